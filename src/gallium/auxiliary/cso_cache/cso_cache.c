@@ -44,36 +44,25 @@ struct cso_cache {
    void                 *sanitize_data;
 };
 
-#if 1
 static unsigned hash_key(const void *key, unsigned key_size)
 {
-   unsigned *ikey = (unsigned *)key;
-   unsigned hash = 0, i;
+   const unsigned *ikey = (const unsigned *)key;
+   unsigned hash = 0x811c9dc5, i;
 
    assert(key_size % 4 == 0);
 
-   /* I'm sure this can be improved on:
+   /* Mix whole words in, FNV style.  A plain xor of the words collides
+    * far too often for state structs that differ only by a swapped pair
+    * of fields (e.g. blend src/dst factors), and every collision costs a
+    * full memcmp of the template.
     */
-   for (i = 0; i < key_size/4; i++)
+   for (i = 0; i < key_size/4; i++) {
       hash ^= ikey[i];
-
-   return hash;
-}
-#else
-static unsigned hash_key(const unsigned char *p, int n)
-{
-   unsigned h = 0;
-   unsigned g;
-
-   while (n--) {
-      h = (h << 4) + *p++;
-      if ((g = (h & 0xf0000000)) != 0)
-         h ^= g >> 23;
-      h &= ~g;
+      hash *= 0x01000193;
    }
-   return h;
+
+   return hash ^ (hash >> 16);
 }
-#endif
 
 unsigned cso_construct_key(void *item, int item_size)
 {
@@ -228,11 +217,20 @@ struct cso_hash_iter cso_find_state_template(struct cso_cache *sc,
 {
    struct cso_hash_iter iter = cso_find_state(sc, hash_key, type);
    while (!cso_hash_iter_is_null(iter)) {
-      void *iter_data = cso_hash_iter_data(iter);
+      void *iter_data;
+
+      /* Nodes with equal keys are adjacent; once the key changes there is
+       * no point in comparing any further templates.
+       */
+      if (cso_hash_iter_key(iter) != hash_key)
+         break;
+
+      iter_data = cso_hash_iter_data(iter);
       if (!memcmp(iter_data, templ, size))
          return iter;
       iter = cso_hash_iter_next(iter);
    }
+   iter.node = NULL;
    return iter;
 }
 
@@ -109,6 +109,19 @@ struct cso_context {
    void *vertex_shader, *vertex_shader_saved, *geometry_shader_saved;
    void *velements, *velements_saved;
 
+   /** The cache entries behind the currently bound blend, DSA and
+    * rasterizer handles, if they were bound through cso_set_*().
+    * Bound entries are never evicted, so these stay valid while the
+    * handle they describe is bound.  Used to detect redundant sets
+    * without hashing the template.
+    */
+   struct cso_blend *blend_cso;
+   struct cso_depth_stencil_alpha *depth_stencil_cso;
+   struct cso_rasterizer *rasterizer_cso;
+
+   /** CSO_BIT_x mask of the state saved by cso_save_state() */
+   unsigned saved_state;
+
    struct pipe_clip_state clip;
    struct pipe_clip_state clip_saved;
 
@@ -333,6 +346,10 @@ void cso_release_all( struct cso_context *ctx )
       cso_cache_delete( ctx->cache );
       ctx->cache = NULL;
    }
+
+   ctx->blend_cso = NULL;
+   ctx->depth_stencil_cso = NULL;
+   ctx->rasterizer_cso = NULL;
 }
 
 
@@ -363,15 +380,20 @@ enum pipe_error cso_set_blend(struct cso_context *ctx,
 {
    unsigned key_size, hash_key;
    struct cso_hash_iter iter;
-   void *handle;
+   struct cso_blend *cso;
 
    key_size = templ->independent_blend_enable ? sizeof(struct pipe_blend_state) :
               (char *)&(templ->rt[1]) - (char *)templ;
+
+   if (ctx->blend_cso &&
+       memcmp(&ctx->blend_cso->state, templ, key_size) == 0)
+      return PIPE_OK;
+
    hash_key = cso_construct_key((void*)templ, key_size);
    iter = cso_find_state_template(ctx->cache, hash_key, CSO_BLEND, (void*)templ, key_size);
 
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_blend *cso = MALLOC(sizeof(struct cso_blend));
+      cso = MALLOC(sizeof(struct cso_blend));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -386,16 +408,15 @@ enum pipe_error cso_set_blend(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    }
    else {
-      handle = ((struct cso_blend *)cso_hash_iter_data(iter))->data;
+      cso = (struct cso_blend *)cso_hash_iter_data(iter);
    }
 
-   if (ctx->blend != handle) {
-      ctx->blend = handle;
-      ctx->pipe->bind_blend_state(ctx->pipe, handle);
+   ctx->blend_cso = cso;
+   if (ctx->blend != cso->data) {
+      ctx->blend = cso->data;
+      ctx->pipe->bind_blend_state(ctx->pipe, cso->data);
    }
    return PIPE_OK;
 }
@@ -409,6 +430,7 @@ void cso_save_blend(struct cso_context *ctx)
 void cso_restore_blend(struct cso_context *ctx)
 {
    if (ctx->blend != ctx->blend_saved) {
+      ctx->blend_cso = NULL;
       ctx->blend = ctx->blend_saved;
       ctx->pipe->bind_blend_state(ctx->pipe, ctx->blend_saved);
    }
@@ -421,15 +443,22 @@ enum pipe_error cso_set_depth_stencil_alpha(struct cso_context *ctx,
                                             const struct pipe_depth_stencil_alpha_state *templ)
 {
    unsigned key_size = sizeof(struct pipe_depth_stencil_alpha_state);
-   unsigned hash_key = cso_construct_key((void*)templ, key_size);
-   struct cso_hash_iter iter = cso_find_state_template(ctx->cache,
-                                                       hash_key, 
-                                                       CSO_DEPTH_STENCIL_ALPHA,
-                                                       (void*)templ, key_size);
-   void *handle;
+   unsigned hash_key;
+   struct cso_hash_iter iter;
+   struct cso_depth_stencil_alpha *cso;
+
+   if (ctx->depth_stencil_cso &&
+       memcmp(&ctx->depth_stencil_cso->state, templ, key_size) == 0)
+      return PIPE_OK;
+
+   hash_key = cso_construct_key((void*)templ, key_size);
+   iter = cso_find_state_template(ctx->cache,
+                                  hash_key,
+                                  CSO_DEPTH_STENCIL_ALPHA,
+                                  (void*)templ, key_size);
 
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_depth_stencil_alpha *cso = MALLOC(sizeof(struct cso_depth_stencil_alpha));
+      cso = MALLOC(sizeof(struct cso_depth_stencil_alpha));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -443,16 +472,15 @@ enum pipe_error cso_set_depth_stencil_alpha(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    }
    else {
-      handle = ((struct cso_depth_stencil_alpha *)cso_hash_iter_data(iter))->data;
+      cso = (struct cso_depth_stencil_alpha *)cso_hash_iter_data(iter);
    }
 
-   if (ctx->depth_stencil != handle) {
-      ctx->depth_stencil = handle;
-      ctx->pipe->bind_depth_stencil_alpha_state(ctx->pipe, handle);
+   ctx->depth_stencil_cso = cso;
+   if (ctx->depth_stencil != cso->data) {
+      ctx->depth_stencil = cso->data;
+      ctx->pipe->bind_depth_stencil_alpha_state(ctx->pipe, cso->data);
    }
    return PIPE_OK;
 }
@@ -466,6 +494,7 @@ void cso_save_depth_stencil_alpha(struct cso_context *ctx)
 void cso_restore_depth_stencil_alpha(struct cso_context *ctx)
 {
    if (ctx->depth_stencil != ctx->depth_stencil_saved) {
+      ctx->depth_stencil_cso = NULL;
       ctx->depth_stencil = ctx->depth_stencil_saved;
       ctx->pipe->bind_depth_stencil_alpha_state(ctx->pipe, ctx->depth_stencil_saved);
    }
@@ -478,14 +507,21 @@ enum pipe_error cso_set_rasterizer(struct cso_context *ctx,
                                    const struct pipe_rasterizer_state *templ)
 {
    unsigned key_size = sizeof(struct pipe_rasterizer_state);
-   unsigned hash_key = cso_construct_key((void*)templ, key_size);
-   struct cso_hash_iter iter = cso_find_state_template(ctx->cache,
-                                                       hash_key, CSO_RASTERIZER,
-                                                       (void*)templ, key_size);
-   void *handle = NULL;
+   unsigned hash_key;
+   struct cso_hash_iter iter;
+   struct cso_rasterizer *cso;
+
+   if (ctx->rasterizer_cso &&
+       memcmp(&ctx->rasterizer_cso->state, templ, key_size) == 0)
+      return PIPE_OK;
+
+   hash_key = cso_construct_key((void*)templ, key_size);
+   iter = cso_find_state_template(ctx->cache,
+                                  hash_key, CSO_RASTERIZER,
+                                  (void*)templ, key_size);
 
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_rasterizer *cso = MALLOC(sizeof(struct cso_rasterizer));
+      cso = MALLOC(sizeof(struct cso_rasterizer));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -499,16 +535,15 @@ enum pipe_error cso_set_rasterizer(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    }
    else {
-      handle = ((struct cso_rasterizer *)cso_hash_iter_data(iter))->data;
+      cso = (struct cso_rasterizer *)cso_hash_iter_data(iter);
    }
 
-   if (ctx->rasterizer != handle) {
-      ctx->rasterizer = handle;
-      ctx->pipe->bind_rasterizer_state(ctx->pipe, handle);
+   ctx->rasterizer_cso = cso;
+   if (ctx->rasterizer != cso->data) {
+      ctx->rasterizer = cso->data;
+      ctx->pipe->bind_rasterizer_state(ctx->pipe, cso->data);
    }
    return PIPE_OK;
 }
@@ -522,6 +557,7 @@ void cso_save_rasterizer(struct cso_context *ctx)
 void cso_restore_rasterizer(struct cso_context *ctx)
 {
    if (ctx->rasterizer != ctx->rasterizer_saved) {
+      ctx->rasterizer_cso = NULL;
       ctx->rasterizer = ctx->rasterizer_saved;
       ctx->pipe->bind_rasterizer_state(ctx->pipe, ctx->rasterizer_saved);
    }
@@ -1338,6 +1374,102 @@ cso_restore_stream_outputs(struct cso_context *ctx)
    ctx->nr_so_targets_saved = 0;
 }
 
+/**
+ * Save the state selected by the CSO_BIT_x flags in state_mask.
+ */
+void
+cso_save_state(struct cso_context *ctx, unsigned state_mask)
+{
+   assert(ctx->saved_state == 0);
+
+   ctx->saved_state = state_mask;
+
+   if (state_mask & CSO_BIT_BLEND)
+      cso_save_blend(ctx);
+   if (state_mask & CSO_BIT_DEPTH_STENCIL_ALPHA)
+      cso_save_depth_stencil_alpha(ctx);
+   if (state_mask & CSO_BIT_RASTERIZER)
+      cso_save_rasterizer(ctx);
+   if (state_mask & CSO_BIT_STENCIL_REF)
+      cso_save_stencil_ref(ctx);
+   if (state_mask & CSO_BIT_VIEWPORT)
+      cso_save_viewport(ctx);
+   if (state_mask & CSO_BIT_CLIP)
+      cso_save_clip(ctx);
+   if (state_mask & CSO_BIT_FRAMEBUFFER)
+      cso_save_framebuffer(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SHADER)
+      cso_save_fragment_shader(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SHADER)
+      cso_save_vertex_shader(ctx);
+   if (state_mask & CSO_BIT_GEOMETRY_SHADER)
+      cso_save_geometry_shader(ctx);
+   if (state_mask & CSO_BIT_VERTEX_ELEMENTS)
+      cso_save_vertex_elements(ctx);
+   if (state_mask & CSO_BIT_VERTEX_BUFFERS)
+      cso_save_vertex_buffers(ctx);
+   if (state_mask & CSO_BIT_STREAM_OUTPUTS)
+      cso_save_stream_outputs(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SAMPLERS)
+      cso_save_samplers(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SAMPLER_VIEWS)
+      cso_save_fragment_sampler_views(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SAMPLERS)
+      cso_save_vertex_samplers(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SAMPLER_VIEWS)
+      cso_save_vertex_sampler_views(ctx);
+}
+
+
+/**
+ * Restore the state which was saved by cso_save_state().
+ */
+void
+cso_restore_state(struct cso_context *ctx)
+{
+   unsigned state_mask = ctx->saved_state;
+
+   assert(state_mask);
+
+   if (state_mask & CSO_BIT_BLEND)
+      cso_restore_blend(ctx);
+   if (state_mask & CSO_BIT_DEPTH_STENCIL_ALPHA)
+      cso_restore_depth_stencil_alpha(ctx);
+   if (state_mask & CSO_BIT_RASTERIZER)
+      cso_restore_rasterizer(ctx);
+   if (state_mask & CSO_BIT_STENCIL_REF)
+      cso_restore_stencil_ref(ctx);
+   if (state_mask & CSO_BIT_VIEWPORT)
+      cso_restore_viewport(ctx);
+   if (state_mask & CSO_BIT_CLIP)
+      cso_restore_clip(ctx);
+   if (state_mask & CSO_BIT_FRAMEBUFFER)
+      cso_restore_framebuffer(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SHADER)
+      cso_restore_fragment_shader(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SHADER)
+      cso_restore_vertex_shader(ctx);
+   if (state_mask & CSO_BIT_GEOMETRY_SHADER)
+      cso_restore_geometry_shader(ctx);
+   if (state_mask & CSO_BIT_VERTEX_ELEMENTS)
+      cso_restore_vertex_elements(ctx);
+   if (state_mask & CSO_BIT_VERTEX_BUFFERS)
+      cso_restore_vertex_buffers(ctx);
+   if (state_mask & CSO_BIT_STREAM_OUTPUTS)
+      cso_restore_stream_outputs(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SAMPLERS)
+      cso_restore_samplers(ctx);
+   if (state_mask & CSO_BIT_FRAGMENT_SAMPLER_VIEWS)
+      cso_restore_fragment_sampler_views(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SAMPLERS)
+      cso_restore_vertex_samplers(ctx);
+   if (state_mask & CSO_BIT_VERTEX_SAMPLER_VIEWS)
+      cso_restore_vertex_sampler_views(ctx);
+
+   ctx->saved_state = 0;
+}
+
+
 /* drawing */
 
 void
@@ -220,6 +220,36 @@ cso_save_vertex_sampler_views(struct cso_context *cso);
 void
 cso_restore_vertex_sampler_views(struct cso_context *cso);
 
+/* Save and restore whole groups of state at once, for meta operations
+ * (clears, blits, bitmaps) that need to clobber several pieces of state.
+ * Like the individual save/restore calls this is a 1-deep stack.
+ */
+
+#define CSO_BIT_BLEND                  0x1
+#define CSO_BIT_DEPTH_STENCIL_ALPHA    0x2
+#define CSO_BIT_RASTERIZER             0x4
+#define CSO_BIT_STENCIL_REF            0x8
+#define CSO_BIT_VIEWPORT               0x10
+#define CSO_BIT_CLIP                   0x20
+#define CSO_BIT_FRAMEBUFFER            0x40
+#define CSO_BIT_FRAGMENT_SHADER        0x80
+#define CSO_BIT_VERTEX_SHADER          0x100
+#define CSO_BIT_GEOMETRY_SHADER        0x200
+#define CSO_BIT_VERTEX_ELEMENTS        0x400
+#define CSO_BIT_VERTEX_BUFFERS         0x800
+#define CSO_BIT_STREAM_OUTPUTS         0x1000
+#define CSO_BIT_FRAGMENT_SAMPLERS      0x2000
+#define CSO_BIT_FRAGMENT_SAMPLER_VIEWS 0x4000
+#define CSO_BIT_VERTEX_SAMPLERS        0x8000
+#define CSO_BIT_VERTEX_SAMPLER_VIEWS   0x10000
+
+void
+cso_save_state(struct cso_context *cso, unsigned state_mask);
+
+void
+cso_restore_state(struct cso_context *cso);
+
+
 /* drawing */
 
 void
@@ -24,21 +24,281 @@
 
 #include "u_indices.h"
 #include "u_indices_priv.h"
+#include "util/u_math.h"
+#include "util/u_prim.h"
+#include "util/u_sse.h"
 
-static void translate_memcpy_ushort( const void *in,
-                                     unsigned nr,
-                                     void *out )
+
+unsigned u_index_translate_memcpy_ushort( const void *in,
+                                          unsigned in_nr,
+                                          unsigned nr,
+                                          unsigned restart_index,
+                                          void *out )
 {
    memcpy(out, in, nr*sizeof(short));
+   return nr;
 }
                               
-static void translate_memcpy_uint( const void *in,
-                                   unsigned nr,
-                                   void *out )
+unsigned u_index_translate_memcpy_uint( const void *in,
+                                        unsigned in_nr,
+                                        unsigned nr,
+                                        unsigned restart_index,
+                                        void *out )
 {
    memcpy(out, in, nr*sizeof(int));
+   return nr;
 }
-                              
+
+
+/**
+ * Widen ubyte indices to ushort, keeping the primitive as it is.
+ */
+unsigned u_index_translate_ubyte_ushort( const void *in,
+                                         unsigned in_nr,
+                                         unsigned nr,
+                                         unsigned restart_index,
+                                         void *out )
+{
+   const ubyte *in_ub = (const ubyte *)in;
+   ushort *out_us = (ushort *)out;
+   unsigned i = 0;
+
+#if defined(PIPE_ARCH_SSE)
+   {
+      const __m128i zero = _mm_setzero_si128();
+
+      for (; i + 16 <= nr; i += 16) {
+         __m128i v = _mm_loadu_si128((const __m128i *)(in_ub + i));
+         _mm_storeu_si128((__m128i *)(out_us + i), _mm_unpacklo_epi8(v, zero));
+         _mm_storeu_si128((__m128i *)(out_us + i + 8), _mm_unpackhi_epi8(v, zero));
+      }
+   }
+#endif
+
+   for (; i < nr; i++)
+      out_us[i] = (ushort) in_ub[i];
+   return nr;
+}
+
+
+#if defined(PIPE_ARCH_SSE)
+
+/*
+ * Quads to triangles with matching provoking vertex conventions, two
+ * quads (v0..v3, w0..w3) at a time, emitting v0 v1 v3, v1 v2 v3,
+ * w0 w1 w3, w1 w2 w3 like the generated code.
+ */
+
+static unsigned translate_quads_ushort2ushort_sse2( const void *in,
+                                                    unsigned in_nr,
+                                                    unsigned nr,
+                                                    unsigned restart_index,
+                                                    void *out )
+{
+   const ushort *in_us = (const ushort *)in;
+   ushort *out_us = (ushort *)out;
+   unsigned i, j;
+
+   for (i = j = 0; j + 12 <= nr; i += 8, j += 12) {
+      __m128i q = _mm_loadu_si128((const __m128i *)(in_us + i));
+      __m128i t = _mm_shufflelo_epi16(q, _MM_SHUFFLE(1, 3, 1, 0));
+
+      t = _mm_shufflehi_epi16(t, _MM_SHUFFLE(1, 3, 1, 0));
+
+      /* v0 v1 v3 v1 | v2 v3 | w0 w1 w3 w1 | w2 w3 */
+      _mm_storel_epi64((__m128i *)(out_us + j), t);
+      out_us[j + 4] = in_us[i + 2];
+      out_us[j + 5] = in_us[i + 3];
+      _mm_storel_epi64((__m128i *)(out_us + j + 6), _mm_unpackhi_epi64(t, t));
+      out_us[j + 10] = in_us[i + 6];
+      out_us[j + 11] = in_us[i + 7];
+   }
+
+   if (j < nr) {
+      out_us[j + 0] = in_us[i + 0];
+      out_us[j + 1] = in_us[i + 1];
+      out_us[j + 2] = in_us[i + 3];
+      out_us[j + 3] = in_us[i + 1];
+      out_us[j + 4] = in_us[i + 2];
+      out_us[j + 5] = in_us[i + 3];
+   }
+   return nr;
+}
+
+static unsigned translate_quads_uint2uint_sse2( const void *in,
+                                                unsigned in_nr,
+                                                unsigned nr,
+                                                unsigned restart_index,
+                                                void *out )
+{
+   const uint *in_ui = (const uint *)in;
+   uint *out_ui = (uint *)out;
+   unsigned i, j;
+
+   for (i = j = 0; j + 12 <= nr; i += 8, j += 12) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(in_ui + i));
+      __m128i w = _mm_loadu_si128((const __m128i *)(in_ui + i + 4));
+
+      /* v0 v1 v3 v1 | v2 v3 w0 w1 | w3 w1 w2 w3 */
+      _mm_storeu_si128((__m128i *)(out_ui + j),
+                       _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 3, 1, 0)));
+      _mm_storeu_si128((__m128i *)(out_ui + j + 4),
+                       _mm_unpacklo_epi64(_mm_unpackhi_epi64(v, v), w));
+      _mm_storeu_si128((__m128i *)(out_ui + j + 8),
+                       _mm_shuffle_epi32(w, _MM_SHUFFLE(3, 2, 1, 3)));
+   }
+
+   if (j < nr) {
+      out_ui[j + 0] = in_ui[i + 0];
+      out_ui[j + 1] = in_ui[i + 1];
+      out_ui[j + 2] = in_ui[i + 3];
+      out_ui[j + 3] = in_ui[i + 1];
+      out_ui[j + 4] = in_ui[i + 2];
+      out_ui[j + 5] = in_ui[i + 3];
+   }
+   return nr;
+}
+
+#endif /* PIPE_ARCH_SSE */
+
+
+/**
+ * Return the position of the first restart index in in[start..nr-1],
+ * or nr if there is none.
+ */
+static unsigned find_restart( const void *in,
+                              unsigned index_size,
+                              unsigned start,
+                              unsigned nr,
+                              unsigned restart_index )
+{
+   unsigned i = start;
+
+   /* A restart index wider than the indices never matches */
+   if (index_size < 4 && restart_index >> (index_size * 8))
+      return nr;
+
+#if defined(PIPE_ARCH_SSE)
+   {
+      const ubyte *in_ub = (const ubyte *)in;
+      unsigned step = 16 / index_size;
+      __m128i r;
+
+      switch (index_size) {
+      case 1: r = _mm_set1_epi8((char) restart_index); break;
+      case 2: r = _mm_set1_epi16((short) restart_index); break;
+      default: r = _mm_set1_epi32((int) restart_index); break;
+      }
+
+      for (; i + step <= nr; i += step) {
+         __m128i v = _mm_loadu_si128((const __m128i *)(in_ub + i * index_size));
+         __m128i eq;
+         int mask;
+
+         switch (index_size) {
+         case 1: eq = _mm_cmpeq_epi8(v, r); break;
+         case 2: eq = _mm_cmpeq_epi16(v, r); break;
+         default: eq = _mm_cmpeq_epi32(v, r); break;
+         }
+
+         mask = _mm_movemask_epi8(eq);
+         if (mask)
+            return i + (ffs(mask) - 1) / index_size;
+      }
+   }
+#endif
+
+   switch (index_size) {
+   case 1:
+      for (; i < nr; i++)
+         if (((const ubyte *)in)[i] == restart_index)
+            return i;
+      break;
+   case 2:
+      for (; i < nr; i++)
+         if (((const ushort *)in)[i] == restart_index)
+            return i;
+      break;
+   default:
+      for (; i < nr; i++)
+         if (((const uint *)in)[i] == restart_index)
+            return i;
+      break;
+   }
+
+   return nr;
+}
+
+
+/**
+ * Translate an index list with primitive restart: run translate on
+ * each sub-primitive between restart indices, with segment_nr giving
+ * the number of output indices of a sub-primitive, and append them all
+ * to out.  Returns the number of indices written.
+ */
+unsigned u_index_translate_restart( const void *in,
+                                    unsigned in_index_size,
+                                    unsigned in_nr,
+                                    unsigned restart_index,
+                                    void *out,
+                                    unsigned out_index_size,
+                                    unsigned prim,
+                                    u_segment_nr_func segment_nr,
+                                    u_translate_func translate )
+{
+   const ubyte *in_ub = (const ubyte *)in;
+   ubyte *out_ub = (ubyte *)out;
+   unsigned start = 0, out_nr = 0;
+
+   while (start < in_nr) {
+      unsigned end = find_restart(in, in_index_size, start, in_nr,
+                                  restart_index);
+      unsigned nr = segment_nr(prim, end - start);
+
+      if (nr)
+         out_nr += translate(in_ub + start * in_index_size, end - start, nr,
+                             restart_index,
+                             out_ub + out_nr * out_index_size);
+
+      start = end + 1;
+   }
+
+   return out_nr;
+}
+
+
+/**
+ * Number of indices the translation of an nr-vertex primitive without
+ * restarts produces, dropping incomplete trailing primitives.
+ */
+unsigned u_index_segment_nr( unsigned prim,
+                             unsigned nr )
+{
+   switch (prim) {
+   case PIPE_PRIM_POINTS:
+      return nr;
+   case PIPE_PRIM_LINES:
+      return nr & ~1;
+   case PIPE_PRIM_LINE_STRIP:
+      return nr >= 2 ? (nr - 1) * 2 : 0;
+   case PIPE_PRIM_LINE_LOOP:
+      return nr >= 2 ? nr * 2 : 0;
+   case PIPE_PRIM_TRIANGLES:
+      return (nr / 3) * 3;
+   case PIPE_PRIM_TRIANGLE_STRIP:
+   case PIPE_PRIM_TRIANGLE_FAN:
+   case PIPE_PRIM_POLYGON:
+      return nr >= 3 ? (nr - 2) * 3 : 0;
+   case PIPE_PRIM_QUADS:
+      return (nr / 4) * 6;
+   case PIPE_PRIM_QUAD_STRIP:
+      return nr >= 4 ? ((nr - 2) / 2) * 6 : 0;
+   default:
+      assert(0);
+      return 0;
+   }
+}
+
 
 int u_index_translator( unsigned hw_mask,
                         unsigned prim,
@@ -46,6 +306,7 @@ int u_index_translator( unsigned hw_mask,
                         unsigned nr,
                         unsigned in_pv,
                         unsigned out_pv,
+                        boolean primitive_restart,
                         unsigned *out_prim,
                         unsigned *out_index_size,
                         unsigned *out_nr,
@@ -61,18 +322,34 @@ int u_index_translator( unsigned hw_mask,
    *out_index_size = (in_index_size == 4) ? 4 : 2;
    out_idx = out_size_idx(*out_index_size);
 
-   if ((hw_mask & (1<<prim)) && 
-       in_index_size == *out_index_size &&
-       in_pv == out_pv) 
+   if (primitive_restart) {
+      /* The sub-primitives are joined into a single list, with the
+       * restart indices dropped.
+       */
+      if (prim >= PRIM_COUNT) {
+         assert(0);
+         return U_TRANSLATE_ERROR;
+      }
+      *out_translate = translate_restart[in_idx][out_idx][in_pv][out_pv][prim];
+      *out_prim = u_reduced_prim(prim);
+      *out_nr = u_index_segment_nr(prim, nr);
+   }
+   else if ((hw_mask & (1<<prim)) && 
+            in_pv == out_pv) 
    {
-      if (in_index_size == 4)
-         *out_translate = translate_memcpy_uint;
-      else
-         *out_translate = translate_memcpy_ushort;
-
       *out_prim = prim;
       *out_nr = nr;
 
+      if (in_index_size == 1) {
+         *out_translate = u_index_translate_ubyte_ushort;
+         return U_TRANSLATE_NORMAL;
+      }
+
+      if (in_index_size == 4)
+         *out_translate = u_index_translate_memcpy_uint;
+      else
+         *out_translate = u_index_translate_memcpy_ushort;
+
       return U_TRANSLATE_MEMCPY;
    }
    else {
@@ -121,6 +398,12 @@ int u_index_translator( unsigned hw_mask,
 
       case PIPE_PRIM_QUADS:
          *out_translate = translate[in_idx][out_idx][in_pv][out_pv][prim];
+#if defined(PIPE_ARCH_SSE)
+         if (in_pv == out_pv && in_idx == IN_USHORT)
+            *out_translate = translate_quads_ushort2ushort_sse2;
+         else if (in_pv == out_pv && in_idx == IN_UINT)
+            *out_translate = translate_quads_uint2uint_sse2;
+#endif
          *out_prim = PIPE_PRIM_TRIANGLES;
          *out_nr = (nr / 4) * 6;
          break;
@@ -128,7 +411,7 @@ int u_index_translator( unsigned hw_mask,
       case PIPE_PRIM_QUAD_STRIP:
          *out_translate = translate[in_idx][out_idx][in_pv][out_pv][prim];
          *out_prim = PIPE_PRIM_TRIANGLES;
-         *out_nr = (nr - 2) * 3;
+         *out_nr = ((nr - 2) / 2) * 6;
          break;
 
       case PIPE_PRIM_POLYGON:
@@ -139,7 +422,8 @@ int u_index_translator( unsigned hw_mask,
 
       default:
          assert(0);
-         *out_translate = translate[in_idx][out_idx][in_pv][out_pv][prim];
+         *out_translate =
+            translate[in_idx][out_idx][in_pv][out_pv][PIPE_PRIM_POINTS];
          *out_prim = PIPE_PRIM_POINTS;
          *out_nr = nr;
          return U_TRANSLATE_ERROR;
@@ -31,9 +31,17 @@
 #define PV_LAST       1
 #define PV_COUNT      2
 
-typedef void (*u_translate_func)( const void *in,
-                                  unsigned nr,
-                                  void *out );
+/* Translate in_nr indices from in to out_nr indices in out.  When
+ * translating with primitive restart, restart_index delimits the
+ * sub-primitives, which come out as one list with the restart indices
+ * dropped, so out_nr is only an upper bound.  Returns the number of
+ * indices actually written.
+ */
+typedef unsigned (*u_translate_func)( const void *in,
+                                      unsigned in_nr,
+                                      unsigned out_nr,
+                                      unsigned restart_index,
+                                      void *out );
 
 typedef void (*u_generate_func)( unsigned nr,
                                  void *out );
@@ -58,6 +66,7 @@ int u_index_translator( unsigned hw_mask,
                         unsigned nr,
                         unsigned in_pv,   /* API */
                         unsigned out_pv,  /* hardware */
+                        boolean primitive_restart,
                         unsigned *out_prim,
                         unsigned *out_index_size,
                         unsigned *out_nr,
@@ -86,6 +95,7 @@ int u_unfilled_translator( unsigned prim,
                            unsigned in_index_size,
                            unsigned nr,
                            unsigned unfilled_mode,
+                           boolean primitive_restart,
                            unsigned *out_prim,
                            unsigned *out_index_size,
                            unsigned *out_nr,
@@ -98,6 +98,7 @@ static unsigned in_size_idx( unsigned index_size )
 
 
 static u_translate_func translate[IN_COUNT][OUT_COUNT][PV_COUNT][PV_COUNT][PRIM_COUNT];
+static u_translate_func translate_restart[IN_COUNT][OUT_COUNT][PV_COUNT][PV_COUNT][PRIM_COUNT];
 static u_generate_func  generate[OUT_COUNT][PV_COUNT][PV_COUNT][PRIM_COUNT];
 
 
@@ -150,10 +151,15 @@ def name(intype, outtype, inpv, outpv, prim):
         return 'translate_' + prim + '_' + intype + '2' + outtype + '_' + inpv + '2' + outpv
 
 def preamble(intype, outtype, inpv, outpv, prim):
-    print 'static void ' + name( intype, outtype, inpv, outpv, prim ) + '('
-    if intype != GENERATE:
+    if intype == GENERATE:
+        print 'static void ' + name( intype, outtype, inpv, outpv, prim ) + '('
+    else:
+        print 'static unsigned ' + name( intype, outtype, inpv, outpv, prim ) + '('
         print '    const void * _in,'
+        print '    unsigned in_nr,'
     print '    unsigned nr,'
+    if intype != GENERATE:
+        print '    unsigned restart_index,'
     print '    void *_out )'
     print '{'
     if intype != GENERATE:
@@ -161,8 +167,32 @@ def preamble(intype, outtype, inpv, outpv, prim):
     print '  ' + outtype + ' *out = (' + outtype + '*)_out;'
     print '  unsigned i, j;'
     print '  (void)j;'
+    if intype != GENERATE:
+        print '  (void)in_nr;'
+        print '  (void)restart_index;'
 
-def postamble():
+def postamble(intype):
+    if intype != GENERATE:
+        print '  return nr;'
+    print '}'
+
+
+# The primitive restart variants split the input at the restart indices
+# and run the plain translate function on each sub-primitive, appending
+# the results to one list.
+def restart(intype, outtype, inpv, outpv, prim):
+    print 'static unsigned ' + name( intype, outtype, inpv, outpv, prim ) + '_restart('
+    print '    const void * _in,'
+    print '    unsigned in_nr,'
+    print '    unsigned nr,'
+    print '    unsigned restart_index,'
+    print '    void *_out )'
+    print '{'
+    print '  (void)nr;'
+    print ('  return u_index_translate_restart( _in, sizeof(' + intype + '), in_nr, restart_index,')
+    print ('                                    _out, sizeof(' + outtype + '), ' + longprim[prim] + ',')
+    print ('                                    u_index_segment_nr,')
+    print ('                                    ' + name( intype, outtype, inpv, outpv, prim ) + ' );')
     print '}'
 
 
@@ -171,21 +201,21 @@ def points(intype, outtype, inpv, outpv):
     print '  for (i = 0; i < nr; i++) { '
     do_point( intype, outtype, 'out+i',  'i' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 def lines(intype, outtype, inpv, outpv):
     preamble(intype, outtype, inpv, outpv, prim='lines')
     print '  for (i = 0; i < nr; i+=2) { '
     do_line( intype, outtype, 'out+i',  'i', 'i+1', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 def linestrip(intype, outtype, inpv, outpv):
     preamble(intype, outtype, inpv, outpv, prim='linestrip')
     print '  for (j = i = 0; j < nr; j+=2, i++) { '
     do_line( intype, outtype, 'out+j',  'i', 'i+1', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 def lineloop(intype, outtype, inpv, outpv):
     preamble(intype, outtype, inpv, outpv, prim='lineloop')
@@ -193,14 +223,14 @@ def lineloop(intype, outtype, inpv, outpv):
     do_line( intype, outtype, 'out+j',  'i', 'i+1', inpv, outpv );
     print '   }'
     do_line( intype, outtype, 'out+j',  'i', '0', inpv, outpv );
-    postamble()
+    postamble(intype)
 
 def tris(intype, outtype, inpv, outpv):
     preamble(intype, outtype, inpv, outpv, prim='tris')
     print '  for (i = 0; i < nr; i+=3) { '
     do_tri( intype, outtype, 'out+i',  'i', 'i+1', 'i+2', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def tristrip(intype, outtype, inpv, outpv):
@@ -211,7 +241,7 @@ def tristrip(intype, outtype, inpv, outpv):
     else:
         do_tri( intype, outtype, 'out+j',  'i+(i&1)', 'i+1-(i&1)', 'i+2', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def trifan(intype, outtype, inpv, outpv):
@@ -219,7 +249,7 @@ def trifan(intype, outtype, inpv, outpv):
     print '  for (j = i = 0; j < nr; j+=3, i++) { '
     do_tri( intype, outtype, 'out+j',  '0', 'i+1', 'i+2', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 
@@ -231,7 +261,7 @@ def polygon(intype, outtype, inpv, outpv):
     else:
         do_tri( intype, outtype, 'out+j',  'i+1', 'i+2', '0', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def quads(intype, outtype, inpv, outpv):
@@ -239,7 +269,7 @@ def quads(intype, outtype, inpv, outpv):
     print '  for (j = i = 0; j < nr; j+=6, i+=4) { '
     do_quad( intype, outtype, 'out+j', 'i+0', 'i+1', 'i+2', 'i+3', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def quadstrip(intype, outtype, inpv, outpv):
@@ -247,7 +277,7 @@ def quadstrip(intype, outtype, inpv, outpv):
     print '  for (j = i = 0; j < nr; j+=6, i+=2) { '
     do_quad( intype, outtype, 'out+j', 'i+2', 'i+0', 'i+1', 'i+3', inpv, outpv );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def emit_funcs():
@@ -265,6 +295,9 @@ def emit_funcs():
                     quads(intype, outtype, inpv, outpv)
                     quadstrip(intype, outtype, inpv, outpv)
                     polygon(intype, outtype, inpv, outpv)
+                    if intype != GENERATE:
+                        for prim in PRIMS:
+                            restart(intype, outtype, inpv, outpv, prim)
 
 def init(intype, outtype, inpv, outpv, prim):
     if intype == GENERATE:
@@ -282,6 +315,13 @@ def init(intype, outtype, inpv, outpv, prim):
                '][' + pv_idx[outpv] + 
                '][' + longprim[prim] + 
                '] = ' + name( intype, outtype, inpv, outpv, prim ) + ';')
+        print ('translate_restart[' + 
+               intype_idx[intype] + 
+               '][' + outtype_idx[outtype] + 
+               '][' + pv_idx[inpv] + 
+               '][' + pv_idx[outpv] + 
+               '][' + longprim[prim] + 
+               '] = ' + name( intype, outtype, inpv, outpv, prim ) + '_restart;')
 
 
 def emit_all_inits():
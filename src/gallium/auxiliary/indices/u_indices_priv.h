@@ -40,4 +40,40 @@
 
 #define PRIM_COUNT   (PIPE_PRIM_POLYGON + 1)
 
+
+/* Number of output indices for a sub-primitive of nr vertices */
+typedef unsigned (*u_segment_nr_func)( unsigned prim,
+                                       unsigned nr );
+
+unsigned u_index_segment_nr( unsigned prim,
+                             unsigned nr );
+
+unsigned u_index_translate_restart( const void *in,
+                                    unsigned in_index_size,
+                                    unsigned in_nr,
+                                    unsigned restart_index,
+                                    void *out,
+                                    unsigned out_index_size,
+                                    unsigned prim,
+                                    u_segment_nr_func segment_nr,
+                                    u_translate_func translate );
+
+unsigned u_index_translate_ubyte_ushort( const void *in,
+                                         unsigned in_nr,
+                                         unsigned nr,
+                                         unsigned restart_index,
+                                         void *out );
+
+unsigned u_index_translate_memcpy_ushort( const void *in,
+                                          unsigned in_nr,
+                                          unsigned nr,
+                                          unsigned restart_index,
+                                          void *out );
+
+unsigned u_index_translate_memcpy_uint( const void *in,
+                                        unsigned in_nr,
+                                        unsigned nr,
+                                        unsigned restart_index,
+                                        void *out );
+
 #endif
@@ -89,6 +89,9 @@ static unsigned in_size_idx( unsigned index_size )
 
 static u_generate_func generate_line[OUT_COUNT][PRIM_COUNT];
 static u_translate_func translate_line[IN_COUNT][OUT_COUNT][PRIM_COUNT];
+static u_translate_func translate_line_restart[IN_COUNT][OUT_COUNT][PRIM_COUNT];
+
+static unsigned nr_lines( unsigned prim, unsigned nr );
 
 '''
 
@@ -124,10 +127,15 @@ def name(intype, outtype, prim):
         return 'translate_' + prim + '_' + intype + '2' + outtype
 
 def preamble(intype, outtype, prim):
-    print 'static void ' + name( intype, outtype, prim ) + '('
-    if intype != GENERATE:
+    if intype == GENERATE:
+        print 'static void ' + name( intype, outtype, prim ) + '('
+    else:
+        print 'static unsigned ' + name( intype, outtype, prim ) + '('
         print '    const void * _in,'
+        print '    unsigned in_nr,'
     print '    unsigned nr,'
+    if intype != GENERATE:
+        print '    unsigned restart_index,'
     print '    void *_out )'
     print '{'
     if intype != GENERATE:
@@ -135,8 +143,30 @@ def preamble(intype, outtype, prim):
     print '  ' + outtype + ' *out = (' + outtype + '*)_out;'
     print '  unsigned i, j;'
     print '  (void)j;'
+    if intype != GENERATE:
+        print '  (void)in_nr;'
+        print '  (void)restart_index;'
+
+def postamble(intype):
+    if intype != GENERATE:
+        print '  return nr;'
+    print '}'
+
 
-def postamble():
+# See u_indices_gen.py
+def restart(intype, outtype, prim):
+    print 'static unsigned ' + name( intype, outtype, prim ) + '_restart('
+    print '    const void * _in,'
+    print '    unsigned in_nr,'
+    print '    unsigned nr,'
+    print '    unsigned restart_index,'
+    print '    void *_out )'
+    print '{'
+    print '  (void)nr;'
+    print ('  return u_index_translate_restart( _in, sizeof(' + intype + '), in_nr, restart_index,')
+    print ('                                    _out, sizeof(' + outtype + '), ' + longprim[prim] + ',')
+    print ('                                    nr_lines,')
+    print ('                                    ' + name( intype, outtype, prim ) + ' );')
     print '}'
 
 
@@ -145,7 +175,7 @@ def tris(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=6, i+=3) { '
     do_tri( intype, outtype, 'out+j',  'i', 'i+1', 'i+2' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def tristrip(intype, outtype):
@@ -153,7 +183,7 @@ def tristrip(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=6, i++) { '
     do_tri( intype, outtype, 'out+j',  'i', 'i+1/*+(i&1)*/', 'i+2/*-(i&1)*/' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def trifan(intype, outtype):
@@ -161,7 +191,7 @@ def trifan(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=6, i++) { '
     do_tri( intype, outtype, 'out+j',  '0', 'i+1', 'i+2' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 
@@ -170,7 +200,7 @@ def polygon(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=2, i++) { '
     line( intype, outtype, 'out+j', 'i', '(i+1)%(nr/2)' )
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def quads(intype, outtype):
@@ -178,7 +208,7 @@ def quads(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=8, i+=4) { '
     do_quad( intype, outtype, 'out+j', 'i+0', 'i+1', 'i+2', 'i+3' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def quadstrip(intype, outtype):
@@ -186,7 +216,7 @@ def quadstrip(intype, outtype):
     print '  for (j = i = 0; j < nr; j+=8, i+=2) { '
     do_quad( intype, outtype, 'out+j', 'i+2', 'i+0', 'i+1', 'i+3' );
     print '   }'
-    postamble()
+    postamble(intype)
 
 
 def emit_funcs():
@@ -198,6 +228,9 @@ def emit_funcs():
             quads(intype, outtype)
             quadstrip(intype, outtype)
             polygon(intype, outtype)
+            if intype != GENERATE:
+                for prim in PRIMS:
+                    restart(intype, outtype, prim)
 
 def init(intype, outtype, prim):
     if intype == GENERATE:
@@ -211,6 +244,11 @@ def init(intype, outtype, prim):
                '][' + outtype_idx[outtype] + 
                '][' + longprim[prim] + 
                '] = ' + name( intype, outtype, prim ) + ';')
+        print ('translate_line_restart[' + 
+               intype_idx[intype] + 
+               '][' + outtype_idx[outtype] + 
+               '][' + longprim[prim] + 
+               '] = ' + name( intype, outtype, prim ) + '_restart;')
 
 
 def emit_all_inits():
@@ -26,29 +26,42 @@
 #include "u_indices_priv.h"
 
 
-static void translate_ubyte_ushort( const void *in,
-                                    unsigned nr,
-                                    void *out )
+/* Points mode with primitive restart just drops the restart indices */
+
+static unsigned translate_points_ubyte2ushort_restart( const void *in,
+                                                       unsigned in_nr,
+                                                       unsigned nr,
+                                                       unsigned restart_index,
+                                                       void *out )
 {
-   const ubyte *in_ub = (const ubyte *)in;
-   ushort *out_us = (ushort *)out;
-   unsigned i;
-   for (i = 0; i < nr; i++)
-      out_us[i] = (ushort) in_ub[i];
+   return u_index_translate_restart( in, 1, in_nr, restart_index,
+                                     out, 2, PIPE_PRIM_POINTS,
+                                     u_index_segment_nr,
+                                     u_index_translate_ubyte_ushort );
 }
 
-static void translate_memcpy_ushort( const void *in,
-                                     unsigned nr,
-                                     void *out )
+static unsigned translate_points_ushort2ushort_restart( const void *in,
+                                                        unsigned in_nr,
+                                                        unsigned nr,
+                                                        unsigned restart_index,
+                                                        void *out )
 {
-   memcpy(out, in, nr*sizeof(short));
+   return u_index_translate_restart( in, 2, in_nr, restart_index,
+                                     out, 2, PIPE_PRIM_POINTS,
+                                     u_index_segment_nr,
+                                     u_index_translate_memcpy_ushort );
 }
-                              
-static void translate_memcpy_uint( const void *in,
-                                   unsigned nr,
-                                   void *out )
+
+static unsigned translate_points_uint2uint_restart( const void *in,
+                                                    unsigned in_nr,
+                                                    unsigned nr,
+                                                    unsigned restart_index,
+                                                    void *out )
 {
-   memcpy(out, in, nr*sizeof(int));
+   return u_index_translate_restart( in, 4, in_nr, restart_index,
+                                     out, 4, PIPE_PRIM_POINTS,
+                                     u_index_segment_nr,
+                                     u_index_translate_memcpy_uint );
 }
 
 
@@ -74,7 +87,8 @@ static void generate_linear_uint( unsigned nr,
 /**
  * Given a primitive type and number of vertices, return the number of vertices
  * needed to draw the primitive with fill mode = PIPE_POLYGON_MODE_LINE using
- * separate lines (PIPE_PRIM_LINES).
+ * separate lines (PIPE_PRIM_LINES).  Incomplete primitives are dropped, as
+ * the sub-primitives of a restart draw are not trimmed.
  */
 static unsigned nr_lines( unsigned prim,
                           unsigned nr )
@@ -83,15 +97,15 @@ static unsigned nr_lines( unsigned prim,
    case PIPE_PRIM_TRIANGLES:
       return (nr / 3) * 6; 
    case PIPE_PRIM_TRIANGLE_STRIP:
-      return (nr - 2) * 6;
+      return nr >= 3 ? (nr - 2) * 6 : 0;
    case PIPE_PRIM_TRIANGLE_FAN:
-      return (nr - 2)  * 6;
+      return nr >= 3 ? (nr - 2) * 6 : 0;
    case PIPE_PRIM_QUADS:
       return (nr / 4) * 8;
    case PIPE_PRIM_QUAD_STRIP:
-      return (nr - 2) / 2 * 8;
+      return nr >= 4 ? (nr - 2) / 2 * 8 : 0;
    case PIPE_PRIM_POLYGON:
-      return 2 * nr; /* a line (two verts) for each polygon edge */
+      return nr >= 3 ? 2 * nr : 0; /* a line (two verts) for each polygon edge */
    default:
       assert(0);
       return 0;
@@ -104,6 +118,7 @@ int u_unfilled_translator( unsigned prim,
                         unsigned in_index_size,
                         unsigned nr,
                         unsigned unfilled_mode,
+                        boolean primitive_restart,
                         unsigned *out_prim,
                         unsigned *out_index_size,
                         unsigned *out_nr,
@@ -123,19 +138,34 @@ int u_unfilled_translator( unsigned prim,
       *out_prim = PIPE_PRIM_POINTS;
       *out_nr = nr;
 
+      if (primitive_restart) {
+         switch (in_index_size)
+         {
+         case 1:
+            *out_translate = translate_points_ubyte2ushort_restart;
+            return U_TRANSLATE_NORMAL;
+         case 2:
+            *out_translate = translate_points_ushort2ushort_restart;
+            return U_TRANSLATE_NORMAL;
+         case 4:
+            *out_translate = translate_points_uint2uint_restart;
+            return U_TRANSLATE_NORMAL;
+         }
+      }
+
       switch (in_index_size)
       {
       case 1:
-         *out_translate = translate_ubyte_ushort;
+         *out_translate = u_index_translate_ubyte_ushort;
          return U_TRANSLATE_NORMAL;
       case 2:
-         *out_translate = translate_memcpy_uint;
+         *out_translate = u_index_translate_memcpy_ushort;
          return U_TRANSLATE_MEMCPY;
       case 4:
-         *out_translate = translate_memcpy_ushort;
+         *out_translate = u_index_translate_memcpy_uint;
          return U_TRANSLATE_MEMCPY;
       default:
-         *out_translate = translate_memcpy_uint;
+         *out_translate = u_index_translate_memcpy_uint;
          *out_nr = 0;
          assert(0);
          return U_TRANSLATE_ERROR;
@@ -144,7 +174,10 @@ int u_unfilled_translator( unsigned prim,
    else {
       assert(unfilled_mode == PIPE_POLYGON_MODE_LINE);
       *out_prim = PIPE_PRIM_LINES;
-      *out_translate = translate_line[in_idx][out_idx][prim];
+      if (primitive_restart)
+         *out_translate = translate_line_restart[in_idx][out_idx][prim];
+      else
+         *out_translate = translate_line[in_idx][out_idx][prim];
       *out_nr = nr_lines( prim, nr );
       return U_TRANSLATE_NORMAL;
    }
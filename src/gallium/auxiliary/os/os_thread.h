@@ -454,20 +454,31 @@ typedef struct {
 #define PIPE_TSD_INIT_MAGIC 0xff8adc98
 
 
+/**
+ * Like pipe_tsd_init(), but destructor is called with the value of each
+ * thread exiting with a non-NULL value, until pipe_tsd_destroy().
+ */
 static INLINE void
-pipe_tsd_init(pipe_tsd *tsd)
+pipe_tsd_init_destructor(pipe_tsd *tsd, void (*destructor)(void *))
 {
 #if defined(PIPE_OS_LINUX) || defined(PIPE_OS_BSD) || defined(PIPE_OS_SOLARIS) || defined(PIPE_OS_APPLE) || defined(PIPE_OS_HAIKU) || defined(PIPE_OS_CYGWIN)
-   if (pthread_key_create(&tsd->key, NULL/*free*/) != 0) {
+   if (pthread_key_create(&tsd->key, destructor) != 0) {
       perror("pthread_key_create(): failed to allocate key for thread specific data");
       exit(-1);
    }
 #elif defined(PIPE_SUBSYSTEM_WINDOWS_USER)
+   (void) destructor;
    assert(0);
 #endif
    tsd->initMagic = PIPE_TSD_INIT_MAGIC;
 }
 
+static INLINE void
+pipe_tsd_init(pipe_tsd *tsd)
+{
+   pipe_tsd_init_destructor(tsd, NULL/*free*/);
+}
+
 static INLINE void *
 pipe_tsd_get(pipe_tsd *tsd)
 {
@@ -503,6 +514,23 @@ pipe_tsd_set(pipe_tsd *tsd, void *value)
 #endif
 }
 
+/**
+ * Release the key of thread-specific data initialized with pipe_tsd_init()
+ * or the first pipe_tsd_get/set().  Values of other threads are lost.
+ */
+static INLINE void
+pipe_tsd_destroy(pipe_tsd *tsd)
+{
+   if (tsd->initMagic != (int) PIPE_TSD_INIT_MAGIC)
+      return;
+#if defined(PIPE_OS_LINUX) || defined(PIPE_OS_BSD) || defined(PIPE_OS_SOLARIS) || defined(PIPE_OS_APPLE) || defined(PIPE_OS_HAIKU) || defined(PIPE_OS_CYGWIN)
+   pthread_key_delete(tsd->key);
+#elif defined(PIPE_SUBSYSTEM_WINDOWS_USER)
+   assert(0);
+#endif
+   tsd->initMagic = 0;
+}
+
 
 
 #endif /* OS_THREAD_H_ */
@@ -59,6 +59,7 @@ extern "C" {
 
 
 struct pb_desc;
+struct pb_fence_ops;
 
 
 /** 
@@ -86,6 +87,13 @@ struct pb_manager
    boolean
    (*is_buffer_busy)( struct pb_manager *mgr,
                       struct pb_buffer *buf );
+
+   /**
+    * Print statistics with debug_printf, including those of the providers.
+    * Optional.
+    */
+   void
+   (*dump)( struct pb_manager *mgr );
 };
 
 
@@ -153,18 +161,33 @@ pb_slab_range_manager_create(struct pb_manager *provider,
                              pb_size slabSize,
                              const struct pb_desc *desc);
 
+/**
+ * Same as pb_slab_range_manager_create(), but destroyed buffers are only
+ * reused once their last fence has signalled.  The fence ops are not
+ * destroyed with the manager.
+ */
+struct pb_manager *
+pb_slab_range_manager_create_fenced(struct pb_manager *provider,
+                                    struct pb_fence_ops *ops,
+                                    pb_size minBufSize,
+                                    pb_size maxBufSize,
+                                    pb_size slabSize,
+                                    const struct pb_desc *desc);
+
 
 /** 
  * Time-based buffer cache.
  *
- * This manager keeps a cache of destroyed buffers during a time interval. 
+ * This manager keeps a cache of destroyed buffers during a time interval,
+ * and at most maximum_cache_size bytes of them (0 means no limit), evicting
+ * the least recently destroyed ones first.
  */
 struct pb_manager *
 pb_cache_manager_create(struct pb_manager *provider, 
-                     	unsigned usecs); 
+                     	unsigned usecs,
+                        pb_size maximum_cache_size); 
 
 
-struct pb_fence_ops;
 
 /** 
  * Fenced buffer manager.
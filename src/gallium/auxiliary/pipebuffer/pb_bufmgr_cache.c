@@ -37,6 +37,7 @@
 #include "pipe/p_compiler.h"
 #include "util/u_debug.h"
 #include "os/os_thread.h"
+#include "util/u_math.h"
 #include "util/u_memory.h"
 #include "util/u_double_list.h"
 #include "util/u_time.h"
@@ -51,6 +52,20 @@
 #define SUPER(__derived) (&(__derived)->base)
 
 
+/**
+ * One bucket per power of two: a buffer of size s is in bucket log2(s), so
+ * the buffers in [size, 2*size) are all in buckets log2(size) and
+ * log2(size) + 1.
+ */
+#define PB_CACHE_NUM_BUCKETS (sizeof(pb_size) * 8)
+
+/**
+ * Buffers looked at per bucket when searching, to bound the time spent
+ * under the mutex.
+ */
+#define PB_CACHE_MAX_CANDIDATES 8
+
+
 struct pb_cache_manager;
 
 
@@ -67,7 +82,11 @@ struct pb_cache_buffer
    /** Caching time interval */
    int64_t start, end;
 
+   /** In the manager's LRU list */
    struct list_head head;
+
+   /** In the manager's bucket list for the size */
+   struct list_head bucket_head;
 };
 
 
@@ -80,8 +99,22 @@ struct pb_cache_manager
    
    pipe_mutex mutex;
    
+   /** All cached buffers, least recently destroyed first */
    struct list_head delayed;
    pb_size numDelayed;
+
+   /** Cached buffers by size, least recently destroyed first */
+   struct list_head buckets[PB_CACHE_NUM_BUCKETS];
+
+   /** Total size of the cached buffers, and its limit */
+   pb_size cacheSize;
+   pb_size maxCacheSize;
+
+   /** Statistics, protected by the mutex */
+   unsigned numHits;
+   unsigned numMisses;
+   unsigned numEvictions;
+   unsigned numExpirations;
 };
 
 
@@ -101,17 +134,37 @@ pb_cache_manager(struct pb_manager *mgr)
 }
 
 
+static INLINE struct list_head *
+pb_cache_bucket(struct pb_cache_manager *mgr, pb_size size)
+{
+   return &mgr->buckets[util_logbase2(size)];
+}
+
+
 /**
- * Actually destroy the buffer.
+ * Remove a buffer from the cache lists.
  */
 static INLINE void
-_pb_cache_buffer_destroy(struct pb_cache_buffer *buf)
+_pb_cache_buffer_unlink(struct pb_cache_buffer *buf)
 {
    struct pb_cache_manager *mgr = buf->mgr;
 
    LIST_DEL(&buf->head);
+   LIST_DEL(&buf->bucket_head);
    assert(mgr->numDelayed);
    --mgr->numDelayed;
+   assert(mgr->cacheSize >= buf->base.size);
+   mgr->cacheSize -= buf->base.size;
+}
+
+
+/**
+ * Actually destroy the buffer.
+ */
+static INLINE void
+_pb_cache_buffer_destroy(struct pb_cache_buffer *buf)
+{
+   _pb_cache_buffer_unlink(buf);
    assert(!pipe_is_referenced(&buf->base.reference));
    pb_reference(&buf->buffer, NULL);
    FREE(buf);
@@ -139,6 +192,7 @@ _pb_cache_buffer_list_check_free(struct pb_cache_manager *mgr)
 	 break;
 	 
       _pb_cache_buffer_destroy(buf);
+      ++mgr->numExpirations;
 
       curr = next; 
       next = curr->next;
@@ -152,15 +206,34 @@ pb_cache_buffer_destroy(struct pb_buffer *_buf)
    struct pb_cache_buffer *buf = pb_cache_buffer(_buf);   
    struct pb_cache_manager *mgr = buf->mgr;
 
+   /* Don't flush the whole cache for a buffer it can't hold anyway */
+   if (buf->base.size > mgr->maxCacheSize) {
+      assert(!pipe_is_referenced(&buf->base.reference));
+      pb_reference(&buf->buffer, NULL);
+      FREE(buf);
+      return;
+   }
+
    pipe_mutex_lock(mgr->mutex);
    assert(!pipe_is_referenced(&buf->base.reference));
    
    _pb_cache_buffer_list_check_free(mgr);
+
+   /* Evict the least recently used buffers to stay within the budget */
+   while (mgr->cacheSize + buf->base.size > mgr->maxCacheSize) {
+      struct pb_cache_buffer *lru =
+         LIST_ENTRY(struct pb_cache_buffer, mgr->delayed.next, head);
+
+      _pb_cache_buffer_destroy(lru);
+      ++mgr->numEvictions;
+   }
    
    buf->start = os_time_get();
    buf->end = buf->start + mgr->usecs;
    LIST_ADDTAIL(&buf->head, &mgr->delayed);
+   LIST_ADDTAIL(&buf->bucket_head, pb_cache_bucket(mgr, buf->base.size));
    ++mgr->numDelayed;
+   mgr->cacheSize += buf->base.size;
    pipe_mutex_unlock(mgr->mutex);
 }
 
@@ -222,6 +295,11 @@ pb_cache_buffer_vtbl = {
 };
 
 
+/**
+ * Check whether a cached buffer can be used for the request.
+ * \return 2 if it can and has exactly the requested usage, 1 if it can,
+ * 0 if it can't, -1 if it is still busy
+ */
 static INLINE int
 pb_cache_is_buffer_compat(struct pb_cache_buffer *buf,  
                           pb_size size,
@@ -252,7 +330,41 @@ pb_cache_is_buffer_compat(struct pb_cache_buffer *buf,
       pb_unmap(buf->buffer);
    }
 
-   return 1;
+   /* extra usage flags may mean e.g. a different memory domain */
+   return buf->base.usage == desc->usage ? 2 : 1;
+}
+
+
+/**
+ * Look for a reusable buffer in a bucket, starting with the least recently
+ * destroyed, which is the most likely to be idle.
+ */
+static struct pb_cache_buffer *
+pb_cache_bucket_search(struct list_head *bucket,
+                       pb_size size,
+                       const struct pb_desc *desc,
+                       struct pb_cache_buffer **fallback)
+{
+   struct list_head *curr;
+   unsigned n = 0;
+
+   for (curr = bucket->next;
+        curr != bucket && n < PB_CACHE_MAX_CANDIDATES;
+        curr = curr->next, ++n) {
+      struct pb_cache_buffer *buf =
+         LIST_ENTRY(struct pb_cache_buffer, curr, bucket_head);
+      int ret = pb_cache_is_buffer_compat(buf, size, desc);
+
+      if (ret == 2)
+         return buf;
+      if (ret == 1 && !*fallback)
+         *fallback = buf;
+      /* the more recent buffers are likely busy too */
+      if (ret == -1)
+         break;
+   }
+
+   return NULL;
 }
 
 
@@ -263,60 +375,35 @@ pb_cache_manager_create_buffer(struct pb_manager *_mgr,
 {
    struct pb_cache_manager *mgr = pb_cache_manager(_mgr);
    struct pb_cache_buffer *buf;
-   struct pb_cache_buffer *curr_buf;
-   struct list_head *curr, *next;
-   int64_t now;
-   int ret = 0;
+   struct pb_cache_buffer *fallback = NULL;
+   unsigned bucket;
 
    pipe_mutex_lock(mgr->mutex);
 
-   buf = NULL;
-   curr = mgr->delayed.next;
-   next = curr->next;
-   
-   /* search in the expired buffers, freeing them in the process */
-   now = os_time_get();
-   while(curr != &mgr->delayed) {
-      curr_buf = LIST_ENTRY(struct pb_cache_buffer, curr, head);
-      if(!buf && (ret = pb_cache_is_buffer_compat(curr_buf, size, desc) > 0))
-         buf = curr_buf;
-      else if(os_time_timeout(curr_buf->start, curr_buf->end, now))
-         _pb_cache_buffer_destroy(curr_buf);
-      else
-         /* This buffer (and all hereafter) are still hot in cache */
-         break;
-      if (ret == -1)
-         break;
-      curr = next; 
-      next = curr->next;
-   }
+   _pb_cache_buffer_list_check_free(mgr);
 
-   /* keep searching in the hot buffers */
-   if(!buf && ret != -1) {
-      while(curr != &mgr->delayed) {
-         curr_buf = LIST_ENTRY(struct pb_cache_buffer, curr, head);
-         ret = pb_cache_is_buffer_compat(curr_buf, size, desc);
-         if (ret > 0) {
-            buf = curr_buf;
-            break;
-         }
-         if (ret == -1)
-            break;
-         /* no need to check the timeout here */
-         curr = next;
-         next = curr->next;
-      }
+   buf = NULL;
+   if (size && mgr->numDelayed) {
+      bucket = util_logbase2(size);
+      buf = pb_cache_bucket_search(&mgr->buckets[bucket], size, desc,
+                                   &fallback);
+      if (!buf && bucket + 1 < PB_CACHE_NUM_BUCKETS)
+         buf = pb_cache_bucket_search(&mgr->buckets[bucket + 1], size, desc,
+                                      &fallback);
+      if (!buf)
+         buf = fallback;
    }
    
    if(buf) {
-      LIST_DEL(&buf->head);
-      --mgr->numDelayed;
+      _pb_cache_buffer_unlink(buf);
+      ++mgr->numHits;
       pipe_mutex_unlock(mgr->mutex);
       /* Increase refcount */
       pipe_reference_init(&buf->base.reference, 1);
       return &buf->base;
    }
    
+   ++mgr->numMisses;
    pipe_mutex_unlock(mgr->mutex);
 
    buf = CALLOC_STRUCT(pb_cache_buffer);
@@ -378,18 +465,46 @@ pb_cache_manager_flush(struct pb_manager *_mgr)
 
 
 static void
-pb_cache_manager_destroy(struct pb_manager *mgr)
+pb_cache_manager_dump(struct pb_manager *_mgr)
+{
+   struct pb_cache_manager *mgr = pb_cache_manager(_mgr);
+   unsigned lookups;
+
+   pipe_mutex_lock(mgr->mutex);
+   lookups = mgr->numHits + mgr->numMisses;
+   debug_printf("pb_cache_manager %p:\n", (void *) mgr);
+   debug_printf("    hits = %u / %u (%.1f%%)\n",
+                mgr->numHits, lookups,
+                lookups ? 100.0 * mgr->numHits / lookups : 0.0);
+   debug_printf("    cached = %u buffers, %u / %u bytes\n",
+                mgr->numDelayed, mgr->cacheSize, mgr->maxCacheSize);
+   debug_printf("    evictions = %u, expirations = %u\n",
+                mgr->numEvictions, mgr->numExpirations);
+   pipe_mutex_unlock(mgr->mutex);
+
+   if (mgr->provider->dump)
+      mgr->provider->dump(mgr->provider);
+}
+
+
+static void
+pb_cache_manager_destroy(struct pb_manager *_mgr)
 {
-   pb_cache_manager_flush(mgr);
+   struct pb_cache_manager *mgr = pb_cache_manager(_mgr);
+
+   pb_cache_manager_flush(_mgr);
+   pipe_mutex_destroy(mgr->mutex);
    FREE(mgr);
 }
 
 
 struct pb_manager *
 pb_cache_manager_create(struct pb_manager *provider, 
-                     	unsigned usecs) 
+                     	unsigned usecs,
+                        pb_size maximum_cache_size) 
 {
    struct pb_cache_manager *mgr;
+   unsigned i;
 
    if(!provider)
       return NULL;
@@ -401,9 +516,13 @@ pb_cache_manager_create(struct pb_manager *provider,
    mgr->base.destroy = pb_cache_manager_destroy;
    mgr->base.create_buffer = pb_cache_manager_create_buffer;
    mgr->base.flush = pb_cache_manager_flush;
+   mgr->base.dump = pb_cache_manager_dump;
    mgr->provider = provider;
    mgr->usecs = usecs;
+   mgr->maxCacheSize = maximum_cache_size ? maximum_cache_size : ~0;
    LIST_INITHEAD(&mgr->delayed);
+   for (i = 0; i < PB_CACHE_NUM_BUCKETS; ++i)
+      LIST_INITHEAD(&mgr->buckets[i]);
    mgr->numDelayed = 0;
    pipe_mutex_init(mgr->mutex);
       
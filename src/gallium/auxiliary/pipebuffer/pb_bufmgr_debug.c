@@ -53,6 +53,9 @@
 #define PB_DEBUG_MAP_BACKTRACE 8
 
 
+DEBUG_GET_ONCE_BOOL_OPTION(pb_stats, "GALLIUM_PB_STATS", FALSE)
+
+
 /**
  * Convenience macro (type safe).
  */
@@ -438,11 +441,42 @@ pb_debug_manager_flush(struct pb_manager *_mgr)
 }
 
 
+/**
+ * Print the live buffers and the statistics of the managers below.
+ */
+static void
+pb_debug_manager_dump(struct pb_manager *_mgr)
+{
+   struct pb_debug_manager *mgr = pb_debug_manager(_mgr);
+   struct list_head *curr;
+   unsigned num_buffers = 0;
+   pb_size size = 0;
+
+   pipe_mutex_lock(mgr->mutex);
+   for (curr = mgr->list.next; curr != &mgr->list; curr = curr->next) {
+      struct pb_debug_buffer *buf =
+         LIST_ENTRY(struct pb_debug_buffer, curr, head);
+      ++num_buffers;
+      size += buf->base.size;
+   }
+   pipe_mutex_unlock(mgr->mutex);
+
+   debug_printf("pb_debug_manager %p:\n", (void *) mgr);
+   debug_printf("    live = %u buffers, %u bytes\n", num_buffers, size);
+
+   if (mgr->provider->dump)
+      mgr->provider->dump(mgr->provider);
+}
+
+
 static void
 pb_debug_manager_destroy(struct pb_manager *_mgr)
 {
    struct pb_debug_manager *mgr = pb_debug_manager(_mgr);
    
+   if (debug_get_option_pb_stats())
+      pb_debug_manager_dump(_mgr);
+
    pipe_mutex_lock(mgr->mutex);
    if(!LIST_IS_EMPTY(&mgr->list)) {
       debug_printf("%s: unfreed buffers\n", __FUNCTION__);
@@ -472,6 +506,7 @@ pb_debug_manager_create(struct pb_manager *provider,
    mgr->base.destroy = pb_debug_manager_destroy;
    mgr->base.create_buffer = pb_debug_manager_create_buffer;
    mgr->base.flush = pb_debug_manager_flush;
+   mgr->base.dump = pb_debug_manager_dump;
    mgr->provider = provider;
    mgr->underflow_size = underflow_size;
    mgr->overflow_size = overflow_size;
@@ -45,10 +45,36 @@
 #include "util/u_time.h"
 
 #include "pb_buffer.h"
+#include "pb_buffer_fenced.h"
 #include "pb_bufmgr.h"
 
 
+/*
+ * Per-thread magazines need thread-specific data, see os_thread.h.
+ */
+#if defined(PIPE_OS_LINUX) || defined(PIPE_OS_BSD) || defined(PIPE_OS_SOLARIS) || defined(PIPE_OS_APPLE) || defined(PIPE_OS_HAIKU) || defined(PIPE_OS_CYGWIN)
+#define PB_SLAB_MAGAZINES 1
+#else
+#define PB_SLAB_MAGAZINES 0
+#endif
+
+
+/**
+ * Number of free buffers a thread keeps per bucket.  Magazines are
+ * refilled from, and overflow into, the shared slabs half a magazine at a
+ * time.
+ */
+#define PB_SLAB_MAGAZINE_SIZE 16
+
+
+/**
+ * Number of size classes per power of two in the range manager.
+ */
+#define PB_SLAB_CLASSES_LOG2 2
+
+
 struct pb_slab;
+struct pb_slab_range_manager;
 
 
 /**
@@ -69,6 +95,9 @@ struct pb_slab_buffer
    /** Offset relative to the start of the slab buffer. */
    pb_size start;
    
+   /** Last fence the buffer was used with, if the manager has fence ops */
+   struct pipe_fence_handle *fence;
+
    /** Use when validating, to signal that all mappings are finished */
    /* TODO: Actually validation does not reach this stage yet */
    pipe_condvar event;
@@ -120,6 +149,13 @@ struct pb_slab_manager
     */
    struct pb_desc desc;
 
+   /** Optional, to defer reuse of destroyed buffers until they're idle */
+   struct pb_fence_ops *ops;
+
+   /** Range manager and bucket this belongs to, if any, for magazines */
+   struct pb_slab_range_manager *range;
+   unsigned bucket;
+
    /** 
     * Partial slabs
     * 
@@ -127,8 +163,33 @@ struct pb_slab_manager
     * immediatly.
     */
    struct list_head slabs;
+
+   /** Number of partial and full slabs, to check the teardown */
+   unsigned numSlabs;
    
+   /** Destroyed buffers whose fence hasn't signalled yet, oldest first */
+   struct list_head delayed;
+
+   pipe_mutex mutex;
+};
+
+
+/**
+ * A thread's cache of free buffers, one stack per bucket.  Only its
+ * thread uses it, except for flushes and destruction, so its mutex is
+ * normally uncontended.  When the thread exits, its buffers go back to the
+ * slabs, see pb_slab_thread_exit().
+ */
+struct pb_slab_thread
+{
+   struct list_head head;
+
+   struct pb_slab_range_manager *mgr;
+
    pipe_mutex mutex;
+
+   unsigned *count;
+   struct pb_slab_buffer *(*buffers)[PB_SLAB_MAGAZINE_SIZE];
 };
 
 
@@ -138,10 +199,17 @@ struct pb_slab_manager
  * 
  * This buffer manager just dispatches buffer allocations to the appropriate slab
  * manager, according to the requested buffer size, or by passes the slab 
- * managers altogether for even greater sizes.
+ * managers altogether for even greater sizes.  There are
+ * 1 << PB_SLAB_CLASSES_LOG2 size classes per power of two, as far as the
+ * alignment allows.
  * 
+ * Each thread allocates from and frees into its own magazines first, and
+ * only takes the slab managers' mutexes to exchange half a magazine at a
+ * time with them.
+ *
  * The data of this structure remains constant after
- * initialization and thus needs no mutex protection.
+ * initialization and thus needs no mutex protection, except for the list
+ * of threads.
  */
 struct pb_slab_range_manager 
 {
@@ -160,6 +228,15 @@ struct pb_slab_range_manager
    
    /** Array of pb_slab_manager, one for each bucket size */
    struct pb_manager **buckets;
+
+#if PB_SLAB_MAGAZINES
+   /** This thread's pb_slab_thread */
+   pipe_tsd tsd;
+#endif
+
+   /** All pb_slab_thread, protected by the mutex */
+   struct list_head threads;
+   pipe_mutex mutex;
 };
 
 
@@ -188,21 +265,16 @@ pb_slab_range_manager(struct pb_manager *mgr)
 
 
 /**
- * Delete a buffer from the slab delayed list and put
- * it on the slab FREE list.
+ * Put a buffer back on its slab's FREE list, destroying the slab if it
+ * becomes totally empty.  Called with the manager mutex held.
  */
 static void
-pb_slab_buffer_destroy(struct pb_buffer *_buf)
+pb_slab_buffer_release_locked(struct pb_slab_buffer *buf)
 {
-   struct pb_slab_buffer *buf = pb_slab_buffer(_buf);
    struct pb_slab *slab = buf->slab;
    struct pb_slab_manager *mgr = slab->mgr;
    struct list_head *list = &buf->head;
 
-   pipe_mutex_lock(mgr->mutex);
-   
-   assert(!pipe_is_referenced(&buf->base.reference));
-   
    buf->mapCount = 0;
 
    LIST_DEL(list);
@@ -219,12 +291,264 @@ pb_slab_buffer_destroy(struct pb_buffer *_buf)
       pb_reference(&slab->bo, NULL);
       FREE(slab->buffers);
       FREE(slab);
+      mgr->numSlabs--;
+   }
+}
+
+
+/**
+ * Release the delayed buffers whose fence has signalled.  Called with the
+ * manager mutex held.
+ */
+static void
+pb_slab_manager_reclaim_locked(struct pb_slab_manager *mgr)
+{
+   struct list_head *curr, *next;
+
+   curr = mgr->delayed.next;
+   while (curr != &mgr->delayed) {
+      struct pb_slab_buffer *buf =
+         LIST_ENTRY(struct pb_slab_buffer, curr, head);
+
+      next = curr->next;
+
+      if (mgr->ops->fence_signalled(mgr->ops, buf->fence, 0) == 0) {
+         mgr->ops->fence_reference(mgr->ops, &buf->fence, NULL);
+         pb_slab_buffer_release_locked(buf);
+      }
+
+      curr = next;
+   }
+}
+
+
+/**
+ * Defer the release of a buffer if the GPU may still be using it.
+ * \return TRUE if the buffer was put on the delayed list
+ */
+static boolean
+pb_slab_buffer_delay(struct pb_slab_buffer *buf)
+{
+   struct pb_slab_manager *mgr = buf->slab->mgr;
+
+   if (!buf->fence)
+      return FALSE;
+
+   if (mgr->ops->fence_signalled(mgr->ops, buf->fence, 0) == 0) {
+      mgr->ops->fence_reference(mgr->ops, &buf->fence, NULL);
+      return FALSE;
+   }
+
+   pipe_mutex_lock(mgr->mutex);
+   LIST_ADDTAIL(&buf->head, &mgr->delayed);
+   pipe_mutex_unlock(mgr->mutex);
+
+   return TRUE;
+}
+
+
+/**
+ * Take up to n buffers from the partial slabs, creating new slabs as
+ * needed.  Called with the manager mutex held.
+ * \return number of buffers taken
+ */
+static unsigned
+pb_slab_manager_alloc_locked(struct pb_slab_manager *mgr,
+                             struct pb_slab_buffer **bufs,
+                             unsigned n);
+
+
+/**
+ * Return buffers to their slabs under a single lock.
+ */
+static void
+pb_slab_manager_free(struct pb_slab_manager *mgr,
+                     struct pb_slab_buffer **bufs,
+                     unsigned n)
+{
+   unsigned i;
+
+   pipe_mutex_lock(mgr->mutex);
+   for (i = 0; i < n; i++)
+      pb_slab_buffer_release_locked(bufs[i]);
+   pipe_mutex_unlock(mgr->mutex);
+}
+
+
+#if PB_SLAB_MAGAZINES
+
+/**
+ * TSD destructor: return the buffers of an exiting thread's magazines to
+ * the slabs, so that they can be reused by other threads, and free them.
+ */
+static void
+pb_slab_thread_exit(void *data)
+{
+   struct pb_slab_thread *thr = data;
+   struct pb_slab_range_manager *mgr = thr->mgr;
+   unsigned i;
+
+   /* Once unlinked, flushes no longer see the magazines */
+   pipe_mutex_lock(mgr->mutex);
+   LIST_DEL(&thr->head);
+   pipe_mutex_unlock(mgr->mutex);
+
+   for (i = 0; i < mgr->numBuckets; ++i)
+      pb_slab_manager_free(pb_slab_manager(mgr->buckets[i]),
+                           thr->buffers[i], thr->count[i]);
+
+   pipe_mutex_destroy(thr->mutex);
+   FREE(thr);
+}
+
+
+/**
+ * Get the calling thread's magazines, creating them if needed.
+ */
+static struct pb_slab_thread *
+pb_slab_thread_get(struct pb_slab_range_manager *mgr)
+{
+   struct pb_slab_thread *thr = pipe_tsd_get(&mgr->tsd);
+
+   if (!thr) {
+      thr = CALLOC(1, sizeof *thr +
+                   mgr->numBuckets * (sizeof *thr->count +
+                                      sizeof *thr->buffers));
+      if (!thr)
+         return NULL;
+
+      thr->mgr = mgr;
+      thr->buffers = (void *) (thr + 1);
+      thr->count = (unsigned *) (thr->buffers + mgr->numBuckets);
+      pipe_mutex_init(thr->mutex);
+
+      pipe_mutex_lock(mgr->mutex);
+      LIST_ADDTAIL(&thr->head, &mgr->threads);
+      pipe_mutex_unlock(mgr->mutex);
+
+      pipe_tsd_set(&mgr->tsd, thr);
+   }
+
+   return thr;
+}
+
+
+/**
+ * Allocate a buffer from the calling thread's magazine for a bucket.
+ */
+static struct pb_slab_buffer *
+pb_slab_magazine_alloc(struct pb_slab_manager *mgr)
+{
+   struct pb_slab_thread *thr = pb_slab_thread_get(mgr->range);
+   struct pb_slab_buffer *buf = NULL;
+   unsigned *count;
+
+   if (!thr)
+      return NULL;
+
+   count = &thr->count[mgr->bucket];
+
+   pipe_mutex_lock(thr->mutex);
+   if (*count == 0) {
+      pipe_mutex_lock(mgr->mutex);
+      *count = pb_slab_manager_alloc_locked(mgr, thr->buffers[mgr->bucket],
+                                            PB_SLAB_MAGAZINE_SIZE / 2);
+      pipe_mutex_unlock(mgr->mutex);
+   }
+   if (*count)
+      buf = thr->buffers[mgr->bucket][--*count];
+   pipe_mutex_unlock(thr->mutex);
+
+   return buf;
+}
+
+
+/**
+ * Free a buffer into the calling thread's magazine for its bucket,
+ * returning the older half of the magazine to the slabs when full.
+ * \return FALSE if there is no magazine
+ */
+static boolean
+pb_slab_magazine_free(struct pb_slab_buffer *buf)
+{
+   struct pb_slab_manager *mgr = buf->slab->mgr;
+   struct pb_slab_thread *thr = pb_slab_thread_get(mgr->range);
+   struct pb_slab_buffer **mag;
+   unsigned *count;
+
+   if (!thr)
+      return FALSE;
+
+   mag = thr->buffers[mgr->bucket];
+   count = &thr->count[mgr->bucket];
+
+   pipe_mutex_lock(thr->mutex);
+   if (*count == PB_SLAB_MAGAZINE_SIZE) {
+      const unsigned half = PB_SLAB_MAGAZINE_SIZE / 2;
+
+      pb_slab_manager_free(mgr, mag, half);
+      memmove(mag, mag + half, (PB_SLAB_MAGAZINE_SIZE - half) * sizeof *mag);
+      *count -= half;
    }
+   mag[(*count)++] = buf;
+   pipe_mutex_unlock(thr->mutex);
+
+   return TRUE;
+}
+
+#endif /* PB_SLAB_MAGAZINES */
+
 
+/**
+ * Return all buffers in the threads' magazines to the slabs.
+ */
+static void
+pb_slab_range_manager_drain(struct pb_slab_range_manager *mgr)
+{
+   struct list_head *curr;
+   unsigned i;
+
+   pipe_mutex_lock(mgr->mutex);
+   for (curr = mgr->threads.next; curr != &mgr->threads; curr = curr->next) {
+      struct pb_slab_thread *thr =
+         LIST_ENTRY(struct pb_slab_thread, curr, head);
+
+      pipe_mutex_lock(thr->mutex);
+      for (i = 0; i < mgr->numBuckets; ++i) {
+         pb_slab_manager_free(pb_slab_manager(mgr->buckets[i]),
+                              thr->buffers[i], thr->count[i]);
+         thr->count[i] = 0;
+      }
+      pipe_mutex_unlock(thr->mutex);
+   }
    pipe_mutex_unlock(mgr->mutex);
 }
 
 
+/**
+ * Delete a buffer from the slab delayed list and put
+ * it on the slab FREE list.
+ */
+static void
+pb_slab_buffer_destroy(struct pb_buffer *_buf)
+{
+   struct pb_slab_buffer *buf = pb_slab_buffer(_buf);
+   struct pb_slab_manager *mgr = buf->slab->mgr;
+
+   assert(!pipe_is_referenced(&buf->base.reference));
+
+   if (mgr->ops && pb_slab_buffer_delay(buf))
+      return;
+
+#if PB_SLAB_MAGAZINES
+   if (mgr->range && pb_slab_magazine_free(buf))
+      return;
+#endif
+
+   pb_slab_manager_free(mgr, &buf, 1);
+}
+
+
 static void *
 pb_slab_buffer_map(struct pb_buffer *_buf, 
                    unsigned flags,
@@ -265,6 +589,11 @@ pb_slab_buffer_fence(struct pb_buffer *_buf,
                       struct pipe_fence_handle *fence)
 {
    struct pb_slab_buffer *buf = pb_slab_buffer(_buf);
+   struct pb_slab_manager *mgr = buf->slab->mgr;
+
+   if (mgr->ops)
+      mgr->ops->fence_reference(mgr->ops, &buf->fence, fence);
+
    pb_fence(buf->slab->bo, fence);
 }
 
@@ -358,6 +687,7 @@ pb_slab_create(struct pb_slab_manager *mgr)
 
    /* Add this slab to the list of partial slabs */
    LIST_ADDTAIL(&slab->head, &mgr->slabs);
+   mgr->numSlabs++;
 
    return PIPE_OK;
 
@@ -369,58 +699,99 @@ out_err0:
 }
 
 
-static struct pb_buffer *
-pb_slab_manager_create_buffer(struct pb_manager *_mgr,
-                              pb_size size,
-                              const struct pb_desc *desc)
+static unsigned
+pb_slab_manager_alloc_locked(struct pb_slab_manager *mgr,
+                             struct pb_slab_buffer **bufs,
+                             unsigned n)
 {
-   struct pb_slab_manager *mgr = pb_slab_manager(_mgr);
-   static struct pb_slab_buffer *buf;
    struct pb_slab *slab;
    struct list_head *list;
+   unsigned i;
+
+   if (mgr->ops && !LIST_IS_EMPTY(&mgr->delayed))
+      pb_slab_manager_reclaim_locked(mgr);
+
+   for (i = 0; i < n; ++i) {
+      /* Create a new slab, if we run out of partial slabs */
+      if (mgr->slabs.next == &mgr->slabs) {
+         (void) pb_slab_create(mgr);
+         if (mgr->slabs.next == &mgr->slabs)
+            break;
+      }
+
+      /* Allocate the buffer from a partial (or just created) slab */
+      list = mgr->slabs.next;
+      slab = LIST_ENTRY(struct pb_slab, list, head);
+
+      /* If totally full remove from the partial slab list */
+      if (--slab->numFree == 0)
+         LIST_DELINIT(list);
+
+      list = slab->freeBuffers.next;
+      LIST_DELINIT(list);
+
+      bufs[i] = LIST_ENTRY(struct pb_slab_buffer, list, head);
+   }
+
+   return i;
+}
 
+
+/**
+ * Check that we can provide a buffer of the given size and description.
+ */
+static boolean
+pb_slab_manager_check(struct pb_slab_manager *mgr,
+                      pb_size size,
+                      const struct pb_desc *desc)
+{
    /* check size */
    assert(size <= mgr->bufSize);
    if(size > mgr->bufSize)
-      return NULL;
+      return FALSE;
    
    /* check if we can provide the requested alignment */
    assert(pb_check_alignment(desc->alignment, mgr->desc.alignment));
    if(!pb_check_alignment(desc->alignment, mgr->desc.alignment))
-      return NULL;
+      return FALSE;
    assert(pb_check_alignment(desc->alignment, mgr->bufSize));
    if(!pb_check_alignment(desc->alignment, mgr->bufSize))
-      return NULL;
+      return FALSE;
 
    assert(pb_check_usage(desc->usage, mgr->desc.usage));
    if(!pb_check_usage(desc->usage, mgr->desc.usage))
+      return FALSE;
+
+   return TRUE;
+}
+
+
+static struct pb_buffer *
+pb_slab_manager_create_buffer(struct pb_manager *_mgr,
+                              pb_size size,
+                              const struct pb_desc *desc)
+{
+   struct pb_slab_manager *mgr = pb_slab_manager(_mgr);
+   struct pb_slab_buffer *buf = NULL;
+
+   if (!pb_slab_manager_check(mgr, size, desc))
       return NULL;
 
-   pipe_mutex_lock(mgr->mutex);
-   
-   /* Create a new slab, if we run out of partial slabs */
-   if (mgr->slabs.next == &mgr->slabs) {
-      (void) pb_slab_create(mgr);
-      if (mgr->slabs.next == &mgr->slabs) {
-	 pipe_mutex_unlock(mgr->mutex);
-	 return NULL;
-      }
+#if PB_SLAB_MAGAZINES
+   if (mgr->range)
+      buf = pb_slab_magazine_alloc(mgr);
+#endif
+
+   if (!buf) {
+      pipe_mutex_lock(mgr->mutex);
+      (void) pb_slab_manager_alloc_locked(mgr, &buf, 1);
+      pipe_mutex_unlock(mgr->mutex);
+      if (!buf)
+         return NULL;
    }
-   
-   /* Allocate the buffer from a partial (or just created) slab */
-   list = mgr->slabs.next;
-   slab = LIST_ENTRY(struct pb_slab, list, head);
-   
-   /* If totally full remove from the partial slab list */
-   if (--slab->numFree == 0)
-      LIST_DELINIT(list);
 
-   list = slab->freeBuffers.next;
-   LIST_DELINIT(list);
+   assert(!buf->fence);
 
-   pipe_mutex_unlock(mgr->mutex);
-   buf = LIST_ENTRY(struct pb_slab_buffer, list, head);
-   
    pipe_reference_init(&buf->base.reference, 1);
    buf->base.alignment = desc->alignment;
    buf->base.usage = desc->usage;
@@ -434,6 +805,12 @@ pb_slab_manager_flush(struct pb_manager *_mgr)
 {
    struct pb_slab_manager *mgr = pb_slab_manager(_mgr);
 
+   if (mgr->ops) {
+      pipe_mutex_lock(mgr->mutex);
+      pb_slab_manager_reclaim_locked(mgr);
+      pipe_mutex_unlock(mgr->mutex);
+   }
+
    assert(mgr->provider->flush);
    if(mgr->provider->flush)
       mgr->provider->flush(mgr->provider);
@@ -445,16 +822,32 @@ pb_slab_manager_destroy(struct pb_manager *_mgr)
 {
    struct pb_slab_manager *mgr = pb_slab_manager(_mgr);
 
-   /* TODO: cleanup all allocated buffers */
+   /* Wait for the destroyed buffers the GPU may still be using */
+   while (!LIST_IS_EMPTY(&mgr->delayed)) {
+      struct pb_slab_buffer *buf =
+         LIST_ENTRY(struct pb_slab_buffer, mgr->delayed.next, head);
+
+      mgr->ops->fence_finish(mgr->ops, buf->fence, 0);
+      mgr->ops->fence_reference(mgr->ops, &buf->fence, NULL);
+      pb_slab_buffer_release_locked(buf);
+   }
+
+   /* Releasing the last buffer of a slab frees it, so any slab left
+    * means a buffer wasn't destroyed, or a magazine wasn't drained.
+    */
+   assert(mgr->numSlabs == 0);
+
+   pipe_mutex_destroy(mgr->mutex);
    FREE(mgr);
 }
 
 
-struct pb_manager *
-pb_slab_manager_create(struct pb_manager *provider,
-                       pb_size bufSize,
-                       pb_size slabSize,
-                       const struct pb_desc *desc)
+static struct pb_manager *
+pb_slab_manager_create_fenced(struct pb_manager *provider,
+                              struct pb_fence_ops *ops,
+                              pb_size bufSize,
+                              pb_size slabSize,
+                              const struct pb_desc *desc)
 {
    struct pb_slab_manager *mgr;
 
@@ -470,8 +863,10 @@ pb_slab_manager_create(struct pb_manager *provider,
    mgr->bufSize = bufSize;
    mgr->slabSize = slabSize;
    mgr->desc = *desc;
+   mgr->ops = ops;
 
    LIST_INITHEAD(&mgr->slabs);
+   LIST_INITHEAD(&mgr->delayed);
    
    pipe_mutex_init(mgr->mutex);
 
@@ -479,24 +874,34 @@ pb_slab_manager_create(struct pb_manager *provider,
 }
 
 
+struct pb_manager *
+pb_slab_manager_create(struct pb_manager *provider,
+                       pb_size bufSize,
+                       pb_size slabSize,
+                       const struct pb_desc *desc)
+{
+   return pb_slab_manager_create_fenced(provider, NULL,
+                                        bufSize, slabSize, desc);
+}
+
+
 static struct pb_buffer *
 pb_slab_range_manager_create_buffer(struct pb_manager *_mgr,
                                     pb_size size,
                                     const struct pb_desc *desc)
 {
    struct pb_slab_range_manager *mgr = pb_slab_range_manager(_mgr);
-   pb_size bufSize;
    pb_size reqSize = size;
    unsigned i;
 
    if(desc->alignment > reqSize)
 	   reqSize = desc->alignment;
 
-   bufSize = mgr->minBufSize;
+   /* the intermediate sizes may not satisfy the alignment */
    for (i = 0; i < mgr->numBuckets; ++i) {
-      if(bufSize >= reqSize)
+      if(mgr->bucketSizes[i] >= reqSize &&
+         pb_check_alignment(desc->alignment, mgr->bucketSizes[i]))
 	 return mgr->buckets[i]->create_buffer(mgr->buckets[i], size, desc);
-      bufSize *= 2;
    }
 
    /* Fall back to allocate a buffer object directly from the provider. */
@@ -508,9 +913,22 @@ static void
 pb_slab_range_manager_flush(struct pb_manager *_mgr)
 {
    struct pb_slab_range_manager *mgr = pb_slab_range_manager(_mgr);
+   unsigned i;
+
+   /* Give back the buffers cached by the threads, and the idle delayed
+    * ones, so that empty slabs get released to the provider.
+    */
+   pb_slab_range_manager_drain(mgr);
+   for (i = 0; i < mgr->numBuckets; ++i) {
+      struct pb_slab_manager *bucket = pb_slab_manager(mgr->buckets[i]);
+
+      if (bucket->ops) {
+         pipe_mutex_lock(bucket->mutex);
+         pb_slab_manager_reclaim_locked(bucket);
+         pipe_mutex_unlock(bucket->mutex);
+      }
+   }
 
-   /* Individual slabs don't hold any temporary buffers so no need to call them */
-   
    assert(mgr->provider->flush);
    if(mgr->provider->flush)
       mgr->provider->flush(mgr->provider);
@@ -521,8 +939,26 @@ static void
 pb_slab_range_manager_destroy(struct pb_manager *_mgr)
 {
    struct pb_slab_range_manager *mgr = pb_slab_range_manager(_mgr);
+   struct list_head *curr, *next;
    unsigned i;
    
+#if PB_SLAB_MAGAZINES
+   /* no more pb_slab_thread_exit() calls from here on */
+   pipe_tsd_destroy(&mgr->tsd);
+#endif
+
+   pb_slab_range_manager_drain(mgr);
+
+   for (curr = mgr->threads.next; curr != &mgr->threads; curr = next) {
+      struct pb_slab_thread *thr =
+         LIST_ENTRY(struct pb_slab_thread, curr, head);
+
+      next = curr->next;
+      pipe_mutex_destroy(thr->mutex);
+      FREE(thr);
+   }
+   pipe_mutex_destroy(mgr->mutex);
+
    for (i = 0; i < mgr->numBuckets; ++i)
       mgr->buckets[i]->destroy(mgr->buckets[i]);
    FREE(mgr->buckets);
@@ -531,15 +967,61 @@ pb_slab_range_manager_destroy(struct pb_manager *_mgr)
 }
 
 
+/**
+ * Compute the bucket sizes: the powers of two from minBufSize up to
+ * maxBufSize, and in between the multiples of a quarter (for
+ * PB_SLAB_CLASSES_LOG2 = 2) of the power of two which keep the alignment.
+ * \return number of buckets, sizes only written if bucketSizes != NULL
+ */
+static unsigned
+pb_slab_range_bucket_sizes(pb_size minBufSize,
+                           pb_size maxBufSize,
+                           pb_size alignment,
+                           pb_size *bucketSizes)
+{
+   pb_size bufSize = minBufSize;
+   unsigned n = 0;
+
+   while (1) {
+      const pb_size step = bufSize >> PB_SLAB_CLASSES_LOG2;
+      unsigned i;
+
+      if (bucketSizes)
+         bucketSizes[n] = bufSize;
+      ++n;
+
+      if (bufSize >= maxBufSize)
+         break;
+
+      if (step && pb_check_alignment(alignment, step)) {
+         for (i = 1; i < (1 << PB_SLAB_CLASSES_LOG2); ++i) {
+            if (bucketSizes)
+               bucketSizes[n] = bufSize + i * step;
+            ++n;
+         }
+      }
+
+      bufSize *= 2;
+   }
+
+   return n;
+}
+
+
+/**
+ * Same as pb_slab_range_manager_create(), but with fence ops so that
+ * destroyed buffers are only reused once the GPU is done with them.  The
+ * ops are not destroyed with the manager.
+ */
 struct pb_manager *
-pb_slab_range_manager_create(struct pb_manager *provider,
-                             pb_size minBufSize,
-                             pb_size maxBufSize,
-                             pb_size slabSize,
-                             const struct pb_desc *desc)
+pb_slab_range_manager_create_fenced(struct pb_manager *provider,
+                                    struct pb_fence_ops *ops,
+                                    pb_size minBufSize,
+                                    pb_size maxBufSize,
+                                    pb_size slabSize,
+                                    const struct pb_desc *desc)
 {
    struct pb_slab_range_manager *mgr;
-   pb_size bufSize;
    unsigned i;
 
    if(!provider)
@@ -556,35 +1038,68 @@ pb_slab_range_manager_create(struct pb_manager *provider,
    mgr->provider = provider;
    mgr->minBufSize = minBufSize;
    mgr->maxBufSize = maxBufSize;
+   mgr->desc = *desc;
 
-   mgr->numBuckets = 1;
-   bufSize = minBufSize;
-   while(bufSize < maxBufSize) {
-      bufSize *= 2;
-      ++mgr->numBuckets;
-   }
+   LIST_INITHEAD(&mgr->threads);
+
+   mgr->numBuckets = pb_slab_range_bucket_sizes(minBufSize, maxBufSize,
+                                                desc->alignment, NULL);
+
+   mgr->bucketSizes = CALLOC(mgr->numBuckets, sizeof(*mgr->bucketSizes));
+   if (!mgr->bucketSizes)
+      goto out_err1;
+
+   pb_slab_range_bucket_sizes(minBufSize, maxBufSize, desc->alignment,
+                              mgr->bucketSizes);
    
    mgr->buckets = CALLOC(mgr->numBuckets, sizeof(*mgr->buckets));
    if (!mgr->buckets)
-      goto out_err1;
+      goto out_err2;
 
-   bufSize = minBufSize;
    for (i = 0; i < mgr->numBuckets; ++i) {
-      mgr->buckets[i] = pb_slab_manager_create(provider, bufSize, slabSize, desc);
+      struct pb_slab_manager *bucket;
+
+      mgr->buckets[i] = pb_slab_manager_create_fenced(provider, ops,
+                                                      mgr->bucketSizes[i],
+                                                      slabSize, desc);
       if(!mgr->buckets[i])
-	 goto out_err2;
-      bufSize *= 2;
+	 goto out_err3;
+
+      bucket = pb_slab_manager(mgr->buckets[i]);
+      bucket->range = mgr;
+      bucket->bucket = i;
    }
 
+   pipe_mutex_init(mgr->mutex);
+#if PB_SLAB_MAGAZINES
+   /* create the key now, before any thread races to do it */
+   pipe_tsd_init_destructor(&mgr->tsd, pb_slab_thread_exit);
+#endif
+
    return &mgr->base;
 
-out_err2: 
+out_err3: 
    for (i = 0; i < mgr->numBuckets; ++i)
       if(mgr->buckets[i])
 	    mgr->buckets[i]->destroy(mgr->buckets[i]);
    FREE(mgr->buckets);
+out_err2:
+   FREE(mgr->bucketSizes);
 out_err1: 
    FREE(mgr);
 out_err0:
    return NULL;
 }
+
+
+struct pb_manager *
+pb_slab_range_manager_create(struct pb_manager *provider,
+                             pb_size minBufSize,
+                             pb_size maxBufSize,
+                             pb_size slabSize,
+                             const struct pb_desc *desc)
+{
+   return pb_slab_range_manager_create_fenced(provider, NULL,
+                                              minBufSize, maxBufSize,
+                                              slabSize, desc);
+}
@@ -41,18 +41,24 @@ struct pp_filter_t
    unsigned int verts;          /* How many are vertex shaders */
    pp_init_func init;           /* Init function */
    pp_func main;                /* Run function */
+   unsigned int keep;           /* Channels kept, for the color filters */
 };
 
-/*	Order matters. Put new filters in a suitable place. */
+/*	Order matters. Put new filters in a suitable place.
+ *
+ *	Filters that only drop channels keep less than PIPE_MASK_RGBA. They
+ *	don't get a pass of their own, but are folded into the next filter
+ *	run by pp_nocolor, which applies ppq->fuse_mask to what it samples.
+ */
 
 static const struct pp_filter_t pp_filters[PP_FILTERS] = {
-/*    name			inner	shaders	verts	init			run */
-   { "pp_noblue",		0,	2,	1,	pp_noblue_init,		pp_nocolor },
-   { "pp_nogreen",		0,	2,	1,	pp_nogreen_init,	pp_nocolor },
-   { "pp_nored",		0,	2,	1,	pp_nored_init,		pp_nocolor },
-   { "pp_celshade",		0,	2,	1,	pp_celshade_init,	pp_nocolor },
-   { "pp_jimenezmlaa",		2,	5,	2,	pp_jimenezmlaa_init,	pp_jimenezmlaa },
-   { "pp_jimenezmlaa_color",	2,	5,	2,	pp_jimenezmlaa_init_color, pp_jimenezmlaa_color },
+/*    name			inner	shaders	verts	init			run		keep */
+   { "pp_noblue",		0,	2,	1,	pp_nocolor_init,	pp_nocolor,	PIPE_MASK_RGBA & ~PIPE_MASK_B },
+   { "pp_nogreen",		0,	2,	1,	pp_nocolor_init,	pp_nocolor,	PIPE_MASK_RGBA & ~PIPE_MASK_G },
+   { "pp_nored",		0,	2,	1,	pp_nocolor_init,	pp_nocolor,	PIPE_MASK_RGBA & ~PIPE_MASK_R },
+   { "pp_celshade",		0,	2,	1,	pp_celshade_init,	pp_nocolor,	PIPE_MASK_RGBA },
+   { "pp_jimenezmlaa",		2,	5,	2,	pp_jimenezmlaa_init,	pp_jimenezmlaa,	PIPE_MASK_RGBA },
+   { "pp_jimenezmlaa_color",	2,	5,	2,	pp_jimenezmlaa_init_color, pp_jimenezmlaa_color, PIPE_MASK_RGBA },
 };
 
 #endif
@@ -61,6 +61,8 @@ struct pp_queue_t
    struct program *p;
 
    bool fbos_init;
+
+   unsigned int fuse_mask;      /* Channels kept in the pass being set up */
 };
 
 /* Main functions */
@@ -88,9 +90,7 @@ void pp_jimenezmlaa_color(struct pp_queue_t *, struct pipe_resource *,
 
 void pp_celshade_init(struct pp_queue_t *, unsigned int, unsigned int);
 
-void pp_nored_init(struct pp_queue_t *, unsigned int, unsigned int);
-void pp_nogreen_init(struct pp_queue_t *, unsigned int, unsigned int);
-void pp_noblue_init(struct pp_queue_t *, unsigned int, unsigned int);
+void pp_nocolor_init(struct pp_queue_t *, unsigned int, unsigned int);
 
 void pp_jimenezmlaa_init(struct pp_queue_t *, unsigned int, unsigned int);
 void pp_jimenezmlaa_init_color(struct pp_queue_t *, unsigned int,
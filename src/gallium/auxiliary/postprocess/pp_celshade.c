@@ -34,5 +34,6 @@ void
 pp_celshade_init(struct pp_queue_t *ppq, unsigned int n, unsigned int val)
 {
    ppq->shaders[n][1] =
-      pp_tgsi_to_state(ppq->p->pipe, celshade, false, "celshade");
+      pp_colormask_to_state(ppq->p->pipe, celshade_decls, celshade_insts,
+                            ppq->fuse_mask, "celshade");
 }
@@ -28,7 +28,7 @@
 #ifndef CELSHADE_H
 #define CELSHADE_H
 
-static const char celshade[] = "FRAG\n"
+static const char celshade_decls[] = "FRAG\n"
    "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
    "DCL IN[0], GENERIC[0], PERSPECTIVE\n"
    "DCL OUT[0], COLOR\n"
@@ -36,44 +36,47 @@ static const char celshade[] = "FRAG\n"
    "DCL TEMP[0..4]\n"
    "IMM FLT32 {    0.2126,     0.7152,     0.0722,     4.0000}\n"
    "IMM FLT32 {    0.5000,     2.0000,     1.0000,    -0.1250}\n"
-   "IMM FLT32 {    0.2500,     0.1000,     0.1250,     3.0000}\n"
+   "IMM FLT32 {    0.2500,     0.1000,     0.1250,     3.0000}\n";
+
+static const char celshade_insts[] =
    "  0: TEX TEMP[0], IN[0].xyyy, SAMP[0], 2D\n"
-   "  1: DP3 TEMP[1].x, TEMP[0].xyzz, IMM[0]\n"
-   "  2: MUL TEMP[3].x, TEMP[1].xxxx, IMM[0].wwww\n"
-   "  3: ROUND TEMP[2].x, TEMP[3].xxxx\n"
-   "  4: MUL TEMP[3].x, TEMP[2].xxxx, IMM[2].xxxx\n"
-   "  5: MOV TEMP[2].x, TEMP[3].xxxx\n"
-   "  6: ADD TEMP[4].x, TEMP[1].xxxx, -TEMP[3].xxxx\n"
-   "  7: SGT TEMP[1].w, TEMP[4].xxxx, IMM[2].yyyy\n"
-   "  8: IF TEMP[1].wwww :19\n"
-   "  9:   ADD TEMP[4].y, TEMP[3].xxxx, IMM[2].yyyy\n"
-   " 10:   ADD TEMP[1].z, TEMP[1].xxxx, -TEMP[4].yyyy\n"
-   " 11:   ADD TEMP[1].y, TEMP[3].xxxx, IMM[2].zzzz\n"
-   " 12:   ADD TEMP[2].x, TEMP[1].yyyy, -TEMP[4].yyyy\n"
-   " 13:   RCP TEMP[4].y, TEMP[2].xxxx\n"
-   " 14:   MUL TEMP[2].x, TEMP[1].zzzz, TEMP[4].yyyy\n"
-   " 15:   MAD TEMP[1].y, -IMM[1].yyyy, TEMP[2].xxxx, IMM[2].wwww\n"
-   " 16:   MUL TEMP[1].z, TEMP[2].xxxx, TEMP[1].yyyy\n"
-   " 17:   MUL TEMP[1].y, TEMP[2].xxxx, TEMP[1].zzzz\n"
-   " 18:   MAD TEMP[2].x, TEMP[1].yyyy, IMM[2].zzzz, TEMP[3].xxxx\n"
-   " 19: ENDIF\n"
-   " 20: SLT TEMP[3].x, TEMP[4].xxxx, -IMM[2].yyyy\n"
-   " 21: IF TEMP[3].xxxx :34\n"
-   " 22:   ADD TEMP[3].x, TEMP[2].xxxx, -IMM[2].zzzz\n"
-   " 23:   ADD TEMP[4].x, TEMP[1].xxxx, -TEMP[3].xxxx\n"
-   " 24:   ADD TEMP[1].x, TEMP[2].xxxx, -IMM[2].yyyy\n"
-   " 25:   ADD TEMP[4].y, TEMP[1].xxxx, -TEMP[3].xxxx\n"
-   " 26:   RCP TEMP[3].x, TEMP[4].yyyy\n"
-   " 27:   MUL TEMP[1].x, TEMP[4].xxxx, TEMP[3].xxxx\n"
-   " 28:   MAD TEMP[4].x, -IMM[1].yyyy, TEMP[1].xxxx, IMM[2].wwww\n"
-   " 29:   MUL TEMP[3].x, TEMP[1].xxxx, TEMP[4].xxxx\n"
-   " 30:   MUL TEMP[4].x, TEMP[1].xxxx, TEMP[3].xxxx\n"
-   " 31:   ADD TEMP[3].x, IMM[1].zzzz, -TEMP[4].xxxx\n"
-   " 32:   MAD TEMP[1].x, TEMP[3].xxxx, -IMM[2].zzzz, TEMP[2].xxxx\n"
-   " 33:   MOV TEMP[2].x, TEMP[1].xxxx\n"
-   " 34: ENDIF\n"
-   " 35: MAD TEMP[1].x, TEMP[2].xxxx, IMM[1].yyyy, IMM[2].yyyy\n"
-   " 36: MUL OUT[0], TEMP[0], TEMP[1].xxxx\n"
-   " 37: END\n";
+   "  1: MUL TEMP[0], TEMP[0], IMM[3]\n"
+   "  2: DP3 TEMP[1].x, TEMP[0].xyzz, IMM[0]\n"
+   "  3: MUL TEMP[3].x, TEMP[1].xxxx, IMM[0].wwww\n"
+   "  4: ROUND TEMP[2].x, TEMP[3].xxxx\n"
+   "  5: MUL TEMP[3].x, TEMP[2].xxxx, IMM[2].xxxx\n"
+   "  6: MOV TEMP[2].x, TEMP[3].xxxx\n"
+   "  7: ADD TEMP[4].x, TEMP[1].xxxx, -TEMP[3].xxxx\n"
+   "  8: SGT TEMP[1].w, TEMP[4].xxxx, IMM[2].yyyy\n"
+   "  9: IF TEMP[1].wwww :20\n"
+   " 10:   ADD TEMP[4].y, TEMP[3].xxxx, IMM[2].yyyy\n"
+   " 11:   ADD TEMP[1].z, TEMP[1].xxxx, -TEMP[4].yyyy\n"
+   " 12:   ADD TEMP[1].y, TEMP[3].xxxx, IMM[2].zzzz\n"
+   " 13:   ADD TEMP[2].x, TEMP[1].yyyy, -TEMP[4].yyyy\n"
+   " 14:   RCP TEMP[4].y, TEMP[2].xxxx\n"
+   " 15:   MUL TEMP[2].x, TEMP[1].zzzz, TEMP[4].yyyy\n"
+   " 16:   MAD TEMP[1].y, -IMM[1].yyyy, TEMP[2].xxxx, IMM[2].wwww\n"
+   " 17:   MUL TEMP[1].z, TEMP[2].xxxx, TEMP[1].yyyy\n"
+   " 18:   MUL TEMP[1].y, TEMP[2].xxxx, TEMP[1].zzzz\n"
+   " 19:   MAD TEMP[2].x, TEMP[1].yyyy, IMM[2].zzzz, TEMP[3].xxxx\n"
+   " 20: ENDIF\n"
+   " 21: SLT TEMP[3].x, TEMP[4].xxxx, -IMM[2].yyyy\n"
+   " 22: IF TEMP[3].xxxx :35\n"
+   " 23:   ADD TEMP[3].x, TEMP[2].xxxx, -IMM[2].zzzz\n"
+   " 24:   ADD TEMP[4].x, TEMP[1].xxxx, -TEMP[3].xxxx\n"
+   " 25:   ADD TEMP[1].x, TEMP[2].xxxx, -IMM[2].yyyy\n"
+   " 26:   ADD TEMP[4].y, TEMP[1].xxxx, -TEMP[3].xxxx\n"
+   " 27:   RCP TEMP[3].x, TEMP[4].yyyy\n"
+   " 28:   MUL TEMP[1].x, TEMP[4].xxxx, TEMP[3].xxxx\n"
+   " 29:   MAD TEMP[4].x, -IMM[1].yyyy, TEMP[1].xxxx, IMM[2].wwww\n"
+   " 30:   MUL TEMP[3].x, TEMP[1].xxxx, TEMP[4].xxxx\n"
+   " 31:   MUL TEMP[4].x, TEMP[1].xxxx, TEMP[3].xxxx\n"
+   " 32:   ADD TEMP[3].x, IMM[1].zzzz, -TEMP[4].xxxx\n"
+   " 33:   MAD TEMP[1].x, TEMP[3].xxxx, -IMM[2].zzzz, TEMP[2].xxxx\n"
+   " 34:   MOV TEMP[2].x, TEMP[1].xxxx\n"
+   " 35: ENDIF\n"
+   " 36: MAD TEMP[1].x, TEMP[2].xxxx, IMM[1].yyyy, IMM[2].yyyy\n"
+   " 37: MUL OUT[0], TEMP[0], TEMP[1].xxxx\n"
+   " 38: END\n";
 
 #endif
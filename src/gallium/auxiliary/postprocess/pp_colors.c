@@ -55,26 +55,13 @@ pp_nocolor(struct pp_queue_t *ppq, struct pipe_resource *in,
 }
 
 
-/* Init functions */
+/* Init function */
 
+/** All the channel filters share one shader, keeping ppq->fuse_mask. */
 void
-pp_nored_init(struct pp_queue_t *ppq, unsigned int n, unsigned int val)
-{
-   ppq->shaders[n][1] = pp_tgsi_to_state(ppq->p->pipe, nored, false, "nored");
-}
-
-
-void
-pp_nogreen_init(struct pp_queue_t *ppq, unsigned int n, unsigned int val)
-{
-   ppq->shaders[n][1] =
-      pp_tgsi_to_state(ppq->p->pipe, nogreen, false, "nogreen");
-}
-
-
-void
-pp_noblue_init(struct pp_queue_t *ppq, unsigned int n, unsigned int val)
+pp_nocolor_init(struct pp_queue_t *ppq, unsigned int n, unsigned int val)
 {
    ppq->shaders[n][1] =
-      pp_tgsi_to_state(ppq->p->pipe, noblue, false, "noblue");
+      pp_colormask_to_state(ppq->p->pipe, colormask_decls, colormask_insts,
+                            ppq->fuse_mask, "colormask");
 }
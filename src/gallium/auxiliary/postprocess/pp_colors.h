@@ -28,42 +28,16 @@
 #ifndef PP_COLORS_H
 #define PP_COLORS_H
 
-static const char nored[] = "FRAG\n"
+static const char colormask_decls[] = "FRAG\n"
    "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
    "DCL IN[0], GENERIC[0], PERSPECTIVE\n"
    "DCL OUT[0], COLOR\n"
    "DCL SAMP[0]\n"
-   "DCL TEMP[0]\n"
-   "IMM FLT32 {    0.0000,     0.0000,     0.0000,     0.0000}\n"
-   "  0: TEX TEMP[0], IN[0].xyyy, SAMP[0], 2D\n"
-   "  1: MOV TEMP[0].x, IMM[0].xxxx\n"
-   "  2: MOV OUT[0], TEMP[0]\n"
-   "  3: END\n";
-
+   "DCL TEMP[0]\n";
 
-static const char nogreen[] = "FRAG\n"
-   "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
-   "DCL IN[0], GENERIC[0], PERSPECTIVE\n"
-   "DCL OUT[0], COLOR\n"
-   "DCL SAMP[0]\n"
-   "DCL TEMP[0]\n"
-   "IMM FLT32 {    0.0000,     0.0000,     0.0000,     0.0000}\n"
-   "  0: TEX TEMP[0], IN[0].xyyy, SAMP[0], 2D\n"
-   "  1: MOV TEMP[0].y, IMM[0].xxxx\n"
-   "  2: MOV OUT[0], TEMP[0]\n"
-   "  3: END\n";
-
-
-static const char noblue[] = "FRAG\n"
-   "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
-   "DCL IN[0], GENERIC[0], PERSPECTIVE\n"
-   "DCL OUT[0], COLOR\n"
-   "DCL SAMP[0]\n"
-   "DCL TEMP[0]\n"
-   "IMM FLT32 {    0.0000,     0.0000,     0.0000,     0.0000}\n"
+static const char colormask_insts[] =
    "  0: TEX TEMP[0], IN[0].xyyy, SAMP[0], 2D\n"
-   "  1: MOV TEMP[0].z, IMM[0].xxxx\n"
-   "  2: MOV OUT[0], TEMP[0]\n"
-   "  3: END\n";
+   "  1: MUL OUT[0], TEMP[0], IMM[0]\n"
+   "  2: END\n";
 
 #endif
@@ -48,6 +48,8 @@ void pp_filter_setup_out(struct program *, struct pipe_resource *);
 void pp_filter_end_pass(struct program *);
 void *pp_tgsi_to_state(struct pipe_context *, const char *, bool,
                        const char *);
+void *pp_colormask_to_state(struct pipe_context *, const char *,
+                            const char *, unsigned int, const char *);
 void pp_filter_misc_state(struct program *);
 void pp_filter_draw(struct program *);
 void pp_filter_set_fb(struct program *);
@@ -37,29 +37,68 @@
 #include "util/u_memory.h"
 #include "cso_cache/cso_context.h"
 
+/**
+*	Work out the passes for the enabled filters, in order. Runs of color
+*	filters are fused into the following pp_nocolor filter, or into a
+*	pass of their own if there is none. Returns the number of passes.
+*/
+static unsigned int
+pp_plan_passes(const unsigned int *enabled, unsigned int *filter,
+               unsigned int *mask)
+{
+   unsigned int i, n = 0, keep = PIPE_MASK_RGBA;
+   int last = -1;               /* Last color filter not yet given a pass */
+
+   for (i = 0; i <= PP_FILTERS; i++) {
+      if (i < PP_FILTERS && !enabled[i])
+         continue;
+
+      if (i < PP_FILTERS && pp_filters[i].keep != PIPE_MASK_RGBA) {
+         keep &= pp_filters[i].keep;
+         last = i;
+         continue;
+      }
+
+      if (last >= 0 && (i == PP_FILTERS || pp_filters[i].main != pp_nocolor)) {
+         filter[n] = last;
+         mask[n++] = keep;
+         keep = PIPE_MASK_RGBA;
+         last = -1;
+      }
+
+      if (i == PP_FILTERS)
+         break;
+
+      filter[n] = i;
+      mask[n++] = keep;
+      keep = PIPE_MASK_RGBA;
+      last = -1;
+   }
+
+   return n;
+}
+
 /** Initialize the post-processing queue. */
 struct pp_queue_t *
 pp_init(struct pipe_screen *pscreen, const unsigned int *enabled)
 {
 
-   unsigned int curpos = 0, i, tmp_req = 0;
+   unsigned int curpos = 0, i, tmp_req = 0, n_passes;
+   unsigned int filter[PP_FILTERS], mask[PP_FILTERS];
    struct pp_queue_t *ppq;
    pp_func *tmp_q;
 
    pp_debug("Initializing the post-processing queue.\n");
 
-   /* How many filters were requested? */
-   for (i = 0; i < PP_FILTERS; i++) {
-      if (enabled[i])
-         curpos++;
-   }
-   if (!curpos)
+   /* How many passes do the requested filters need? */
+   n_passes = pp_plan_passes(enabled, filter, mask);
+   if (!n_passes)
       return NULL;
 
    ppq = CALLOC(1, sizeof(struct pp_queue_t));
-   tmp_q = CALLOC(curpos, sizeof(pp_func));
-   ppq->shaders = CALLOC(curpos, sizeof(void *));
-   ppq->verts = CALLOC(curpos, sizeof(unsigned int));
+   tmp_q = CALLOC(n_passes, sizeof(pp_func));
+   ppq->shaders = CALLOC(n_passes, sizeof(void *));
+   ppq->verts = CALLOC(n_passes, sizeof(unsigned int));
 
    if (!tmp_q || !ppq || !ppq->shaders || !ppq->verts)
       goto error;
@@ -68,25 +107,26 @@ pp_init(struct pipe_screen *pscreen, const unsigned int *enabled)
    if (!ppq->p)
       goto error;
 
-   /* Add the enabled filters to the queue, in order */
-   curpos = 0;
+   /* Add the passes to the queue, in order */
    ppq->pp_queue = tmp_q;
-   for (i = 0; i < PP_FILTERS; i++) {
-      if (enabled[i]) {
-         ppq->pp_queue[curpos] = pp_filters[i].main;
-         tmp_req = MAX2(tmp_req, pp_filters[i].inner_tmps);
-
-         if (pp_filters[i].shaders) {
-            ppq->shaders[curpos] =
-               CALLOC(pp_filters[i].shaders + 1, sizeof(void *));
-            ppq->verts[curpos] = pp_filters[i].verts;
-            if (!ppq->shaders[curpos])
-               goto error;
-         }
-         pp_filters[i].init(ppq, curpos, enabled[i]);
+   for (curpos = 0; curpos < n_passes; curpos++) {
+      const struct pp_filter_t *f = &pp_filters[filter[curpos]];
+
+      if (mask[curpos] != PIPE_MASK_RGBA)
+         pp_debug("Pass %u: %s, keeping channel mask 0x%x\n", curpos,
+                  f->name, mask[curpos]);
+
+      ppq->pp_queue[curpos] = f->main;
+      tmp_req = MAX2(tmp_req, f->inner_tmps);
 
-         curpos++;
+      if (f->shaders) {
+         ppq->shaders[curpos] = CALLOC(f->shaders + 1, sizeof(void *));
+         ppq->verts[curpos] = f->verts;
+         if (!ppq->shaders[curpos])
+            goto error;
       }
+      ppq->fuse_mask = mask[curpos];
+      f->init(ppq, curpos, enabled[filter[curpos]]);
    }
 
    ppq->p->blitctx = util_create_blit(ppq->p->pipe, ppq->p->cso);
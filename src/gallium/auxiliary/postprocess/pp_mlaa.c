@@ -221,6 +221,8 @@ pp_jimenezmlaa_init_run(struct pp_queue_t *ppq, unsigned int n,
       return;
    }
 
+   /* The new constant buffer needs the pixel size on the first run */
+   dimensions[0] = dimensions[1] = 0;
 
    pp_debug("mlaa: using %u max search steps\n", val);
 
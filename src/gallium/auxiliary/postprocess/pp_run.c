@@ -31,6 +31,9 @@
 #include "util/u_blit.h"
 #include "util/u_inlines.h"
 #include "util/u_sampler.h"
+#include "util/u_string.h"
+
+#define IMM_SPACE 80
 
 /**
 *	Main run function of the PP queue. Called on swapbuffers/flush.
@@ -99,6 +102,9 @@ pp_run(struct pp_queue_t *ppq, struct pipe_resource *in,
       break;
    }
 
+   /* The passes are ordered within our context, but the caller's isn't */
+   ppq->p->pipe->flush(ppq->p->pipe, NULL);
+
    pipe_resource_reference(&ppq->depth, NULL);
    pipe_resource_reference(&refin, NULL);
    pipe_resource_reference(&refout, NULL);
@@ -161,6 +167,40 @@ pp_tgsi_to_state(struct pipe_context *pipe, const char *text, bool isvs,
       return pipe->create_fs_state(pipe, &state);
 }
 
+/**
+*	Build a color filter's shader from its declarations and instructions,
+*	with an immediate of the channels to keep in between. The
+*	instructions multiply the sampled color by it, so that the channel
+*	filters fused into the pass cost a MUL instead of a full pass each.
+*/
+void *
+pp_colormask_to_state(struct pipe_context *pipe, const char *decls,
+                      const char *insts, unsigned int mask, const char *name)
+{
+   char *text;
+   void *state;
+
+   text = CALLOC(strlen(decls) + strlen(insts) + IMM_SPACE, sizeof(char));
+   if (!text) {
+      pp_debug("Failed to allocate shader space\n");
+      return NULL;
+   }
+
+   util_sprintf(text, "%s"
+                "IMM FLT32 { %.4f, %.4f, %.4f, %.4f}\n"
+                "%s", decls,
+                (mask & PIPE_MASK_R) ? 1.0 : 0.0,
+                (mask & PIPE_MASK_G) ? 1.0 : 0.0,
+                (mask & PIPE_MASK_B) ? 1.0 : 0.0,
+                (mask & PIPE_MASK_A) ? 1.0 : 0.0, insts);
+
+   state = pp_tgsi_to_state(pipe, text, false, name);
+
+   FREE(text);
+
+   return state;
+}
+
 /** Setup misc state for the filter. */
 void
 pp_filter_misc_state(struct program *p)
@@ -179,7 +219,6 @@ pp_filter_draw(struct program *p)
 {
    util_draw_vertex_buffer(p->pipe, p->cso, p->vbuf, 0,
                            PIPE_PRIM_QUADS, 4, 2);
-   p->pipe->flush(p->pipe, NULL);
 }
 
 /** Set the framebuffer as active. */
@@ -50,6 +50,7 @@
 #include "util/u_texture.h"
 #include "util/u_half.h"
 #include "util/u_surface.h"
+#include "util/u_sse.h"
 
 #include "cso_cache/cso_context.h"
 
@@ -69,9 +70,12 @@ struct gen_mipmap_state
    void *fs[TGSI_TEXTURE_COUNT]; /**< Not all are used, but simplifies code */
 
    struct pipe_resource *vbuf;  /**< quad vertices */
-   unsigned vbuf_slot;
+   unsigned vbuf_offset;
 
    float vertices[4][2][4];   /**< vertex/texcoords for quad */
+
+   /** the driver prefers the CPU path, see PIPE_CAP_CPU_MIPMAP_GENERATION */
+   boolean cpu_filter;
 };
 
 
@@ -151,9 +155,104 @@ typedef uint16_t half_float;
       dst[i][e] = util_float_to_half((aj + ak + bj + bk + cj + ck + dj + dk) \
                                       * 0.125F); \
    } while(0)
+
+/* Rounds to nearest like the render path, rather than truncating. */
+#define FILTER_SUM_2D(Aj, Ak, Bj, Bk) \
+   ((unsigned) Aj + (unsigned) Ak \
+    + (unsigned) Bj + (unsigned) Bk \
+    + 2) >> 2
 /*@}*/
 
 
+#if defined(PIPE_ARCH_SSE)
+
+/**
+ * Divide eight 16-bit sums of four texels by four, rounding to nearest
+ * like FILTER_SUM_2D().
+ */
+static INLINE __m128i
+round_sum_sse2(__m128i sum)
+{
+   return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+}
+
+
+/**
+ * SSE2 version of do_row() for 4 x ubyte pixels when halving the width.
+ * Computes the same rounded average as the C code, four dest pixels
+ * at a time, and returns how many dest pixels it did.
+ */
+static uint
+do_row_ubyte4_sse2(const ubyte *rowA, const ubyte *rowB,
+                   uint dstWidth, ubyte *dst)
+{
+   const __m128i zero = _mm_setzero_si128();
+   uint i;
+
+   for (i = 0; i + 4 <= dstWidth; i += 4) {
+      __m128i a0 = _mm_loadu_si128((const __m128i *)(rowA + 8 * i));
+      __m128i a1 = _mm_loadu_si128((const __m128i *)(rowA + 8 * i + 16));
+      __m128i b0 = _mm_loadu_si128((const __m128i *)(rowB + 8 * i));
+      __m128i b1 = _mm_loadu_si128((const __m128i *)(rowB + 8 * i + 16));
+      __m128i even, odd, lo, hi;
+
+      /* split into even and odd pixels */
+      a0 = _mm_shuffle_epi32(a0, _MM_SHUFFLE(3, 1, 2, 0));
+      a1 = _mm_shuffle_epi32(a1, _MM_SHUFFLE(3, 1, 2, 0));
+      b0 = _mm_shuffle_epi32(b0, _MM_SHUFFLE(3, 1, 2, 0));
+      b1 = _mm_shuffle_epi32(b1, _MM_SHUFFLE(3, 1, 2, 0));
+
+      even = _mm_unpacklo_epi64(a0, a1);
+      odd = _mm_unpackhi_epi64(a0, a1);
+      lo = _mm_add_epi16(_mm_unpacklo_epi8(even, zero),
+                         _mm_unpacklo_epi8(odd, zero));
+      hi = _mm_add_epi16(_mm_unpackhi_epi8(even, zero),
+                         _mm_unpackhi_epi8(odd, zero));
+
+      even = _mm_unpacklo_epi64(b0, b1);
+      odd = _mm_unpackhi_epi64(b0, b1);
+      lo = _mm_add_epi16(lo, _mm_add_epi16(_mm_unpacklo_epi8(even, zero),
+                                           _mm_unpacklo_epi8(odd, zero)));
+      hi = _mm_add_epi16(hi, _mm_add_epi16(_mm_unpackhi_epi8(even, zero),
+                                           _mm_unpackhi_epi8(odd, zero)));
+
+      lo = round_sum_sse2(lo);
+      hi = round_sum_sse2(hi);
+      _mm_storeu_si128((__m128i *)(dst + 4 * i), _mm_packus_epi16(lo, hi));
+   }
+
+   return i;
+}
+
+
+/**
+ * As above for 1 x ubyte pixels, eight dest pixels at a time.
+ */
+static uint
+do_row_ubyte1_sse2(const ubyte *rowA, const ubyte *rowB,
+                   uint dstWidth, ubyte *dst)
+{
+   const __m128i mask = _mm_set1_epi16(0xff);
+   uint i;
+
+   for (i = 0; i + 8 <= dstWidth; i += 8) {
+      __m128i a = _mm_loadu_si128((const __m128i *)(rowA + 2 * i));
+      __m128i b = _mm_loadu_si128((const __m128i *)(rowB + 2 * i));
+      __m128i sum;
+
+      sum = _mm_add_epi16(_mm_and_si128(a, mask), _mm_srli_epi16(a, 8));
+      sum = _mm_add_epi16(sum, _mm_and_si128(b, mask));
+      sum = _mm_add_epi16(sum, _mm_srli_epi16(b, 8));
+      sum = round_sum_sse2(sum);
+      _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(sum, sum));
+   }
+
+   return i;
+}
+
+#endif /* PIPE_ARCH_SSE */
+
+
 /**
  * Average together two rows of a source image to produce a single new
  * row in the dest image.  It's legal for the two source rows to point
@@ -177,6 +276,25 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
    assert(srcWidth == dstWidth || srcWidth == 2 * dstWidth);
    */
 
+#if defined(PIPE_ARCH_SSE)
+   if (datatype == DTYPE_UBYTE && (comps == 4 || comps == 1) &&
+       srcWidth != dstWidth) {
+      uint done;
+
+      if (comps == 4)
+         done = do_row_ubyte4_sse2(srcRowA, srcRowB, dstWidth, dstRow);
+      else
+         done = do_row_ubyte1_sse2(srcRowA, srcRowB, dstWidth, dstRow);
+
+      /* the C code below does the remaining pixels */
+      srcRowA = (const ubyte *) srcRowA + 2 * comps * done;
+      srcRowB = (const ubyte *) srcRowB + 2 * comps * done;
+      dstRow = (ubyte *) dstRow + comps * done;
+      srcWidth -= 2 * done;
+      dstWidth -= done;
+   }
+#endif
+
    if (datatype == DTYPE_UBYTE && comps == 4) {
       uint i, j, k;
       const ubyte(*rowA)[4] = (const ubyte(*)[4]) srcRowA;
@@ -184,10 +302,14 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
       ubyte(*dst)[4] = (ubyte(*)[4]) dstRow;
       for (i = j = 0, k = k0; i < (uint) dstWidth;
            i++, j += colStride, k += colStride) {
-         dst[i][0] = (rowA[j][0] + rowA[k][0] + rowB[j][0] + rowB[k][0]) / 4;
-         dst[i][1] = (rowA[j][1] + rowA[k][1] + rowB[j][1] + rowB[k][1]) / 4;
-         dst[i][2] = (rowA[j][2] + rowA[k][2] + rowB[j][2] + rowB[k][2]) / 4;
-         dst[i][3] = (rowA[j][3] + rowA[k][3] + rowB[j][3] + rowB[k][3]) / 4;
+         dst[i][0] = FILTER_SUM_2D(rowA[j][0], rowA[k][0],
+                                   rowB[j][0], rowB[k][0]);
+         dst[i][1] = FILTER_SUM_2D(rowA[j][1], rowA[k][1],
+                                   rowB[j][1], rowB[k][1]);
+         dst[i][2] = FILTER_SUM_2D(rowA[j][2], rowA[k][2],
+                                   rowB[j][2], rowB[k][2]);
+         dst[i][3] = FILTER_SUM_2D(rowA[j][3], rowA[k][3],
+                                   rowB[j][3], rowB[k][3]);
       }
    }
    else if (datatype == DTYPE_UBYTE && comps == 3) {
@@ -197,9 +319,12 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
       ubyte(*dst)[3] = (ubyte(*)[3]) dstRow;
       for (i = j = 0, k = k0; i < (uint) dstWidth;
            i++, j += colStride, k += colStride) {
-         dst[i][0] = (rowA[j][0] + rowA[k][0] + rowB[j][0] + rowB[k][0]) / 4;
-         dst[i][1] = (rowA[j][1] + rowA[k][1] + rowB[j][1] + rowB[k][1]) / 4;
-         dst[i][2] = (rowA[j][2] + rowA[k][2] + rowB[j][2] + rowB[k][2]) / 4;
+         dst[i][0] = FILTER_SUM_2D(rowA[j][0], rowA[k][0],
+                                   rowB[j][0], rowB[k][0]);
+         dst[i][1] = FILTER_SUM_2D(rowA[j][1], rowA[k][1],
+                                   rowB[j][1], rowB[k][1]);
+         dst[i][2] = FILTER_SUM_2D(rowA[j][2], rowA[k][2],
+                                   rowB[j][2], rowB[k][2]);
       }
    }
    else if (datatype == DTYPE_UBYTE && comps == 2) {
@@ -209,8 +334,10 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
       ubyte(*dst)[2] = (ubyte(*)[2]) dstRow;
       for (i = j = 0, k = k0; i < (uint) dstWidth;
            i++, j += colStride, k += colStride) {
-         dst[i][0] = (rowA[j][0] + rowA[k][0] + rowB[j][0] + rowB[k][0]) >> 2;
-         dst[i][1] = (rowA[j][1] + rowA[k][1] + rowB[j][1] + rowB[k][1]) >> 2;
+         dst[i][0] = FILTER_SUM_2D(rowA[j][0], rowA[k][0],
+                                   rowB[j][0], rowB[k][0]);
+         dst[i][1] = FILTER_SUM_2D(rowA[j][1], rowA[k][1],
+                                   rowB[j][1], rowB[k][1]);
       }
    }
    else if (datatype == DTYPE_UBYTE && comps == 1) {
@@ -220,7 +347,7 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
       ubyte *dst = (ubyte *) dstRow;
       for (i = j = 0, k = k0; i < (uint) dstWidth;
            i++, j += colStride, k += colStride) {
-         dst[i] = (rowA[j] + rowA[k] + rowB[j] + rowB[k]) >> 2;
+         dst[i] = FILTER_SUM_2D(rowA[j], rowA[k], rowB[j], rowB[k]);
       }
    }
 
@@ -424,9 +551,9 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
          const int rowAb1 = (rowA[k] >> 11) & 0x1f;
          const int rowBb0 = (rowB[j] >> 11) & 0x1f;
          const int rowBb1 = (rowB[k] >> 11) & 0x1f;
-         const int red = (rowAr0 + rowAr1 + rowBr0 + rowBr1) >> 2;
-         const int green = (rowAg0 + rowAg1 + rowBg0 + rowBg1) >> 2;
-         const int blue = (rowAb0 + rowAb1 + rowBb0 + rowBb1) >> 2;
+         const int red = FILTER_SUM_2D(rowAr0, rowAr1, rowBr0, rowBr1);
+         const int green = FILTER_SUM_2D(rowAg0, rowAg1, rowBg0, rowBg1);
+         const int blue = FILTER_SUM_2D(rowAb0, rowAb1, rowBb0, rowBb1);
          dst[i] = (blue << 11) | (green << 5) | red;
       }
    }
@@ -453,10 +580,10 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
          const int rowAa1 = (rowA[k] >> 12) & 0xf;
          const int rowBa0 = (rowB[j] >> 12) & 0xf;
          const int rowBa1 = (rowB[k] >> 12) & 0xf;
-         const int red = (rowAr0 + rowAr1 + rowBr0 + rowBr1) >> 2;
-         const int green = (rowAg0 + rowAg1 + rowBg0 + rowBg1) >> 2;
-         const int blue = (rowAb0 + rowAb1 + rowBb0 + rowBb1) >> 2;
-         const int alpha = (rowAa0 + rowAa1 + rowBa0 + rowBa1) >> 2;
+         const int red = FILTER_SUM_2D(rowAr0, rowAr1, rowBr0, rowBr1);
+         const int green = FILTER_SUM_2D(rowAg0, rowAg1, rowBg0, rowBg1);
+         const int blue = FILTER_SUM_2D(rowAb0, rowAb1, rowBb0, rowBb1);
+         const int alpha = FILTER_SUM_2D(rowAa0, rowAa1, rowBa0, rowBa1);
          dst[i] = (alpha << 12) | (blue << 8) | (green << 4) | red;
       }
    }
@@ -483,10 +610,10 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
          const int rowAa1 = (rowA[k] >> 15) & 0x1;
          const int rowBa0 = (rowB[j] >> 15) & 0x1;
          const int rowBa1 = (rowB[k] >> 15) & 0x1;
-         const int red = (rowAr0 + rowAr1 + rowBr0 + rowBr1) >> 2;
-         const int green = (rowAg0 + rowAg1 + rowBg0 + rowBg1) >> 2;
-         const int blue = (rowAb0 + rowAb1 + rowBb0 + rowBb1) >> 2;
-         const int alpha = (rowAa0 + rowAa1 + rowBa0 + rowBa1) >> 2;
+         const int red = FILTER_SUM_2D(rowAr0, rowAr1, rowBr0, rowBr1);
+         const int green = FILTER_SUM_2D(rowAg0, rowAg1, rowBg0, rowBg1);
+         const int blue = FILTER_SUM_2D(rowAb0, rowAb1, rowBb0, rowBb1);
+         const int alpha = FILTER_SUM_2D(rowAa0, rowAa1, rowBa0, rowBa1);
          dst[i] = (alpha << 15) | (blue << 10) | (green << 5) | red;
       }
    }
@@ -509,9 +636,9 @@ do_row(enum dtype datatype, uint comps, int srcWidth,
          const int rowAb1 = (rowA[k] >> 5) & 0x7;
          const int rowBb0 = (rowB[j] >> 5) & 0x7;
          const int rowBb1 = (rowB[k] >> 5) & 0x7;
-         const int red = (rowAr0 + rowAr1 + rowBr0 + rowBr1) >> 2;
-         const int green = (rowAg0 + rowAg1 + rowBg0 + rowBg1) >> 2;
-         const int blue = (rowAb0 + rowAb1 + rowBb0 + rowBb1) >> 2;
+         const int red = FILTER_SUM_2D(rowAr0, rowAr1, rowBr0, rowBr1);
+         const int green = FILTER_SUM_2D(rowAg0, rowAg1, rowBg0, rowBg1);
+         const int blue = FILTER_SUM_2D(rowAb0, rowAb1, rowBb0, rowBb1);
          dst[i] = (blue << 5) | (green << 2) | red;
       }
    }
@@ -900,7 +1027,10 @@ do_row_3D(enum dtype datatype, uint comps, int srcWidth,
 
 
 
-static void
+/**
+ * Return FALSE if the format can't be filtered by the CPU path.
+ */
+static boolean
 format_to_type_comps(enum pipe_format pformat,
                      enum dtype *datatype, uint *comps)
 {
@@ -910,46 +1040,52 @@ format_to_type_comps(enum pipe_format pformat,
    case PIPE_FORMAT_B8G8R8X8_UNORM:
    case PIPE_FORMAT_A8R8G8B8_UNORM:
    case PIPE_FORMAT_X8R8G8B8_UNORM:
+   case PIPE_FORMAT_R8G8B8A8_UNORM:
+   case PIPE_FORMAT_R8G8B8X8_UNORM:
+   case PIPE_FORMAT_A8B8G8R8_UNORM:
+   case PIPE_FORMAT_X8B8G8R8_UNORM:
    case PIPE_FORMAT_A8B8G8R8_SRGB:
    case PIPE_FORMAT_X8B8G8R8_SRGB:
    case PIPE_FORMAT_B8G8R8A8_SRGB:
    case PIPE_FORMAT_B8G8R8X8_SRGB:
    case PIPE_FORMAT_A8R8G8B8_SRGB:
    case PIPE_FORMAT_X8R8G8B8_SRGB:
-   case PIPE_FORMAT_R8G8B8_SRGB:
       *datatype = DTYPE_UBYTE;
       *comps = 4;
-      return;
+      return TRUE;
+   case PIPE_FORMAT_R8G8B8_SRGB:
+      *datatype = DTYPE_UBYTE;
+      *comps = 3;
+      return TRUE;
    case PIPE_FORMAT_B5G5R5X1_UNORM:
    case PIPE_FORMAT_B5G5R5A1_UNORM:
       *datatype = DTYPE_USHORT_1_5_5_5_REV;
       *comps = 4;
-      return;
+      return TRUE;
    case PIPE_FORMAT_B4G4R4A4_UNORM:
       *datatype = DTYPE_USHORT_4_4_4_4;
       *comps = 4;
-      return;
+      return TRUE;
    case PIPE_FORMAT_B5G6R5_UNORM:
       *datatype = DTYPE_USHORT_5_6_5;
       *comps = 3;
-      return;
+      return TRUE;
    case PIPE_FORMAT_L8_UNORM:
    case PIPE_FORMAT_L8_SRGB:
    case PIPE_FORMAT_A8_UNORM:
    case PIPE_FORMAT_I8_UNORM:
       *datatype = DTYPE_UBYTE;
       *comps = 1;
-      return;
+      return TRUE;
    case PIPE_FORMAT_L8A8_UNORM:
    case PIPE_FORMAT_L8A8_SRGB:
       *datatype = DTYPE_UBYTE;
       *comps = 2;
-      return;
+      return TRUE;
    default:
-      assert(0);
       *datatype = DTYPE_UBYTE;
       *comps = 0;
-      break;
+      return FALSE;
    }
 }
 
@@ -1234,6 +1370,8 @@ fallback_gen_mipmap(struct gen_mipmap_state *ctx,
                     struct pipe_resource *pt,
                     uint layer, uint baseLevel, uint lastLevel)
 {
+   uint i;
+
    switch (pt->target) {
    case PIPE_TEXTURE_1D:
       make_1d_mipmap(ctx, pt, layer, baseLevel, lastLevel);
@@ -1246,12 +1384,51 @@ fallback_gen_mipmap(struct gen_mipmap_state *ctx,
    case PIPE_TEXTURE_3D:
       make_3d_mipmap(ctx, pt, layer, baseLevel, lastLevel);
       break;
+   case PIPE_TEXTURE_1D_ARRAY:
+      for (i = 0; i < pt->array_size; i++)
+         make_1d_mipmap(ctx, pt, i, baseLevel, lastLevel);
+      break;
+   case PIPE_TEXTURE_2D_ARRAY:
+      for (i = 0; i < pt->array_size; i++)
+         make_2d_mipmap(ctx, pt, i, baseLevel, lastLevel);
+      break;
    default:
       assert(0);
    }
 }
 
 
+/**
+ * Whether to filter on the CPU rather than render, either because the
+ * driver prefers it or because the format isn't renderable.
+ *
+ * The CPU path always box filters in the texture's encoding, so the driver
+ * preference is only followed where that gives what rendering would:
+ * linear filtering of 8-bit linear channels, which both round to nearest.
+ */
+static boolean
+use_fallback(struct gen_mipmap_state *ctx,
+             struct pipe_sampler_view *psv, uint filter)
+{
+   struct pipe_screen *screen = ctx->pipe->screen;
+   struct pipe_resource *pt = psv->texture;
+   enum dtype datatype;
+   uint comps;
+
+   if (!screen->is_format_supported(screen, psv->format, pt->target,
+                                    pt->nr_samples, PIPE_BIND_RENDER_TARGET))
+      return TRUE;
+
+   return ctx->cpu_filter &&
+          filter == PIPE_TEX_FILTER_LINEAR &&
+          psv->format == pt->format &&
+          pt->nr_samples <= 1 &&
+          !util_format_is_srgb(pt->format) &&
+          format_to_type_comps(pt->format, &datatype, &comps) &&
+          datatype == DTYPE_UBYTE;
+}
+
+
 /**
  * Create a mipmap generation context.
  * The idea is to create one of these and re-use it each time we need to
@@ -1270,6 +1447,8 @@ util_create_gen_mipmap(struct pipe_context *pipe,
 
    ctx->pipe = pipe;
    ctx->cso = cso;
+   ctx->cpu_filter = pipe->screen->get_param(pipe->screen,
+                                             PIPE_CAP_CPU_MIPMAP_GENERATION);
 
    /* disabled blending/masking */
    memset(&ctx->blend, 0, sizeof(ctx->blend));
@@ -1353,37 +1532,43 @@ set_vertex_shader(struct gen_mipmap_state *ctx)
 
 
 /**
- * Get next "slot" of vertex space in the vertex buffer.
- * We're allocating one large vertex buffer and using it piece by piece.
+ * Upload the quads for a whole mipmap generation at once.  We're allocating
+ * one large vertex buffer and using it piece by piece.
+ * \return offset of the data in ctx->vbuf
  */
 static unsigned
-get_next_slot(struct gen_mipmap_state *ctx)
+upload_vertex_data(struct gen_mipmap_state *ctx,
+                   const void *data, unsigned size)
 {
-   const unsigned max_slots = 4096 / sizeof ctx->vertices;
+   unsigned offset;
 
-   if (ctx->vbuf_slot >= max_slots) {
+   if (ctx->vbuf && ctx->vbuf_offset + size > ctx->vbuf->width0) {
       pipe_resource_reference(&ctx->vbuf, NULL);
-      ctx->vbuf_slot = 0;
+      ctx->vbuf_offset = 0;
    }
 
    if (!ctx->vbuf) {
       ctx->vbuf = pipe_buffer_create(ctx->pipe->screen,
                                      PIPE_BIND_VERTEX_BUFFER,
                                      PIPE_USAGE_STREAM,
-                                     max_slots * sizeof ctx->vertices);
+                                     MAX2(4096, size));
+      if (!ctx->vbuf)
+         return ~0;
    }
-   
-   return ctx->vbuf_slot++ * sizeof ctx->vertices;
+
+   offset = ctx->vbuf_offset;
+   pipe_buffer_write_nooverlap(ctx->pipe, ctx->vbuf, offset, size, data);
+   ctx->vbuf_offset += size;
+
+   return offset;
 }
 
 
-static unsigned
+static void
 set_vertex_data(struct gen_mipmap_state *ctx,
                 enum pipe_texture_target tex_target,
                 uint layer, float r)
 {
-   unsigned offset;
-
    /* vert[0].position */
    ctx->vertices[0][0][0] = -1.0f; /*x*/
    ctx->vertices[0][0][1] = -1.0f; /*y*/
@@ -1444,13 +1629,6 @@ set_vertex_data(struct gen_mipmap_state *ctx,
       ctx->vertices[3][1][1] = 1.0f;
       ctx->vertices[3][1][2] = r;
    }
-
-   offset = get_next_slot( ctx );
-
-   pipe_buffer_write_nooverlap(ctx->pipe, ctx->vbuf,
-                               offset, sizeof(ctx->vertices), ctx->vertices);
-
-   return offset;
 }
 
 
@@ -1494,9 +1672,10 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
                 uint face, uint baseLevel, uint lastLevel, uint filter)
 {
    struct pipe_context *pipe = ctx->pipe;
-   struct pipe_screen *screen = pipe->screen;
    struct pipe_framebuffer_state fb;
    struct pipe_resource *pt = psv->texture;
+   float (*quads)[4][2][4];
+   uint nr_quads, quad;
    uint dstLevel;
    uint offset;
    uint type;
@@ -1536,13 +1715,61 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
       type = TGSI_TEXTURE_2D;
    }
 
-   /* check if we can render in the texture's format */
-   if (!screen->is_format_supported(screen, psv->format, pt->target,
-                                    pt->nr_samples, PIPE_BIND_RENDER_TARGET)) {
+   /* check if we can render in the texture's format, or would rather not */
+   if (use_fallback(ctx, psv, filter)) {
       fallback_gen_mipmap(ctx, pt, face, baseLevel, lastLevel);
       return;
    }
 
+   /*
+    * Compute the quads for all the levels and layers and upload them in
+    * one go.  The quad only depends on the layer, except for 3D textures
+    * where the r coordinate depends on the depth of the level.
+    */
+   if (pt->target == PIPE_TEXTURE_3D) {
+      nr_quads = 0;
+      for (dstLevel = baseLevel + 1; dstLevel <= lastLevel; dstLevel++)
+         nr_quads += u_minify(pt->depth0, dstLevel);
+   }
+   else if (pt->target == PIPE_TEXTURE_2D_ARRAY ||
+            pt->target == PIPE_TEXTURE_1D_ARRAY) {
+      nr_quads = pt->array_size;
+   }
+   else {
+      nr_quads = 1;
+   }
+
+   quads = MALLOC(nr_quads * sizeof ctx->vertices);
+   if (!quads)
+      return;
+
+   if (pt->target == PIPE_TEXTURE_3D) {
+      quad = 0;
+      for (dstLevel = baseLevel + 1; dstLevel <= lastLevel; dstLevel++) {
+         const uint depth = u_minify(pt->depth0, dstLevel);
+         uint i;
+
+         for (i = 0; i < depth; i++) {
+            /* XXX hmm really? */
+            float rcoord = (float)i / (float)depth + 1.0f / (float)(depth * 2);
+
+            set_vertex_data(ctx, pt->target, face, rcoord);
+            memcpy(quads[quad++], ctx->vertices, sizeof ctx->vertices);
+         }
+      }
+   }
+   else {
+      for (quad = 0; quad < nr_quads; quad++) {
+         set_vertex_data(ctx, pt->target, face, (float) quad);
+         memcpy(quads[quad], ctx->vertices, sizeof ctx->vertices);
+      }
+   }
+
+   offset = upload_vertex_data(ctx, quads, nr_quads * sizeof ctx->vertices);
+   FREE(quads);
+   if (offset == ~0)
+      return;
+
    /* save state (restored below) */
    cso_save_blend(ctx->cso);
    cso_save_depth_stencil_alpha(ctx->cso);
@@ -1568,6 +1795,9 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
    set_vertex_shader(ctx);
    cso_set_geometry_shader_handle(ctx->cso, NULL);
 
+   /* the source is the same view for all the levels */
+   cso_set_fragment_sampler_views(ctx->cso, 1, &psv);
+
    /* init framebuffer state */
    memset(&fb, 0, sizeof(fb));
    fb.nr_cbufs = 1;
@@ -1577,14 +1807,15 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
    ctx->sampler.min_img_filter = filter;
 
    /*
-    * XXX for small mipmap levels, it may be faster to use the software
-    * fallback path...
+    * Only the sampler LOD, the viewport and the render target change
+    * from one level to the next, and only the render target from one
+    * layer to the next.
     */
+   quad = 0;
    for (dstLevel = baseLevel + 1; dstLevel <= lastLevel; dstLevel++) {
       const uint srcLevel = dstLevel - 1;
       struct pipe_viewport_state vp;
       unsigned nr_layers, layer, i;
-      float rcoord = 0.0f;
 
       if (pt->target == PIPE_TEXTURE_3D)
          nr_layers = u_minify(pt->depth0, dstLevel);
@@ -1593,19 +1824,48 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
       else
          nr_layers = 1;
 
+      fb.width = u_minify(pt->width0, dstLevel);
+      fb.height = u_minify(pt->height0, dstLevel);
+
+      /* viewport */
+      vp.scale[0] = 0.5f * fb.width;
+      vp.scale[1] = 0.5f * fb.height;
+      vp.scale[2] = 1.0f;
+      vp.scale[3] = 1.0f;
+      vp.translate[0] = 0.5f * fb.width;
+      vp.translate[1] = 0.5f * fb.height;
+      vp.translate[2] = 0.0f;
+      vp.translate[3] = 0.0f;
+      cso_set_viewport(ctx->cso, &vp);
+
+      /*
+       * Setup sampler state
+       * Note: we should only have to set the min/max LOD clamps to ensure
+       * we grab texels from the right mipmap level.  But some hardware
+       * has trouble with min clamping so we also set the lod_bias to
+       * try to work around that.
+       */
+      ctx->sampler.min_lod = ctx->sampler.max_lod = (float) srcLevel;
+      ctx->sampler.lod_bias = (float) srcLevel;
+      cso_single_sampler(ctx->cso, 0, &ctx->sampler);
+      cso_single_sampler_done(ctx->cso);
+
       for (i = 0; i < nr_layers; i++) {
          struct pipe_surface *surf, surf_templ;
+         unsigned quad_offset;
+
          if (pt->target == PIPE_TEXTURE_3D) {
             /* in theory with geom shaders and driver with full layer support
                could do that in one go. */
             layer = i;
-            /* XXX hmm really? */
-            rcoord = (float)layer / (float)nr_layers + 1.0f / (float)(nr_layers * 2);
+            quad_offset = quad++;
          } else if (pt->target == PIPE_TEXTURE_2D_ARRAY || pt->target == PIPE_TEXTURE_1D_ARRAY) {
 	    layer = i;
-	    rcoord = (float)layer;
-	 } else
+            quad_offset = i;
+	 } else {
             layer = face;
+            quad_offset = 0;
+         }
 
          memset(&surf_templ, 0, sizeof(surf_templ));
          u_surface_default_template(&surf_templ, pt, PIPE_BIND_RENDER_TARGET);
@@ -1618,45 +1878,12 @@ util_gen_mipmap(struct gen_mipmap_state *ctx,
           * Setup framebuffer / dest surface
           */
          fb.cbufs[0] = surf;
-         fb.width = u_minify(pt->width0, dstLevel);
-         fb.height = u_minify(pt->height0, dstLevel);
          cso_set_framebuffer(ctx->cso, &fb);
 
-         /* viewport */
-         vp.scale[0] = 0.5f * fb.width;
-         vp.scale[1] = 0.5f * fb.height;
-         vp.scale[2] = 1.0f;
-         vp.scale[3] = 1.0f;
-         vp.translate[0] = 0.5f * fb.width;
-         vp.translate[1] = 0.5f * fb.height;
-         vp.translate[2] = 0.0f;
-         vp.translate[3] = 0.0f;
-         cso_set_viewport(ctx->cso, &vp);
-
-         /*
-          * Setup sampler state
-          * Note: we should only have to set the min/max LOD clamps to ensure
-          * we grab texels from the right mipmap level.  But some hardware
-          * has trouble with min clamping so we also set the lod_bias to
-          * try to work around that.
-          */
-         ctx->sampler.min_lod = ctx->sampler.max_lod = (float) srcLevel;
-         ctx->sampler.lod_bias = (float) srcLevel;
-         cso_single_sampler(ctx->cso, 0, &ctx->sampler);
-         cso_single_sampler_done(ctx->cso);
-
-         cso_set_fragment_sampler_views(ctx->cso, 1, &psv);
-
-         /* quad coords in clip coords */
-         offset = set_vertex_data(ctx,
-                                  pt->target,
-                                  face,
-                                  rcoord);
-
          util_draw_vertex_buffer(ctx->pipe,
                                  ctx->cso,
                                  ctx->vbuf,
-                                 offset,
+                                 offset + quad_offset * sizeof ctx->vertices,
                                  PIPE_PRIM_TRIANGLE_FAN,
                                  4,  /* verts */
                                  2); /* attribs/vert */
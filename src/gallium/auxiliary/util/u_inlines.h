@@ -258,6 +258,9 @@ pipe_buffer_map_range(struct pipe_context *pipe,
 
    u_box_1d(offset, length, &box);
 
+   if (usage & PIPE_TRANSFER_WRITE)
+      buffer->generation++;
+
    *transfer = pipe->get_transfer( pipe,
                                    buffer,
                                    0,
@@ -340,6 +343,8 @@ pipe_buffer_write(struct pipe_context *pipe,
 
    u_box_1d(offset, size, &box);
 
+   buf->generation++;
+
    pipe->transfer_inline_write( pipe,
                                 buf,
                                 0,
@@ -366,6 +371,8 @@ pipe_buffer_write_nooverlap(struct pipe_context *pipe,
 
    u_box_1d(offset, size, &box);
 
+   buf->generation++;
+
    pipe->transfer_inline_write(pipe,
                                buf,
                                0,
@@ -38,6 +38,19 @@
 #include "u_upload_mgr.h"
 
 
+/* Max number of fences remembered in ring-buffer mode.  When full the
+ * oldest is dropped: later fences guard all the data before them too.
+ */
+#define U_UPLOAD_MAX_FENCES 16
+
+
+struct u_upload_fence {
+   struct pipe_fence_handle *fence;
+   unsigned lap;    /* Ring lap and offset the fence was recorded at: */
+   unsigned offset; /* all the data uploaded before is guarded by it. */
+};
+
+
 struct u_upload_mgr {
    struct pipe_context *pipe;
 
@@ -51,6 +64,14 @@ struct u_upload_mgr {
    unsigned size;   /* Actual size of the upload buffer. */
    unsigned offset; /* Aligned offset to the upload buffer, pointing
                      * at the first unused byte. */
+
+   /* Ring-buffer mode, see u_upload_create_ring(). */
+   boolean ring;
+   unsigned lap;      /* Number of times the ring wrapped around. */
+   unsigned safe_end; /* Data of the previous lap before this offset is
+                       * known to be no longer used. */
+   struct u_upload_fence fences[U_UPLOAD_MAX_FENCES]; /* Oldest first. */
+   unsigned num_fences;
 };
 
 
@@ -72,6 +93,59 @@ struct u_upload_mgr *u_upload_create( struct pipe_context *pipe,
    return upload;
 }
 
+struct u_upload_mgr *u_upload_create_ring( struct pipe_context *pipe,
+                                           unsigned size,
+                                           unsigned alignment,
+                                           unsigned bind )
+{
+   struct u_upload_mgr *upload = u_upload_create(pipe, size, alignment, bind);
+   if (!upload)
+      return NULL;
+
+   upload->ring = TRUE;
+   return upload;
+}
+
+/* Drop the first n remembered fences. */
+static void u_upload_drop_fences( struct u_upload_mgr *upload, unsigned n )
+{
+   struct pipe_screen *screen = upload->pipe->screen;
+   unsigned i;
+
+   assert(n <= upload->num_fences);
+
+   for (i = 0; i < n; i++)
+      screen->fence_reference(screen, &upload->fences[i].fence, NULL);
+
+   memmove(upload->fences, upload->fences + n,
+           (upload->num_fences - n) * sizeof upload->fences[0]);
+   upload->num_fences -= n;
+}
+
+void u_upload_fence( struct u_upload_mgr *upload,
+                     struct pipe_fence_handle *fence )
+{
+   struct pipe_screen *screen = upload->pipe->screen;
+   struct u_upload_fence *last;
+
+   if (!upload->ring || !upload->buffer || !fence)
+      return;
+
+   /* Nothing was uploaded since the previous fence, which is enough. */
+   last = upload->num_fences ? &upload->fences[upload->num_fences - 1] : NULL;
+   if (last && last->lap == upload->lap && last->offset == upload->offset)
+      return;
+
+   if (upload->num_fences == U_UPLOAD_MAX_FENCES)
+      u_upload_drop_fences(upload, 1);
+
+   last = &upload->fences[upload->num_fences++];
+   last->fence = NULL;
+   screen->fence_reference(screen, &last->fence, fence);
+   last->lap = upload->lap;
+   last->offset = upload->offset;
+}
+
 void u_upload_unmap( struct u_upload_mgr *upload )
 {
    if (upload->transfer) {
@@ -103,6 +177,7 @@ void u_upload_flush( struct u_upload_mgr *upload )
    u_upload_unmap(upload);
    pipe_resource_reference( &upload->buffer, NULL );
    upload->size = 0;
+   u_upload_drop_fences(upload, upload->num_fences);
 }
 
 
@@ -149,10 +224,90 @@ u_upload_alloc_buffer( struct u_upload_mgr *upload,
 
    upload->size = size;
 
+   /* Fences of the old buffer guard nothing in the new one. */
+   u_upload_drop_fences(upload, upload->num_fences);
+
    upload->offset = 0;
+   upload->lap = 0;
+   upload->safe_end = size;
    return PIPE_OK;
 }
 
+
+/* Make sure the data the previous lap of the ring left before offset "end"
+ * is no longer used, so that it can be overwritten through an
+ * unsynchronized mapping.
+ */
+static boolean
+u_upload_ring_reclaim( struct u_upload_mgr *upload, unsigned end )
+{
+   struct pipe_screen *screen = upload->pipe->screen;
+   struct pipe_transfer *transfer;
+   unsigned i;
+
+   /* Find the oldest fence guarding that data. */
+   for (i = 0; i < upload->num_fences; i++) {
+      struct u_upload_fence *f = &upload->fences[i];
+
+      if (f->lap == upload->lap || f->offset >= end) {
+         if (!screen->fence_signalled(screen, f->fence))
+            break;
+
+         upload->safe_end = f->lap == upload->lap ? upload->size : f->offset;
+         u_upload_drop_fences(upload, i + 1);
+         return TRUE;
+      }
+   }
+
+   /* No signalled fence: ask the driver whether the buffer is idle. */
+   u_upload_unmap(upload);
+   if (pipe_buffer_map_range(upload->pipe, upload->buffer, 0, 1,
+                             PIPE_TRANSFER_WRITE | PIPE_TRANSFER_DONTBLOCK,
+                             &transfer)) {
+      pipe_buffer_unmap(upload->pipe, transfer);
+      upload->safe_end = upload->size;
+      u_upload_drop_fences(upload, upload->num_fences);
+      return TRUE;
+   }
+
+   return FALSE;
+}
+
+
+/* Find room for alloc_size bytes at or after alloc_offset in the ring,
+ * wrapping around if needed.  Returns FALSE if a new buffer is needed.
+ */
+static boolean
+u_upload_ring_alloc( struct u_upload_mgr *upload,
+                     unsigned alloc_offset,
+                     unsigned alloc_size )
+{
+   unsigned offset = MAX2(upload->offset, alloc_offset);
+   unsigned i;
+
+   if (!upload->buffer || alloc_offset + alloc_size > upload->size)
+      return FALSE;
+
+   if (offset + alloc_size > upload->size) {
+      /* Wrap around. */
+      u_upload_unmap(upload);
+      upload->lap++;
+      upload->offset = 0;
+      upload->safe_end = 0;
+
+      /* Fences recorded two laps ago don't guard anything anymore. */
+      for (i = 0; i < upload->num_fences; i++)
+         if (upload->fences[i].lap + 1 >= upload->lap)
+            break;
+      u_upload_drop_fences(upload, i);
+
+      offset = alloc_offset;
+   }
+
+   return offset + alloc_size <= upload->safe_end ||
+          u_upload_ring_reclaim(upload, offset + alloc_size);
+}
+
 enum pipe_error u_upload_alloc( struct u_upload_mgr *upload,
                                 unsigned min_out_offset,
                                 unsigned size,
@@ -166,7 +321,15 @@ enum pipe_error u_upload_alloc( struct u_upload_mgr *upload,
 
    /* Make sure we have enough space in the upload buffer
     * for the sub-allocation. */
-   if (MAX2(upload->offset, alloc_offset) + alloc_size > upload->size) {
+   if (upload->ring) {
+      if (!u_upload_ring_alloc(upload, alloc_offset, alloc_size)) {
+         enum pipe_error ret = u_upload_alloc_buffer(upload,
+                                                     alloc_offset + alloc_size);
+         if (ret != PIPE_OK)
+            return ret;
+      }
+   }
+   else if (MAX2(upload->offset, alloc_offset) + alloc_size > upload->size) {
       enum pipe_error ret = u_upload_alloc_buffer(upload,
                                                   alloc_offset + alloc_size);
       if (ret != PIPE_OK)
@@ -182,6 +345,13 @@ enum pipe_error u_upload_alloc( struct u_upload_mgr *upload,
 					  PIPE_TRANSFER_FLUSH_EXPLICIT |
 					  PIPE_TRANSFER_UNSYNCHRONIZED,
 					  &upload->transfer);
+      if (!upload->map && upload->ring) {
+         /* No unsynchronized maps, use a new buffer each time it's full. */
+         upload->ring = FALSE;
+         u_upload_flush(upload);
+         return u_upload_alloc(upload, min_out_offset, size,
+                               out_offset, outbuf, ptr);
+      }
       if (!upload->map) {
          pipe_resource_reference(outbuf, NULL);
          *ptr = NULL;
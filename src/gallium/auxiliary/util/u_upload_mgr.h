@@ -36,6 +36,7 @@
 
 struct pipe_context;
 struct pipe_resource;
+struct pipe_fence_handle;
 
 
 /**
@@ -51,6 +52,27 @@ struct u_upload_mgr *u_upload_create( struct pipe_context *pipe,
                                       unsigned alignment,
                                       unsigned bind );
 
+/**
+ * Create the upload manager in ring-buffer mode.
+ *
+ * A single buffer of the given size is reused: when it is full, uploads
+ * wrap around to its start as soon as the data there is no longer used,
+ * and are written through unsynchronized mappings.  Whether the data is
+ * still used is found with the fences passed to u_upload_fence(), or else
+ * by asking the driver whether the buffer is busy.  When it is, or when
+ * the driver can't map the buffer unsynchronized, a new buffer is created
+ * as in the normal mode.
+ *
+ * \param pipe          Pipe driver.
+ * \param size          Size of the ring buffer, in bytes.
+ * \param alignment     Alignment of each suballocation in the upload buffer.
+ * \param bind          Bitmask of PIPE_BIND_* flags.
+ */
+struct u_upload_mgr *u_upload_create_ring( struct pipe_context *pipe,
+                                           unsigned size,
+                                           unsigned alignment,
+                                           unsigned bind );
+
 /**
  * Destroy the upload manager.
  */
@@ -66,6 +88,15 @@ void u_upload_destroy( struct u_upload_mgr *upload );
 
 void u_upload_flush( struct u_upload_mgr *upload );
 
+/**
+ * Guard the data uploaded so far with a fence.
+ *
+ * For ring-buffer mode, to be called on hardware flushes with their fence,
+ * instead of u_upload_flush().  Does nothing in the normal mode.
+ */
+void u_upload_fence( struct u_upload_mgr *upload,
+                     struct pipe_fence_handle *fence );
+
 /**
  * Unmap upload buffer
  *
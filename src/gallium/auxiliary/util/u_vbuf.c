@@ -37,6 +37,8 @@
 #include "cso_cache/cso_cache.h"
 #include "cso_cache/cso_hash.h"
 
+DEBUG_GET_ONCE_BOOL_OPTION(vbuf_stats, "GALLIUM_VBUF_STATS", FALSE)
+
 struct u_vbuf_elements {
    unsigned count;
    struct pipe_vertex_element ve[PIPE_MAX_ATTRIBS];
@@ -71,6 +73,23 @@ struct u_vbuf_elements {
    void *driver_cso;
 };
 
+/* Number of translated vertex buffers kept for reuse. */
+#define U_VBUF_CACHE_SIZE 16
+
+/* A static vertex buffer translated in full, which can be reused by draws
+ * until the source buffer is written to. */
+struct u_vbuf_cache_entry {
+   struct pipe_resource *src;    /* NULL if the entry is unused */
+   unsigned generation;          /* of src when translated */
+   unsigned src_offset;
+   unsigned src_stride;
+   struct translate_key key;
+
+   struct pipe_resource *out;    /* vertex i is at i * key.output_stride */
+   unsigned count;               /* number of translated vertices */
+   unsigned last_used;
+};
+
 enum {
    VB_VERTEX = 0,
    VB_INSTANCE = 1,
@@ -122,6 +141,13 @@ struct u_vbuf {
    uint32_t incompatible_vb_mask; /* each bit describes a corresp. buffer */
    /* Which buffer has a non-zero stride. */
    uint32_t nonzero_stride_vb_mask; /* each bit describes a corresp. buffer */
+
+   /* Translated static vertex buffers. */
+   struct u_vbuf_cache_entry cache[U_VBUF_CACHE_SIZE];
+   unsigned cache_clock;
+
+   /* Statistics since the last u_vbuf_get_stats, and in total. */
+   struct u_vbuf_stats stats, total_stats;
 };
 
 static void *
@@ -184,8 +210,8 @@ u_vbuf_create(struct pipe_context *pipe,
    mgr->translate_cache = translate_cache_create();
    memset(mgr->fallback_vbs, ~0, sizeof(mgr->fallback_vbs));
 
-   mgr->uploader = u_upload_create(pipe, 1024 * 1024, 4,
-                                   PIPE_BIND_VERTEX_BUFFER);
+   mgr->uploader = u_upload_create_ring(pipe, 1024 * 1024, 4,
+                                        PIPE_BIND_VERTEX_BUFFER);
 
    return mgr;
 }
@@ -235,6 +261,13 @@ void u_vbuf_set_vertex_elements(struct u_vbuf *mgr, unsigned count,
    mgr->ve = u_vbuf_set_vertex_elements_internal(mgr, count, states);
 }
 
+static void
+u_vbuf_cache_entry_release(struct u_vbuf_cache_entry *entry)
+{
+   pipe_resource_reference(&entry->src, NULL);
+   pipe_resource_reference(&entry->out, NULL);
+}
+
 void u_vbuf_destroy(struct u_vbuf *mgr)
 {
    unsigned i;
@@ -248,12 +281,191 @@ void u_vbuf_destroy(struct u_vbuf *mgr)
       pipe_resource_reference(&mgr->real_vertex_buffer[i].buffer, NULL);
    }
 
+   for (i = 0; i < U_VBUF_CACHE_SIZE; i++) {
+      u_vbuf_cache_entry_release(&mgr->cache[i]);
+   }
+
+   if (debug_get_option_vbuf_stats()) {
+      debug_printf("u_vbuf: %llu bytes translated, %llu bytes reused\n",
+                   (unsigned long long) mgr->total_stats.translated,
+                   (unsigned long long) mgr->total_stats.reused);
+   }
+
    translate_cache_destroy(mgr->translate_cache);
    u_upload_destroy(mgr->uploader);
    cso_cache_delete(mgr->cso_cache);
    FREE(mgr);
 }
 
+void u_vbuf_get_stats(struct u_vbuf *mgr, struct u_vbuf_stats *stats)
+{
+   *stats = mgr->stats;
+   memset(&mgr->stats, 0, sizeof(mgr->stats));
+}
+
+void u_vbuf_fence(struct u_vbuf *mgr, struct pipe_fence_handle *fence)
+{
+   u_upload_fence(mgr->uploader, fence);
+}
+
+static void
+u_vbuf_add_stats(struct u_vbuf *mgr, unsigned translated, unsigned reused)
+{
+   mgr->stats.translated += translated;
+   mgr->stats.reused += reused;
+   mgr->total_stats.translated += translated;
+   mgr->total_stats.reused += reused;
+}
+
+/* Return the number of whole vertices from offset to the end of the buffer,
+ * or 0 if there's none. */
+static unsigned
+u_vbuf_num_vertices(struct pipe_resource *buffer, unsigned offset,
+                    unsigned stride, const struct translate_key *key)
+{
+   unsigned i, end = 0;
+
+   for (i = 0; i < key->nr_elements; i++) {
+      const struct translate_element *te = &key->element[i];
+      end = MAX2(end, te->input_offset +
+                      util_format_get_blocksize(te->input_format));
+   }
+
+   if (offset + end > buffer->width0)
+      return 0;
+   if (!stride)
+      return 1;
+   return (buffer->width0 - offset - end) / stride + 1;
+}
+
+/* Whether a cache entry should be replaced before another one: free
+ * entries first, then those whose source buffer is only referenced by the
+ * cache, then the least recently used. */
+static boolean
+u_vbuf_cache_evict_before(const struct u_vbuf_cache_entry *a,
+                          const struct u_vbuf_cache_entry *b)
+{
+   int rank_a = !a->src ? 0 : a->src->reference.count == 1 ? 1 : 2;
+   int rank_b = !b->src ? 0 : b->src->reference.count == 1 ? 1 : 2;
+
+   if (rank_a != rank_b) {
+      return rank_a < rank_b;
+   }
+   return a->last_used < b->last_used;
+}
+
+/* Look for a translation of the vertex buffer in the cache, or translate
+ * the whole buffer and put it into the cache.  Only worth it for buffers
+ * which aren't expected to change.
+ *
+ * The buffer offset is folded into the vertex index, so that draws from
+ * different parts of a buffer share the translation.
+ *
+ * Return the buffer with the translated vertices and the offset to use
+ * with it, or NULL.
+ */
+static struct pipe_resource *
+u_vbuf_translate_cached(struct u_vbuf *mgr, struct translate_key *key,
+                        struct pipe_vertex_buffer *vb,
+                        int start, unsigned num, unsigned *out_offset)
+{
+   struct u_vbuf_cache_entry *entry, *victim = NULL;
+   struct pipe_transfer *transfer, *out_transfer;
+   struct translate *tr;
+   uint8_t *map, *out_map;
+   unsigned i, count, src_offset, first;
+
+   if (vb->buffer->user_ptr || start < 0 ||
+       (vb->buffer->usage != PIPE_USAGE_STATIC &&
+        vb->buffer->usage != PIPE_USAGE_IMMUTABLE)) {
+      return NULL;
+   }
+
+   if (vb->stride) {
+      src_offset = vb->buffer_offset % vb->stride;
+      first = vb->buffer_offset / vb->stride;
+   } else {
+      src_offset = vb->buffer_offset;
+      first = 0;
+   }
+
+   for (i = 0; i < U_VBUF_CACHE_SIZE; i++) {
+      entry = &mgr->cache[i];
+
+      if (entry->src == vb->buffer &&
+          entry->src_offset == src_offset &&
+          entry->src_stride == vb->stride &&
+          !translate_key_compare(&entry->key, key)) {
+         if (entry->generation == vb->buffer->generation &&
+             first + start + num <= entry->count) {
+            entry->last_used = ++mgr->cache_clock;
+            u_vbuf_add_stats(mgr, 0, num * key->output_stride);
+            *out_offset = first * key->output_stride;
+            return entry->out;
+         }
+         /* Written to since, or too small: replace it. */
+         victim = entry;
+         break;
+      }
+
+      if (!victim || u_vbuf_cache_evict_before(entry, victim)) {
+         victim = entry;
+      }
+   }
+
+   count = u_vbuf_num_vertices(vb->buffer, src_offset, vb->stride, key);
+   if (first + start + num > count) {
+      return NULL;
+   }
+
+   u_vbuf_cache_entry_release(victim);
+
+   victim->out = pipe_buffer_create(mgr->pipe->screen,
+                                    PIPE_BIND_VERTEX_BUFFER,
+                                    PIPE_USAGE_STATIC,
+                                    count * key->output_stride);
+   if (!victim->out) {
+      return NULL;
+   }
+
+   map = pipe_buffer_map_range(mgr->pipe, vb->buffer, src_offset,
+                               vb->buffer->width0 - src_offset,
+                               PIPE_TRANSFER_READ, &transfer);
+   out_map = pipe_buffer_map_range(mgr->pipe, victim->out, 0,
+                                   count * key->output_stride,
+                                   PIPE_TRANSFER_WRITE |
+                                   PIPE_TRANSFER_DISCARD_WHOLE_RESOURCE,
+                                   &out_transfer);
+   if (!map || !out_map) {
+      if (map)
+         pipe_buffer_unmap(mgr->pipe, transfer);
+      if (out_map)
+         pipe_buffer_unmap(mgr->pipe, out_transfer);
+      pipe_resource_reference(&victim->out, NULL);
+      return NULL;
+   }
+
+   tr = translate_cache_find(mgr->translate_cache, key);
+   tr->set_buffer(tr, key->element[0].input_buffer, map, vb->stride, ~0);
+   tr->run(tr, 0, count, 0, out_map);
+
+   pipe_buffer_unmap(mgr->pipe, out_transfer);
+   pipe_buffer_unmap(mgr->pipe, transfer);
+
+   pipe_resource_reference(&victim->src, vb->buffer);
+   victim->generation = vb->buffer->generation;
+   victim->src_offset = src_offset;
+   victim->src_stride = vb->stride;
+   victim->key = *key;
+   victim->count = count;
+   victim->last_used = ++mgr->cache_clock;
+
+   u_vbuf_add_stats(mgr, count * key->output_stride,
+                    num * key->output_stride);
+   *out_offset = first * key->output_stride;
+   return victim->out;
+}
+
 static void
 u_vbuf_translate_buffers(struct u_vbuf *mgr, struct translate_key *key,
                          unsigned vb_mask, unsigned out_vb,
@@ -267,6 +479,21 @@ u_vbuf_translate_buffers(struct u_vbuf *mgr, struct translate_key *key,
    uint8_t *out_map;
    unsigned i, out_offset;
 
+   /* Translations of a single static buffer can be reused. */
+   if (!unroll_indices && util_is_power_of_two(vb_mask)) {
+      struct pipe_resource *cached =
+         u_vbuf_translate_cached(mgr, key,
+                                 &mgr->vertex_buffer[ffs(vb_mask) - 1],
+                                 start_vertex, num_vertices, &out_offset);
+      if (cached) {
+         mgr->real_vertex_buffer[out_vb].buffer_offset = out_offset;
+         mgr->real_vertex_buffer[out_vb].stride = key->output_stride;
+         pipe_resource_reference(&mgr->real_vertex_buffer[out_vb].buffer,
+                                 cached);
+         return;
+      }
+   }
+
    /* Get a translate object. */
    tr = translate_cache_find(mgr->translate_cache, key);
 
@@ -351,6 +578,9 @@ u_vbuf_translate_buffers(struct u_vbuf *mgr, struct translate_key *key,
       tr->run(tr, 0, num_vertices, 0, out_map);
    }
 
+   u_vbuf_add_stats(mgr, key->output_stride *
+                    (unroll_indices ? num_indices : num_vertices), 0);
+
    /* Unmap all buffers. */
    for (i = 0; i < mgr->nr_vertex_buffers; i++) {
       if (vb_transfer[i]) {
@@ -59,6 +59,12 @@ struct u_vbuf_caps {
    unsigned user_vertex_buffers:1;
 };
 
+/* Vertex translation statistics, in bytes of translated vertices. */
+struct u_vbuf_stats {
+   uint64_t translated; /* translated for draws */
+   uint64_t reused;     /* translated earlier and reused */
+};
+
 
 void u_vbuf_get_caps(struct pipe_screen *screen, struct u_vbuf_caps *caps);
 
@@ -68,6 +74,13 @@ u_vbuf_create(struct pipe_context *pipe,
 
 void u_vbuf_destroy(struct u_vbuf *mgr);
 
+/* Get the statistics since the last call, e.g. per frame. */
+void u_vbuf_get_stats(struct u_vbuf *mgr, struct u_vbuf_stats *stats);
+
+/* Guard the vertices uploaded so far with the fence of a hardware flush,
+ * so that the upload buffer can be reused once it's signalled. */
+void u_vbuf_fence(struct u_vbuf *mgr, struct pipe_fence_handle *fence);
+
 /* State and draw functions. */
 void u_vbuf_set_vertex_elements(struct u_vbuf *mgr, unsigned count,
                                 const struct pipe_vertex_element *states);
@@ -0,0 +1,287 @@
+/**
+ * Benchmark for the graph coloring register allocator.
+ *
+ * Interference graphs are either read from files written by setting
+ * MESA_RA_DUMP while running any driver that uses the allocator, or
+ * generated from random live ranges.  Each graph is allocated several
+ * times and the best time is reported, along with a hash of the
+ * resulting assignment so that allocator changes can be checked for
+ * identical results.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "main/glheader.h"
+#include "program/register_allocate.h"
+#include "ralloc.h"
+
+struct bench_graph {
+	const char * name;
+	struct ra_regs * regs;
+	unsigned int node_count;
+	unsigned int * node_class;
+	int * node_reg;
+	float * spill_cost;
+	unsigned int * edges;
+	unsigned int edge_count;
+	unsigned int edge_size;
+};
+
+static double now(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void add_edge(struct bench_graph * bg, unsigned int n1, unsigned int n2)
+{
+	if (bg->edge_count == bg->edge_size) {
+		bg->edge_size = bg->edge_size ? bg->edge_size * 2 : 1024;
+		bg->edges = reralloc(bg, bg->edges, unsigned int,
+							2 * bg->edge_size);
+	}
+	bg->edges[2 * bg->edge_count] = n1;
+	bg->edges[2 * bg->edge_count + 1] = n2;
+	bg->edge_count++;
+}
+
+static void alloc_nodes(struct bench_graph * bg, unsigned int count)
+{
+	bg->node_count = count;
+	bg->node_class = rzalloc_array(bg, unsigned int, count);
+	bg->node_reg = ralloc_array(bg, int, count);
+	bg->spill_cost = rzalloc_array(bg, float, count);
+	memset(bg->node_reg, 0xff, count * sizeof(int));
+}
+
+/**
+ * Reads the next graph in the format written by ra_dump_graph().
+ *
+ * \return NULL at the end of the file or on a parse error.
+ */
+static struct bench_graph * read_graph(void * mem_ctx, FILE * f,
+							const char * name)
+{
+	struct bench_graph * bg;
+	unsigned int reg_count, class_count, i, j;
+	char word[8];
+
+	if (fscanf(f, " ra_regs %u %u", &reg_count, &class_count) != 2)
+		return NULL;
+
+	bg = rzalloc(mem_ctx, struct bench_graph);
+	bg->name = name;
+	bg->regs = ra_alloc_reg_set(bg, reg_count);
+	for (i = 0; i < class_count; i++)
+		ra_alloc_reg_class(bg->regs);
+
+	for (i = 0; i < reg_count; i++) {
+		unsigned int r, count, r2;
+		if (fscanf(f, " r %u %u", &r, &count) != 2 || r >= reg_count)
+			goto fail;
+		for (j = 0; j < count; j++) {
+			if (fscanf(f, "%u", &r2) != 1 || r2 >= reg_count)
+				goto fail;
+			ra_add_reg_conflict(bg->regs, r, r2);
+		}
+	}
+
+	for (i = 0; i < class_count; i++) {
+		unsigned int c, count, r;
+		if (fscanf(f, " c %u %u", &c, &count) != 2 || c >= class_count)
+			goto fail;
+		for (j = 0; j < count; j++) {
+			if (fscanf(f, "%u", &r) != 1 || r >= reg_count)
+				goto fail;
+			ra_class_add_reg(bg->regs, c, r);
+		}
+	}
+	ra_set_finalize(bg->regs);
+
+	if (fscanf(f, " ra_graph %u", &bg->node_count) != 1)
+		goto fail;
+	alloc_nodes(bg, bg->node_count);
+
+	for (i = 0; i < bg->node_count; i++) {
+		unsigned int n, count, n2;
+		if (fscanf(f, " n %u %u %d %f %u", &n, &bg->node_class[i],
+				&bg->node_reg[i], &bg->spill_cost[i], &count) != 5
+				|| n != i || bg->node_class[i] >= class_count)
+			goto fail;
+		for (j = 0; j < count; j++) {
+			if (fscanf(f, "%u", &n2) != 1 || n2 >= bg->node_count)
+				goto fail;
+			add_edge(bg, n, n2);
+		}
+	}
+
+	if (fscanf(f, " %7s", word) != 1 || strcmp(word, "end"))
+		goto fail;
+
+	return bg;
+
+fail:
+	fprintf(stderr, "%s: parse error\n", name);
+	ralloc_free(bg);
+	return NULL;
+}
+
+/**
+ * Generates a graph out of random live ranges over a straight-line
+ * program, with a register set similar to what the hardware backends
+ * use: single registers and aligned pairs of them.
+ */
+static struct bench_graph * generate_graph(void * mem_ctx,
+						unsigned int node_count)
+{
+	const unsigned int base_regs = 128;
+	struct bench_graph * bg;
+	unsigned int * end;
+	unsigned int i, j;
+	char * name;
+
+	bg = rzalloc(mem_ctx, struct bench_graph);
+	name = ralloc_asprintf(bg, "random-%u", node_count);
+	bg->name = name;
+
+	bg->regs = ra_alloc_reg_set(bg, base_regs + base_regs / 2);
+	ra_alloc_reg_class(bg->regs);
+	ra_alloc_reg_class(bg->regs);
+	for (i = 0; i < base_regs; i++)
+		ra_class_add_reg(bg->regs, 0, i);
+	for (i = 0; i < base_regs / 2; i++) {
+		unsigned int pair = base_regs + i;
+		ra_add_transitive_reg_conflict(bg->regs, 2 * i, pair);
+		ra_add_transitive_reg_conflict(bg->regs, 2 * i + 1, pair);
+		ra_class_add_reg(bg->regs, 1, pair);
+	}
+	ra_set_finalize(bg->regs);
+
+	alloc_nodes(bg, node_count);
+	end = ralloc_array(bg, unsigned int, node_count);
+
+	/* Node i is defined by instruction i.  Most values die shortly
+	 * after, a few stay live across a good part of the program. */
+	for (i = 0; i < node_count; i++) {
+		unsigned int len = rand() % 10 ? 1 + rand() % 20
+						: 20 + rand() % 400;
+		end[i] = i + len;
+		bg->node_class[i] = rand() % 5 ? 0 : 1;
+		bg->spill_cost[i] = 1.0 + rand() % 100;
+	}
+
+	for (i = 0; i < node_count; i++) {
+		for (j = i + 1; j < node_count && j < end[i]; j++)
+			add_edge(bg, i, j);
+	}
+
+	return bg;
+}
+
+static struct ra_graph * build_graph(struct bench_graph * bg)
+{
+	struct ra_graph * g;
+	unsigned int i;
+
+	g = ra_alloc_interference_graph(bg->regs, bg->node_count);
+	for (i = 0; i < bg->node_count; i++) {
+		ra_set_node_class(g, i, bg->node_class[i]);
+		if (bg->node_reg[i] >= 0)
+			ra_set_node_reg(g, i, bg->node_reg[i]);
+		if (bg->spill_cost[i] != 0.0)
+			ra_set_node_spill_cost(g, i, bg->spill_cost[i]);
+	}
+	for (i = 0; i < bg->edge_count; i++)
+		ra_add_node_interference(g, bg->edges[2 * i],
+						bg->edges[2 * i + 1]);
+	return g;
+}
+
+static void run_graph(struct bench_graph * bg, unsigned int runs)
+{
+	double best_build = 0, best_alloc = 0;
+	unsigned int hash = 0;
+	int spill = -1;
+	GLboolean ok = GL_FALSE;
+	unsigned int run, i;
+
+	for (run = 0; run < runs; run++) {
+		struct ra_graph * g;
+		double start, built, done;
+
+		start = now();
+		g = build_graph(bg);
+		built = now();
+		ok = ra_allocate_no_spills(g);
+		if (!ok)
+			spill = ra_get_best_spill_node(g);
+		done = now();
+
+		if (run == 0 || built - start < best_build)
+			best_build = built - start;
+		if (run == 0 || done - built < best_alloc)
+			best_alloc = done - built;
+
+		if (run == 0 && ok) {
+			for (i = 0; i < bg->node_count; i++)
+				hash = hash * 31 + ra_get_node_reg(g, i);
+		}
+		ralloc_free(g);
+	}
+
+	printf("%-24s %7u nodes %9u edges  build %8.3f ms  alloc %8.3f ms  ",
+		bg->name, bg->node_count, bg->edge_count,
+		best_build * 1000, best_alloc * 1000);
+	if (ok)
+		printf("ok %08x\n", hash);
+	else
+		printf("spill node %d\n", spill);
+}
+
+int main(int argc, char ** argv)
+{
+	void * mem_ctx = ralloc_context(NULL);
+	unsigned int runs = 5;
+	int files = 0;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		struct bench_graph * bg;
+		FILE * f;
+
+		if (!strncmp(argv[i], "--runs=", 7)) {
+			runs = atoi(argv[i] + 7);
+			continue;
+		}
+
+		f = fopen(argv[i], "r");
+		if (!f) {
+			fprintf(stderr, "%s: cannot open\n", argv[i]);
+			return 1;
+		}
+		while ((bg = read_graph(mem_ctx, f, argv[i]))) {
+			run_graph(bg, runs);
+			ralloc_free(bg);
+		}
+		fclose(f);
+		files++;
+	}
+
+	if (!files) {
+		static const unsigned int sizes[] = { 500, 2000, 8000, 16000 };
+
+		srand(1);
+		for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+			struct bench_graph * bg = generate_graph(mem_ctx, sizes[i]);
+			run_graph(bg, runs);
+			ralloc_free(bg);
+		}
+	}
+
+	ralloc_free(mem_ctx);
+	return 0;
+}
@@ -504,8 +504,8 @@ struct pipe_context* r300_create_context(struct pipe_screen* screen,
                 r300->screen->info.pci_id,
                 r300->screen->info.r300_num_gb_pipes,
                 r300->screen->info.r300_num_z_pipes,
-                r300->screen->info.gart_size >> 20,
-                r300->screen->info.vram_size >> 20,
+                (int) (r300->screen->info.gart_size >> 20),
+                (int) (r300->screen->info.vram_size >> 20),
                 "YES", /* XXX really? */
                 r300->screen->caps.zmask_ram ? "YES" : "NO",
                 r300->screen->caps.hiz_ram ? "YES" : "NO");
@@ -145,6 +145,7 @@ static int r300_get_param(struct pipe_screen* pscreen, enum pipe_cap param)
         case PIPE_CAP_FRAGMENT_COLOR_CLAMPED:
         case PIPE_CAP_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION:
         case PIPE_CAP_USER_VERTEX_BUFFERS:
+        case PIPE_CAP_CPU_MIPMAP_GENERATION:
             return 0;
 
         /* SWTCL-only features. */
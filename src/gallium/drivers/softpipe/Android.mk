@@ -52,6 +52,7 @@ C_SOURCES = \
 	sp_texture.c \
 	sp_tex_sample.c \
 	sp_tex_tile_cache.c \
+	sp_tile_bin.c \
 	sp_tile_cache.c \
 	sp_surface.c
 
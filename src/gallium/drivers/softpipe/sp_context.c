@@ -49,6 +49,7 @@
 #include "sp_tile_cache.h"
 #include "sp_tex_tile_cache.h"
 #include "sp_texture.h"
+#include "sp_tile_bin.h"
 #include "sp_query.h"
 #include "sp_screen.h"
 
@@ -102,6 +103,9 @@ softpipe_destroy( struct pipe_context *pipe )
    if (softpipe->draw)
       draw_destroy( softpipe->draw );
 
+   if (softpipe->tile_bins)
+      sp_destroy_tile_bins( softpipe->tile_bins );
+
    if (softpipe->quad.shade)
       softpipe->quad.shade->destroy( softpipe->quad.shade );
 
@@ -232,13 +236,20 @@ softpipe_create_context( struct pipe_screen *screen,
 {
    struct softpipe_screen *sp_screen = softpipe_screen(screen);
    struct softpipe_context *softpipe = CALLOC_STRUCT(softpipe_context);
-   uint i;
+   uint i, num_threads;
 
    util_init_math();
 
    softpipe->dump_fs = debug_get_bool_option( "SOFTPIPE_DUMP_FS", FALSE );
    softpipe->dump_gs = debug_get_bool_option( "SOFTPIPE_DUMP_GS", FALSE );
 
+   /* Number of threads to do quad processing in, 0 means do it all in
+    * the calling thread.  Threading is off by default since softpipe is
+    * meant to be the reference rasterizer.
+    */
+   num_threads = debug_get_num_option( "SOFTPIPE_NUM_THREADS", 0 );
+   num_threads = MIN2(num_threads, SP_MAX_THREADS);
+
    softpipe->pipe.screen = screen;
    softpipe->pipe.destroy = softpipe_destroy;
    softpipe->pipe.priv = priv;
@@ -271,8 +282,10 @@ softpipe_create_context( struct pipe_screen *screen,
     * Must be before quad stage setup!
     */
    for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++)
-      softpipe->cbuf_cache[i] = sp_create_tile_cache( &softpipe->pipe );
-   softpipe->zsbuf_cache = sp_create_tile_cache( &softpipe->pipe );
+      softpipe->cbuf_cache[i] = sp_create_tile_cache( &softpipe->pipe,
+                                                      num_threads );
+   softpipe->zsbuf_cache = sp_create_tile_cache( &softpipe->pipe,
+                                                 num_threads );
 
    for (i = 0; i < PIPE_MAX_SAMPLERS; i++) {
       softpipe->fragment_tex_cache[i] = sp_create_tex_tile_cache( &softpipe->pipe );
@@ -300,6 +313,11 @@ softpipe_create_context( struct pipe_screen *screen,
    softpipe->quad.blend = sp_quad_blend_stage(softpipe);
    softpipe->quad.pstipple = sp_quad_polygon_stipple_stage(softpipe);
 
+   if (num_threads) {
+      softpipe->tile_bins = sp_create_tile_bins(softpipe, num_threads);
+      if (!softpipe->tile_bins)
+         goto fail;
+   }
 
    /*
     * Create drawing context and plug our rendering stage into it.
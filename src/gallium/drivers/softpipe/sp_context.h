@@ -54,6 +54,7 @@ struct sp_fragment_shader;
 struct sp_vertex_shader;
 struct sp_velems_state;
 struct sp_so_state;
+struct sp_tile_bins;
 
 struct softpipe_context {
    struct pipe_context pipe;  /**< base class */
@@ -171,6 +172,9 @@ struct softpipe_context {
 
    struct tgsi_exec_machine *fs_machine;
 
+   /** Tile bins and rasterizer threads, NULL if not threaded */
+   struct sp_tile_bins *tile_bins;
+
    /** The primitive drawing context */
    struct draw_context *draw;
 
@@ -38,6 +38,7 @@
 #include "sp_state.h"
 #include "sp_tile_cache.h"
 #include "sp_tex_tile_cache.h"
+#include "sp_tile_bin.h"
 
 
 void
@@ -60,6 +61,8 @@ softpipe_flush( struct pipe_context *pipe,
       for (i = 0; i < softpipe->num_geometry_sampler_views; i++) {
          sp_flush_tex_tile_cache(softpipe->geometry_tex_cache[i]);
       }
+      if (softpipe->tile_bins)
+         sp_tile_bins_flush_tex_caches(softpipe->tile_bins);
    }
 
    /* If this is a swapbuffers, just flush color buffers.
@@ -40,6 +40,7 @@
 #include "sp_setup.h"
 #include "sp_state.h"
 #include "sp_prim_vbuf.h"
+#include "sp_tile_bin.h"
 #include "draw/draw_context.h"
 #include "draw/draw_vbuf.h"
 #include "util/u_memory.h"
@@ -345,6 +346,10 @@ sp_vbuf_draw_elements(struct vbuf_render *vbr, const ushort *indices, uint nr)
    default:
       assert(0);
    }
+
+   /* let the rasterizer threads finish before anything else can change */
+   if (softpipe->tile_bins)
+      sp_tile_bins_flush(softpipe->tile_bins);
 }
 
 
@@ -539,6 +544,10 @@ sp_vbuf_draw_arrays(struct vbuf_render *vbr, uint start, uint nr)
    default:
       assert(0);
    }
+
+   /* let the rasterizer threads finish before anything else can change */
+   if (softpipe->tile_bins)
+      sp_tile_bins_flush(softpipe->tile_bins);
 }
 
 static void
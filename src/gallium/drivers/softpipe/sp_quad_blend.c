@@ -35,6 +35,7 @@
 #include "util/u_memory.h"
 #include "util/u_format.h"
 #include "util/u_dual_blend.h"
+#include "util/u_sse.h"
 #include "sp_context.h"
 #include "sp_state.h"
 #include "sp_quad.h"
@@ -933,9 +934,8 @@ blend_fallback(struct quad_stage *qs,
       const uint blend_buf = blend->independent_blend_enable ? cbuf : 0;
       float dest[4][TGSI_QUAD_SIZE];
       struct softpipe_cached_tile *tile
-         = sp_get_cached_tile(softpipe->cbuf_cache[cbuf],
-                              quads[0]->input.x0, 
-                              quads[0]->input.y0);
+         = sp_get_cached_tile_quads(softpipe->cbuf_cache[cbuf],
+                                    quads, nr);
       const boolean clamp = bqs->clamp[cbuf];
       const float *blend_color;
       const boolean dual_source_blend = util_blend_state_is_dual(blend, cbuf);
@@ -1035,9 +1035,8 @@ blend_single_add_src_alpha_inv_src_alpha(struct quad_stage *qs,
    uint i, j, q;
 
    struct softpipe_cached_tile *tile
-      = sp_get_cached_tile(qs->softpipe->cbuf_cache[0],
-                           quads[0]->input.x0, 
-                           quads[0]->input.y0);
+      = sp_get_cached_tile_quads(qs->softpipe->cbuf_cache[0],
+                                 quads, nr);
 
    for (q = 0; q < nr; q++) {
       struct quad_header *quad = quads[q];
@@ -1109,9 +1108,8 @@ blend_single_add_one_one(struct quad_stage *qs,
    uint i, j, q;
 
    struct softpipe_cached_tile *tile
-      = sp_get_cached_tile(qs->softpipe->cbuf_cache[0],
-                           quads[0]->input.x0, 
-                           quads[0]->input.y0);
+      = sp_get_cached_tile_quads(qs->softpipe->cbuf_cache[0],
+                                 quads, nr);
 
    for (q = 0; q < nr; q++) {
       struct quad_header *quad = quads[q];
@@ -1177,9 +1175,8 @@ single_output_color(struct quad_stage *qs,
    uint i, j, q;
 
    struct softpipe_cached_tile *tile
-      = sp_get_cached_tile(qs->softpipe->cbuf_cache[0],
-                           quads[0]->input.x0, 
-                           quads[0]->input.y0);
+      = sp_get_cached_tile_quads(qs->softpipe->cbuf_cache[0],
+                                 quads, nr);
 
    for (q = 0; q < nr; q++) {
       struct quad_header *quad = quads[q];
@@ -1204,6 +1201,141 @@ single_output_color(struct quad_stage *qs,
    }
 }
 
+#if defined(PIPE_ARCH_SSE)
+
+/*
+ * SSE2 versions of the single color buffer cases above, for RGBA buffers.
+ * They work on one pixel (an RGBA vector) at a time and do exactly the
+ * same float operations as the scalar code, so the results are identical.
+ */
+
+
+/**
+ * Clamp to [0, 1] like CLAMP(), i.e. keeping NaNs and negative zero.
+ */
+static INLINE __m128
+clamp_sse(__m128 x)
+{
+   return _mm_max_ps(_mm_setzero_ps(), _mm_min_ps(_mm_set1_ps(1.0f), x));
+}
+
+
+/**
+ * Convert a quad's colors from SoA (rrrr, gggg, ...) to one RGBA vector
+ * per pixel.
+ */
+static INLINE void
+load_quad_colors_sse(float (*quadColor)[4], __m128 pixel[4])
+{
+   __m128 r = _mm_loadu_ps(quadColor[0]);
+   __m128 g = _mm_loadu_ps(quadColor[1]);
+   __m128 b = _mm_loadu_ps(quadColor[2]);
+   __m128 a = _mm_loadu_ps(quadColor[3]);
+
+   _MM_TRANSPOSE4_PS(r, g, b, a);
+
+   pixel[0] = r;
+   pixel[1] = g;
+   pixel[2] = b;
+   pixel[3] = a;
+}
+
+
+static INLINE void
+store_quad_colors_sse(struct softpipe_cached_tile *tile,
+                      int itx, int ity, unsigned mask,
+                      const __m128 pixel[4])
+{
+   if (mask & 1)
+      _mm_storeu_ps(tile->data.color[ity][itx], pixel[0]);
+   if (mask & 2)
+      _mm_storeu_ps(tile->data.color[ity][itx + 1], pixel[1]);
+   if (mask & 4)
+      _mm_storeu_ps(tile->data.color[ity + 1][itx], pixel[2]);
+   if (mask & 8)
+      _mm_storeu_ps(tile->data.color[ity + 1][itx + 1], pixel[3]);
+}
+
+
+static void
+blend_single_add_src_alpha_inv_src_alpha_sse(struct quad_stage *qs,
+                                             struct quad_header *quads[],
+                                             unsigned nr)
+{
+   const struct blend_quad_stage *bqs = blend_quad_stage(qs);
+   const boolean clamp_src =
+      bqs->clamp[0] || qs->softpipe->rasterizer->clamp_fragment_color;
+   const boolean clamp_dst = bqs->clamp[0];
+   const __m128 one = _mm_set1_ps(1.0f);
+   uint j, q;
+
+   struct softpipe_cached_tile *tile
+      = sp_get_cached_tile_quads(qs->softpipe->cbuf_cache[0],
+                                 quads, nr);
+
+   for (q = 0; q < nr; q++) {
+      struct quad_header *quad = quads[q];
+      const int itx = (quad->input.x0 & (TILE_SIZE-1));
+      const int ity = (quad->input.y0 & (TILE_SIZE-1));
+      __m128 pixel[4];
+
+      load_quad_colors_sse(quad->output.color[0], pixel);
+
+      for (j = 0; j < TGSI_QUAD_SIZE; j++) {
+         __m128 src = pixel[j];
+         __m128 dst =
+            _mm_loadu_ps(tile->data.color[ity + (j >> 1)][itx + (j & 1)]);
+         __m128 alpha;
+
+         if (clamp_src)
+            src = clamp_sse(src);
+
+         alpha = _mm_shuffle_ps(src, src, _MM_SHUFFLE(3, 3, 3, 3));
+         src = _mm_mul_ps(src, alpha);
+         dst = _mm_mul_ps(dst, _mm_sub_ps(one, alpha));
+         pixel[j] = _mm_add_ps(src, dst);
+
+         if (clamp_dst)
+            pixel[j] = clamp_sse(pixel[j]);
+      }
+
+      store_quad_colors_sse(tile, itx, ity, quad->inout.mask, pixel);
+   }
+}
+
+
+static void
+single_output_color_sse(struct quad_stage *qs, 
+                        struct quad_header *quads[],
+                        unsigned nr)
+{
+   const boolean clamp = qs->softpipe->rasterizer->clamp_fragment_color;
+   uint j, q;
+
+   struct softpipe_cached_tile *tile
+      = sp_get_cached_tile_quads(qs->softpipe->cbuf_cache[0],
+                                 quads, nr);
+
+   for (q = 0; q < nr; q++) {
+      struct quad_header *quad = quads[q];
+      const int itx = (quad->input.x0 & (TILE_SIZE-1));
+      const int ity = (quad->input.y0 & (TILE_SIZE-1));
+      __m128 pixel[4];
+
+      load_quad_colors_sse(quad->output.color[0], pixel);
+
+      if (clamp) {
+         for (j = 0; j < TGSI_QUAD_SIZE; j++)
+            pixel[j] = clamp_sse(pixel[j]);
+      }
+
+      store_quad_colors_sse(tile, itx, ity, quad->inout.mask, pixel);
+   }
+}
+
+#endif /* PIPE_ARCH_SSE */
+
+
 static void
 blend_noop(struct quad_stage *qs, 
            struct quad_header *quads[],
@@ -1274,6 +1406,16 @@ choose_blend_quad(struct quad_stage *qs,
          bqs->base_format[i] = RGBA;
    }
 
+#if defined(PIPE_ARCH_SSE)
+   /* use the vectorized variants where no rebasing is needed */
+   if (softpipe->framebuffer.nr_cbufs == 1 && bqs->base_format[0] == RGBA) {
+      if (qs->run == single_output_color)
+         qs->run = single_output_color_sse;
+      else if (qs->run == blend_single_add_src_alpha_inv_src_alpha)
+         qs->run = blend_single_add_src_alpha_inv_src_alpha_sse;
+   }
+#endif
+
    qs->run(qs, quads, nr);
 }
 
@@ -34,11 +34,13 @@
 #include "util/u_format.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
+#include "util/u_sse.h"
 #include "tgsi/tgsi_scan.h"
 #include "sp_context.h"
 #include "sp_quad.h"
 #include "sp_quad_pipe.h"
 #include "sp_tile_cache.h"
+#include "sp_tile_bin.h"
 #include "sp_state.h"           /* for sp_fragment_shader */
 
 
@@ -785,9 +787,8 @@ depth_test_quads_fallback(struct quad_stage *qs,
 
       data.ps = qs->softpipe->framebuffer.zsbuf;
       data.format = data.ps->format;
-      data.tile = sp_get_cached_tile(qs->softpipe->zsbuf_cache, 
-                                     quads[0]->input.x0, 
-                                     quads[0]->input.y0);
+      data.tile = sp_get_cached_tile_quads(qs->softpipe->zsbuf_cache,
+                                           quads, nr);
 
       for (i = 0; i < nr; i++) {
          get_depth_stencil_values(&data, quads[i]);
@@ -805,6 +806,10 @@ depth_test_quads_fallback(struct quad_stage *qs,
             
             depth_stencil_test_quad(qs, &data, quads[i]);
             write_depth_stencil_values(&data, quads[i]);
+
+            /* the stencil ops are applied, nothing left to shade */
+            if (!quads[i]->inout.mask)
+               continue;
          }
          else {
             if (!depth_test_quad(qs, &data, quads[i]))
@@ -821,8 +826,12 @@ depth_test_quads_fallback(struct quad_stage *qs,
    }
 
    if (qs->softpipe->active_query_count) {
+      /* rasterizer threads count privately, summed up after each draw */
+      uint64_t *count = qs->thread ? &qs->thread->occlusion_count :
+                                     &qs->softpipe->occlusion_count;
+
       for (i = 0; i < nr; i++) 
-         qs->softpipe->occlusion_count += mask_count[quads[i]->inout.mask];
+         *count += mask_count[quads[i]->inout.mask];
    }
 
    if (nr)
@@ -864,6 +873,156 @@ depth_test_quads_fallback(struct quad_stage *qs,
 
 
 
+#if defined(PIPE_ARCH_SSE)
+
+/**
+ * Special-case Z testing for 24-bit Z buffers and Z buffer writes enabled,
+ * with LESS or LEQUAL.  Like depth_test_quads_fallback() but four pixels
+ * at a time.  The depth values are computed with the same float
+ * operations and conversions, and the same values written back, so the
+ * results are identical.
+ */
+static INLINE void
+depth_interp_z24_write_sse(struct quad_stage *qs, 
+                           struct quad_header *quads[],
+                           unsigned nr,
+                           boolean lequal,
+                           boolean stencil8)
+{
+   const __m128 scale = _mm_set1_ps((float) ((1 << 24) - 1));
+   const __m128 min = _mm_set1_ps(-1.0f);
+   const __m128 max = _mm_set1_ps(2147483648.0f);
+   const __m128i zmask = _mm_set1_epi32(0xffffff);
+   const __m128i smask = _mm_set1_epi32(0xff000000);
+   const __m128i sign = _mm_set1_epi32(0x80000000);
+   const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+   struct softpipe_cached_tile *tile;
+   unsigned i, pass = 0;
+
+   tile = sp_get_cached_tile_quads(qs->softpipe->zsbuf_cache, quads, nr);
+
+   for (i = 0; i < nr; i++) {
+      struct quad_header *quad = quads[i];
+      const float fx = (float) quad->input.x0;
+      const float fy = (float) quad->input.y0;
+      const float dzdx = quad->posCoef->dadx[2];
+      const float dzdy = quad->posCoef->dady[2];
+      const float z0 = quad->posCoef->a0[2] + dzdx * fx + dzdy * fy;
+      const int x = quad->input.x0 % TILE_SIZE;
+      const int y = quad->input.y0 % TILE_SIZE;
+      uint *row0 = &tile->data.depth32[y][x];
+      uint *row1 = &tile->data.depth32[y + 1][x];
+      __m128 z;
+      __m128i qz, old, bz, gt, sel, res;
+      unsigned mask;
+
+      /* same as interpolate_quad_depth(), then scaled */
+      z = _mm_add_ps(_mm_add_ps(_mm_set1_ps(z0),
+                                _mm_setr_ps(0.0f, dzdx, dzdy, dzdx)),
+                     _mm_setr_ps(0.0f, 0.0f, 0.0f, dzdy));
+      z = _mm_mul_ps(z, scale);
+
+      if (_mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(z, min),
+                                     _mm_cmplt_ps(z, max))) == 0xf) {
+         qz = _mm_cvttps_epi32(z);
+      }
+      else {
+         /* beyond cvttps2dq's range, convert like convert_quad_depth() */
+         union m128i u;
+         float zf[4];
+
+         _mm_storeu_ps(zf, z);
+         u.ui[0] = (unsigned) zf[0];
+         u.ui[1] = (unsigned) zf[1];
+         u.ui[2] = (unsigned) zf[2];
+         u.ui[3] = (unsigned) zf[3];
+         qz = u.m;
+      }
+
+      old = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) row0),
+                               _mm_loadl_epi64((const __m128i *) row1));
+      bz = _mm_and_si128(old, zmask);
+
+      /* unsigned compares */
+      if (lequal) {
+         gt = _mm_cmpgt_epi32(_mm_xor_si128(qz, sign),
+                              _mm_xor_si128(bz, sign));
+         mask = ~_mm_movemask_ps(_mm_castsi128_ps(gt));
+      }
+      else {
+         gt = _mm_cmpgt_epi32(_mm_xor_si128(bz, sign),
+                              _mm_xor_si128(qz, sign));
+         mask = _mm_movemask_ps(_mm_castsi128_ps(gt));
+      }
+
+      mask &= quad->inout.mask;
+      if (!mask)
+         continue;
+
+      quad->inout.mask = mask;
+
+      /* Write the whole quad back as write_depth_stencil_values() does,
+       * which clears the X8 bits of Z24X8 pixels failing the test too.
+       */
+      sel = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(mask), bits), bits);
+      if (stencil8)
+         res = _mm_or_si128(_mm_and_si128(sel,
+                                          _mm_or_si128(_mm_and_si128(old, smask),
+                                                       qz)),
+                            _mm_andnot_si128(sel, old));
+      else
+         res = _mm_or_si128(_mm_and_si128(sel, qz),
+                            _mm_andnot_si128(sel, bz));
+
+      _mm_storel_epi64((__m128i *) row0, res);
+      _mm_storel_epi64((__m128i *) row1, _mm_unpackhi_epi64(res, res));
+
+      quads[pass++] = quad;
+   }
+
+   if (pass)
+      qs->next->run(qs->next, quads, pass);
+}
+
+
+static void
+depth_interp_z24x8_less_write(struct quad_stage *qs, 
+                              struct quad_header *quads[],
+                              unsigned nr)
+{
+   depth_interp_z24_write_sse(qs, quads, nr, FALSE, FALSE);
+}
+
+
+static void
+depth_interp_z24x8_lequal_write(struct quad_stage *qs, 
+                                struct quad_header *quads[],
+                                unsigned nr)
+{
+   depth_interp_z24_write_sse(qs, quads, nr, TRUE, FALSE);
+}
+
+
+static void
+depth_interp_z24s8_less_write(struct quad_stage *qs, 
+                              struct quad_header *quads[],
+                              unsigned nr)
+{
+   depth_interp_z24_write_sse(qs, quads, nr, FALSE, TRUE);
+}
+
+
+static void
+depth_interp_z24s8_lequal_write(struct quad_stage *qs, 
+                                struct quad_header *quads[],
+                                unsigned nr)
+{
+   depth_interp_z24_write_sse(qs, quads, nr, TRUE, TRUE);
+}
+
+#endif /* PIPE_ARCH_SSE */
+
+
 static void
 depth_noop(struct quad_stage *qs, 
            struct quad_header *quads[],
@@ -946,6 +1105,20 @@ choose_depth_test(struct quad_stage *qs,
             break;
          }
       }
+#if defined(PIPE_ARCH_SSE)
+      else if (qs->softpipe->framebuffer.zsbuf->format == PIPE_FORMAT_Z24X8_UNORM) {
+         if (depthfunc == PIPE_FUNC_LESS)
+            qs->run = depth_interp_z24x8_less_write;
+         else if (depthfunc == PIPE_FUNC_LEQUAL)
+            qs->run = depth_interp_z24x8_lequal_write;
+      }
+      else if (qs->softpipe->framebuffer.zsbuf->format == PIPE_FORMAT_Z24_UNORM_S8_UINT) {
+         if (depthfunc == PIPE_FUNC_LESS)
+            qs->run = depth_interp_z24s8_less_write;
+         else if (depthfunc == PIPE_FUNC_LEQUAL)
+            qs->run = depth_interp_z24s8_lequal_write;
+      }
+#endif
    }
 
    /* next quad/fragment stage */
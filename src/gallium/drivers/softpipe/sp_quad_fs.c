@@ -45,6 +45,7 @@
 #include "sp_state.h"
 #include "sp_quad.h"
 #include "sp_quad_pipe.h"
+#include "sp_tile_bin.h"
 
 
 struct quad_shade_stage
@@ -63,6 +64,17 @@ quad_shade_stage(struct quad_stage *qs)
 }
 
 
+/**
+ * Return the shader machine to use: the context's or, when running in
+ * a rasterizer thread, the thread's own.
+ */
+static INLINE struct tgsi_exec_machine *
+get_machine(struct quad_stage *qs)
+{
+   return qs->thread ? qs->thread->machine : qs->softpipe->fs_machine;
+}
+
+
 /**
  * Execute fragment shader for the four fragments in the quad.
  * \return TRUE if quad is alive, FALSE if all four pixels are killed
@@ -71,7 +83,7 @@ static INLINE boolean
 shade_quad(struct quad_stage *qs, struct quad_header *quad)
 {
    struct softpipe_context *softpipe = qs->softpipe;
-   struct tgsi_exec_machine *machine = softpipe->fs_machine;
+   struct tgsi_exec_machine *machine = get_machine(qs);
 
    /* run shader */
    machine->flatshade_color = softpipe->rasterizer->flatshade ? TRUE : FALSE;
@@ -109,7 +121,7 @@ shade_quads(struct quad_stage *qs,
             unsigned nr)
 {
    struct softpipe_context *softpipe = qs->softpipe;
-   struct tgsi_exec_machine *machine = softpipe->fs_machine;
+   struct tgsi_exec_machine *machine = get_machine(qs);
    unsigned i, nr_quads = 0;
 
    tgsi_exec_set_constant_buffers(machine, PIPE_MAX_CONSTANT_BUFFERS,
@@ -149,11 +161,13 @@ static void
 shade_begin(struct quad_stage *qs)
 {
    struct softpipe_context *softpipe = qs->softpipe;
+   struct tgsi_sampler **samplers = qs->thread ?
+      qs->thread->sampler_list :
+      (struct tgsi_sampler **) softpipe->tgsi.frag_samplers_list;
 
    softpipe->fs_variant->prepare( softpipe->fs_variant, 
-                                  softpipe->fs_machine,
-                                  (struct tgsi_sampler **)
-                                  softpipe->tgsi.frag_samplers_list );
+                                  get_machine(qs),
+                                  samplers );
 
    qs->next->begin(qs->next);
 }
@@ -31,39 +31,50 @@
 #include "pipe/p_shader_tokens.h"
 
 
-static void
-insert_stage_at_head(struct softpipe_context *sp, struct quad_stage *quad)
-{
-   quad->next = sp->quad.first;
-   sp->quad.first = quad;
-}
-
-
-void
-sp_build_quad_pipeline(struct softpipe_context *sp)
+/**
+ * Chain the given shade, depth test and blend stages in the order
+ * required by the current state and return the first one.
+ */
+struct quad_stage *
+sp_link_quad_pipeline(struct softpipe_context *sp,
+                      struct quad_stage *shade,
+                      struct quad_stage *depth_test,
+                      struct quad_stage *blend)
 {
    boolean early_depth_test =
-      sp->depth_stencil->depth.enabled &&
+      (sp->depth_stencil->depth.enabled ||
+       sp->depth_stencil->stencil[0].enabled) &&
       sp->framebuffer.zsbuf &&
       !sp->depth_stencil->alpha.enabled &&
       !sp->fs_variant->info.uses_kill &&
       !sp->fs_variant->info.writes_z &&
       !sp->fs_variant->info.writes_stencil;
 
-   sp->quad.first = sp->quad.blend;
-
    if (early_depth_test) {
-      insert_stage_at_head( sp, sp->quad.shade );
-      insert_stage_at_head( sp, sp->quad.depth_test );
+      depth_test->next = shade;
+      shade->next = blend;
+      return depth_test;
    }
    else {
-      insert_stage_at_head( sp, sp->quad.depth_test );
-      insert_stage_at_head( sp, sp->quad.shade );
+      shade->next = depth_test;
+      depth_test->next = blend;
+      return shade;
    }
+}
+
+
+void
+sp_build_quad_pipeline(struct softpipe_context *sp)
+{
+   sp->quad.first = sp_link_quad_pipeline(sp,
+                                          sp->quad.shade,
+                                          sp->quad.depth_test,
+                                          sp->quad.blend);
 
 #if !DO_PSTIPPLE_IN_DRAW_MODULE && !DO_PSTIPPLE_IN_HELPER_MODULE
-   if (sp->rasterizer->poly_stipple_enable)
-      insert_stage_at_head( sp, sp->quad.pstipple );
+   if (sp->rasterizer->poly_stipple_enable) {
+      sp->quad.pstipple->next = sp->quad.first;
+      sp->quad.first = sp->quad.pstipple;
+   }
 #endif
 }
-
@@ -34,6 +34,7 @@
 
 struct softpipe_context;
 struct quad_header;
+struct sp_tile_thread;
 
 
 /**
@@ -44,6 +45,9 @@ struct quad_header;
 struct quad_stage {
    struct softpipe_context *softpipe;
 
+   /** The rasterizer thread owning this stage, NULL for the context's own */
+   struct sp_tile_thread *thread;
+
    struct quad_stage *next;
 
    void (*begin)(struct quad_stage *qs);
@@ -67,6 +71,11 @@ struct quad_stage *sp_quad_blend_stage( struct softpipe_context *softpipe );
 struct quad_stage *sp_quad_colormask_stage( struct softpipe_context *softpipe );
 struct quad_stage *sp_quad_output_stage( struct softpipe_context *softpipe );
 
+struct quad_stage *sp_link_quad_pipeline(struct softpipe_context *sp,
+                                         struct quad_stage *shade,
+                                         struct quad_stage *depth_test,
+                                         struct quad_stage *blend);
+
 void sp_build_quad_pipeline(struct softpipe_context *sp);
 
 #endif /* SP_QUAD_PIPE_H */
@@ -140,6 +140,8 @@ softpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
       return 0;
    case PIPE_CAP_USER_VERTEX_BUFFERS:
       return 1;
+   case PIPE_CAP_CPU_MIPMAP_GENERATION:
+      return 1;
    default:
       return 0;
    }
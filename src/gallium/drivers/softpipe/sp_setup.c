@@ -37,6 +37,7 @@
 #include "sp_quad_pipe.h"
 #include "sp_setup.h"
 #include "sp_state.h"
+#include "sp_tile_bin.h"
 #include "draw/draw_context.h"
 #include "draw/draw_vertex.h"
 #include "pipe/p_shader_tokens.h"
@@ -99,6 +100,7 @@ struct setup_context {
 
    struct tgsi_interp_coef coef[PIPE_MAX_SHADER_INPUTS];
    struct tgsi_interp_coef posCoef;  /* For Z, W */
+   unsigned bin_coef;   /**< binned copy of coef[] for threads, or ~0 */
 
    struct {
       int left[2];   /**< [0] = row0, [1] = row1 */
@@ -152,6 +154,34 @@ quad_clip(struct setup_context *setup, struct quad_header *quad)
 }
 
 
+/**
+ * Pass a batch of quads in the same tile to the quad pipeline, or to the
+ * rasterizer threads' bins if we have any.
+ */
+static INLINE void
+emit_quads(struct setup_context *setup, struct quad_header *quads[],
+           unsigned nr)
+{
+   struct softpipe_context *sp = setup->softpipe;
+
+   if (sp->tile_bins) {
+      if (setup->bin_coef == ~0u) {
+         setup->bin_coef =
+            sp_tile_bin_coefs(sp->tile_bins, &setup->posCoef, setup->coef,
+                              sp->fs_variant->info.num_inputs);
+      }
+
+      if (sp_tile_bin_quads(sp->tile_bins, &setup->bin_coef, quads, nr))
+         return;
+
+      /* out of memory, the bins got flushed so just run the quads here */
+      setup->bin_coef = ~0u;
+   }
+
+   sp->quad.first->run( sp->quad.first, quads, nr );
+}
+
+
 /**
  * Emit a quad (pass to next stage) with clipping.
  */
@@ -161,9 +191,7 @@ clip_emit_quad(struct setup_context *setup, struct quad_header *quad)
    quad_clip( setup, quad );
 
    if (quad->inout.mask) {
-      struct softpipe_context *sp = setup->softpipe;
-
-      sp->quad.first->run( sp->quad.first, &quad, 1 );
+      emit_quads( setup, &quad, 1 );
    }
 }
 
@@ -198,7 +226,6 @@ flush_spans(struct setup_context *setup)
    const int xleft1 = setup->span.left[1];
    const int xright0 = setup->span.right[0];
    const int xright1 = setup->span.right[1];
-   struct quad_stage *pipe = setup->softpipe->quad.first;
 
    const int minleft = block_x(MIN2(xleft0, xleft1));
    const int maxright = MAX2(xright0, xright1);
@@ -240,7 +267,7 @@ flush_spans(struct setup_context *setup)
             lx += 2;
          } while (mask0 | mask1);
 
-         pipe->run( pipe, setup->quad_ptrs, q );
+         emit_quads( setup, setup->quad_ptrs, q );
       }
    }
 
@@ -617,6 +644,9 @@ setup_tri_coefficients(struct setup_context *setup)
    v[2] = setup->vmax[0][3];
    tri_linear_coeff(setup, &setup->posCoef, 3, v);
 
+   /* new coefficients, need a new binned copy */
+   setup->bin_coef = ~0u;
+
    /* setup interpolation for all the remaining attributes:
     */
    for (fragSlot = 0; fragSlot < fsInfo->num_inputs; fragSlot++) {
@@ -973,6 +1003,9 @@ setup_line_coefficients(struct setup_context *setup,
    v[1] = setup->vmax[0][3];
    line_linear_coeff(setup, &setup->posCoef, 3, v);
 
+   /* new coefficients, need a new binned copy */
+   setup->bin_coef = ~0u;
+
    /* setup interpolation for all the remaining attributes:
     */
    for (fragSlot = 0; fragSlot < fsInfo->num_inputs; fragSlot++) {
@@ -1233,6 +1266,9 @@ sp_setup_point(struct setup_context *setup,
    const_coeff(setup, &setup->posCoef, 0, 2);
    const_coeff(setup, &setup->posCoef, 0, 3);
 
+   /* new coefficients, need a new binned copy */
+   setup->bin_coef = ~0u;
+
    for (fragSlot = 0; fragSlot < fsInfo->num_inputs; fragSlot++) {
       const uint vertSlot = vinfo->attrib[fragSlot].src_index;
       uint j;
@@ -1435,6 +1471,7 @@ sp_setup_create_context(struct softpipe_context *softpipe)
    unsigned i;
 
    setup->softpipe = softpipe;
+   setup->bin_coef = ~0u;
 
    for (i = 0; i < MAX_QUADS; i++) {
       setup->quad[i].coef = setup->coef;
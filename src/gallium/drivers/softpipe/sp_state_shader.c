@@ -29,6 +29,7 @@
 #include "sp_state.h"
 #include "sp_fs.h"
 #include "sp_texture.h"
+#include "sp_tile_bin.h"
 
 #include "pipe/p_defines.h"
 #include "util/u_memory.h"
@@ -193,6 +194,9 @@ softpipe_delete_fs_state(struct pipe_context *pipe, void *fs)
 
       assert(var != softpipe->fs_variant);
 
+      if (softpipe->tile_bins)
+         sp_tile_bins_unbind_shader(softpipe->tile_bins, var->tokens);
+
       /* See comments elsewhere about draw fragment shaders */
 #if 0
       draw_delete_fragment_shader(softpipe->draw, var->draw_shader);
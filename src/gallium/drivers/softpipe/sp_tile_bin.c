@@ -0,0 +1,462 @@
+/**************************************************************************
+ *
+ * Copyright 2012 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Binning of quads to tiles and the rasterizer threads that process them.
+ * See sp_tile_bin.h for an overview.
+ */
+
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "tgsi/tgsi_exec.h"
+#include "sp_context.h"
+#include "sp_quad_pipe.h"
+#include "sp_state.h"
+#include "sp_texture.h"
+#include "sp_tex_tile_cache.h"
+#include "sp_tile_cache.h"
+#include "sp_tile_bin.h"
+
+
+/**
+ * Upper bound on the number of quads held in the bins before we kick
+ * the threads, to limit memory use for very large draws.
+ */
+#define MAX_BINNED_QUADS (64 * 1024)
+
+
+/**
+ * Grow a bin array so it can hold at least 'needed' elements.
+ */
+static boolean
+grow_array(void **array, unsigned *max, unsigned needed, unsigned size)
+{
+   unsigned new_max;
+   void *new_array;
+
+   if (needed <= *max)
+      return TRUE;
+
+   new_max = MAX2(needed, MAX2(*max * 2, 64));
+   new_array = REALLOC(*array, *max * size, new_max * size);
+   if (!new_array)
+      return FALSE;
+
+   *array = new_array;
+   *max = new_max;
+   return TRUE;
+}
+
+
+/**
+ * Run the quads binned for a thread through the given quad pipeline.
+ */
+static void
+run_bins(struct sp_tile_thread *thr, struct quad_stage *first)
+{
+   const struct tgsi_interp_coef *coefs = thr->bins->coefs;
+   unsigned i, j;
+
+   for (i = 0; i < thr->num_cmds; i++) {
+      const struct sp_bin_cmd *cmd = &thr->cmds[i];
+      const struct sp_bin_quad *bq = &thr->quads[cmd->first];
+
+      for (j = 0; j < cmd->count; j++) {
+         struct quad_header *quad = &thr->quad[j];
+
+         quad->input = bq[j].input;
+         quad->inout.mask = bq[j].mask;
+         quad->posCoef = &coefs[cmd->coef];
+         quad->coef = &coefs[cmd->coef + 1];
+         thr->quad_ptrs[j] = quad;
+      }
+
+      first->run(first, thr->quad_ptrs, cmd->count);
+   }
+}
+
+
+static PIPE_THREAD_ROUTINE( thread_function, init_data )
+{
+   struct sp_tile_thread *thr = (struct sp_tile_thread *) init_data;
+   struct sp_tile_bins *bins = thr->bins;
+
+   while (1) {
+      pipe_semaphore_wait(&thr->work_ready);
+
+      if (bins->exit)
+         break;
+
+      run_bins(thr, thr->first);
+
+      pipe_semaphore_signal(&thr->work_done);
+   }
+
+   return NULL;
+}
+
+
+/**
+ * Bring a thread's private samplers, texture caches and quad pipeline
+ * up to date with the context's current state.  Called with all threads
+ * idle.
+ * \return FALSE if we ran out of memory
+ */
+static boolean
+prepare_thread(struct sp_tile_thread *thr)
+{
+   struct softpipe_context *sp = thr->bins->softpipe;
+   int i;
+
+   for (i = 0; i <= sp->fs_variant->info.file_max[TGSI_FILE_SAMPLER]; i++) {
+      struct softpipe_tex_tile_cache *tc;
+
+      if (!sp->fragment_samplers[i])
+         continue;
+
+      if (!thr->tex_cache[i]) {
+         thr->tex_cache[i] = sp_create_tex_tile_cache(&sp->pipe);
+         if (!thr->tex_cache[i])
+            return FALSE;
+      }
+
+      tc = thr->tex_cache[i];
+      sp_tex_tile_cache_set_sampler_view(tc, sp->fragment_sampler_views[i]);
+      if (tc->texture) {
+         struct softpipe_resource *spt = softpipe_resource(tc->texture);
+         if (spt->timestamp != tc->timestamp) {
+            sp_tex_tile_cache_validate_texture(tc);
+            tc->timestamp = spt->timestamp;
+         }
+      }
+
+      /* the variant's wrap/filter functions are shared, only the texture
+       * cache and the per-lookup scratch fields need to be private
+       */
+      thr->samplers[i] = *sp->tgsi.frag_samplers_list[i];
+      thr->samplers[i].cache = tc;
+      thr->samplers[i].next = NULL;
+   }
+
+   thr->first = sp_link_quad_pipeline(sp, thr->shade, thr->depth_test,
+                                      thr->blend);
+   thr->first->begin(thr->first);
+
+   thr->occlusion_count = 0;
+
+   return TRUE;
+}
+
+
+static void
+reset_bins(struct sp_tile_bins *bins)
+{
+   unsigned i;
+
+   for (i = 0; i < bins->num_threads; i++) {
+      bins->thread[i].num_cmds = 0;
+      bins->thread[i].num_quads = 0;
+   }
+
+   bins->num_coefs = 0;
+   bins->num_quads = 0;
+}
+
+
+/**
+ * Process all binned quads and wait for the threads to finish.
+ */
+void
+sp_tile_bins_flush(struct sp_tile_bins *bins)
+{
+   struct softpipe_context *sp = bins->softpipe;
+   boolean threaded = TRUE;
+   unsigned i;
+
+   if (!bins->num_quads) {
+      bins->num_coefs = 0;
+      return;
+   }
+
+   for (i = 0; i < bins->num_threads; i++) {
+      if (!prepare_thread(&bins->thread[i])) {
+         threaded = FALSE;
+         break;
+      }
+   }
+
+   if (threaded) {
+      for (i = 0; i < bins->num_threads; i++)
+         pipe_semaphore_signal(&bins->thread[i].work_ready);
+
+      for (i = 0; i < bins->num_threads; i++) {
+         pipe_semaphore_wait(&bins->thread[i].work_done);
+         sp->occlusion_count += bins->thread[i].occlusion_count;
+      }
+   }
+   else {
+      /* Out of memory: just do it all here with the context's pipeline.
+       * Tile cache partitions are picked by tile address, not by thread,
+       * so this works as long as the threads are idle.
+       */
+      for (i = 0; i < bins->num_threads; i++)
+         run_bins(&bins->thread[i], sp->quad.first);
+   }
+
+   reset_bins(bins);
+}
+
+
+/**
+ * Copy a primitive's interpolation coefficients to the bins.
+ * \return index to pass to sp_tile_bin_quads() or ~0 if out of memory
+ */
+unsigned
+sp_tile_bin_coefs(struct sp_tile_bins *bins,
+                  const struct tgsi_interp_coef *posCoef,
+                  const struct tgsi_interp_coef *coef,
+                  unsigned num_inputs)
+{
+   unsigned index;
+
+   if (bins->num_quads >= MAX_BINNED_QUADS)
+      sp_tile_bins_flush(bins);
+
+   if (!grow_array((void **) &bins->coefs, &bins->max_coefs,
+                   bins->num_coefs + 1 + num_inputs,
+                   sizeof bins->coefs[0])) {
+      sp_tile_bins_flush(bins);
+      return ~0u;
+   }
+
+   index = bins->num_coefs;
+   bins->coefs[index] = *posCoef;
+   memcpy(&bins->coefs[index + 1], coef, num_inputs * sizeof coef[0]);
+   bins->num_coefs += 1 + num_inputs;
+
+   return index;
+}
+
+
+/**
+ * Put a batch of quads, which must all lie in the same tile, into the bin
+ * of the thread owning that tile.
+ * \param coef  index returned by sp_tile_bin_coefs() for the primitive,
+ *              updated if the bins get flushed to stay under the limit
+ * \return FALSE if out of memory, in which case the bins have been
+ *         flushed and the caller should process the quads itself
+ */
+boolean
+sp_tile_bin_quads(struct sp_tile_bins *bins, unsigned *coef,
+                  struct quad_header *quads[], unsigned nr)
+{
+   union tile_address addr = tile_address(quads[0]->input.x0,
+                                          quads[0]->input.y0);
+   struct sp_tile_thread *thr =
+      &bins->thread[tile_partition(addr, bins->num_threads)];
+   struct sp_bin_cmd *cmd;
+   unsigned i;
+
+   assert(nr <= SP_BIN_MAX_QUADS);
+
+   if (*coef != ~0u && bins->num_quads + nr > MAX_BINNED_QUADS) {
+      /* A single large primitive: flush, but keep its coefficients, which
+       * are the last ones in the arena, for the rest of its quads.
+       */
+      const unsigned num_coefs = bins->num_coefs - *coef;
+
+      sp_tile_bins_flush(bins);
+
+      memmove(bins->coefs, &bins->coefs[*coef],
+              num_coefs * sizeof bins->coefs[0]);
+      bins->num_coefs = num_coefs;
+      *coef = 0;
+   }
+
+   if (*coef == ~0u ||
+       !grow_array((void **) &thr->cmds, &thr->max_cmds,
+                   thr->num_cmds + 1, sizeof thr->cmds[0]) ||
+       !grow_array((void **) &thr->quads, &thr->max_quads,
+                   thr->num_quads + nr, sizeof thr->quads[0])) {
+      sp_tile_bins_flush(bins);
+      return FALSE;
+   }
+
+   cmd = &thr->cmds[thr->num_cmds++];
+   cmd->coef = *coef;
+   cmd->first = thr->num_quads;
+   cmd->count = nr;
+
+   for (i = 0; i < nr; i++) {
+      struct sp_bin_quad *bq = &thr->quads[thr->num_quads++];
+
+      assert(tile_address(quads[i]->input.x0,
+                          quads[i]->input.y0).value == addr.value);
+
+      bq->input = quads[i]->input;
+      bq->mask = quads[i]->inout.mask;
+   }
+
+   bins->num_quads += nr;
+
+   return TRUE;
+}
+
+
+/**
+ * Unbind a fragment shader which is about to be deleted from the
+ * threads' shader machines.
+ */
+void
+sp_tile_bins_unbind_shader(struct sp_tile_bins *bins, const void *tokens)
+{
+   unsigned i;
+
+   for (i = 0; i < bins->num_threads; i++) {
+      struct tgsi_exec_machine *machine = bins->thread[i].machine;
+
+      if (machine->Tokens == tokens)
+         tgsi_exec_machine_bind_shader(machine, NULL, 0, NULL);
+   }
+}
+
+
+void
+sp_tile_bins_flush_tex_caches(struct sp_tile_bins *bins)
+{
+   unsigned i, j;
+
+   for (i = 0; i < bins->num_threads; i++) {
+      for (j = 0; j < PIPE_MAX_SAMPLERS; j++) {
+         if (bins->thread[i].tex_cache[j])
+            sp_flush_tex_tile_cache(bins->thread[i].tex_cache[j]);
+      }
+   }
+}
+
+
+static void
+destroy_thread_state(struct sp_tile_thread *thr)
+{
+   unsigned i;
+
+   if (thr->shade)
+      thr->shade->destroy(thr->shade);
+   if (thr->depth_test)
+      thr->depth_test->destroy(thr->depth_test);
+   if (thr->blend)
+      thr->blend->destroy(thr->blend);
+
+   if (thr->machine)
+      tgsi_exec_machine_destroy(thr->machine);
+
+   for (i = 0; i < PIPE_MAX_SAMPLERS; i++)
+      sp_destroy_tex_tile_cache(thr->tex_cache[i]);
+
+   FREE(thr->cmds);
+   FREE(thr->quads);
+}
+
+
+/**
+ * Create the bins and start num_threads rasterizer threads.
+ */
+struct sp_tile_bins *
+sp_create_tile_bins(struct softpipe_context *softpipe, unsigned num_threads)
+{
+   struct sp_tile_bins *bins;
+   unsigned i, j;
+
+   assert(num_threads > 0 && num_threads <= SP_MAX_THREADS);
+
+   bins = CALLOC_STRUCT(sp_tile_bins);
+   if (!bins)
+      return NULL;
+
+   bins->softpipe = softpipe;
+
+   for (i = 0; i < num_threads; i++) {
+      struct sp_tile_thread *thr = &bins->thread[i];
+
+      thr->bins = bins;
+      thr->id = i;
+
+      thr->machine = tgsi_exec_machine_create();
+      thr->shade = sp_quad_shade_stage(softpipe);
+      thr->depth_test = sp_quad_depth_test_stage(softpipe);
+      thr->blend = sp_quad_blend_stage(softpipe);
+      if (!thr->machine || !thr->shade || !thr->depth_test || !thr->blend) {
+         destroy_thread_state(thr);
+         goto fail;
+      }
+
+      thr->shade->thread = thr;
+      thr->depth_test->thread = thr;
+      thr->blend->thread = thr;
+
+      for (j = 0; j < PIPE_MAX_SAMPLERS; j++)
+         thr->sampler_list[j] = &thr->samplers[j].base;
+
+      pipe_semaphore_init(&thr->work_ready, 0);
+      pipe_semaphore_init(&thr->work_done, 0);
+      thr->handle = pipe_thread_create(thread_function, thr);
+
+      bins->num_threads++;
+   }
+
+   return bins;
+
+fail:
+   sp_destroy_tile_bins(bins);
+   return NULL;
+}
+
+
+void
+sp_destroy_tile_bins(struct sp_tile_bins *bins)
+{
+   unsigned i;
+
+   /* Set the exit flag and wake up each thread so it notices it and
+    * breaks out of its main loop.
+    */
+   bins->exit = TRUE;
+   for (i = 0; i < bins->num_threads; i++)
+      pipe_semaphore_signal(&bins->thread[i].work_ready);
+
+   for (i = 0; i < bins->num_threads; i++) {
+      struct sp_tile_thread *thr = &bins->thread[i];
+
+      pipe_thread_wait(thr->handle);
+      pipe_semaphore_destroy(&thr->work_ready);
+      pipe_semaphore_destroy(&thr->work_done);
+      destroy_thread_state(thr);
+   }
+
+   FREE(bins->coefs);
+   FREE(bins);
+}
@@ -0,0 +1,155 @@
+/**************************************************************************
+ *
+ * Copyright 2012 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Tile-parallel quad processing.
+ *
+ * When SOFTPIPE_NUM_THREADS is set, primitive setup still runs in the
+ * calling thread but instead of running the quad pipeline directly, the
+ * quads it generates are put into per-thread bins according to which
+ * framebuffer tile they hit.  At the end of each vbuf draw the bins are
+ * handed to the rasterizer threads, each of which shades, depth tests
+ * and blends the quads of its own tiles in submission order, and the
+ * caller waits for all of them to finish.  Since every tile belongs to
+ * exactly one thread, per-pixel ordering is preserved.
+ */
+
+#ifndef SP_TILE_BIN_H
+#define SP_TILE_BIN_H
+
+
+#include "os/os_thread.h"
+#include "sp_limits.h"
+#include "sp_quad.h"
+#include "sp_tex_sample.h"
+
+
+struct softpipe_context;
+struct softpipe_tex_tile_cache;
+struct quad_stage;
+struct sp_tile_bins;
+
+
+/** Max number of quads in one binned batch, same as setup's MAX_QUADS */
+#define SP_BIN_MAX_QUADS 16
+
+
+/** A binned quad: position, coverage, facing and mask */
+struct sp_bin_quad {
+   struct quad_header_input input;
+   unsigned mask;
+};
+
+
+/** A batch of quads from one primitive, all in the same tile */
+struct sp_bin_cmd {
+   unsigned coef;          /**< index of posCoef in the coef arena */
+   unsigned first;         /**< first quad in the thread's quad array */
+   unsigned count;
+};
+
+
+/**
+ * Per-thread state: the binned work and a private quad pipeline with
+ * its own shader machine, sampler variants and texture caches.
+ */
+struct sp_tile_thread {
+   struct sp_tile_bins *bins;
+   unsigned id;
+
+   pipe_thread handle;
+   pipe_semaphore work_ready;
+   pipe_semaphore work_done;
+
+   struct sp_bin_cmd *cmds;
+   unsigned num_cmds, max_cmds;
+   struct sp_bin_quad *quads;
+   unsigned num_quads, max_quads;
+
+   struct quad_stage *shade;
+   struct quad_stage *depth_test;
+   struct quad_stage *blend;
+   struct quad_stage *first;
+
+   struct tgsi_exec_machine *machine;
+   struct sp_sampler_variant samplers[PIPE_MAX_SAMPLERS];
+   struct tgsi_sampler *sampler_list[PIPE_MAX_SAMPLERS];
+   struct softpipe_tex_tile_cache *tex_cache[PIPE_MAX_SAMPLERS];
+
+   /** occlusion query samples counted by this thread, see the depth stage */
+   uint64_t occlusion_count;
+
+   /** quads handed to the pipeline */
+   struct quad_header quad[SP_BIN_MAX_QUADS];
+   struct quad_header *quad_ptrs[SP_BIN_MAX_QUADS];
+};
+
+
+struct sp_tile_bins {
+   struct softpipe_context *softpipe;
+
+   unsigned num_threads;
+   struct sp_tile_thread thread[SP_MAX_THREADS];
+
+   /** Interpolation coefficients of binned primitives, posCoef first */
+   struct tgsi_interp_coef *coefs;
+   unsigned num_coefs, max_coefs;
+
+   /** total number of binned quads, to bound memory use */
+   unsigned num_quads;
+
+   boolean exit;
+};
+
+
+struct sp_tile_bins *
+sp_create_tile_bins(struct softpipe_context *softpipe, unsigned num_threads);
+
+void
+sp_destroy_tile_bins(struct sp_tile_bins *bins);
+
+unsigned
+sp_tile_bin_coefs(struct sp_tile_bins *bins,
+                  const struct tgsi_interp_coef *posCoef,
+                  const struct tgsi_interp_coef *coef,
+                  unsigned num_inputs);
+
+boolean
+sp_tile_bin_quads(struct sp_tile_bins *bins, unsigned *coef,
+                  struct quad_header *quads[], unsigned nr);
+
+void
+sp_tile_bins_flush(struct sp_tile_bins *bins);
+
+void
+sp_tile_bins_unbind_shader(struct sp_tile_bins *bins, const void *tokens);
+
+void
+sp_tile_bins_flush_tex_caches(struct sp_tile_bins *bins);
+
+
+#endif /* SP_TILE_BIN_H */
@@ -33,37 +33,31 @@
  */
 
 #include "util/u_inlines.h"
+#include "util/u_debug.h"
 #include "util/u_format.h"
+#include "util/u_math.h"
 #include "util/u_memory.h"
-#include "util/u_tile.h"
+#include "util/u_rect.h"
 #include "sp_tile_cache.h"
 
-static struct softpipe_cached_tile *
-sp_alloc_tile(struct softpipe_tile_cache *tc);
 
+DEBUG_GET_ONCE_BOOL_OPTION(tile_cache_stats, "SOFTPIPE_TILE_CACHE_STATS", FALSE)
 
-/**
- * Return the position in the cache for the tile that contains win pos (x,y).
- * We currently use a direct mapped cache so this is like a hack key.
- * At some point we should investige something more sophisticated, like
- * a LRU replacement policy.
- */
-#define CACHE_POS(x, y) \
-   (((x) + (y) * 5) % NUM_ENTRIES)
 
+static struct softpipe_cached_tile *
+sp_alloc_tile(struct softpipe_tile_cache *tc, unsigned part);
 
 
 /**
  * Is the tile at (x,y) in cleared state?
  */
 static INLINE uint
-is_clear_flag_set(const uint *bitvec, union tile_address addr)
+is_clear_flag_set(const ubyte *flags, union tile_address addr)
 {
-   int pos, bit;
+   int pos;
    pos = addr.bits.y * (MAX_WIDTH / TILE_SIZE) + addr.bits.x;
-   assert(pos / 32 < (MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32);
-   bit = bitvec[pos / 32] & (1 << (pos & 31));
-   return bit;
+   assert(pos < (MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE));
+   return flags[pos];
 }
    
 
@@ -71,17 +65,111 @@ is_clear_flag_set(const uint *bitvec, union tile_address addr)
  * Mark the tile at (x,y) as not cleared.
  */
 static INLINE void
-clear_clear_flag(uint *bitvec, union tile_address addr)
+clear_clear_flag(ubyte *flags, union tile_address addr)
 {
    int pos;
    pos = addr.bits.y * (MAX_WIDTH / TILE_SIZE) + addr.bits.x;
-   assert(pos / 32 < (MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32);
-   bitvec[pos / 32] &= ~(1 << (pos & 31));
+   assert(pos < (MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE));
+   flags[pos] = 0;
 }
-   
 
+
+/**
+ * Return the first entry of the cache set holding the given tile.  A
+ * partition has sets_per_part / slots_per_part sets for each of its slots,
+ * and the tiles of a slot take turns among them.
+ */
+static INLINE unsigned
+tile_set_start(const struct softpipe_tile_cache *tc,
+               union tile_address addr, unsigned part)
+{
+   const unsigned pos = addr.bits.x + addr.bits.y * 5;
+   const unsigned slot = (pos % NUM_SLOTS) / tc->num_parts;
+   const unsigned turn = pos / NUM_SLOTS;
+   const unsigned set = part * tc->sets_per_part +
+      (slot + turn * tc->slots_per_part) % tc->sets_per_part;
+
+   return set * tc->ways;
+}
+
+
+/**
+ * Return the transfer's mapping, mapping it if needed.  While drawing the
+ * transfers are already mapped (see softpipe_map_transfers()), so only
+ * flushes and clears outside of draws get here with the transfer
+ * unmapped, but let only one thread at a time map it anyway.
+ */
+static ubyte *
+get_transfer_map(struct softpipe_tile_cache *tc)
+{
+   if (!tc->transfer_map) {
+      pipe_mutex_lock(tc->transfer_mutex);
+      sp_tile_cache_map_transfers(tc);
+      pipe_mutex_unlock(tc->transfer_mutex);
+   }
+   return tc->transfer_map;
+}
+
+
+/**
+ * Allocate the entry arrays for the given number of sets per partition.
+ * Returns FALSE if out of memory, leaving the current arrays alone.
+ */
+static boolean
+alloc_entries(struct softpipe_tile_cache *tc, unsigned sets_per_part)
+{
+   const unsigned num_entries =
+      tc->num_parts * sets_per_part * tc->ways;
+   union tile_address *tile_addrs;
+   struct softpipe_cached_tile **entries;
+   unsigned *last_used;
+   unsigned pos;
+
+   if (num_entries == tc->num_entries) {
+      tc->sets_per_part = sets_per_part;
+      return TRUE;
+   }
+
+   tile_addrs = MALLOC(num_entries * sizeof *tile_addrs);
+   entries = CALLOC(num_entries, sizeof *entries);
+   last_used = CALLOC(num_entries, sizeof *last_used);
+   if (!tile_addrs || !entries || !last_used) {
+      FREE(tile_addrs);
+      FREE(entries);
+      FREE(last_used);
+      return FALSE;
+   }
+
+   for (pos = 0; pos < num_entries; pos++) {
+      tile_addrs[pos].value = 0;
+      tile_addrs[pos].bits.invalid = 1;
+   }
+
+   for (pos = 0; pos < tc->num_entries; pos++) {
+      assert(tc->tile_addrs[pos].bits.invalid);
+      FREE(tc->entries[pos]);
+   }
+   FREE(tc->tile_addrs);
+   FREE(tc->entries);
+   FREE(tc->last_used);
+
+   tc->tile_addrs = tile_addrs;
+   tc->entries = entries;
+   tc->last_used = last_used;
+   tc->num_entries = num_entries;
+   tc->sets_per_part = sets_per_part;
+
+   return TRUE;
+}
+
+
+/**
+ * Create a tile cache.
+ * \param num_parts  number of rasterizer threads that will access the
+ *                   cache concurrently, or 0 or 1 if not threaded
+ */
 struct softpipe_tile_cache *
-sp_create_tile_cache( struct pipe_context *pipe )
+sp_create_tile_cache( struct pipe_context *pipe, unsigned num_parts )
 {
    struct softpipe_tile_cache *tc;
    uint pos;
@@ -96,20 +184,36 @@ sp_create_tile_cache( struct pipe_context *pipe )
 
    assert((TILE_SIZE << TILE_ADDR_BITS) >= MAX_WIDTH);
 
+   assert(TILE_BLOCKS <= 16);
+
    tc = CALLOC_STRUCT( softpipe_tile_cache );
    if (tc) {
       tc->pipe = pipe;
-      for (pos = 0; pos < NUM_ENTRIES; pos++) {
-         tc->tile_addrs[pos].bits.invalid = 1;
+      tc->num_parts = CLAMP(num_parts, 1, SP_MAX_THREADS);
+      tc->slots_per_part = (NUM_SLOTS + tc->num_parts - 1) / tc->num_parts;
+      tc->ways = TILE_CACHE_WAYS;
+      pipe_mutex_init(tc->transfer_mutex);
+      for (pos = 0; pos < tc->num_parts; pos++) {
+         tc->last_tile_addr[pos].bits.invalid = 1;
+      }
+      for (pos = 0; pos < NUM_SLOTS; pos++) {
+         tc->slot_addrs[pos].bits.invalid = 1;
       }
-      tc->last_tile_addr.bits.invalid = 1;
 
-      /* this allocation allows us to guarantee that allocation
-       * failures are never fatal later
+      /* these allocations allow us to guarantee that allocation
+       * failures are never fatal later; the smallest cache is one set
+       * per slot, the entry arrays are never shrunk below that
        */
-      tc->tile = MALLOC_STRUCT( softpipe_cached_tile );
-      if (!tc->tile)
+      for (pos = 0; pos < tc->num_parts; pos++) {
+         tc->spare[pos] = MALLOC_STRUCT( softpipe_cached_tile );
+         if (!tc->spare[pos])
+            break;
+      }
+      if (pos < tc->num_parts || !alloc_entries(tc, tc->slots_per_part))
       {
+         for (pos = 0; pos < tc->num_parts; pos++)
+            FREE(tc->spare[pos]);
+         pipe_mutex_destroy(tc->transfer_mutex);
          FREE(tc);
          return NULL;
       }
@@ -134,21 +238,109 @@ sp_destroy_tile_cache(struct softpipe_tile_cache *tc)
    if (tc) {
       uint pos;
 
-      for (pos = 0; pos < NUM_ENTRIES; pos++) {
+      if (debug_get_option_tile_cache_stats()) {
+         struct sp_tile_cache_stats total;
+
+         memset(&total, 0, sizeof total);
+         for (pos = 0; pos < tc->num_parts; pos++) {
+            total.hits += tc->stats[pos].hits;
+            total.misses += tc->stats[pos].misses;
+            total.evictions += tc->stats[pos].evictions;
+            total.blocks_read += tc->stats[pos].blocks_read;
+            total.blocks_written += tc->stats[pos].blocks_written;
+         }
+
+         if (total.hits || total.misses)
+            debug_printf("softpipe: %s tile cache: %u hits, %u misses, "
+                         "%u evictions, %u blocks read, "
+                         "%u blocks written\n",
+                         tc->depth_stencil ? "depth/stencil" : "color",
+                         total.hits, total.misses, total.evictions,
+                         total.blocks_read, total.blocks_written);
+      }
+
+      for (pos = 0; pos < tc->num_entries; pos++) {
          /*assert(tc->entries[pos].x < 0);*/
          FREE( tc->entries[pos] );
       }
-      FREE( tc->tile );
+      FREE( tc->tile_addrs );
+      FREE( tc->entries );
+      FREE( tc->last_used );
+      for (pos = 0; pos < tc->num_parts; pos++)
+         FREE( tc->spare[pos] );
 
       if (tc->transfer) {
          tc->pipe->transfer_destroy(tc->pipe, tc->transfer);
       }
 
+      pipe_mutex_destroy(tc->transfer_mutex);
+
       FREE( tc );
    }
 }
 
 
+/**
+ * Size the cache for the given surface: enough sets per slot to hold all
+ * the tiles, within TILE_CACHE_MAX_TILES.  For whole_tiles, a single
+ * entry per slot.
+ */
+static void
+sp_tile_cache_resize(struct softpipe_tile_cache *tc,
+                     unsigned width, unsigned height)
+{
+   const unsigned n = tc->num_parts;
+   const unsigned tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+   const unsigned tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+   const unsigned slot_entries = n * tc->slots_per_part * tc->ways;
+   const unsigned max_turns = MAX2(TILE_CACHE_MAX_TILES / slot_entries, 1);
+   unsigned turns;
+
+   turns = (tiles_x * tiles_y + slot_entries - 1) / slot_entries;
+   turns = CLAMP(turns, 1, max_turns);
+   if (tc->whole_tiles)
+      turns = 1;
+
+   /* if out of memory, try smaller, or keep the current arrays */
+   while (!alloc_entries(tc, turns * tc->slots_per_part)) {
+      if (turns == 1) {
+         tc->sets_per_part = tc->num_entries / (n * tc->ways);
+         break;
+      }
+      turns /= 2;
+   }
+}
+
+
+/**
+ * Do values read from a surface of the given format convert back to the
+ * same bits?  Float and 8-bit normalized channels do, but the other
+ * normalized channels are truncated when converting to the surface.
+ */
+static boolean
+is_repack_exact(enum pipe_format format)
+{
+   const struct util_format_description *desc =
+      util_format_description(format);
+   unsigned i;
+
+   if (desc->layout != UTIL_FORMAT_LAYOUT_PLAIN)
+      return FALSE;
+
+   for (i = 0; i < desc->nr_channels; i++) {
+      const struct util_format_channel_description *chan = &desc->channel[i];
+
+      if (chan->type != UTIL_FORMAT_TYPE_VOID &&
+          chan->type != UTIL_FORMAT_TYPE_FLOAT &&
+          !(chan->type == UTIL_FORMAT_TYPE_UNSIGNED &&
+            chan->normalized && chan->size == 8))
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+
 /**
  * Specify the surface to cache.
  */
@@ -157,6 +349,7 @@ sp_tile_cache_set_surface(struct softpipe_tile_cache *tc,
                           struct pipe_surface *ps)
 {
    struct pipe_context *pipe = tc->pipe;
+   uint pos;
 
    if (tc->transfer) {
       if (ps == tc->surface)
@@ -173,6 +366,17 @@ sp_tile_cache_set_surface(struct softpipe_tile_cache *tc,
 
    tc->surface = ps;
 
+   /* the cache was flushed before, forget about the old surface's tiles */
+   for (pos = 0; pos < tc->num_entries; pos++) {
+      tc->tile_addrs[pos].bits.invalid = 1;
+   }
+   for (pos = 0; pos < tc->num_parts; pos++) {
+      tc->last_tile_addr[pos].bits.invalid = 1;
+   }
+   for (pos = 0; pos < NUM_SLOTS; pos++) {
+      tc->slot_addrs[pos].bits.invalid = 1;
+   }
+
    if (ps) {
       tc->transfer = pipe_get_transfer(pipe, ps->texture,
                                        ps->u.tex.level, ps->u.tex.first_layer,
@@ -181,6 +385,17 @@ sp_tile_cache_set_surface(struct softpipe_tile_cache *tc,
                                        0, 0, ps->width, ps->height);
 
       tc->depth_stencil = util_format_is_depth_or_stencil(ps->format);
+
+      /* depth/stencil tiles are kept in the surface format, and integer
+       * and RGBA float tiles hold exactly what the surface can
+       */
+      tc->quantize = !tc->depth_stencil &&
+                     !util_format_is_pure_integer(ps->format) &&
+                     ps->format != PIPE_FORMAT_R32G32B32A32_FLOAT;
+      tc->whole_tiles = tc->quantize && !is_repack_exact(ps->format);
+      tc->ways = tc->whole_tiles ? 1 : TILE_CACHE_WAYS;
+
+      sp_tile_cache_resize(tc, ps->width, ps->height);
    }
 }
 
@@ -263,54 +478,29 @@ clear_tile_rgba(struct softpipe_cached_tile *tile,
 
 
 /**
- * Set a tile to a solid value/color.
+ * Set a row of depth/stencil values to a solid value.
  */
 static void
-clear_tile(struct softpipe_cached_tile *tile,
-           enum pipe_format format,
-           uint64_t clear_value)
+clear_row(ubyte *row, unsigned blocksize, unsigned width,
+          uint64_t clear_value)
 {
-   uint i, j;
+   uint j;
 
-   switch (util_format_get_blocksize(format)) {
+   switch (blocksize) {
    case 1:
-      memset(tile->data.any, clear_value, TILE_SIZE * TILE_SIZE);
+      memset(row, clear_value, width);
       break;
    case 2:
-      if (clear_value == 0) {
-         memset(tile->data.any, 0, 2 * TILE_SIZE * TILE_SIZE);
-      }
-      else {
-         for (i = 0; i < TILE_SIZE; i++) {
-            for (j = 0; j < TILE_SIZE; j++) {
-               tile->data.depth16[i][j] = (ushort) clear_value;
-            }
-         }
-      }
+      for (j = 0; j < width; j++)
+         ((ushort *) row)[j] = (ushort) clear_value;
       break;
    case 4:
-      if (clear_value == 0) {
-         memset(tile->data.any, 0, 4 * TILE_SIZE * TILE_SIZE);
-      }
-      else {
-         for (i = 0; i < TILE_SIZE; i++) {
-            for (j = 0; j < TILE_SIZE; j++) {
-               tile->data.depth32[i][j] = clear_value;
-            }
-         }
-      }
+      for (j = 0; j < width; j++)
+         ((uint *) row)[j] = (uint) clear_value;
       break;
    case 8:
-      if (clear_value == 0) {
-         memset(tile->data.any, 0, 8 * TILE_SIZE * TILE_SIZE);
-      }
-      else {
-         for (i = 0; i < TILE_SIZE; i++) {
-            for (j = 0; j < TILE_SIZE; j++) {
-               tile->data.depth64[i][j] = clear_value;
-            }
-         }
-      }
+      for (j = 0; j < width; j++)
+         ((uint64_t *) row)[j] = clear_value;
       break;
    default:
       assert(0);
@@ -318,64 +508,253 @@ clear_tile(struct softpipe_cached_tile *tile,
 }
 
 
+/**
+ * Set a tile to a solid value/color.
+ */
+static void
+clear_tile(struct softpipe_cached_tile *tile,
+           enum pipe_format format,
+           uint64_t clear_value)
+{
+   const unsigned blocksize = util_format_get_blocksize(format);
+
+   if (clear_value == 0) {
+      memset(tile->data.any, 0, blocksize * TILE_SIZE * TILE_SIZE);
+   }
+   else {
+      uint i;
+
+      clear_row(tile->data.any, blocksize, TILE_SIZE, clear_value);
+      for (i = 1; i < TILE_SIZE; i++) {
+         memcpy(tile->data.any + i * blocksize * TILE_SIZE,
+                tile->data.any, blocksize * TILE_SIZE);
+      }
+   }
+}
+
+
+/**
+ * Convert blocks of a tile between the cache and the surface.
+ * \param tx  x position of the tile, in pixels
+ * \param py  y position of the row of blocks, in pixels
+ * \param mask  which blocks of the row to convert
+ * \param to_surface  write the blocks back rather than read them
+ * \return number of blocks converted
+ */
+static unsigned
+convert_blocks(struct softpipe_tile_cache *tc,
+               struct softpipe_cached_tile *tile,
+               unsigned tx, unsigned py, unsigned mask,
+               boolean to_surface)
+{
+   struct pipe_transfer *pt = tc->transfer;
+   const enum pipe_format format = tc->surface->format;
+   const unsigned w = pt->box.width;
+   const unsigned h = pt->box.height;
+   const unsigned y = py & (TILE_SIZE - 1);
+   const unsigned ph = MIN2(TILE_BLOCK_SIZE, h - MIN2(py, h));
+   unsigned converted = 0;
+   ubyte *map;
+
+   assert(y % TILE_BLOCK_SIZE == 0);
+
+   if (!ph)
+      return 0;
+
+   map = get_transfer_map(tc);
+   if (!map)
+      return 0;
+
+   /* convert runs of consecutive blocks at once */
+   while (mask) {
+      const unsigned first = ffs(mask) - 1;
+      const unsigned run = ffs(~(mask >> first)) - 1;
+      const unsigned x = first * TILE_BLOCK_SIZE;
+      const unsigned px = tx + x;
+      const unsigned pw = MIN2(run * TILE_BLOCK_SIZE, w - MIN2(px, w));
+
+      mask &= ~(((1 << run) - 1) << first);
+
+      if (!pw)
+         continue;
+
+      if (tc->depth_stencil) {
+         const unsigned stride =
+            util_format_get_blocksize(format) * TILE_SIZE;
+
+         if (to_surface)
+            util_copy_rect(map, format, pt->stride, px, py, pw, ph,
+                           tile->data.any, stride, x, y);
+         else
+            util_copy_rect(tile->data.any, format, stride, x, y, pw, ph,
+                           map, pt->stride, px, py);
+      }
+      else if (util_format_is_pure_uint(format)) {
+         unsigned *data = tile->data.colorui128[y][x];
+
+         if (to_surface)
+            util_format_write_4ui(format, data, sizeof tile->data.colorui128[0],
+                                  map, pt->stride, px, py, pw, ph);
+         else
+            util_format_read_4ui(format, data, sizeof tile->data.colorui128[0],
+                                 map, pt->stride, px, py, pw, ph);
+      }
+      else if (util_format_is_pure_sint(format)) {
+         int *data = tile->data.colori128[y][x];
+
+         if (to_surface)
+            util_format_write_4i(format, data, sizeof tile->data.colori128[0],
+                                 map, pt->stride, px, py, pw, ph);
+         else
+            util_format_read_4i(format, data, sizeof tile->data.colori128[0],
+                                map, pt->stride, px, py, pw, ph);
+      }
+      else {
+         float *data = tile->data.color[y][x];
+
+         if (to_surface)
+            util_format_write_4f(format, data, sizeof tile->data.color[0],
+                                 map, pt->stride, px, py, pw, ph);
+         else
+            util_format_read_4f(format, data, sizeof tile->data.color[0],
+                                map, pt->stride, px, py, pw, ph);
+      }
+
+      converted += run;
+   }
+
+   return converted;
+}
+
+
+/**
+ * Convert the given blocks of a row of blocks from the surface.
+ * \param x, y  position of a pixel in the row of blocks
+ */
+void
+sp_tile_cache_load_blocks(struct softpipe_tile_cache *tc,
+                          struct softpipe_cached_tile *tile,
+                          int x, int y, unsigned mask)
+{
+   const unsigned part = tile_partition(tile_address(x, y), tc->num_parts);
+   const unsigned row = (y & (TILE_SIZE - 1)) / TILE_BLOCK_SIZE;
+
+   tc->stats[part].blocks_read +=
+      convert_blocks(tc, tile, x & ~(TILE_SIZE - 1),
+                     (y & ~(TILE_BLOCK_SIZE - 1)), mask, FALSE);
+   tile->valid[row] |= mask;
+}
+
+
+/**
+ * Write a tile's dirty blocks back to the surface.
+ */
+static void
+write_dirty_blocks(struct softpipe_tile_cache *tc,
+                   struct softpipe_cached_tile *tile,
+                   union tile_address addr)
+{
+   const unsigned part = tile_partition(addr, tc->num_parts);
+   unsigned row;
+
+   for (row = 0; row < TILE_BLOCKS; row++) {
+      if (tile->dirty[row]) {
+         tc->stats[part].blocks_written +=
+            convert_blocks(tc, tile,
+                           addr.bits.x * TILE_SIZE,
+                           addr.bits.y * TILE_SIZE + row * TILE_BLOCK_SIZE,
+                           tile->dirty[row], TRUE);
+      }
+   }
+}
+
+
+/**
+ * Write a tile's dirty blocks back to the surface and mark its entry as
+ * empty.
+ */
+static void
+sp_flush_tile(struct softpipe_tile_cache* tc, unsigned pos)
+{
+   if (!tc->tile_addrs[pos].bits.invalid) {
+      write_dirty_blocks(tc, tc->entries[pos], tc->tile_addrs[pos]);
+      tc->tile_addrs[pos].bits.invalid = 1;  /* mark as empty */
+   }
+}
+
+
 /**
  * Actually clear the tiles which were flagged as being in a clear state.
+ * The clear value is converted to the surface format once and the
+ * resulting row is copied to the tiles.
  */
 static void
 sp_tile_cache_flush_clear(struct softpipe_tile_cache *tc)
 {
    struct pipe_transfer *pt = tc->transfer;
+   const enum pipe_format format = tc->surface->format;
+   const unsigned blocksize = util_format_get_blocksize(format);
    const uint w = tc->transfer->box.width;
    const uint h = tc->transfer->box.height;
+   ubyte row[TILE_SIZE * 16];
+   ubyte *map = NULL;
    uint x, y;
    uint numCleared = 0;
 
    assert(pt->resource);
-   if (!tc->tile)
-      tc->tile = sp_alloc_tile(tc);
+   assert(blocksize <= 16);
 
-   /* clear the scratch tile to the clear value */
-   if (tc->depth_stencil) {
-      clear_tile(tc->tile, pt->resource->format, tc->clear_val);
-   } else {
-      clear_tile_rgba(tc->tile, pt->resource->format, &tc->clear_color);
-   }
-
-   /* push the tile to all positions marked as clear */
    for (y = 0; y < h; y += TILE_SIZE) {
       for (x = 0; x < w; x += TILE_SIZE) {
          union tile_address addr = tile_address(x, y);
 
          if (is_clear_flag_set(tc->clear_flags, addr)) {
-            /* write the scratch tile to the surface */
-            if (tc->depth_stencil) {
-               pipe_put_tile_raw(tc->pipe,
-                                 pt,
-                                 x, y, TILE_SIZE, TILE_SIZE,
-                                 tc->tile->data.any, 0/*STRIDE*/);
-            }
-            else {
-               if (util_format_is_pure_uint(tc->surface->format)) {
-                  pipe_put_tile_ui_format(tc->pipe, pt,
-                                          x, y, TILE_SIZE, TILE_SIZE,
-                                          pt->resource->format,
-                                          (unsigned *) tc->tile->data.colorui128);
-               } else if (util_format_is_pure_sint(tc->surface->format)) {
-                  pipe_put_tile_i_format(tc->pipe, pt,
-                                         x, y, TILE_SIZE, TILE_SIZE,
-                                         pt->resource->format,
-                                         (int *) tc->tile->data.colori128);
-               } else {
-                  pipe_put_tile_rgba(tc->pipe, pt,
-                                     x, y, TILE_SIZE, TILE_SIZE,
-                                     (float *) tc->tile->data.color);
+            const uint tw = MIN2(TILE_SIZE, w - x);
+            const uint th = MIN2(TILE_SIZE, h - y);
+            uint i;
+
+            if (!map) {
+               map = get_transfer_map(tc);
+               if (!map)
+                  goto out;
+
+               /* convert the clear value to a row of the surface format */
+               if (tc->depth_stencil) {
+                  clear_row(row, blocksize, TILE_SIZE, tc->clear_val);
+               }
+               else if (util_format_is_pure_uint(format)) {
+                  uint rgba[TILE_SIZE][4];
+                  for (i = 0; i < TILE_SIZE; i++)
+                     memcpy(rgba[i], tc->clear_color.ui, sizeof rgba[i]);
+                  util_format_write_4ui(format, rgba[0], sizeof rgba,
+                                        row, sizeof row, 0, 0, TILE_SIZE, 1);
                }
+               else if (util_format_is_pure_sint(format)) {
+                  int rgba[TILE_SIZE][4];
+                  for (i = 0; i < TILE_SIZE; i++)
+                     memcpy(rgba[i], tc->clear_color.i, sizeof rgba[i]);
+                  util_format_write_4i(format, rgba[0], sizeof rgba,
+                                       row, sizeof row, 0, 0, TILE_SIZE, 1);
+               }
+               else {
+                  float rgba[TILE_SIZE][4];
+                  for (i = 0; i < TILE_SIZE; i++)
+                     memcpy(rgba[i], tc->clear_color.f, sizeof rgba[i]);
+                  util_format_write_4f(format, rgba[0], sizeof rgba,
+                                       row, sizeof row, 0, 0, TILE_SIZE, 1);
+               }
+            }
+
+            for (i = 0; i < th; i++) {
+               memcpy(map + (y + i) * pt->stride + x * blocksize,
+                      row, tw * blocksize);
             }
             numCleared++;
          }
       }
    }
 
+out:
    /* reset all clear flags to zero */
    memset(tc->clear_flags, 0, sizeof(tc->clear_flags));
 
@@ -384,45 +763,6 @@ sp_tile_cache_flush_clear(struct softpipe_tile_cache *tc)
 #endif
 }
 
-static void
-sp_flush_tile(struct softpipe_tile_cache* tc, unsigned pos)
-{
-   if (!tc->tile_addrs[pos].bits.invalid) {
-      if (tc->depth_stencil) {
-         pipe_put_tile_raw(tc->pipe, tc->transfer,
-                           tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                           tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                           TILE_SIZE, TILE_SIZE,
-                           tc->entries[pos]->data.depth32, 0/*STRIDE*/);
-      }
-      else {
-         if (util_format_is_pure_uint(tc->surface->format)) {
-            pipe_put_tile_ui_format(tc->pipe, tc->transfer,
-                                    tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                    tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                    TILE_SIZE, TILE_SIZE,
-                                    tc->surface->format,
-                                    (unsigned *) tc->entries[pos]->data.colorui128);
-         } else if (util_format_is_pure_sint(tc->surface->format)) {
-            pipe_put_tile_i_format(tc->pipe, tc->transfer,
-                                   tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                   tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                   TILE_SIZE, TILE_SIZE,
-                                   tc->surface->format,
-                                   (int *) tc->entries[pos]->data.colori128);
-         } else {
-            pipe_put_tile_rgba_format(tc->pipe, tc->transfer,
-                                      tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                      tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                      TILE_SIZE, TILE_SIZE,
-                                      tc->surface->format,
-                                      (float *) tc->entries[pos]->data.color);
-         }
-      }
-      tc->tile_addrs[pos].bits.invalid = 1;  /* mark as empty */
-   }
-}
-
 /**
  * Flush the tile cache: write all dirty tiles back to the transfer.
  * any tiles "flagged" as cleared will be "really" cleared.
@@ -431,11 +771,12 @@ void
 sp_flush_tile_cache(struct softpipe_tile_cache *tc)
 {
    struct pipe_transfer *pt = tc->transfer;
-   int inuse = 0, pos;
+   int inuse = 0;
+   unsigned pos;
 
    if (pt) {
       /* caching a drawing transfer */
-      for (pos = 0; pos < NUM_ENTRIES; pos++) {
+      for (pos = 0; pos < tc->num_entries; pos++) {
          struct softpipe_cached_tile *tile = tc->entries[pos];
          if (!tile)
          {
@@ -450,7 +791,17 @@ sp_flush_tile_cache(struct softpipe_tile_cache *tc)
       sp_tile_cache_flush_clear(tc);
 
 
-      tc->last_tile_addr.bits.invalid = 1;
+      for (pos = 0; pos < tc->num_parts; pos++)
+         tc->last_tile_addr[pos].bits.invalid = 1;
+      for (pos = 0; pos < NUM_SLOTS; pos++)
+         tc->slot_addrs[pos].bits.invalid = 1;
+
+      /* The tiles were written straight into the mapped surface.  Let
+       * texture caches know, as they would have by the transfer being
+       * unmapped for each tile before.
+       */
+      if (inuse)
+         softpipe_resource(pt->resource)->timestamp++;
    }
 
 #if 0
@@ -458,146 +809,202 @@ sp_flush_tile_cache(struct softpipe_tile_cache *tc)
 #endif
 }
 
+/**
+ * Allocate a tile for the given partition.  If we're out of memory, use
+ * the partition's spare tile, or steal one from the same partition, so we
+ * never touch tiles which may be in use by another rasterizer thread.
+ */
 static struct softpipe_cached_tile *
-sp_alloc_tile(struct softpipe_tile_cache *tc)
+sp_alloc_tile(struct softpipe_tile_cache *tc, unsigned part)
 {
    struct softpipe_cached_tile * tile = MALLOC_STRUCT(softpipe_cached_tile);
    if (!tile)
    {
       /* in this case, steal an existing tile */
-      if (!tc->tile)
+      if (!tc->spare[part])
       {
+         const unsigned part_entries = tc->sets_per_part * tc->ways;
          unsigned pos;
-         for (pos = 0; pos < NUM_ENTRIES; ++pos) {
+         for (pos = part * part_entries;
+              pos < (part + 1) * part_entries; ++pos) {
             if (!tc->entries[pos])
                continue;
 
             sp_flush_tile(tc, pos);
-            tc->tile = tc->entries[pos];
+            tc->spare[part] = tc->entries[pos];
             tc->entries[pos] = NULL;
             break;
          }
 
          /* this should never happen */
-         if (!tc->tile)
+         if (!tc->spare[part])
             abort();
       }
 
-      tile = tc->tile;
-      tc->tile = NULL;
+      tile = tc->spare[part];
+      tc->spare[part] = NULL;
 
-      tc->last_tile_addr.bits.invalid = 1;
+      tc->last_tile_addr[part].bits.invalid = 1;
    }
    return tile;
 }
 
 /**
- * Get a tile from the cache.
+ * Quantize a cached color tile to the surface format, as writing the tile
+ * back and reading it again would.  Either the blocks drawn to since the
+ * last time are converted to the surface format and back, or for
+ * whole_tiles the tile is written back and its blocks will be read again
+ * when next used.
+ */
+static void
+sp_quantize_tile(struct softpipe_tile_cache *tc, union tile_address addr)
+{
+   const unsigned part = tile_partition(addr, tc->num_parts);
+   const unsigned first = tile_set_start(tc, addr, part);
+   const enum pipe_format format = tc->surface->format;
+   ubyte packed[TILE_BLOCK_SIZE][TILE_SIZE * 16];
+   unsigned pos, row;
+
+   assert(util_format_get_blocksize(format) <= 16);
+
+   for (pos = first; pos < first + tc->ways; pos++) {
+      if (tc->tile_addrs[pos].value == addr.value) {
+         struct softpipe_cached_tile *tile = tc->entries[pos];
+
+         if (tc->whole_tiles) {
+            write_dirty_blocks(tc, tile, addr);
+            memset(tile->valid, 0, sizeof tile->valid);
+            memset(tile->dirty, 0, sizeof tile->dirty);
+            memset(tile->drawn, 0, sizeof tile->drawn);
+            return;
+         }
+
+         for (row = 0; row < TILE_BLOCKS; row++) {
+            unsigned mask = tile->drawn[row];
+
+            /* convert runs of consecutive blocks at once */
+            while (mask) {
+               const unsigned col = ffs(mask) - 1;
+               const unsigned run = ffs(~(mask >> col)) - 1;
+               float *data = tile->data.color[row * TILE_BLOCK_SIZE]
+                                             [col * TILE_BLOCK_SIZE];
+
+               mask &= ~(((1 << run) - 1) << col);
+
+               util_format_write_4f(format, data, sizeof tile->data.color[0],
+                                    packed, sizeof packed[0],
+                                    0, 0, run * TILE_BLOCK_SIZE,
+                                    TILE_BLOCK_SIZE);
+               util_format_read_4f(format, data, sizeof tile->data.color[0],
+                                   packed, sizeof packed[0],
+                                   0, 0, run * TILE_BLOCK_SIZE,
+                                   TILE_BLOCK_SIZE);
+            }
+            tile->drawn[row] = 0;
+         }
+         return;
+      }
+   }
+}
+
+
+/**
+ * Get a tile from the cache.  The tile's blocks are only converted from
+ * the surface once used, see sp_tile_cache_load_blocks().
  * \param x, y  position of tile, in pixels
  */
 struct softpipe_cached_tile *
 sp_find_cached_tile(struct softpipe_tile_cache *tc, 
                     union tile_address addr )
 {
-   struct pipe_transfer *pt = tc->transfer;
-   /* cache pos/entry: */
-   const int pos = CACHE_POS(addr.bits.x,
-                             addr.bits.y);
-   struct softpipe_cached_tile *tile = tc->entries[pos];
+   const unsigned part = tile_partition(addr, tc->num_parts);
+   struct sp_tile_cache_stats *stats = &tc->stats[part];
+   const unsigned first = tile_set_start(tc, addr, part);
+   struct softpipe_cached_tile *tile;
+   unsigned pos, victim = first;
+   boolean whole_tile = FALSE;
+
+   assert(tc->transfer->resource);
+
+   if (tc->quantize) {
+      const unsigned slot = CACHE_POS(addr.bits.x, addr.bits.y);
+
+      if (tc->slot_addrs[slot].value != addr.value) {
+         if (!tc->slot_addrs[slot].bits.invalid)
+            sp_quantize_tile(tc, tc->slot_addrs[slot]);
+         tc->slot_addrs[slot] = addr;
+         whole_tile = tc->whole_tiles;
+      }
+   }
+
+   for (pos = first; pos < first + tc->ways; pos++) {
+      if (tc->tile_addrs[pos].value == addr.value) {
+         stats->hits++;
+         tile = tc->entries[pos];
+         goto found;
+      }
 
+      /* replace an empty entry, or the least recently used one */
+      if (!tc->tile_addrs[victim].bits.invalid &&
+          (tc->tile_addrs[pos].bits.invalid ||
+           tc->last_used[pos] < tc->last_used[victim]))
+         victim = pos;
+   }
+
+   stats->misses++;
+   pos = victim;
+
+   tile = tc->entries[pos];
    if (!tile) {
-      tile = sp_alloc_tile(tc);
+      tile = sp_alloc_tile(tc, part);
       tc->entries[pos] = tile;
    }
 
-   if (addr.value != tc->tile_addrs[pos].value) {
-
-      assert(pt->resource);
-      if (tc->tile_addrs[pos].bits.invalid == 0) {
-         /* put dirty tile back in framebuffer */
-         if (tc->depth_stencil) {
-            pipe_put_tile_raw(tc->pipe, pt,
-                              tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                              tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                              TILE_SIZE, TILE_SIZE,
-                              tile->data.depth32, 0/*STRIDE*/);
-         }
-         else {
-            if (util_format_is_pure_uint(tc->surface->format)) {
-               pipe_put_tile_ui_format(tc->pipe, pt,
-                                      tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                      tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                      TILE_SIZE, TILE_SIZE,
-                                      tc->surface->format,
-                                      (unsigned *) tile->data.colorui128);
-            } else if (util_format_is_pure_sint(tc->surface->format)) {
-               pipe_put_tile_i_format(tc->pipe, pt,
-                                      tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                      tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                      TILE_SIZE, TILE_SIZE,
-                                      tc->surface->format,
-                                      (int *) tile->data.colori128);
-            } else {
-               pipe_put_tile_rgba_format(tc->pipe, pt,
-                                         tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                         tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                         TILE_SIZE, TILE_SIZE,
-                                         tc->surface->format,
-                                         (float *) tile->data.color);
-            }
-         }
-      }
+   if (!tc->tile_addrs[pos].bits.invalid) {
+      /* put dirty blocks back in framebuffer */
+      sp_flush_tile(tc, pos);
+      stats->evictions++;
+   }
 
-      tc->tile_addrs[pos] = addr;
+   tc->tile_addrs[pos] = addr;
 
-      if (is_clear_flag_set(tc->clear_flags, addr)) {
-         /* don't get tile from framebuffer, just clear it */
-         if (tc->depth_stencil) {
-            clear_tile(tile, pt->resource->format, tc->clear_val);
-         }
-         else {
-            clear_tile_rgba(tile, pt->resource->format, &tc->clear_color);
-         }
-         clear_clear_flag(tc->clear_flags, addr);
+   if (is_clear_flag_set(tc->clear_flags, addr)) {
+      /* don't get tile from framebuffer, just clear it */
+      if (tc->depth_stencil) {
+         clear_tile(tile, tc->surface->format, tc->clear_val);
       }
       else {
-         /* get new tile data from transfer */
-         if (tc->depth_stencil) {
-            pipe_get_tile_raw(tc->pipe, pt,
-                              tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                              tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                              TILE_SIZE, TILE_SIZE,
-                              tile->data.depth32, 0/*STRIDE*/);
-         }
-         else {
-            if (util_format_is_pure_uint(tc->surface->format)) {
-               pipe_get_tile_ui_format(tc->pipe, pt,
-                                         tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                         tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                         TILE_SIZE, TILE_SIZE,
-                                         tc->surface->format,
-                                         (unsigned *) tile->data.colorui128);
-            } else if (util_format_is_pure_sint(tc->surface->format)) {
-               pipe_get_tile_i_format(tc->pipe, pt,
-                                         tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                         tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                         TILE_SIZE, TILE_SIZE,
-                                         tc->surface->format,
-                                         (int *) tile->data.colori128);
-            } else {
-               pipe_get_tile_rgba_format(tc->pipe, pt,
-                                         tc->tile_addrs[pos].bits.x * TILE_SIZE,
-                                         tc->tile_addrs[pos].bits.y * TILE_SIZE,
-                                         TILE_SIZE, TILE_SIZE,
-                                         tc->surface->format,
-                                         (float *) tile->data.color);
-            }
-         }
+         clear_tile_rgba(tile, tc->surface->format, &tc->clear_color);
       }
+      clear_clear_flag(tc->clear_flags, addr);
+      memset(tile->valid, 0xff, sizeof tile->valid);
+      memset(tile->dirty, 0xff, sizeof tile->dirty);
+      memset(tile->drawn, 0xff, sizeof tile->drawn);
+   }
+   else {
+      memset(tile->valid, 0, sizeof tile->valid);
+      memset(tile->dirty, 0, sizeof tile->dirty);
+      memset(tile->drawn, 0, sizeof tile->drawn);
    }
 
-   tc->last_tile = tile;
-   tc->last_tile_addr = addr;
+found:
+   if (whole_tile) {
+      /* the tile will be written back as a whole, so read all of it */
+      unsigned row;
+
+      for (row = 0; row < TILE_BLOCKS; row++) {
+         if (tile->valid[row] != 0xffff)
+            sp_tile_cache_load_blocks(tc, tile, addr.bits.x * TILE_SIZE,
+                                      addr.bits.y * TILE_SIZE +
+                                      row * TILE_BLOCK_SIZE,
+                                      0xffff & ~tile->valid[row]);
+         tile->dirty[row] = 0xffff;
+      }
+   }
+
+   tc->last_used[pos] = ++stats->clock;
+   tc->last_tile[part] = tile;
+   tc->last_tile_addr[part] = addr;
    return tile;
 }
 
@@ -624,8 +1031,13 @@ sp_tile_cache_clear(struct softpipe_tile_cache *tc,
    /* set flags to indicate all the tiles are cleared */
    memset(tc->clear_flags, 255, sizeof(tc->clear_flags));
 
-   for (pos = 0; pos < NUM_ENTRIES; pos++) {
+   for (pos = 0; pos < tc->num_entries; pos++) {
       tc->tile_addrs[pos].bits.invalid = 1;
    }
-   tc->last_tile_addr.bits.invalid = 1;
+   for (pos = 0; pos < tc->num_parts; pos++) {
+      tc->last_tile_addr[pos].bits.invalid = 1;
+   }
+   for (pos = 0; pos < NUM_SLOTS; pos++) {
+      tc->slot_addrs[pos].bits.invalid = 1;
+   }
 }
@@ -30,7 +30,9 @@
 
 
 #include "pipe/p_compiler.h"
+#include "os/os_thread.h"
 #include "sp_texture.h"
+#include "sp_quad.h"
 
 
 struct softpipe_tile_cache;
@@ -60,8 +62,30 @@ union tile_address {
 };
 
 
+/**
+ * Tiles are converted from/to the surface format in blocks of
+ * TILE_BLOCK_SIZE x TILE_BLOCK_SIZE pixels, and only when a quad touches
+ * them.  One bit per block in a row of blocks must fit in a ushort.
+ */
+#define TILE_BLOCK_SIZE 4
+#define TILE_BLOCKS (TILE_SIZE / TILE_BLOCK_SIZE)
+
+
 struct softpipe_cached_tile
 {
+   /** per row of blocks, which blocks hold the surface contents */
+   ushort valid[TILE_BLOCKS];
+   /** per row of blocks, which blocks may have been modified */
+   ushort dirty[TILE_BLOCKS];
+   /** per row of blocks, which blocks may have been modified since the
+    * tile was last quantized, see CACHE_POS() */
+   ushort drawn[TILE_BLOCKS];
+
+   /**
+    * Color tiles are float, or uint/int for pure integer formats, since
+    * that's what the quad stages work with.  Depth/stencil tiles are kept
+    * in the surface format, with a stride of TILE_SIZE pixels.
+    */
    union {
       float color[TILE_SIZE][TILE_SIZE][4];
       uint color32[TILE_SIZE][TILE_SIZE];
@@ -75,9 +99,60 @@ struct softpipe_cached_tile
    } data;
 };
 
-#define NUM_ENTRIES 50
+
+/**
+ * The cache is set associative with TILE_CACHE_WAYS entries per set and
+ * LRU replacement within a set.  It is sized from the surface, up to
+ * TILE_CACHE_MAX_TILES entries.  Tile memory is only allocated when an
+ * entry is first used, but a color tile is 64 KB, so a cache can grow to
+ * 32 MB per bound surface.
+ *
+ * Formats for which whole_tiles is set gain nothing from holding more
+ * tiles, see below, so their cache is direct mapped with one entry per
+ * slot, as softpipe's tile cache always was.
+ */
+#define TILE_CACHE_WAYS 4
+#define TILE_CACHE_MAX_TILES 512
+
+
+/**
+ * Color tiles are kept in float, so when a tile gets written back and
+ * read again, the values are quantized to the surface format.  To render
+ * exactly as a direct mapped cache of NUM_SLOTS entries would, the tiles
+ * are mapped to slots with CACHE_POS() and whenever a tile takes over a
+ * slot, the tile which held it before is quantized.  Each cache set only
+ * holds tiles of a single slot.
+ *
+ * For most formats, converting values read from the surface back gives
+ * the same bits, and tiles are quantized in place.  For the others,
+ * every write back changes even the pixels which weren't drawn to, so
+ * the tile holding a slot is always converted as a whole.
+ */
+#define NUM_SLOTS 50
+
+#define CACHE_POS(x, y) \
+   (((x) + (y) * 5) % NUM_SLOTS)
 
 
+struct sp_tile_cache_stats
+{
+   unsigned clock;            /**< source of LRU stamps */
+   unsigned hits;
+   unsigned misses;
+   unsigned evictions;
+   unsigned blocks_read;      /**< blocks converted from the surface */
+   unsigned blocks_written;   /**< blocks converted back to the surface */
+};
+
+
+/**
+ * When rasterizing with several threads, each thread owns the tiles for
+ * which tile_partition() returns its index and the cache sets are dealt
+ * out to the partitions, so that a thread only ever touches its own
+ * entries and lookups need no locking.  Tiles which share a slot belong
+ * to the same thread, so they get quantized in the same order as when
+ * not threaded.
+ */
 struct softpipe_tile_cache
 {
    struct pipe_context *pipe;
@@ -85,22 +160,41 @@ struct softpipe_tile_cache
    struct pipe_transfer *transfer;
    void *transfer_map;
 
-   union tile_address tile_addrs[NUM_ENTRIES];
-   struct softpipe_cached_tile *entries[NUM_ENTRIES];
-   uint clear_flags[(MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32];
+   unsigned num_parts;            /**< number of partitions, >= 1 */
+   pipe_mutex transfer_mutex;     /**< serializes mapping the transfer */
+
+   unsigned slots_per_part;       /**< slots in one partition */
+   unsigned ways;                 /**< entries per set */
+   unsigned sets_per_part;        /**< a multiple of slots_per_part */
+   unsigned num_entries;
+   union tile_address *tile_addrs;
+   struct softpipe_cached_tile **entries;
+   unsigned *last_used;           /**< LRU stamps, per entry */
+
+   /** One byte per tile, so that threads can clear flags concurrently */
+   ubyte clear_flags[(MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE)];
    union pipe_color_union clear_color; /**< for color bufs */
    uint64_t clear_val;        /**< for z+stencil */
    boolean depth_stencil; /**< Is the surface a depth/stencil format? */
+   boolean quantize;      /**< Is converting to the surface format lossy? */
+   boolean whole_tiles;   /**< Does converting back change the bits? */
+
+   /** which tile each slot holds, see CACHE_POS() */
+   union tile_address slot_addrs[NUM_SLOTS];
 
-   struct softpipe_cached_tile *tile;  /**< scratch tile for clears */
+   /** spare tile of each partition, for out of memory */
+   struct softpipe_cached_tile *spare[SP_MAX_THREADS];
 
-   union tile_address last_tile_addr;
-   struct softpipe_cached_tile *last_tile;  /**< most recently retrieved tile */
+   /** most recently retrieved tile, per partition */
+   union tile_address last_tile_addr[SP_MAX_THREADS];
+   struct softpipe_cached_tile *last_tile[SP_MAX_THREADS];
+
+   struct sp_tile_cache_stats stats[SP_MAX_THREADS];
 };
 
 
 extern struct softpipe_tile_cache *
-sp_create_tile_cache( struct pipe_context *pipe );
+sp_create_tile_cache( struct pipe_context *pipe, unsigned num_parts );
 
 extern void
 sp_destroy_tile_cache(struct softpipe_tile_cache *tc);
@@ -130,6 +224,11 @@ extern struct softpipe_cached_tile *
 sp_find_cached_tile(struct softpipe_tile_cache *tc, 
                     union tile_address addr );
 
+extern void
+sp_tile_cache_load_blocks(struct softpipe_tile_cache *tc,
+                          struct softpipe_cached_tile *tile,
+                          int x, int y, unsigned mask);
+
 
 static INLINE union tile_address
 tile_address( unsigned x,
@@ -144,22 +243,84 @@ tile_address( unsigned x,
    return addr;
 }
 
+/**
+ * Return which of n partitions / rasterizer threads owns the given tile.
+ */
+static INLINE unsigned
+tile_partition( union tile_address addr, unsigned n )
+{
+   return n > 1 ? CACHE_POS(addr.bits.x, addr.bits.y) % n : 0;
+}
+
 /* Quickly retrieve tile if it matches last lookup.
  */
 static INLINE struct softpipe_cached_tile *
-sp_get_cached_tile(struct softpipe_tile_cache *tc, 
-                   int x, int y )
+sp_lookup_tile(struct softpipe_tile_cache *tc, 
+               int x, int y )
 {
    union tile_address addr = tile_address( x, y );
+   unsigned part = tile_partition( addr, tc->num_parts );
 
-   if (tc->last_tile_addr.value == addr.value)
-      return tc->last_tile;
+   if (tc->last_tile_addr[part].value == addr.value) {
+      tc->stats[part].hits++;
+      return tc->last_tile[part];
+   }
 
    return sp_find_cached_tile( tc, addr );
 }
 
+/**
+ * Get the tile containing the given batch of quads, which all lie in the
+ * same row of blocks.  Only the blocks the quads hit are converted from
+ * the surface, and they get marked dirty.
+ */
+static INLINE struct softpipe_cached_tile *
+sp_get_cached_tile_quads(struct softpipe_tile_cache *tc,
+                         struct quad_header *quads[], unsigned nr)
+{
+   const int x = quads[0]->input.x0;
+   const int y = quads[0]->input.y0;
+   struct softpipe_cached_tile *tile = sp_lookup_tile(tc, x, y);
+   const unsigned row = (y & (TILE_SIZE - 1)) / TILE_BLOCK_SIZE;
+   unsigned mask = 0, q;
+
+   for (q = 0; q < nr; q++) {
+      assert(quads[q]->input.y0 == y);
+      mask |= 1 << ((quads[q]->input.x0 & (TILE_SIZE - 1)) / TILE_BLOCK_SIZE);
+   }
+
+   if (mask & ~tile->valid[row])
+      sp_tile_cache_load_blocks(tc, tile, x, y, mask & ~tile->valid[row]);
+   tile->dirty[row] |= mask;
+   tile->drawn[row] |= mask;
+
+   return tile;
+}
 
+/**
+ * Get the whole tile containing pixel (x,y), converted and marked dirty.
+ */
+static INLINE struct softpipe_cached_tile *
+sp_get_cached_tile(struct softpipe_tile_cache *tc, 
+                   int x, int y )
+{
+   struct softpipe_cached_tile *tile = sp_lookup_tile(tc, x, y);
+   unsigned row;
+
+   for (row = 0; row < TILE_BLOCKS; row++) {
+      if (tile->valid[row] != 0xffff)
+         sp_tile_cache_load_blocks(tc, tile, x,
+                                   (y & ~(TILE_SIZE - 1)) +
+                                   row * TILE_BLOCK_SIZE,
+                                   0xffff & ~tile->valid[row]);
+      tile->dirty[row] = 0xffff;
+      tile->drawn[row] = 0xffff;
+   }
+
+   return tile;
+}
 
 
-#endif /* SP_TILE_CACHE_H */
 
+
+#endif /* SP_TILE_CACHE_H */
@@ -74,7 +74,9 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
                                 unsigned max_index,
                                 unsigned prim, 
                                 unsigned start, 
-                                unsigned count );
+                                unsigned count,
+                                boolean primitive_restart,
+                                unsigned restart_index );
 
 boolean
 svga_hwtnl_is_buffer_referred( struct svga_hwtnl *hwtnl,
@@ -41,10 +41,13 @@ static enum pipe_error
 translate_indices( struct svga_hwtnl *hwtnl,
                    struct pipe_resource *src,
                    unsigned offset,
+                   unsigned in_nr,
                    unsigned nr,
                    unsigned index_size,
+                   unsigned restart_index,
                    u_translate_func translate,
-                   struct pipe_resource **out_buf )
+                   struct pipe_resource **out_buf,
+                   unsigned *out_nr )
 {
    struct pipe_context *pipe = &hwtnl->svga->pipe;
    struct pipe_transfer *src_transfer = NULL;
@@ -69,9 +72,11 @@ translate_indices( struct svga_hwtnl *hwtnl,
    if (dst_map == NULL)
       goto fail;
 
-   translate( (const char *)src_map + offset,
-              nr,
-              dst_map );
+   *out_nr = translate( (const char *)src_map + offset,
+                        in_nr,
+                        nr,
+                        restart_index,
+                        dst_map );
 
    pipe_buffer_unmap( pipe, src_transfer );
    pipe_buffer_unmap( pipe, dst_transfer );
@@ -168,7 +173,9 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
                                 int index_bias,
                                 unsigned min_index,
                                 unsigned max_index,
-                                unsigned prim, unsigned start, unsigned count)
+                                unsigned prim, unsigned start, unsigned count,
+                                boolean primitive_restart,
+                                unsigned restart_index)
 {
    unsigned gen_prim, gen_size, gen_nr, gen_type;
    u_translate_func gen_func;
@@ -181,6 +188,7 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
                                         index_size,
                                         count,
                                         hwtnl->api_fillmode,
+                                        primitive_restart,
                                         &gen_prim,
                                         &gen_size,
                                         &gen_nr,
@@ -194,6 +202,7 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
                                      count,
                                      hwtnl->api_pv,
                                      hwtnl->hw_pv,
+                                     primitive_restart,
                                      &gen_prim,
                                      &gen_size,
                                      &gen_nr,
@@ -201,6 +210,9 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
    }
 
    
+   if (gen_nr == 0)
+      return PIPE_OK;
+
    if (gen_type == U_TRANSLATE_MEMCPY) {
       /* No need for translation, just pass through to hardware: 
        */
@@ -220,14 +232,20 @@ svga_hwtnl_draw_range_elements( struct svga_hwtnl *hwtnl,
        * re-translations.  Not much point if we're just accelerating
        * GL though, as index buffers are typically used only once
        * there.
+       *
+       * With primitive restart gen_nr is only an upper bound, the
+       * translate func returns how many indices it actually wrote.
        */
       ret = translate_indices( hwtnl,
                                index_buffer,
                                start * index_size,
+                               count,
                                gen_nr,
                                gen_size,
+                               restart_index,
                                gen_func,
-                               &gen_buf );
+                               &gen_buf,
+                               &gen_nr );
       if (ret != PIPE_OK)
          goto done;
 
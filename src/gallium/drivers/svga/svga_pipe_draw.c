@@ -233,6 +233,8 @@ retry_draw_range_elements( struct svga_context *svga,
                            unsigned start, 
                            unsigned count,
                            unsigned instance_count,
+                           boolean primitive_restart,
+                           unsigned restart_index,
                            boolean do_retry )
 {
    enum pipe_error ret = PIPE_OK;
@@ -256,7 +258,8 @@ retry_draw_range_elements( struct svga_context *svga,
    ret = svga_hwtnl_draw_range_elements( svga->hwtnl,
                                          index_buffer, index_size, index_bias,
                                          min_index, max_index,
-                                         prim, start, count );
+                                         prim, start, count,
+                                         primitive_restart, restart_index );
    if (ret != PIPE_OK)
       goto retry;
 
@@ -271,7 +274,9 @@ retry:
                                         index_buffer, index_size, index_bias,
                                         min_index, max_index,
                                         prim, start, count,
-                                        instance_count, FALSE );
+                                        instance_count,
+                                        primitive_restart, restart_index,
+                                        FALSE );
    }
 
    return ret;
@@ -398,6 +403,8 @@ svga_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info)
                                           info->start + offset,
                                           info->count,
                                           info->instance_count,
+                                          info->primitive_restart,
+                                          info->restart_index,
                                           TRUE );
       }
       else {
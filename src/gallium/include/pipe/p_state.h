@@ -420,6 +420,13 @@ struct pipe_resource
 
    /* XXX this is only temporary and will be removed once it's not needed */
    uint8_t *user_ptr;        /**< user buffer pointer */
+
+   /**
+    * Incremented whenever the contents of a buffer may have changed, by the
+    * pipe_buffer_* helpers and the state tracker, so that data derived
+    * from it can be cached.  Not maintained by the drivers.
+    */
+   unsigned generation;
 };
 
 
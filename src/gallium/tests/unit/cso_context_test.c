@@ -0,0 +1,232 @@
+/**************************************************************************
+ *
+ * Copyright 2012 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+/*
+ * Test case and benchmark for cso_context.
+ *
+ * Drives a cso_context on top of a stub pipe context with a state stream
+ * resembling a draw-heavy app: a handful of distinct blend, DSA and
+ * rasterizer states, mostly redundant sets, and a save/set/restore meta
+ * operation every few draws.  Checks that the driver sees exactly the
+ * expected binds and reports the time spent per state set.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pipe/p_context.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_state.h"
+#include "cso_cache/cso_context.h"
+#include "os/os_time.h"
+#include "util/u_memory.h"
+
+
+#define NUM_STATES 8
+#define NUM_DRAWS (1 << 20)
+#define META_INTERVAL 64
+
+
+static unsigned num_creates;
+static unsigned num_binds;
+
+
+static int
+stub_get_param(struct pipe_screen *screen, enum pipe_cap param)
+{
+   return 0;
+}
+
+static int
+stub_get_shader_param(struct pipe_screen *screen, unsigned shader,
+                      enum pipe_shader_cap param)
+{
+   return 0;
+}
+
+static void *
+stub_create_state(struct pipe_context *pipe, const void *templ)
+{
+   ++num_creates;
+   return MALLOC(1);
+}
+
+static void
+stub_bind_state(struct pipe_context *pipe, void *state)
+{
+   ++num_binds;
+}
+
+static void
+stub_delete_state(struct pipe_context *pipe, void *state)
+{
+   FREE(state);
+}
+
+static void
+stub_bind_samplers(struct pipe_context *pipe, unsigned num, void **states)
+{
+}
+
+static void
+stub_set_sampler_views(struct pipe_context *pipe, unsigned num,
+                       struct pipe_sampler_view **views)
+{
+}
+
+
+static void
+init_states(struct pipe_blend_state *blend,
+            struct pipe_depth_stencil_alpha_state *dsa,
+            struct pipe_rasterizer_state *rast)
+{
+   unsigned i;
+
+   memset(blend, 0, NUM_STATES * sizeof *blend);
+   memset(dsa, 0, NUM_STATES * sizeof *dsa);
+   memset(rast, 0, NUM_STATES * sizeof *rast);
+
+   for (i = 0; i < NUM_STATES; i++) {
+      blend[i].rt[0].blend_enable = i & 1;
+      blend[i].rt[0].rgb_src_factor = PIPE_BLENDFACTOR_SRC_ALPHA;
+      blend[i].rt[0].rgb_dst_factor = PIPE_BLENDFACTOR_INV_SRC_ALPHA;
+      blend[i].rt[0].colormask = 0xf >> (i >> 1);
+
+      dsa[i].depth.enabled = 1;
+      dsa[i].depth.writemask = i & 1;
+      dsa[i].depth.func = PIPE_FUNC_LESS + (i >> 1);
+
+      rast[i].cull_face = i & 3;
+      rast[i].scissor = (i >> 2) & 1;
+      rast[i].gl_rasterization_rules = 1;
+   }
+}
+
+
+int main(int argc, char **argv)
+{
+   struct pipe_screen screen;
+   struct pipe_context pipe;
+   struct cso_context *cso;
+   struct pipe_blend_state blend[NUM_STATES];
+   struct pipe_depth_stencil_alpha_state dsa[NUM_STATES];
+   struct pipe_rasterizer_state rast[NUM_STATES];
+   unsigned expected_binds = 0;
+   unsigned cur = ~0;
+   int64_t start, end;
+   unsigned i;
+   int ret = 0;
+
+   memset(&screen, 0, sizeof screen);
+   screen.get_param = stub_get_param;
+   screen.get_shader_param = stub_get_shader_param;
+
+   memset(&pipe, 0, sizeof pipe);
+   pipe.screen = &screen;
+   pipe.create_blend_state = (void *)stub_create_state;
+   pipe.bind_blend_state = stub_bind_state;
+   pipe.delete_blend_state = stub_delete_state;
+   pipe.create_depth_stencil_alpha_state = (void *)stub_create_state;
+   pipe.bind_depth_stencil_alpha_state = stub_bind_state;
+   pipe.delete_depth_stencil_alpha_state = stub_delete_state;
+   pipe.create_rasterizer_state = (void *)stub_create_state;
+   pipe.bind_rasterizer_state = stub_bind_state;
+   pipe.delete_rasterizer_state = stub_delete_state;
+   pipe.bind_fs_state = stub_bind_state;
+   pipe.bind_vs_state = stub_bind_state;
+   pipe.bind_vertex_elements_state = stub_bind_state;
+   pipe.bind_fragment_sampler_states = stub_bind_samplers;
+   pipe.set_fragment_sampler_views = stub_set_sampler_views;
+
+   cso = cso_create_context(&pipe);
+   if (!cso) {
+      printf("Failure! Could not create cso context.\n");
+      return 1;
+   }
+
+   init_states(blend, dsa, rast);
+
+   start = os_time_get();
+
+   for (i = 0; i < NUM_DRAWS; i++) {
+      /* change state every 16 draws, otherwise re-set the same state */
+      unsigned s = (i >> 4) % NUM_STATES;
+
+      if (s != cur) {
+         expected_binds += 3;
+         cur = s;
+      }
+
+      cso_set_blend(cso, &blend[s]);
+      cso_set_depth_stencil_alpha(cso, &dsa[s]);
+      cso_set_rasterizer(cso, &rast[s]);
+
+      if (i % META_INTERVAL == META_INTERVAL - 1) {
+         unsigned m = (s + 1) % NUM_STATES;
+
+         cso_save_state(cso, (CSO_BIT_BLEND |
+                              CSO_BIT_DEPTH_STENCIL_ALPHA |
+                              CSO_BIT_RASTERIZER));
+         cso_set_blend(cso, &blend[m]);
+         cso_set_depth_stencil_alpha(cso, &dsa[m]);
+         cso_set_rasterizer(cso, &rast[m]);
+         cso_restore_state(cso);
+
+         /* three binds for the meta state, three to restore */
+         expected_binds += 6;
+      }
+   }
+
+   end = os_time_get();
+
+   printf("%u state sets in %.3f ms (%.1f ns per set)\n",
+          3 * NUM_DRAWS,
+          (end - start) / 1000.0,
+          (end - start) * 1000.0 / (3.0 * NUM_DRAWS));
+
+   if (num_creates != 3 * NUM_STATES) {
+      printf("Failure! Created %u states, expected %u.\n",
+             num_creates, 3 * NUM_STATES);
+      ret = 1;
+   }
+
+   if (num_binds != expected_binds) {
+      printf("Failure! Driver saw %u binds, expected %u.\n",
+             num_binds, expected_binds);
+      ret = 1;
+   }
+
+   cso_release_all(cso);
+   cso_destroy_context(cso);
+
+   if (!ret)
+      printf("Success!\n");
+
+   return ret;
+}
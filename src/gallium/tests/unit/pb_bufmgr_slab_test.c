@@ -0,0 +1,318 @@
+/**************************************************************************
+ *
+ * Copyright 2012 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+/*
+ * Stress test and benchmark for the slab buffer manager.
+ *
+ * N threads (4 by default, or the first argument) allocate, fill, check,
+ * fence and destroy buffers of random sizes from one fenced slab range
+ * manager.  Each thread keeps a window of live buffers, so that a buffer
+ * handed out twice shows up as a corrupted pattern, and stamps every
+ * buffer with its fence before destroying it, so that a buffer reused
+ * before its fence signalled shows up too.  Reports the allocations per
+ * second.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "os/os_thread.h"
+#include "os/os_time.h"
+#include "pipe/p_defines.h"
+#include "util/u_atomic.h"
+#include "util/u_memory.h"
+#include "pipebuffer/pb_buffer.h"
+#include "pipebuffer/pb_buffer_fenced.h"
+#include "pipebuffer/pb_bufmgr.h"
+
+
+#define MAX_THREADS 16
+#define NUM_ITERATIONS (1 << 18)
+#define NUM_LIVE 32
+#define FENCE_LAG 8
+
+#define MIN_SIZE 64
+#define MAX_SIZE 8192
+
+#define STAMP_MAGIC 0x5ab5ab5a
+
+
+struct thread_data {
+   unsigned id;
+   pipe_thread thread;
+   unsigned seed;
+   /** last submitted and last signalled fence of this thread */
+   int32_t submitted;
+   int32_t completed;
+   unsigned errors;
+};
+
+
+static struct pb_manager *mgr;
+static struct thread_data threads[MAX_THREADS];
+
+
+/*
+ * Fences are a thread index and a sequence number packed into the handle,
+ * signalled once the thread's completed count catches up.
+ */
+
+static struct pipe_fence_handle *
+make_fence(unsigned thread, int32_t seq)
+{
+   return (struct pipe_fence_handle *) (uintptr_t) (((uintptr_t) seq << 8) |
+                                                    (thread + 1));
+}
+
+static boolean
+fence_is_signalled(struct pipe_fence_handle *fence)
+{
+   uintptr_t f = (uintptr_t) fence;
+   struct thread_data *t = &threads[(f & 0xff) - 1];
+
+   return (int32_t) (f >> 8) <= p_atomic_read(&t->completed);
+}
+
+static void
+stub_fence_reference(struct pb_fence_ops *ops,
+                     struct pipe_fence_handle **ptr,
+                     struct pipe_fence_handle *fence)
+{
+   *ptr = fence;
+}
+
+static int
+stub_fence_signalled(struct pb_fence_ops *ops,
+                     struct pipe_fence_handle *fence,
+                     unsigned flag)
+{
+   return fence_is_signalled(fence) ? 0 : 1;
+}
+
+static int
+stub_fence_finish(struct pb_fence_ops *ops,
+                  struct pipe_fence_handle *fence,
+                  unsigned flag)
+{
+   return fence_is_signalled(fence) ? 0 : 1;
+}
+
+static struct pb_fence_ops stub_fence_ops = {
+   NULL,
+   stub_fence_reference,
+   stub_fence_signalled,
+   stub_fence_finish
+};
+
+
+static unsigned
+rand_next(unsigned *seed)
+{
+   *seed = *seed * 1103515245 + 12345;
+   return *seed >> 16;
+}
+
+
+static void
+fill(struct pb_buffer *buf, uint32_t pattern)
+{
+   uint32_t *map = pb_map(buf, PB_USAGE_CPU_WRITE, NULL);
+   unsigned i;
+
+   for (i = 2; i < buf->size / 4; i++)
+      map[i] = pattern + i;
+   pb_unmap(buf);
+}
+
+
+static boolean
+check(struct pb_buffer *buf, uint32_t pattern)
+{
+   uint32_t *map = pb_map(buf, PB_USAGE_CPU_READ, NULL);
+   boolean ok = TRUE;
+   unsigned i;
+
+   for (i = 2; i < buf->size / 4; i++) {
+      if (map[i] != pattern + i) {
+         ok = FALSE;
+         break;
+      }
+   }
+   pb_unmap(buf);
+   return ok;
+}
+
+
+/**
+ * Check a newly allocated buffer isn't still in use by a pending fence,
+ * and leave the stamp for the next user.
+ */
+static boolean
+check_stamp(struct pb_buffer *buf)
+{
+   uint32_t *map = pb_map(buf, PB_USAGE_CPU_READ, NULL);
+   boolean ok = TRUE;
+
+   if (map[0] == STAMP_MAGIC)
+      ok = fence_is_signalled((struct pipe_fence_handle *) (uintptr_t) map[1]);
+   map[0] = 0;
+   pb_unmap(buf);
+   return ok;
+}
+
+
+static void
+stamp(struct pb_buffer *buf, struct pipe_fence_handle *fence)
+{
+   uint32_t *map = pb_map(buf, PB_USAGE_CPU_WRITE, NULL);
+
+   map[0] = STAMP_MAGIC;
+   map[1] = (uint32_t) (uintptr_t) fence;
+   pb_unmap(buf);
+}
+
+
+static PIPE_THREAD_ROUTINE(thread_function, thread_data)
+{
+   struct thread_data *t = (struct thread_data *) thread_data;
+   struct pb_buffer *live[NUM_LIVE];
+   uint32_t patterns[NUM_LIVE];
+   struct pb_desc desc;
+   unsigned i;
+
+   memset(live, 0, sizeof live);
+   memset(&desc, 0, sizeof desc);
+   desc.alignment = MIN_SIZE;
+   desc.usage = PB_USAGE_CPU_READ | PB_USAGE_CPU_WRITE;
+
+   for (i = 0; i < NUM_ITERATIONS; i++) {
+      unsigned slot = rand_next(&t->seed) % NUM_LIVE;
+      pb_size size = MIN_SIZE + rand_next(&t->seed) % (MAX_SIZE - MIN_SIZE);
+
+      if (live[slot]) {
+         struct pipe_fence_handle *fence;
+
+         if (!check(live[slot], patterns[slot]))
+            t->errors++;
+
+         fence = make_fence(t->id, ++t->submitted);
+         stamp(live[slot], fence);
+         pb_fence(live[slot], fence);
+         pb_reference(&live[slot], NULL);
+
+         /* the "GPU" trails behind */
+         if (t->submitted > FENCE_LAG)
+            p_atomic_set(&t->completed, t->submitted - FENCE_LAG);
+      }
+
+      live[slot] = mgr->create_buffer(mgr, size, &desc);
+      if (!live[slot]) {
+         t->errors++;
+         break;
+      }
+
+      if (!check_stamp(live[slot]))
+         t->errors++;
+
+      patterns[slot] = (t->id << 24) ^ (i << 4);
+      fill(live[slot], patterns[slot]);
+   }
+
+   for (i = 0; i < NUM_LIVE; i++) {
+      if (live[i] && !check(live[i], patterns[i]))
+         t->errors++;
+      pb_reference(&live[i], NULL);
+   }
+
+   return NULL;
+}
+
+
+int main(int argc, char **argv)
+{
+   struct pb_manager *provider;
+   struct pb_desc desc;
+   unsigned num_threads = 4;
+   unsigned errors = 0;
+   int64_t start, end;
+   unsigned i;
+
+   if (argc > 1)
+      num_threads = MIN2(MAX2(atoi(argv[1]), 1), MAX_THREADS);
+
+   memset(&desc, 0, sizeof desc);
+   desc.alignment = MIN_SIZE;
+   desc.usage = PB_USAGE_CPU_READ | PB_USAGE_CPU_WRITE;
+
+   provider = pb_malloc_bufmgr_create();
+   mgr = pb_slab_range_manager_create_fenced(provider, &stub_fence_ops,
+                                             MIN_SIZE, MAX_SIZE,
+                                             16 * MAX_SIZE, &desc);
+   if (!mgr) {
+      printf("Failure! Could not create slab manager.\n");
+      return 1;
+   }
+
+   start = os_time_get();
+
+   for (i = 0; i < num_threads; i++) {
+      threads[i].id = i;
+      threads[i].seed = i + 1;
+      threads[i].thread = pipe_thread_create(thread_function, &threads[i]);
+   }
+
+   for (i = 0; i < num_threads; i++) {
+      pipe_thread_wait(threads[i].thread);
+      errors += threads[i].errors;
+   }
+
+   end = os_time_get();
+
+   printf("%u threads, %u allocations in %.3f ms (%.0f allocations/s)\n",
+          num_threads, num_threads * NUM_ITERATIONS,
+          (end - start) / 1000.0,
+          num_threads * NUM_ITERATIONS * 1000000.0 / (end - start));
+
+   /* let every fence signal, so that all slabs are released */
+   for (i = 0; i < num_threads; i++)
+      p_atomic_set(&threads[i].completed, threads[i].submitted);
+
+   mgr->flush(mgr);
+   mgr->destroy(mgr);
+
+   if (errors) {
+      printf("Failure! %u errors.\n", errors);
+      return 1;
+   }
+
+   printf("Success!\n");
+
+   return 0;
+}
@@ -0,0 +1,341 @@
+/**************************************************************************
+ *
+ * Copyright 2012 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+/*
+ * Test case and benchmark for the post-processing queue.
+ *
+ * Runs the queue on softpipe over a frame with a few hard edges, once for
+ * each filter and once for some typical filter combinations, and reports
+ * the time per frame.  Checks that the channel filters zero exactly their
+ * channels, and that MLAA only touches pixels next to an edge.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pipe/p_context.h"
+#include "pipe/p_defines.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_state.h"
+#include "postprocess/filters.h"
+#include "os/os_time.h"
+#include "util/u_inlines.h"
+#include "util/u_memory.h"
+#include "softpipe/sp_public.h"
+#include "sw/null/null_sw_winsys.h"
+
+
+#define WIDTH 256
+#define HEIGHT 256
+#define NUM_FRAMES 8
+
+#define MLAA_STEPS 8
+
+
+static struct pipe_screen *screen;
+static struct pipe_context *ctx;
+
+
+static struct pipe_resource *
+create_texture(enum pipe_format format, unsigned bind)
+{
+   struct pipe_resource templ;
+
+   memset(&templ, 0, sizeof templ);
+   templ.target = PIPE_TEXTURE_2D;
+   templ.format = format;
+   templ.width0 = WIDTH;
+   templ.height0 = HEIGHT;
+   templ.depth0 = 1;
+   templ.array_size = 1;
+   templ.bind = bind | PIPE_BIND_SAMPLER_VIEW;
+
+   return screen->resource_create(screen, &templ);
+}
+
+
+/** Inside of the test shape: a disc and a slanted band. */
+static boolean
+inside(unsigned x, unsigned y)
+{
+   int dx = (int) x - WIDTH / 3, dy = (int) y - HEIGHT / 3;
+
+   return dx * dx + dy * dy < (WIDTH / 5) * (WIDTH / 5) ||
+          (x + 2 * y) % 97 < 20;
+}
+
+
+static void
+fill(struct pipe_resource *res, boolean depth)
+{
+   struct pipe_transfer *transfer;
+   struct pipe_box box;
+   uint32_t *map;
+   unsigned x, y;
+
+   u_box_origin_2d(WIDTH, HEIGHT, &box);
+   transfer = ctx->get_transfer(ctx, res, 0, PIPE_TRANSFER_WRITE, &box);
+   map = ctx->transfer_map(ctx, transfer);
+
+   for (y = 0; y < HEIGHT; y++) {
+      uint32_t *row = (uint32_t *) ((uint8_t *) map + y * transfer->stride);
+
+      for (x = 0; x < WIDTH; x++) {
+         if (depth)
+            row[x] = inside(x, y) ? 0 : ~0;
+         else
+            row[x] = inside(x, y) ? 0xff20c0e0 : 0xff402010 + (y & 0xf);
+      }
+   }
+
+   ctx->transfer_unmap(ctx, transfer);
+   ctx->transfer_destroy(ctx, transfer);
+}
+
+
+static uint32_t *
+read_back(struct pipe_resource *res)
+{
+   struct pipe_transfer *transfer;
+   struct pipe_box box;
+   uint32_t *pixels = MALLOC(WIDTH * HEIGHT * 4);
+   uint8_t *map;
+   unsigned y;
+
+   u_box_origin_2d(WIDTH, HEIGHT, &box);
+   transfer = ctx->get_transfer(ctx, res, 0, PIPE_TRANSFER_READ, &box);
+   map = ctx->transfer_map(ctx, transfer);
+
+   for (y = 0; y < HEIGHT; y++)
+      memcpy(pixels + y * WIDTH, map + y * transfer->stride, WIDTH * 4);
+
+   ctx->transfer_unmap(ctx, transfer);
+   ctx->transfer_destroy(ctx, transfer);
+
+   return pixels;
+}
+
+
+static int
+find_filter(const char *name)
+{
+   unsigned i;
+
+   for (i = 0; i < PP_FILTERS; i++) {
+      if (strcmp(pp_filters[i].name, name) == 0)
+         return i;
+   }
+
+   return -1;
+}
+
+
+/** Does the pixel have a neighbour on the other side of an edge? */
+static boolean
+near_edge(unsigned x, unsigned y)
+{
+   boolean in = inside(x, y);
+   int dx, dy;
+
+   for (dy = -2; dy <= 2; dy++) {
+      for (dx = -2; dx <= 2; dx++) {
+         int nx = CLAMP((int) x + dx, 0, WIDTH - 1);
+         int ny = CLAMP((int) y + dy, 0, HEIGHT - 1);
+
+         if (inside(nx, ny) != in)
+            return TRUE;
+      }
+   }
+
+   return FALSE;
+}
+
+
+/**
+ * Check the output of a filter chain, as far as it can be predicted.
+ * Returns the number of mismatching pixels.
+ */
+static unsigned
+check(const unsigned *enabled, const uint32_t *in, const uint32_t *out)
+{
+   uint32_t keep = ~0;
+   boolean celshade = enabled[find_filter("pp_celshade")];
+   boolean mlaa = enabled[find_filter("pp_jimenezmlaa")] ||
+                  enabled[find_filter("pp_jimenezmlaa_color")];
+   unsigned x, y, errors = 0, changed = 0;
+
+   /* B8G8R8A8 in memory, so blue is the low byte */
+   if (enabled[find_filter("pp_noblue")])
+      keep &= ~0x000000ff;
+   if (enabled[find_filter("pp_nogreen")])
+      keep &= ~0x0000ff00;
+   if (enabled[find_filter("pp_nored")])
+      keep &= ~0x00ff0000;
+
+   if (celshade)
+      return 0;
+
+   for (y = 0; y < HEIGHT; y++) {
+      for (x = 0; x < WIDTH; x++) {
+         uint32_t expected = in[y * WIDTH + x] & keep;
+         uint32_t got = out[y * WIDTH + x];
+
+         if (got == expected)
+            continue;
+
+         if (mlaa && near_edge(x, y)) {
+            changed++;
+            continue;
+         }
+
+         if (errors++ < 4)
+            printf("  pixel (%u, %u) is 0x%08x, expected 0x%08x\n",
+                   x, y, got, expected);
+      }
+   }
+
+   if (mlaa && !changed) {
+      printf("  MLAA did not change any pixel\n");
+      errors++;
+   }
+
+   return errors;
+}
+
+
+static unsigned
+run(const char *names, boolean in_place)
+{
+   struct pipe_resource *in, *out, *depth;
+   struct pp_queue_t *ppq;
+   unsigned enabled[PP_FILTERS];
+   char buf[128], *name;
+   uint32_t *in_pixels, *out_pixels;
+   int64_t start, end;
+   unsigned i, errors;
+
+   memset(enabled, 0, sizeof enabled);
+   strncpy(buf, names, sizeof buf - 1);
+   buf[sizeof buf - 1] = 0;
+   for (name = strtok(buf, " "); name; name = strtok(NULL, " ")) {
+      int f = find_filter(name);
+      if (f < 0) {
+         printf("Failure! Unknown filter %s.\n", name);
+         return 1;
+      }
+      enabled[f] = strstr(name, "mlaa") ? MLAA_STEPS : 1;
+   }
+
+   in = create_texture(PIPE_FORMAT_B8G8R8A8_UNORM, PIPE_BIND_RENDER_TARGET);
+   out = in_place ? NULL :
+      create_texture(PIPE_FORMAT_B8G8R8A8_UNORM, PIPE_BIND_RENDER_TARGET);
+   depth = create_texture(PIPE_FORMAT_S8_UINT_Z24_UNORM,
+                          PIPE_BIND_DEPTH_STENCIL);
+   fill(in, FALSE);
+   fill(depth, TRUE);
+   in_pixels = read_back(in);
+
+   ppq = pp_init(screen, enabled);
+   if (!ppq) {
+      printf("Failure! Could not create the queue for %s.\n", names);
+      return 1;
+   }
+
+   /* the first frame allocates the temporaries, so don't time it */
+   pp_run(ppq, in, in_place ? in : out, depth);
+   out_pixels = read_back(in_place ? in : out);
+   errors = check(enabled, in_pixels, out_pixels);
+   FREE(out_pixels);
+
+   start = os_time_get();
+   for (i = 0; i < NUM_FRAMES; i++) {
+      if (in_place)
+         fill(in, FALSE);
+      pp_run(ppq, in, in_place ? in : out, depth);
+   }
+   ctx->flush(ctx, NULL);
+   end = os_time_get();
+
+   printf("%-36s %u pass(es) %8.3f ms per frame%s\n", names,
+          ppq->n_filters, (end - start) / 1000.0 / NUM_FRAMES,
+          in_place ? " (in place)" : "");
+
+   if (errors)
+      printf("Failure! %u wrong pixels for %s.\n", errors, names);
+
+   pp_free(ppq);
+   FREE(in_pixels);
+   pipe_resource_reference(&in, NULL);
+   pipe_resource_reference(&out, NULL);
+   pipe_resource_reference(&depth, NULL);
+
+   return errors;
+}
+
+
+int main(int argc, char **argv)
+{
+   static const char *chains[] = {
+      "pp_noblue",
+      "pp_nogreen",
+      "pp_nored",
+      "pp_celshade",
+      "pp_jimenezmlaa",
+      "pp_jimenezmlaa_color",
+      "pp_nored pp_noblue",
+      "pp_nored pp_nogreen pp_noblue",
+      "pp_nored pp_celshade",
+      "pp_nored pp_jimenezmlaa",
+      "pp_celshade pp_jimenezmlaa_color",
+   };
+   unsigned errors = 0;
+   unsigned i;
+
+   screen = softpipe_create_screen(null_sw_create());
+   ctx = screen->context_create(screen, NULL);
+
+   for (i = 0; i < Elements(chains); i++)
+      errors += run(chains[i], FALSE);
+
+   /* the way the DRI state trackers call it */
+   errors += run("pp_nored", TRUE);
+   errors += run("pp_jimenezmlaa_color", TRUE);
+
+   ctx->destroy(ctx);
+   screen->destroy(screen);
+
+   if (errors) {
+      printf("Failure! %u errors.\n", errors);
+      return 1;
+   }
+
+   printf("Success!\n");
+
+   return 0;
+}
@@ -383,7 +383,11 @@ struct radeon_winsys *radeon_drm_winsys_create(int fd)
     ws->kman = radeon_bomgr_create(ws);
     if (!ws->kman)
         goto fail;
-    ws->cman = pb_cache_manager_create(ws->kman, 1000000);
+    /* Cache up to a quarter of VRAM.  0 would mean no limit, so don't let
+     * the budget wrap around with huge VRAM sizes. */
+    ws->cman = pb_cache_manager_create(ws->kman, 1000000,
+                                       MIN2(ws->info.vram_size / 4,
+                                            ~(pb_size)0));
     if (!ws->cman)
         goto fail;
 
@@ -78,8 +78,8 @@ struct radeon_winsys_cs {
 
 struct radeon_info {
     uint32_t pci_id;
-    uint32_t gart_size;
-    uint32_t vram_size;
+    uint64_t gart_size;
+    uint64_t vram_size;
 
     uint32_t drm_major; /* version */
     uint32_t drm_minor;
@@ -49,23 +49,24 @@ struct YYLTYPE;
  */
 class ast_node {
 public:
-   /* Callers of this ralloc-based new need not call delete. It's
-    * easier to just ralloc_free 'ctx' (or any of its ancestors). */
-   static void* operator new(size_t size, void *ctx)
+   /* AST nodes are allocated from an arena (see ralloc_arena_context),
+    * since they all live exactly as long as the parse state.  Callers need
+    * not call delete.  The nodes are freed along with 'arena'. */
+   static void* operator new(size_t size, void *arena)
    {
       void *node;
 
-      node = rzalloc_size(ctx, size);
+      node = rzalloc_arena_size(arena, size);
       assert(node != NULL);
 
       return node;
    }
 
-   /* If the user *does* call delete, that's OK, we will just
-    * ralloc_free in that case. */
+   /* If the user *does* call delete, that's OK.  The memory is reclaimed
+    * with the rest of the arena. */
    static void operator delete(void *table)
    {
-      ralloc_free(table);
+      (void) table;
    }
 
    /**
@@ -419,7 +420,11 @@ struct ast_type_qualifier {
 
 class ast_struct_specifier : public ast_node {
 public:
-   ast_struct_specifier(const char *identifier, ast_node *declarator_list);
+   /**
+    * \param arena  Arena to allocate a name from, if \c identifier is NULL
+    */
+   ast_struct_specifier(void *arena, const char *identifier,
+			ast_node *declarator_list);
    virtual void print(void) const;
 
    virtual ir_rvalue *hir(exec_list *instructions,
@@ -318,6 +318,8 @@ match_function_by_name(const char *name,
    ir_function *f = state->symbols->get_function(name);
    ir_function_signature *local_sig = NULL;
    ir_function_signature *sig = NULL;
+   gl_shader *builtin_sh = NULL;
+   bool builtins_locked = false;
 
    /* Is the function hidden by a record type constructor? */
    if (state->symbols->get_type(name))
@@ -345,6 +347,8 @@ match_function_by_name(const char *name,
 
    /* Local shader has no exact candidates; check the built-ins. */
    _mesa_glsl_initialize_functions(state);
+   _mesa_glsl_lock_builtins();
+   builtins_locked = true;
    for (unsigned i = 0; i < state->num_builtins_to_link; i++) {
       ir_function *builtin =
 	 state->builtins_to_link[i]->symbols->get_function(name);
@@ -361,6 +365,7 @@ match_function_by_name(const char *name,
       /* If the built-in signature is exact, we can stop. */
       if (is_exact) {
 	 sig = builtin_sig;
+	 builtin_sh = state->builtins_to_link[i];
 	 goto done;
       }
 
@@ -369,13 +374,18 @@ match_function_by_name(const char *name,
 	  * we should keep searching for an exact match.
 	  */
 	 sig = builtin_sig;
+	 builtin_sh = state->builtins_to_link[i];
       }
    }
 
 done:
    if (sig != NULL) {
-      /* If the match is from a linked built-in shader, import the prototype. */
+      /* If the match is from a linked built-in shader, import the prototype
+       * and make sure the built-in's body has been read.
+       */
       if (sig != local_sig) {
+	 _mesa_glsl_read_builtin_function(builtin_sh, name);
+
 	 if (f == NULL) {
 	    f = new(ctx) ir_function(name);
 	    state->symbols->add_global_function(f);
@@ -384,6 +394,10 @@ done:
 	 f->add_signature(sig->clone_prototype(f, NULL));
       }
    }
+
+   if (builtins_locked)
+      _mesa_glsl_unlock_builtins();
+
    return sig;
 }
 
@@ -403,6 +417,8 @@ no_matching_function_error(const char *name,
 
    const char *prefix = "candidates are: ";
 
+   _mesa_glsl_lock_builtins();
+
    for (int i = -1; i < (int) state->num_builtins_to_link; i++) {
       glsl_symbol_table *syms = i >= 0 ? state->builtins_to_link[i]->symbols
 				       : state->symbols;
@@ -420,6 +436,8 @@ no_matching_function_error(const char *name,
 	 prefix = "                ";
       }
    }
+
+   _mesa_glsl_unlock_builtins();
 }
 
 /**
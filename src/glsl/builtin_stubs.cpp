@@ -37,3 +37,20 @@ _mesa_glsl_initialize_functions(_mesa_glsl_parse_state *state)
 {
    (void) state;
 }
+
+void
+_mesa_glsl_lock_builtins(void)
+{
+}
+
+void
+_mesa_glsl_unlock_builtins(void)
+{
+}
+
+void
+_mesa_glsl_read_builtin_function(gl_shader *sh, const char *name)
+{
+   (void) sh;
+   (void) name;
+}
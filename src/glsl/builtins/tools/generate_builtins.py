@@ -106,16 +106,16 @@ def write_profile(filename, profile):
     print 'static const char prototypes_for_' + profile + '[] ='
     print stringify(proto_ir), ';'
 
-    # Print a table of all the functions (not signatures) referenced.
-    # This is done so we can avoid bothering with a hash table in the C++ code.
+    # Print a table of all the functions (not signatures) referenced, sorted
+    # by name so that the C++ code can find a function's body with bsearch.
 
     function_names = set()
     for func in re.finditer(r'\(function (.+)\n', proto_ir):
         function_names.add(func.group(1))
 
-    print 'static const char *functions_for_' + profile + ' [] = {'
+    print 'static const struct builtin_function functions_for_' + profile + ' [] = {'
     for func in sorted(function_names):
-        print '   builtin_' + func + ','
+        print '   { "' + func + '", builtin_' + func + ' },'
     print '};'
 
 def write_profiles():
@@ -160,7 +160,9 @@ if __name__ == "__main__":
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "main/core.h" /* for struct gl_shader */
+#include "glapi/glthread.h"
 #include "glsl_parser_extras.h"
 #include "ir_reader.h"
 #include "program.h"
@@ -169,8 +171,35 @@ if __name__ == "__main__":
 extern "C" struct gl_shader *
 _mesa_new_shader(struct gl_context *ctx, GLuint name, GLenum type);
 
-gl_shader *
-read_builtins(GLenum target, const char *protos, const char **functions, unsigned count)
+/**
+ * A built-in function's definition, as IR text.
+ */
+struct builtin_function {
+   const char *name;
+   const char *text;
+};
+
+/**
+ * A built-in profile.  Only the prototypes are read when the profile is
+ * first used; each function's body is read the first time a shader calls
+ * it, by _mesa_glsl_read_builtin_function().  Since shaders may be compiled
+ * on several threads at once, the profile shaders must only be looked at
+ * with builtins_lock held.
+ */
+struct builtin_profile {
+   const char *prototypes;
+   const struct builtin_function *functions;
+   unsigned count;
+
+   gl_shader *sh;
+   _mesa_glsl_parse_state *st;  /**< Kept around to read bodies later */
+   bool *read;                  /**< Which functions have their bodies */
+};
+
+_glthread_DECLARE_STATIC_MUTEX(builtins_lock);
+
+static bool
+read_builtins(GLenum target, struct builtin_profile *profile)
 {
    struct gl_context fakeCtx;
    fakeCtx.API = API_OPENGL;
@@ -181,6 +210,11 @@ read_builtins(GLenum target, const char *protos, const char **functions, unsigne
    struct _mesa_glsl_parse_state *st =
       new(sh) _mesa_glsl_parse_state(&fakeCtx, target, sh);
 
+   /* The IR reader doesn't look at the extensions, and fakeCtx is gone
+    * by the time the function bodies are read.
+    */
+   st->extensions = NULL;
+
    st->language_version = 140;
    st->symbols->language_version = 140;
    st->ARB_texture_rectangle_enable = true;
@@ -191,28 +225,80 @@ read_builtins(GLenum target, const char *protos, const char **functions, unsigne
    sh->ir = new(sh) exec_list;
    sh->symbols = st->symbols;
 
-   /* Read the IR containing the prototypes */
-   _mesa_glsl_read_ir(st, sh->ir, protos, true);
-
-   /* Read ALL the function bodies, telling the IR reader not to scan for
-    * prototypes (we've already created them).  The IR reader will skip any
-    * signature that does not already exist as a prototype.
+   /* Read the IR containing the prototypes.  The bodies are read on
+    * demand, by read_builtin_body().
     */
-   for (unsigned i = 0; i < count; i++) {
-      _mesa_glsl_read_ir(st, sh->ir, functions[i], false);
-
-      if (st->error) {
-         printf("error reading builtin: %.35s ...\\n", functions[i]);
-         printf("Info log:\\n%s\\n", st->info_log);
-         ralloc_free(sh);
-         return NULL;
-      }
+   _mesa_glsl_read_ir(st, sh->ir, profile->prototypes, true);
+
+   if (st->error) {
+      printf("error reading builtin prototypes\\n");
+      printf("Info log:\\n%s\\n", st->info_log);
+      ralloc_free(sh);
+      return false;
    }
 
    reparent_ir(sh->ir, sh);
-   delete st;
 
-   return sh;
+   profile->sh = sh;
+   profile->st = st;
+   profile->read = rzalloc_array(sh, bool, profile->count);
+
+   return true;
+}
+
+static int
+compare_builtin_function(const void *key, const void *elem)
+{
+   return strcmp((const char *) key,
+                 ((const struct builtin_function *) elem)->name);
+}
+
+/**
+ * Read the bodies of all the signatures of one function, along with those
+ * of any built-in function they call.  Bodies are read with the IR reader
+ * told not to scan for prototypes, so that it skips any signature that
+ * isn't in this profile.
+ */
+static void
+read_builtin_body(struct builtin_profile *profile, const char *name)
+{
+   const struct builtin_function *f = (const struct builtin_function *)
+      bsearch(name, profile->functions, profile->count,
+              sizeof(profile->functions[0]), compare_builtin_function);
+   if (f == NULL)
+      return;
+
+   const unsigned index = f - profile->functions;
+   if (profile->read[index])
+      return;
+   profile->read[index] = true;
+
+   _mesa_glsl_read_ir(profile->st, profile->sh->ir, f->text, false);
+
+   if (profile->st->error) {
+      printf("error reading builtin: %.35s ...\\n", f->text);
+      printf("Info log:\\n%s\\n", profile->st->info_log);
+      profile->st->error = false;
+      return;
+   }
+
+   /* The body may call other built-ins, which need their bodies too. */
+   for (const char *call = strstr(f->text, "(call ");
+        call != NULL;
+        call = strstr(call, "(call ")) {
+      char callee[64];
+      unsigned len;
+
+      call += strlen("(call ");
+      len = strcspn(call, " ()\\n");
+      if (len >= sizeof(callee))
+         continue;
+
+      memcpy(callee, call, len);
+      callee[len] = '\\0';
+      read_builtin_body(profile, callee);
+   }
+
 }
 """
 
@@ -221,7 +307,12 @@ read_builtins(GLenum target, const char *protos, const char **functions, unsigne
 
     profiles = get_profile_list()
 
-    print 'static gl_shader *builtin_profiles[%d];' % len(profiles)
+    print 'static struct builtin_profile builtin_profiles[%d] = {' % len(profiles)
+    for (filename, profile) in profiles:
+        print '   { prototypes_for_' + profile + ','
+        print '     functions_for_' + profile + ','
+        print '     Elements(functions_for_' + profile + ') },'
+    print '};'
 
     print """
 void *builtin_mem_ctx = NULL;
@@ -229,30 +320,58 @@ void *builtin_mem_ctx = NULL;
 void
 _mesa_glsl_release_functions(void)
 {
+   _glthread_LOCK_MUTEX(builtins_lock);
+
    ralloc_free(builtin_mem_ctx);
    builtin_mem_ctx = NULL;
-   memset(builtin_profiles, 0, sizeof(builtin_profiles));
+   for (unsigned i = 0; i < Elements(builtin_profiles); i++) {
+      builtin_profiles[i].sh = NULL;
+      builtin_profiles[i].st = NULL;
+      builtin_profiles[i].read = NULL;
+   }
+
+   _glthread_UNLOCK_MUTEX(builtins_lock);
 }
 
 static void
 _mesa_read_profile(struct _mesa_glsl_parse_state *state,
-                   int profile_index,
-		   const char *prototypes,
-		   const char **functions,
-                   int count)
+                   int profile_index)
 {
-   gl_shader *sh = builtin_profiles[profile_index];
+   struct builtin_profile *profile = &builtin_profiles[profile_index];
 
-   if (sh == NULL) {
-      sh = read_builtins(GL_VERTEX_SHADER, prototypes, functions, count);
-      ralloc_steal(builtin_mem_ctx, sh);
-      builtin_profiles[profile_index] = sh;
+   if (profile->sh == NULL) {
+      if (!read_builtins(GL_VERTEX_SHADER, profile))
+         return;
+      ralloc_steal(builtin_mem_ctx, profile->sh);
    }
 
-   state->builtins_to_link[state->num_builtins_to_link] = sh;
+   state->builtins_to_link[state->num_builtins_to_link] = profile->sh;
    state->num_builtins_to_link++;
 }
 
+void
+_mesa_glsl_lock_builtins(void)
+{
+   _glthread_LOCK_MUTEX(builtins_lock);
+}
+
+void
+_mesa_glsl_unlock_builtins(void)
+{
+   _glthread_UNLOCK_MUTEX(builtins_lock);
+}
+
+void
+_mesa_glsl_read_builtin_function(gl_shader *sh, const char *name)
+{
+   for (unsigned i = 0; i < Elements(builtin_profiles); i++) {
+      if (builtin_profiles[i].sh == sh) {
+         read_builtin_body(&builtin_profiles[i], name);
+         break;
+      }
+   }
+}
+
 void
 _mesa_glsl_initialize_functions(struct _mesa_glsl_parse_state *state)
 {
@@ -260,10 +379,10 @@ _mesa_glsl_initialize_functions(struct _mesa_glsl_parse_state *state)
    if (state->num_builtins_to_link > 0)
       return;
 
-   if (builtin_mem_ctx == NULL) {
+   _glthread_LOCK_MUTEX(builtins_lock);
+
+   if (builtin_mem_ctx == NULL)
       builtin_mem_ctx = ralloc_context(NULL); // "GLSL built-in functions"
-      memset(&builtin_profiles, 0, sizeof(builtin_profiles));
-   }
 """
 
     i = 0
@@ -282,12 +401,10 @@ _mesa_glsl_initialize_functions(struct _mesa_glsl_parse_state *state)
             check += 'state->' + version + '_enable'
 
         print '   if (' + check + ') {'
-        print '      _mesa_read_profile(state, %d,' % i
-        print '                         prototypes_for_' + profile + ','
-        print '                         functions_for_' + profile + ','
-        print '                         Elements(functions_for_' + profile + '));'
+        print '      _mesa_read_profile(state, %d);' % i
         print '   }'
         print
         i = i + 1
+    print '   _glthread_UNLOCK_MUTEX(builtins_lock);'
     print '}'
 
@@ -116,6 +116,9 @@ static void
 _glcpp_parser_print_expanded_token_list (glcpp_parser_t *parser,
 					 token_list_t *list);
 
+static void
+_glcpp_parser_output (glcpp_parser_t *parser, const char *str, size_t length);
+
 static void
 _glcpp_parser_skip_stack_push_if (glcpp_parser_t *parser, YYLTYPE *loc,
 				  int condition);
@@ -184,11 +187,11 @@ input:
 
 line:
 	control_line {
-		ralloc_asprintf_rewrite_tail (&parser->output, &parser->output_length, "\n");
+		_glcpp_parser_output (parser, "\n", 1);
 	}
 |	text_line {
 		_glcpp_parser_print_expanded_token_list (parser, $1);
-		ralloc_asprintf_rewrite_tail (&parser->output, &parser->output_length, "\n");
+		_glcpp_parser_output (parser, "\n", 1);
 		ralloc_free ($1);
 	}
 |	expanded_line
@@ -218,6 +221,7 @@ control_line:
 		macro_t *macro = hash_table_find (parser->defines, $2);
 		if (macro) {
 			hash_table_remove (parser->defines, $2);
+			parser->defines_generation++;
 			ralloc_free (macro);
 		}
 		ralloc_free ($2);
@@ -303,8 +307,10 @@ control_line:
 	}
 |	HASH_VERSION integer_constant NEWLINE {
 		macro_t *macro = hash_table_find (parser->defines, "__VERSION__");
+		char *version;
 		if (macro) {
 			hash_table_remove (parser->defines, "__VERSION__");
+			parser->defines_generation++;
 			ralloc_free (macro);
 		}
 		add_builtin_define (parser, "__VERSION__", $2);
@@ -320,7 +326,9 @@ control_line:
 		if ($2 >= 130 || $2 == 100)
 			add_builtin_define (parser, "GL_FRAGMENT_PRECISION_HIGH", 1);
 
-		ralloc_asprintf_rewrite_tail (&parser->output, &parser->output_length, "#version %" PRIiMAX, $2);
+		version = ralloc_asprintf (parser, "#version %" PRIiMAX, $2);
+		_glcpp_parser_output (parser, version, strlen (version));
+		ralloc_free (version);
 	}
 |	HASH NEWLINE
 ;
@@ -902,9 +910,47 @@ _token_list_equal_ignoring_space (token_list_t *a, token_list_t *b)
 	return 1;
 }
 
+/* Return the text of a token that is neither a single character nor
+ * has a value, or NULL if 'type' isn't such a token. */
+static const char *
+_token_operator_string (int type)
+{
+	switch (type) {
+	case SPACE:
+		return " ";
+	case LEFT_SHIFT:
+		return "<<";
+	case RIGHT_SHIFT:
+		return ">>";
+	case LESS_OR_EQUAL:
+		return "<=";
+	case GREATER_OR_EQUAL:
+		return ">=";
+	case EQUAL:
+		return "==";
+	case NOT_EQUAL:
+		return "!=";
+	case AND:
+		return "&&";
+	case OR:
+		return "||";
+	case PASTE:
+		return "##";
+	case COMMA_FINAL:
+		return ",";
+	case PLACEHOLDER:
+		/* Nothing to print. */
+		return "";
+	default:
+		return NULL;
+	}
+}
+
 static void
 _token_print (char **out, size_t *len, token_t *token)
 {
+	const char *str;
+
 	if (token->type < 256) {
 		ralloc_asprintf_rewrite_tail (out, len, "%c", token->type);
 		return;
@@ -919,44 +965,72 @@ _token_print (char **out, size_t *len, token_t *token)
 	case OTHER:
 		ralloc_asprintf_rewrite_tail (out, len, "%s", token->value.str);
 		break;
-	case SPACE:
-		ralloc_asprintf_rewrite_tail (out, len, " ");
-		break;
-	case LEFT_SHIFT:
-		ralloc_asprintf_rewrite_tail (out, len, "<<");
-		break;
-	case RIGHT_SHIFT:
-		ralloc_asprintf_rewrite_tail (out, len, ">>");
-		break;
-	case LESS_OR_EQUAL:
-		ralloc_asprintf_rewrite_tail (out, len, "<=");
-		break;
-	case GREATER_OR_EQUAL:
-		ralloc_asprintf_rewrite_tail (out, len, ">=");
-		break;
-	case EQUAL:
-		ralloc_asprintf_rewrite_tail (out, len, "==");
-		break;
-	case NOT_EQUAL:
-		ralloc_asprintf_rewrite_tail (out, len, "!=");
-		break;
-	case AND:
-		ralloc_asprintf_rewrite_tail (out, len, "&&");
-		break;
-	case OR:
-		ralloc_asprintf_rewrite_tail (out, len, "||");
-		break;
-	case PASTE:
-		ralloc_asprintf_rewrite_tail (out, len, "##");
+	default:
+		str = _token_operator_string (token->type);
+		if (str == NULL) {
+			assert(!"Error: Don't know how to print token.");
+			break;
+		}
+		ralloc_asprintf_rewrite_tail (out, len, "%s", str);
 		break;
-	case COMMA_FINAL:
-		ralloc_asprintf_rewrite_tail (out, len, ",");
+	}
+}
+
+/* Append to the parser's output. Unlike the ralloc string functions,
+ * this grows the buffer geometrically, since the output is built up
+ * a token at a time and reallocating it for every token makes
+ * preprocessing quadratic in the size of the shader. */
+void
+_glcpp_parser_output (glcpp_parser_t *parser, const char *str, size_t length)
+{
+	size_t needed = parser->output_length + length + 1;
+
+	if (needed > parser->output_size) {
+		size_t size = parser->output_size * 2;
+
+		if (size < needed)
+			size = needed;
+
+		parser->output = reralloc (parser, parser->output, char, size);
+		parser->output_size = size;
+	}
+
+	memcpy (parser->output + parser->output_length, str, length);
+	parser->output_length += length;
+	parser->output[parser->output_length] = '\0';
+}
+
+static void
+_glcpp_parser_output_token (glcpp_parser_t *parser, token_t *token)
+{
+	const char *str;
+	char c;
+
+	if (token->type < 256) {
+		c = token->type;
+		_glcpp_parser_output (parser, &c, 1);
+		return;
+	}
+
+	switch (token->type) {
+	case INTEGER:
+		str = ralloc_asprintf (parser, "%" PRIiMAX, token->value.ival);
+		_glcpp_parser_output (parser, str, strlen (str));
+		ralloc_free ((char *) str);
 		break;
-	case PLACEHOLDER:
-		/* Nothing to print. */
+	case IDENTIFIER:
+	case INTEGER_STRING:
+	case OTHER:
+		str = token->value.str;
+		_glcpp_parser_output (parser, str, strlen (str));
 		break;
 	default:
-		assert(!"Error: Don't know how to print token.");
+		str = _token_operator_string (token->type);
+		if (str == NULL) {
+			assert(!"Error: Don't know how to print token.");
+			break;
+		}
+		_glcpp_parser_output (parser, str, strlen (str));
 		break;
 	}
 }
@@ -1058,7 +1132,7 @@ _token_list_print (glcpp_parser_t *parser, token_list_t *list)
 		return;
 
 	for (node = list->head; node; node = node->next)
-		_token_print (&parser->output, &parser->output_length, node->token);
+		_glcpp_parser_output_token (parser, node->token);
 }
 
 void
@@ -1091,6 +1165,7 @@ glcpp_parser_create (const struct gl_extensions *extensions, int api)
 	glcpp_lex_init_extra (parser, &parser->scanner);
 	parser->defines = hash_table_ctor (32, hash_table_string_hash,
 					   hash_table_string_compare);
+	parser->defines_generation = 1;
 	parser->active = NULL;
 	parser->lexing_if = 0;
 	parser->space_tokens = 1;
@@ -1105,6 +1180,7 @@ glcpp_parser_create (const struct gl_extensions *extensions, int api)
 
 	parser->output = ralloc_strdup(parser, "");
 	parser->output_length = 0;
+	parser->output_size = 1;
 	parser->info_log = ralloc_strdup(parser, "");
 	parser->info_log_length = 0;
 	parser->error = 0;
@@ -1438,6 +1514,68 @@ _glcpp_parser_expand_function (glcpp_parser_t *parser,
 	return substituted;
 }
 
+/* Compute the complete expansion of the object-like macro 'macro',
+ * as used by 'token', on its own and store it in macro->expansion.
+ *
+ * Shaders commonly use the same object-like macros over and over, so
+ * this saves copying and rescanning their replacement lists for every
+ * use. The expansion is only kept if it is the same as what expanding
+ * the macro in place would give, that is, if expanding it raised no
+ * errors (which might not be raised in place, as for unbalanced
+ * parentheses closed by the tokens following the use) and left no
+ * macro names, (such as a function-like macro whose arguments follow
+ * the use). It is only valid as long as no macro is defined or
+ * undefined, which defines_generation tracks.
+ */
+static void
+_glcpp_parser_cache_expansion (glcpp_parser_t *parser, macro_t *macro,
+			       token_t *token)
+{
+	token_list_t *expansion;
+	token_node_t *node;
+	size_t info_log_end = strlen (parser->info_log);
+	size_t info_log_length = parser->info_log_length;
+	int error = parser->error;
+
+	ralloc_free (macro->expansion);
+	macro->expansion = NULL;
+	macro->expansion_generation = parser->defines_generation;
+
+	expansion = _token_list_create (parser);
+	_token_list_append (expansion, token);
+
+	parser->error = 0;
+	_glcpp_parser_expand_token_list (parser, expansion);
+
+	/* Drop any diagnostics; they'll be raised again (or not) when
+	 * the macro is expanded in place. */
+	if (parser->error) {
+		parser->info_log[info_log_end] = '\0';
+		parser->info_log_length = info_log_length;
+		parser->error = error;
+		ralloc_free (expansion);
+		return;
+	}
+	parser->error = error;
+
+	if (expansion->head == NULL) {
+		ralloc_free (expansion);
+		return;
+	}
+
+	for (node = expansion->head; node; node = node->next) {
+		if (node->token->type == IDENTIFIER &&
+		    hash_table_find (parser->defines, node->token->value.str))
+		{
+			ralloc_free (expansion);
+			return;
+		}
+	}
+
+	ralloc_steal (macro, expansion);
+	macro->expansion = expansion;
+}
+
 /* Compute the complete expansion of node, (and subsequent nodes after
  * 'node' in the case that 'node' is a function-like macro and
  * subsequent nodes are arguments).
@@ -1452,16 +1590,25 @@ _glcpp_parser_expand_function (glcpp_parser_t *parser,
  *
  *	As the token of the closing right parenthesis in the case of
  *	function-like macro expansion.
+ *
+ * *complete is set if the returned list is already completely
+ * expanded, (taken from the cache of object-like macro expansions),
+ * and so need not be rescanned. Its nodes are then allocated off of
+ * 'ctx'.
  */
 static token_list_t *
 _glcpp_parser_expand_node (glcpp_parser_t *parser,
 			   token_node_t *node,
-			   token_node_t **last)
+			   token_node_t **last,
+			   int *complete,
+			   void *ctx)
 {
 	token_t *token = node->token;
 	const char *identifier;
 	macro_t *macro;
 
+	*complete = 0;
+
 	/* We only expand identifiers */
 	if (token->type != IDENTIFIER) {
 		/* We change any COMMA into a COMMA_FINAL to prevent
@@ -1506,6 +1653,28 @@ _glcpp_parser_expand_node (glcpp_parser_t *parser,
 		token_list_t *replacement;
 		*last = node;
 
+		/* The cached expansion was computed with no macros
+		 * active, so it can only be used in the same state. */
+		if (parser->active == NULL) {
+			token_node_t *n;
+
+			if (macro->expansion_generation !=
+			    parser->defines_generation)
+			{
+				_glcpp_parser_cache_expansion (parser, macro,
+							       token);
+			}
+
+			if (macro->expansion) {
+				replacement = _token_list_create (ctx);
+				for (n = macro->expansion->head; n; n = n->next)
+					_token_list_append (replacement,
+							    n->token);
+				*complete = 1;
+				return replacement;
+			}
+		}
+
 		/* Replace a macro defined as empty with a SPACE token. */
 		if (macro->replacements == NULL)
 			return _token_list_create_with_one_space (parser);
@@ -1584,6 +1753,7 @@ _glcpp_parser_expand_token_list (glcpp_parser_t *parser,
 	token_node_t *node, *last = NULL;
 	token_list_t *expansion;
 	active_list_t *active_initial = parser->active;
+	int complete;
 
 	if (list == NULL)
 		return;
@@ -1598,8 +1768,20 @@ _glcpp_parser_expand_token_list (glcpp_parser_t *parser,
 		while (parser->active && parser->active->marker == node)
 			_parser_active_list_pop (parser);
 
-		expansion = _glcpp_parser_expand_node (parser, node, &last);
-		if (expansion) {
+		expansion = _glcpp_parser_expand_node (parser, node, &last,
+						       &complete, list);
+		if (expansion && complete) {
+			/* Splice in the expansion, which replaces just
+			 * 'node', and continue after it. */
+			if (node_prev)
+				node_prev->next = expansion->head;
+			else
+				list->head = expansion->head;
+			expansion->tail->next = node->next;
+			if (node == list->tail)
+				list->tail = expansion->tail;
+			node_prev = expansion->tail;
+		} else if (expansion) {
 			token_node_t *n;
 
 			for (n = node; n != last->next; n = n->next)
@@ -1708,6 +1890,8 @@ _define_object_macro (glcpp_parser_t *parser,
 	macro->parameters = NULL;
 	macro->identifier = ralloc_strdup (macro, identifier);
 	macro->replacements = replacements;
+	macro->expansion = NULL;
+	macro->expansion_generation = 0;
 	ralloc_steal (macro, replacements);
 
 	previous = hash_table_find (parser->defines, identifier);
@@ -1721,6 +1905,7 @@ _define_object_macro (glcpp_parser_t *parser,
 	}
 
 	hash_table_insert (parser->defines, macro, identifier);
+	parser->defines_generation++;
 }
 
 void
@@ -1742,6 +1927,8 @@ _define_function_macro (glcpp_parser_t *parser,
 	macro->parameters = parameters;
 	macro->identifier = ralloc_strdup (macro, identifier);
 	macro->replacements = replacements;
+	macro->expansion = NULL;
+	macro->expansion_generation = 0;
 	previous = hash_table_find (parser->defines, identifier);
 	if (previous) {
 		if (_macro_equal (macro, previous)) {
@@ -1753,6 +1940,7 @@ _define_function_macro (glcpp_parser_t *parser,
 	}
 
 	hash_table_insert (parser->defines, macro, identifier);
+	parser->defines_generation++;
 }
 
 static int
@@ -134,6 +134,12 @@ typedef struct {
 	string_list_t *parameters;
 	const char *identifier;
 	token_list_t *replacements;
+
+	/* For object-like macros, the complete expansion of the macro
+	 * as of the parser's defines_generation in expansion_generation,
+	 * or NULL. */
+	token_list_t *expansion;
+	unsigned expansion_generation;
 } macro_t;
 
 typedef struct expansion_node {
@@ -163,6 +169,7 @@ typedef struct active_list {
 struct glcpp_parser {
 	yyscan_t scanner;
 	struct hash_table *defines;
+	unsigned defines_generation;
 	active_list_t *active;
 	int lexing_if;
 	int space_tokens;
@@ -175,6 +182,7 @@ struct glcpp_parser {
 	char *output;
 	char *info_log;
 	size_t output_length;
+	size_t output_size;
 	size_t info_log_length;
 	int error;
 };
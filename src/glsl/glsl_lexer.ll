@@ -478,8 +478,8 @@ usamplerBuffer	KEYWORD(140, 140, USAMPLERBUFFER);
 
 [_a-zA-Z][_a-zA-Z0-9]*	{
 			    struct _mesa_glsl_parse_state *state = yyextra;
-			    void *ctx = state;	
-			    yylval->identifier = ralloc_strdup(ctx, yytext);
+			    yylval->identifier =
+			       ralloc_arena_strdup(state->ast_arena, yytext);
 			    return classify_identifier(state, yytext);
 			}
 
@@ -354,35 +354,35 @@ variable_identifier:
 primary_expression:
 	variable_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_identifier, NULL, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.identifier = $1;
 	}
 	| INTCONSTANT
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_int_constant, NULL, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.int_constant = $1;
 	}
 	| UINTCONSTANT
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_uint_constant, NULL, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.uint_constant = $1;
 	}
 	| FLOATCONSTANT
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_float_constant, NULL, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.float_constant = $1;
 	}
 	| BOOLCONSTANT
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_bool_constant, NULL, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.bool_constant = $1;
@@ -397,7 +397,7 @@ postfix_expression:
 	primary_expression
 	| postfix_expression '[' integer_expression ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_array_index, $1, $3, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -407,20 +407,20 @@ postfix_expression:
 	}
 	| postfix_expression '.' any_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_field_selection, $1, NULL, NULL);
 	   $$->set_location(yylloc);
 	   $$->primary_expression.identifier = $3;
 	}
 	| postfix_expression INC_OP
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_post_inc, $1, NULL, NULL);
 	   $$->set_location(yylloc);
 	}
 	| postfix_expression DEC_OP
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_post_dec, $1, NULL, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -438,7 +438,7 @@ function_call_or_method:
 	function_call_generic
 	| postfix_expression '.' method_call_generic
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_field_selection, $1, $3, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -479,20 +479,20 @@ function_call_header:
 function_identifier:
 	type_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_function_expression($1);
 	   $$->set_location(yylloc);
    	}
 	| variable_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_expression *callee = new(ctx) ast_expression($1);
 	   $$ = new(ctx) ast_function_expression(callee);
 	   $$->set_location(yylloc);
    	}
 	| FIELD_SELECTION
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_expression *callee = new(ctx) ast_expression($1);
 	   $$ = new(ctx) ast_function_expression(callee);
 	   $$->set_location(yylloc);
@@ -530,7 +530,7 @@ method_call_header_with_parameters:
 method_call_header:
 	variable_identifier '('
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_expression *callee = new(ctx) ast_expression($1);
 	   $$ = new(ctx) ast_function_expression(callee);
 	   $$->set_location(yylloc);
@@ -542,19 +542,19 @@ unary_expression:
 	postfix_expression
 	| INC_OP unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_pre_inc, $2, NULL, NULL);
 	   $$->set_location(yylloc);
 	}
 	| DEC_OP unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_pre_dec, $2, NULL, NULL);
 	   $$->set_location(yylloc);
 	}
 	| unary_operator unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression($1, $2, NULL, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -572,19 +572,19 @@ multiplicative_expression:
 	unary_expression
 	| multiplicative_expression '*' unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_mul, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| multiplicative_expression '/' unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_div, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| multiplicative_expression '%' unary_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_mod, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -594,13 +594,13 @@ additive_expression:
 	multiplicative_expression
 	| additive_expression '+' multiplicative_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_add, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| additive_expression '-' multiplicative_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_sub, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -610,13 +610,13 @@ shift_expression:
 	additive_expression
 	| shift_expression LEFT_OP additive_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_lshift, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| shift_expression RIGHT_OP additive_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_rshift, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -626,25 +626,25 @@ relational_expression:
 	shift_expression
 	| relational_expression '<' shift_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_less, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| relational_expression '>' shift_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_greater, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| relational_expression LE_OP shift_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_lequal, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| relational_expression GE_OP shift_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_gequal, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -654,13 +654,13 @@ equality_expression:
 	relational_expression
 	| equality_expression EQ_OP relational_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_equal, $1, $3);
 	   $$->set_location(yylloc);
 	}
 	| equality_expression NE_OP relational_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_nequal, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -670,7 +670,7 @@ and_expression:
 	equality_expression
 	| and_expression '&' equality_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_bit_and, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -680,7 +680,7 @@ exclusive_or_expression:
 	and_expression
 	| exclusive_or_expression '^' and_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_bit_xor, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -690,7 +690,7 @@ inclusive_or_expression:
 	exclusive_or_expression
 	| inclusive_or_expression '|' exclusive_or_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_bit_or, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -700,7 +700,7 @@ logical_and_expression:
 	inclusive_or_expression
 	| logical_and_expression AND_OP inclusive_or_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_logic_and, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -710,7 +710,7 @@ logical_xor_expression:
 	logical_and_expression
 	| logical_xor_expression XOR_OP logical_and_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_logic_xor, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -720,7 +720,7 @@ logical_or_expression:
 	logical_xor_expression
 	| logical_or_expression OR_OP logical_xor_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_bin(ast_logic_or, $1, $3);
 	   $$->set_location(yylloc);
 	}
@@ -730,7 +730,7 @@ conditional_expression:
 	logical_or_expression
 	| logical_or_expression '?' expression ':' assignment_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression(ast_conditional, $1, $3, $5);
 	   $$->set_location(yylloc);
 	}
@@ -740,7 +740,7 @@ assignment_expression:
 	conditional_expression
 	| unary_expression assignment_operator assignment_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression($2, $1, $3, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -767,7 +767,7 @@ expression:
 	}
 	| expression ',' assignment_expression
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   if ($1->oper != ast_sequence) {
 	      $$ = new(ctx) ast_expression(ast_sequence, NULL, NULL, NULL);
 	      $$->set_location(yylloc);
@@ -827,7 +827,7 @@ function_header_with_parameters:
 function_header:
 	fully_specified_type variable_identifier '('
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_function();
 	   $$->set_location(yylloc);
 	   $$->return_type = $1;
@@ -841,7 +841,7 @@ function_header:
 parameter_declarator:
 	type_specifier any_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_parameter_declarator();
 	   $$->set_location(yylloc);
 	   $$->type = new(ctx) ast_fully_specified_type();
@@ -851,7 +851,7 @@ parameter_declarator:
 	}
 	| type_specifier any_identifier '[' constant_expression ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_parameter_declarator();
 	   $$->set_location(yylloc);
 	   $$->type = new(ctx) ast_fully_specified_type();
@@ -878,7 +878,7 @@ parameter_declaration:
 	}
 	| parameter_type_qualifier parameter_qualifier parameter_type_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $1.flags.i |= $2.flags.i;
 
 	   $$ = new(ctx) ast_parameter_declarator();
@@ -889,7 +889,7 @@ parameter_declaration:
 	}
 	| parameter_qualifier parameter_type_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_parameter_declarator();
 	   $$->set_location(yylloc);
 	   $$->type = new(ctx) ast_fully_specified_type();
@@ -929,7 +929,7 @@ init_declarator_list:
 	single_declaration
 	| init_declarator_list ',' any_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, false, NULL, NULL);
 	   decl->set_location(yylloc);
 
@@ -939,7 +939,7 @@ init_declarator_list:
 	}
 	| init_declarator_list ',' any_identifier '[' ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, true, NULL, NULL);
 	   decl->set_location(yylloc);
 
@@ -949,7 +949,7 @@ init_declarator_list:
 	}
 	| init_declarator_list ',' any_identifier '[' constant_expression ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, true, $5, NULL);
 	   decl->set_location(yylloc);
 
@@ -959,7 +959,7 @@ init_declarator_list:
 	}
 	| init_declarator_list ',' any_identifier '[' ']' '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, true, NULL, $7);
 	   decl->set_location(yylloc);
 
@@ -969,7 +969,7 @@ init_declarator_list:
 	}
 	| init_declarator_list ',' any_identifier '[' constant_expression ']' '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, true, $5, $8);
 	   decl->set_location(yylloc);
 
@@ -979,7 +979,7 @@ init_declarator_list:
 	}
 	| init_declarator_list ',' any_identifier '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($3, false, NULL, $5);
 	   decl->set_location(yylloc);
 
@@ -993,14 +993,14 @@ init_declarator_list:
 single_declaration:
 	fully_specified_type
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   /* Empty declaration list is valid. */
 	   $$ = new(ctx) ast_declarator_list($1);
 	   $$->set_location(yylloc);
 	}
 	| fully_specified_type any_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, false, NULL, NULL);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1009,7 +1009,7 @@ single_declaration:
 	}
 	| fully_specified_type any_identifier '[' ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, true, NULL, NULL);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1018,7 +1018,7 @@ single_declaration:
 	}
 	| fully_specified_type any_identifier '[' constant_expression ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, true, $4, NULL);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1027,7 +1027,7 @@ single_declaration:
 	}
 	| fully_specified_type any_identifier '[' ']' '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, true, NULL, $6);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1036,7 +1036,7 @@ single_declaration:
 	}
 	| fully_specified_type any_identifier '[' constant_expression ']' '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, true, $4, $7);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1045,7 +1045,7 @@ single_declaration:
 	}
 	| fully_specified_type any_identifier '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, false, NULL, $4);
 
 	   $$ = new(ctx) ast_declarator_list($1);
@@ -1054,7 +1054,7 @@ single_declaration:
 	}
 	| INVARIANT variable_identifier // Vertex only.
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, false, NULL, NULL);
 
 	   $$ = new(ctx) ast_declarator_list(NULL);
@@ -1068,14 +1068,14 @@ single_declaration:
 fully_specified_type:
 	type_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_fully_specified_type();
 	   $$->set_location(yylloc);
 	   $$->specifier = $1;
 	}
 	| type_qualifier type_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_fully_specified_type();
 	   $$->set_location(yylloc);
 	   $$->qualifier = $1;
@@ -1368,19 +1368,19 @@ type_specifier_no_prec:
 type_specifier_nonarray:
 	basic_type_specifier_nonarray
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_type_specifier($1);
 	   $$->set_location(yylloc);
 	}
 	| struct_specifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_type_specifier($1);
 	   $$->set_location(yylloc);
 	}
 	| TYPE_IDENTIFIER
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_type_specifier($1);
 	   $$->set_location(yylloc);
 	}
@@ -1482,15 +1482,15 @@ precision_qualifier:
 struct_specifier:
 	STRUCT any_identifier '{' struct_declaration_list '}'
 	{
-	   void *ctx = state;
-	   $$ = new(ctx) ast_struct_specifier($2, $4);
+	   void *ctx = state->ast_arena;
+	   $$ = new(ctx) ast_struct_specifier(ctx, $2, $4);
 	   $$->set_location(yylloc);
 	   state->symbols->add_type($2, glsl_type::void_type);
 	}
 	| STRUCT '{' struct_declaration_list '}'
 	{
-	   void *ctx = state;
-	   $$ = new(ctx) ast_struct_specifier(NULL, $3);
+	   void *ctx = state->ast_arena;
+	   $$ = new(ctx) ast_struct_specifier(ctx, NULL, $3);
 	   $$->set_location(yylloc);
 	}
 	;
@@ -1511,7 +1511,7 @@ struct_declaration_list:
 struct_declaration:
 	type_specifier struct_declarator_list ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_fully_specified_type *type = new(ctx) ast_fully_specified_type();
 	   type->set_location(yylloc);
 
@@ -1539,14 +1539,14 @@ struct_declarator_list:
 struct_declarator:
 	any_identifier
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_declaration($1, false, NULL, NULL);
 	   $$->set_location(yylloc);
 	   state->symbols->add_variable(new(state) ir_variable(NULL, $1, ir_var_auto));
 	}
 	| any_identifier '[' constant_expression ']'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_declaration($1, true, $3, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -1579,7 +1579,7 @@ simple_statement:
 compound_statement:
 	'{' '}'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_compound_statement(true, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -1589,7 +1589,7 @@ compound_statement:
 	}
 	statement_list '}'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_compound_statement(true, $3);
 	   $$->set_location(yylloc);
 	   state->symbols->pop_scope();
@@ -1604,13 +1604,13 @@ statement_no_new_scope:
 compound_statement_no_new_scope:
 	'{' '}'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_compound_statement(false, NULL);
 	   $$->set_location(yylloc);
 	}
 	| '{' statement_list '}'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_compound_statement(false, $2);
 	   $$->set_location(yylloc);
 	}
@@ -1641,13 +1641,13 @@ statement_list:
 expression_statement:
 	';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_statement(NULL);
 	   $$->set_location(yylloc);
 	}
 	| expression ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_expression_statement($1);
 	   $$->set_location(yylloc);
 	}
@@ -1682,7 +1682,7 @@ condition:
 	}
 	| fully_specified_type any_identifier '=' initializer
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   ast_declaration *decl = new(ctx) ast_declaration($2, false, NULL, $4);
 	   ast_declarator_list *declarator = new(ctx) ast_declarator_list($1);
 	   decl->set_location(yylloc);
@@ -1782,21 +1782,21 @@ case_statement_list:
 iteration_statement:
 	WHILE '(' condition ')' statement_no_new_scope
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_while,
 	   					    NULL, $3, NULL, $5);
 	   $$->set_location(yylloc);
 	}
 	| DO statement WHILE '(' expression ')' ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_do_while,
 						    NULL, $5, NULL, $2);
 	   $$->set_location(yylloc);
 	}
 	| FOR '(' for_init_statement for_rest_statement ')' statement_no_new_scope
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_for,
 						    $3, $4.cond, $4.rest, $6);
 	   $$->set_location(yylloc);
@@ -1833,31 +1833,31 @@ for_rest_statement:
 jump_statement:
 	CONTINUE ';' 
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_jump_statement(ast_jump_statement::ast_continue, NULL);
 	   $$->set_location(yylloc);
 	}
 	| BREAK ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_jump_statement(ast_jump_statement::ast_break, NULL);
 	   $$->set_location(yylloc);
 	}
 	| RETURN ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_jump_statement(ast_jump_statement::ast_return, NULL);
 	   $$->set_location(yylloc);
 	}
 	| RETURN expression ';'
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_jump_statement(ast_jump_statement::ast_return, $2);
 	   $$->set_location(yylloc);
 	}
 	| DISCARD ';' // Fragment shader only.
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_jump_statement(ast_jump_statement::ast_discard, NULL);
 	   $$->set_location(yylloc);
 	}
@@ -1872,7 +1872,7 @@ external_declaration:
 function_definition:
 	function_prototype compound_statement_no_new_scope
 	{
-	   void *ctx = state;
+	   void *ctx = state->ast_arena;
 	   $$ = new(ctx) ast_function_definition();
 	   $$->set_location(yylloc);
 	   $$->prototype = $1;
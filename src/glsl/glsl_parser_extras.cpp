@@ -27,6 +27,7 @@
 
 extern "C" {
 #include "main/core.h" /* for struct gl_context */
+#include "glapi/glthread.h"
 }
 
 #include "ralloc.h"
@@ -34,7 +35,6 @@ extern "C" {
 #include "glsl_parser_extras.h"
 #include "glsl_parser.h"
 #include "ir_optimization.h"
-#include "loop_analysis.h"
 
 _mesa_glsl_parse_state::_mesa_glsl_parse_state(struct gl_context *ctx,
 					       GLenum target, void *mem_ctx)
@@ -47,6 +47,7 @@ _mesa_glsl_parse_state::_mesa_glsl_parse_state(struct gl_context *ctx,
 
    this->scanner = NULL;
    this->translation_unit.make_empty();
+   this->ast_arena = ralloc_arena_context(this);
    this->symbols = new(mem_ctx) glsl_symbol_table;
    this->info_log = ralloc_strdup(mem_ctx, "");
    this->error = false;
@@ -979,82 +980,26 @@ ast_struct_specifier::print(void) const
 }
 
 
-ast_struct_specifier::ast_struct_specifier(const char *identifier,
+ast_struct_specifier::ast_struct_specifier(void *arena,
+					   const char *identifier,
 					   ast_node *declarator_list)
 {
    if (identifier == NULL) {
+      /* The counter is shared by shaders compiling on other threads. */
+      _glthread_DECLARE_STATIC_MUTEX(anon_lock);
       static unsigned anon_count = 1;
-      identifier = ralloc_asprintf(this, "#anon_struct_%04x", anon_count);
-      anon_count++;
-   }
-   name = identifier;
-   this->declarations.push_degenerate_list_at_head(&declarator_list->link);
-}
-
-/**
- * Do the set of common optimizations passes
- *
- * \param ir                          List of instructions to be optimized
- * \param linked                      Is the shader linked?  This enables
- *                                    optimizations passes that remove code at
- *                                    global scope and could cause linking to
- *                                    fail.
- * \param uniform_locations_assigned  Have locations already been assigned for
- *                                    uniforms?  This prevents the declarations
- *                                    of unused uniforms from being removed.
- *                                    The setting of this flag only matters if
- *                                    \c linked is \c true.
- * \param max_unroll_iterations       Maximum number of loop iterations to be
- *                                    unrolled.  Setting to 0 forces all loops
- *                                    to be unrolled.
- */
-bool
-do_common_optimization(exec_list *ir, bool linked,
-		       bool uniform_locations_assigned,
-		       unsigned max_unroll_iterations)
-{
-   GLboolean progress = GL_FALSE;
+      unsigned count;
+      char anon_name[32];
 
-   progress = lower_instructions(ir, SUB_TO_ADD_NEG) || progress;
+      _glthread_LOCK_MUTEX(anon_lock);
+      count = anon_count++;
+      _glthread_UNLOCK_MUTEX(anon_lock);
 
-   if (linked) {
-      progress = do_function_inlining(ir) || progress;
-      progress = do_dead_functions(ir) || progress;
-      progress = do_structure_splitting(ir) || progress;
-   }
-   progress = do_if_simplification(ir) || progress;
-   progress = do_discard_simplification(ir) || progress;
-   progress = do_copy_propagation(ir) || progress;
-   progress = do_copy_propagation_elements(ir) || progress;
-   if (linked)
-      progress = do_dead_code(ir, uniform_locations_assigned) || progress;
-   else
-      progress = do_dead_code_unlinked(ir) || progress;
-   progress = do_dead_code_local(ir) || progress;
-   progress = do_tree_grafting(ir) || progress;
-   progress = do_constant_propagation(ir) || progress;
-   if (linked)
-      progress = do_constant_variable(ir) || progress;
-   else
-      progress = do_constant_variable_unlinked(ir) || progress;
-   progress = do_constant_folding(ir) || progress;
-   progress = do_algebraic(ir) || progress;
-   progress = do_lower_jumps(ir) || progress;
-   progress = do_vec_index_to_swizzle(ir) || progress;
-   progress = do_swizzle_swizzle(ir) || progress;
-   progress = do_noop_swizzle(ir) || progress;
-
-   progress = optimize_split_arrays(ir, linked) || progress;
-   progress = optimize_redundant_jumps(ir) || progress;
-
-   loop_state *ls = analyze_loop_variables(ir);
-   if (ls->loop_found) {
-      progress = set_loop_controls(ir, ls) || progress;
-      progress = unroll_loops(ir, ls, max_unroll_iterations) || progress;
+      snprintf(anon_name, sizeof(anon_name), "#anon_struct_%04x", count);
+      identifier = ralloc_arena_strdup(arena, anon_name);
    }
-   delete ls;
-
-   return progress;
+   name = identifier;
+   this->declarations.push_degenerate_list_at_head(&declarator_list->link);
 }
 
 extern "C" {
@@ -81,6 +81,12 @@ struct _mesa_glsl_parse_state {
    exec_list translation_unit;
    glsl_symbol_table *symbols;
 
+   /**
+    * Arena holding the AST and the identifier strings of the lexer, which
+    * are all freed with the parse state.
+    */
+   void *ast_arena;
+
    bool es_shader;
    unsigned language_version;
    const char *version_string;
@@ -226,6 +226,14 @@ struct glsl_type {
 					       unsigned num_fields,
 					       const char *name);
 
+   /**
+    * Get the built-in type with the specified name
+    *
+    * Unlike a symbol table lookup, this ignores the language version and the
+    * enabled extensions.  \c NULL is returned if there is no such type.
+    */
+   static const glsl_type *get_builtin_instance(const char *name);
+
    /**
     * Query the total number of scalars that make up a scalar, vector or matrix
     */
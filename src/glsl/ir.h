@@ -1688,6 +1688,12 @@ visit_exec_list(exec_list *list, ir_visitor *visitor);
  */
 void validate_ir_tree(exec_list *instructions);
 
+/**
+ * Like \c validate_ir_tree, but returns \c false on a violation instead of
+ * aborting, for IR which doesn't come from the compiler
+ */
+bool is_valid_ir_tree(exec_list *instructions);
+
 struct _mesa_glsl_parse_state;
 struct gl_shader_program;
 
@@ -1733,6 +1739,25 @@ _mesa_glsl_initialize_functions(_mesa_glsl_parse_state *state);
 extern void
 _mesa_glsl_release_functions(void);
 
+/**
+ * Lock the shaders in _mesa_glsl_parse_state::builtins_to_link against
+ * other threads.  The lock must be held to look at those shaders.
+ */
+extern void
+_mesa_glsl_lock_builtins(void);
+
+extern void
+_mesa_glsl_unlock_builtins(void);
+
+/**
+ * Read the body of a built-in function found in one of the shaders in
+ * _mesa_glsl_parse_state::builtins_to_link, if it hasn't been already.
+ *
+ * The caller must hold the lock taken by _mesa_glsl_lock_builtins().
+ */
+extern void
+_mesa_glsl_read_builtin_function(struct gl_shader *sh, const char *name);
+
 extern void
 reparent_ir(exec_list *list, void *mem_ctx);
 
@@ -40,6 +40,34 @@
 bool do_common_optimization(exec_list *ir, bool linked,
 			    bool uniform_locations_assigned,
 			    unsigned max_unroll_iterations);
+bool do_common_optimization_loop(exec_list *ir, bool linked,
+				 bool uniform_locations_assigned,
+				 unsigned max_unroll_iterations);
+
+/**
+ * Counters for one pass run by do_common_optimization_loop().
+ */
+struct optimization_pass_stats {
+   const char *name;
+   unsigned runs;      /**< Runs on a function body or on the whole program */
+   unsigned skipped;   /**< Runs avoided because nothing changed since */
+   unsigned progress;  /**< Runs that made progress */
+   double ms;          /**< CPU time spent in the pass */
+};
+
+struct optimization_stats {
+   unsigned rounds;
+   unsigned num_passes;
+   struct optimization_pass_stats pass[32];
+};
+
+/**
+ * If non-NULL, do_common_optimization_loop() accumulates its statistics
+ * here.  Only meant for single-threaded tools like the standalone compiler.
+ */
+extern struct optimization_stats *_mesa_glsl_optimization_stats;
+
+void _mesa_print_optimization_stats(const struct optimization_stats *stats);
 
 bool do_algebraic(exec_list *instructions);
 bool do_constant_folding(exec_list *instructions);
@@ -31,6 +31,10 @@
  * in the ir tree.  ir_variable does appear multiple times: Once as a
  * declaration in an exec_list, and multiple times as the endpoint of
  * a dereference chain.
+ *
+ * validate_ir_tree() aborts on the first violation, for checking the
+ * compiler's own IR.  is_valid_ir_tree() instead reports failure, for IR
+ * which comes from outside, like program binaries.
  */
 
 #include "ir.h"
@@ -38,17 +42,32 @@
 #include "program/hash_table.h"
 #include "glsl_types.h"
 
+/**
+ * Check an invariant of an expression.  Like assert() for validate_ir_tree(),
+ * while is_valid_ir_tree() always checks it and stops at a violation.
+ */
+#define validate_assert(cond)						\
+   do {									\
+      if (!this->fatal && !(cond)) {					\
+	 this->failed = true;						\
+	 return visit_stop;						\
+      }									\
+      assert(cond);							\
+   } while (0)
+
 class ir_validate : public ir_hierarchical_visitor {
 public:
-   ir_validate()
+   ir_validate(bool fatal)
    {
       this->ht = hash_table_ctor(0, hash_table_pointer_hash,
 				 hash_table_pointer_compare);
 
       this->current_function = NULL;
+      this->fatal = fatal;
+      this->failed = false;
 
       this->callback = ir_validate::validate_ir;
-      this->data = ht;
+      this->data = this;
    }
 
    ~ir_validate()
@@ -74,9 +93,27 @@ public:
 
    static void validate_ir(ir_instruction *ir, void *data);
 
+   /**
+    * Report a violation: abort if \c fatal, otherwise stop the validation.
+    */
+   ir_visitor_status fail()
+   {
+      if (this->fatal)
+	 abort();
+
+      this->failed = true;
+      return visit_stop;
+   }
+
    ir_function *current_function;
 
    struct hash_table *ht;
+
+   /** Whether a violation aborts */
+   bool fatal;
+
+   /** Whether a violation was found */
+   bool failed;
 };
 
 
@@ -86,14 +123,14 @@ ir_validate::visit(ir_dereference_variable *ir)
    if ((ir->var == NULL) || (ir->var->as_variable() == NULL)) {
       printf("ir_dereference_variable @ %p does not specify a variable %p\n",
 	     (void *) ir, (void *) ir->var);
-      abort();
+      return fail();
    }
 
    if (hash_table_find(ht, ir->var) == NULL) {
       printf("ir_dereference_variable @ %p specifies undeclared variable "
 	     "`%s' @ %p\n",
 	     (void *) ir, ir->var->name, (void *) ir->var);
-      abort();
+      return fail();
    }
 
    this->validate_ir(ir, this->data);
@@ -109,7 +146,7 @@ ir_validate::visit_enter(ir_if *ir)
 	     ir->condition->type->name);
       ir->print();
       printf("\n");
-      abort();
+      return fail();
    }
 
    return visit_continue;
@@ -128,12 +165,12 @@ ir_validate::visit_leave(ir_loop *ir)
 		"    increment: %p\n",
 		(void *) ir->counter, (void *) ir->from, (void *) ir->to,
                 (void *) ir->increment);
-	 abort();
+	 return fail();
       }
 
       if ((ir->cmp < ir_binop_less) || (ir->cmp > ir_binop_nequal)) {
 	 printf("ir_loop has invalid comparitor %d\n", ir->cmp);
-	 abort();
+	 return fail();
       }
    } else {
       if ((ir->from != NULL) || (ir->from != NULL) || (ir->increment != NULL)) {
@@ -144,7 +181,7 @@ ir_validate::visit_leave(ir_loop *ir)
 		"    increment: %p\n",
 		(void *) ir->counter, (void *) ir->from, (void *) ir->to,
                 (void *) ir->increment);
-	 abort();
+	 return fail();
       }
    }
 
@@ -163,7 +200,7 @@ ir_validate::visit_enter(ir_function *ir)
       printf("%s %p inside %s %p\n",
 	     ir->name, (void *) ir,
 	     this->current_function->name, (void *) this->current_function);
-      abort();
+      return fail();
    }
 
    /* Store the current function hierarchy being traversed.  This is used
@@ -183,7 +220,7 @@ ir_validate::visit_enter(ir_function *ir)
       if (sig->ir_type != ir_type_function_signature) {
 	 printf("Non-signature in signature list of function `%s'\n",
 		ir->name);
-	 abort();
+	 return fail();
       }
    }
 
@@ -209,13 +246,13 @@ ir_validate::visit_enter(ir_function_signature *ir)
 	     (void *) ir,
 	     this->current_function->name, (void *) this->current_function,
 	     ir->function_name(), (void *) ir->function());
-      abort();
+      return fail();
    }
 
    if (ir->return_type == NULL) {
       printf("Function signature %p for function %s has NULL return type.\n",
 	     (void *) ir, ir->function_name());
-      abort();
+      return fail();
    }
 
    this->validate_ir(ir, this->data);
@@ -228,11 +265,11 @@ ir_validate::visit_leave(ir_expression *ir)
 {
    switch (ir->operation) {
    case ir_unop_bit_not:
-      assert(ir->operands[0]->type == ir->type);
+      validate_assert(ir->operands[0]->type == ir->type);
       break;
    case ir_unop_logic_not:
-      assert(ir->type->base_type == GLSL_TYPE_BOOL);
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
       break;
 
    case ir_unop_neg:
@@ -241,57 +278,57 @@ ir_validate::visit_leave(ir_expression *ir)
    case ir_unop_rcp:
    case ir_unop_rsq:
    case ir_unop_sqrt:
-      assert(ir->type == ir->operands[0]->type);
+      validate_assert(ir->type == ir->operands[0]->type);
       break;
 
    case ir_unop_exp:
    case ir_unop_log:
    case ir_unop_exp2:
    case ir_unop_log2:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
-      assert(ir->type == ir->operands[0]->type);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->type == ir->operands[0]->type);
       break;
 
    case ir_unop_f2i:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
-      assert(ir->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_INT);
       break;
    case ir_unop_i2f:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
-      assert(ir->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_FLOAT);
       break;
    case ir_unop_f2b:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
-      assert(ir->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_BOOL);
       break;
    case ir_unop_b2f:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
-      assert(ir->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->type->base_type == GLSL_TYPE_FLOAT);
       break;
    case ir_unop_i2b:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
-      assert(ir->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_BOOL);
       break;
    case ir_unop_b2i:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
-      assert(ir->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->type->base_type == GLSL_TYPE_INT);
       break;
    case ir_unop_u2f:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_UINT);
-      assert(ir->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_UINT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_FLOAT);
       break;
    case ir_unop_i2u:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
-      assert(ir->type->base_type == GLSL_TYPE_UINT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_UINT);
       break;
    case ir_unop_u2i:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_UINT);
-      assert(ir->type->base_type == GLSL_TYPE_INT);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_UINT);
+      validate_assert(ir->type->base_type == GLSL_TYPE_INT);
       break;
 
    case ir_unop_any:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
-      assert(ir->type == glsl_type::bool_type);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->type == glsl_type::bool_type);
       break;
 
    case ir_unop_trunc:
@@ -305,8 +342,8 @@ ir_validate::visit_leave(ir_expression *ir)
    case ir_unop_cos_reduced:
    case ir_unop_dFdx:
    case ir_unop_dFdy:
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
-      assert(ir->operands[0]->type == ir->type);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->operands[0]->type == ir->type);
       break;
 
    case ir_unop_noise:
@@ -322,13 +359,13 @@ ir_validate::visit_leave(ir_expression *ir)
    case ir_binop_max:
    case ir_binop_pow:
       if (ir->operands[0]->type->is_scalar())
-	 assert(ir->operands[1]->type == ir->type);
+	 validate_assert(ir->operands[1]->type == ir->type);
       else if (ir->operands[1]->type->is_scalar())
-	 assert(ir->operands[0]->type == ir->type);
+	 validate_assert(ir->operands[0]->type == ir->type);
       else if (ir->operands[0]->type->is_vector() &&
 	       ir->operands[1]->type->is_vector()) {
-	 assert(ir->operands[0]->type == ir->operands[1]->type);
-	 assert(ir->operands[0]->type == ir->type);
+	 validate_assert(ir->operands[0]->type == ir->operands[1]->type);
+	 validate_assert(ir->operands[0]->type == ir->type);
       }
       break;
 
@@ -343,11 +380,11 @@ ir_validate::visit_leave(ir_expression *ir)
        * comparison on scalar or vector types and return a boolean scalar or
        * vector type of the same size.
        */
-      assert(ir->type->base_type == GLSL_TYPE_BOOL);
-      assert(ir->operands[0]->type == ir->operands[1]->type);
-      assert(ir->operands[0]->type->is_vector()
+      validate_assert(ir->type->base_type == GLSL_TYPE_BOOL);
+      validate_assert(ir->operands[0]->type == ir->operands[1]->type);
+      validate_assert(ir->operands[0]->type->is_vector()
 	     || ir->operands[0]->type->is_scalar());
-      assert(ir->operands[0]->type->vector_elements
+      validate_assert(ir->operands[0]->type->vector_elements
 	     == ir->type->vector_elements);
       break;
 
@@ -356,34 +393,34 @@ ir_validate::visit_leave(ir_expression *ir)
       /* GLSL == and != operate on scalars, vectors, matrices and arrays, and
        * return a scalar boolean.  The IR matches that.
        */
-      assert(ir->type == glsl_type::bool_type);
-      assert(ir->operands[0]->type == ir->operands[1]->type);
+      validate_assert(ir->type == glsl_type::bool_type);
+      validate_assert(ir->operands[0]->type == ir->operands[1]->type);
       break;
 
    case ir_binop_lshift:
    case ir_binop_rshift:
-      assert(ir->operands[0]->type->is_integer() &&
+      validate_assert(ir->operands[0]->type->is_integer() &&
              ir->operands[1]->type->is_integer());
       if (ir->operands[0]->type->is_scalar()) {
-          assert(ir->operands[1]->type->is_scalar());
+          validate_assert(ir->operands[1]->type->is_scalar());
       }
       if (ir->operands[0]->type->is_vector() &&
           ir->operands[1]->type->is_vector()) {
-          assert(ir->operands[0]->type->components() ==
+          validate_assert(ir->operands[0]->type->components() ==
                  ir->operands[1]->type->components());
       }
-      assert(ir->type == ir->operands[0]->type);
+      validate_assert(ir->type == ir->operands[0]->type);
       break;
 
    case ir_binop_bit_and:
    case ir_binop_bit_xor:
    case ir_binop_bit_or:
-       assert(ir->operands[0]->type->base_type ==
+       validate_assert(ir->operands[0]->type->base_type ==
               ir->operands[1]->type->base_type);
-       assert(ir->type->is_integer());
+       validate_assert(ir->type->is_integer());
        if (ir->operands[0]->type->is_vector() &&
            ir->operands[1]->type->is_vector()) {
-           assert(ir->operands[0]->type->vector_elements ==
+           validate_assert(ir->operands[0]->type->vector_elements ==
                   ir->operands[1]->type->vector_elements);
        }
        break;
@@ -391,16 +428,16 @@ ir_validate::visit_leave(ir_expression *ir)
    case ir_binop_logic_and:
    case ir_binop_logic_xor:
    case ir_binop_logic_or:
-      assert(ir->type == glsl_type::bool_type);
-      assert(ir->operands[0]->type == glsl_type::bool_type);
-      assert(ir->operands[1]->type == glsl_type::bool_type);
+      validate_assert(ir->type == glsl_type::bool_type);
+      validate_assert(ir->operands[0]->type == glsl_type::bool_type);
+      validate_assert(ir->operands[1]->type == glsl_type::bool_type);
       break;
 
    case ir_binop_dot:
-      assert(ir->type == glsl_type::float_type);
-      assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
-      assert(ir->operands[0]->type->is_vector());
-      assert(ir->operands[0]->type == ir->operands[1]->type);
+      validate_assert(ir->type == glsl_type::float_type);
+      validate_assert(ir->operands[0]->type->base_type == GLSL_TYPE_FLOAT);
+      validate_assert(ir->operands[0]->type->is_vector());
+      validate_assert(ir->operands[0]->type == ir->operands[1]->type);
       break;
 
    case ir_quadop_vector:
@@ -411,40 +448,40 @@ ir_validate::visit_leave(ir_expression *ir)
        *  - Number of operands must matche the size of the resulting vector.
        *  - Base type of the operands must match the base type of the result.
        */
-      assert(ir->type->is_vector());
+      validate_assert(ir->type->is_vector());
       switch (ir->type->vector_elements) {
       case 2:
-	 assert(ir->operands[0]->type->is_scalar());
-	 assert(ir->operands[0]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[1]->type->is_scalar());
-	 assert(ir->operands[1]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[2] == NULL);
-	 assert(ir->operands[3] == NULL);
+	 validate_assert(ir->operands[0]->type->is_scalar());
+	 validate_assert(ir->operands[0]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[1]->type->is_scalar());
+	 validate_assert(ir->operands[1]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[2] == NULL);
+	 validate_assert(ir->operands[3] == NULL);
 	 break;
       case 3:
-	 assert(ir->operands[0]->type->is_scalar());
-	 assert(ir->operands[0]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[1]->type->is_scalar());
-	 assert(ir->operands[1]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[2]->type->is_scalar());
-	 assert(ir->operands[2]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[3] == NULL);
+	 validate_assert(ir->operands[0]->type->is_scalar());
+	 validate_assert(ir->operands[0]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[1]->type->is_scalar());
+	 validate_assert(ir->operands[1]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[2]->type->is_scalar());
+	 validate_assert(ir->operands[2]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[3] == NULL);
 	 break;
       case 4:
-	 assert(ir->operands[0]->type->is_scalar());
-	 assert(ir->operands[0]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[1]->type->is_scalar());
-	 assert(ir->operands[1]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[2]->type->is_scalar());
-	 assert(ir->operands[2]->type->base_type == ir->type->base_type);
-	 assert(ir->operands[3]->type->is_scalar());
-	 assert(ir->operands[3]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[0]->type->is_scalar());
+	 validate_assert(ir->operands[0]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[1]->type->is_scalar());
+	 validate_assert(ir->operands[1]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[2]->type->is_scalar());
+	 validate_assert(ir->operands[2]->type->base_type == ir->type->base_type);
+	 validate_assert(ir->operands[3]->type->is_scalar());
+	 validate_assert(ir->operands[3]->type->base_type == ir->type->base_type);
 	 break;
       default:
 	 /* The is_vector assertion above should prevent execution from ever
 	  * getting here.
 	  */
-	 assert(!"Should not get here.");
+	 validate_assert(!"Should not get here.");
 	 break;
       }
    }
@@ -462,7 +499,7 @@ ir_validate::visit_leave(ir_swizzle *ir)
 	 printf("ir_swizzle @ %p specifies a channel not present "
 		"in the value.\n", (void *) ir);
 	 ir->print();
-	 abort();
+	 return fail();
       }
    }
 
@@ -492,7 +529,7 @@ ir_validate::visit(ir_variable *ir)
 	 printf("ir_variable has maximum access out of bounds (%d vs %d)\n",
 		ir->max_array_access, ir->type->length - 1);
 	 ir->print();
-	 abort();
+	 return fail();
       }
    }
 
@@ -500,7 +537,7 @@ ir_validate::visit(ir_variable *ir)
       printf("ir_variable didn't have an initializer, but has a constant "
 	     "initializer value.\n");
       ir->print();
-      abort();
+      return fail();
    }
 
    return visit_continue;
@@ -515,7 +552,7 @@ ir_validate::visit_enter(ir_assignment *ir)
 	 printf("Assignment LHS is %s, but write mask is 0:\n",
 		lhs->type->is_scalar() ? "scalar" : "vector");
 	 ir->print();
-	 abort();
+	 return fail();
       }
 
       int lhs_components = 0;
@@ -529,7 +566,7 @@ ir_validate::visit_enter(ir_assignment *ir)
 		"matching RHS vector size (%d LHS, %d RHS).\n",
 		lhs_components, ir->rhs->type->vector_elements);
 	 ir->print();
-	 abort();
+	 return fail();
       }
    }
 
@@ -545,18 +582,18 @@ ir_validate::visit_enter(ir_call *ir)
 
    if (callee->ir_type != ir_type_function_signature) {
       printf("IR called by ir_call is not ir_function_signature!\n");
-      abort();
+      return fail();
    }
 
    if (ir->return_deref) {
       if (ir->return_deref->type != callee->return_type) {
 	 printf("callee type %s does not match return storage type %s\n",
 	        callee->return_type->name, ir->return_deref->type->name);
-	 abort();
+	 return fail();
       }
    } else if (callee->return_type != glsl_type::void_type) {
       printf("ir_call has non-void callee but no return storage\n");
-      abort();
+      return fail();
    }
 
    const exec_node *formal_param_node = callee->parameters.head;
@@ -595,48 +632,69 @@ dump_ir:
    ir->print();
    printf("callee:\n");
    callee->print();
-   abort();
-   return visit_stop;
+   return fail();
 }
 
 void
 ir_validate::validate_ir(ir_instruction *ir, void *data)
 {
-   struct hash_table *ht = (struct hash_table *) data;
+   ir_validate *v = (ir_validate *) data;
 
-   if (hash_table_find(ht, ir)) {
+   if (hash_table_find(v->ht, ir)) {
       printf("Instruction node present twice in ir tree:\n");
       ir->print();
       printf("\n");
-      abort();
+      v->fail();
+      return;
    }
-   hash_table_insert(ht, ir, ir);
+   hash_table_insert(v->ht, ir, ir);
 }
 
 void
 check_node_type(ir_instruction *ir, void *data)
 {
-   (void) data;
+   ir_validate *v = (ir_validate *) data;
 
    if (ir->ir_type <= ir_type_unset || ir->ir_type >= ir_type_max) {
       printf("Instruction node with unset type\n");
       ir->print(); printf("\n");
+      if (!v->fatal)
+	 v->failed = true;
    }
    ir_rvalue *value = ir->as_rvalue();
-   if (value != NULL)
-      assert(value->type != glsl_type::error_type);
+   if (value != NULL) {
+      if (!v->fatal && value->type == glsl_type::error_type)
+	 v->failed = true;
+      assert(v->failed || value->type != glsl_type::error_type);
+   }
 }
 
-void
-validate_ir_tree(exec_list *instructions)
+static bool
+run_validate(exec_list *instructions, bool fatal)
 {
-   ir_validate v;
+   ir_validate v(fatal);
 
    v.run(instructions);
+   if (v.failed)
+      return false;
 
    foreach_iter(exec_list_iterator, iter, *instructions) {
       ir_instruction *ir = (ir_instruction *)iter.get();
 
-      visit_tree(ir, check_node_type, NULL);
+      visit_tree(ir, check_node_type, &v);
    }
+
+   return !v.failed;
+}
+
+void
+validate_ir_tree(exec_list *instructions)
+{
+   run_validate(instructions, true);
+}
+
+bool
+is_valid_ir_tree(exec_list *instructions)
+{
+   return run_validate(instructions, false);
 }
@@ -50,15 +50,16 @@ ir_variable_refcount_entry *
 ir_variable_refcount_visitor::get_variable_entry(ir_variable *var)
 {
    assert(var);
-   foreach_iter(exec_list_iterator, iter, this->variable_list) {
-      ir_variable_refcount_entry *entry = (ir_variable_refcount_entry *)iter.get();
-      if (entry->var == var)
-	 return entry;
-   }
 
-   ir_variable_refcount_entry *entry = new(mem_ctx) ir_variable_refcount_entry(var);
+   ir_variable_refcount_entry *entry =
+      (ir_variable_refcount_entry *) hash_table_find(this->ht, var);
+   if (entry)
+      return entry;
+
+   entry = new(mem_ctx) ir_variable_refcount_entry(var);
    assert(entry->referenced_count == 0);
    this->variable_list.push_tail(entry);
+   hash_table_insert(this->ht, entry, var);
    return entry;
 }
 
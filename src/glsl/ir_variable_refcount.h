@@ -32,6 +32,7 @@
 #include "ir.h"
 #include "ir_visitor.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 class ir_variable_refcount_entry : public exec_node
 {
@@ -56,11 +57,14 @@ public:
    {
       this->mem_ctx = ralloc_context(NULL);
       this->variable_list.make_empty();
+      this->ht = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
    }
 
    ~ir_variable_refcount_visitor(void)
    {
       ralloc_free(this->mem_ctx);
+      hash_table_dtor(this->ht);
    }
 
    virtual ir_visitor_status visit(ir_variable *);
@@ -74,5 +78,8 @@ public:
    /* List of ir_variable_refcount_entry */
    exec_list variable_list;
 
+   /** Maps each ir_variable to its entry in variable_list */
+   struct hash_table *ht;
+
    void *mem_ctx;
 };
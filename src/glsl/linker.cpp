@@ -1040,8 +1040,15 @@ link_intrastage_shaders(void *mem_ctx,
 
    assert(idx == num_linking_shaders);
 
-   if (!link_function_calls(prog, linked, linking_shaders,
-			    num_linking_shaders)) {
+   /* The built-in function shaders are shared with the compiler, which may
+    * be reading function bodies into them on another thread.
+    */
+   _mesa_glsl_lock_builtins();
+   const bool calls_linked = link_function_calls(prog, linked, linking_shaders,
+						  num_linking_shaders);
+   _mesa_glsl_unlock_builtins();
+
+   if (!calls_linked) {
       ctx->Driver.DeleteShader(ctx, linked);
       linked = NULL;
    }
@@ -2313,8 +2320,8 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
 
       unsigned max_unroll = ctx->ShaderCompilerOptions[i].MaxUnrollIterations;
 
-      while (do_common_optimization(prog->_LinkedShaders[i]->ir, true, false, max_unroll))
-	 ;
+      do_common_optimization_loop(prog->_LinkedShaders[i]->ir, true, false,
+				  max_unroll);
    }
 
    /* FINISHME: The value of the max_attribute_index parameter is
@@ -2465,3 +2472,28 @@ done:
 
    ralloc_free(mem_ctx);
 }
+
+
+/**
+ * Release the parts of a linked shader's IR that are only needed to generate
+ * code, once the driver has done so.
+ *
+ * Only the top-level variable declarations are kept, since the GL API still
+ * looks at them (e.g. for glGetActiveAttrib).  They are cloned into a fresh
+ * list so that freeing the old one releases all of the function bodies.
+ */
+void
+compact_linked_ir(struct gl_shader *sh)
+{
+   exec_list *ir = new(sh) exec_list;
+
+   foreach_list(node, sh->ir) {
+      ir_variable *const var = ((ir_instruction *) node)->as_variable();
+
+      if (var != NULL)
+	 ir->push_tail(var->clone(ir, NULL));
+   }
+
+   ralloc_free(sh->ir);
+   sh->ir = ir;
+}
@@ -21,6 +21,7 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <getopt.h>
+#include <sys/time.h>
 
 /** @file main.cpp
  *
@@ -39,6 +40,13 @@
 #include "loop_analysis.h"
 #include "standalone_scaffolding.h"
 
+static void
+delete_shader(struct gl_context *ctx, struct gl_shader *sh)
+{
+   (void) ctx;
+   ralloc_free(sh);
+}
+
 static void
 initialize_context(struct gl_context *ctx, gl_api api)
 {
@@ -58,6 +66,7 @@ initialize_context(struct gl_context *ctx, gl_api api)
    ctx->Const.MaxTextureCoordUnits = 4;
 
    ctx->Driver.NewShader = _mesa_new_shader;
+   ctx->Driver.DeleteShader = delete_shader;
 }
 
 /* Returned string will have 'ctx' as its ralloc owner. */
@@ -108,6 +117,8 @@ int dump_ast = 0;
 int dump_hir = 0;
 int dump_lir = 0;
 int do_link = 0;
+int do_time = 0;
+int do_round_trip = 0;
 
 const struct option compiler_opts[] = {
    { "glsl-es",  0, &glsl_es,  1 },
@@ -115,6 +126,8 @@ const struct option compiler_opts[] = {
    { "dump-hir", 0, &dump_hir, 1 },
    { "dump-lir", 0, &dump_lir, 1 },
    { "link",     0, &do_link,  1 },
+   { "time",     0, &do_time,  1 },
+   { "round-trip", 0, &do_round_trip, 1 },
    { NULL, 0, NULL, 0 }
 };
 
@@ -137,6 +150,18 @@ usage_fail(const char *name)
 }
 
 
+/**
+ * Current time in milliseconds, for --time.
+ */
+static double
+get_time_ms(void)
+{
+   struct timeval tv;
+
+   gettimeofday(&tv, NULL);
+   return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
 void
 compile_shader(struct gl_context *ctx, struct gl_shader *shader)
 {
@@ -173,10 +198,7 @@ compile_shader(struct gl_context *ctx, struct gl_shader *shader)
 
    /* Optimization passes */
    if (!state->error && !shader->ir->is_empty()) {
-      bool progress;
-      do {
-	 progress = do_common_optimization(shader->ir, false, false, 32);
-      } while (progress);
+      do_common_optimization_loop(shader->ir, false, false, 32);
 
       validate_ir_tree(shader->ir);
    }
@@ -207,6 +229,57 @@ compile_shader(struct gl_context *ctx, struct gl_shader *shader)
    return;
 }
 
+/**
+ * Serialize a linked program, load it into a new program, and check that
+ * serializing the new program gives back the same binary.
+ */
+static int
+round_trip_program(struct gl_context *ctx, struct gl_shader_program *prog)
+{
+   /* Binaries never leave this process, so any build ID will do. */
+   static const unsigned char build_id[PROGRAM_BINARY_BUILD_ID_SIZE] = { 0 };
+   unsigned size;
+   void *binary = serialize_program(prog, prog, build_id, &size);
+
+   if (binary == NULL) {
+      printf("Program could not be serialized.\n");
+      return EXIT_FAILURE;
+   }
+
+   struct gl_shader_program *copy = rzalloc(NULL, struct gl_shader_program);
+   copy->InfoLog = ralloc_strdup(copy, "");
+
+   const double start = get_time_ms();
+
+   deserialize_program(ctx, copy, build_id, binary, size);
+
+   if (do_time)
+      printf("Loaded program binary in %.3f ms\n", get_time_ms() - start);
+
+   int status = EXIT_FAILURE;
+   if (!copy->LinkStatus) {
+      printf("Info log for loading program binary:\n%s\n", copy->InfoLog);
+   } else {
+      unsigned copy_size;
+      void *copy_binary = serialize_program(copy, copy, build_id,
+					    &copy_size);
+
+      if (copy_binary != NULL && copy_size == size
+	  && memcmp(copy_binary, binary, size) == 0) {
+	 printf("Program binary round-trip: %u bytes\n", size);
+	 status = EXIT_SUCCESS;
+      } else {
+	 printf("Program binary does not round-trip.\n");
+      }
+   }
+
+   for (unsigned i = 0; i < MESA_SHADER_TYPES; i++)
+      ralloc_free(copy->_LinkedShaders[i]);
+
+   ralloc_free(copy);
+   return status;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -225,6 +298,12 @@ main(int argc, char **argv)
 
    initialize_context(ctx, (glsl_es) ? API_OPENGLES2 : API_OPENGL);
 
+   struct optimization_stats opt_stats;
+   if (do_time) {
+      memset(&opt_stats, 0, sizeof(opt_stats));
+      _mesa_glsl_optimization_stats = &opt_stats;
+   }
+
    struct gl_shader_program *whole_program;
 
    whole_program = rzalloc (NULL, struct gl_shader_program);
@@ -262,8 +341,15 @@ main(int argc, char **argv)
 	 exit(EXIT_FAILURE);
       }
 
+      const double start = get_time_ms();
+
       compile_shader(ctx, shader);
 
+      /* The first compile also pays for reading the built-ins. */
+      if (do_time)
+         printf("Compiled %s in %.3f ms\n", argv[optind],
+                get_time_ms() - start);
+
       if (!shader->CompileStatus) {
 	 printf("Info log for %s:\n%s\n", argv[optind], shader->InfoLog);
 	 status = EXIT_FAILURE;
@@ -272,13 +358,27 @@ main(int argc, char **argv)
    }
 
    if ((status == EXIT_SUCCESS) && do_link)  {
+      const double start = get_time_ms();
+
       link_shaders(ctx, whole_program);
+
+      if (do_time)
+         printf("Linked in %.3f ms\n", get_time_ms() - start);
+
       status = (whole_program->LinkStatus) ? EXIT_SUCCESS : EXIT_FAILURE;
 
       if (strlen(whole_program->InfoLog) > 0)
 	 printf("Info log for linking:\n%s\n", whole_program->InfoLog);
    }
 
+   if ((status == EXIT_SUCCESS) && do_link && do_round_trip)
+      status = round_trip_program(ctx, whole_program);
+
+   if (do_time) {
+      _mesa_print_optimization_stats(&opt_stats);
+      _mesa_glsl_optimization_stats = NULL;
+   }
+
    for (unsigned i = 0; i < MESA_SHADER_TYPES; i++)
       ralloc_free(whole_program->_LinkedShaders[i]);
 
@@ -40,6 +40,7 @@
 #include "ir_basic_block.h"
 #include "ir_optimization.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 class acp_entry : public exec_node
 {
@@ -68,6 +69,9 @@ public:
 
    /** Mask of values initially available in the constant. */
    unsigned initial_values;
+
+   /** Link in the list of entries for the same \c var */
+   exec_node var_link;
 };
 
 
@@ -85,17 +89,168 @@ public:
    unsigned write_mask;
 };
 
+
+/**
+ * The available constants, indexed by variable.
+ *
+ * Long straight-line shaders can have thousands of constants available at
+ * a time, and every dereference and every assignment used to walk all of
+ * them.
+ */
+class constant_table
+{
+public:
+   constant_table(void *mem_ctx)
+   {
+      this->mem_ctx = mem_ctx;
+      this->ht = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
+   }
+
+   ~constant_table()
+   {
+      hash_table_dtor(this->ht);
+   }
+
+   acp_entry *find(ir_variable *var, int channel);
+   void add(acp_entry *entry);
+   void kill(ir_variable *var, unsigned write_mask);
+   void copy(constant_table *src);
+   void clear();
+
+private:
+   /** Maps each variable to the list of its acp_entry::var_link */
+   struct hash_table *ht;
+
+   /** List of acp_entry, in the order they were added */
+   exec_list entries;
+
+   void *mem_ctx;
+};
+
+/**
+ * Returns the oldest available constant for the given channel of \c var.
+ */
+acp_entry *
+constant_table::find(ir_variable *var, int channel)
+{
+   exec_list *list = (exec_list *) hash_table_find(this->ht, var);
+   if (list == NULL)
+      return NULL;
+
+   foreach_list(node, list) {
+      acp_entry *entry = exec_node_data(acp_entry, node, var_link);
+
+      if (entry->write_mask & (1 << channel))
+	 return entry;
+   }
+
+   return NULL;
+}
+
+void
+constant_table::add(acp_entry *entry)
+{
+   exec_list *list = (exec_list *) hash_table_find(this->ht, entry->var);
+
+   if (list == NULL) {
+      list = new(this->mem_ctx) exec_list;
+      hash_table_insert(this->ht, list, entry->var);
+   }
+
+   this->entries.push_tail(entry);
+   list->push_tail(&entry->var_link);
+}
+
+void
+constant_table::kill(ir_variable *var, unsigned write_mask)
+{
+   exec_list *list = (exec_list *) hash_table_find(this->ht, var);
+   if (list == NULL)
+      return;
+
+   foreach_list_safe(node, list) {
+      acp_entry *entry = exec_node_data(acp_entry, node, var_link);
+
+      entry->write_mask &= ~write_mask;
+      if (entry->write_mask == 0) {
+	 entry->remove();
+	 entry->var_link.remove();
+      }
+   }
+}
+
+void
+constant_table::copy(constant_table *src)
+{
+   foreach_list(node, &src->entries) {
+      acp_entry *a = (acp_entry *) node;
+
+      add(new(this->mem_ctx) acp_entry(a));
+   }
+}
+
+void
+constant_table::clear()
+{
+   hash_table_clear(this->ht);
+   this->entries.make_empty();
+}
+
+
+/**
+ * The variables killed in a block, and the channels killed in each.
+ */
+class kill_table
+{
+public:
+   kill_table(void *mem_ctx)
+   {
+      this->mem_ctx = mem_ctx;
+      this->ht = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
+   }
+
+   ~kill_table()
+   {
+      hash_table_dtor(this->ht);
+   }
+
+   void add(ir_variable *var, unsigned write_mask)
+   {
+      kill_entry *entry = (kill_entry *) hash_table_find(this->ht, var);
+
+      if (entry) {
+	 entry->write_mask |= write_mask;
+      } else {
+	 entry = new(this->mem_ctx) kill_entry(var, write_mask);
+	 this->entries.push_tail(entry);
+	 hash_table_insert(this->ht, entry, var);
+      }
+   }
+
+   /** List of kill_entry */
+   exec_list entries;
+
+private:
+   struct hash_table *ht;
+   void *mem_ctx;
+};
+
 class ir_constant_propagation_visitor : public ir_rvalue_visitor {
 public:
    ir_constant_propagation_visitor()
    {
       progress = false;
       mem_ctx = ralloc_context(0);
-      this->acp = new(mem_ctx) exec_list;
-      this->kills = new(mem_ctx) exec_list;
+      this->acp = new constant_table(mem_ctx);
+      this->kills = new kill_table(mem_ctx);
+      this->killed_all = false;
    }
    ~ir_constant_propagation_visitor()
    {
+      delete this->acp;
+      delete this->kills;
       ralloc_free(mem_ctx);
    }
 
@@ -111,14 +266,13 @@ public:
    void handle_if_block(exec_list *instructions);
    void handle_rvalue(ir_rvalue **rvalue);
 
-   /** List of acp_entry: The available constants to propagate */
-   exec_list *acp;
+   /** The available constants to propagate */
+   constant_table *acp;
 
    /**
-    * List of kill_entry: The masks of variables whose values were
-    * killed in this block.
+    * The masks of variables whose values were killed in this block.
     */
-   exec_list *kills;
+   kill_table *kills;
 
    bool progress;
 
@@ -169,13 +323,7 @@ ir_constant_propagation_visitor::handle_rvalue(ir_rvalue **rvalue)
 	 channel = i;
       }
 
-      foreach_iter(exec_list_iterator, iter, *this->acp) {
-	 acp_entry *entry = (acp_entry *)iter.get();
-	 if (entry->var == deref->var && entry->write_mask & (1 << channel)) {
-	    found = entry;
-	    break;
-	 }
-      }
+      found = this->acp->find(deref->var, channel);
 
       if (!found)
 	 return;
@@ -218,12 +366,14 @@ ir_constant_propagation_visitor::visit_enter(ir_function_signature *ir)
     * block.  Any instructions at global scope will be shuffled into
     * main() at link time, so they're irrelevant to us.
     */
-   exec_list *orig_acp = this->acp;
-   exec_list *orig_kills = this->kills;
+   constant_table *orig_acp = this->acp;
+   kill_table *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   constant_table acp(mem_ctx);
+   kill_table kills(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
-   this->kills = new(mem_ctx) exec_list;
+   this->acp = &acp;
+   this->kills = &kills;
    this->killed_all = false;
 
    visit_list_elements(this, &ir->body);
@@ -277,7 +427,7 @@ ir_constant_propagation_visitor::visit_enter(ir_call *ir)
    /* Since we're unlinked, we don't (necssarily) know the side effects of
     * this call.  So kill all copies.
     */
-   acp->make_empty();
+   acp->clear();
    this->killed_all = true;
 
    return visit_continue_with_parent;
@@ -286,32 +436,30 @@ ir_constant_propagation_visitor::visit_enter(ir_call *ir)
 void
 ir_constant_propagation_visitor::handle_if_block(exec_list *instructions)
 {
-   exec_list *orig_acp = this->acp;
-   exec_list *orig_kills = this->kills;
+   constant_table *orig_acp = this->acp;
+   kill_table *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   constant_table acp(mem_ctx);
+   kill_table kills(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
-   this->kills = new(mem_ctx) exec_list;
+   this->acp = &acp;
+   this->kills = &kills;
    this->killed_all = false;
 
    /* Populate the initial acp with a constant of the original */
-   foreach_iter(exec_list_iterator, iter, *orig_acp) {
-      acp_entry *a = (acp_entry *)iter.get();
-      this->acp->push_tail(new(this->mem_ctx) acp_entry(a));
-   }
+   acp.copy(orig_acp);
 
    visit_list_elements(this, instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
-   exec_list *new_kills = this->kills;
    this->kills = orig_kills;
    this->acp = orig_acp;
    this->killed_all = this->killed_all || orig_killed_all;
 
-   foreach_iter(exec_list_iterator, iter, *new_kills) {
+   foreach_iter(exec_list_iterator, iter, kills.entries) {
       kill_entry *k = (kill_entry *)iter.get();
       kill(k->var, k->write_mask);
    }
@@ -333,30 +481,31 @@ ir_constant_propagation_visitor::visit_enter(ir_if *ir)
 ir_visitor_status
 ir_constant_propagation_visitor::visit_enter(ir_loop *ir)
 {
-   exec_list *orig_acp = this->acp;
-   exec_list *orig_kills = this->kills;
+   constant_table *orig_acp = this->acp;
+   kill_table *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   constant_table acp(mem_ctx);
+   kill_table kills(mem_ctx);
 
    /* FINISHME: For now, the initial acp for loops is totally empty.
     * We could go through once, then go through again with the acp
     * cloned minus the killed entries after the first run through.
     */
-   this->acp = new(mem_ctx) exec_list;
-   this->kills = new(mem_ctx) exec_list;
+   this->acp = &acp;
+   this->kills = &kills;
    this->killed_all = false;
 
    visit_list_elements(this, &ir->body_instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
-   exec_list *new_kills = this->kills;
    this->kills = orig_kills;
    this->acp = orig_acp;
    this->killed_all = this->killed_all || orig_killed_all;
 
-   foreach_iter(exec_list_iterator, iter, *new_kills) {
+   foreach_iter(exec_list_iterator, iter, kills.entries) {
       kill_entry *k = (kill_entry *)iter.get();
       kill(k->var, k->write_mask);
    }
@@ -375,29 +524,12 @@ ir_constant_propagation_visitor::kill(ir_variable *var, unsigned write_mask)
       return;
 
    /* Remove any entries currently in the ACP for this kill. */
-   foreach_iter(exec_list_iterator, iter, *this->acp) {
-      acp_entry *entry = (acp_entry *)iter.get();
-
-      if (entry->var == var) {
-	 entry->write_mask &= ~write_mask;
-	 if (entry->write_mask == 0)
-	    entry->remove();
-      }
-   }
+   this->acp->kill(var, write_mask);
 
    /* Add this writemask of the variable to the list of killed
     * variables in this block.
     */
-   foreach_iter(exec_list_iterator, iter, *this->kills) {
-      kill_entry *entry = (kill_entry *)iter.get();
-
-      if (entry->var == var) {
-	 entry->write_mask |= write_mask;
-	 return;
-      }
-   }
-   /* Not already in the list.  Make new entry. */
-   this->kills->push_tail(new(this->mem_ctx) kill_entry(var, write_mask));
+   this->kills->add(var, write_mask);
 }
 
 /**
@@ -407,8 +539,6 @@ ir_constant_propagation_visitor::kill(ir_variable *var, unsigned write_mask)
 void
 ir_constant_propagation_visitor::add_constant(ir_assignment *ir)
 {
-   acp_entry *entry;
-
    if (ir->condition)
       return;
 
@@ -427,8 +557,8 @@ ir_constant_propagation_visitor::add_constant(ir_assignment *ir)
    if (!deref->var->type->is_vector() && !deref->var->type->is_scalar())
       return;
 
-   entry = new(this->mem_ctx) acp_entry(deref->var, ir->write_mask, constant);
-   this->acp->push_tail(entry);
+   this->acp->add(new(this->mem_ctx) acp_entry(deref->var, ir->write_mask,
+						 constant));
 }
 
 /**
@@ -36,6 +36,7 @@
 #include "ir_visitor.h"
 #include "ir_optimization.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 struct assignment_entry {
    exec_node link;
@@ -47,34 +48,50 @@ struct assignment_entry {
 
 class ir_constant_variable_visitor : public ir_hierarchical_visitor {
 public:
+   ir_constant_variable_visitor()
+   {
+      this->ht = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
+   }
+
+   ~ir_constant_variable_visitor()
+   {
+      hash_table_dtor(this->ht);
+   }
+
    virtual ir_visitor_status visit_enter(ir_dereference_variable *);
    virtual ir_visitor_status visit(ir_variable *);
    virtual ir_visitor_status visit_enter(ir_assignment *);
    virtual ir_visitor_status visit_enter(ir_call *);
 
+   struct assignment_entry *get_assignment_entry(ir_variable *var);
+
    exec_list list;
+
+   /** Maps each ir_variable to its assignment_entry in list */
+   struct hash_table *ht;
 };
 
-static struct assignment_entry *
-get_assignment_entry(ir_variable *var, exec_list *list)
+struct assignment_entry *
+ir_constant_variable_visitor::get_assignment_entry(ir_variable *var)
 {
    struct assignment_entry *entry;
 
-   foreach_list_typed(struct assignment_entry, entry, link, list) {
-      if (entry->var == var)
-	 return entry;
-   }
+   entry = (struct assignment_entry *) hash_table_find(this->ht, var);
+   if (entry)
+      return entry;
 
    entry = (struct assignment_entry *)calloc(1, sizeof(*entry));
    entry->var = var;
-   list->push_head(&entry->link);
+   this->list.push_head(&entry->link);
+   hash_table_insert(this->ht, entry, var);
    return entry;
 }
 
 ir_visitor_status
 ir_constant_variable_visitor::visit(ir_variable *ir)
 {
-   struct assignment_entry *entry = get_assignment_entry(ir, &this->list);
+   struct assignment_entry *entry = get_assignment_entry(ir);
    entry->our_scope = true;
    return visit_continue;
 }
@@ -93,7 +110,7 @@ ir_constant_variable_visitor::visit_enter(ir_assignment *ir)
    ir_constant *constval;
    struct assignment_entry *entry;
 
-   entry = get_assignment_entry(ir->lhs->variable_referenced(), &this->list);
+   entry = get_assignment_entry(ir->lhs->variable_referenced());
    assert(entry);
    entry->assignment_count++;
 
@@ -139,7 +156,7 @@ ir_constant_variable_visitor::visit_enter(ir_call *ir)
 	 struct assignment_entry *entry;
 
 	 assert(var);
-	 entry = get_assignment_entry(var, &this->list);
+	 entry = get_assignment_entry(var);
 	 entry->assignment_count++;
       }
       sig_iter.next();
@@ -151,7 +168,7 @@ ir_constant_variable_visitor::visit_enter(ir_call *ir)
       struct assignment_entry *entry;
 
       assert(var);
-      entry = get_assignment_entry(var, &this->list);
+      entry = get_assignment_entry(var);
       entry->assignment_count++;
    }
 
@@ -37,6 +37,7 @@
 #include "ir_basic_block.h"
 #include "ir_optimization.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 class acp_entry : public exec_node
 {
@@ -51,9 +52,129 @@ public:
 
    ir_variable *lhs;
    ir_variable *rhs;
+
+   /** Link in the list of entries copying from the same \c rhs */
+   exec_node rhs_link;
 };
 
 
+/**
+ * The available copies, indexed both by the variable written and by the
+ * variable copied from.
+ *
+ * Long straight-line shaders can have thousands of copies available at a
+ * time, and every variable dereference and every assignment used to walk
+ * all of them.
+ */
+class acp_table
+{
+public:
+   acp_table(void *mem_ctx)
+   {
+      this->mem_ctx = mem_ctx;
+      this->lhs_ht = hash_table_ctor(0, hash_table_pointer_hash,
+				     hash_table_pointer_compare);
+      this->rhs_ht = hash_table_ctor(0, hash_table_pointer_hash,
+				     hash_table_pointer_compare);
+   }
+
+   ~acp_table()
+   {
+      hash_table_dtor(this->lhs_ht);
+      hash_table_dtor(this->rhs_ht);
+   }
+
+   /** Returns the variable \c lhs is a copy of, if any. */
+   ir_variable *find(ir_variable *lhs)
+   {
+      acp_entry *entry = (acp_entry *) hash_table_find(this->lhs_ht, lhs);
+
+      return entry ? entry->rhs : NULL;
+   }
+
+   void add(ir_variable *lhs, ir_variable *rhs);
+   void kill(ir_variable *var);
+   void copy(acp_table *src);
+   void clear();
+
+private:
+   void remove(acp_entry *entry);
+
+   /** Maps the lhs of each copy to its acp_entry */
+   struct hash_table *lhs_ht;
+
+   /** Maps the rhs of each copy to the list of acp_entry::rhs_link */
+   struct hash_table *rhs_ht;
+
+   /** List of acp_entry, in the order they were added */
+   exec_list entries;
+
+   void *mem_ctx;
+};
+
+void
+acp_table::add(ir_variable *lhs, ir_variable *rhs)
+{
+   acp_entry *entry = new(this->mem_ctx) acp_entry(lhs, rhs);
+   exec_list *uses = (exec_list *) hash_table_find(this->rhs_ht, rhs);
+
+   if (uses == NULL) {
+      uses = new(this->mem_ctx) exec_list;
+      hash_table_insert(this->rhs_ht, uses, rhs);
+   }
+
+   /* The caller killed any previous copy into lhs. */
+   assert(hash_table_find(this->lhs_ht, lhs) == NULL);
+
+   this->entries.push_tail(entry);
+   uses->push_tail(&entry->rhs_link);
+   hash_table_insert(this->lhs_ht, entry, lhs);
+}
+
+void
+acp_table::remove(acp_entry *entry)
+{
+   entry->remove();
+   entry->rhs_link.remove();
+   hash_table_remove(this->lhs_ht, entry->lhs);
+}
+
+/**
+ * Removes the copies into \c var and the copies from \c var.
+ */
+void
+acp_table::kill(ir_variable *var)
+{
+   acp_entry *entry = (acp_entry *) hash_table_find(this->lhs_ht, var);
+   if (entry)
+      remove(entry);
+
+   exec_list *uses = (exec_list *) hash_table_find(this->rhs_ht, var);
+   if (uses) {
+      while (!uses->is_empty())
+	 remove(exec_node_data(acp_entry, uses->head, rhs_link));
+   }
+}
+
+void
+acp_table::copy(acp_table *src)
+{
+   foreach_list(node, &src->entries) {
+      acp_entry *a = (acp_entry *) node;
+
+      add(a->lhs, a->rhs);
+   }
+}
+
+void
+acp_table::clear()
+{
+   hash_table_clear(this->lhs_ht);
+   hash_table_clear(this->rhs_ht);
+   this->entries.make_empty();
+}
+
+
 class kill_entry : public exec_node
 {
 public:
@@ -72,11 +193,13 @@ public:
    {
       progress = false;
       mem_ctx = ralloc_context(0);
-      this->acp = new(mem_ctx) exec_list;
+      this->acp = new acp_table(mem_ctx);
       this->kills = new(mem_ctx) exec_list;
+      this->killed_all = false;
    }
    ~ir_copy_propagation_visitor()
    {
+      delete this->acp;
       ralloc_free(mem_ctx);
    }
 
@@ -92,8 +215,8 @@ public:
    void kill(ir_variable *ir);
    void handle_if_block(exec_list *instructions);
 
-   /** List of acp_entry: The available copies to propagate */
-   exec_list *acp;
+   /** The available copies to propagate */
+   acp_table *acp;
    /**
     * List of kill_entry: The variables whose values were killed in this
     * block.
@@ -114,11 +237,12 @@ ir_copy_propagation_visitor::visit_enter(ir_function_signature *ir)
     * block.  Any instructions at global scope will be shuffled into
     * main() at link time, so they're irrelevant to us.
     */
-   exec_list *orig_acp = this->acp;
+   acp_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_table acp(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
@@ -161,16 +285,11 @@ ir_copy_propagation_visitor::visit(ir_dereference_variable *ir)
    if (this->in_assignee)
       return visit_continue;
 
-   ir_variable *var = ir->var;
-
-   foreach_iter(exec_list_iterator, iter, *this->acp) {
-      acp_entry *entry = (acp_entry *)iter.get();
+   ir_variable *rhs = this->acp->find(ir->var);
 
-      if (var == entry->lhs) {
-	 ir->var = entry->rhs;
-	 this->progress = true;
-	 break;
-      }
+   if (rhs) {
+      ir->var = rhs;
+      this->progress = true;
    }
 
    return visit_continue;
@@ -194,7 +313,7 @@ ir_copy_propagation_visitor::visit_enter(ir_call *ir)
    /* Since we're unlinked, we don't (necessarily) know the side effects of
     * this call.  So kill all copies.
     */
-   acp->make_empty();
+   acp->clear();
    this->killed_all = true;
 
    return visit_continue_with_parent;
@@ -203,24 +322,22 @@ ir_copy_propagation_visitor::visit_enter(ir_call *ir)
 void
 ir_copy_propagation_visitor::handle_if_block(exec_list *instructions)
 {
-   exec_list *orig_acp = this->acp;
+   acp_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_table acp(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
    /* Populate the initial acp with a copy of the original */
-   foreach_iter(exec_list_iterator, iter, *orig_acp) {
-      acp_entry *a = (acp_entry *)iter.get();
-      this->acp->push_tail(new(this->mem_ctx) acp_entry(a->lhs, a->rhs));
-   }
+   acp.copy(orig_acp);
 
    visit_list_elements(this, instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
    exec_list *new_kills = this->kills;
@@ -249,22 +366,23 @@ ir_copy_propagation_visitor::visit_enter(ir_if *ir)
 ir_visitor_status
 ir_copy_propagation_visitor::visit_enter(ir_loop *ir)
 {
-   exec_list *orig_acp = this->acp;
+   acp_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_table acp(mem_ctx);
 
    /* FINISHME: For now, the initial acp for loops is totally empty.
     * We could go through once, then go through again with the acp
     * cloned minus the killed entries after the first run through.
     */
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
    visit_list_elements(this, &ir->body_instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
    exec_list *new_kills = this->kills;
@@ -287,13 +405,7 @@ ir_copy_propagation_visitor::kill(ir_variable *var)
    assert(var != NULL);
 
    /* Remove any entries currently in the ACP for this kill. */
-   foreach_iter(exec_list_iterator, iter, *acp) {
-      acp_entry *entry = (acp_entry *)iter.get();
-
-      if (entry->lhs == var || entry->rhs == var) {
-	 entry->remove();
-      }
-   }
+   this->acp->kill(var);
 
    /* Add the LHS variable to the list of killed variables in this block.
     */
@@ -307,8 +419,6 @@ ir_copy_propagation_visitor::kill(ir_variable *var)
 void
 ir_copy_propagation_visitor::add_copy(ir_assignment *ir)
 {
-   acp_entry *entry;
-
    if (ir->condition)
       return;
 
@@ -325,8 +435,7 @@ ir_copy_propagation_visitor::add_copy(ir_assignment *ir)
 	 ir->condition = new(ralloc_parent(ir)) ir_constant(false);
 	 this->progress = true;
       } else {
-	 entry = new(this->mem_ctx) acp_entry(lhs_var, rhs_var);
-	 this->acp->push_tail(entry);
+	 this->acp->add(lhs_var, rhs_var);
       }
    }
 }
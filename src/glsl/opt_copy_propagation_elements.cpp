@@ -46,6 +46,7 @@
 #include "ir_basic_block.h"
 #include "ir_optimization.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 static bool debug = false;
 
@@ -72,6 +73,10 @@ public:
    ir_variable *rhs;
    unsigned int write_mask;
    int swizzle[4];
+
+   /** Links in the lists of entries with the same \c lhs and \c rhs */
+   exec_node lhs_link;
+   exec_node rhs_link;
 };
 
 
@@ -88,6 +93,132 @@ public:
    unsigned int write_mask;
 };
 
+
+/**
+ * The available copies, indexed both by the variable written and by the
+ * variable copied from.
+ *
+ * Long straight-line shaders can have thousands of copies available at a
+ * time, and every dereference and every assignment used to walk all of
+ * them.
+ */
+class acp_element_table
+{
+public:
+   acp_element_table(void *mem_ctx)
+   {
+      this->mem_ctx = mem_ctx;
+      this->lhs_ht = hash_table_ctor(0, hash_table_pointer_hash,
+				     hash_table_pointer_compare);
+      this->rhs_ht = hash_table_ctor(0, hash_table_pointer_hash,
+				     hash_table_pointer_compare);
+   }
+
+   ~acp_element_table()
+   {
+      hash_table_dtor(this->lhs_ht);
+      hash_table_dtor(this->rhs_ht);
+   }
+
+   /**
+    * Returns the list of acp_entry::lhs_link for copies into \c var, in
+    * the order they were added, or NULL.
+    */
+   exec_list *copies_into(ir_variable *var)
+   {
+      return (exec_list *) hash_table_find(this->lhs_ht, var);
+   }
+
+   void add(acp_entry *entry);
+   void kill(ir_variable *var, unsigned write_mask);
+   void copy(acp_element_table *src);
+   void clear();
+
+private:
+   exec_list *get_list(struct hash_table *ht, ir_variable *var);
+   void remove(acp_entry *entry);
+
+   struct hash_table *lhs_ht;
+   struct hash_table *rhs_ht;
+
+   /** List of acp_entry, in the order they were added */
+   exec_list entries;
+
+   void *mem_ctx;
+};
+
+exec_list *
+acp_element_table::get_list(struct hash_table *ht, ir_variable *var)
+{
+   exec_list *list = (exec_list *) hash_table_find(ht, var);
+
+   if (list == NULL) {
+      list = new(this->mem_ctx) exec_list;
+      hash_table_insert(ht, list, var);
+   }
+
+   return list;
+}
+
+void
+acp_element_table::add(acp_entry *entry)
+{
+   this->entries.push_tail(entry);
+   get_list(this->lhs_ht, entry->lhs)->push_tail(&entry->lhs_link);
+   get_list(this->rhs_ht, entry->rhs)->push_tail(&entry->rhs_link);
+}
+
+void
+acp_element_table::remove(acp_entry *entry)
+{
+   entry->remove();
+   entry->lhs_link.remove();
+   entry->rhs_link.remove();
+}
+
+/**
+ * Removes the given channels of copies into \c var, and all copies
+ * from \c var.
+ */
+void
+acp_element_table::kill(ir_variable *var, unsigned write_mask)
+{
+   exec_list *list = (exec_list *) hash_table_find(this->lhs_ht, var);
+   if (list) {
+      foreach_list_safe(node, list) {
+	 acp_entry *entry = exec_node_data(acp_entry, node, lhs_link);
+
+	 entry->write_mask = entry->write_mask & ~write_mask;
+	 if (entry->write_mask == 0)
+	    remove(entry);
+      }
+   }
+
+   list = (exec_list *) hash_table_find(this->rhs_ht, var);
+   if (list) {
+      while (!list->is_empty())
+	 remove(exec_node_data(acp_entry, list->head, rhs_link));
+   }
+}
+
+void
+acp_element_table::copy(acp_element_table *src)
+{
+   foreach_list(node, &src->entries) {
+      acp_entry *a = (acp_entry *) node;
+
+      add(new(this->mem_ctx) acp_entry(a));
+   }
+}
+
+void
+acp_element_table::clear()
+{
+   hash_table_clear(this->lhs_ht);
+   hash_table_clear(this->rhs_ht);
+   this->entries.make_empty();
+}
+
 class ir_copy_propagation_elements_visitor : public ir_rvalue_visitor {
 public:
    ir_copy_propagation_elements_visitor()
@@ -96,11 +227,12 @@ public:
       this->killed_all = false;
       this->mem_ctx = ralloc_context(NULL);
       this->shader_mem_ctx = NULL;
-      this->acp = new(mem_ctx) exec_list;
+      this->acp = new acp_element_table(mem_ctx);
       this->kills = new(mem_ctx) exec_list;
    }
    ~ir_copy_propagation_elements_visitor()
    {
+      delete this->acp;
       ralloc_free(mem_ctx);
    }
 
@@ -117,8 +249,8 @@ public:
    void kill(kill_entry *k);
    void handle_if_block(exec_list *instructions);
 
-   /** List of acp_entry: The available copies to propagate */
-   exec_list *acp;
+   /** The available copies to propagate */
+   acp_element_table *acp;
    /**
     * List of kill_entry: The variables whose values were killed in this
     * block.
@@ -142,11 +274,12 @@ ir_copy_propagation_elements_visitor::visit_enter(ir_function_signature *ir)
     * block.  Any instructions at global scope will be shuffled into
     * main() at link time, so they're irrelevant to us.
     */
-   exec_list *orig_acp = this->acp;
+   acp_element_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_element_table acp(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
@@ -240,15 +373,17 @@ ir_copy_propagation_elements_visitor::handle_rvalue(ir_rvalue **ir)
    /* Try to find ACP entries covering swizzle_chan[], hoping they're
     * the same source variable.
     */
-   foreach_iter(exec_list_iterator, iter, *this->acp) {
-      acp_entry *entry = (acp_entry *)iter.get();
-
-      if (var == entry->lhs) {
-	 for (int c = 0; c < chans; c++) {
-	    if (entry->write_mask & (1 << swizzle_chan[c])) {
-	       source[c] = entry->rhs;
-	       source_chan[c] = entry->swizzle[swizzle_chan[c]];
-	    }
+   exec_list *copies = this->acp->copies_into(var);
+   if (!copies)
+      return;
+
+   foreach_list(node, copies) {
+      acp_entry *entry = exec_node_data(acp_entry, node, lhs_link);
+
+      for (int c = 0; c < chans; c++) {
+	 if (entry->write_mask & (1 << swizzle_chan[c])) {
+	    source[c] = entry->rhs;
+	    source_chan[c] = entry->swizzle[swizzle_chan[c]];
 	 }
       }
    }
@@ -302,7 +437,7 @@ ir_copy_propagation_elements_visitor::visit_enter(ir_call *ir)
    /* Since we're unlinked, we don't (necessarily) know the side effects of
     * this call.  So kill all copies.
     */
-   acp->make_empty();
+   acp->clear();
    this->killed_all = true;
 
    return visit_continue_with_parent;
@@ -311,24 +446,22 @@ ir_copy_propagation_elements_visitor::visit_enter(ir_call *ir)
 void
 ir_copy_propagation_elements_visitor::handle_if_block(exec_list *instructions)
 {
-   exec_list *orig_acp = this->acp;
+   acp_element_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_element_table acp(mem_ctx);
 
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
    /* Populate the initial acp with a copy of the original */
-   foreach_iter(exec_list_iterator, iter, *orig_acp) {
-      acp_entry *a = (acp_entry *)iter.get();
-      this->acp->push_tail(new(this->mem_ctx) acp_entry(a));
-   }
+   acp.copy(orig_acp);
 
    visit_list_elements(this, instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
    exec_list *new_kills = this->kills;
@@ -360,22 +493,23 @@ ir_copy_propagation_elements_visitor::visit_enter(ir_if *ir)
 ir_visitor_status
 ir_copy_propagation_elements_visitor::visit_enter(ir_loop *ir)
 {
-   exec_list *orig_acp = this->acp;
+   acp_element_table *orig_acp = this->acp;
    exec_list *orig_kills = this->kills;
    bool orig_killed_all = this->killed_all;
+   acp_element_table acp(mem_ctx);
 
    /* FINISHME: For now, the initial acp for loops is totally empty.
     * We could go through once, then go through again with the acp
     * cloned minus the killed entries after the first run through.
     */
-   this->acp = new(mem_ctx) exec_list;
+   this->acp = &acp;
    this->kills = new(mem_ctx) exec_list;
    this->killed_all = false;
 
    visit_list_elements(this, &ir->body_instructions);
 
    if (this->killed_all) {
-      orig_acp->make_empty();
+      orig_acp->clear();
    }
 
    exec_list *new_kills = this->kills;
@@ -396,20 +530,7 @@ ir_copy_propagation_elements_visitor::visit_enter(ir_loop *ir)
 void
 ir_copy_propagation_elements_visitor::kill(kill_entry *k)
 {
-   foreach_list_safe(node, acp) {
-      acp_entry *entry = (acp_entry *)node;
-
-      if (entry->lhs == k->var) {
-	 entry->write_mask = entry->write_mask & ~k->write_mask;
-	 if (entry->write_mask == 0) {
-	    entry->remove();
-	    continue;
-	 }
-      }
-      if (entry->rhs == k->var) {
-	 entry->remove();
-      }
-   }
+   this->acp->kill(k->var, k->write_mask);
 
    /* If we were on a list, remove ourselves before inserting */
    if (k->next)
@@ -477,7 +598,7 @@ ir_copy_propagation_elements_visitor::add_copy(ir_assignment *ir)
 
    entry = new(this->mem_ctx) acp_entry(lhs->var, rhs->var, write_mask,
 					swizzle);
-   this->acp->push_tail(entry);
+   this->acp->add(entry);
 }
 
 bool
@@ -37,6 +37,7 @@
 #include "ir_basic_block.h"
 #include "ir_optimization.h"
 #include "glsl_types.h"
+#include "program/hash_table.h"
 
 static bool debug = false;
 
@@ -53,11 +54,63 @@ public:
 
    ir_variable *lhs;
    ir_instruction *ir;
+
+   /** Link in the list of entries with the same \c lhs */
+   exec_node lhs_link;
+};
+
+/**
+ * The assignments in a basic block that may still turn out to be dead,
+ * indexed by the variable they write.
+ */
+class assignment_table {
+public:
+   assignment_table()
+   {
+      this->ht = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
+   }
+
+   ~assignment_table()
+   {
+      hash_table_dtor(this->ht);
+   }
+
+   void add(assignment_entry *entry)
+   {
+      exec_list *list = (exec_list *) hash_table_find(this->ht, entry->lhs);
+
+      if (list == NULL) {
+	 list = new(ralloc_parent(entry)) exec_list;
+	 hash_table_insert(this->ht, list, entry->lhs);
+      }
+
+      this->entries.push_tail(entry);
+      list->push_tail(&entry->lhs_link);
+   }
+
+   /** Returns the list of assignment_entry::lhs_link for \c var, or NULL */
+   exec_list *assignments_to(ir_variable *var)
+   {
+      return (exec_list *) hash_table_find(this->ht, var);
+   }
+
+   static void remove(assignment_entry *entry)
+   {
+      entry->remove();
+      entry->lhs_link.remove();
+   }
+
+   /** List of assignment_entry, in the order they were added */
+   exec_list entries;
+
+private:
+   struct hash_table *ht;
 };
 
 class kill_for_derefs_visitor : public ir_hierarchical_visitor {
 public:
-   kill_for_derefs_visitor(exec_list *assignments)
+   kill_for_derefs_visitor(assignment_table *assignments)
    {
       this->assignments = assignments;
    }
@@ -65,22 +118,25 @@ public:
    virtual ir_visitor_status visit(ir_dereference_variable *ir)
    {
       ir_variable *const var = ir->variable_referenced();
+      exec_list *list = this->assignments->assignments_to(var);
 
-      foreach_iter(exec_list_iterator, iter, *this->assignments) {
-	 assignment_entry *entry = (assignment_entry *)iter.get();
+      if (list == NULL)
+	 return visit_continue;
 
-	 if (entry->lhs == var) {
-	    if (debug)
-	       printf("kill %s\n", entry->lhs->name);
-	    entry->remove();
-	 }
+      while (!list->is_empty()) {
+	 assignment_entry *entry =
+	    exec_node_data(assignment_entry, list->head, lhs_link);
+
+	 if (debug)
+	    printf("kill %s\n", entry->lhs->name);
+	 assignment_table::remove(entry);
       }
 
       return visit_continue;
    }
 
 private:
-   exec_list *assignments;
+   assignment_table *assignments;
 };
 
 class array_index_visit : public ir_hierarchical_visitor {
@@ -111,7 +167,7 @@ public:
  * of a variable to a variable.
  */
 static bool
-process_assignment(void *ctx, ir_assignment *ir, exec_list *assignments)
+process_assignment(void *ctx, ir_assignment *ir, assignment_table *assignments)
 {
    ir_variable *var = NULL;
    bool progress = false;
@@ -136,28 +192,28 @@ process_assignment(void *ctx, ir_assignment *ir, exec_list *assignments)
        */
       if (debug)
 	 printf("looking for %s to remove\n", var->name);
-      foreach_iter(exec_list_iterator, iter, *assignments) {
-	 assignment_entry *entry = (assignment_entry *)iter.get();
-
-	 if (entry->lhs == var) {
-	    if (debug)
-	       printf("removing %s\n", var->name);
-	    entry->ir->remove();
-	    entry->remove();
-	    progress = true;
-	 }
+      exec_list *list = assignments->assignments_to(var);
+      while (list != NULL && !list->is_empty()) {
+	 assignment_entry *entry =
+	    exec_node_data(assignment_entry, list->head, lhs_link);
+
+	 if (debug)
+	    printf("removing %s\n", var->name);
+	 entry->ir->remove();
+	 assignment_table::remove(entry);
+	 progress = true;
       }
    }
 
    /* Add this instruction to the assignment list available to be removed. */
    assignment_entry *entry = new(ctx) assignment_entry(var, ir);
-   assignments->push_tail(entry);
+   assignments->add(entry);
 
    if (debug) {
       printf("add %s\n", var->name);
 
       printf("current entries\n");
-      foreach_iter(exec_list_iterator, iter, *assignments) {
+      foreach_iter(exec_list_iterator, iter, assignments->entries) {
 	 assignment_entry *entry = (assignment_entry *)iter.get();
 
 	 printf("    %s\n", entry->lhs->name);
@@ -173,8 +229,8 @@ dead_code_local_basic_block(ir_instruction *first,
 			     void *data)
 {
    ir_instruction *ir, *ir_next;
-   /* List of avaialble_copy */
-   exec_list assignments;
+   /* The assignments that may still be dead */
+   assignment_table assignments;
    bool *out_progress = (bool *)data;
    bool progress = false;
 
@@ -0,0 +1,610 @@
+/*
+ * Copyright © 2012 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file opt_worklist.cpp
+ *
+ * Driver for the common optimization passes.
+ *
+ * Running every pass over the whole program until none of them makes
+ * progress spends most of its time re-walking code that nothing has touched
+ * since a pass last looked at it.  Instead, every function body (and the
+ * global scope) carries a generation number that is bumped whenever a pass
+ * changes it, and for each pass we remember the generation at which it last
+ * found nothing to do there.
+ *
+ * Passes which only ever look inside one function body at a time are then
+ * re-run only on the bodies that changed since.  Passes which need to see
+ * the whole program are skipped as long as nothing at all changed, and when
+ * they do make progress every body is considered changed, since we can't
+ * tell which ones they touched.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "main/compiler.h"
+#include "ir.h"
+#include "ir_optimization.h"
+#include "loop_analysis.h"
+#include "program/hash_table.h"
+#include "ralloc.h"
+
+struct optimization_stats *_mesa_glsl_optimization_stats = NULL;
+
+namespace {
+
+struct opt_options {
+   bool linked;
+   bool uniform_locations_assigned;
+   unsigned max_unroll_iterations;
+};
+
+/** The pass only applies to linked programs */
+#define PASS_LINKED_ONLY     0x1
+/** The pass never looks outside of the instruction list it's given */
+#define PASS_FUNCTION_LOCAL  0x2
+
+struct opt_pass {
+   const char *name;
+   bool (*run)(exec_list *ir, const opt_options *options);
+   unsigned flags;
+};
+
+static bool
+run_lower_sub(exec_list *ir, const opt_options *)
+{
+   return lower_instructions(ir, SUB_TO_ADD_NEG);
+}
+
+static bool
+run_function_inlining(exec_list *ir, const opt_options *)
+{
+   return do_function_inlining(ir);
+}
+
+static bool
+run_dead_functions(exec_list *ir, const opt_options *)
+{
+   return do_dead_functions(ir);
+}
+
+static bool
+run_structure_splitting(exec_list *ir, const opt_options *)
+{
+   return do_structure_splitting(ir);
+}
+
+static bool
+run_if_simplification(exec_list *ir, const opt_options *)
+{
+   return do_if_simplification(ir);
+}
+
+static bool
+run_discard_simplification(exec_list *ir, const opt_options *)
+{
+   return do_discard_simplification(ir);
+}
+
+static bool
+run_copy_propagation(exec_list *ir, const opt_options *)
+{
+   return do_copy_propagation(ir);
+}
+
+static bool
+run_copy_propagation_elements(exec_list *ir, const opt_options *)
+{
+   return do_copy_propagation_elements(ir);
+}
+
+static bool
+run_dead_code(exec_list *ir, const opt_options *options)
+{
+   if (options->linked)
+      return do_dead_code(ir, options->uniform_locations_assigned);
+   else
+      return do_dead_code_unlinked(ir);
+}
+
+static bool
+run_dead_code_local(exec_list *ir, const opt_options *)
+{
+   return do_dead_code_local(ir);
+}
+
+static bool
+run_tree_grafting(exec_list *ir, const opt_options *)
+{
+   return do_tree_grafting(ir);
+}
+
+static bool
+run_constant_propagation(exec_list *ir, const opt_options *)
+{
+   return do_constant_propagation(ir);
+}
+
+static bool
+run_constant_variable(exec_list *ir, const opt_options *options)
+{
+   if (options->linked)
+      return do_constant_variable(ir);
+   else
+      return do_constant_variable_unlinked(ir);
+}
+
+static bool
+run_constant_folding(exec_list *ir, const opt_options *)
+{
+   return do_constant_folding(ir);
+}
+
+static bool
+run_algebraic(exec_list *ir, const opt_options *)
+{
+   return do_algebraic(ir);
+}
+
+static bool
+run_lower_jumps(exec_list *ir, const opt_options *)
+{
+   return do_lower_jumps(ir);
+}
+
+static bool
+run_vec_index_to_swizzle(exec_list *ir, const opt_options *)
+{
+   return do_vec_index_to_swizzle(ir);
+}
+
+static bool
+run_swizzle_swizzle(exec_list *ir, const opt_options *)
+{
+   return do_swizzle_swizzle(ir);
+}
+
+static bool
+run_noop_swizzle(exec_list *ir, const opt_options *)
+{
+   return do_noop_swizzle(ir);
+}
+
+static bool
+run_split_arrays(exec_list *ir, const opt_options *options)
+{
+   return optimize_split_arrays(ir, options->linked);
+}
+
+static bool
+run_redundant_jumps(exec_list *ir, const opt_options *)
+{
+   return optimize_redundant_jumps(ir);
+}
+
+static bool
+run_loop_unrolling(exec_list *ir, const opt_options *options)
+{
+   bool progress = false;
+
+   loop_state *ls = analyze_loop_variables(ir);
+   if (ls->loop_found) {
+      progress = set_loop_controls(ir, ls) || progress;
+      progress = unroll_loops(ir, ls, options->max_unroll_iterations)
+	 || progress;
+   }
+   delete ls;
+
+   return progress;
+}
+
+/**
+ * The passes, in the order they are run in each round.
+ */
+static const opt_pass passes[] = {
+   { "lower_sub",		run_lower_sub,			PASS_FUNCTION_LOCAL },
+   { "function_inlining",	run_function_inlining,		PASS_LINKED_ONLY },
+   { "dead_functions",		run_dead_functions,		PASS_LINKED_ONLY },
+   { "structure_splitting",	run_structure_splitting,	PASS_LINKED_ONLY },
+   { "if_simplification",	run_if_simplification,		PASS_FUNCTION_LOCAL },
+   { "discard_simplification",	run_discard_simplification,	PASS_FUNCTION_LOCAL },
+   { "copy_propagation",	run_copy_propagation,		PASS_FUNCTION_LOCAL },
+   { "copy_propagation_elements", run_copy_propagation_elements, PASS_FUNCTION_LOCAL },
+   { "dead_code",		run_dead_code,			0 },
+   { "dead_code_local",		run_dead_code_local,		PASS_FUNCTION_LOCAL },
+   { "tree_grafting",		run_tree_grafting,		0 },
+   { "constant_propagation",	run_constant_propagation,	PASS_FUNCTION_LOCAL },
+   { "constant_variable",	run_constant_variable,		0 },
+   { "constant_folding",	run_constant_folding,		PASS_FUNCTION_LOCAL },
+   { "algebraic",		run_algebraic,			PASS_FUNCTION_LOCAL },
+   { "lower_jumps",		run_lower_jumps,		0 },
+   { "vec_index_to_swizzle",	run_vec_index_to_swizzle,	PASS_FUNCTION_LOCAL },
+   { "swizzle_swizzle",		run_swizzle_swizzle,		PASS_FUNCTION_LOCAL },
+   { "noop_swizzle",		run_noop_swizzle,		PASS_FUNCTION_LOCAL },
+   { "split_arrays",		run_split_arrays,		0 },
+   { "redundant_jumps",		run_redundant_jumps,		PASS_FUNCTION_LOCAL },
+   { "loop_unrolling",		run_loop_unrolling,		0 },
+};
+
+#define NUM_PASSES (sizeof(passes) / sizeof(passes[0]))
+
+/**
+ * Bookkeeping for one function body, or for the global scope.
+ */
+struct opt_unit {
+   /** Bumped every time a pass makes progress on this unit. */
+   unsigned generation;
+
+   /**
+    * For each pass, the generation at which it last ran on this unit
+    * without making progress.  Zero if it never did.
+    */
+   unsigned clean[NUM_PASSES];
+};
+
+class common_optimizer {
+public:
+   common_optimizer(bool linked, bool uniform_locations_assigned,
+		    unsigned max_unroll_iterations,
+		    struct optimization_stats *stats);
+   ~common_optimizer();
+
+   bool run_round(exec_list *ir);
+
+private:
+   bool run_global_pass(unsigned p, exec_list *ir);
+   bool run_local_pass(unsigned p, exec_list *ir);
+   bool run_on_unit(unsigned p, opt_unit *unit, exec_list *ir,
+		    bool global_scope);
+   bool run_on_global_scope(unsigned p, exec_list *ir);
+   opt_unit *unit_for(ir_function_signature *sig);
+   void invalidate_all();
+
+   opt_options options;
+   struct optimization_stats *stats;
+
+   /** Bumped whenever any pass makes progress anywhere. */
+   unsigned program_generation;
+
+   /** For each pass, the program generation at which it last did nothing. */
+   unsigned program_clean[NUM_PASSES];
+
+   /** Instructions outside of any function. */
+   opt_unit global_scope;
+
+   /** Maps ir_function_signature to opt_unit, allocated out of mem_ctx. */
+   struct hash_table *units;
+   void *mem_ctx;
+};
+
+common_optimizer::common_optimizer(bool linked,
+				   bool uniform_locations_assigned,
+				   unsigned max_unroll_iterations,
+				   struct optimization_stats *stats)
+{
+   this->options.linked = linked;
+   this->options.uniform_locations_assigned = uniform_locations_assigned;
+   this->options.max_unroll_iterations = max_unroll_iterations;
+   this->stats = stats;
+
+   this->program_generation = 1;
+   memset(this->program_clean, 0, sizeof(this->program_clean));
+   this->global_scope.generation = 1;
+   memset(this->global_scope.clean, 0, sizeof(this->global_scope.clean));
+
+   this->units = hash_table_ctor(0, hash_table_pointer_hash,
+				 hash_table_pointer_compare);
+   this->mem_ctx = ralloc_context(NULL);
+
+   if (stats) {
+      assert(NUM_PASSES <= Elements(stats->pass));
+      stats->num_passes = NUM_PASSES;
+      for (unsigned p = 0; p < NUM_PASSES; p++)
+	 stats->pass[p].name = passes[p].name;
+   }
+}
+
+common_optimizer::~common_optimizer()
+{
+   hash_table_dtor(this->units);
+   ralloc_free(this->mem_ctx);
+}
+
+/**
+ * Forget everything we know about the function bodies.
+ *
+ * Called after a pass that looks at the whole program made progress.  This
+ * also takes care of signatures which were removed by the pass, whose
+ * addresses could otherwise be reused for new ones.
+ */
+void
+common_optimizer::invalidate_all()
+{
+   hash_table_clear(this->units);
+   ralloc_free(this->mem_ctx);
+   this->mem_ctx = ralloc_context(NULL);
+
+   this->global_scope.generation++;
+}
+
+opt_unit *
+common_optimizer::unit_for(ir_function_signature *sig)
+{
+   opt_unit *unit = (opt_unit *) hash_table_find(this->units, sig);
+
+   if (unit == NULL) {
+      unit = rzalloc(this->mem_ctx, opt_unit);
+      unit->generation = 1;
+      hash_table_insert(this->units, unit, sig);
+   }
+
+   return unit;
+}
+
+/**
+ * Runs a function-local pass on the instructions outside of any function.
+ *
+ * Each run of consecutive global instructions is temporarily moved to a
+ * list of its own so that the pass doesn't descend into the functions in
+ * between.  That loses whatever the pass could have propagated from one
+ * run to the next across a function definition, which is only
+ * conservative.
+ */
+bool
+common_optimizer::run_on_global_scope(unsigned p, exec_list *ir)
+{
+   bool progress = false;
+   exec_node *node = ir->head;
+
+   while (!node->is_tail_sentinel()) {
+      if (((ir_instruction *) node)->as_function()) {
+	 node = node->next;
+	 continue;
+      }
+
+      /* Gather the run of global instructions starting here. */
+      exec_node *const prev = node->prev;
+      exec_list scope;
+
+      while (!node->is_tail_sentinel()
+	     && !((ir_instruction *) node)->as_function()) {
+	 exec_node *const next = node->next;
+	 node->remove();
+	 scope.push_tail(node);
+	 node = next;
+      }
+
+      progress = passes[p].run(&scope, &this->options) || progress;
+
+      /* Put whatever is left back where it came from. */
+      exec_node *after = prev;
+      while (!scope.is_empty()) {
+	 exec_node *const n = scope.head;
+	 n->remove();
+	 after->insert_after(n);
+	 after = n;
+      }
+   }
+
+   return progress;
+}
+
+bool
+common_optimizer::run_on_unit(unsigned p, opt_unit *unit, exec_list *ir,
+			      bool global_scope)
+{
+   if (unit->clean[p] == unit->generation) {
+      if (this->stats)
+	 this->stats->pass[p].skipped++;
+      return false;
+   }
+
+   clock_t start = 0;
+   if (this->stats)
+      start = clock();
+
+   const bool progress = global_scope
+      ? run_on_global_scope(p, ir)
+      : passes[p].run(ir, &this->options);
+
+   if (this->stats) {
+      this->stats->pass[p].runs++;
+      this->stats->pass[p].ms +=
+	 (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+      if (progress)
+	 this->stats->pass[p].progress++;
+   }
+
+   if (progress) {
+      unit->generation++;
+      this->program_generation++;
+   } else {
+      unit->clean[p] = unit->generation;
+   }
+
+   return progress;
+}
+
+bool
+common_optimizer::run_local_pass(unsigned p, exec_list *ir)
+{
+   bool progress = false;
+
+   progress = run_on_unit(p, &this->global_scope, ir, true) || progress;
+
+   foreach_list(node, ir) {
+      ir_function *const f = ((ir_instruction *) node)->as_function();
+
+      if (f == NULL)
+	 continue;
+
+      foreach_list(sig_node, &f->signatures) {
+	 ir_function_signature *const sig =
+	    (ir_function_signature *) sig_node;
+
+	 if (!sig->is_defined)
+	    continue;
+
+	 progress = run_on_unit(p, unit_for(sig), &sig->body, false)
+	    || progress;
+      }
+   }
+
+   return progress;
+}
+
+bool
+common_optimizer::run_global_pass(unsigned p, exec_list *ir)
+{
+   clock_t start = 0;
+   if (this->stats)
+      start = clock();
+
+   const bool progress = passes[p].run(ir, &this->options);
+
+   if (this->stats) {
+      this->stats->pass[p].runs++;
+      this->stats->pass[p].ms +=
+	 (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+      if (progress)
+	 this->stats->pass[p].progress++;
+   }
+
+   if (progress) {
+      this->program_generation++;
+      invalidate_all();
+   }
+
+   return progress;
+}
+
+/**
+ * Runs each pass once, wherever something changed since it last did
+ * nothing.  Returns true if any of them made progress.
+ */
+bool
+common_optimizer::run_round(exec_list *ir)
+{
+   bool progress = false;
+
+   if (this->stats)
+      this->stats->rounds++;
+
+   for (unsigned p = 0; p < NUM_PASSES; p++) {
+      if ((passes[p].flags & PASS_LINKED_ONLY) && !this->options.linked)
+	 continue;
+
+      if (this->program_clean[p] == this->program_generation) {
+	 if (this->stats)
+	    this->stats->pass[p].skipped++;
+	 continue;
+      }
+
+      const bool pass_progress = (passes[p].flags & PASS_FUNCTION_LOCAL)
+	 ? run_local_pass(p, ir)
+	 : run_global_pass(p, ir);
+
+      if (pass_progress)
+	 progress = true;
+      else
+	 this->program_clean[p] = this->program_generation;
+   }
+
+   return progress;
+}
+
+} /* anonymous namespace */
+
+/**
+ * Do the set of common optimizations passes, once each
+ *
+ * \param ir                          List of instructions to be optimized
+ * \param linked                      Is the shader linked?  This enables
+ *                                    optimizations passes that remove code at
+ *                                    global scope and could cause linking to
+ *                                    fail.
+ * \param uniform_locations_assigned  Have locations already been assigned for
+ *                                    uniforms?  This prevents the declarations
+ *                                    of unused uniforms from being removed.
+ *                                    The setting of this flag only matters if
+ *                                    \c linked is \c true.
+ * \param max_unroll_iterations       Maximum number of loop iterations to be
+ *                                    unrolled.  Setting to 0 forces all loops
+ *                                    to be unrolled.
+ *
+ * Returns true if any pass made progress.  Callers that want to run the
+ * passes until nothing changes should use do_common_optimization_loop(),
+ * which avoids re-running passes on code that didn't change.
+ */
+bool
+do_common_optimization(exec_list *ir, bool linked,
+		       bool uniform_locations_assigned,
+		       unsigned max_unroll_iterations)
+{
+   common_optimizer opt(linked, uniform_locations_assigned,
+			max_unroll_iterations, NULL);
+
+   return opt.run_round(ir);
+}
+
+/**
+ * Runs the common optimization passes until none of them makes progress.
+ *
+ * Returns true if any of them made progress.  Statistics are accumulated
+ * into _mesa_glsl_optimization_stats if it is set.
+ */
+bool
+do_common_optimization_loop(exec_list *ir, bool linked,
+			    bool uniform_locations_assigned,
+			    unsigned max_unroll_iterations)
+{
+   common_optimizer opt(linked, uniform_locations_assigned,
+			max_unroll_iterations, _mesa_glsl_optimization_stats);
+   bool progress = false;
+
+   while (opt.run_round(ir))
+      progress = true;
+
+   return progress;
+}
+
+void
+_mesa_print_optimization_stats(const struct optimization_stats *stats)
+{
+   double total = 0.0;
+
+   printf("%-26s %8s %8s %8s %10s\n",
+	  "pass", "runs", "skipped", "progress", "ms");
+
+   for (unsigned p = 0; p < stats->num_passes; p++) {
+      const struct optimization_pass_stats *s = &stats->pass[p];
+
+      printf("%-26s %8u %8u %8u %10.3f\n",
+	     s->name, s->runs, s->skipped, s->progress, s->ms);
+      total += s->ms;
+   }
+
+   printf("%u rounds, %.3f ms total\n", stats->rounds, total);
+}
@@ -26,6 +26,21 @@
 extern void
 link_shaders(struct gl_context *ctx, struct gl_shader_program *prog);
 
+extern void
+compact_linked_ir(struct gl_shader *sh);
+
+/** Size of the build ID program binaries are keyed with */
+#define PROGRAM_BINARY_BUILD_ID_SIZE 20
+
+extern void *
+serialize_program(void *mem_ctx, struct gl_shader_program *prog,
+		  const unsigned char *build_id, unsigned *size);
+
+extern void
+deserialize_program(struct gl_context *ctx, struct gl_shader_program *prog,
+		    const unsigned char *build_id,
+		    const void *binary, unsigned size);
+
 extern void
 linker_error(gl_shader_program *prog, const char *fmt, ...)
    PRINTFLIKE(2, 3);
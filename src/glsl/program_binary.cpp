@@ -0,0 +1,1344 @@
+/*
+ * Copyright © 2012 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file program_binary.cpp
+ * Serialization of linked GLSL programs
+ *
+ * This is the backing store for \c glGetProgramBinary and
+ * \c glProgramBinary.  A linked program is written as a versioned blob that
+ * holds the program-wide link results (transform feedback layout, clip
+ * distance and geometry state, ...) followed by the linked IR of each stage.
+ *
+ * The IR is captured after the linker is done with it but before the driver
+ * lowers it, so loading a binary replaces the front-end, the linker and the
+ * common optimization passes, and then hands the IR to the driver exactly
+ * as \c link_shaders would have.  Uniform storage is not stored directly; it
+ * is a pure function of the linked IR, so it is rebuilt by
+ * \c link_assign_uniform_locations and checked against the recorded count.
+ *
+ * The format is specific to a single build of Mesa, identified by the build
+ * ID the caller passes in (see \c _mesa_get_build_id).  Binaries from any
+ * other build are rejected by the header check, and applications are
+ * expected to fall back to compiling from source when that happens.  Since
+ * the checksum only catches damage, the loaded IR is also validated before
+ * anything else sees it.
+ */
+
+#include "main/core.h"
+#include "glsl_types.h"
+#include "ir.h"
+#include "program.h"
+#include "program/hash_table.h"
+#include "linker.h"
+
+extern "C" {
+#include "main/shaderobj.h"
+}
+
+#define PROGRAM_BINARY_MAGIC   0x4d534c42 /* "MSLB" */
+#define PROGRAM_BINARY_VERSION 2
+
+/** Marks a \c NULL pointer or the end of an instruction list. */
+#define NODE_NONE ir_type_unset
+
+namespace {
+
+/**
+ * Growable byte buffer that the serializer writes into
+ */
+class binary_writer {
+public:
+   binary_writer(void *mem_ctx)
+      : mem_ctx(mem_ctx), data(NULL), size(0), capacity(0)
+   {
+      /* empty */
+   }
+
+   void write_bytes(const void *src, unsigned n)
+   {
+      if (size + n > capacity) {
+	 capacity = MAX2(MAX2(capacity * 2, 4096), size + n);
+	 data = (uint8_t *) reralloc_size(mem_ctx, data, capacity);
+      }
+
+      memcpy(data + size, src, n);
+      size += n;
+   }
+
+   void write_uint(uint32_t v)
+   {
+      write_bytes(&v, sizeof(v));
+   }
+
+   void write_int(int32_t v)
+   {
+      write_bytes(&v, sizeof(v));
+   }
+
+   void write_string(const char *s)
+   {
+      if (s == NULL) {
+	 write_uint(~0u);
+	 return;
+      }
+
+      const unsigned len = strlen(s);
+      write_uint(len);
+      write_bytes(s, len);
+   }
+
+   void *mem_ctx;
+   uint8_t *data;
+   unsigned size;
+   unsigned capacity;
+};
+
+
+/**
+ * Bounds-checked cursor over a blob
+ *
+ * Reading past the end of the data does not fail immediately.  Zeros are
+ * returned and \c overrun is set, and callers check it at convenient points.
+ */
+class binary_reader {
+public:
+   binary_reader(const uint8_t *data, unsigned size)
+      : cur(data), end(data + size), overrun(false)
+   {
+      /* empty */
+   }
+
+   bool read_bytes(void *dst, unsigned n)
+   {
+      if (overrun || unsigned(end - cur) < n) {
+	 overrun = true;
+	 memset(dst, 0, n);
+	 return false;
+      }
+
+      memcpy(dst, cur, n);
+      cur += n;
+      return true;
+   }
+
+   uint32_t read_uint()
+   {
+      uint32_t v;
+      read_bytes(&v, sizeof(v));
+      return v;
+   }
+
+   int32_t read_int()
+   {
+      int32_t v;
+      read_bytes(&v, sizeof(v));
+      return v;
+   }
+
+   char *read_string(void *mem_ctx)
+   {
+      const uint32_t len = read_uint();
+      if (len == ~0u || overrun)
+	 return NULL;
+
+      if (unsigned(end - cur) < len) {
+	 overrun = true;
+	 return NULL;
+      }
+
+      char *s = ralloc_strndup(mem_ctx, (const char *) cur, len);
+      cur += len;
+      return s;
+   }
+
+   const uint8_t *cur;
+   const uint8_t *end;
+   bool overrun;
+};
+
+
+static uint32_t
+checksum(const uint8_t *data, unsigned size)
+{
+   /* FNV-1a.  This only has to catch truncated or damaged binaries, not
+    * deliberate tampering.
+    */
+   uint32_t hash = 2166136261u;
+
+   for (unsigned i = 0; i < size; i++) {
+      hash ^= data[i];
+      hash *= 16777619u;
+   }
+
+   return hash;
+}
+
+
+/**
+ * Writes the linked IR of a single shader stage
+ *
+ * Variables and function signatures are written once, at their declaration,
+ * and are referred to by index everywhere else.
+ */
+class ir_serializer {
+public:
+   ir_serializer(binary_writer *out)
+      : failed(false), out(out), num_variables(0), num_signatures(0)
+   {
+      variables = hash_table_ctor(0, hash_table_pointer_hash,
+				  hash_table_pointer_compare);
+      signatures = hash_table_ctor(0, hash_table_pointer_hash,
+				   hash_table_pointer_compare);
+   }
+
+   ~ir_serializer()
+   {
+      hash_table_dtor(variables);
+      hash_table_dtor(signatures);
+   }
+
+   void write_shader(exec_list *instructions);
+
+   bool failed;
+
+private:
+   void write_type(const glsl_type *type);
+   void write_variable(ir_variable *var);
+   void write_variable_ref(ir_variable *var);
+   void write_instructions(exec_list *list);
+   void write_instruction(ir_instruction *ir);
+   void write_rvalue(ir_rvalue *ir);
+   void write_constant(ir_constant *ir);
+
+   binary_writer *out;
+
+   /** ir_variable * -> index + 1 */
+   hash_table *variables;
+   unsigned num_variables;
+
+   /** ir_function_signature * -> index + 1 */
+   hash_table *signatures;
+   unsigned num_signatures;
+};
+
+
+void
+ir_serializer::write_type(const glsl_type *type)
+{
+   if (type->base_type == GLSL_TYPE_ARRAY) {
+      out->write_uint(GLSL_TYPE_ARRAY);
+      out->write_uint(type->length);
+      write_type(type->fields.array);
+   } else if (type->base_type == GLSL_TYPE_STRUCT
+	      && glsl_type::get_builtin_instance(type->name) != type) {
+      out->write_uint(GLSL_TYPE_STRUCT);
+      out->write_string(type->name);
+      out->write_uint(type->length);
+      for (unsigned i = 0; i < type->length; i++) {
+	 out->write_string(type->fields.structure[i].name);
+	 write_type(type->fields.structure[i].type);
+      }
+   } else {
+      /* Every other type is one of the built-in singletons.  This includes
+       * the built-in structures such as gl_DepthRangeParameters.
+       */
+      assert(glsl_type::get_builtin_instance(type->name) == type);
+      out->write_uint(GLSL_TYPE_VOID);
+      out->write_string(type->name);
+   }
+}
+
+
+void
+ir_serializer::write_variable(ir_variable *var)
+{
+   assert(hash_table_find(variables, var) == NULL);
+   hash_table_insert(variables, (void *) intptr_t(++num_variables), var);
+
+   out->write_string(var->name);
+   write_type(var->type);
+
+   const uint32_t flags = (var->read_only << 0)
+      | (var->centroid << 1)
+      | (var->invariant << 2)
+      | (var->used << 3)
+      | (var->assigned << 4)
+      | (var->origin_upper_left << 5)
+      | (var->pixel_center_integer << 6)
+      | (var->explicit_location << 7)
+      | (var->explicit_index << 8)
+      | (var->has_initializer << 9);
+
+   out->write_uint(flags);
+   out->write_uint(var->mode);
+   out->write_uint(var->interpolation);
+   out->write_uint(var->depth_layout);
+   out->write_uint(var->max_array_access);
+   out->write_int(var->location);
+   out->write_int(var->index);
+   write_rvalue(var->constant_value);
+   write_rvalue(var->constant_initializer);
+}
+
+
+void
+ir_serializer::write_variable_ref(ir_variable *var)
+{
+   const intptr_t id = intptr_t(hash_table_find(variables, var));
+
+   if (id != 0) {
+      out->write_uint(id);
+   } else {
+      /* The variable is referenced without having been declared in the
+       * instruction stream.  Emit the declaration in place.
+       */
+      out->write_uint(0);
+      write_variable(var);
+   }
+}
+
+
+void
+ir_serializer::write_constant(ir_constant *ir)
+{
+   write_type(ir->type);
+
+   if (ir->type->is_array()) {
+      for (unsigned i = 0; i < ir->type->length; i++)
+	 write_constant(ir->array_elements[i]);
+   } else if (ir->type->is_record()) {
+      foreach_list(node, &ir->components) {
+	 write_constant((ir_constant *) node);
+      }
+   } else {
+      for (unsigned i = 0; i < ir->type->components(); i++)
+	 out->write_uint(ir->type->base_type == GLSL_TYPE_BOOL
+			 ? ir->value.b[i] : ir->value.u[i]);
+   }
+}
+
+
+void
+ir_serializer::write_rvalue(ir_rvalue *ir)
+{
+   if (ir == NULL)
+      out->write_uint(NODE_NONE);
+   else
+      write_instruction(ir);
+}
+
+
+void
+ir_serializer::write_instructions(exec_list *list)
+{
+   foreach_list(node, list) {
+      write_instruction((ir_instruction *) node);
+   }
+
+   out->write_uint(NODE_NONE);
+}
+
+
+void
+ir_serializer::write_instruction(ir_instruction *ir)
+{
+   out->write_uint(ir->ir_type);
+
+   switch (ir->ir_type) {
+   case ir_type_variable:
+      write_variable((ir_variable *) ir);
+      break;
+
+   case ir_type_function: {
+      ir_function *f = (ir_function *) ir;
+
+      foreach_list(node, &f->signatures) {
+	 ir_function_signature *sig = (ir_function_signature *) node;
+	 const intptr_t id = intptr_t(hash_table_find(signatures, sig));
+
+	 assert(id != 0);
+	 out->write_uint(id);
+	 write_instructions(&sig->body);
+      }
+      out->write_uint(0);
+      break;
+   }
+
+   case ir_type_assignment: {
+      ir_assignment *a = (ir_assignment *) ir;
+
+      write_rvalue(a->lhs);
+      write_rvalue(a->rhs);
+      write_rvalue(a->condition);
+      out->write_uint(a->write_mask);
+      break;
+   }
+
+   case ir_type_call: {
+      ir_call *call = (ir_call *) ir;
+      const intptr_t id = intptr_t(hash_table_find(signatures, call->callee));
+
+      /* After linking, every called function must be defined in the same
+       * shader.
+       */
+      if (id == 0) {
+	 failed = true;
+	 out->write_uint(0);
+	 break;
+      }
+
+      out->write_uint(id);
+      write_rvalue(call->return_deref);
+      write_instructions(&call->actual_parameters);
+      break;
+   }
+
+   case ir_type_constant:
+      write_constant((ir_constant *) ir);
+      break;
+
+   case ir_type_dereference_array: {
+      ir_dereference_array *d = (ir_dereference_array *) ir;
+
+      write_rvalue(d->array);
+      write_rvalue(d->array_index);
+      break;
+   }
+
+   case ir_type_dereference_record: {
+      ir_dereference_record *d = (ir_dereference_record *) ir;
+
+      write_rvalue(d->record);
+      out->write_string(d->field);
+      break;
+   }
+
+   case ir_type_dereference_variable:
+      write_variable_ref(((ir_dereference_variable *) ir)->var);
+      break;
+
+   case ir_type_discard:
+      write_rvalue(((ir_discard *) ir)->condition);
+      break;
+
+   case ir_type_expression: {
+      ir_expression *expr = (ir_expression *) ir;
+
+      out->write_uint(expr->operation);
+      write_type(expr->type);
+      for (unsigned i = 0; i < Elements(expr->operands); i++)
+	 write_rvalue(expr->operands[i]);
+      break;
+   }
+
+   case ir_type_if: {
+      ir_if *iff = (ir_if *) ir;
+
+      write_rvalue(iff->condition);
+      write_instructions(&iff->then_instructions);
+      write_instructions(&iff->else_instructions);
+      break;
+   }
+
+   case ir_type_loop: {
+      ir_loop *loop = (ir_loop *) ir;
+
+      if (loop->counter != NULL) {
+	 out->write_uint(1);
+	 write_variable_ref(loop->counter);
+      } else {
+	 out->write_uint(0);
+      }
+      write_rvalue(loop->from);
+      write_rvalue(loop->to);
+      write_rvalue(loop->increment);
+      out->write_int(loop->cmp);
+      write_instructions(&loop->body_instructions);
+      break;
+   }
+
+   case ir_type_loop_jump:
+      out->write_uint(((ir_loop_jump *) ir)->mode);
+      break;
+
+   case ir_type_return:
+      write_rvalue(((ir_return *) ir)->value);
+      break;
+
+   case ir_type_swizzle: {
+      ir_swizzle *swiz = (ir_swizzle *) ir;
+
+      out->write_uint(swiz->mask.x | (swiz->mask.y << 2) | (swiz->mask.z << 4)
+		      | (swiz->mask.w << 6)
+		      | (swiz->mask.num_components << 8));
+      write_rvalue(swiz->val);
+      break;
+   }
+
+   case ir_type_texture: {
+      ir_texture *tex = (ir_texture *) ir;
+
+      out->write_uint(tex->op);
+      write_type(tex->type);
+      write_rvalue(tex->sampler);
+      write_rvalue(tex->coordinate);
+      write_rvalue(tex->projector);
+      write_rvalue(tex->shadow_comparitor);
+      write_rvalue(tex->offset);
+
+      switch (tex->op) {
+      case ir_tex:
+	 break;
+      case ir_txb:
+	 write_rvalue(tex->lod_info.bias);
+	 break;
+      case ir_txl:
+      case ir_txf:
+      case ir_txs:
+	 write_rvalue(tex->lod_info.lod);
+	 break;
+      case ir_txd:
+	 write_rvalue(tex->lod_info.grad.dPdx);
+	 write_rvalue(tex->lod_info.grad.dPdy);
+	 break;
+      }
+      break;
+   }
+
+   default:
+      /* Function signatures only appear inside functions, and everything
+       * else has been handled above.
+       */
+      assert(!"Unexpected IR node in linked shader");
+      failed = true;
+      break;
+   }
+}
+
+
+void
+ir_serializer::write_shader(exec_list *instructions)
+{
+   /* Write every function signature ahead of the instruction stream.  This
+    * lets calls refer to their callee by index, even when the callee is
+    * defined after the caller.
+    */
+   unsigned num_functions = 0;
+   foreach_list(node, instructions) {
+      if (((ir_instruction *) node)->ir_type == ir_type_function)
+	 num_functions++;
+   }
+
+   out->write_uint(num_functions);
+   foreach_list(node, instructions) {
+      ir_function *const f = ((ir_instruction *) node)->as_function();
+      if (f == NULL)
+	 continue;
+
+      out->write_string(f->name);
+      foreach_list(sig_node, &f->signatures) {
+	 ir_function_signature *sig = (ir_function_signature *) sig_node;
+
+	 hash_table_insert(signatures, (void *) intptr_t(++num_signatures),
+			   sig);
+
+	 out->write_uint(1);
+	 write_type(sig->return_type);
+	 out->write_uint(sig->is_defined);
+	 out->write_uint(sig->is_builtin);
+
+	 foreach_list(param_node, &sig->parameters) {
+	    out->write_uint(1);
+	    write_variable((ir_variable *) param_node);
+	 }
+	 out->write_uint(0);
+      }
+      out->write_uint(0);
+   }
+
+   write_instructions(instructions);
+}
+
+
+/**
+ * Rebuilds the IR written by \c ir_serializer
+ *
+ * Any inconsistency in the data causes \c failed to be set.  The partially
+ * built IR is then garbage, but it is still safe to free.
+ */
+class ir_deserializer {
+public:
+   ir_deserializer(binary_reader *in, void *mem_ctx)
+      : in(in), mem_ctx(mem_ctx), failed(false)
+   {
+      /* empty */
+   }
+
+   bool read_shader(exec_list *instructions);
+
+private:
+   const glsl_type *read_type();
+   ir_variable *read_variable();
+   ir_variable *read_variable_ref();
+   bool read_instructions(exec_list *list);
+   ir_instruction *read_instruction(unsigned type);
+   ir_rvalue *read_rvalue();
+   ir_constant *read_constant();
+
+   /** Flags the input as invalid and returns \c NULL for convenience */
+   ir_instruction *fail()
+   {
+      failed = true;
+      return NULL;
+   }
+
+   binary_reader *in;
+   void *mem_ctx;
+   bool failed;
+
+   ir_variable **variables;
+   unsigned num_variables;
+
+   ir_function **functions;
+   unsigned num_functions;
+   unsigned next_function;
+
+   ir_function_signature **signatures;
+   unsigned num_signatures;
+};
+
+
+const glsl_type *
+ir_deserializer::read_type()
+{
+   const unsigned base_type = in->read_uint();
+
+   switch (base_type) {
+   case GLSL_TYPE_ARRAY: {
+      const unsigned length = in->read_uint();
+      const glsl_type *element = read_type();
+      if (element == NULL)
+	 return NULL;
+
+      return glsl_type::get_array_instance(element, length);
+   }
+
+   case GLSL_TYPE_STRUCT: {
+      const char *name = in->read_string(mem_ctx);
+      const unsigned length = in->read_uint();
+      if (name == NULL || in->overrun || length > unsigned(in->end - in->cur))
+	 return NULL;
+
+      glsl_struct_field *fields =
+	 ralloc_array(mem_ctx, glsl_struct_field, length);
+      for (unsigned i = 0; i < length; i++) {
+	 fields[i].name = in->read_string(mem_ctx);
+	 fields[i].type = read_type();
+	 if (fields[i].name == NULL || fields[i].type == NULL)
+	    return NULL;
+      }
+
+      return glsl_type::get_record_instance(fields, length, name);
+   }
+
+   case GLSL_TYPE_VOID: {
+      const char *name = in->read_string(mem_ctx);
+      return name ? glsl_type::get_builtin_instance(name) : NULL;
+   }
+
+   default:
+      return NULL;
+   }
+}
+
+
+ir_variable *
+ir_deserializer::read_variable()
+{
+   const char *name = in->read_string(mem_ctx);
+   const glsl_type *type = read_type();
+   const uint32_t flags = in->read_uint();
+   const unsigned mode = in->read_uint();
+   const unsigned interpolation = in->read_uint();
+   const unsigned depth_layout = in->read_uint();
+   const unsigned max_array_access = in->read_uint();
+   const int location = in->read_int();
+   const int index = in->read_int();
+
+   if (type == NULL || mode > ir_var_temporary
+       || interpolation > INTERP_QUALIFIER_NOPERSPECTIVE
+       || depth_layout > ir_depth_layout_unchanged) {
+      fail();
+      return NULL;
+   }
+
+   ir_variable *var =
+      new(mem_ctx) ir_variable(type, name, ir_variable_mode(mode));
+
+   var->read_only = (flags >> 0) & 1;
+   var->centroid = (flags >> 1) & 1;
+   var->invariant = (flags >> 2) & 1;
+   var->used = (flags >> 3) & 1;
+   var->assigned = (flags >> 4) & 1;
+   var->origin_upper_left = (flags >> 5) & 1;
+   var->pixel_center_integer = (flags >> 6) & 1;
+   var->explicit_location = (flags >> 7) & 1;
+   var->explicit_index = (flags >> 8) & 1;
+   var->has_initializer = (flags >> 9) & 1;
+   var->interpolation = interpolation;
+   var->depth_layout = ir_depth_layout(depth_layout);
+   var->max_array_access = max_array_access;
+   var->location = location;
+   var->index = index;
+
+   /* Register the variable before reading the initializers so that indices
+    * stay in step with the writer.
+    */
+   variables = reralloc(mem_ctx, variables, ir_variable *, num_variables + 1);
+   variables[num_variables++] = var;
+
+   ir_rvalue *value = read_rvalue();
+   ir_rvalue *initializer = read_rvalue();
+   if ((value != NULL && value->as_constant() == NULL)
+       || (initializer != NULL && initializer->as_constant() == NULL)) {
+      fail();
+      return NULL;
+   }
+
+   var->constant_value = (ir_constant *) value;
+   var->constant_initializer = (ir_constant *) initializer;
+   return var;
+}
+
+
+ir_variable *
+ir_deserializer::read_variable_ref()
+{
+   const unsigned id = in->read_uint();
+
+   if (id == 0)
+      return read_variable();
+
+   if (id > num_variables) {
+      fail();
+      return NULL;
+   }
+
+   return variables[id - 1];
+}
+
+
+ir_constant *
+ir_deserializer::read_constant()
+{
+   const glsl_type *type = read_type();
+   if (type == NULL)
+      return (ir_constant *) fail();
+
+   if (type->is_array() || type->is_record()) {
+      exec_list values;
+
+      for (unsigned i = 0; i < type->length; i++) {
+	 ir_constant *c = read_constant();
+	 if (c == NULL)
+	    return NULL;
+
+	 values.push_tail(c);
+      }
+
+      return new(mem_ctx) ir_constant(type, &values);
+   }
+
+   if (!type->is_scalar() && !type->is_vector() && !type->is_matrix())
+      return (ir_constant *) fail();
+
+   ir_constant_data data;
+   memset(&data, 0, sizeof(data));
+   for (unsigned i = 0; i < type->components(); i++) {
+      if (type->base_type == GLSL_TYPE_BOOL)
+	 data.b[i] = in->read_uint() != 0;
+      else
+	 data.u[i] = in->read_uint();
+   }
+
+   return new(mem_ctx) ir_constant(type, &data);
+}
+
+
+ir_rvalue *
+ir_deserializer::read_rvalue()
+{
+   const unsigned type = in->read_uint();
+   if (type == NODE_NONE || failed || in->overrun)
+      return NULL;
+
+   ir_instruction *ir = read_instruction(type);
+   if (ir == NULL)
+      return NULL;
+
+   ir_rvalue *rv = ir->as_rvalue();
+   if (rv == NULL)
+      fail();
+
+   return rv;
+}
+
+
+bool
+ir_deserializer::read_instructions(exec_list *list)
+{
+   for (;;) {
+      const unsigned type = in->read_uint();
+      if (type == NODE_NONE || failed || in->overrun)
+	 break;
+
+      ir_instruction *ir = read_instruction(type);
+      if (ir == NULL)
+	 break;
+
+      list->push_tail(ir);
+   }
+
+   return !failed && !in->overrun;
+}
+
+
+ir_instruction *
+ir_deserializer::read_instruction(unsigned type)
+{
+   switch (type) {
+   case ir_type_variable:
+      return read_variable();
+
+   case ir_type_function: {
+      /* The functions were created up front, in the same order that they
+       * appear in the instruction stream.  Attach the signature bodies.
+       */
+      if (next_function >= num_functions)
+	 return fail();
+
+      ir_function *f = functions[next_function++];
+
+      for (;;) {
+	 const unsigned id = in->read_uint();
+	 if (id == 0 || in->overrun)
+	    break;
+
+	 if (id > num_signatures || signatures[id - 1]->function() != f)
+	    return fail();
+
+	 if (!read_instructions(&signatures[id - 1]->body))
+	    return fail();
+      }
+
+      return f;
+   }
+
+   case ir_type_assignment: {
+      ir_rvalue *lhs = read_rvalue();
+      ir_rvalue *rhs = read_rvalue();
+      ir_rvalue *condition = read_rvalue();
+      const unsigned write_mask = in->read_uint();
+
+      if (lhs == NULL || lhs->as_dereference() == NULL || rhs == NULL)
+	 return fail();
+
+      return new(mem_ctx) ir_assignment(lhs->as_dereference(), rhs,
+					condition, write_mask);
+   }
+
+   case ir_type_call: {
+      const unsigned id = in->read_uint();
+      if (id == 0 || id > num_signatures)
+	 return fail();
+
+      ir_rvalue *ret = read_rvalue();
+      exec_list parameters;
+      if (!read_instructions(&parameters))
+	 return fail();
+
+      if (ret != NULL && ret->as_dereference_variable() == NULL)
+	 return fail();
+
+      return new(mem_ctx) ir_call(signatures[id - 1],
+				  ret ? ret->as_dereference_variable() : NULL,
+				  &parameters);
+   }
+
+   case ir_type_constant:
+      return read_constant();
+
+   case ir_type_dereference_array: {
+      ir_rvalue *array = read_rvalue();
+      ir_rvalue *index = read_rvalue();
+
+      if (array == NULL || index == NULL)
+	 return fail();
+
+      return new(mem_ctx) ir_dereference_array(array, index);
+   }
+
+   case ir_type_dereference_record: {
+      ir_rvalue *record = read_rvalue();
+      const char *field = in->read_string(mem_ctx);
+
+      if (record == NULL || field == NULL)
+	 return fail();
+
+      return new(mem_ctx) ir_dereference_record(record, field);
+   }
+
+   case ir_type_dereference_variable: {
+      ir_variable *var = read_variable_ref();
+
+      return var ? new(mem_ctx) ir_dereference_variable(var) : fail();
+   }
+
+   case ir_type_discard:
+      return new(mem_ctx) ir_discard(read_rvalue());
+
+   case ir_type_expression: {
+      const unsigned op = in->read_uint();
+      const glsl_type *type = read_type();
+      ir_rvalue *operands[4];
+
+      for (unsigned i = 0; i < Elements(operands); i++)
+	 operands[i] = read_rvalue();
+
+      if (op > ir_last_opcode || type == NULL || operands[0] == NULL)
+	 return fail();
+
+      ir_expression *expr = new(mem_ctx) ir_expression(op, type,
+						       operands[0],
+						       operands[1],
+						       operands[2],
+						       operands[3]);
+      for (unsigned i = 0; i < expr->get_num_operands(); i++) {
+	 if (expr->operands[i] == NULL)
+	    return fail();
+      }
+
+      return expr;
+   }
+
+   case ir_type_if: {
+      ir_rvalue *condition = read_rvalue();
+      if (condition == NULL)
+	 return fail();
+
+      ir_if *iff = new(mem_ctx) ir_if(condition);
+      if (!read_instructions(&iff->then_instructions)
+	  || !read_instructions(&iff->else_instructions))
+	 return fail();
+
+      return iff;
+   }
+
+   case ir_type_loop: {
+      ir_loop *loop = new(mem_ctx) ir_loop();
+
+      if (in->read_uint() != 0) {
+	 loop->counter = read_variable_ref();
+	 if (loop->counter == NULL)
+	    return fail();
+      }
+      loop->from = read_rvalue();
+      loop->to = read_rvalue();
+      loop->increment = read_rvalue();
+      loop->cmp = in->read_int();
+
+      if (!read_instructions(&loop->body_instructions))
+	 return fail();
+
+      return loop;
+   }
+
+   case ir_type_loop_jump: {
+      const unsigned mode = in->read_uint();
+      if (mode > ir_loop_jump::jump_continue)
+	 return fail();
+
+      return new(mem_ctx) ir_loop_jump(ir_loop_jump::jump_mode(mode));
+   }
+
+   case ir_type_return: {
+      ir_rvalue *value = read_rvalue();
+
+      return value ? new(mem_ctx) ir_return(value) : new(mem_ctx) ir_return();
+   }
+
+   case ir_type_swizzle: {
+      const unsigned mask = in->read_uint();
+      ir_rvalue *val = read_rvalue();
+      const unsigned count = (mask >> 8) & 7;
+
+      if (val == NULL || count == 0 || count > 4)
+	 return fail();
+
+      return new(mem_ctx) ir_swizzle(val, (mask >> 0) & 3, (mask >> 2) & 3,
+				     (mask >> 4) & 3, (mask >> 6) & 3, count);
+   }
+
+   case ir_type_texture: {
+      const unsigned op = in->read_uint();
+      const glsl_type *type = read_type();
+      ir_rvalue *sampler = read_rvalue();
+
+      if (op > ir_txs || type == NULL || sampler == NULL
+	  || sampler->as_dereference() == NULL)
+	 return fail();
+
+      ir_texture *tex = new(mem_ctx) ir_texture(ir_texture_opcode(op));
+      tex->set_sampler(sampler->as_dereference(), type);
+      tex->coordinate = read_rvalue();
+      tex->projector = read_rvalue();
+      tex->shadow_comparitor = read_rvalue();
+      tex->offset = read_rvalue();
+
+      switch (tex->op) {
+      case ir_tex:
+	 break;
+      case ir_txb:
+	 tex->lod_info.bias = read_rvalue();
+	 break;
+      case ir_txl:
+      case ir_txf:
+      case ir_txs:
+	 tex->lod_info.lod = read_rvalue();
+	 break;
+      case ir_txd:
+	 tex->lod_info.grad.dPdx = read_rvalue();
+	 tex->lod_info.grad.dPdy = read_rvalue();
+	 break;
+      }
+
+      return tex;
+   }
+
+   default:
+      return fail();
+   }
+}
+
+
+bool
+ir_deserializer::read_shader(exec_list *instructions)
+{
+   variables = NULL;
+   num_variables = 0;
+   signatures = NULL;
+   num_signatures = 0;
+
+   next_function = 0;
+   num_functions = in->read_uint();
+   if (num_functions > unsigned(in->end - in->cur))
+      return false;
+
+   functions = ralloc_array(mem_ctx, ir_function *, num_functions);
+   for (unsigned i = 0; i < num_functions; i++) {
+      functions[i] = new(mem_ctx) ir_function(in->read_string(mem_ctx));
+
+      while (in->read_uint() != 0 && !in->overrun) {
+	 const glsl_type *return_type = read_type();
+	 if (return_type == NULL)
+	    return false;
+
+	 ir_function_signature *sig =
+	    new(mem_ctx) ir_function_signature(return_type);
+	 sig->is_defined = in->read_uint() != 0;
+	 sig->is_builtin = in->read_uint() != 0;
+
+	 while (in->read_uint() != 0 && !in->overrun) {
+	    ir_variable *param = read_variable();
+	    if (param == NULL)
+	       return false;
+
+	    sig->parameters.push_tail(param);
+	 }
+
+	 functions[i]->add_signature(sig);
+
+	 signatures = reralloc(mem_ctx, signatures, ir_function_signature *,
+			       num_signatures + 1);
+	 signatures[num_signatures++] = sig;
+      }
+
+      if (functions[i]->name == NULL || in->overrun)
+	 return false;
+   }
+
+   return read_instructions(instructions);
+}
+
+} /* anonymous namespace */
+
+
+static void
+write_program(binary_writer *out, struct gl_shader_program *prog,
+	      bool *failed)
+{
+   const gl_transform_feedback_info *xfb = &prog->LinkedTransformFeedback;
+
+   out->write_uint(prog->Version);
+   out->write_uint(prog->NumUserUniformStorage);
+   out->write_uint(prog->FragDepthLayout);
+   out->write_uint(prog->Vert.UsesClipDistance);
+   out->write_uint(prog->Vert.ClipDistanceArraySize);
+   out->write_int(prog->Geom.VerticesOut);
+   out->write_uint(prog->Geom.InputType);
+   out->write_uint(prog->Geom.OutputType);
+
+   out->write_uint(xfb->NumBuffers);
+   for (unsigned i = 0; i < Elements(xfb->BufferStride); i++)
+      out->write_uint(xfb->BufferStride[i]);
+
+   out->write_uint(xfb->NumOutputs);
+   for (unsigned i = 0; i < xfb->NumOutputs; i++) {
+      out->write_uint(xfb->Outputs[i].OutputRegister);
+      out->write_uint(xfb->Outputs[i].OutputBuffer);
+      out->write_uint(xfb->Outputs[i].NumComponents);
+      out->write_uint(xfb->Outputs[i].DstOffset);
+      out->write_uint(xfb->Outputs[i].ComponentOffset);
+   }
+
+   out->write_int(xfb->NumVarying);
+   for (int i = 0; i < xfb->NumVarying; i++) {
+      out->write_string(xfb->Varyings[i].Name);
+      out->write_uint(xfb->Varyings[i].Type);
+      out->write_int(xfb->Varyings[i].Size);
+   }
+
+   for (unsigned i = 0; i < MESA_SHADER_TYPES; i++) {
+      gl_shader *sh = prog->_LinkedShaders[i];
+
+      if (sh == NULL) {
+	 out->write_uint(0);
+	 continue;
+      }
+
+      out->write_uint(sh->Type);
+      out->write_uint(sh->Version);
+
+      ir_serializer s(out);
+      s.write_shader(sh->ir);
+      if (s.failed)
+	 *failed = true;
+   }
+}
+
+
+static bool
+read_program(binary_reader *in, struct gl_context *ctx,
+	     struct gl_shader_program *prog, unsigned *num_uniforms)
+{
+   gl_transform_feedback_info *xfb = &prog->LinkedTransformFeedback;
+
+   prog->Version = in->read_uint();
+   *num_uniforms = in->read_uint();
+   prog->FragDepthLayout = gl_frag_depth_layout(in->read_uint());
+   prog->Vert.UsesClipDistance = in->read_uint() != 0;
+   prog->Vert.ClipDistanceArraySize = in->read_uint();
+   prog->Geom.VerticesOut = in->read_int();
+   prog->Geom.InputType = in->read_uint();
+   prog->Geom.OutputType = in->read_uint();
+
+   ralloc_free(xfb->Varyings);
+   ralloc_free(xfb->Outputs);
+   memset(xfb, 0, sizeof(*xfb));
+
+   xfb->NumBuffers = in->read_uint();
+   for (unsigned i = 0; i < Elements(xfb->BufferStride); i++)
+      xfb->BufferStride[i] = in->read_uint();
+
+   xfb->NumOutputs = in->read_uint();
+   if (in->overrun || xfb->NumOutputs > unsigned(in->end - in->cur))
+      return false;
+
+   xfb->Outputs = rzalloc_array(prog, struct gl_transform_feedback_output,
+				xfb->NumOutputs);
+   for (unsigned i = 0; i < xfb->NumOutputs; i++) {
+      xfb->Outputs[i].OutputRegister = in->read_uint();
+      xfb->Outputs[i].OutputBuffer = in->read_uint();
+      xfb->Outputs[i].NumComponents = in->read_uint();
+      xfb->Outputs[i].DstOffset = in->read_uint();
+      xfb->Outputs[i].ComponentOffset = in->read_uint();
+   }
+
+   xfb->NumVarying = in->read_int();
+   if (in->overrun || xfb->NumVarying < 0
+       || unsigned(xfb->NumVarying) > unsigned(in->end - in->cur))
+      return false;
+
+   xfb->Varyings = rzalloc_array(prog,
+				 struct gl_transform_feedback_varying_info,
+				 xfb->NumVarying);
+   for (int i = 0; i < xfb->NumVarying; i++) {
+      xfb->Varyings[i].Name = in->read_string(prog);
+      xfb->Varyings[i].Type = in->read_uint();
+      xfb->Varyings[i].Size = in->read_int();
+   }
+
+   for (unsigned i = 0; i < MESA_SHADER_TYPES; i++) {
+      const GLenum type = in->read_uint();
+      if (type == 0)
+	 continue;
+
+      if (in->overrun
+	  || (type != GL_VERTEX_SHADER && type != GL_FRAGMENT_SHADER
+	      && type != GL_GEOMETRY_SHADER)
+	  || _mesa_shader_type_to_index(type) != i)
+	 return false;
+
+      gl_shader *sh = ctx->Driver.NewShader(NULL, 0, type);
+      _mesa_reference_shader(ctx, &prog->_LinkedShaders[i], sh);
+
+      sh->Version = in->read_uint();
+      sh->CompileStatus = GL_TRUE;
+      sh->ir = new(sh) exec_list;
+
+      ir_deserializer d(in, sh->ir);
+      if (!d.read_shader(sh->ir) || !is_valid_ir_tree(sh->ir))
+	 return false;
+   }
+
+   return !in->overrun && in->cur == in->end;
+}
+
+
+/**
+ * Serialize a linked program
+ *
+ * This must be called after \c link_shaders succeeds and before the driver
+ * sees the IR.
+ *
+ * \return
+ * A buffer allocated from \c mem_ctx, or \c NULL if the program cannot be
+ * serialized.
+ */
+void *
+serialize_program(void *mem_ctx, struct gl_shader_program *prog,
+		  const unsigned char *build_id, unsigned *size)
+{
+   binary_writer out(mem_ctx);
+   bool failed = false;
+
+   out.write_uint(PROGRAM_BINARY_MAGIC);
+   out.write_uint(PROGRAM_BINARY_VERSION);
+   out.write_bytes(build_id, PROGRAM_BINARY_BUILD_ID_SIZE);
+   out.write_uint(ir_last_opcode);
+
+   /* Placeholder for the checksum of everything that follows. */
+   const unsigned checksum_offset = out.size;
+   out.write_uint(0);
+
+   write_program(&out, prog, &failed);
+
+   if (failed) {
+      ralloc_free(out.data);
+      return NULL;
+   }
+
+   const uint32_t sum = checksum(out.data + checksum_offset + 4,
+				 out.size - checksum_offset - 4);
+   memcpy(out.data + checksum_offset, &sum, sizeof(sum));
+
+   *size = out.size;
+   return out.data;
+}
+
+
+/**
+ * Load a program previously written by \c serialize_program
+ *
+ * On success, \c prog is left in the same state that \c link_shaders would
+ * have left it in, and \c prog->LinkStatus is set.  Otherwise a message is
+ * added to the info log.
+ */
+void
+deserialize_program(struct gl_context *ctx, struct gl_shader_program *prog,
+		    const unsigned char *build_id,
+		    const void *binary, unsigned size)
+{
+   binary_reader in((const uint8_t *) binary, size);
+   void *mem_ctx = ralloc_context(NULL);
+
+   prog->LinkStatus = false;
+   prog->Validated = false;
+   prog->_Used = false;
+
+   for (unsigned i = 0; i < MESA_SHADER_TYPES; i++) {
+      if (prog->_LinkedShaders[i] != NULL)
+	 ctx->Driver.DeleteShader(ctx, prog->_LinkedShaders[i]);
+
+      prog->_LinkedShaders[i] = NULL;
+   }
+
+   unsigned char id[PROGRAM_BINARY_BUILD_ID_SIZE];
+   const uint32_t magic = in.read_uint();
+   const uint32_t version = in.read_uint();
+   in.read_bytes(id, sizeof(id));
+   const uint32_t num_opcodes = in.read_uint();
+   const uint32_t sum = in.read_uint();
+
+   if (in.overrun || magic != PROGRAM_BINARY_MAGIC
+       || version != PROGRAM_BINARY_VERSION
+       || memcmp(id, build_id, sizeof(id)) != 0
+       || num_opcodes != ir_last_opcode) {
+      linker_error(prog, "program binary was created by a different "
+		   "version of Mesa\n");
+      goto done;
+   }
+
+   if (checksum(in.cur, in.end - in.cur) != sum) {
+      linker_error(prog, "program binary is corrupt\n");
+      goto done;
+   }
+
+   unsigned num_uniforms;
+   if (!read_program(&in, ctx, prog, &num_uniforms)) {
+      linker_error(prog, "program binary is corrupt\n");
+      goto done;
+   }
+
+   link_assign_uniform_locations(prog);
+   if (prog->NumUserUniformStorage != num_uniforms) {
+      linker_error(prog, "program binary has an inconsistent uniform "
+		   "layout\n");
+      goto done;
+   }
+
+   prog->LinkStatus = true;
+
+done:
+   if (!prog->LinkStatus) {
+      for (unsigned i = 0; i < MESA_SHADER_TYPES; i++) {
+	 if (prog->_LinkedShaders[i] != NULL)
+	    ctx->Driver.DeleteShader(ctx, prog->_LinkedShaders[i]);
+
+	 prog->_LinkedShaders[i] = NULL;
+      }
+   }
+
+   ralloc_free(mem_ctx);
+}
@@ -488,3 +488,84 @@ ralloc_vasprintf_rewrite_tail(char **str, size_t *start, const char *fmt,
    *start += new_length;
    return true;
 }
+
+/* Arena allocation */
+
+#define ARENA_BLOCK_SIZE 8192
+
+/* Allocations larger than this get a block of their own, so that they don't
+ * waste what is left of the current block.
+ */
+#define ARENA_MAX_SMALL_SIZE (ARENA_BLOCK_SIZE / 4)
+
+struct ralloc_arena
+{
+   /* Unused part of the current block */
+   char *next;
+   size_t remaining;
+};
+
+void *
+ralloc_arena_context(const void *ctx)
+{
+   struct ralloc_arena *arena = ralloc(ctx, struct ralloc_arena);
+   if (unlikely(arena == NULL))
+      return NULL;
+
+   arena->next = NULL;
+   arena->remaining = 0;
+   return arena;
+}
+
+void *
+ralloc_arena_size(void *ctx, size_t size)
+{
+   struct ralloc_arena *arena = (struct ralloc_arena *) ctx;
+   void *ptr;
+
+   size = (size + 7) & ~(size_t) 7;
+
+   if (unlikely(size > arena->remaining)) {
+      if (size > ARENA_MAX_SMALL_SIZE)
+	 return ralloc_size(arena, size);
+
+      arena->next = ralloc_size(arena, ARENA_BLOCK_SIZE);
+      if (unlikely(arena->next == NULL)) {
+	 arena->remaining = 0;
+	 return NULL;
+      }
+      arena->remaining = ARENA_BLOCK_SIZE;
+   }
+
+   ptr = arena->next;
+   arena->next += size;
+   arena->remaining -= size;
+   return ptr;
+}
+
+void *
+rzalloc_arena_size(void *arena, size_t size)
+{
+   void *ptr = ralloc_arena_size(arena, size);
+   if (likely(ptr != NULL))
+      memset(ptr, 0, size);
+   return ptr;
+}
+
+char *
+ralloc_arena_strdup(void *arena, const char *str)
+{
+   size_t n;
+   char *ptr;
+
+   if (unlikely(str == NULL))
+      return NULL;
+
+   n = strlen(str);
+   ptr = ralloc_arena_size(arena, n + 1);
+   if (likely(ptr != NULL)) {
+      memcpy(ptr, str, n);
+      ptr[n] = '\0';
+   }
+   return ptr;
+}
@@ -397,6 +397,40 @@ bool ralloc_asprintf_append (char **str, const char *fmt, ...);
 bool ralloc_vasprintf_append(char **str, const char *fmt, va_list args);
 /// @}
 
+/// \defgroup arena Arena Allocators @{
+/**
+ * Create an arena, a context for many small allocations that all share its
+ * lifetime.
+ *
+ * Memory allocated from an arena is carved out of large blocks instead of
+ * getting its own ralloc header, which makes it much cheaper in both time
+ * and space.  The price is that it is only ever released all at once, by
+ * freeing the arena (or one of its ancestors).  Arena memory must therefore
+ * not be passed to \c ralloc_free, \c ralloc_steal, \c reralloc or
+ * \c ralloc_parent, nor be used as the context of other allocations.
+ *
+ * The arena itself is an ordinary ralloc context chained off of \p ctx.
+ */
+void *ralloc_arena_context(const void *ctx);
+
+/**
+ * Allocate memory from an arena.
+ *
+ * The memory is suitably aligned for any pointer or double.
+ */
+void *ralloc_arena_size(void *arena, size_t size);
+
+/**
+ * Allocate zero-initialized memory from an arena.
+ */
+void *rzalloc_arena_size(void *arena, size_t size);
+
+/**
+ * Duplicate a string, allocating the memory from an arena.
+ */
+char *ralloc_arena_strdup(void *arena, const char *str);
+/// @}
+
 #ifdef __cplusplus
 } /* end of extern "C" */
 #endif
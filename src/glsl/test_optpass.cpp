@@ -62,8 +62,11 @@ do_optimization(struct exec_list *ir, const char *optimization)
    int int_3;
    int int_4;
 
-   if (sscanf(optimization, "do_common_optimization ( %d , %d ) ",
+   if (sscanf(optimization, "do_common_optimization_loop ( %d , %d ) ",
               &int_0, &int_1) == 2) {
+      return do_common_optimization_loop(ir, int_0 != 0, false, int_1);
+   } else if (sscanf(optimization, "do_common_optimization ( %d , %d ) ",
+                     &int_0, &int_1) == 2) {
       return do_common_optimization(ir, int_0 != 0, false, int_1);
    } else if (strcmp(optimization, "do_algebraic") == 0) {
       return do_algebraic(ir);
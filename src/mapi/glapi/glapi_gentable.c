@@ -5624,6 +5624,13 @@ _glapi_create_table_from_handle(void *handle, const char *symbol_prefix) {
     }
 
 
+    if(!disp->ProgramParameteriARB) {
+        void ** procp = (void **) &disp->ProgramParameteriARB;
+        snprintf(symboln, sizeof(symboln), "%sProgramParameteri", symbol_prefix);
+        *procp = dlsym(handle, symboln);
+    }
+
+
     if(!disp->VertexAttribDivisorARB) {
         void ** procp = (void **) &disp->VertexAttribDivisorARB;
         snprintf(symboln, sizeof(symboln), "%sVertexAttribDivisorARB", symbol_prefix);
@@ -6275,6 +6282,20 @@ _glapi_create_table_from_handle(void *handle, const char *symbol_prefix) {
     }
 
 
+    if(!disp->GetProgramBinary) {
+        void ** procp = (void **) &disp->GetProgramBinary;
+        snprintf(symboln, sizeof(symboln), "%sGetProgramBinary", symbol_prefix);
+        *procp = dlsym(handle, symboln);
+    }
+
+
+    if(!disp->ProgramBinary) {
+        void ** procp = (void **) &disp->ProgramBinary;
+        snprintf(symboln, sizeof(symboln), "%sProgramBinary", symbol_prefix);
+        *procp = dlsym(handle, symboln);
+    }
+
+
     if(!disp->DebugMessageCallbackARB) {
         void ** procp = (void **) &disp->DebugMessageCallbackARB;
         snprintf(symboln, sizeof(symboln), "%sDebugMessageCallbackARB", symbol_prefix);
@@ -718,6 +718,8 @@ static const char gl_string_table[] =
     "glGetShaderPrecisionFormat\0"
     "glReleaseShaderCompiler\0"
     "glShaderBinary\0"
+    "glGetProgramBinary\0"
+    "glProgramBinary\0"
     "glDebugMessageCallbackARB\0"
     "glDebugMessageControlARB\0"
     "glDebugMessageInsertARB\0"
@@ -1239,6 +1241,7 @@ static const char gl_string_table[] =
     "glDrawElementsInstancedEXT\0"
     "glDrawElementsInstanced\0"
     "glRenderbufferStorageMultisampleEXT\0"
+    "glProgramParameteri\0"
     "glTexBuffer\0"
     "glBlendEquationSeparateIndexedAMD\0"
     "glBlendEquationIndexedAMD\0"
@@ -1413,17 +1416,17 @@ static const char gl_string_table[] =
 #define gl_dispatch_stub_364 mgl_dispatch_stub_364
 #define gl_dispatch_stub_365 mgl_dispatch_stub_365
 #define gl_dispatch_stub_366 mgl_dispatch_stub_366
-#define gl_dispatch_stub_697 mgl_dispatch_stub_697
-#define gl_dispatch_stub_698 mgl_dispatch_stub_698
+#define gl_dispatch_stub_666 mgl_dispatch_stub_666
+#define gl_dispatch_stub_667 mgl_dispatch_stub_667
 #define gl_dispatch_stub_699 mgl_dispatch_stub_699
 #define gl_dispatch_stub_700 mgl_dispatch_stub_700
 #define gl_dispatch_stub_701 mgl_dispatch_stub_701
 #define gl_dispatch_stub_702 mgl_dispatch_stub_702
 #define gl_dispatch_stub_703 mgl_dispatch_stub_703
 #define gl_dispatch_stub_704 mgl_dispatch_stub_704
-#define gl_dispatch_stub_739 mgl_dispatch_stub_739
-#define gl_dispatch_stub_781 mgl_dispatch_stub_781
-#define gl_dispatch_stub_782 mgl_dispatch_stub_782
+#define gl_dispatch_stub_705 mgl_dispatch_stub_705
+#define gl_dispatch_stub_706 mgl_dispatch_stub_706
+#define gl_dispatch_stub_741 mgl_dispatch_stub_741
 #define gl_dispatch_stub_783 mgl_dispatch_stub_783
 #define gl_dispatch_stub_784 mgl_dispatch_stub_784
 #define gl_dispatch_stub_785 mgl_dispatch_stub_785
@@ -1431,23 +1434,25 @@ static const char gl_string_table[] =
 #define gl_dispatch_stub_787 mgl_dispatch_stub_787
 #define gl_dispatch_stub_788 mgl_dispatch_stub_788
 #define gl_dispatch_stub_789 mgl_dispatch_stub_789
-#define gl_dispatch_stub_870 mgl_dispatch_stub_870
-#define gl_dispatch_stub_871 mgl_dispatch_stub_871
+#define gl_dispatch_stub_790 mgl_dispatch_stub_790
+#define gl_dispatch_stub_791 mgl_dispatch_stub_791
 #define gl_dispatch_stub_872 mgl_dispatch_stub_872
 #define gl_dispatch_stub_873 mgl_dispatch_stub_873
 #define gl_dispatch_stub_874 mgl_dispatch_stub_874
-#define gl_dispatch_stub_883 mgl_dispatch_stub_883
-#define gl_dispatch_stub_884 mgl_dispatch_stub_884
-#define gl_dispatch_stub_902 mgl_dispatch_stub_902
-#define gl_dispatch_stub_903 mgl_dispatch_stub_903
+#define gl_dispatch_stub_875 mgl_dispatch_stub_875
+#define gl_dispatch_stub_876 mgl_dispatch_stub_876
+#define gl_dispatch_stub_885 mgl_dispatch_stub_885
+#define gl_dispatch_stub_886 mgl_dispatch_stub_886
 #define gl_dispatch_stub_904 mgl_dispatch_stub_904
-#define gl_dispatch_stub_962 mgl_dispatch_stub_962
-#define gl_dispatch_stub_963 mgl_dispatch_stub_963
-#define gl_dispatch_stub_971 mgl_dispatch_stub_971
-#define gl_dispatch_stub_972 mgl_dispatch_stub_972
+#define gl_dispatch_stub_905 mgl_dispatch_stub_905
+#define gl_dispatch_stub_906 mgl_dispatch_stub_906
+#define gl_dispatch_stub_964 mgl_dispatch_stub_964
+#define gl_dispatch_stub_965 mgl_dispatch_stub_965
 #define gl_dispatch_stub_973 mgl_dispatch_stub_973
 #define gl_dispatch_stub_974 mgl_dispatch_stub_974
 #define gl_dispatch_stub_975 mgl_dispatch_stub_975
+#define gl_dispatch_stub_976 mgl_dispatch_stub_976
+#define gl_dispatch_stub_977 mgl_dispatch_stub_977
 #endif /* USE_MGL_NAMESPACE */
 
 
@@ -1465,41 +1470,43 @@ void GLAPIENTRY gl_dispatch_stub_363(GLenum target, GLenum pname, GLint * params
 void GLAPIENTRY gl_dispatch_stub_364(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values);
 void GLAPIENTRY gl_dispatch_stub_365(GLenum target, GLenum pname, GLfloat * params);
 void GLAPIENTRY gl_dispatch_stub_366(GLenum target, GLenum pname, GLint * params);
-void GLAPIENTRY gl_dispatch_stub_697(GLenum pname, GLfloat * params);
-void GLAPIENTRY gl_dispatch_stub_698(GLenum pname, GLint * params);
-void GLAPIENTRY gl_dispatch_stub_699(GLenum pname, GLfloat param);
-void GLAPIENTRY gl_dispatch_stub_700(GLenum pname, const GLfloat * params);
-void GLAPIENTRY gl_dispatch_stub_701(GLenum pname, GLint param);
-void GLAPIENTRY gl_dispatch_stub_702(GLenum pname, const GLint * params);
-void GLAPIENTRY gl_dispatch_stub_703(GLclampf value, GLboolean invert);
-void GLAPIENTRY gl_dispatch_stub_704(GLenum pattern);
-void GLAPIENTRY gl_dispatch_stub_739(GLenum mode);
-void GLAPIENTRY gl_dispatch_stub_781(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride);
-void GLAPIENTRY gl_dispatch_stub_782(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride);
-void GLAPIENTRY gl_dispatch_stub_783(GLsizei n, const GLuint * fences);
-void GLAPIENTRY gl_dispatch_stub_784(GLuint fence);
-void GLAPIENTRY gl_dispatch_stub_785(GLsizei n, GLuint * fences);
-void GLAPIENTRY gl_dispatch_stub_786(GLuint fence, GLenum pname, GLint * params);
-GLboolean GLAPIENTRY gl_dispatch_stub_787(GLuint fence);
-void GLAPIENTRY gl_dispatch_stub_788(GLuint fence, GLenum condition);
+void GLAPIENTRY gl_dispatch_stub_666(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, GLvoid * binary);
+void GLAPIENTRY gl_dispatch_stub_667(GLuint program, GLenum binaryFormat, const GLvoid * binary, GLsizei length);
+void GLAPIENTRY gl_dispatch_stub_699(GLenum pname, GLfloat * params);
+void GLAPIENTRY gl_dispatch_stub_700(GLenum pname, GLint * params);
+void GLAPIENTRY gl_dispatch_stub_701(GLenum pname, GLfloat param);
+void GLAPIENTRY gl_dispatch_stub_702(GLenum pname, const GLfloat * params);
+void GLAPIENTRY gl_dispatch_stub_703(GLenum pname, GLint param);
+void GLAPIENTRY gl_dispatch_stub_704(GLenum pname, const GLint * params);
+void GLAPIENTRY gl_dispatch_stub_705(GLclampf value, GLboolean invert);
+void GLAPIENTRY gl_dispatch_stub_706(GLenum pattern);
+void GLAPIENTRY gl_dispatch_stub_741(GLenum mode);
+void GLAPIENTRY gl_dispatch_stub_783(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride);
+void GLAPIENTRY gl_dispatch_stub_784(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride);
+void GLAPIENTRY gl_dispatch_stub_785(GLsizei n, const GLuint * fences);
+void GLAPIENTRY gl_dispatch_stub_786(GLuint fence);
+void GLAPIENTRY gl_dispatch_stub_787(GLsizei n, GLuint * fences);
+void GLAPIENTRY gl_dispatch_stub_788(GLuint fence, GLenum pname, GLint * params);
 GLboolean GLAPIENTRY gl_dispatch_stub_789(GLuint fence);
-void GLAPIENTRY gl_dispatch_stub_870(GLenum face);
-void GLAPIENTRY gl_dispatch_stub_871(GLuint array);
-void GLAPIENTRY gl_dispatch_stub_872(GLsizei n, const GLuint * arrays);
-void GLAPIENTRY gl_dispatch_stub_873(GLsizei n, GLuint * arrays);
-GLboolean GLAPIENTRY gl_dispatch_stub_874(GLuint array);
-void GLAPIENTRY gl_dispatch_stub_883(GLclampd zmin, GLclampd zmax);
-void GLAPIENTRY gl_dispatch_stub_884(GLenum modeRGB, GLenum modeA);
-void GLAPIENTRY gl_dispatch_stub_902(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
-void GLAPIENTRY gl_dispatch_stub_903(GLenum target, GLenum pname, GLint param);
-void GLAPIENTRY gl_dispatch_stub_904(GLenum target, GLintptr offset, GLsizeiptr size);
-void GLAPIENTRY gl_dispatch_stub_962(GLenum target, GLenum pname, GLvoid ** params);
-void GLAPIENTRY gl_dispatch_stub_963(GLenum target, GLsizei length, GLvoid * pointer);
-void GLAPIENTRY gl_dispatch_stub_971(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
-void GLAPIENTRY gl_dispatch_stub_972(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
-void GLAPIENTRY gl_dispatch_stub_973(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
-void GLAPIENTRY gl_dispatch_stub_974(GLuint id, GLenum pname, GLint64EXT * params);
-void GLAPIENTRY gl_dispatch_stub_975(GLuint id, GLenum pname, GLuint64EXT * params);
+void GLAPIENTRY gl_dispatch_stub_790(GLuint fence, GLenum condition);
+GLboolean GLAPIENTRY gl_dispatch_stub_791(GLuint fence);
+void GLAPIENTRY gl_dispatch_stub_872(GLenum face);
+void GLAPIENTRY gl_dispatch_stub_873(GLuint array);
+void GLAPIENTRY gl_dispatch_stub_874(GLsizei n, const GLuint * arrays);
+void GLAPIENTRY gl_dispatch_stub_875(GLsizei n, GLuint * arrays);
+GLboolean GLAPIENTRY gl_dispatch_stub_876(GLuint array);
+void GLAPIENTRY gl_dispatch_stub_885(GLclampd zmin, GLclampd zmax);
+void GLAPIENTRY gl_dispatch_stub_886(GLenum modeRGB, GLenum modeA);
+void GLAPIENTRY gl_dispatch_stub_904(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+void GLAPIENTRY gl_dispatch_stub_905(GLenum target, GLenum pname, GLint param);
+void GLAPIENTRY gl_dispatch_stub_906(GLenum target, GLintptr offset, GLsizeiptr size);
+void GLAPIENTRY gl_dispatch_stub_964(GLenum target, GLenum pname, GLvoid ** params);
+void GLAPIENTRY gl_dispatch_stub_965(GLenum target, GLsizei length, GLvoid * pointer);
+void GLAPIENTRY gl_dispatch_stub_973(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
+void GLAPIENTRY gl_dispatch_stub_974(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
+void GLAPIENTRY gl_dispatch_stub_975(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
+void GLAPIENTRY gl_dispatch_stub_976(GLuint id, GLenum pname, GLint64EXT * params);
+void GLAPIENTRY gl_dispatch_stub_977(GLuint id, GLenum pname, GLuint64EXT * params);
 #endif /* defined(NEED_FUNCTION_POINTER) || defined(GLX_INDIRECT_RENDERING) */
 
 static const glprocs_table_t static_functions[] = {
@@ -2169,684 +2176,687 @@ static const glprocs_table_t static_functions[] = {
     NAME_FUNC_OFFSET(10916, glGetShaderPrecisionFormat, glGetShaderPrecisionFormat, NULL, 663),
     NAME_FUNC_OFFSET(10943, glReleaseShaderCompiler, glReleaseShaderCompiler, NULL, 664),
     NAME_FUNC_OFFSET(10967, glShaderBinary, glShaderBinary, NULL, 665),
-    NAME_FUNC_OFFSET(10982, glDebugMessageCallbackARB, glDebugMessageCallbackARB, NULL, 666),
-    NAME_FUNC_OFFSET(11008, glDebugMessageControlARB, glDebugMessageControlARB, NULL, 667),
-    NAME_FUNC_OFFSET(11033, glDebugMessageInsertARB, glDebugMessageInsertARB, NULL, 668),
-    NAME_FUNC_OFFSET(11057, glGetDebugMessageLogARB, glGetDebugMessageLogARB, NULL, 669),
-    NAME_FUNC_OFFSET(11081, glGetGraphicsResetStatusARB, glGetGraphicsResetStatusARB, NULL, 670),
-    NAME_FUNC_OFFSET(11109, glGetnColorTableARB, glGetnColorTableARB, NULL, 671),
-    NAME_FUNC_OFFSET(11129, glGetnCompressedTexImageARB, glGetnCompressedTexImageARB, NULL, 672),
-    NAME_FUNC_OFFSET(11157, glGetnConvolutionFilterARB, glGetnConvolutionFilterARB, NULL, 673),
-    NAME_FUNC_OFFSET(11184, glGetnHistogramARB, glGetnHistogramARB, NULL, 674),
-    NAME_FUNC_OFFSET(11203, glGetnMapdvARB, glGetnMapdvARB, NULL, 675),
-    NAME_FUNC_OFFSET(11218, glGetnMapfvARB, glGetnMapfvARB, NULL, 676),
-    NAME_FUNC_OFFSET(11233, glGetnMapivARB, glGetnMapivARB, NULL, 677),
-    NAME_FUNC_OFFSET(11248, glGetnMinmaxARB, glGetnMinmaxARB, NULL, 678),
-    NAME_FUNC_OFFSET(11264, glGetnPixelMapfvARB, glGetnPixelMapfvARB, NULL, 679),
-    NAME_FUNC_OFFSET(11284, glGetnPixelMapuivARB, glGetnPixelMapuivARB, NULL, 680),
-    NAME_FUNC_OFFSET(11305, glGetnPixelMapusvARB, glGetnPixelMapusvARB, NULL, 681),
-    NAME_FUNC_OFFSET(11326, glGetnPolygonStippleARB, glGetnPolygonStippleARB, NULL, 682),
-    NAME_FUNC_OFFSET(11350, glGetnSeparableFilterARB, glGetnSeparableFilterARB, NULL, 683),
-    NAME_FUNC_OFFSET(11375, glGetnTexImageARB, glGetnTexImageARB, NULL, 684),
-    NAME_FUNC_OFFSET(11393, glGetnUniformdvARB, glGetnUniformdvARB, NULL, 685),
-    NAME_FUNC_OFFSET(11412, glGetnUniformfvARB, glGetnUniformfvARB, NULL, 686),
-    NAME_FUNC_OFFSET(11431, glGetnUniformivARB, glGetnUniformivARB, NULL, 687),
-    NAME_FUNC_OFFSET(11450, glGetnUniformuivARB, glGetnUniformuivARB, NULL, 688),
-    NAME_FUNC_OFFSET(11470, glReadnPixelsARB, glReadnPixelsARB, NULL, 689),
-    NAME_FUNC_OFFSET(11487, glTexStorage1D, glTexStorage1D, NULL, 690),
-    NAME_FUNC_OFFSET(11502, glTexStorage2D, glTexStorage2D, NULL, 691),
-    NAME_FUNC_OFFSET(11517, glTexStorage3D, glTexStorage3D, NULL, 692),
-    NAME_FUNC_OFFSET(11532, glTextureStorage1DEXT, glTextureStorage1DEXT, NULL, 693),
-    NAME_FUNC_OFFSET(11554, glTextureStorage2DEXT, glTextureStorage2DEXT, NULL, 694),
-    NAME_FUNC_OFFSET(11576, glTextureStorage3DEXT, glTextureStorage3DEXT, NULL, 695),
-    NAME_FUNC_OFFSET(11598, glPolygonOffsetEXT, glPolygonOffsetEXT, NULL, 696),
-    NAME_FUNC_OFFSET(11617, gl_dispatch_stub_697, gl_dispatch_stub_697, NULL, 697),
-    NAME_FUNC_OFFSET(11649, gl_dispatch_stub_698, gl_dispatch_stub_698, NULL, 698),
-    NAME_FUNC_OFFSET(11681, gl_dispatch_stub_699, gl_dispatch_stub_699, NULL, 699),
-    NAME_FUNC_OFFSET(11709, gl_dispatch_stub_700, gl_dispatch_stub_700, NULL, 700),
-    NAME_FUNC_OFFSET(11738, gl_dispatch_stub_701, gl_dispatch_stub_701, NULL, 701),
-    NAME_FUNC_OFFSET(11766, gl_dispatch_stub_702, gl_dispatch_stub_702, NULL, 702),
-    NAME_FUNC_OFFSET(11795, gl_dispatch_stub_703, gl_dispatch_stub_703, NULL, 703),
-    NAME_FUNC_OFFSET(11812, gl_dispatch_stub_704, gl_dispatch_stub_704, NULL, 704),
-    NAME_FUNC_OFFSET(11832, glColorPointerEXT, glColorPointerEXT, NULL, 705),
-    NAME_FUNC_OFFSET(11850, glEdgeFlagPointerEXT, glEdgeFlagPointerEXT, NULL, 706),
-    NAME_FUNC_OFFSET(11871, glIndexPointerEXT, glIndexPointerEXT, NULL, 707),
-    NAME_FUNC_OFFSET(11889, glNormalPointerEXT, glNormalPointerEXT, NULL, 708),
-    NAME_FUNC_OFFSET(11908, glTexCoordPointerEXT, glTexCoordPointerEXT, NULL, 709),
-    NAME_FUNC_OFFSET(11929, glVertexPointerEXT, glVertexPointerEXT, NULL, 710),
-    NAME_FUNC_OFFSET(11948, glPointParameterfEXT, glPointParameterfEXT, NULL, 711),
-    NAME_FUNC_OFFSET(11969, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 712),
-    NAME_FUNC_OFFSET(11991, glLockArraysEXT, glLockArraysEXT, NULL, 713),
-    NAME_FUNC_OFFSET(12007, glUnlockArraysEXT, glUnlockArraysEXT, NULL, 714),
-    NAME_FUNC_OFFSET(12025, glSecondaryColor3bEXT, glSecondaryColor3bEXT, NULL, 715),
-    NAME_FUNC_OFFSET(12047, glSecondaryColor3bvEXT, glSecondaryColor3bvEXT, NULL, 716),
-    NAME_FUNC_OFFSET(12070, glSecondaryColor3dEXT, glSecondaryColor3dEXT, NULL, 717),
-    NAME_FUNC_OFFSET(12092, glSecondaryColor3dvEXT, glSecondaryColor3dvEXT, NULL, 718),
-    NAME_FUNC_OFFSET(12115, glSecondaryColor3fEXT, glSecondaryColor3fEXT, NULL, 719),
-    NAME_FUNC_OFFSET(12137, glSecondaryColor3fvEXT, glSecondaryColor3fvEXT, NULL, 720),
-    NAME_FUNC_OFFSET(12160, glSecondaryColor3iEXT, glSecondaryColor3iEXT, NULL, 721),
-    NAME_FUNC_OFFSET(12182, glSecondaryColor3ivEXT, glSecondaryColor3ivEXT, NULL, 722),
-    NAME_FUNC_OFFSET(12205, glSecondaryColor3sEXT, glSecondaryColor3sEXT, NULL, 723),
-    NAME_FUNC_OFFSET(12227, glSecondaryColor3svEXT, glSecondaryColor3svEXT, NULL, 724),
-    NAME_FUNC_OFFSET(12250, glSecondaryColor3ubEXT, glSecondaryColor3ubEXT, NULL, 725),
-    NAME_FUNC_OFFSET(12273, glSecondaryColor3ubvEXT, glSecondaryColor3ubvEXT, NULL, 726),
-    NAME_FUNC_OFFSET(12297, glSecondaryColor3uiEXT, glSecondaryColor3uiEXT, NULL, 727),
-    NAME_FUNC_OFFSET(12320, glSecondaryColor3uivEXT, glSecondaryColor3uivEXT, NULL, 728),
-    NAME_FUNC_OFFSET(12344, glSecondaryColor3usEXT, glSecondaryColor3usEXT, NULL, 729),
-    NAME_FUNC_OFFSET(12367, glSecondaryColor3usvEXT, glSecondaryColor3usvEXT, NULL, 730),
-    NAME_FUNC_OFFSET(12391, glSecondaryColorPointerEXT, glSecondaryColorPointerEXT, NULL, 731),
-    NAME_FUNC_OFFSET(12418, glMultiDrawArraysEXT, glMultiDrawArraysEXT, NULL, 732),
-    NAME_FUNC_OFFSET(12439, glMultiDrawElementsEXT, glMultiDrawElementsEXT, NULL, 733),
-    NAME_FUNC_OFFSET(12462, glFogCoordPointerEXT, glFogCoordPointerEXT, NULL, 734),
-    NAME_FUNC_OFFSET(12483, glFogCoorddEXT, glFogCoorddEXT, NULL, 735),
-    NAME_FUNC_OFFSET(12498, glFogCoorddvEXT, glFogCoorddvEXT, NULL, 736),
-    NAME_FUNC_OFFSET(12514, glFogCoordfEXT, glFogCoordfEXT, NULL, 737),
-    NAME_FUNC_OFFSET(12529, glFogCoordfvEXT, glFogCoordfvEXT, NULL, 738),
-    NAME_FUNC_OFFSET(12545, gl_dispatch_stub_739, gl_dispatch_stub_739, NULL, 739),
-    NAME_FUNC_OFFSET(12563, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 740),
-    NAME_FUNC_OFFSET(12586, glFlushVertexArrayRangeNV, glFlushVertexArrayRangeNV, NULL, 741),
-    NAME_FUNC_OFFSET(12612, glVertexArrayRangeNV, glVertexArrayRangeNV, NULL, 742),
-    NAME_FUNC_OFFSET(12633, glCombinerInputNV, glCombinerInputNV, NULL, 743),
-    NAME_FUNC_OFFSET(12651, glCombinerOutputNV, glCombinerOutputNV, NULL, 744),
-    NAME_FUNC_OFFSET(12670, glCombinerParameterfNV, glCombinerParameterfNV, NULL, 745),
-    NAME_FUNC_OFFSET(12693, glCombinerParameterfvNV, glCombinerParameterfvNV, NULL, 746),
-    NAME_FUNC_OFFSET(12717, glCombinerParameteriNV, glCombinerParameteriNV, NULL, 747),
-    NAME_FUNC_OFFSET(12740, glCombinerParameterivNV, glCombinerParameterivNV, NULL, 748),
-    NAME_FUNC_OFFSET(12764, glFinalCombinerInputNV, glFinalCombinerInputNV, NULL, 749),
-    NAME_FUNC_OFFSET(12787, glGetCombinerInputParameterfvNV, glGetCombinerInputParameterfvNV, NULL, 750),
-    NAME_FUNC_OFFSET(12819, glGetCombinerInputParameterivNV, glGetCombinerInputParameterivNV, NULL, 751),
-    NAME_FUNC_OFFSET(12851, glGetCombinerOutputParameterfvNV, glGetCombinerOutputParameterfvNV, NULL, 752),
-    NAME_FUNC_OFFSET(12884, glGetCombinerOutputParameterivNV, glGetCombinerOutputParameterivNV, NULL, 753),
-    NAME_FUNC_OFFSET(12917, glGetFinalCombinerInputParameterfvNV, glGetFinalCombinerInputParameterfvNV, NULL, 754),
-    NAME_FUNC_OFFSET(12954, glGetFinalCombinerInputParameterivNV, glGetFinalCombinerInputParameterivNV, NULL, 755),
-    NAME_FUNC_OFFSET(12991, glResizeBuffersMESA, glResizeBuffersMESA, NULL, 756),
-    NAME_FUNC_OFFSET(13011, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 757),
-    NAME_FUNC_OFFSET(13029, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 758),
-    NAME_FUNC_OFFSET(13048, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 759),
-    NAME_FUNC_OFFSET(13066, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 760),
-    NAME_FUNC_OFFSET(13085, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 761),
-    NAME_FUNC_OFFSET(13103, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 762),
-    NAME_FUNC_OFFSET(13122, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 763),
-    NAME_FUNC_OFFSET(13140, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 764),
-    NAME_FUNC_OFFSET(13159, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 765),
-    NAME_FUNC_OFFSET(13177, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 766),
-    NAME_FUNC_OFFSET(13196, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 767),
-    NAME_FUNC_OFFSET(13214, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 768),
-    NAME_FUNC_OFFSET(13233, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 769),
-    NAME_FUNC_OFFSET(13251, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 770),
-    NAME_FUNC_OFFSET(13270, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 771),
-    NAME_FUNC_OFFSET(13288, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 772),
-    NAME_FUNC_OFFSET(13307, glWindowPos4dMESA, glWindowPos4dMESA, NULL, 773),
-    NAME_FUNC_OFFSET(13325, glWindowPos4dvMESA, glWindowPos4dvMESA, NULL, 774),
-    NAME_FUNC_OFFSET(13344, glWindowPos4fMESA, glWindowPos4fMESA, NULL, 775),
-    NAME_FUNC_OFFSET(13362, glWindowPos4fvMESA, glWindowPos4fvMESA, NULL, 776),
-    NAME_FUNC_OFFSET(13381, glWindowPos4iMESA, glWindowPos4iMESA, NULL, 777),
-    NAME_FUNC_OFFSET(13399, glWindowPos4ivMESA, glWindowPos4ivMESA, NULL, 778),
-    NAME_FUNC_OFFSET(13418, glWindowPos4sMESA, glWindowPos4sMESA, NULL, 779),
-    NAME_FUNC_OFFSET(13436, glWindowPos4svMESA, glWindowPos4svMESA, NULL, 780),
-    NAME_FUNC_OFFSET(13455, gl_dispatch_stub_781, gl_dispatch_stub_781, NULL, 781),
-    NAME_FUNC_OFFSET(13480, gl_dispatch_stub_782, gl_dispatch_stub_782, NULL, 782),
-    NAME_FUNC_OFFSET(13507, gl_dispatch_stub_783, gl_dispatch_stub_783, NULL, 783),
-    NAME_FUNC_OFFSET(13524, gl_dispatch_stub_784, gl_dispatch_stub_784, NULL, 784),
-    NAME_FUNC_OFFSET(13540, gl_dispatch_stub_785, gl_dispatch_stub_785, NULL, 785),
-    NAME_FUNC_OFFSET(13554, gl_dispatch_stub_786, gl_dispatch_stub_786, NULL, 786),
-    NAME_FUNC_OFFSET(13569, gl_dispatch_stub_787, gl_dispatch_stub_787, NULL, 787),
-    NAME_FUNC_OFFSET(13581, gl_dispatch_stub_788, gl_dispatch_stub_788, NULL, 788),
-    NAME_FUNC_OFFSET(13594, gl_dispatch_stub_789, gl_dispatch_stub_789, NULL, 789),
-    NAME_FUNC_OFFSET(13608, glAreProgramsResidentNV, glAreProgramsResidentNV, NULL, 790),
-    NAME_FUNC_OFFSET(13632, glBindProgramNV, glBindProgramNV, NULL, 791),
-    NAME_FUNC_OFFSET(13648, glDeleteProgramsNV, glDeleteProgramsNV, NULL, 792),
-    NAME_FUNC_OFFSET(13667, glExecuteProgramNV, glExecuteProgramNV, NULL, 793),
-    NAME_FUNC_OFFSET(13686, glGenProgramsNV, glGenProgramsNV, NULL, 794),
-    NAME_FUNC_OFFSET(13702, glGetProgramParameterdvNV, glGetProgramParameterdvNV, NULL, 795),
-    NAME_FUNC_OFFSET(13728, glGetProgramParameterfvNV, glGetProgramParameterfvNV, NULL, 796),
-    NAME_FUNC_OFFSET(13754, glGetProgramStringNV, glGetProgramStringNV, NULL, 797),
-    NAME_FUNC_OFFSET(13775, glGetProgramivNV, glGetProgramivNV, NULL, 798),
-    NAME_FUNC_OFFSET(13792, glGetTrackMatrixivNV, glGetTrackMatrixivNV, NULL, 799),
-    NAME_FUNC_OFFSET(13813, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 800),
-    NAME_FUNC_OFFSET(13841, glGetVertexAttribdvNV, glGetVertexAttribdvNV, NULL, 801),
-    NAME_FUNC_OFFSET(13863, glGetVertexAttribfvNV, glGetVertexAttribfvNV, NULL, 802),
-    NAME_FUNC_OFFSET(13885, glGetVertexAttribivNV, glGetVertexAttribivNV, NULL, 803),
-    NAME_FUNC_OFFSET(13907, glIsProgramNV, glIsProgramNV, NULL, 804),
-    NAME_FUNC_OFFSET(13921, glLoadProgramNV, glLoadProgramNV, NULL, 805),
-    NAME_FUNC_OFFSET(13937, glProgramParameters4dvNV, glProgramParameters4dvNV, NULL, 806),
-    NAME_FUNC_OFFSET(13962, glProgramParameters4fvNV, glProgramParameters4fvNV, NULL, 807),
-    NAME_FUNC_OFFSET(13987, glRequestResidentProgramsNV, glRequestResidentProgramsNV, NULL, 808),
-    NAME_FUNC_OFFSET(14015, glTrackMatrixNV, glTrackMatrixNV, NULL, 809),
-    NAME_FUNC_OFFSET(14031, glVertexAttrib1dNV, glVertexAttrib1dNV, NULL, 810),
-    NAME_FUNC_OFFSET(14050, glVertexAttrib1dvNV, glVertexAttrib1dvNV, NULL, 811),
-    NAME_FUNC_OFFSET(14070, glVertexAttrib1fNV, glVertexAttrib1fNV, NULL, 812),
-    NAME_FUNC_OFFSET(14089, glVertexAttrib1fvNV, glVertexAttrib1fvNV, NULL, 813),
-    NAME_FUNC_OFFSET(14109, glVertexAttrib1sNV, glVertexAttrib1sNV, NULL, 814),
-    NAME_FUNC_OFFSET(14128, glVertexAttrib1svNV, glVertexAttrib1svNV, NULL, 815),
-    NAME_FUNC_OFFSET(14148, glVertexAttrib2dNV, glVertexAttrib2dNV, NULL, 816),
-    NAME_FUNC_OFFSET(14167, glVertexAttrib2dvNV, glVertexAttrib2dvNV, NULL, 817),
-    NAME_FUNC_OFFSET(14187, glVertexAttrib2fNV, glVertexAttrib2fNV, NULL, 818),
-    NAME_FUNC_OFFSET(14206, glVertexAttrib2fvNV, glVertexAttrib2fvNV, NULL, 819),
-    NAME_FUNC_OFFSET(14226, glVertexAttrib2sNV, glVertexAttrib2sNV, NULL, 820),
-    NAME_FUNC_OFFSET(14245, glVertexAttrib2svNV, glVertexAttrib2svNV, NULL, 821),
-    NAME_FUNC_OFFSET(14265, glVertexAttrib3dNV, glVertexAttrib3dNV, NULL, 822),
-    NAME_FUNC_OFFSET(14284, glVertexAttrib3dvNV, glVertexAttrib3dvNV, NULL, 823),
-    NAME_FUNC_OFFSET(14304, glVertexAttrib3fNV, glVertexAttrib3fNV, NULL, 824),
-    NAME_FUNC_OFFSET(14323, glVertexAttrib3fvNV, glVertexAttrib3fvNV, NULL, 825),
-    NAME_FUNC_OFFSET(14343, glVertexAttrib3sNV, glVertexAttrib3sNV, NULL, 826),
-    NAME_FUNC_OFFSET(14362, glVertexAttrib3svNV, glVertexAttrib3svNV, NULL, 827),
-    NAME_FUNC_OFFSET(14382, glVertexAttrib4dNV, glVertexAttrib4dNV, NULL, 828),
-    NAME_FUNC_OFFSET(14401, glVertexAttrib4dvNV, glVertexAttrib4dvNV, NULL, 829),
-    NAME_FUNC_OFFSET(14421, glVertexAttrib4fNV, glVertexAttrib4fNV, NULL, 830),
-    NAME_FUNC_OFFSET(14440, glVertexAttrib4fvNV, glVertexAttrib4fvNV, NULL, 831),
-    NAME_FUNC_OFFSET(14460, glVertexAttrib4sNV, glVertexAttrib4sNV, NULL, 832),
-    NAME_FUNC_OFFSET(14479, glVertexAttrib4svNV, glVertexAttrib4svNV, NULL, 833),
-    NAME_FUNC_OFFSET(14499, glVertexAttrib4ubNV, glVertexAttrib4ubNV, NULL, 834),
-    NAME_FUNC_OFFSET(14519, glVertexAttrib4ubvNV, glVertexAttrib4ubvNV, NULL, 835),
-    NAME_FUNC_OFFSET(14540, glVertexAttribPointerNV, glVertexAttribPointerNV, NULL, 836),
-    NAME_FUNC_OFFSET(14564, glVertexAttribs1dvNV, glVertexAttribs1dvNV, NULL, 837),
-    NAME_FUNC_OFFSET(14585, glVertexAttribs1fvNV, glVertexAttribs1fvNV, NULL, 838),
-    NAME_FUNC_OFFSET(14606, glVertexAttribs1svNV, glVertexAttribs1svNV, NULL, 839),
-    NAME_FUNC_OFFSET(14627, glVertexAttribs2dvNV, glVertexAttribs2dvNV, NULL, 840),
-    NAME_FUNC_OFFSET(14648, glVertexAttribs2fvNV, glVertexAttribs2fvNV, NULL, 841),
-    NAME_FUNC_OFFSET(14669, glVertexAttribs2svNV, glVertexAttribs2svNV, NULL, 842),
-    NAME_FUNC_OFFSET(14690, glVertexAttribs3dvNV, glVertexAttribs3dvNV, NULL, 843),
-    NAME_FUNC_OFFSET(14711, glVertexAttribs3fvNV, glVertexAttribs3fvNV, NULL, 844),
-    NAME_FUNC_OFFSET(14732, glVertexAttribs3svNV, glVertexAttribs3svNV, NULL, 845),
-    NAME_FUNC_OFFSET(14753, glVertexAttribs4dvNV, glVertexAttribs4dvNV, NULL, 846),
-    NAME_FUNC_OFFSET(14774, glVertexAttribs4fvNV, glVertexAttribs4fvNV, NULL, 847),
-    NAME_FUNC_OFFSET(14795, glVertexAttribs4svNV, glVertexAttribs4svNV, NULL, 848),
-    NAME_FUNC_OFFSET(14816, glVertexAttribs4ubvNV, glVertexAttribs4ubvNV, NULL, 849),
-    NAME_FUNC_OFFSET(14838, glGetTexBumpParameterfvATI, glGetTexBumpParameterfvATI, NULL, 850),
-    NAME_FUNC_OFFSET(14865, glGetTexBumpParameterivATI, glGetTexBumpParameterivATI, NULL, 851),
-    NAME_FUNC_OFFSET(14892, glTexBumpParameterfvATI, glTexBumpParameterfvATI, NULL, 852),
-    NAME_FUNC_OFFSET(14916, glTexBumpParameterivATI, glTexBumpParameterivATI, NULL, 853),
-    NAME_FUNC_OFFSET(14940, glAlphaFragmentOp1ATI, glAlphaFragmentOp1ATI, NULL, 854),
-    NAME_FUNC_OFFSET(14962, glAlphaFragmentOp2ATI, glAlphaFragmentOp2ATI, NULL, 855),
-    NAME_FUNC_OFFSET(14984, glAlphaFragmentOp3ATI, glAlphaFragmentOp3ATI, NULL, 856),
-    NAME_FUNC_OFFSET(15006, glBeginFragmentShaderATI, glBeginFragmentShaderATI, NULL, 857),
-    NAME_FUNC_OFFSET(15031, glBindFragmentShaderATI, glBindFragmentShaderATI, NULL, 858),
-    NAME_FUNC_OFFSET(15055, glColorFragmentOp1ATI, glColorFragmentOp1ATI, NULL, 859),
-    NAME_FUNC_OFFSET(15077, glColorFragmentOp2ATI, glColorFragmentOp2ATI, NULL, 860),
-    NAME_FUNC_OFFSET(15099, glColorFragmentOp3ATI, glColorFragmentOp3ATI, NULL, 861),
-    NAME_FUNC_OFFSET(15121, glDeleteFragmentShaderATI, glDeleteFragmentShaderATI, NULL, 862),
-    NAME_FUNC_OFFSET(15147, glEndFragmentShaderATI, glEndFragmentShaderATI, NULL, 863),
-    NAME_FUNC_OFFSET(15170, glGenFragmentShadersATI, glGenFragmentShadersATI, NULL, 864),
-    NAME_FUNC_OFFSET(15194, glPassTexCoordATI, glPassTexCoordATI, NULL, 865),
-    NAME_FUNC_OFFSET(15212, glSampleMapATI, glSampleMapATI, NULL, 866),
-    NAME_FUNC_OFFSET(15227, glSetFragmentShaderConstantATI, glSetFragmentShaderConstantATI, NULL, 867),
-    NAME_FUNC_OFFSET(15258, glPointParameteriNV, glPointParameteriNV, NULL, 868),
-    NAME_FUNC_OFFSET(15278, glPointParameterivNV, glPointParameterivNV, NULL, 869),
-    NAME_FUNC_OFFSET(15299, gl_dispatch_stub_870, gl_dispatch_stub_870, NULL, 870),
-    NAME_FUNC_OFFSET(15322, gl_dispatch_stub_871, gl_dispatch_stub_871, NULL, 871),
-    NAME_FUNC_OFFSET(15345, gl_dispatch_stub_872, gl_dispatch_stub_872, NULL, 872),
-    NAME_FUNC_OFFSET(15371, gl_dispatch_stub_873, gl_dispatch_stub_873, NULL, 873),
-    NAME_FUNC_OFFSET(15394, gl_dispatch_stub_874, gl_dispatch_stub_874, NULL, 874),
-    NAME_FUNC_OFFSET(15415, glGetProgramNamedParameterdvNV, glGetProgramNamedParameterdvNV, NULL, 875),
-    NAME_FUNC_OFFSET(15446, glGetProgramNamedParameterfvNV, glGetProgramNamedParameterfvNV, NULL, 876),
-    NAME_FUNC_OFFSET(15477, glProgramNamedParameter4dNV, glProgramNamedParameter4dNV, NULL, 877),
-    NAME_FUNC_OFFSET(15505, glProgramNamedParameter4dvNV, glProgramNamedParameter4dvNV, NULL, 878),
-    NAME_FUNC_OFFSET(15534, glProgramNamedParameter4fNV, glProgramNamedParameter4fNV, NULL, 879),
-    NAME_FUNC_OFFSET(15562, glProgramNamedParameter4fvNV, glProgramNamedParameter4fvNV, NULL, 880),
-    NAME_FUNC_OFFSET(15591, glPrimitiveRestartIndexNV, glPrimitiveRestartIndexNV, NULL, 881),
-    NAME_FUNC_OFFSET(15617, glPrimitiveRestartNV, glPrimitiveRestartNV, NULL, 882),
-    NAME_FUNC_OFFSET(15638, gl_dispatch_stub_883, gl_dispatch_stub_883, NULL, 883),
-    NAME_FUNC_OFFSET(15655, gl_dispatch_stub_884, gl_dispatch_stub_884, NULL, 884),
-    NAME_FUNC_OFFSET(15682, glBindFramebufferEXT, glBindFramebufferEXT, NULL, 885),
-    NAME_FUNC_OFFSET(15703, glBindRenderbufferEXT, glBindRenderbufferEXT, NULL, 886),
-    NAME_FUNC_OFFSET(15725, glCheckFramebufferStatusEXT, glCheckFramebufferStatusEXT, NULL, 887),
-    NAME_FUNC_OFFSET(15753, glDeleteFramebuffersEXT, glDeleteFramebuffersEXT, NULL, 888),
-    NAME_FUNC_OFFSET(15777, glDeleteRenderbuffersEXT, glDeleteRenderbuffersEXT, NULL, 889),
-    NAME_FUNC_OFFSET(15802, glFramebufferRenderbufferEXT, glFramebufferRenderbufferEXT, NULL, 890),
-    NAME_FUNC_OFFSET(15831, glFramebufferTexture1DEXT, glFramebufferTexture1DEXT, NULL, 891),
-    NAME_FUNC_OFFSET(15857, glFramebufferTexture2DEXT, glFramebufferTexture2DEXT, NULL, 892),
-    NAME_FUNC_OFFSET(15883, glFramebufferTexture3DEXT, glFramebufferTexture3DEXT, NULL, 893),
-    NAME_FUNC_OFFSET(15909, glGenFramebuffersEXT, glGenFramebuffersEXT, NULL, 894),
-    NAME_FUNC_OFFSET(15930, glGenRenderbuffersEXT, glGenRenderbuffersEXT, NULL, 895),
-    NAME_FUNC_OFFSET(15952, glGenerateMipmapEXT, glGenerateMipmapEXT, NULL, 896),
-    NAME_FUNC_OFFSET(15972, glGetFramebufferAttachmentParameterivEXT, glGetFramebufferAttachmentParameterivEXT, NULL, 897),
-    NAME_FUNC_OFFSET(16013, glGetRenderbufferParameterivEXT, glGetRenderbufferParameterivEXT, NULL, 898),
-    NAME_FUNC_OFFSET(16045, glIsFramebufferEXT, glIsFramebufferEXT, NULL, 899),
-    NAME_FUNC_OFFSET(16064, glIsRenderbufferEXT, glIsRenderbufferEXT, NULL, 900),
-    NAME_FUNC_OFFSET(16084, glRenderbufferStorageEXT, glRenderbufferStorageEXT, NULL, 901),
-    NAME_FUNC_OFFSET(16109, gl_dispatch_stub_902, gl_dispatch_stub_902, NULL, 902),
-    NAME_FUNC_OFFSET(16130, gl_dispatch_stub_903, gl_dispatch_stub_903, NULL, 903),
-    NAME_FUNC_OFFSET(16154, gl_dispatch_stub_904, gl_dispatch_stub_904, NULL, 904),
-    NAME_FUNC_OFFSET(16184, glBindFragDataLocationEXT, glBindFragDataLocationEXT, NULL, 905),
-    NAME_FUNC_OFFSET(16210, glGetFragDataLocationEXT, glGetFragDataLocationEXT, NULL, 906),
-    NAME_FUNC_OFFSET(16235, glGetUniformuivEXT, glGetUniformuivEXT, NULL, 907),
-    NAME_FUNC_OFFSET(16254, glGetVertexAttribIivEXT, glGetVertexAttribIivEXT, NULL, 908),
-    NAME_FUNC_OFFSET(16278, glGetVertexAttribIuivEXT, glGetVertexAttribIuivEXT, NULL, 909),
-    NAME_FUNC_OFFSET(16303, glUniform1uiEXT, glUniform1uiEXT, NULL, 910),
-    NAME_FUNC_OFFSET(16319, glUniform1uivEXT, glUniform1uivEXT, NULL, 911),
-    NAME_FUNC_OFFSET(16336, glUniform2uiEXT, glUniform2uiEXT, NULL, 912),
-    NAME_FUNC_OFFSET(16352, glUniform2uivEXT, glUniform2uivEXT, NULL, 913),
-    NAME_FUNC_OFFSET(16369, glUniform3uiEXT, glUniform3uiEXT, NULL, 914),
-    NAME_FUNC_OFFSET(16385, glUniform3uivEXT, glUniform3uivEXT, NULL, 915),
-    NAME_FUNC_OFFSET(16402, glUniform4uiEXT, glUniform4uiEXT, NULL, 916),
-    NAME_FUNC_OFFSET(16418, glUniform4uivEXT, glUniform4uivEXT, NULL, 917),
-    NAME_FUNC_OFFSET(16435, glVertexAttribI1iEXT, glVertexAttribI1iEXT, NULL, 918),
-    NAME_FUNC_OFFSET(16456, glVertexAttribI1ivEXT, glVertexAttribI1ivEXT, NULL, 919),
-    NAME_FUNC_OFFSET(16478, glVertexAttribI1uiEXT, glVertexAttribI1uiEXT, NULL, 920),
-    NAME_FUNC_OFFSET(16500, glVertexAttribI1uivEXT, glVertexAttribI1uivEXT, NULL, 921),
-    NAME_FUNC_OFFSET(16523, glVertexAttribI2iEXT, glVertexAttribI2iEXT, NULL, 922),
-    NAME_FUNC_OFFSET(16544, glVertexAttribI2ivEXT, glVertexAttribI2ivEXT, NULL, 923),
-    NAME_FUNC_OFFSET(16566, glVertexAttribI2uiEXT, glVertexAttribI2uiEXT, NULL, 924),
-    NAME_FUNC_OFFSET(16588, glVertexAttribI2uivEXT, glVertexAttribI2uivEXT, NULL, 925),
-    NAME_FUNC_OFFSET(16611, glVertexAttribI3iEXT, glVertexAttribI3iEXT, NULL, 926),
-    NAME_FUNC_OFFSET(16632, glVertexAttribI3ivEXT, glVertexAttribI3ivEXT, NULL, 927),
-    NAME_FUNC_OFFSET(16654, glVertexAttribI3uiEXT, glVertexAttribI3uiEXT, NULL, 928),
-    NAME_FUNC_OFFSET(16676, glVertexAttribI3uivEXT, glVertexAttribI3uivEXT, NULL, 929),
-    NAME_FUNC_OFFSET(16699, glVertexAttribI4bvEXT, glVertexAttribI4bvEXT, NULL, 930),
-    NAME_FUNC_OFFSET(16721, glVertexAttribI4iEXT, glVertexAttribI4iEXT, NULL, 931),
-    NAME_FUNC_OFFSET(16742, glVertexAttribI4ivEXT, glVertexAttribI4ivEXT, NULL, 932),
-    NAME_FUNC_OFFSET(16764, glVertexAttribI4svEXT, glVertexAttribI4svEXT, NULL, 933),
-    NAME_FUNC_OFFSET(16786, glVertexAttribI4ubvEXT, glVertexAttribI4ubvEXT, NULL, 934),
-    NAME_FUNC_OFFSET(16809, glVertexAttribI4uiEXT, glVertexAttribI4uiEXT, NULL, 935),
-    NAME_FUNC_OFFSET(16831, glVertexAttribI4uivEXT, glVertexAttribI4uivEXT, NULL, 936),
-    NAME_FUNC_OFFSET(16854, glVertexAttribI4usvEXT, glVertexAttribI4usvEXT, NULL, 937),
-    NAME_FUNC_OFFSET(16877, glVertexAttribIPointerEXT, glVertexAttribIPointerEXT, NULL, 938),
-    NAME_FUNC_OFFSET(16903, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 939),
-    NAME_FUNC_OFFSET(16932, glColorMaskIndexedEXT, glColorMaskIndexedEXT, NULL, 940),
-    NAME_FUNC_OFFSET(16954, glDisableIndexedEXT, glDisableIndexedEXT, NULL, 941),
-    NAME_FUNC_OFFSET(16974, glEnableIndexedEXT, glEnableIndexedEXT, NULL, 942),
-    NAME_FUNC_OFFSET(16993, glGetBooleanIndexedvEXT, glGetBooleanIndexedvEXT, NULL, 943),
-    NAME_FUNC_OFFSET(17017, glGetIntegerIndexedvEXT, glGetIntegerIndexedvEXT, NULL, 944),
-    NAME_FUNC_OFFSET(17041, glIsEnabledIndexedEXT, glIsEnabledIndexedEXT, NULL, 945),
-    NAME_FUNC_OFFSET(17063, glClearColorIiEXT, glClearColorIiEXT, NULL, 946),
-    NAME_FUNC_OFFSET(17081, glClearColorIuiEXT, glClearColorIuiEXT, NULL, 947),
-    NAME_FUNC_OFFSET(17100, glGetTexParameterIivEXT, glGetTexParameterIivEXT, NULL, 948),
-    NAME_FUNC_OFFSET(17124, glGetTexParameterIuivEXT, glGetTexParameterIuivEXT, NULL, 949),
-    NAME_FUNC_OFFSET(17149, glTexParameterIivEXT, glTexParameterIivEXT, NULL, 950),
-    NAME_FUNC_OFFSET(17170, glTexParameterIuivEXT, glTexParameterIuivEXT, NULL, 951),
-    NAME_FUNC_OFFSET(17192, glBeginConditionalRenderNV, glBeginConditionalRenderNV, NULL, 952),
-    NAME_FUNC_OFFSET(17219, glEndConditionalRenderNV, glEndConditionalRenderNV, NULL, 953),
-    NAME_FUNC_OFFSET(17244, glBeginTransformFeedbackEXT, glBeginTransformFeedbackEXT, NULL, 954),
-    NAME_FUNC_OFFSET(17272, glBindBufferBaseEXT, glBindBufferBaseEXT, NULL, 955),
-    NAME_FUNC_OFFSET(17292, glBindBufferOffsetEXT, glBindBufferOffsetEXT, NULL, 956),
-    NAME_FUNC_OFFSET(17314, glBindBufferRangeEXT, glBindBufferRangeEXT, NULL, 957),
-    NAME_FUNC_OFFSET(17335, glEndTransformFeedbackEXT, glEndTransformFeedbackEXT, NULL, 958),
-    NAME_FUNC_OFFSET(17361, glGetTransformFeedbackVaryingEXT, glGetTransformFeedbackVaryingEXT, NULL, 959),
-    NAME_FUNC_OFFSET(17394, glTransformFeedbackVaryingsEXT, glTransformFeedbackVaryingsEXT, NULL, 960),
-    NAME_FUNC_OFFSET(17425, glProvokingVertexEXT, glProvokingVertexEXT, NULL, 961),
-    NAME_FUNC_OFFSET(17446, gl_dispatch_stub_962, gl_dispatch_stub_962, NULL, 962),
-    NAME_FUNC_OFFSET(17477, gl_dispatch_stub_963, gl_dispatch_stub_963, NULL, 963),
-    NAME_FUNC_OFFSET(17497, glGetObjectParameterivAPPLE, glGetObjectParameterivAPPLE, NULL, 964),
-    NAME_FUNC_OFFSET(17525, glObjectPurgeableAPPLE, glObjectPurgeableAPPLE, NULL, 965),
-    NAME_FUNC_OFFSET(17548, glObjectUnpurgeableAPPLE, glObjectUnpurgeableAPPLE, NULL, 966),
-    NAME_FUNC_OFFSET(17573, glActiveProgramEXT, glActiveProgramEXT, NULL, 967),
-    NAME_FUNC_OFFSET(17592, glCreateShaderProgramEXT, glCreateShaderProgramEXT, NULL, 968),
-    NAME_FUNC_OFFSET(17617, glUseShaderProgramEXT, glUseShaderProgramEXT, NULL, 969),
-    NAME_FUNC_OFFSET(17639, glTextureBarrierNV, glTextureBarrierNV, NULL, 970),
-    NAME_FUNC_OFFSET(17658, gl_dispatch_stub_971, gl_dispatch_stub_971, NULL, 971),
-    NAME_FUNC_OFFSET(17683, gl_dispatch_stub_972, gl_dispatch_stub_972, NULL, 972),
-    NAME_FUNC_OFFSET(17712, gl_dispatch_stub_973, gl_dispatch_stub_973, NULL, 973),
-    NAME_FUNC_OFFSET(17743, gl_dispatch_stub_974, gl_dispatch_stub_974, NULL, 974),
-    NAME_FUNC_OFFSET(17767, gl_dispatch_stub_975, gl_dispatch_stub_975, NULL, 975),
-    NAME_FUNC_OFFSET(17792, glEGLImageTargetRenderbufferStorageOES, glEGLImageTargetRenderbufferStorageOES, NULL, 976),
-    NAME_FUNC_OFFSET(17831, glEGLImageTargetTexture2DOES, glEGLImageTargetTexture2DOES, NULL, 977),
-    NAME_FUNC_OFFSET(17860, glArrayElement, glArrayElement, NULL, 306),
-    NAME_FUNC_OFFSET(17878, glBindTexture, glBindTexture, NULL, 307),
-    NAME_FUNC_OFFSET(17895, glDrawArrays, glDrawArrays, NULL, 310),
-    NAME_FUNC_OFFSET(17911, glAreTexturesResident, glAreTexturesResidentEXT, glAreTexturesResidentEXT, 322),
-    NAME_FUNC_OFFSET(17936, glCopyTexImage1D, glCopyTexImage1D, NULL, 323),
-    NAME_FUNC_OFFSET(17956, glCopyTexImage2D, glCopyTexImage2D, NULL, 324),
-    NAME_FUNC_OFFSET(17976, glCopyTexSubImage1D, glCopyTexSubImage1D, NULL, 325),
-    NAME_FUNC_OFFSET(17999, glCopyTexSubImage2D, glCopyTexSubImage2D, NULL, 326),
-    NAME_FUNC_OFFSET(18022, glDeleteTextures, glDeleteTexturesEXT, glDeleteTexturesEXT, 327),
-    NAME_FUNC_OFFSET(18042, glGenTextures, glGenTexturesEXT, glGenTexturesEXT, 328),
-    NAME_FUNC_OFFSET(18059, glGetPointerv, glGetPointerv, NULL, 329),
-    NAME_FUNC_OFFSET(18076, glIsTexture, glIsTextureEXT, glIsTextureEXT, 330),
-    NAME_FUNC_OFFSET(18091, glPrioritizeTextures, glPrioritizeTextures, NULL, 331),
-    NAME_FUNC_OFFSET(18115, glTexSubImage1D, glTexSubImage1D, NULL, 332),
-    NAME_FUNC_OFFSET(18134, glTexSubImage2D, glTexSubImage2D, NULL, 333),
-    NAME_FUNC_OFFSET(18153, glBlendColor, glBlendColor, NULL, 336),
-    NAME_FUNC_OFFSET(18169, glBlendEquation, glBlendEquation, NULL, 337),
-    NAME_FUNC_OFFSET(18188, glDrawRangeElements, glDrawRangeElements, NULL, 338),
-    NAME_FUNC_OFFSET(18211, glColorTable, glColorTable, NULL, 339),
-    NAME_FUNC_OFFSET(18227, glColorTable, glColorTable, NULL, 339),
-    NAME_FUNC_OFFSET(18243, glColorTableParameterfv, glColorTableParameterfv, NULL, 340),
-    NAME_FUNC_OFFSET(18270, glColorTableParameteriv, glColorTableParameteriv, NULL, 341),
-    NAME_FUNC_OFFSET(18297, glCopyColorTable, glCopyColorTable, NULL, 342),
-    NAME_FUNC_OFFSET(18317, glGetColorTable, glGetColorTableEXT, glGetColorTableEXT, 343),
-    NAME_FUNC_OFFSET(18336, glGetColorTable, glGetColorTableEXT, glGetColorTableEXT, 343),
-    NAME_FUNC_OFFSET(18355, glGetColorTableParameterfv, glGetColorTableParameterfvEXT, glGetColorTableParameterfvEXT, 344),
-    NAME_FUNC_OFFSET(18385, glGetColorTableParameterfv, glGetColorTableParameterfvEXT, glGetColorTableParameterfvEXT, 344),
-    NAME_FUNC_OFFSET(18415, glGetColorTableParameteriv, glGetColorTableParameterivEXT, glGetColorTableParameterivEXT, 345),
-    NAME_FUNC_OFFSET(18445, glGetColorTableParameteriv, glGetColorTableParameterivEXT, glGetColorTableParameterivEXT, 345),
-    NAME_FUNC_OFFSET(18475, glColorSubTable, glColorSubTable, NULL, 346),
-    NAME_FUNC_OFFSET(18494, glCopyColorSubTable, glCopyColorSubTable, NULL, 347),
-    NAME_FUNC_OFFSET(18517, glConvolutionFilter1D, glConvolutionFilter1D, NULL, 348),
-    NAME_FUNC_OFFSET(18542, glConvolutionFilter2D, glConvolutionFilter2D, NULL, 349),
-    NAME_FUNC_OFFSET(18567, glConvolutionParameterf, glConvolutionParameterf, NULL, 350),
-    NAME_FUNC_OFFSET(18594, glConvolutionParameterfv, glConvolutionParameterfv, NULL, 351),
-    NAME_FUNC_OFFSET(18622, glConvolutionParameteri, glConvolutionParameteri, NULL, 352),
-    NAME_FUNC_OFFSET(18649, glConvolutionParameteriv, glConvolutionParameteriv, NULL, 353),
-    NAME_FUNC_OFFSET(18677, glCopyConvolutionFilter1D, glCopyConvolutionFilter1D, NULL, 354),
-    NAME_FUNC_OFFSET(18706, glCopyConvolutionFilter2D, glCopyConvolutionFilter2D, NULL, 355),
-    NAME_FUNC_OFFSET(18735, glGetConvolutionFilter, gl_dispatch_stub_356, gl_dispatch_stub_356, 356),
-    NAME_FUNC_OFFSET(18761, glGetConvolutionParameterfv, gl_dispatch_stub_357, gl_dispatch_stub_357, 357),
-    NAME_FUNC_OFFSET(18792, glGetConvolutionParameteriv, gl_dispatch_stub_358, gl_dispatch_stub_358, 358),
-    NAME_FUNC_OFFSET(18823, glGetSeparableFilter, gl_dispatch_stub_359, gl_dispatch_stub_359, 359),
-    NAME_FUNC_OFFSET(18847, glSeparableFilter2D, glSeparableFilter2D, NULL, 360),
-    NAME_FUNC_OFFSET(18870, glGetHistogram, gl_dispatch_stub_361, gl_dispatch_stub_361, 361),
-    NAME_FUNC_OFFSET(18888, glGetHistogramParameterfv, gl_dispatch_stub_362, gl_dispatch_stub_362, 362),
-    NAME_FUNC_OFFSET(18917, glGetHistogramParameteriv, gl_dispatch_stub_363, gl_dispatch_stub_363, 363),
-    NAME_FUNC_OFFSET(18946, glGetMinmax, gl_dispatch_stub_364, gl_dispatch_stub_364, 364),
-    NAME_FUNC_OFFSET(18961, glGetMinmaxParameterfv, gl_dispatch_stub_365, gl_dispatch_stub_365, 365),
-    NAME_FUNC_OFFSET(18987, glGetMinmaxParameteriv, gl_dispatch_stub_366, gl_dispatch_stub_366, 366),
-    NAME_FUNC_OFFSET(19013, glHistogram, glHistogram, NULL, 367),
-    NAME_FUNC_OFFSET(19028, glMinmax, glMinmax, NULL, 368),
-    NAME_FUNC_OFFSET(19040, glResetHistogram, glResetHistogram, NULL, 369),
-    NAME_FUNC_OFFSET(19060, glResetMinmax, glResetMinmax, NULL, 370),
-    NAME_FUNC_OFFSET(19077, glTexImage3D, glTexImage3D, NULL, 371),
-    NAME_FUNC_OFFSET(19093, glTexSubImage3D, glTexSubImage3D, NULL, 372),
-    NAME_FUNC_OFFSET(19112, glCopyTexSubImage3D, glCopyTexSubImage3D, NULL, 373),
-    NAME_FUNC_OFFSET(19135, glActiveTextureARB, glActiveTextureARB, NULL, 374),
-    NAME_FUNC_OFFSET(19151, glClientActiveTextureARB, glClientActiveTextureARB, NULL, 375),
-    NAME_FUNC_OFFSET(19173, glMultiTexCoord1dARB, glMultiTexCoord1dARB, NULL, 376),
-    NAME_FUNC_OFFSET(19191, glMultiTexCoord1dvARB, glMultiTexCoord1dvARB, NULL, 377),
-    NAME_FUNC_OFFSET(19210, glMultiTexCoord1fARB, glMultiTexCoord1fARB, NULL, 378),
-    NAME_FUNC_OFFSET(19228, glMultiTexCoord1fvARB, glMultiTexCoord1fvARB, NULL, 379),
-    NAME_FUNC_OFFSET(19247, glMultiTexCoord1iARB, glMultiTexCoord1iARB, NULL, 380),
-    NAME_FUNC_OFFSET(19265, glMultiTexCoord1ivARB, glMultiTexCoord1ivARB, NULL, 381),
-    NAME_FUNC_OFFSET(19284, glMultiTexCoord1sARB, glMultiTexCoord1sARB, NULL, 382),
-    NAME_FUNC_OFFSET(19302, glMultiTexCoord1svARB, glMultiTexCoord1svARB, NULL, 383),
-    NAME_FUNC_OFFSET(19321, glMultiTexCoord2dARB, glMultiTexCoord2dARB, NULL, 384),
-    NAME_FUNC_OFFSET(19339, glMultiTexCoord2dvARB, glMultiTexCoord2dvARB, NULL, 385),
-    NAME_FUNC_OFFSET(19358, glMultiTexCoord2fARB, glMultiTexCoord2fARB, NULL, 386),
-    NAME_FUNC_OFFSET(19376, glMultiTexCoord2fvARB, glMultiTexCoord2fvARB, NULL, 387),
-    NAME_FUNC_OFFSET(19395, glMultiTexCoord2iARB, glMultiTexCoord2iARB, NULL, 388),
-    NAME_FUNC_OFFSET(19413, glMultiTexCoord2ivARB, glMultiTexCoord2ivARB, NULL, 389),
-    NAME_FUNC_OFFSET(19432, glMultiTexCoord2sARB, glMultiTexCoord2sARB, NULL, 390),
-    NAME_FUNC_OFFSET(19450, glMultiTexCoord2svARB, glMultiTexCoord2svARB, NULL, 391),
-    NAME_FUNC_OFFSET(19469, glMultiTexCoord3dARB, glMultiTexCoord3dARB, NULL, 392),
-    NAME_FUNC_OFFSET(19487, glMultiTexCoord3dvARB, glMultiTexCoord3dvARB, NULL, 393),
-    NAME_FUNC_OFFSET(19506, glMultiTexCoord3fARB, glMultiTexCoord3fARB, NULL, 394),
-    NAME_FUNC_OFFSET(19524, glMultiTexCoord3fvARB, glMultiTexCoord3fvARB, NULL, 395),
-    NAME_FUNC_OFFSET(19543, glMultiTexCoord3iARB, glMultiTexCoord3iARB, NULL, 396),
-    NAME_FUNC_OFFSET(19561, glMultiTexCoord3ivARB, glMultiTexCoord3ivARB, NULL, 397),
-    NAME_FUNC_OFFSET(19580, glMultiTexCoord3sARB, glMultiTexCoord3sARB, NULL, 398),
-    NAME_FUNC_OFFSET(19598, glMultiTexCoord3svARB, glMultiTexCoord3svARB, NULL, 399),
-    NAME_FUNC_OFFSET(19617, glMultiTexCoord4dARB, glMultiTexCoord4dARB, NULL, 400),
-    NAME_FUNC_OFFSET(19635, glMultiTexCoord4dvARB, glMultiTexCoord4dvARB, NULL, 401),
-    NAME_FUNC_OFFSET(19654, glMultiTexCoord4fARB, glMultiTexCoord4fARB, NULL, 402),
-    NAME_FUNC_OFFSET(19672, glMultiTexCoord4fvARB, glMultiTexCoord4fvARB, NULL, 403),
-    NAME_FUNC_OFFSET(19691, glMultiTexCoord4iARB, glMultiTexCoord4iARB, NULL, 404),
-    NAME_FUNC_OFFSET(19709, glMultiTexCoord4ivARB, glMultiTexCoord4ivARB, NULL, 405),
-    NAME_FUNC_OFFSET(19728, glMultiTexCoord4sARB, glMultiTexCoord4sARB, NULL, 406),
-    NAME_FUNC_OFFSET(19746, glMultiTexCoord4svARB, glMultiTexCoord4svARB, NULL, 407),
-    NAME_FUNC_OFFSET(19765, glStencilOpSeparate, glStencilOpSeparate, NULL, 423),
-    NAME_FUNC_OFFSET(19788, glLoadTransposeMatrixdARB, glLoadTransposeMatrixdARB, NULL, 440),
-    NAME_FUNC_OFFSET(19811, glLoadTransposeMatrixfARB, glLoadTransposeMatrixfARB, NULL, 441),
-    NAME_FUNC_OFFSET(19834, glMultTransposeMatrixdARB, glMultTransposeMatrixdARB, NULL, 442),
-    NAME_FUNC_OFFSET(19857, glMultTransposeMatrixfARB, glMultTransposeMatrixfARB, NULL, 443),
-    NAME_FUNC_OFFSET(19880, glSampleCoverageARB, glSampleCoverageARB, NULL, 444),
-    NAME_FUNC_OFFSET(19897, glCompressedTexImage1DARB, glCompressedTexImage1DARB, NULL, 445),
-    NAME_FUNC_OFFSET(19920, glCompressedTexImage2DARB, glCompressedTexImage2DARB, NULL, 446),
-    NAME_FUNC_OFFSET(19943, glCompressedTexImage3DARB, glCompressedTexImage3DARB, NULL, 447),
-    NAME_FUNC_OFFSET(19966, glCompressedTexSubImage1DARB, glCompressedTexSubImage1DARB, NULL, 448),
-    NAME_FUNC_OFFSET(19992, glCompressedTexSubImage2DARB, glCompressedTexSubImage2DARB, NULL, 449),
-    NAME_FUNC_OFFSET(20018, glCompressedTexSubImage3DARB, glCompressedTexSubImage3DARB, NULL, 450),
-    NAME_FUNC_OFFSET(20044, glGetCompressedTexImageARB, glGetCompressedTexImageARB, NULL, 451),
-    NAME_FUNC_OFFSET(20068, glDisableVertexAttribArrayARB, glDisableVertexAttribArrayARB, NULL, 452),
-    NAME_FUNC_OFFSET(20095, glEnableVertexAttribArrayARB, glEnableVertexAttribArrayARB, NULL, 453),
-    NAME_FUNC_OFFSET(20121, glGetVertexAttribdvARB, glGetVertexAttribdvARB, NULL, 460),
-    NAME_FUNC_OFFSET(20141, glGetVertexAttribfvARB, glGetVertexAttribfvARB, NULL, 461),
-    NAME_FUNC_OFFSET(20161, glGetVertexAttribivARB, glGetVertexAttribivARB, NULL, 462),
-    NAME_FUNC_OFFSET(20181, glProgramEnvParameter4dARB, glProgramEnvParameter4dARB, NULL, 463),
-    NAME_FUNC_OFFSET(20204, glProgramEnvParameter4dvARB, glProgramEnvParameter4dvARB, NULL, 464),
-    NAME_FUNC_OFFSET(20228, glProgramEnvParameter4fARB, glProgramEnvParameter4fARB, NULL, 465),
-    NAME_FUNC_OFFSET(20251, glProgramEnvParameter4fvARB, glProgramEnvParameter4fvARB, NULL, 466),
-    NAME_FUNC_OFFSET(20275, glVertexAttrib1dARB, glVertexAttrib1dARB, NULL, 472),
-    NAME_FUNC_OFFSET(20292, glVertexAttrib1dvARB, glVertexAttrib1dvARB, NULL, 473),
-    NAME_FUNC_OFFSET(20310, glVertexAttrib1fARB, glVertexAttrib1fARB, NULL, 474),
-    NAME_FUNC_OFFSET(20327, glVertexAttrib1fvARB, glVertexAttrib1fvARB, NULL, 475),
-    NAME_FUNC_OFFSET(20345, glVertexAttrib1sARB, glVertexAttrib1sARB, NULL, 476),
-    NAME_FUNC_OFFSET(20362, glVertexAttrib1svARB, glVertexAttrib1svARB, NULL, 477),
-    NAME_FUNC_OFFSET(20380, glVertexAttrib2dARB, glVertexAttrib2dARB, NULL, 478),
-    NAME_FUNC_OFFSET(20397, glVertexAttrib2dvARB, glVertexAttrib2dvARB, NULL, 479),
-    NAME_FUNC_OFFSET(20415, glVertexAttrib2fARB, glVertexAttrib2fARB, NULL, 480),
-    NAME_FUNC_OFFSET(20432, glVertexAttrib2fvARB, glVertexAttrib2fvARB, NULL, 481),
-    NAME_FUNC_OFFSET(20450, glVertexAttrib2sARB, glVertexAttrib2sARB, NULL, 482),
-    NAME_FUNC_OFFSET(20467, glVertexAttrib2svARB, glVertexAttrib2svARB, NULL, 483),
-    NAME_FUNC_OFFSET(20485, glVertexAttrib3dARB, glVertexAttrib3dARB, NULL, 484),
-    NAME_FUNC_OFFSET(20502, glVertexAttrib3dvARB, glVertexAttrib3dvARB, NULL, 485),
-    NAME_FUNC_OFFSET(20520, glVertexAttrib3fARB, glVertexAttrib3fARB, NULL, 486),
-    NAME_FUNC_OFFSET(20537, glVertexAttrib3fvARB, glVertexAttrib3fvARB, NULL, 487),
-    NAME_FUNC_OFFSET(20555, glVertexAttrib3sARB, glVertexAttrib3sARB, NULL, 488),
-    NAME_FUNC_OFFSET(20572, glVertexAttrib3svARB, glVertexAttrib3svARB, NULL, 489),
-    NAME_FUNC_OFFSET(20590, glVertexAttrib4NbvARB, glVertexAttrib4NbvARB, NULL, 490),
-    NAME_FUNC_OFFSET(20609, glVertexAttrib4NivARB, glVertexAttrib4NivARB, NULL, 491),
-    NAME_FUNC_OFFSET(20628, glVertexAttrib4NsvARB, glVertexAttrib4NsvARB, NULL, 492),
-    NAME_FUNC_OFFSET(20647, glVertexAttrib4NubARB, glVertexAttrib4NubARB, NULL, 493),
-    NAME_FUNC_OFFSET(20666, glVertexAttrib4NubvARB, glVertexAttrib4NubvARB, NULL, 494),
-    NAME_FUNC_OFFSET(20686, glVertexAttrib4NuivARB, glVertexAttrib4NuivARB, NULL, 495),
-    NAME_FUNC_OFFSET(20706, glVertexAttrib4NusvARB, glVertexAttrib4NusvARB, NULL, 496),
-    NAME_FUNC_OFFSET(20726, glVertexAttrib4bvARB, glVertexAttrib4bvARB, NULL, 497),
-    NAME_FUNC_OFFSET(20744, glVertexAttrib4dARB, glVertexAttrib4dARB, NULL, 498),
-    NAME_FUNC_OFFSET(20761, glVertexAttrib4dvARB, glVertexAttrib4dvARB, NULL, 499),
-    NAME_FUNC_OFFSET(20779, glVertexAttrib4fARB, glVertexAttrib4fARB, NULL, 500),
-    NAME_FUNC_OFFSET(20796, glVertexAttrib4fvARB, glVertexAttrib4fvARB, NULL, 501),
-    NAME_FUNC_OFFSET(20814, glVertexAttrib4ivARB, glVertexAttrib4ivARB, NULL, 502),
-    NAME_FUNC_OFFSET(20832, glVertexAttrib4sARB, glVertexAttrib4sARB, NULL, 503),
-    NAME_FUNC_OFFSET(20849, glVertexAttrib4svARB, glVertexAttrib4svARB, NULL, 504),
-    NAME_FUNC_OFFSET(20867, glVertexAttrib4ubvARB, glVertexAttrib4ubvARB, NULL, 505),
-    NAME_FUNC_OFFSET(20886, glVertexAttrib4uivARB, glVertexAttrib4uivARB, NULL, 506),
-    NAME_FUNC_OFFSET(20905, glVertexAttrib4usvARB, glVertexAttrib4usvARB, NULL, 507),
-    NAME_FUNC_OFFSET(20924, glVertexAttribPointerARB, glVertexAttribPointerARB, NULL, 508),
-    NAME_FUNC_OFFSET(20946, glBindBufferARB, glBindBufferARB, NULL, 509),
-    NAME_FUNC_OFFSET(20959, glBufferDataARB, glBufferDataARB, NULL, 510),
-    NAME_FUNC_OFFSET(20972, glBufferSubDataARB, glBufferSubDataARB, NULL, 511),
-    NAME_FUNC_OFFSET(20988, glDeleteBuffersARB, glDeleteBuffersARB, NULL, 512),
-    NAME_FUNC_OFFSET(21004, glGenBuffersARB, glGenBuffersARB, NULL, 513),
-    NAME_FUNC_OFFSET(21017, glGetBufferParameterivARB, glGetBufferParameterivARB, NULL, 514),
-    NAME_FUNC_OFFSET(21040, glGetBufferPointervARB, glGetBufferPointervARB, NULL, 515),
-    NAME_FUNC_OFFSET(21060, glGetBufferSubDataARB, glGetBufferSubDataARB, NULL, 516),
-    NAME_FUNC_OFFSET(21079, glIsBufferARB, glIsBufferARB, NULL, 517),
-    NAME_FUNC_OFFSET(21090, glMapBufferARB, glMapBufferARB, NULL, 518),
-    NAME_FUNC_OFFSET(21102, glUnmapBufferARB, glUnmapBufferARB, NULL, 519),
-    NAME_FUNC_OFFSET(21116, glBeginQueryARB, glBeginQueryARB, NULL, 520),
-    NAME_FUNC_OFFSET(21129, glDeleteQueriesARB, glDeleteQueriesARB, NULL, 521),
-    NAME_FUNC_OFFSET(21145, glEndQueryARB, glEndQueryARB, NULL, 522),
-    NAME_FUNC_OFFSET(21156, glGenQueriesARB, glGenQueriesARB, NULL, 523),
-    NAME_FUNC_OFFSET(21169, glGetQueryObjectivARB, glGetQueryObjectivARB, NULL, 524),
-    NAME_FUNC_OFFSET(21188, glGetQueryObjectuivARB, glGetQueryObjectuivARB, NULL, 525),
-    NAME_FUNC_OFFSET(21208, glGetQueryivARB, glGetQueryivARB, NULL, 526),
-    NAME_FUNC_OFFSET(21221, glIsQueryARB, glIsQueryARB, NULL, 527),
-    NAME_FUNC_OFFSET(21231, glCompileShaderARB, glCompileShaderARB, NULL, 529),
-    NAME_FUNC_OFFSET(21247, glGetActiveUniformARB, glGetActiveUniformARB, NULL, 534),
-    NAME_FUNC_OFFSET(21266, glGetShaderSourceARB, glGetShaderSourceARB, NULL, 540),
-    NAME_FUNC_OFFSET(21284, glGetUniformLocationARB, glGetUniformLocationARB, NULL, 541),
-    NAME_FUNC_OFFSET(21305, glGetUniformfvARB, glGetUniformfvARB, NULL, 542),
-    NAME_FUNC_OFFSET(21320, glGetUniformivARB, glGetUniformivARB, NULL, 543),
-    NAME_FUNC_OFFSET(21335, glLinkProgramARB, glLinkProgramARB, NULL, 544),
-    NAME_FUNC_OFFSET(21349, glShaderSourceARB, glShaderSourceARB, NULL, 545),
-    NAME_FUNC_OFFSET(21364, glUniform1fARB, glUniform1fARB, NULL, 546),
-    NAME_FUNC_OFFSET(21376, glUniform1fvARB, glUniform1fvARB, NULL, 547),
-    NAME_FUNC_OFFSET(21389, glUniform1iARB, glUniform1iARB, NULL, 548),
-    NAME_FUNC_OFFSET(21401, glUniform1ivARB, glUniform1ivARB, NULL, 549),
-    NAME_FUNC_OFFSET(21414, glUniform2fARB, glUniform2fARB, NULL, 550),
-    NAME_FUNC_OFFSET(21426, glUniform2fvARB, glUniform2fvARB, NULL, 551),
-    NAME_FUNC_OFFSET(21439, glUniform2iARB, glUniform2iARB, NULL, 552),
-    NAME_FUNC_OFFSET(21451, glUniform2ivARB, glUniform2ivARB, NULL, 553),
-    NAME_FUNC_OFFSET(21464, glUniform3fARB, glUniform3fARB, NULL, 554),
-    NAME_FUNC_OFFSET(21476, glUniform3fvARB, glUniform3fvARB, NULL, 555),
-    NAME_FUNC_OFFSET(21489, glUniform3iARB, glUniform3iARB, NULL, 556),
-    NAME_FUNC_OFFSET(21501, glUniform3ivARB, glUniform3ivARB, NULL, 557),
-    NAME_FUNC_OFFSET(21514, glUniform4fARB, glUniform4fARB, NULL, 558),
-    NAME_FUNC_OFFSET(21526, glUniform4fvARB, glUniform4fvARB, NULL, 559),
-    NAME_FUNC_OFFSET(21539, glUniform4iARB, glUniform4iARB, NULL, 560),
-    NAME_FUNC_OFFSET(21551, glUniform4ivARB, glUniform4ivARB, NULL, 561),
-    NAME_FUNC_OFFSET(21564, glUniformMatrix2fvARB, glUniformMatrix2fvARB, NULL, 562),
-    NAME_FUNC_OFFSET(21583, glUniformMatrix3fvARB, glUniformMatrix3fvARB, NULL, 563),
-    NAME_FUNC_OFFSET(21602, glUniformMatrix4fvARB, glUniformMatrix4fvARB, NULL, 564),
-    NAME_FUNC_OFFSET(21621, glUseProgramObjectARB, glUseProgramObjectARB, NULL, 565),
-    NAME_FUNC_OFFSET(21634, glValidateProgramARB, glValidateProgramARB, NULL, 566),
-    NAME_FUNC_OFFSET(21652, glBindAttribLocationARB, glBindAttribLocationARB, NULL, 567),
-    NAME_FUNC_OFFSET(21673, glGetActiveAttribARB, glGetActiveAttribARB, NULL, 568),
-    NAME_FUNC_OFFSET(21691, glGetAttribLocationARB, glGetAttribLocationARB, NULL, 569),
-    NAME_FUNC_OFFSET(21711, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
-    NAME_FUNC_OFFSET(21725, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
-    NAME_FUNC_OFFSET(21742, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
-    NAME_FUNC_OFFSET(21758, glDrawArraysInstancedARB, glDrawArraysInstancedARB, NULL, 572),
-    NAME_FUNC_OFFSET(21783, glDrawArraysInstancedARB, glDrawArraysInstancedARB, NULL, 572),
-    NAME_FUNC_OFFSET(21805, glDrawElementsInstancedARB, glDrawElementsInstancedARB, NULL, 573),
-    NAME_FUNC_OFFSET(21832, glDrawElementsInstancedARB, glDrawElementsInstancedARB, NULL, 573),
-    NAME_FUNC_OFFSET(21856, glRenderbufferStorageMultisample, glRenderbufferStorageMultisample, NULL, 574),
-    NAME_FUNC_OFFSET(21892, glTexBufferARB, glTexBufferARB, NULL, 581),
-    NAME_FUNC_OFFSET(21904, glBlendEquationSeparateiARB, glBlendEquationSeparateiARB, NULL, 596),
-    NAME_FUNC_OFFSET(21938, glBlendEquationiARB, glBlendEquationiARB, NULL, 597),
-    NAME_FUNC_OFFSET(21964, glBlendFuncSeparateiARB, glBlendFuncSeparateiARB, NULL, 598),
-    NAME_FUNC_OFFSET(21994, glBlendFunciARB, glBlendFunciARB, NULL, 599),
-    NAME_FUNC_OFFSET(22016, gl_dispatch_stub_703, gl_dispatch_stub_703, NULL, 703),
-    NAME_FUNC_OFFSET(22032, gl_dispatch_stub_704, gl_dispatch_stub_704, NULL, 704),
-    NAME_FUNC_OFFSET(22051, glPointParameterfEXT, glPointParameterfEXT, NULL, 711),
-    NAME_FUNC_OFFSET(22069, glPointParameterfEXT, glPointParameterfEXT, NULL, 711),
-    NAME_FUNC_OFFSET(22090, glPointParameterfEXT, glPointParameterfEXT, NULL, 711),
-    NAME_FUNC_OFFSET(22112, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 712),
-    NAME_FUNC_OFFSET(22131, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 712),
-    NAME_FUNC_OFFSET(22153, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 712),
-    NAME_FUNC_OFFSET(22176, glSecondaryColor3bEXT, glSecondaryColor3bEXT, NULL, 715),
-    NAME_FUNC_OFFSET(22195, glSecondaryColor3bvEXT, glSecondaryColor3bvEXT, NULL, 716),
-    NAME_FUNC_OFFSET(22215, glSecondaryColor3dEXT, glSecondaryColor3dEXT, NULL, 717),
-    NAME_FUNC_OFFSET(22234, glSecondaryColor3dvEXT, glSecondaryColor3dvEXT, NULL, 718),
-    NAME_FUNC_OFFSET(22254, glSecondaryColor3fEXT, glSecondaryColor3fEXT, NULL, 719),
-    NAME_FUNC_OFFSET(22273, glSecondaryColor3fvEXT, glSecondaryColor3fvEXT, NULL, 720),
-    NAME_FUNC_OFFSET(22293, glSecondaryColor3iEXT, glSecondaryColor3iEXT, NULL, 721),
-    NAME_FUNC_OFFSET(22312, glSecondaryColor3ivEXT, glSecondaryColor3ivEXT, NULL, 722),
-    NAME_FUNC_OFFSET(22332, glSecondaryColor3sEXT, glSecondaryColor3sEXT, NULL, 723),
-    NAME_FUNC_OFFSET(22351, glSecondaryColor3svEXT, glSecondaryColor3svEXT, NULL, 724),
-    NAME_FUNC_OFFSET(22371, glSecondaryColor3ubEXT, glSecondaryColor3ubEXT, NULL, 725),
-    NAME_FUNC_OFFSET(22391, glSecondaryColor3ubvEXT, glSecondaryColor3ubvEXT, NULL, 726),
-    NAME_FUNC_OFFSET(22412, glSecondaryColor3uiEXT, glSecondaryColor3uiEXT, NULL, 727),
-    NAME_FUNC_OFFSET(22432, glSecondaryColor3uivEXT, glSecondaryColor3uivEXT, NULL, 728),
-    NAME_FUNC_OFFSET(22453, glSecondaryColor3usEXT, glSecondaryColor3usEXT, NULL, 729),
-    NAME_FUNC_OFFSET(22473, glSecondaryColor3usvEXT, glSecondaryColor3usvEXT, NULL, 730),
-    NAME_FUNC_OFFSET(22494, glSecondaryColorPointerEXT, glSecondaryColorPointerEXT, NULL, 731),
-    NAME_FUNC_OFFSET(22518, glMultiDrawArraysEXT, glMultiDrawArraysEXT, NULL, 732),
-    NAME_FUNC_OFFSET(22536, glMultiDrawElementsEXT, glMultiDrawElementsEXT, NULL, 733),
-    NAME_FUNC_OFFSET(22556, glFogCoordPointerEXT, glFogCoordPointerEXT, NULL, 734),
-    NAME_FUNC_OFFSET(22574, glFogCoorddEXT, glFogCoorddEXT, NULL, 735),
-    NAME_FUNC_OFFSET(22586, glFogCoorddvEXT, glFogCoorddvEXT, NULL, 736),
-    NAME_FUNC_OFFSET(22599, glFogCoordfEXT, glFogCoordfEXT, NULL, 737),
-    NAME_FUNC_OFFSET(22611, glFogCoordfvEXT, glFogCoordfvEXT, NULL, 738),
-    NAME_FUNC_OFFSET(22624, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 740),
-    NAME_FUNC_OFFSET(22644, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 740),
-    NAME_FUNC_OFFSET(22668, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 757),
-    NAME_FUNC_OFFSET(22682, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 757),
-    NAME_FUNC_OFFSET(22699, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 758),
-    NAME_FUNC_OFFSET(22714, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 758),
-    NAME_FUNC_OFFSET(22732, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 759),
-    NAME_FUNC_OFFSET(22746, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 759),
-    NAME_FUNC_OFFSET(22763, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 760),
-    NAME_FUNC_OFFSET(22778, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 760),
-    NAME_FUNC_OFFSET(22796, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 761),
-    NAME_FUNC_OFFSET(22810, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 761),
-    NAME_FUNC_OFFSET(22827, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 762),
-    NAME_FUNC_OFFSET(22842, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 762),
-    NAME_FUNC_OFFSET(22860, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 763),
-    NAME_FUNC_OFFSET(22874, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 763),
-    NAME_FUNC_OFFSET(22891, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 764),
-    NAME_FUNC_OFFSET(22906, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 764),
-    NAME_FUNC_OFFSET(22924, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 765),
-    NAME_FUNC_OFFSET(22938, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 765),
-    NAME_FUNC_OFFSET(22955, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 766),
-    NAME_FUNC_OFFSET(22970, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 766),
-    NAME_FUNC_OFFSET(22988, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 767),
-    NAME_FUNC_OFFSET(23002, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 767),
-    NAME_FUNC_OFFSET(23019, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 768),
-    NAME_FUNC_OFFSET(23034, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 768),
-    NAME_FUNC_OFFSET(23052, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 769),
-    NAME_FUNC_OFFSET(23066, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 769),
-    NAME_FUNC_OFFSET(23083, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 770),
-    NAME_FUNC_OFFSET(23098, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 770),
-    NAME_FUNC_OFFSET(23116, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 771),
-    NAME_FUNC_OFFSET(23130, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 771),
-    NAME_FUNC_OFFSET(23147, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 772),
-    NAME_FUNC_OFFSET(23162, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 772),
-    NAME_FUNC_OFFSET(23180, glBindProgramNV, glBindProgramNV, NULL, 791),
-    NAME_FUNC_OFFSET(23197, glDeleteProgramsNV, glDeleteProgramsNV, NULL, 792),
-    NAME_FUNC_OFFSET(23217, glGenProgramsNV, glGenProgramsNV, NULL, 794),
-    NAME_FUNC_OFFSET(23234, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 800),
-    NAME_FUNC_OFFSET(23260, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 800),
-    NAME_FUNC_OFFSET(23289, glIsProgramNV, glIsProgramNV, NULL, 804),
-    NAME_FUNC_OFFSET(23304, glPointParameteriNV, glPointParameteriNV, NULL, 868),
-    NAME_FUNC_OFFSET(23322, glPointParameterivNV, glPointParameterivNV, NULL, 869),
-    NAME_FUNC_OFFSET(23341, gl_dispatch_stub_872, gl_dispatch_stub_872, NULL, 872),
-    NAME_FUNC_OFFSET(23362, gl_dispatch_stub_874, gl_dispatch_stub_874, NULL, 874),
-    NAME_FUNC_OFFSET(23378, glPrimitiveRestartIndexNV, glPrimitiveRestartIndexNV, NULL, 881),
-    NAME_FUNC_OFFSET(23402, gl_dispatch_stub_884, gl_dispatch_stub_884, NULL, 884),
-    NAME_FUNC_OFFSET(23426, gl_dispatch_stub_884, gl_dispatch_stub_884, NULL, 884),
-    NAME_FUNC_OFFSET(23453, glBindFramebufferEXT, glBindFramebufferEXT, NULL, 885),
-    NAME_FUNC_OFFSET(23471, glBindRenderbufferEXT, glBindRenderbufferEXT, NULL, 886),
-    NAME_FUNC_OFFSET(23490, glCheckFramebufferStatusEXT, glCheckFramebufferStatusEXT, NULL, 887),
-    NAME_FUNC_OFFSET(23515, glDeleteFramebuffersEXT, glDeleteFramebuffersEXT, NULL, 888),
-    NAME_FUNC_OFFSET(23536, glDeleteRenderbuffersEXT, glDeleteRenderbuffersEXT, NULL, 889),
-    NAME_FUNC_OFFSET(23558, glFramebufferRenderbufferEXT, glFramebufferRenderbufferEXT, NULL, 890),
-    NAME_FUNC_OFFSET(23584, glFramebufferTexture1DEXT, glFramebufferTexture1DEXT, NULL, 891),
-    NAME_FUNC_OFFSET(23607, glFramebufferTexture2DEXT, glFramebufferTexture2DEXT, NULL, 892),
-    NAME_FUNC_OFFSET(23630, glFramebufferTexture3DEXT, glFramebufferTexture3DEXT, NULL, 893),
-    NAME_FUNC_OFFSET(23653, glGenFramebuffersEXT, glGenFramebuffersEXT, NULL, 894),
-    NAME_FUNC_OFFSET(23671, glGenRenderbuffersEXT, glGenRenderbuffersEXT, NULL, 895),
-    NAME_FUNC_OFFSET(23690, glGenerateMipmapEXT, glGenerateMipmapEXT, NULL, 896),
-    NAME_FUNC_OFFSET(23707, glGetFramebufferAttachmentParameterivEXT, glGetFramebufferAttachmentParameterivEXT, NULL, 897),
-    NAME_FUNC_OFFSET(23745, glGetRenderbufferParameterivEXT, glGetRenderbufferParameterivEXT, NULL, 898),
-    NAME_FUNC_OFFSET(23774, glIsFramebufferEXT, glIsFramebufferEXT, NULL, 899),
-    NAME_FUNC_OFFSET(23790, glIsRenderbufferEXT, glIsRenderbufferEXT, NULL, 900),
-    NAME_FUNC_OFFSET(23807, glRenderbufferStorageEXT, glRenderbufferStorageEXT, NULL, 901),
-    NAME_FUNC_OFFSET(23829, gl_dispatch_stub_902, gl_dispatch_stub_902, NULL, 902),
-    NAME_FUNC_OFFSET(23847, glBindFragDataLocationEXT, glBindFragDataLocationEXT, NULL, 905),
-    NAME_FUNC_OFFSET(23870, glGetFragDataLocationEXT, glGetFragDataLocationEXT, NULL, 906),
-    NAME_FUNC_OFFSET(23892, glGetUniformuivEXT, glGetUniformuivEXT, NULL, 907),
-    NAME_FUNC_OFFSET(23908, glGetVertexAttribIivEXT, glGetVertexAttribIivEXT, NULL, 908),
-    NAME_FUNC_OFFSET(23929, glGetVertexAttribIuivEXT, glGetVertexAttribIuivEXT, NULL, 909),
-    NAME_FUNC_OFFSET(23951, glUniform1uiEXT, glUniform1uiEXT, NULL, 910),
-    NAME_FUNC_OFFSET(23964, glUniform1uivEXT, glUniform1uivEXT, NULL, 911),
-    NAME_FUNC_OFFSET(23978, glUniform2uiEXT, glUniform2uiEXT, NULL, 912),
-    NAME_FUNC_OFFSET(23991, glUniform2uivEXT, glUniform2uivEXT, NULL, 913),
-    NAME_FUNC_OFFSET(24005, glUniform3uiEXT, glUniform3uiEXT, NULL, 914),
-    NAME_FUNC_OFFSET(24018, glUniform3uivEXT, glUniform3uivEXT, NULL, 915),
-    NAME_FUNC_OFFSET(24032, glUniform4uiEXT, glUniform4uiEXT, NULL, 916),
-    NAME_FUNC_OFFSET(24045, glUniform4uivEXT, glUniform4uivEXT, NULL, 917),
-    NAME_FUNC_OFFSET(24059, glVertexAttribI1iEXT, glVertexAttribI1iEXT, NULL, 918),
-    NAME_FUNC_OFFSET(24077, glVertexAttribI1ivEXT, glVertexAttribI1ivEXT, NULL, 919),
-    NAME_FUNC_OFFSET(24096, glVertexAttribI1uiEXT, glVertexAttribI1uiEXT, NULL, 920),
-    NAME_FUNC_OFFSET(24115, glVertexAttribI1uivEXT, glVertexAttribI1uivEXT, NULL, 921),
-    NAME_FUNC_OFFSET(24135, glVertexAttribI2iEXT, glVertexAttribI2iEXT, NULL, 922),
-    NAME_FUNC_OFFSET(24153, glVertexAttribI2ivEXT, glVertexAttribI2ivEXT, NULL, 923),
-    NAME_FUNC_OFFSET(24172, glVertexAttribI2uiEXT, glVertexAttribI2uiEXT, NULL, 924),
-    NAME_FUNC_OFFSET(24191, glVertexAttribI2uivEXT, glVertexAttribI2uivEXT, NULL, 925),
-    NAME_FUNC_OFFSET(24211, glVertexAttribI3iEXT, glVertexAttribI3iEXT, NULL, 926),
-    NAME_FUNC_OFFSET(24229, glVertexAttribI3ivEXT, glVertexAttribI3ivEXT, NULL, 927),
-    NAME_FUNC_OFFSET(24248, glVertexAttribI3uiEXT, glVertexAttribI3uiEXT, NULL, 928),
-    NAME_FUNC_OFFSET(24267, glVertexAttribI3uivEXT, glVertexAttribI3uivEXT, NULL, 929),
-    NAME_FUNC_OFFSET(24287, glVertexAttribI4bvEXT, glVertexAttribI4bvEXT, NULL, 930),
-    NAME_FUNC_OFFSET(24306, glVertexAttribI4iEXT, glVertexAttribI4iEXT, NULL, 931),
-    NAME_FUNC_OFFSET(24324, glVertexAttribI4ivEXT, glVertexAttribI4ivEXT, NULL, 932),
-    NAME_FUNC_OFFSET(24343, glVertexAttribI4svEXT, glVertexAttribI4svEXT, NULL, 933),
-    NAME_FUNC_OFFSET(24362, glVertexAttribI4ubvEXT, glVertexAttribI4ubvEXT, NULL, 934),
-    NAME_FUNC_OFFSET(24382, glVertexAttribI4uiEXT, glVertexAttribI4uiEXT, NULL, 935),
-    NAME_FUNC_OFFSET(24401, glVertexAttribI4uivEXT, glVertexAttribI4uivEXT, NULL, 936),
-    NAME_FUNC_OFFSET(24421, glVertexAttribI4usvEXT, glVertexAttribI4usvEXT, NULL, 937),
-    NAME_FUNC_OFFSET(24441, glVertexAttribIPointerEXT, glVertexAttribIPointerEXT, NULL, 938),
-    NAME_FUNC_OFFSET(24464, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 939),
-    NAME_FUNC_OFFSET(24490, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 939),
-    NAME_FUNC_OFFSET(24519, glColorMaskIndexedEXT, glColorMaskIndexedEXT, NULL, 940),
-    NAME_FUNC_OFFSET(24532, glDisableIndexedEXT, glDisableIndexedEXT, NULL, 941),
-    NAME_FUNC_OFFSET(24543, glEnableIndexedEXT, glEnableIndexedEXT, NULL, 942),
-    NAME_FUNC_OFFSET(24553, glGetBooleanIndexedvEXT, glGetBooleanIndexedvEXT, NULL, 943),
-    NAME_FUNC_OFFSET(24569, glGetIntegerIndexedvEXT, glGetIntegerIndexedvEXT, NULL, 944),
-    NAME_FUNC_OFFSET(24585, glIsEnabledIndexedEXT, glIsEnabledIndexedEXT, NULL, 945),
-    NAME_FUNC_OFFSET(24598, glGetTexParameterIivEXT, glGetTexParameterIivEXT, NULL, 948),
-    NAME_FUNC_OFFSET(24619, glGetTexParameterIuivEXT, glGetTexParameterIuivEXT, NULL, 949),
-    NAME_FUNC_OFFSET(24641, glTexParameterIivEXT, glTexParameterIivEXT, NULL, 950),
-    NAME_FUNC_OFFSET(24659, glTexParameterIuivEXT, glTexParameterIuivEXT, NULL, 951),
-    NAME_FUNC_OFFSET(24678, glBeginConditionalRenderNV, glBeginConditionalRenderNV, NULL, 952),
-    NAME_FUNC_OFFSET(24703, glEndConditionalRenderNV, glEndConditionalRenderNV, NULL, 953),
-    NAME_FUNC_OFFSET(24726, glBeginTransformFeedbackEXT, glBeginTransformFeedbackEXT, NULL, 954),
-    NAME_FUNC_OFFSET(24751, glBindBufferBaseEXT, glBindBufferBaseEXT, NULL, 955),
-    NAME_FUNC_OFFSET(24768, glBindBufferRangeEXT, glBindBufferRangeEXT, NULL, 957),
-    NAME_FUNC_OFFSET(24786, glEndTransformFeedbackEXT, glEndTransformFeedbackEXT, NULL, 958),
-    NAME_FUNC_OFFSET(24809, glGetTransformFeedbackVaryingEXT, glGetTransformFeedbackVaryingEXT, NULL, 959),
-    NAME_FUNC_OFFSET(24839, glTransformFeedbackVaryingsEXT, glTransformFeedbackVaryingsEXT, NULL, 960),
-    NAME_FUNC_OFFSET(24867, glProvokingVertexEXT, glProvokingVertexEXT, NULL, 961),
+    NAME_FUNC_OFFSET(10982, gl_dispatch_stub_666, gl_dispatch_stub_666, NULL, 666),
+    NAME_FUNC_OFFSET(11001, gl_dispatch_stub_667, gl_dispatch_stub_667, NULL, 667),
+    NAME_FUNC_OFFSET(11017, glDebugMessageCallbackARB, glDebugMessageCallbackARB, NULL, 668),
+    NAME_FUNC_OFFSET(11043, glDebugMessageControlARB, glDebugMessageControlARB, NULL, 669),
+    NAME_FUNC_OFFSET(11068, glDebugMessageInsertARB, glDebugMessageInsertARB, NULL, 670),
+    NAME_FUNC_OFFSET(11092, glGetDebugMessageLogARB, glGetDebugMessageLogARB, NULL, 671),
+    NAME_FUNC_OFFSET(11116, glGetGraphicsResetStatusARB, glGetGraphicsResetStatusARB, NULL, 672),
+    NAME_FUNC_OFFSET(11144, glGetnColorTableARB, glGetnColorTableARB, NULL, 673),
+    NAME_FUNC_OFFSET(11164, glGetnCompressedTexImageARB, glGetnCompressedTexImageARB, NULL, 674),
+    NAME_FUNC_OFFSET(11192, glGetnConvolutionFilterARB, glGetnConvolutionFilterARB, NULL, 675),
+    NAME_FUNC_OFFSET(11219, glGetnHistogramARB, glGetnHistogramARB, NULL, 676),
+    NAME_FUNC_OFFSET(11238, glGetnMapdvARB, glGetnMapdvARB, NULL, 677),
+    NAME_FUNC_OFFSET(11253, glGetnMapfvARB, glGetnMapfvARB, NULL, 678),
+    NAME_FUNC_OFFSET(11268, glGetnMapivARB, glGetnMapivARB, NULL, 679),
+    NAME_FUNC_OFFSET(11283, glGetnMinmaxARB, glGetnMinmaxARB, NULL, 680),
+    NAME_FUNC_OFFSET(11299, glGetnPixelMapfvARB, glGetnPixelMapfvARB, NULL, 681),
+    NAME_FUNC_OFFSET(11319, glGetnPixelMapuivARB, glGetnPixelMapuivARB, NULL, 682),
+    NAME_FUNC_OFFSET(11340, glGetnPixelMapusvARB, glGetnPixelMapusvARB, NULL, 683),
+    NAME_FUNC_OFFSET(11361, glGetnPolygonStippleARB, glGetnPolygonStippleARB, NULL, 684),
+    NAME_FUNC_OFFSET(11385, glGetnSeparableFilterARB, glGetnSeparableFilterARB, NULL, 685),
+    NAME_FUNC_OFFSET(11410, glGetnTexImageARB, glGetnTexImageARB, NULL, 686),
+    NAME_FUNC_OFFSET(11428, glGetnUniformdvARB, glGetnUniformdvARB, NULL, 687),
+    NAME_FUNC_OFFSET(11447, glGetnUniformfvARB, glGetnUniformfvARB, NULL, 688),
+    NAME_FUNC_OFFSET(11466, glGetnUniformivARB, glGetnUniformivARB, NULL, 689),
+    NAME_FUNC_OFFSET(11485, glGetnUniformuivARB, glGetnUniformuivARB, NULL, 690),
+    NAME_FUNC_OFFSET(11505, glReadnPixelsARB, glReadnPixelsARB, NULL, 691),
+    NAME_FUNC_OFFSET(11522, glTexStorage1D, glTexStorage1D, NULL, 692),
+    NAME_FUNC_OFFSET(11537, glTexStorage2D, glTexStorage2D, NULL, 693),
+    NAME_FUNC_OFFSET(11552, glTexStorage3D, glTexStorage3D, NULL, 694),
+    NAME_FUNC_OFFSET(11567, glTextureStorage1DEXT, glTextureStorage1DEXT, NULL, 695),
+    NAME_FUNC_OFFSET(11589, glTextureStorage2DEXT, glTextureStorage2DEXT, NULL, 696),
+    NAME_FUNC_OFFSET(11611, glTextureStorage3DEXT, glTextureStorage3DEXT, NULL, 697),
+    NAME_FUNC_OFFSET(11633, glPolygonOffsetEXT, glPolygonOffsetEXT, NULL, 698),
+    NAME_FUNC_OFFSET(11652, gl_dispatch_stub_699, gl_dispatch_stub_699, NULL, 699),
+    NAME_FUNC_OFFSET(11684, gl_dispatch_stub_700, gl_dispatch_stub_700, NULL, 700),
+    NAME_FUNC_OFFSET(11716, gl_dispatch_stub_701, gl_dispatch_stub_701, NULL, 701),
+    NAME_FUNC_OFFSET(11744, gl_dispatch_stub_702, gl_dispatch_stub_702, NULL, 702),
+    NAME_FUNC_OFFSET(11773, gl_dispatch_stub_703, gl_dispatch_stub_703, NULL, 703),
+    NAME_FUNC_OFFSET(11801, gl_dispatch_stub_704, gl_dispatch_stub_704, NULL, 704),
+    NAME_FUNC_OFFSET(11830, gl_dispatch_stub_705, gl_dispatch_stub_705, NULL, 705),
+    NAME_FUNC_OFFSET(11847, gl_dispatch_stub_706, gl_dispatch_stub_706, NULL, 706),
+    NAME_FUNC_OFFSET(11867, glColorPointerEXT, glColorPointerEXT, NULL, 707),
+    NAME_FUNC_OFFSET(11885, glEdgeFlagPointerEXT, glEdgeFlagPointerEXT, NULL, 708),
+    NAME_FUNC_OFFSET(11906, glIndexPointerEXT, glIndexPointerEXT, NULL, 709),
+    NAME_FUNC_OFFSET(11924, glNormalPointerEXT, glNormalPointerEXT, NULL, 710),
+    NAME_FUNC_OFFSET(11943, glTexCoordPointerEXT, glTexCoordPointerEXT, NULL, 711),
+    NAME_FUNC_OFFSET(11964, glVertexPointerEXT, glVertexPointerEXT, NULL, 712),
+    NAME_FUNC_OFFSET(11983, glPointParameterfEXT, glPointParameterfEXT, NULL, 713),
+    NAME_FUNC_OFFSET(12004, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 714),
+    NAME_FUNC_OFFSET(12026, glLockArraysEXT, glLockArraysEXT, NULL, 715),
+    NAME_FUNC_OFFSET(12042, glUnlockArraysEXT, glUnlockArraysEXT, NULL, 716),
+    NAME_FUNC_OFFSET(12060, glSecondaryColor3bEXT, glSecondaryColor3bEXT, NULL, 717),
+    NAME_FUNC_OFFSET(12082, glSecondaryColor3bvEXT, glSecondaryColor3bvEXT, NULL, 718),
+    NAME_FUNC_OFFSET(12105, glSecondaryColor3dEXT, glSecondaryColor3dEXT, NULL, 719),
+    NAME_FUNC_OFFSET(12127, glSecondaryColor3dvEXT, glSecondaryColor3dvEXT, NULL, 720),
+    NAME_FUNC_OFFSET(12150, glSecondaryColor3fEXT, glSecondaryColor3fEXT, NULL, 721),
+    NAME_FUNC_OFFSET(12172, glSecondaryColor3fvEXT, glSecondaryColor3fvEXT, NULL, 722),
+    NAME_FUNC_OFFSET(12195, glSecondaryColor3iEXT, glSecondaryColor3iEXT, NULL, 723),
+    NAME_FUNC_OFFSET(12217, glSecondaryColor3ivEXT, glSecondaryColor3ivEXT, NULL, 724),
+    NAME_FUNC_OFFSET(12240, glSecondaryColor3sEXT, glSecondaryColor3sEXT, NULL, 725),
+    NAME_FUNC_OFFSET(12262, glSecondaryColor3svEXT, glSecondaryColor3svEXT, NULL, 726),
+    NAME_FUNC_OFFSET(12285, glSecondaryColor3ubEXT, glSecondaryColor3ubEXT, NULL, 727),
+    NAME_FUNC_OFFSET(12308, glSecondaryColor3ubvEXT, glSecondaryColor3ubvEXT, NULL, 728),
+    NAME_FUNC_OFFSET(12332, glSecondaryColor3uiEXT, glSecondaryColor3uiEXT, NULL, 729),
+    NAME_FUNC_OFFSET(12355, glSecondaryColor3uivEXT, glSecondaryColor3uivEXT, NULL, 730),
+    NAME_FUNC_OFFSET(12379, glSecondaryColor3usEXT, glSecondaryColor3usEXT, NULL, 731),
+    NAME_FUNC_OFFSET(12402, glSecondaryColor3usvEXT, glSecondaryColor3usvEXT, NULL, 732),
+    NAME_FUNC_OFFSET(12426, glSecondaryColorPointerEXT, glSecondaryColorPointerEXT, NULL, 733),
+    NAME_FUNC_OFFSET(12453, glMultiDrawArraysEXT, glMultiDrawArraysEXT, NULL, 734),
+    NAME_FUNC_OFFSET(12474, glMultiDrawElementsEXT, glMultiDrawElementsEXT, NULL, 735),
+    NAME_FUNC_OFFSET(12497, glFogCoordPointerEXT, glFogCoordPointerEXT, NULL, 736),
+    NAME_FUNC_OFFSET(12518, glFogCoorddEXT, glFogCoorddEXT, NULL, 737),
+    NAME_FUNC_OFFSET(12533, glFogCoorddvEXT, glFogCoorddvEXT, NULL, 738),
+    NAME_FUNC_OFFSET(12549, glFogCoordfEXT, glFogCoordfEXT, NULL, 739),
+    NAME_FUNC_OFFSET(12564, glFogCoordfvEXT, glFogCoordfvEXT, NULL, 740),
+    NAME_FUNC_OFFSET(12580, gl_dispatch_stub_741, gl_dispatch_stub_741, NULL, 741),
+    NAME_FUNC_OFFSET(12598, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 742),
+    NAME_FUNC_OFFSET(12621, glFlushVertexArrayRangeNV, glFlushVertexArrayRangeNV, NULL, 743),
+    NAME_FUNC_OFFSET(12647, glVertexArrayRangeNV, glVertexArrayRangeNV, NULL, 744),
+    NAME_FUNC_OFFSET(12668, glCombinerInputNV, glCombinerInputNV, NULL, 745),
+    NAME_FUNC_OFFSET(12686, glCombinerOutputNV, glCombinerOutputNV, NULL, 746),
+    NAME_FUNC_OFFSET(12705, glCombinerParameterfNV, glCombinerParameterfNV, NULL, 747),
+    NAME_FUNC_OFFSET(12728, glCombinerParameterfvNV, glCombinerParameterfvNV, NULL, 748),
+    NAME_FUNC_OFFSET(12752, glCombinerParameteriNV, glCombinerParameteriNV, NULL, 749),
+    NAME_FUNC_OFFSET(12775, glCombinerParameterivNV, glCombinerParameterivNV, NULL, 750),
+    NAME_FUNC_OFFSET(12799, glFinalCombinerInputNV, glFinalCombinerInputNV, NULL, 751),
+    NAME_FUNC_OFFSET(12822, glGetCombinerInputParameterfvNV, glGetCombinerInputParameterfvNV, NULL, 752),
+    NAME_FUNC_OFFSET(12854, glGetCombinerInputParameterivNV, glGetCombinerInputParameterivNV, NULL, 753),
+    NAME_FUNC_OFFSET(12886, glGetCombinerOutputParameterfvNV, glGetCombinerOutputParameterfvNV, NULL, 754),
+    NAME_FUNC_OFFSET(12919, glGetCombinerOutputParameterivNV, glGetCombinerOutputParameterivNV, NULL, 755),
+    NAME_FUNC_OFFSET(12952, glGetFinalCombinerInputParameterfvNV, glGetFinalCombinerInputParameterfvNV, NULL, 756),
+    NAME_FUNC_OFFSET(12989, glGetFinalCombinerInputParameterivNV, glGetFinalCombinerInputParameterivNV, NULL, 757),
+    NAME_FUNC_OFFSET(13026, glResizeBuffersMESA, glResizeBuffersMESA, NULL, 758),
+    NAME_FUNC_OFFSET(13046, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 759),
+    NAME_FUNC_OFFSET(13064, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 760),
+    NAME_FUNC_OFFSET(13083, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 761),
+    NAME_FUNC_OFFSET(13101, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 762),
+    NAME_FUNC_OFFSET(13120, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 763),
+    NAME_FUNC_OFFSET(13138, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 764),
+    NAME_FUNC_OFFSET(13157, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 765),
+    NAME_FUNC_OFFSET(13175, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 766),
+    NAME_FUNC_OFFSET(13194, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 767),
+    NAME_FUNC_OFFSET(13212, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 768),
+    NAME_FUNC_OFFSET(13231, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 769),
+    NAME_FUNC_OFFSET(13249, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 770),
+    NAME_FUNC_OFFSET(13268, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 771),
+    NAME_FUNC_OFFSET(13286, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 772),
+    NAME_FUNC_OFFSET(13305, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 773),
+    NAME_FUNC_OFFSET(13323, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 774),
+    NAME_FUNC_OFFSET(13342, glWindowPos4dMESA, glWindowPos4dMESA, NULL, 775),
+    NAME_FUNC_OFFSET(13360, glWindowPos4dvMESA, glWindowPos4dvMESA, NULL, 776),
+    NAME_FUNC_OFFSET(13379, glWindowPos4fMESA, glWindowPos4fMESA, NULL, 777),
+    NAME_FUNC_OFFSET(13397, glWindowPos4fvMESA, glWindowPos4fvMESA, NULL, 778),
+    NAME_FUNC_OFFSET(13416, glWindowPos4iMESA, glWindowPos4iMESA, NULL, 779),
+    NAME_FUNC_OFFSET(13434, glWindowPos4ivMESA, glWindowPos4ivMESA, NULL, 780),
+    NAME_FUNC_OFFSET(13453, glWindowPos4sMESA, glWindowPos4sMESA, NULL, 781),
+    NAME_FUNC_OFFSET(13471, glWindowPos4svMESA, glWindowPos4svMESA, NULL, 782),
+    NAME_FUNC_OFFSET(13490, gl_dispatch_stub_783, gl_dispatch_stub_783, NULL, 783),
+    NAME_FUNC_OFFSET(13515, gl_dispatch_stub_784, gl_dispatch_stub_784, NULL, 784),
+    NAME_FUNC_OFFSET(13542, gl_dispatch_stub_785, gl_dispatch_stub_785, NULL, 785),
+    NAME_FUNC_OFFSET(13559, gl_dispatch_stub_786, gl_dispatch_stub_786, NULL, 786),
+    NAME_FUNC_OFFSET(13575, gl_dispatch_stub_787, gl_dispatch_stub_787, NULL, 787),
+    NAME_FUNC_OFFSET(13589, gl_dispatch_stub_788, gl_dispatch_stub_788, NULL, 788),
+    NAME_FUNC_OFFSET(13604, gl_dispatch_stub_789, gl_dispatch_stub_789, NULL, 789),
+    NAME_FUNC_OFFSET(13616, gl_dispatch_stub_790, gl_dispatch_stub_790, NULL, 790),
+    NAME_FUNC_OFFSET(13629, gl_dispatch_stub_791, gl_dispatch_stub_791, NULL, 791),
+    NAME_FUNC_OFFSET(13643, glAreProgramsResidentNV, glAreProgramsResidentNV, NULL, 792),
+    NAME_FUNC_OFFSET(13667, glBindProgramNV, glBindProgramNV, NULL, 793),
+    NAME_FUNC_OFFSET(13683, glDeleteProgramsNV, glDeleteProgramsNV, NULL, 794),
+    NAME_FUNC_OFFSET(13702, glExecuteProgramNV, glExecuteProgramNV, NULL, 795),
+    NAME_FUNC_OFFSET(13721, glGenProgramsNV, glGenProgramsNV, NULL, 796),
+    NAME_FUNC_OFFSET(13737, glGetProgramParameterdvNV, glGetProgramParameterdvNV, NULL, 797),
+    NAME_FUNC_OFFSET(13763, glGetProgramParameterfvNV, glGetProgramParameterfvNV, NULL, 798),
+    NAME_FUNC_OFFSET(13789, glGetProgramStringNV, glGetProgramStringNV, NULL, 799),
+    NAME_FUNC_OFFSET(13810, glGetProgramivNV, glGetProgramivNV, NULL, 800),
+    NAME_FUNC_OFFSET(13827, glGetTrackMatrixivNV, glGetTrackMatrixivNV, NULL, 801),
+    NAME_FUNC_OFFSET(13848, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 802),
+    NAME_FUNC_OFFSET(13876, glGetVertexAttribdvNV, glGetVertexAttribdvNV, NULL, 803),
+    NAME_FUNC_OFFSET(13898, glGetVertexAttribfvNV, glGetVertexAttribfvNV, NULL, 804),
+    NAME_FUNC_OFFSET(13920, glGetVertexAttribivNV, glGetVertexAttribivNV, NULL, 805),
+    NAME_FUNC_OFFSET(13942, glIsProgramNV, glIsProgramNV, NULL, 806),
+    NAME_FUNC_OFFSET(13956, glLoadProgramNV, glLoadProgramNV, NULL, 807),
+    NAME_FUNC_OFFSET(13972, glProgramParameters4dvNV, glProgramParameters4dvNV, NULL, 808),
+    NAME_FUNC_OFFSET(13997, glProgramParameters4fvNV, glProgramParameters4fvNV, NULL, 809),
+    NAME_FUNC_OFFSET(14022, glRequestResidentProgramsNV, glRequestResidentProgramsNV, NULL, 810),
+    NAME_FUNC_OFFSET(14050, glTrackMatrixNV, glTrackMatrixNV, NULL, 811),
+    NAME_FUNC_OFFSET(14066, glVertexAttrib1dNV, glVertexAttrib1dNV, NULL, 812),
+    NAME_FUNC_OFFSET(14085, glVertexAttrib1dvNV, glVertexAttrib1dvNV, NULL, 813),
+    NAME_FUNC_OFFSET(14105, glVertexAttrib1fNV, glVertexAttrib1fNV, NULL, 814),
+    NAME_FUNC_OFFSET(14124, glVertexAttrib1fvNV, glVertexAttrib1fvNV, NULL, 815),
+    NAME_FUNC_OFFSET(14144, glVertexAttrib1sNV, glVertexAttrib1sNV, NULL, 816),
+    NAME_FUNC_OFFSET(14163, glVertexAttrib1svNV, glVertexAttrib1svNV, NULL, 817),
+    NAME_FUNC_OFFSET(14183, glVertexAttrib2dNV, glVertexAttrib2dNV, NULL, 818),
+    NAME_FUNC_OFFSET(14202, glVertexAttrib2dvNV, glVertexAttrib2dvNV, NULL, 819),
+    NAME_FUNC_OFFSET(14222, glVertexAttrib2fNV, glVertexAttrib2fNV, NULL, 820),
+    NAME_FUNC_OFFSET(14241, glVertexAttrib2fvNV, glVertexAttrib2fvNV, NULL, 821),
+    NAME_FUNC_OFFSET(14261, glVertexAttrib2sNV, glVertexAttrib2sNV, NULL, 822),
+    NAME_FUNC_OFFSET(14280, glVertexAttrib2svNV, glVertexAttrib2svNV, NULL, 823),
+    NAME_FUNC_OFFSET(14300, glVertexAttrib3dNV, glVertexAttrib3dNV, NULL, 824),
+    NAME_FUNC_OFFSET(14319, glVertexAttrib3dvNV, glVertexAttrib3dvNV, NULL, 825),
+    NAME_FUNC_OFFSET(14339, glVertexAttrib3fNV, glVertexAttrib3fNV, NULL, 826),
+    NAME_FUNC_OFFSET(14358, glVertexAttrib3fvNV, glVertexAttrib3fvNV, NULL, 827),
+    NAME_FUNC_OFFSET(14378, glVertexAttrib3sNV, glVertexAttrib3sNV, NULL, 828),
+    NAME_FUNC_OFFSET(14397, glVertexAttrib3svNV, glVertexAttrib3svNV, NULL, 829),
+    NAME_FUNC_OFFSET(14417, glVertexAttrib4dNV, glVertexAttrib4dNV, NULL, 830),
+    NAME_FUNC_OFFSET(14436, glVertexAttrib4dvNV, glVertexAttrib4dvNV, NULL, 831),
+    NAME_FUNC_OFFSET(14456, glVertexAttrib4fNV, glVertexAttrib4fNV, NULL, 832),
+    NAME_FUNC_OFFSET(14475, glVertexAttrib4fvNV, glVertexAttrib4fvNV, NULL, 833),
+    NAME_FUNC_OFFSET(14495, glVertexAttrib4sNV, glVertexAttrib4sNV, NULL, 834),
+    NAME_FUNC_OFFSET(14514, glVertexAttrib4svNV, glVertexAttrib4svNV, NULL, 835),
+    NAME_FUNC_OFFSET(14534, glVertexAttrib4ubNV, glVertexAttrib4ubNV, NULL, 836),
+    NAME_FUNC_OFFSET(14554, glVertexAttrib4ubvNV, glVertexAttrib4ubvNV, NULL, 837),
+    NAME_FUNC_OFFSET(14575, glVertexAttribPointerNV, glVertexAttribPointerNV, NULL, 838),
+    NAME_FUNC_OFFSET(14599, glVertexAttribs1dvNV, glVertexAttribs1dvNV, NULL, 839),
+    NAME_FUNC_OFFSET(14620, glVertexAttribs1fvNV, glVertexAttribs1fvNV, NULL, 840),
+    NAME_FUNC_OFFSET(14641, glVertexAttribs1svNV, glVertexAttribs1svNV, NULL, 841),
+    NAME_FUNC_OFFSET(14662, glVertexAttribs2dvNV, glVertexAttribs2dvNV, NULL, 842),
+    NAME_FUNC_OFFSET(14683, glVertexAttribs2fvNV, glVertexAttribs2fvNV, NULL, 843),
+    NAME_FUNC_OFFSET(14704, glVertexAttribs2svNV, glVertexAttribs2svNV, NULL, 844),
+    NAME_FUNC_OFFSET(14725, glVertexAttribs3dvNV, glVertexAttribs3dvNV, NULL, 845),
+    NAME_FUNC_OFFSET(14746, glVertexAttribs3fvNV, glVertexAttribs3fvNV, NULL, 846),
+    NAME_FUNC_OFFSET(14767, glVertexAttribs3svNV, glVertexAttribs3svNV, NULL, 847),
+    NAME_FUNC_OFFSET(14788, glVertexAttribs4dvNV, glVertexAttribs4dvNV, NULL, 848),
+    NAME_FUNC_OFFSET(14809, glVertexAttribs4fvNV, glVertexAttribs4fvNV, NULL, 849),
+    NAME_FUNC_OFFSET(14830, glVertexAttribs4svNV, glVertexAttribs4svNV, NULL, 850),
+    NAME_FUNC_OFFSET(14851, glVertexAttribs4ubvNV, glVertexAttribs4ubvNV, NULL, 851),
+    NAME_FUNC_OFFSET(14873, glGetTexBumpParameterfvATI, glGetTexBumpParameterfvATI, NULL, 852),
+    NAME_FUNC_OFFSET(14900, glGetTexBumpParameterivATI, glGetTexBumpParameterivATI, NULL, 853),
+    NAME_FUNC_OFFSET(14927, glTexBumpParameterfvATI, glTexBumpParameterfvATI, NULL, 854),
+    NAME_FUNC_OFFSET(14951, glTexBumpParameterivATI, glTexBumpParameterivATI, NULL, 855),
+    NAME_FUNC_OFFSET(14975, glAlphaFragmentOp1ATI, glAlphaFragmentOp1ATI, NULL, 856),
+    NAME_FUNC_OFFSET(14997, glAlphaFragmentOp2ATI, glAlphaFragmentOp2ATI, NULL, 857),
+    NAME_FUNC_OFFSET(15019, glAlphaFragmentOp3ATI, glAlphaFragmentOp3ATI, NULL, 858),
+    NAME_FUNC_OFFSET(15041, glBeginFragmentShaderATI, glBeginFragmentShaderATI, NULL, 859),
+    NAME_FUNC_OFFSET(15066, glBindFragmentShaderATI, glBindFragmentShaderATI, NULL, 860),
+    NAME_FUNC_OFFSET(15090, glColorFragmentOp1ATI, glColorFragmentOp1ATI, NULL, 861),
+    NAME_FUNC_OFFSET(15112, glColorFragmentOp2ATI, glColorFragmentOp2ATI, NULL, 862),
+    NAME_FUNC_OFFSET(15134, glColorFragmentOp3ATI, glColorFragmentOp3ATI, NULL, 863),
+    NAME_FUNC_OFFSET(15156, glDeleteFragmentShaderATI, glDeleteFragmentShaderATI, NULL, 864),
+    NAME_FUNC_OFFSET(15182, glEndFragmentShaderATI, glEndFragmentShaderATI, NULL, 865),
+    NAME_FUNC_OFFSET(15205, glGenFragmentShadersATI, glGenFragmentShadersATI, NULL, 866),
+    NAME_FUNC_OFFSET(15229, glPassTexCoordATI, glPassTexCoordATI, NULL, 867),
+    NAME_FUNC_OFFSET(15247, glSampleMapATI, glSampleMapATI, NULL, 868),
+    NAME_FUNC_OFFSET(15262, glSetFragmentShaderConstantATI, glSetFragmentShaderConstantATI, NULL, 869),
+    NAME_FUNC_OFFSET(15293, glPointParameteriNV, glPointParameteriNV, NULL, 870),
+    NAME_FUNC_OFFSET(15313, glPointParameterivNV, glPointParameterivNV, NULL, 871),
+    NAME_FUNC_OFFSET(15334, gl_dispatch_stub_872, gl_dispatch_stub_872, NULL, 872),
+    NAME_FUNC_OFFSET(15357, gl_dispatch_stub_873, gl_dispatch_stub_873, NULL, 873),
+    NAME_FUNC_OFFSET(15380, gl_dispatch_stub_874, gl_dispatch_stub_874, NULL, 874),
+    NAME_FUNC_OFFSET(15406, gl_dispatch_stub_875, gl_dispatch_stub_875, NULL, 875),
+    NAME_FUNC_OFFSET(15429, gl_dispatch_stub_876, gl_dispatch_stub_876, NULL, 876),
+    NAME_FUNC_OFFSET(15450, glGetProgramNamedParameterdvNV, glGetProgramNamedParameterdvNV, NULL, 877),
+    NAME_FUNC_OFFSET(15481, glGetProgramNamedParameterfvNV, glGetProgramNamedParameterfvNV, NULL, 878),
+    NAME_FUNC_OFFSET(15512, glProgramNamedParameter4dNV, glProgramNamedParameter4dNV, NULL, 879),
+    NAME_FUNC_OFFSET(15540, glProgramNamedParameter4dvNV, glProgramNamedParameter4dvNV, NULL, 880),
+    NAME_FUNC_OFFSET(15569, glProgramNamedParameter4fNV, glProgramNamedParameter4fNV, NULL, 881),
+    NAME_FUNC_OFFSET(15597, glProgramNamedParameter4fvNV, glProgramNamedParameter4fvNV, NULL, 882),
+    NAME_FUNC_OFFSET(15626, glPrimitiveRestartIndexNV, glPrimitiveRestartIndexNV, NULL, 883),
+    NAME_FUNC_OFFSET(15652, glPrimitiveRestartNV, glPrimitiveRestartNV, NULL, 884),
+    NAME_FUNC_OFFSET(15673, gl_dispatch_stub_885, gl_dispatch_stub_885, NULL, 885),
+    NAME_FUNC_OFFSET(15690, gl_dispatch_stub_886, gl_dispatch_stub_886, NULL, 886),
+    NAME_FUNC_OFFSET(15717, glBindFramebufferEXT, glBindFramebufferEXT, NULL, 887),
+    NAME_FUNC_OFFSET(15738, glBindRenderbufferEXT, glBindRenderbufferEXT, NULL, 888),
+    NAME_FUNC_OFFSET(15760, glCheckFramebufferStatusEXT, glCheckFramebufferStatusEXT, NULL, 889),
+    NAME_FUNC_OFFSET(15788, glDeleteFramebuffersEXT, glDeleteFramebuffersEXT, NULL, 890),
+    NAME_FUNC_OFFSET(15812, glDeleteRenderbuffersEXT, glDeleteRenderbuffersEXT, NULL, 891),
+    NAME_FUNC_OFFSET(15837, glFramebufferRenderbufferEXT, glFramebufferRenderbufferEXT, NULL, 892),
+    NAME_FUNC_OFFSET(15866, glFramebufferTexture1DEXT, glFramebufferTexture1DEXT, NULL, 893),
+    NAME_FUNC_OFFSET(15892, glFramebufferTexture2DEXT, glFramebufferTexture2DEXT, NULL, 894),
+    NAME_FUNC_OFFSET(15918, glFramebufferTexture3DEXT, glFramebufferTexture3DEXT, NULL, 895),
+    NAME_FUNC_OFFSET(15944, glGenFramebuffersEXT, glGenFramebuffersEXT, NULL, 896),
+    NAME_FUNC_OFFSET(15965, glGenRenderbuffersEXT, glGenRenderbuffersEXT, NULL, 897),
+    NAME_FUNC_OFFSET(15987, glGenerateMipmapEXT, glGenerateMipmapEXT, NULL, 898),
+    NAME_FUNC_OFFSET(16007, glGetFramebufferAttachmentParameterivEXT, glGetFramebufferAttachmentParameterivEXT, NULL, 899),
+    NAME_FUNC_OFFSET(16048, glGetRenderbufferParameterivEXT, glGetRenderbufferParameterivEXT, NULL, 900),
+    NAME_FUNC_OFFSET(16080, glIsFramebufferEXT, glIsFramebufferEXT, NULL, 901),
+    NAME_FUNC_OFFSET(16099, glIsRenderbufferEXT, glIsRenderbufferEXT, NULL, 902),
+    NAME_FUNC_OFFSET(16119, glRenderbufferStorageEXT, glRenderbufferStorageEXT, NULL, 903),
+    NAME_FUNC_OFFSET(16144, gl_dispatch_stub_904, gl_dispatch_stub_904, NULL, 904),
+    NAME_FUNC_OFFSET(16165, gl_dispatch_stub_905, gl_dispatch_stub_905, NULL, 905),
+    NAME_FUNC_OFFSET(16189, gl_dispatch_stub_906, gl_dispatch_stub_906, NULL, 906),
+    NAME_FUNC_OFFSET(16219, glBindFragDataLocationEXT, glBindFragDataLocationEXT, NULL, 907),
+    NAME_FUNC_OFFSET(16245, glGetFragDataLocationEXT, glGetFragDataLocationEXT, NULL, 908),
+    NAME_FUNC_OFFSET(16270, glGetUniformuivEXT, glGetUniformuivEXT, NULL, 909),
+    NAME_FUNC_OFFSET(16289, glGetVertexAttribIivEXT, glGetVertexAttribIivEXT, NULL, 910),
+    NAME_FUNC_OFFSET(16313, glGetVertexAttribIuivEXT, glGetVertexAttribIuivEXT, NULL, 911),
+    NAME_FUNC_OFFSET(16338, glUniform1uiEXT, glUniform1uiEXT, NULL, 912),
+    NAME_FUNC_OFFSET(16354, glUniform1uivEXT, glUniform1uivEXT, NULL, 913),
+    NAME_FUNC_OFFSET(16371, glUniform2uiEXT, glUniform2uiEXT, NULL, 914),
+    NAME_FUNC_OFFSET(16387, glUniform2uivEXT, glUniform2uivEXT, NULL, 915),
+    NAME_FUNC_OFFSET(16404, glUniform3uiEXT, glUniform3uiEXT, NULL, 916),
+    NAME_FUNC_OFFSET(16420, glUniform3uivEXT, glUniform3uivEXT, NULL, 917),
+    NAME_FUNC_OFFSET(16437, glUniform4uiEXT, glUniform4uiEXT, NULL, 918),
+    NAME_FUNC_OFFSET(16453, glUniform4uivEXT, glUniform4uivEXT, NULL, 919),
+    NAME_FUNC_OFFSET(16470, glVertexAttribI1iEXT, glVertexAttribI1iEXT, NULL, 920),
+    NAME_FUNC_OFFSET(16491, glVertexAttribI1ivEXT, glVertexAttribI1ivEXT, NULL, 921),
+    NAME_FUNC_OFFSET(16513, glVertexAttribI1uiEXT, glVertexAttribI1uiEXT, NULL, 922),
+    NAME_FUNC_OFFSET(16535, glVertexAttribI1uivEXT, glVertexAttribI1uivEXT, NULL, 923),
+    NAME_FUNC_OFFSET(16558, glVertexAttribI2iEXT, glVertexAttribI2iEXT, NULL, 924),
+    NAME_FUNC_OFFSET(16579, glVertexAttribI2ivEXT, glVertexAttribI2ivEXT, NULL, 925),
+    NAME_FUNC_OFFSET(16601, glVertexAttribI2uiEXT, glVertexAttribI2uiEXT, NULL, 926),
+    NAME_FUNC_OFFSET(16623, glVertexAttribI2uivEXT, glVertexAttribI2uivEXT, NULL, 927),
+    NAME_FUNC_OFFSET(16646, glVertexAttribI3iEXT, glVertexAttribI3iEXT, NULL, 928),
+    NAME_FUNC_OFFSET(16667, glVertexAttribI3ivEXT, glVertexAttribI3ivEXT, NULL, 929),
+    NAME_FUNC_OFFSET(16689, glVertexAttribI3uiEXT, glVertexAttribI3uiEXT, NULL, 930),
+    NAME_FUNC_OFFSET(16711, glVertexAttribI3uivEXT, glVertexAttribI3uivEXT, NULL, 931),
+    NAME_FUNC_OFFSET(16734, glVertexAttribI4bvEXT, glVertexAttribI4bvEXT, NULL, 932),
+    NAME_FUNC_OFFSET(16756, glVertexAttribI4iEXT, glVertexAttribI4iEXT, NULL, 933),
+    NAME_FUNC_OFFSET(16777, glVertexAttribI4ivEXT, glVertexAttribI4ivEXT, NULL, 934),
+    NAME_FUNC_OFFSET(16799, glVertexAttribI4svEXT, glVertexAttribI4svEXT, NULL, 935),
+    NAME_FUNC_OFFSET(16821, glVertexAttribI4ubvEXT, glVertexAttribI4ubvEXT, NULL, 936),
+    NAME_FUNC_OFFSET(16844, glVertexAttribI4uiEXT, glVertexAttribI4uiEXT, NULL, 937),
+    NAME_FUNC_OFFSET(16866, glVertexAttribI4uivEXT, glVertexAttribI4uivEXT, NULL, 938),
+    NAME_FUNC_OFFSET(16889, glVertexAttribI4usvEXT, glVertexAttribI4usvEXT, NULL, 939),
+    NAME_FUNC_OFFSET(16912, glVertexAttribIPointerEXT, glVertexAttribIPointerEXT, NULL, 940),
+    NAME_FUNC_OFFSET(16938, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 941),
+    NAME_FUNC_OFFSET(16967, glColorMaskIndexedEXT, glColorMaskIndexedEXT, NULL, 942),
+    NAME_FUNC_OFFSET(16989, glDisableIndexedEXT, glDisableIndexedEXT, NULL, 943),
+    NAME_FUNC_OFFSET(17009, glEnableIndexedEXT, glEnableIndexedEXT, NULL, 944),
+    NAME_FUNC_OFFSET(17028, glGetBooleanIndexedvEXT, glGetBooleanIndexedvEXT, NULL, 945),
+    NAME_FUNC_OFFSET(17052, glGetIntegerIndexedvEXT, glGetIntegerIndexedvEXT, NULL, 946),
+    NAME_FUNC_OFFSET(17076, glIsEnabledIndexedEXT, glIsEnabledIndexedEXT, NULL, 947),
+    NAME_FUNC_OFFSET(17098, glClearColorIiEXT, glClearColorIiEXT, NULL, 948),
+    NAME_FUNC_OFFSET(17116, glClearColorIuiEXT, glClearColorIuiEXT, NULL, 949),
+    NAME_FUNC_OFFSET(17135, glGetTexParameterIivEXT, glGetTexParameterIivEXT, NULL, 950),
+    NAME_FUNC_OFFSET(17159, glGetTexParameterIuivEXT, glGetTexParameterIuivEXT, NULL, 951),
+    NAME_FUNC_OFFSET(17184, glTexParameterIivEXT, glTexParameterIivEXT, NULL, 952),
+    NAME_FUNC_OFFSET(17205, glTexParameterIuivEXT, glTexParameterIuivEXT, NULL, 953),
+    NAME_FUNC_OFFSET(17227, glBeginConditionalRenderNV, glBeginConditionalRenderNV, NULL, 954),
+    NAME_FUNC_OFFSET(17254, glEndConditionalRenderNV, glEndConditionalRenderNV, NULL, 955),
+    NAME_FUNC_OFFSET(17279, glBeginTransformFeedbackEXT, glBeginTransformFeedbackEXT, NULL, 956),
+    NAME_FUNC_OFFSET(17307, glBindBufferBaseEXT, glBindBufferBaseEXT, NULL, 957),
+    NAME_FUNC_OFFSET(17327, glBindBufferOffsetEXT, glBindBufferOffsetEXT, NULL, 958),
+    NAME_FUNC_OFFSET(17349, glBindBufferRangeEXT, glBindBufferRangeEXT, NULL, 959),
+    NAME_FUNC_OFFSET(17370, glEndTransformFeedbackEXT, glEndTransformFeedbackEXT, NULL, 960),
+    NAME_FUNC_OFFSET(17396, glGetTransformFeedbackVaryingEXT, glGetTransformFeedbackVaryingEXT, NULL, 961),
+    NAME_FUNC_OFFSET(17429, glTransformFeedbackVaryingsEXT, glTransformFeedbackVaryingsEXT, NULL, 962),
+    NAME_FUNC_OFFSET(17460, glProvokingVertexEXT, glProvokingVertexEXT, NULL, 963),
+    NAME_FUNC_OFFSET(17481, gl_dispatch_stub_964, gl_dispatch_stub_964, NULL, 964),
+    NAME_FUNC_OFFSET(17512, gl_dispatch_stub_965, gl_dispatch_stub_965, NULL, 965),
+    NAME_FUNC_OFFSET(17532, glGetObjectParameterivAPPLE, glGetObjectParameterivAPPLE, NULL, 966),
+    NAME_FUNC_OFFSET(17560, glObjectPurgeableAPPLE, glObjectPurgeableAPPLE, NULL, 967),
+    NAME_FUNC_OFFSET(17583, glObjectUnpurgeableAPPLE, glObjectUnpurgeableAPPLE, NULL, 968),
+    NAME_FUNC_OFFSET(17608, glActiveProgramEXT, glActiveProgramEXT, NULL, 969),
+    NAME_FUNC_OFFSET(17627, glCreateShaderProgramEXT, glCreateShaderProgramEXT, NULL, 970),
+    NAME_FUNC_OFFSET(17652, glUseShaderProgramEXT, glUseShaderProgramEXT, NULL, 971),
+    NAME_FUNC_OFFSET(17674, glTextureBarrierNV, glTextureBarrierNV, NULL, 972),
+    NAME_FUNC_OFFSET(17693, gl_dispatch_stub_973, gl_dispatch_stub_973, NULL, 973),
+    NAME_FUNC_OFFSET(17718, gl_dispatch_stub_974, gl_dispatch_stub_974, NULL, 974),
+    NAME_FUNC_OFFSET(17747, gl_dispatch_stub_975, gl_dispatch_stub_975, NULL, 975),
+    NAME_FUNC_OFFSET(17778, gl_dispatch_stub_976, gl_dispatch_stub_976, NULL, 976),
+    NAME_FUNC_OFFSET(17802, gl_dispatch_stub_977, gl_dispatch_stub_977, NULL, 977),
+    NAME_FUNC_OFFSET(17827, glEGLImageTargetRenderbufferStorageOES, glEGLImageTargetRenderbufferStorageOES, NULL, 978),
+    NAME_FUNC_OFFSET(17866, glEGLImageTargetTexture2DOES, glEGLImageTargetTexture2DOES, NULL, 979),
+    NAME_FUNC_OFFSET(17895, glArrayElement, glArrayElement, NULL, 306),
+    NAME_FUNC_OFFSET(17913, glBindTexture, glBindTexture, NULL, 307),
+    NAME_FUNC_OFFSET(17930, glDrawArrays, glDrawArrays, NULL, 310),
+    NAME_FUNC_OFFSET(17946, glAreTexturesResident, glAreTexturesResidentEXT, glAreTexturesResidentEXT, 322),
+    NAME_FUNC_OFFSET(17971, glCopyTexImage1D, glCopyTexImage1D, NULL, 323),
+    NAME_FUNC_OFFSET(17991, glCopyTexImage2D, glCopyTexImage2D, NULL, 324),
+    NAME_FUNC_OFFSET(18011, glCopyTexSubImage1D, glCopyTexSubImage1D, NULL, 325),
+    NAME_FUNC_OFFSET(18034, glCopyTexSubImage2D, glCopyTexSubImage2D, NULL, 326),
+    NAME_FUNC_OFFSET(18057, glDeleteTextures, glDeleteTexturesEXT, glDeleteTexturesEXT, 327),
+    NAME_FUNC_OFFSET(18077, glGenTextures, glGenTexturesEXT, glGenTexturesEXT, 328),
+    NAME_FUNC_OFFSET(18094, glGetPointerv, glGetPointerv, NULL, 329),
+    NAME_FUNC_OFFSET(18111, glIsTexture, glIsTextureEXT, glIsTextureEXT, 330),
+    NAME_FUNC_OFFSET(18126, glPrioritizeTextures, glPrioritizeTextures, NULL, 331),
+    NAME_FUNC_OFFSET(18150, glTexSubImage1D, glTexSubImage1D, NULL, 332),
+    NAME_FUNC_OFFSET(18169, glTexSubImage2D, glTexSubImage2D, NULL, 333),
+    NAME_FUNC_OFFSET(18188, glBlendColor, glBlendColor, NULL, 336),
+    NAME_FUNC_OFFSET(18204, glBlendEquation, glBlendEquation, NULL, 337),
+    NAME_FUNC_OFFSET(18223, glDrawRangeElements, glDrawRangeElements, NULL, 338),
+    NAME_FUNC_OFFSET(18246, glColorTable, glColorTable, NULL, 339),
+    NAME_FUNC_OFFSET(18262, glColorTable, glColorTable, NULL, 339),
+    NAME_FUNC_OFFSET(18278, glColorTableParameterfv, glColorTableParameterfv, NULL, 340),
+    NAME_FUNC_OFFSET(18305, glColorTableParameteriv, glColorTableParameteriv, NULL, 341),
+    NAME_FUNC_OFFSET(18332, glCopyColorTable, glCopyColorTable, NULL, 342),
+    NAME_FUNC_OFFSET(18352, glGetColorTable, glGetColorTableEXT, glGetColorTableEXT, 343),
+    NAME_FUNC_OFFSET(18371, glGetColorTable, glGetColorTableEXT, glGetColorTableEXT, 343),
+    NAME_FUNC_OFFSET(18390, glGetColorTableParameterfv, glGetColorTableParameterfvEXT, glGetColorTableParameterfvEXT, 344),
+    NAME_FUNC_OFFSET(18420, glGetColorTableParameterfv, glGetColorTableParameterfvEXT, glGetColorTableParameterfvEXT, 344),
+    NAME_FUNC_OFFSET(18450, glGetColorTableParameteriv, glGetColorTableParameterivEXT, glGetColorTableParameterivEXT, 345),
+    NAME_FUNC_OFFSET(18480, glGetColorTableParameteriv, glGetColorTableParameterivEXT, glGetColorTableParameterivEXT, 345),
+    NAME_FUNC_OFFSET(18510, glColorSubTable, glColorSubTable, NULL, 346),
+    NAME_FUNC_OFFSET(18529, glCopyColorSubTable, glCopyColorSubTable, NULL, 347),
+    NAME_FUNC_OFFSET(18552, glConvolutionFilter1D, glConvolutionFilter1D, NULL, 348),
+    NAME_FUNC_OFFSET(18577, glConvolutionFilter2D, glConvolutionFilter2D, NULL, 349),
+    NAME_FUNC_OFFSET(18602, glConvolutionParameterf, glConvolutionParameterf, NULL, 350),
+    NAME_FUNC_OFFSET(18629, glConvolutionParameterfv, glConvolutionParameterfv, NULL, 351),
+    NAME_FUNC_OFFSET(18657, glConvolutionParameteri, glConvolutionParameteri, NULL, 352),
+    NAME_FUNC_OFFSET(18684, glConvolutionParameteriv, glConvolutionParameteriv, NULL, 353),
+    NAME_FUNC_OFFSET(18712, glCopyConvolutionFilter1D, glCopyConvolutionFilter1D, NULL, 354),
+    NAME_FUNC_OFFSET(18741, glCopyConvolutionFilter2D, glCopyConvolutionFilter2D, NULL, 355),
+    NAME_FUNC_OFFSET(18770, glGetConvolutionFilter, gl_dispatch_stub_356, gl_dispatch_stub_356, 356),
+    NAME_FUNC_OFFSET(18796, glGetConvolutionParameterfv, gl_dispatch_stub_357, gl_dispatch_stub_357, 357),
+    NAME_FUNC_OFFSET(18827, glGetConvolutionParameteriv, gl_dispatch_stub_358, gl_dispatch_stub_358, 358),
+    NAME_FUNC_OFFSET(18858, glGetSeparableFilter, gl_dispatch_stub_359, gl_dispatch_stub_359, 359),
+    NAME_FUNC_OFFSET(18882, glSeparableFilter2D, glSeparableFilter2D, NULL, 360),
+    NAME_FUNC_OFFSET(18905, glGetHistogram, gl_dispatch_stub_361, gl_dispatch_stub_361, 361),
+    NAME_FUNC_OFFSET(18923, glGetHistogramParameterfv, gl_dispatch_stub_362, gl_dispatch_stub_362, 362),
+    NAME_FUNC_OFFSET(18952, glGetHistogramParameteriv, gl_dispatch_stub_363, gl_dispatch_stub_363, 363),
+    NAME_FUNC_OFFSET(18981, glGetMinmax, gl_dispatch_stub_364, gl_dispatch_stub_364, 364),
+    NAME_FUNC_OFFSET(18996, glGetMinmaxParameterfv, gl_dispatch_stub_365, gl_dispatch_stub_365, 365),
+    NAME_FUNC_OFFSET(19022, glGetMinmaxParameteriv, gl_dispatch_stub_366, gl_dispatch_stub_366, 366),
+    NAME_FUNC_OFFSET(19048, glHistogram, glHistogram, NULL, 367),
+    NAME_FUNC_OFFSET(19063, glMinmax, glMinmax, NULL, 368),
+    NAME_FUNC_OFFSET(19075, glResetHistogram, glResetHistogram, NULL, 369),
+    NAME_FUNC_OFFSET(19095, glResetMinmax, glResetMinmax, NULL, 370),
+    NAME_FUNC_OFFSET(19112, glTexImage3D, glTexImage3D, NULL, 371),
+    NAME_FUNC_OFFSET(19128, glTexSubImage3D, glTexSubImage3D, NULL, 372),
+    NAME_FUNC_OFFSET(19147, glCopyTexSubImage3D, glCopyTexSubImage3D, NULL, 373),
+    NAME_FUNC_OFFSET(19170, glActiveTextureARB, glActiveTextureARB, NULL, 374),
+    NAME_FUNC_OFFSET(19186, glClientActiveTextureARB, glClientActiveTextureARB, NULL, 375),
+    NAME_FUNC_OFFSET(19208, glMultiTexCoord1dARB, glMultiTexCoord1dARB, NULL, 376),
+    NAME_FUNC_OFFSET(19226, glMultiTexCoord1dvARB, glMultiTexCoord1dvARB, NULL, 377),
+    NAME_FUNC_OFFSET(19245, glMultiTexCoord1fARB, glMultiTexCoord1fARB, NULL, 378),
+    NAME_FUNC_OFFSET(19263, glMultiTexCoord1fvARB, glMultiTexCoord1fvARB, NULL, 379),
+    NAME_FUNC_OFFSET(19282, glMultiTexCoord1iARB, glMultiTexCoord1iARB, NULL, 380),
+    NAME_FUNC_OFFSET(19300, glMultiTexCoord1ivARB, glMultiTexCoord1ivARB, NULL, 381),
+    NAME_FUNC_OFFSET(19319, glMultiTexCoord1sARB, glMultiTexCoord1sARB, NULL, 382),
+    NAME_FUNC_OFFSET(19337, glMultiTexCoord1svARB, glMultiTexCoord1svARB, NULL, 383),
+    NAME_FUNC_OFFSET(19356, glMultiTexCoord2dARB, glMultiTexCoord2dARB, NULL, 384),
+    NAME_FUNC_OFFSET(19374, glMultiTexCoord2dvARB, glMultiTexCoord2dvARB, NULL, 385),
+    NAME_FUNC_OFFSET(19393, glMultiTexCoord2fARB, glMultiTexCoord2fARB, NULL, 386),
+    NAME_FUNC_OFFSET(19411, glMultiTexCoord2fvARB, glMultiTexCoord2fvARB, NULL, 387),
+    NAME_FUNC_OFFSET(19430, glMultiTexCoord2iARB, glMultiTexCoord2iARB, NULL, 388),
+    NAME_FUNC_OFFSET(19448, glMultiTexCoord2ivARB, glMultiTexCoord2ivARB, NULL, 389),
+    NAME_FUNC_OFFSET(19467, glMultiTexCoord2sARB, glMultiTexCoord2sARB, NULL, 390),
+    NAME_FUNC_OFFSET(19485, glMultiTexCoord2svARB, glMultiTexCoord2svARB, NULL, 391),
+    NAME_FUNC_OFFSET(19504, glMultiTexCoord3dARB, glMultiTexCoord3dARB, NULL, 392),
+    NAME_FUNC_OFFSET(19522, glMultiTexCoord3dvARB, glMultiTexCoord3dvARB, NULL, 393),
+    NAME_FUNC_OFFSET(19541, glMultiTexCoord3fARB, glMultiTexCoord3fARB, NULL, 394),
+    NAME_FUNC_OFFSET(19559, glMultiTexCoord3fvARB, glMultiTexCoord3fvARB, NULL, 395),
+    NAME_FUNC_OFFSET(19578, glMultiTexCoord3iARB, glMultiTexCoord3iARB, NULL, 396),
+    NAME_FUNC_OFFSET(19596, glMultiTexCoord3ivARB, glMultiTexCoord3ivARB, NULL, 397),
+    NAME_FUNC_OFFSET(19615, glMultiTexCoord3sARB, glMultiTexCoord3sARB, NULL, 398),
+    NAME_FUNC_OFFSET(19633, glMultiTexCoord3svARB, glMultiTexCoord3svARB, NULL, 399),
+    NAME_FUNC_OFFSET(19652, glMultiTexCoord4dARB, glMultiTexCoord4dARB, NULL, 400),
+    NAME_FUNC_OFFSET(19670, glMultiTexCoord4dvARB, glMultiTexCoord4dvARB, NULL, 401),
+    NAME_FUNC_OFFSET(19689, glMultiTexCoord4fARB, glMultiTexCoord4fARB, NULL, 402),
+    NAME_FUNC_OFFSET(19707, glMultiTexCoord4fvARB, glMultiTexCoord4fvARB, NULL, 403),
+    NAME_FUNC_OFFSET(19726, glMultiTexCoord4iARB, glMultiTexCoord4iARB, NULL, 404),
+    NAME_FUNC_OFFSET(19744, glMultiTexCoord4ivARB, glMultiTexCoord4ivARB, NULL, 405),
+    NAME_FUNC_OFFSET(19763, glMultiTexCoord4sARB, glMultiTexCoord4sARB, NULL, 406),
+    NAME_FUNC_OFFSET(19781, glMultiTexCoord4svARB, glMultiTexCoord4svARB, NULL, 407),
+    NAME_FUNC_OFFSET(19800, glStencilOpSeparate, glStencilOpSeparate, NULL, 423),
+    NAME_FUNC_OFFSET(19823, glLoadTransposeMatrixdARB, glLoadTransposeMatrixdARB, NULL, 440),
+    NAME_FUNC_OFFSET(19846, glLoadTransposeMatrixfARB, glLoadTransposeMatrixfARB, NULL, 441),
+    NAME_FUNC_OFFSET(19869, glMultTransposeMatrixdARB, glMultTransposeMatrixdARB, NULL, 442),
+    NAME_FUNC_OFFSET(19892, glMultTransposeMatrixfARB, glMultTransposeMatrixfARB, NULL, 443),
+    NAME_FUNC_OFFSET(19915, glSampleCoverageARB, glSampleCoverageARB, NULL, 444),
+    NAME_FUNC_OFFSET(19932, glCompressedTexImage1DARB, glCompressedTexImage1DARB, NULL, 445),
+    NAME_FUNC_OFFSET(19955, glCompressedTexImage2DARB, glCompressedTexImage2DARB, NULL, 446),
+    NAME_FUNC_OFFSET(19978, glCompressedTexImage3DARB, glCompressedTexImage3DARB, NULL, 447),
+    NAME_FUNC_OFFSET(20001, glCompressedTexSubImage1DARB, glCompressedTexSubImage1DARB, NULL, 448),
+    NAME_FUNC_OFFSET(20027, glCompressedTexSubImage2DARB, glCompressedTexSubImage2DARB, NULL, 449),
+    NAME_FUNC_OFFSET(20053, glCompressedTexSubImage3DARB, glCompressedTexSubImage3DARB, NULL, 450),
+    NAME_FUNC_OFFSET(20079, glGetCompressedTexImageARB, glGetCompressedTexImageARB, NULL, 451),
+    NAME_FUNC_OFFSET(20103, glDisableVertexAttribArrayARB, glDisableVertexAttribArrayARB, NULL, 452),
+    NAME_FUNC_OFFSET(20130, glEnableVertexAttribArrayARB, glEnableVertexAttribArrayARB, NULL, 453),
+    NAME_FUNC_OFFSET(20156, glGetVertexAttribdvARB, glGetVertexAttribdvARB, NULL, 460),
+    NAME_FUNC_OFFSET(20176, glGetVertexAttribfvARB, glGetVertexAttribfvARB, NULL, 461),
+    NAME_FUNC_OFFSET(20196, glGetVertexAttribivARB, glGetVertexAttribivARB, NULL, 462),
+    NAME_FUNC_OFFSET(20216, glProgramEnvParameter4dARB, glProgramEnvParameter4dARB, NULL, 463),
+    NAME_FUNC_OFFSET(20239, glProgramEnvParameter4dvARB, glProgramEnvParameter4dvARB, NULL, 464),
+    NAME_FUNC_OFFSET(20263, glProgramEnvParameter4fARB, glProgramEnvParameter4fARB, NULL, 465),
+    NAME_FUNC_OFFSET(20286, glProgramEnvParameter4fvARB, glProgramEnvParameter4fvARB, NULL, 466),
+    NAME_FUNC_OFFSET(20310, glVertexAttrib1dARB, glVertexAttrib1dARB, NULL, 472),
+    NAME_FUNC_OFFSET(20327, glVertexAttrib1dvARB, glVertexAttrib1dvARB, NULL, 473),
+    NAME_FUNC_OFFSET(20345, glVertexAttrib1fARB, glVertexAttrib1fARB, NULL, 474),
+    NAME_FUNC_OFFSET(20362, glVertexAttrib1fvARB, glVertexAttrib1fvARB, NULL, 475),
+    NAME_FUNC_OFFSET(20380, glVertexAttrib1sARB, glVertexAttrib1sARB, NULL, 476),
+    NAME_FUNC_OFFSET(20397, glVertexAttrib1svARB, glVertexAttrib1svARB, NULL, 477),
+    NAME_FUNC_OFFSET(20415, glVertexAttrib2dARB, glVertexAttrib2dARB, NULL, 478),
+    NAME_FUNC_OFFSET(20432, glVertexAttrib2dvARB, glVertexAttrib2dvARB, NULL, 479),
+    NAME_FUNC_OFFSET(20450, glVertexAttrib2fARB, glVertexAttrib2fARB, NULL, 480),
+    NAME_FUNC_OFFSET(20467, glVertexAttrib2fvARB, glVertexAttrib2fvARB, NULL, 481),
+    NAME_FUNC_OFFSET(20485, glVertexAttrib2sARB, glVertexAttrib2sARB, NULL, 482),
+    NAME_FUNC_OFFSET(20502, glVertexAttrib2svARB, glVertexAttrib2svARB, NULL, 483),
+    NAME_FUNC_OFFSET(20520, glVertexAttrib3dARB, glVertexAttrib3dARB, NULL, 484),
+    NAME_FUNC_OFFSET(20537, glVertexAttrib3dvARB, glVertexAttrib3dvARB, NULL, 485),
+    NAME_FUNC_OFFSET(20555, glVertexAttrib3fARB, glVertexAttrib3fARB, NULL, 486),
+    NAME_FUNC_OFFSET(20572, glVertexAttrib3fvARB, glVertexAttrib3fvARB, NULL, 487),
+    NAME_FUNC_OFFSET(20590, glVertexAttrib3sARB, glVertexAttrib3sARB, NULL, 488),
+    NAME_FUNC_OFFSET(20607, glVertexAttrib3svARB, glVertexAttrib3svARB, NULL, 489),
+    NAME_FUNC_OFFSET(20625, glVertexAttrib4NbvARB, glVertexAttrib4NbvARB, NULL, 490),
+    NAME_FUNC_OFFSET(20644, glVertexAttrib4NivARB, glVertexAttrib4NivARB, NULL, 491),
+    NAME_FUNC_OFFSET(20663, glVertexAttrib4NsvARB, glVertexAttrib4NsvARB, NULL, 492),
+    NAME_FUNC_OFFSET(20682, glVertexAttrib4NubARB, glVertexAttrib4NubARB, NULL, 493),
+    NAME_FUNC_OFFSET(20701, glVertexAttrib4NubvARB, glVertexAttrib4NubvARB, NULL, 494),
+    NAME_FUNC_OFFSET(20721, glVertexAttrib4NuivARB, glVertexAttrib4NuivARB, NULL, 495),
+    NAME_FUNC_OFFSET(20741, glVertexAttrib4NusvARB, glVertexAttrib4NusvARB, NULL, 496),
+    NAME_FUNC_OFFSET(20761, glVertexAttrib4bvARB, glVertexAttrib4bvARB, NULL, 497),
+    NAME_FUNC_OFFSET(20779, glVertexAttrib4dARB, glVertexAttrib4dARB, NULL, 498),
+    NAME_FUNC_OFFSET(20796, glVertexAttrib4dvARB, glVertexAttrib4dvARB, NULL, 499),
+    NAME_FUNC_OFFSET(20814, glVertexAttrib4fARB, glVertexAttrib4fARB, NULL, 500),
+    NAME_FUNC_OFFSET(20831, glVertexAttrib4fvARB, glVertexAttrib4fvARB, NULL, 501),
+    NAME_FUNC_OFFSET(20849, glVertexAttrib4ivARB, glVertexAttrib4ivARB, NULL, 502),
+    NAME_FUNC_OFFSET(20867, glVertexAttrib4sARB, glVertexAttrib4sARB, NULL, 503),
+    NAME_FUNC_OFFSET(20884, glVertexAttrib4svARB, glVertexAttrib4svARB, NULL, 504),
+    NAME_FUNC_OFFSET(20902, glVertexAttrib4ubvARB, glVertexAttrib4ubvARB, NULL, 505),
+    NAME_FUNC_OFFSET(20921, glVertexAttrib4uivARB, glVertexAttrib4uivARB, NULL, 506),
+    NAME_FUNC_OFFSET(20940, glVertexAttrib4usvARB, glVertexAttrib4usvARB, NULL, 507),
+    NAME_FUNC_OFFSET(20959, glVertexAttribPointerARB, glVertexAttribPointerARB, NULL, 508),
+    NAME_FUNC_OFFSET(20981, glBindBufferARB, glBindBufferARB, NULL, 509),
+    NAME_FUNC_OFFSET(20994, glBufferDataARB, glBufferDataARB, NULL, 510),
+    NAME_FUNC_OFFSET(21007, glBufferSubDataARB, glBufferSubDataARB, NULL, 511),
+    NAME_FUNC_OFFSET(21023, glDeleteBuffersARB, glDeleteBuffersARB, NULL, 512),
+    NAME_FUNC_OFFSET(21039, glGenBuffersARB, glGenBuffersARB, NULL, 513),
+    NAME_FUNC_OFFSET(21052, glGetBufferParameterivARB, glGetBufferParameterivARB, NULL, 514),
+    NAME_FUNC_OFFSET(21075, glGetBufferPointervARB, glGetBufferPointervARB, NULL, 515),
+    NAME_FUNC_OFFSET(21095, glGetBufferSubDataARB, glGetBufferSubDataARB, NULL, 516),
+    NAME_FUNC_OFFSET(21114, glIsBufferARB, glIsBufferARB, NULL, 517),
+    NAME_FUNC_OFFSET(21125, glMapBufferARB, glMapBufferARB, NULL, 518),
+    NAME_FUNC_OFFSET(21137, glUnmapBufferARB, glUnmapBufferARB, NULL, 519),
+    NAME_FUNC_OFFSET(21151, glBeginQueryARB, glBeginQueryARB, NULL, 520),
+    NAME_FUNC_OFFSET(21164, glDeleteQueriesARB, glDeleteQueriesARB, NULL, 521),
+    NAME_FUNC_OFFSET(21180, glEndQueryARB, glEndQueryARB, NULL, 522),
+    NAME_FUNC_OFFSET(21191, glGenQueriesARB, glGenQueriesARB, NULL, 523),
+    NAME_FUNC_OFFSET(21204, glGetQueryObjectivARB, glGetQueryObjectivARB, NULL, 524),
+    NAME_FUNC_OFFSET(21223, glGetQueryObjectuivARB, glGetQueryObjectuivARB, NULL, 525),
+    NAME_FUNC_OFFSET(21243, glGetQueryivARB, glGetQueryivARB, NULL, 526),
+    NAME_FUNC_OFFSET(21256, glIsQueryARB, glIsQueryARB, NULL, 527),
+    NAME_FUNC_OFFSET(21266, glCompileShaderARB, glCompileShaderARB, NULL, 529),
+    NAME_FUNC_OFFSET(21282, glGetActiveUniformARB, glGetActiveUniformARB, NULL, 534),
+    NAME_FUNC_OFFSET(21301, glGetShaderSourceARB, glGetShaderSourceARB, NULL, 540),
+    NAME_FUNC_OFFSET(21319, glGetUniformLocationARB, glGetUniformLocationARB, NULL, 541),
+    NAME_FUNC_OFFSET(21340, glGetUniformfvARB, glGetUniformfvARB, NULL, 542),
+    NAME_FUNC_OFFSET(21355, glGetUniformivARB, glGetUniformivARB, NULL, 543),
+    NAME_FUNC_OFFSET(21370, glLinkProgramARB, glLinkProgramARB, NULL, 544),
+    NAME_FUNC_OFFSET(21384, glShaderSourceARB, glShaderSourceARB, NULL, 545),
+    NAME_FUNC_OFFSET(21399, glUniform1fARB, glUniform1fARB, NULL, 546),
+    NAME_FUNC_OFFSET(21411, glUniform1fvARB, glUniform1fvARB, NULL, 547),
+    NAME_FUNC_OFFSET(21424, glUniform1iARB, glUniform1iARB, NULL, 548),
+    NAME_FUNC_OFFSET(21436, glUniform1ivARB, glUniform1ivARB, NULL, 549),
+    NAME_FUNC_OFFSET(21449, glUniform2fARB, glUniform2fARB, NULL, 550),
+    NAME_FUNC_OFFSET(21461, glUniform2fvARB, glUniform2fvARB, NULL, 551),
+    NAME_FUNC_OFFSET(21474, glUniform2iARB, glUniform2iARB, NULL, 552),
+    NAME_FUNC_OFFSET(21486, glUniform2ivARB, glUniform2ivARB, NULL, 553),
+    NAME_FUNC_OFFSET(21499, glUniform3fARB, glUniform3fARB, NULL, 554),
+    NAME_FUNC_OFFSET(21511, glUniform3fvARB, glUniform3fvARB, NULL, 555),
+    NAME_FUNC_OFFSET(21524, glUniform3iARB, glUniform3iARB, NULL, 556),
+    NAME_FUNC_OFFSET(21536, glUniform3ivARB, glUniform3ivARB, NULL, 557),
+    NAME_FUNC_OFFSET(21549, glUniform4fARB, glUniform4fARB, NULL, 558),
+    NAME_FUNC_OFFSET(21561, glUniform4fvARB, glUniform4fvARB, NULL, 559),
+    NAME_FUNC_OFFSET(21574, glUniform4iARB, glUniform4iARB, NULL, 560),
+    NAME_FUNC_OFFSET(21586, glUniform4ivARB, glUniform4ivARB, NULL, 561),
+    NAME_FUNC_OFFSET(21599, glUniformMatrix2fvARB, glUniformMatrix2fvARB, NULL, 562),
+    NAME_FUNC_OFFSET(21618, glUniformMatrix3fvARB, glUniformMatrix3fvARB, NULL, 563),
+    NAME_FUNC_OFFSET(21637, glUniformMatrix4fvARB, glUniformMatrix4fvARB, NULL, 564),
+    NAME_FUNC_OFFSET(21656, glUseProgramObjectARB, glUseProgramObjectARB, NULL, 565),
+    NAME_FUNC_OFFSET(21669, glValidateProgramARB, glValidateProgramARB, NULL, 566),
+    NAME_FUNC_OFFSET(21687, glBindAttribLocationARB, glBindAttribLocationARB, NULL, 567),
+    NAME_FUNC_OFFSET(21708, glGetActiveAttribARB, glGetActiveAttribARB, NULL, 568),
+    NAME_FUNC_OFFSET(21726, glGetAttribLocationARB, glGetAttribLocationARB, NULL, 569),
+    NAME_FUNC_OFFSET(21746, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
+    NAME_FUNC_OFFSET(21760, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
+    NAME_FUNC_OFFSET(21777, glDrawBuffersARB, glDrawBuffersARB, NULL, 570),
+    NAME_FUNC_OFFSET(21793, glDrawArraysInstancedARB, glDrawArraysInstancedARB, NULL, 572),
+    NAME_FUNC_OFFSET(21818, glDrawArraysInstancedARB, glDrawArraysInstancedARB, NULL, 572),
+    NAME_FUNC_OFFSET(21840, glDrawElementsInstancedARB, glDrawElementsInstancedARB, NULL, 573),
+    NAME_FUNC_OFFSET(21867, glDrawElementsInstancedARB, glDrawElementsInstancedARB, NULL, 573),
+    NAME_FUNC_OFFSET(21891, glRenderbufferStorageMultisample, glRenderbufferStorageMultisample, NULL, 574),
+    NAME_FUNC_OFFSET(21927, glProgramParameteriARB, glProgramParameteriARB, NULL, 577),
+    NAME_FUNC_OFFSET(21947, glTexBufferARB, glTexBufferARB, NULL, 581),
+    NAME_FUNC_OFFSET(21959, glBlendEquationSeparateiARB, glBlendEquationSeparateiARB, NULL, 596),
+    NAME_FUNC_OFFSET(21993, glBlendEquationiARB, glBlendEquationiARB, NULL, 597),
+    NAME_FUNC_OFFSET(22019, glBlendFuncSeparateiARB, glBlendFuncSeparateiARB, NULL, 598),
+    NAME_FUNC_OFFSET(22049, glBlendFunciARB, glBlendFunciARB, NULL, 599),
+    NAME_FUNC_OFFSET(22071, gl_dispatch_stub_705, gl_dispatch_stub_705, NULL, 705),
+    NAME_FUNC_OFFSET(22087, gl_dispatch_stub_706, gl_dispatch_stub_706, NULL, 706),
+    NAME_FUNC_OFFSET(22106, glPointParameterfEXT, glPointParameterfEXT, NULL, 713),
+    NAME_FUNC_OFFSET(22124, glPointParameterfEXT, glPointParameterfEXT, NULL, 713),
+    NAME_FUNC_OFFSET(22145, glPointParameterfEXT, glPointParameterfEXT, NULL, 713),
+    NAME_FUNC_OFFSET(22167, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 714),
+    NAME_FUNC_OFFSET(22186, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 714),
+    NAME_FUNC_OFFSET(22208, glPointParameterfvEXT, glPointParameterfvEXT, NULL, 714),
+    NAME_FUNC_OFFSET(22231, glSecondaryColor3bEXT, glSecondaryColor3bEXT, NULL, 717),
+    NAME_FUNC_OFFSET(22250, glSecondaryColor3bvEXT, glSecondaryColor3bvEXT, NULL, 718),
+    NAME_FUNC_OFFSET(22270, glSecondaryColor3dEXT, glSecondaryColor3dEXT, NULL, 719),
+    NAME_FUNC_OFFSET(22289, glSecondaryColor3dvEXT, glSecondaryColor3dvEXT, NULL, 720),
+    NAME_FUNC_OFFSET(22309, glSecondaryColor3fEXT, glSecondaryColor3fEXT, NULL, 721),
+    NAME_FUNC_OFFSET(22328, glSecondaryColor3fvEXT, glSecondaryColor3fvEXT, NULL, 722),
+    NAME_FUNC_OFFSET(22348, glSecondaryColor3iEXT, glSecondaryColor3iEXT, NULL, 723),
+    NAME_FUNC_OFFSET(22367, glSecondaryColor3ivEXT, glSecondaryColor3ivEXT, NULL, 724),
+    NAME_FUNC_OFFSET(22387, glSecondaryColor3sEXT, glSecondaryColor3sEXT, NULL, 725),
+    NAME_FUNC_OFFSET(22406, glSecondaryColor3svEXT, glSecondaryColor3svEXT, NULL, 726),
+    NAME_FUNC_OFFSET(22426, glSecondaryColor3ubEXT, glSecondaryColor3ubEXT, NULL, 727),
+    NAME_FUNC_OFFSET(22446, glSecondaryColor3ubvEXT, glSecondaryColor3ubvEXT, NULL, 728),
+    NAME_FUNC_OFFSET(22467, glSecondaryColor3uiEXT, glSecondaryColor3uiEXT, NULL, 729),
+    NAME_FUNC_OFFSET(22487, glSecondaryColor3uivEXT, glSecondaryColor3uivEXT, NULL, 730),
+    NAME_FUNC_OFFSET(22508, glSecondaryColor3usEXT, glSecondaryColor3usEXT, NULL, 731),
+    NAME_FUNC_OFFSET(22528, glSecondaryColor3usvEXT, glSecondaryColor3usvEXT, NULL, 732),
+    NAME_FUNC_OFFSET(22549, glSecondaryColorPointerEXT, glSecondaryColorPointerEXT, NULL, 733),
+    NAME_FUNC_OFFSET(22573, glMultiDrawArraysEXT, glMultiDrawArraysEXT, NULL, 734),
+    NAME_FUNC_OFFSET(22591, glMultiDrawElementsEXT, glMultiDrawElementsEXT, NULL, 735),
+    NAME_FUNC_OFFSET(22611, glFogCoordPointerEXT, glFogCoordPointerEXT, NULL, 736),
+    NAME_FUNC_OFFSET(22629, glFogCoorddEXT, glFogCoorddEXT, NULL, 737),
+    NAME_FUNC_OFFSET(22641, glFogCoorddvEXT, glFogCoorddvEXT, NULL, 738),
+    NAME_FUNC_OFFSET(22654, glFogCoordfEXT, glFogCoordfEXT, NULL, 739),
+    NAME_FUNC_OFFSET(22666, glFogCoordfvEXT, glFogCoordfvEXT, NULL, 740),
+    NAME_FUNC_OFFSET(22679, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 742),
+    NAME_FUNC_OFFSET(22699, glBlendFuncSeparateEXT, glBlendFuncSeparateEXT, NULL, 742),
+    NAME_FUNC_OFFSET(22723, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 759),
+    NAME_FUNC_OFFSET(22737, glWindowPos2dMESA, glWindowPos2dMESA, NULL, 759),
+    NAME_FUNC_OFFSET(22754, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 760),
+    NAME_FUNC_OFFSET(22769, glWindowPos2dvMESA, glWindowPos2dvMESA, NULL, 760),
+    NAME_FUNC_OFFSET(22787, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 761),
+    NAME_FUNC_OFFSET(22801, glWindowPos2fMESA, glWindowPos2fMESA, NULL, 761),
+    NAME_FUNC_OFFSET(22818, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 762),
+    NAME_FUNC_OFFSET(22833, glWindowPos2fvMESA, glWindowPos2fvMESA, NULL, 762),
+    NAME_FUNC_OFFSET(22851, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 763),
+    NAME_FUNC_OFFSET(22865, glWindowPos2iMESA, glWindowPos2iMESA, NULL, 763),
+    NAME_FUNC_OFFSET(22882, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 764),
+    NAME_FUNC_OFFSET(22897, glWindowPos2ivMESA, glWindowPos2ivMESA, NULL, 764),
+    NAME_FUNC_OFFSET(22915, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 765),
+    NAME_FUNC_OFFSET(22929, glWindowPos2sMESA, glWindowPos2sMESA, NULL, 765),
+    NAME_FUNC_OFFSET(22946, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 766),
+    NAME_FUNC_OFFSET(22961, glWindowPos2svMESA, glWindowPos2svMESA, NULL, 766),
+    NAME_FUNC_OFFSET(22979, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 767),
+    NAME_FUNC_OFFSET(22993, glWindowPos3dMESA, glWindowPos3dMESA, NULL, 767),
+    NAME_FUNC_OFFSET(23010, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 768),
+    NAME_FUNC_OFFSET(23025, glWindowPos3dvMESA, glWindowPos3dvMESA, NULL, 768),
+    NAME_FUNC_OFFSET(23043, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 769),
+    NAME_FUNC_OFFSET(23057, glWindowPos3fMESA, glWindowPos3fMESA, NULL, 769),
+    NAME_FUNC_OFFSET(23074, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 770),
+    NAME_FUNC_OFFSET(23089, glWindowPos3fvMESA, glWindowPos3fvMESA, NULL, 770),
+    NAME_FUNC_OFFSET(23107, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 771),
+    NAME_FUNC_OFFSET(23121, glWindowPos3iMESA, glWindowPos3iMESA, NULL, 771),
+    NAME_FUNC_OFFSET(23138, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 772),
+    NAME_FUNC_OFFSET(23153, glWindowPos3ivMESA, glWindowPos3ivMESA, NULL, 772),
+    NAME_FUNC_OFFSET(23171, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 773),
+    NAME_FUNC_OFFSET(23185, glWindowPos3sMESA, glWindowPos3sMESA, NULL, 773),
+    NAME_FUNC_OFFSET(23202, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 774),
+    NAME_FUNC_OFFSET(23217, glWindowPos3svMESA, glWindowPos3svMESA, NULL, 774),
+    NAME_FUNC_OFFSET(23235, glBindProgramNV, glBindProgramNV, NULL, 793),
+    NAME_FUNC_OFFSET(23252, glDeleteProgramsNV, glDeleteProgramsNV, NULL, 794),
+    NAME_FUNC_OFFSET(23272, glGenProgramsNV, glGenProgramsNV, NULL, 796),
+    NAME_FUNC_OFFSET(23289, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 802),
+    NAME_FUNC_OFFSET(23315, glGetVertexAttribPointervNV, glGetVertexAttribPointervNV, NULL, 802),
+    NAME_FUNC_OFFSET(23344, glIsProgramNV, glIsProgramNV, NULL, 806),
+    NAME_FUNC_OFFSET(23359, glPointParameteriNV, glPointParameteriNV, NULL, 870),
+    NAME_FUNC_OFFSET(23377, glPointParameterivNV, glPointParameterivNV, NULL, 871),
+    NAME_FUNC_OFFSET(23396, gl_dispatch_stub_874, gl_dispatch_stub_874, NULL, 874),
+    NAME_FUNC_OFFSET(23417, gl_dispatch_stub_876, gl_dispatch_stub_876, NULL, 876),
+    NAME_FUNC_OFFSET(23433, glPrimitiveRestartIndexNV, glPrimitiveRestartIndexNV, NULL, 883),
+    NAME_FUNC_OFFSET(23457, gl_dispatch_stub_886, gl_dispatch_stub_886, NULL, 886),
+    NAME_FUNC_OFFSET(23481, gl_dispatch_stub_886, gl_dispatch_stub_886, NULL, 886),
+    NAME_FUNC_OFFSET(23508, glBindFramebufferEXT, glBindFramebufferEXT, NULL, 887),
+    NAME_FUNC_OFFSET(23526, glBindRenderbufferEXT, glBindRenderbufferEXT, NULL, 888),
+    NAME_FUNC_OFFSET(23545, glCheckFramebufferStatusEXT, glCheckFramebufferStatusEXT, NULL, 889),
+    NAME_FUNC_OFFSET(23570, glDeleteFramebuffersEXT, glDeleteFramebuffersEXT, NULL, 890),
+    NAME_FUNC_OFFSET(23591, glDeleteRenderbuffersEXT, glDeleteRenderbuffersEXT, NULL, 891),
+    NAME_FUNC_OFFSET(23613, glFramebufferRenderbufferEXT, glFramebufferRenderbufferEXT, NULL, 892),
+    NAME_FUNC_OFFSET(23639, glFramebufferTexture1DEXT, glFramebufferTexture1DEXT, NULL, 893),
+    NAME_FUNC_OFFSET(23662, glFramebufferTexture2DEXT, glFramebufferTexture2DEXT, NULL, 894),
+    NAME_FUNC_OFFSET(23685, glFramebufferTexture3DEXT, glFramebufferTexture3DEXT, NULL, 895),
+    NAME_FUNC_OFFSET(23708, glGenFramebuffersEXT, glGenFramebuffersEXT, NULL, 896),
+    NAME_FUNC_OFFSET(23726, glGenRenderbuffersEXT, glGenRenderbuffersEXT, NULL, 897),
+    NAME_FUNC_OFFSET(23745, glGenerateMipmapEXT, glGenerateMipmapEXT, NULL, 898),
+    NAME_FUNC_OFFSET(23762, glGetFramebufferAttachmentParameterivEXT, glGetFramebufferAttachmentParameterivEXT, NULL, 899),
+    NAME_FUNC_OFFSET(23800, glGetRenderbufferParameterivEXT, glGetRenderbufferParameterivEXT, NULL, 900),
+    NAME_FUNC_OFFSET(23829, glIsFramebufferEXT, glIsFramebufferEXT, NULL, 901),
+    NAME_FUNC_OFFSET(23845, glIsRenderbufferEXT, glIsRenderbufferEXT, NULL, 902),
+    NAME_FUNC_OFFSET(23862, glRenderbufferStorageEXT, glRenderbufferStorageEXT, NULL, 903),
+    NAME_FUNC_OFFSET(23884, gl_dispatch_stub_904, gl_dispatch_stub_904, NULL, 904),
+    NAME_FUNC_OFFSET(23902, glBindFragDataLocationEXT, glBindFragDataLocationEXT, NULL, 907),
+    NAME_FUNC_OFFSET(23925, glGetFragDataLocationEXT, glGetFragDataLocationEXT, NULL, 908),
+    NAME_FUNC_OFFSET(23947, glGetUniformuivEXT, glGetUniformuivEXT, NULL, 909),
+    NAME_FUNC_OFFSET(23963, glGetVertexAttribIivEXT, glGetVertexAttribIivEXT, NULL, 910),
+    NAME_FUNC_OFFSET(23984, glGetVertexAttribIuivEXT, glGetVertexAttribIuivEXT, NULL, 911),
+    NAME_FUNC_OFFSET(24006, glUniform1uiEXT, glUniform1uiEXT, NULL, 912),
+    NAME_FUNC_OFFSET(24019, glUniform1uivEXT, glUniform1uivEXT, NULL, 913),
+    NAME_FUNC_OFFSET(24033, glUniform2uiEXT, glUniform2uiEXT, NULL, 914),
+    NAME_FUNC_OFFSET(24046, glUniform2uivEXT, glUniform2uivEXT, NULL, 915),
+    NAME_FUNC_OFFSET(24060, glUniform3uiEXT, glUniform3uiEXT, NULL, 916),
+    NAME_FUNC_OFFSET(24073, glUniform3uivEXT, glUniform3uivEXT, NULL, 917),
+    NAME_FUNC_OFFSET(24087, glUniform4uiEXT, glUniform4uiEXT, NULL, 918),
+    NAME_FUNC_OFFSET(24100, glUniform4uivEXT, glUniform4uivEXT, NULL, 919),
+    NAME_FUNC_OFFSET(24114, glVertexAttribI1iEXT, glVertexAttribI1iEXT, NULL, 920),
+    NAME_FUNC_OFFSET(24132, glVertexAttribI1ivEXT, glVertexAttribI1ivEXT, NULL, 921),
+    NAME_FUNC_OFFSET(24151, glVertexAttribI1uiEXT, glVertexAttribI1uiEXT, NULL, 922),
+    NAME_FUNC_OFFSET(24170, glVertexAttribI1uivEXT, glVertexAttribI1uivEXT, NULL, 923),
+    NAME_FUNC_OFFSET(24190, glVertexAttribI2iEXT, glVertexAttribI2iEXT, NULL, 924),
+    NAME_FUNC_OFFSET(24208, glVertexAttribI2ivEXT, glVertexAttribI2ivEXT, NULL, 925),
+    NAME_FUNC_OFFSET(24227, glVertexAttribI2uiEXT, glVertexAttribI2uiEXT, NULL, 926),
+    NAME_FUNC_OFFSET(24246, glVertexAttribI2uivEXT, glVertexAttribI2uivEXT, NULL, 927),
+    NAME_FUNC_OFFSET(24266, glVertexAttribI3iEXT, glVertexAttribI3iEXT, NULL, 928),
+    NAME_FUNC_OFFSET(24284, glVertexAttribI3ivEXT, glVertexAttribI3ivEXT, NULL, 929),
+    NAME_FUNC_OFFSET(24303, glVertexAttribI3uiEXT, glVertexAttribI3uiEXT, NULL, 930),
+    NAME_FUNC_OFFSET(24322, glVertexAttribI3uivEXT, glVertexAttribI3uivEXT, NULL, 931),
+    NAME_FUNC_OFFSET(24342, glVertexAttribI4bvEXT, glVertexAttribI4bvEXT, NULL, 932),
+    NAME_FUNC_OFFSET(24361, glVertexAttribI4iEXT, glVertexAttribI4iEXT, NULL, 933),
+    NAME_FUNC_OFFSET(24379, glVertexAttribI4ivEXT, glVertexAttribI4ivEXT, NULL, 934),
+    NAME_FUNC_OFFSET(24398, glVertexAttribI4svEXT, glVertexAttribI4svEXT, NULL, 935),
+    NAME_FUNC_OFFSET(24417, glVertexAttribI4ubvEXT, glVertexAttribI4ubvEXT, NULL, 936),
+    NAME_FUNC_OFFSET(24437, glVertexAttribI4uiEXT, glVertexAttribI4uiEXT, NULL, 937),
+    NAME_FUNC_OFFSET(24456, glVertexAttribI4uivEXT, glVertexAttribI4uivEXT, NULL, 938),
+    NAME_FUNC_OFFSET(24476, glVertexAttribI4usvEXT, glVertexAttribI4usvEXT, NULL, 939),
+    NAME_FUNC_OFFSET(24496, glVertexAttribIPointerEXT, glVertexAttribIPointerEXT, NULL, 940),
+    NAME_FUNC_OFFSET(24519, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 941),
+    NAME_FUNC_OFFSET(24545, glFramebufferTextureLayerEXT, glFramebufferTextureLayerEXT, NULL, 941),
+    NAME_FUNC_OFFSET(24574, glColorMaskIndexedEXT, glColorMaskIndexedEXT, NULL, 942),
+    NAME_FUNC_OFFSET(24587, glDisableIndexedEXT, glDisableIndexedEXT, NULL, 943),
+    NAME_FUNC_OFFSET(24598, glEnableIndexedEXT, glEnableIndexedEXT, NULL, 944),
+    NAME_FUNC_OFFSET(24608, glGetBooleanIndexedvEXT, glGetBooleanIndexedvEXT, NULL, 945),
+    NAME_FUNC_OFFSET(24624, glGetIntegerIndexedvEXT, glGetIntegerIndexedvEXT, NULL, 946),
+    NAME_FUNC_OFFSET(24640, glIsEnabledIndexedEXT, glIsEnabledIndexedEXT, NULL, 947),
+    NAME_FUNC_OFFSET(24653, glGetTexParameterIivEXT, glGetTexParameterIivEXT, NULL, 950),
+    NAME_FUNC_OFFSET(24674, glGetTexParameterIuivEXT, glGetTexParameterIuivEXT, NULL, 951),
+    NAME_FUNC_OFFSET(24696, glTexParameterIivEXT, glTexParameterIivEXT, NULL, 952),
+    NAME_FUNC_OFFSET(24714, glTexParameterIuivEXT, glTexParameterIuivEXT, NULL, 953),
+    NAME_FUNC_OFFSET(24733, glBeginConditionalRenderNV, glBeginConditionalRenderNV, NULL, 954),
+    NAME_FUNC_OFFSET(24758, glEndConditionalRenderNV, glEndConditionalRenderNV, NULL, 955),
+    NAME_FUNC_OFFSET(24781, glBeginTransformFeedbackEXT, glBeginTransformFeedbackEXT, NULL, 956),
+    NAME_FUNC_OFFSET(24806, glBindBufferBaseEXT, glBindBufferBaseEXT, NULL, 957),
+    NAME_FUNC_OFFSET(24823, glBindBufferRangeEXT, glBindBufferRangeEXT, NULL, 959),
+    NAME_FUNC_OFFSET(24841, glEndTransformFeedbackEXT, glEndTransformFeedbackEXT, NULL, 960),
+    NAME_FUNC_OFFSET(24864, glGetTransformFeedbackVaryingEXT, glGetTransformFeedbackVaryingEXT, NULL, 961),
+    NAME_FUNC_OFFSET(24894, glTransformFeedbackVaryingsEXT, glTransformFeedbackVaryingsEXT, NULL, 962),
+    NAME_FUNC_OFFSET(24922, glProvokingVertexEXT, glProvokingVertexEXT, NULL, 963),
     NAME_FUNC_OFFSET(-1, NULL, NULL, NULL, 0)
 };
 
@@ -317,6 +317,11 @@ brwCreateContext(int api,
    ctx->Const.NativeIntegers = true;
    ctx->Const.UniformBooleanTrue = 1;
 
+   /* Programs are recompiled from the IR when the state they depend on
+    * changes, so it has to stay around.
+    */
+   ctx->Const.CompactLinkedIR = false;
+
    ctx->Const.ForceGLSLExtensionsWarn = driQueryOptionb(&intel->optionCache, "force_glsl_extensions_warn");
 
    return true;
@@ -39,11 +39,12 @@
 
 #define BITSET_WORD GLuint
 #define BITSET_WORDBITS (sizeof (BITSET_WORD) * 8)
+#define BITSET_WORDS(size) (((size) + BITSET_WORDBITS - 1) / BITSET_WORDBITS)
 
 /* bitset declarations
  */
 #define BITSET_DECLARE(name, size) \
-   BITSET_WORD name[((size) + BITSET_WORDBITS - 1) / BITSET_WORDBITS]
+   BITSET_WORD name[BITSET_WORDS(size)]
 
 /* bitset operations
  */
@@ -42,6 +42,7 @@
 #include "mfeatures.h"
 #include "mtypes.h"
 #include "texobj.h"
+#include "vbo/vbo.h"
 
 
 /* Debug flags */
@@ -298,6 +299,8 @@ _mesa_reference_buffer_object_(struct gl_context *ctx,
 	 ASSERT(ctx->Array.ArrayObj->Vertex.BufferObj != bufObj);
 #endif
 
+         vbo_delete_minmax_cache(oldObj);
+
 	 ASSERT(ctx->Driver.DeleteBuffer);
          ctx->Driver.DeleteBuffer(ctx, oldObj);
       }
@@ -672,6 +675,11 @@ bind_buffer_object(struct gl_context *ctx, GLenum target, GLuint buffer)
    /* bind new buffer */
    _mesa_reference_buffer_object(ctx, bindTarget, newBufObj);
 
+   /* The GL writes to these behind the index bounds cache's back. */
+   if (target == GL_PIXEL_PACK_BUFFER_EXT ||
+       target == GL_TRANSFORM_FEEDBACK_BUFFER)
+      newBufObj->MinMaxCacheDisabled = GL_TRUE;
+
    /* Pass BindBuffer call to device driver */
    if (ctx->Driver.BindBuffer)
       ctx->Driver.BindBuffer( ctx, target, newBufObj );
@@ -966,6 +974,7 @@ _mesa_BufferDataARB(GLenum target, GLsizeiptrARB size,
    FLUSH_VERTICES(ctx, _NEW_BUFFER_OBJECT);
 
    bufObj->Written = GL_TRUE;
+   bufObj->MinMaxCacheDirty = GL_TRUE;
 
 #ifdef VBO_DEBUG
    printf("glBufferDataARB(%u, sz %ld, from %p, usage 0x%x)\n",
@@ -1002,6 +1011,7 @@ _mesa_BufferSubDataARB(GLenum target, GLintptrARB offset,
       return;
 
    bufObj->Written = GL_TRUE;
+   bufObj->MinMaxCacheDirty = GL_TRUE;
 
    ASSERT(ctx->Driver.BufferSubData);
    ctx->Driver.BufferSubData( ctx, offset, size, data, bufObj );
@@ -1085,8 +1095,10 @@ _mesa_MapBufferARB(GLenum target, GLenum access)
       bufObj->AccessFlags = accessFlags;
    }
 
-   if (access == GL_WRITE_ONLY_ARB || access == GL_READ_WRITE_ARB)
+   if (access == GL_WRITE_ONLY_ARB || access == GL_READ_WRITE_ARB) {
       bufObj->Written = GL_TRUE;
+      bufObj->MinMaxCacheDirty = GL_TRUE;
+   }
 
 #ifdef VBO_DEBUG
    printf("glMapBufferARB(%u, sz %ld, access 0x%x)\n",
@@ -1370,6 +1382,8 @@ _mesa_CopyBufferSubData(GLenum readTarget, GLenum writeTarget,
       }
    }
 
+   dst->MinMaxCacheDirty = GL_TRUE;
+
    ctx->Driver.CopyBufferSubData(ctx, src, dst, readOffset, writeOffset, size);
 }
 
@@ -1460,6 +1474,9 @@ _mesa_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length,
       return NULL;
    }
 
+   if (access & GL_MAP_WRITE_BIT)
+      bufObj->MinMaxCacheDirty = GL_TRUE;
+
    /* Mapping zero bytes should return a non-null pointer. */
    if (!length) {
       static long dummy = 0;
@@ -1574,6 +1591,7 @@ buffer_object_purgeable(struct gl_context *ctx, GLuint name, GLenum option)
    }
 
    bufObj->Purgeable = GL_TRUE;
+   bufObj->MinMaxCacheDirty = GL_TRUE;
 
    retval = GL_VOLATILE_APPLE;
    if (ctx->Driver.BufferObjectPurgeable)
@@ -662,6 +662,11 @@ _mesa_init_constants(struct gl_context *ctx)
 
    /* GL_ARB_robustness */
    ctx->Const.ResetStrategy = GL_NO_RESET_NOTIFICATION_ARB;
+
+   /* Drivers that keep generating code from the IR after linking must turn
+    * this off.
+    */
+   ctx->Const.CompactLinkedIR = GL_TRUE;
 }
 
 
@@ -189,6 +189,8 @@ static void add_debug_flags( const char *debug )
     */
    if (strstr(debug, "flush"))
       MESA_DEBUG_FLAGS |= DEBUG_ALWAYS_FLUSH;
+   if (strstr(debug, "minmax"))
+      MESA_DEBUG_FLAGS |= DEBUG_MINMAX_CACHE;
 
 #else
    (void) debug;
@@ -63,7 +63,7 @@
     } while(0)
 
 /* total number of offsets below */
-#define _gloffset_COUNT 978
+#define _gloffset_COUNT 980
 
 #define _gloffset_NewList 0
 #define _gloffset_EndList 1
@@ -734,322 +734,324 @@
 #define _gloffset_GetShaderPrecisionFormat 663
 #define _gloffset_ReleaseShaderCompiler 664
 #define _gloffset_ShaderBinary 665
-#define _gloffset_DebugMessageCallbackARB 666
-#define _gloffset_DebugMessageControlARB 667
-#define _gloffset_DebugMessageInsertARB 668
-#define _gloffset_GetDebugMessageLogARB 669
-#define _gloffset_GetGraphicsResetStatusARB 670
-#define _gloffset_GetnColorTableARB 671
-#define _gloffset_GetnCompressedTexImageARB 672
-#define _gloffset_GetnConvolutionFilterARB 673
-#define _gloffset_GetnHistogramARB 674
-#define _gloffset_GetnMapdvARB 675
-#define _gloffset_GetnMapfvARB 676
-#define _gloffset_GetnMapivARB 677
-#define _gloffset_GetnMinmaxARB 678
-#define _gloffset_GetnPixelMapfvARB 679
-#define _gloffset_GetnPixelMapuivARB 680
-#define _gloffset_GetnPixelMapusvARB 681
-#define _gloffset_GetnPolygonStippleARB 682
-#define _gloffset_GetnSeparableFilterARB 683
-#define _gloffset_GetnTexImageARB 684
-#define _gloffset_GetnUniformdvARB 685
-#define _gloffset_GetnUniformfvARB 686
-#define _gloffset_GetnUniformivARB 687
-#define _gloffset_GetnUniformuivARB 688
-#define _gloffset_ReadnPixelsARB 689
-#define _gloffset_TexStorage1D 690
-#define _gloffset_TexStorage2D 691
-#define _gloffset_TexStorage3D 692
-#define _gloffset_TextureStorage1DEXT 693
-#define _gloffset_TextureStorage2DEXT 694
-#define _gloffset_TextureStorage3DEXT 695
-#define _gloffset_PolygonOffsetEXT 696
-#define _gloffset_GetPixelTexGenParameterfvSGIS 697
-#define _gloffset_GetPixelTexGenParameterivSGIS 698
-#define _gloffset_PixelTexGenParameterfSGIS 699
-#define _gloffset_PixelTexGenParameterfvSGIS 700
-#define _gloffset_PixelTexGenParameteriSGIS 701
-#define _gloffset_PixelTexGenParameterivSGIS 702
-#define _gloffset_SampleMaskSGIS 703
-#define _gloffset_SamplePatternSGIS 704
-#define _gloffset_ColorPointerEXT 705
-#define _gloffset_EdgeFlagPointerEXT 706
-#define _gloffset_IndexPointerEXT 707
-#define _gloffset_NormalPointerEXT 708
-#define _gloffset_TexCoordPointerEXT 709
-#define _gloffset_VertexPointerEXT 710
-#define _gloffset_PointParameterfEXT 711
-#define _gloffset_PointParameterfvEXT 712
-#define _gloffset_LockArraysEXT 713
-#define _gloffset_UnlockArraysEXT 714
-#define _gloffset_SecondaryColor3bEXT 715
-#define _gloffset_SecondaryColor3bvEXT 716
-#define _gloffset_SecondaryColor3dEXT 717
-#define _gloffset_SecondaryColor3dvEXT 718
-#define _gloffset_SecondaryColor3fEXT 719
-#define _gloffset_SecondaryColor3fvEXT 720
-#define _gloffset_SecondaryColor3iEXT 721
-#define _gloffset_SecondaryColor3ivEXT 722
-#define _gloffset_SecondaryColor3sEXT 723
-#define _gloffset_SecondaryColor3svEXT 724
-#define _gloffset_SecondaryColor3ubEXT 725
-#define _gloffset_SecondaryColor3ubvEXT 726
-#define _gloffset_SecondaryColor3uiEXT 727
-#define _gloffset_SecondaryColor3uivEXT 728
-#define _gloffset_SecondaryColor3usEXT 729
-#define _gloffset_SecondaryColor3usvEXT 730
-#define _gloffset_SecondaryColorPointerEXT 731
-#define _gloffset_MultiDrawArraysEXT 732
-#define _gloffset_MultiDrawElementsEXT 733
-#define _gloffset_FogCoordPointerEXT 734
-#define _gloffset_FogCoorddEXT 735
-#define _gloffset_FogCoorddvEXT 736
-#define _gloffset_FogCoordfEXT 737
-#define _gloffset_FogCoordfvEXT 738
-#define _gloffset_PixelTexGenSGIX 739
-#define _gloffset_BlendFuncSeparateEXT 740
-#define _gloffset_FlushVertexArrayRangeNV 741
-#define _gloffset_VertexArrayRangeNV 742
-#define _gloffset_CombinerInputNV 743
-#define _gloffset_CombinerOutputNV 744
-#define _gloffset_CombinerParameterfNV 745
-#define _gloffset_CombinerParameterfvNV 746
-#define _gloffset_CombinerParameteriNV 747
-#define _gloffset_CombinerParameterivNV 748
-#define _gloffset_FinalCombinerInputNV 749
-#define _gloffset_GetCombinerInputParameterfvNV 750
-#define _gloffset_GetCombinerInputParameterivNV 751
-#define _gloffset_GetCombinerOutputParameterfvNV 752
-#define _gloffset_GetCombinerOutputParameterivNV 753
-#define _gloffset_GetFinalCombinerInputParameterfvNV 754
-#define _gloffset_GetFinalCombinerInputParameterivNV 755
-#define _gloffset_ResizeBuffersMESA 756
-#define _gloffset_WindowPos2dMESA 757
-#define _gloffset_WindowPos2dvMESA 758
-#define _gloffset_WindowPos2fMESA 759
-#define _gloffset_WindowPos2fvMESA 760
-#define _gloffset_WindowPos2iMESA 761
-#define _gloffset_WindowPos2ivMESA 762
-#define _gloffset_WindowPos2sMESA 763
-#define _gloffset_WindowPos2svMESA 764
-#define _gloffset_WindowPos3dMESA 765
-#define _gloffset_WindowPos3dvMESA 766
-#define _gloffset_WindowPos3fMESA 767
-#define _gloffset_WindowPos3fvMESA 768
-#define _gloffset_WindowPos3iMESA 769
-#define _gloffset_WindowPos3ivMESA 770
-#define _gloffset_WindowPos3sMESA 771
-#define _gloffset_WindowPos3svMESA 772
-#define _gloffset_WindowPos4dMESA 773
-#define _gloffset_WindowPos4dvMESA 774
-#define _gloffset_WindowPos4fMESA 775
-#define _gloffset_WindowPos4fvMESA 776
-#define _gloffset_WindowPos4iMESA 777
-#define _gloffset_WindowPos4ivMESA 778
-#define _gloffset_WindowPos4sMESA 779
-#define _gloffset_WindowPos4svMESA 780
-#define _gloffset_MultiModeDrawArraysIBM 781
-#define _gloffset_MultiModeDrawElementsIBM 782
-#define _gloffset_DeleteFencesNV 783
-#define _gloffset_FinishFenceNV 784
-#define _gloffset_GenFencesNV 785
-#define _gloffset_GetFenceivNV 786
-#define _gloffset_IsFenceNV 787
-#define _gloffset_SetFenceNV 788
-#define _gloffset_TestFenceNV 789
-#define _gloffset_AreProgramsResidentNV 790
-#define _gloffset_BindProgramNV 791
-#define _gloffset_DeleteProgramsNV 792
-#define _gloffset_ExecuteProgramNV 793
-#define _gloffset_GenProgramsNV 794
-#define _gloffset_GetProgramParameterdvNV 795
-#define _gloffset_GetProgramParameterfvNV 796
-#define _gloffset_GetProgramStringNV 797
-#define _gloffset_GetProgramivNV 798
-#define _gloffset_GetTrackMatrixivNV 799
-#define _gloffset_GetVertexAttribPointervNV 800
-#define _gloffset_GetVertexAttribdvNV 801
-#define _gloffset_GetVertexAttribfvNV 802
-#define _gloffset_GetVertexAttribivNV 803
-#define _gloffset_IsProgramNV 804
-#define _gloffset_LoadProgramNV 805
-#define _gloffset_ProgramParameters4dvNV 806
-#define _gloffset_ProgramParameters4fvNV 807
-#define _gloffset_RequestResidentProgramsNV 808
-#define _gloffset_TrackMatrixNV 809
-#define _gloffset_VertexAttrib1dNV 810
-#define _gloffset_VertexAttrib1dvNV 811
-#define _gloffset_VertexAttrib1fNV 812
-#define _gloffset_VertexAttrib1fvNV 813
-#define _gloffset_VertexAttrib1sNV 814
-#define _gloffset_VertexAttrib1svNV 815
-#define _gloffset_VertexAttrib2dNV 816
-#define _gloffset_VertexAttrib2dvNV 817
-#define _gloffset_VertexAttrib2fNV 818
-#define _gloffset_VertexAttrib2fvNV 819
-#define _gloffset_VertexAttrib2sNV 820
-#define _gloffset_VertexAttrib2svNV 821
-#define _gloffset_VertexAttrib3dNV 822
-#define _gloffset_VertexAttrib3dvNV 823
-#define _gloffset_VertexAttrib3fNV 824
-#define _gloffset_VertexAttrib3fvNV 825
-#define _gloffset_VertexAttrib3sNV 826
-#define _gloffset_VertexAttrib3svNV 827
-#define _gloffset_VertexAttrib4dNV 828
-#define _gloffset_VertexAttrib4dvNV 829
-#define _gloffset_VertexAttrib4fNV 830
-#define _gloffset_VertexAttrib4fvNV 831
-#define _gloffset_VertexAttrib4sNV 832
-#define _gloffset_VertexAttrib4svNV 833
-#define _gloffset_VertexAttrib4ubNV 834
-#define _gloffset_VertexAttrib4ubvNV 835
-#define _gloffset_VertexAttribPointerNV 836
-#define _gloffset_VertexAttribs1dvNV 837
-#define _gloffset_VertexAttribs1fvNV 838
-#define _gloffset_VertexAttribs1svNV 839
-#define _gloffset_VertexAttribs2dvNV 840
-#define _gloffset_VertexAttribs2fvNV 841
-#define _gloffset_VertexAttribs2svNV 842
-#define _gloffset_VertexAttribs3dvNV 843
-#define _gloffset_VertexAttribs3fvNV 844
-#define _gloffset_VertexAttribs3svNV 845
-#define _gloffset_VertexAttribs4dvNV 846
-#define _gloffset_VertexAttribs4fvNV 847
-#define _gloffset_VertexAttribs4svNV 848
-#define _gloffset_VertexAttribs4ubvNV 849
-#define _gloffset_GetTexBumpParameterfvATI 850
-#define _gloffset_GetTexBumpParameterivATI 851
-#define _gloffset_TexBumpParameterfvATI 852
-#define _gloffset_TexBumpParameterivATI 853
-#define _gloffset_AlphaFragmentOp1ATI 854
-#define _gloffset_AlphaFragmentOp2ATI 855
-#define _gloffset_AlphaFragmentOp3ATI 856
-#define _gloffset_BeginFragmentShaderATI 857
-#define _gloffset_BindFragmentShaderATI 858
-#define _gloffset_ColorFragmentOp1ATI 859
-#define _gloffset_ColorFragmentOp2ATI 860
-#define _gloffset_ColorFragmentOp3ATI 861
-#define _gloffset_DeleteFragmentShaderATI 862
-#define _gloffset_EndFragmentShaderATI 863
-#define _gloffset_GenFragmentShadersATI 864
-#define _gloffset_PassTexCoordATI 865
-#define _gloffset_SampleMapATI 866
-#define _gloffset_SetFragmentShaderConstantATI 867
-#define _gloffset_PointParameteriNV 868
-#define _gloffset_PointParameterivNV 869
-#define _gloffset_ActiveStencilFaceEXT 870
-#define _gloffset_BindVertexArrayAPPLE 871
-#define _gloffset_DeleteVertexArraysAPPLE 872
-#define _gloffset_GenVertexArraysAPPLE 873
-#define _gloffset_IsVertexArrayAPPLE 874
-#define _gloffset_GetProgramNamedParameterdvNV 875
-#define _gloffset_GetProgramNamedParameterfvNV 876
-#define _gloffset_ProgramNamedParameter4dNV 877
-#define _gloffset_ProgramNamedParameter4dvNV 878
-#define _gloffset_ProgramNamedParameter4fNV 879
-#define _gloffset_ProgramNamedParameter4fvNV 880
-#define _gloffset_PrimitiveRestartIndexNV 881
-#define _gloffset_PrimitiveRestartNV 882
-#define _gloffset_DepthBoundsEXT 883
-#define _gloffset_BlendEquationSeparateEXT 884
-#define _gloffset_BindFramebufferEXT 885
-#define _gloffset_BindRenderbufferEXT 886
-#define _gloffset_CheckFramebufferStatusEXT 887
-#define _gloffset_DeleteFramebuffersEXT 888
-#define _gloffset_DeleteRenderbuffersEXT 889
-#define _gloffset_FramebufferRenderbufferEXT 890
-#define _gloffset_FramebufferTexture1DEXT 891
-#define _gloffset_FramebufferTexture2DEXT 892
-#define _gloffset_FramebufferTexture3DEXT 893
-#define _gloffset_GenFramebuffersEXT 894
-#define _gloffset_GenRenderbuffersEXT 895
-#define _gloffset_GenerateMipmapEXT 896
-#define _gloffset_GetFramebufferAttachmentParameterivEXT 897
-#define _gloffset_GetRenderbufferParameterivEXT 898
-#define _gloffset_IsFramebufferEXT 899
-#define _gloffset_IsRenderbufferEXT 900
-#define _gloffset_RenderbufferStorageEXT 901
-#define _gloffset_BlitFramebufferEXT 902
-#define _gloffset_BufferParameteriAPPLE 903
-#define _gloffset_FlushMappedBufferRangeAPPLE 904
-#define _gloffset_BindFragDataLocationEXT 905
-#define _gloffset_GetFragDataLocationEXT 906
-#define _gloffset_GetUniformuivEXT 907
-#define _gloffset_GetVertexAttribIivEXT 908
-#define _gloffset_GetVertexAttribIuivEXT 909
-#define _gloffset_Uniform1uiEXT 910
-#define _gloffset_Uniform1uivEXT 911
-#define _gloffset_Uniform2uiEXT 912
-#define _gloffset_Uniform2uivEXT 913
-#define _gloffset_Uniform3uiEXT 914
-#define _gloffset_Uniform3uivEXT 915
-#define _gloffset_Uniform4uiEXT 916
-#define _gloffset_Uniform4uivEXT 917
-#define _gloffset_VertexAttribI1iEXT 918
-#define _gloffset_VertexAttribI1ivEXT 919
-#define _gloffset_VertexAttribI1uiEXT 920
-#define _gloffset_VertexAttribI1uivEXT 921
-#define _gloffset_VertexAttribI2iEXT 922
-#define _gloffset_VertexAttribI2ivEXT 923
-#define _gloffset_VertexAttribI2uiEXT 924
-#define _gloffset_VertexAttribI2uivEXT 925
-#define _gloffset_VertexAttribI3iEXT 926
-#define _gloffset_VertexAttribI3ivEXT 927
-#define _gloffset_VertexAttribI3uiEXT 928
-#define _gloffset_VertexAttribI3uivEXT 929
-#define _gloffset_VertexAttribI4bvEXT 930
-#define _gloffset_VertexAttribI4iEXT 931
-#define _gloffset_VertexAttribI4ivEXT 932
-#define _gloffset_VertexAttribI4svEXT 933
-#define _gloffset_VertexAttribI4ubvEXT 934
-#define _gloffset_VertexAttribI4uiEXT 935
-#define _gloffset_VertexAttribI4uivEXT 936
-#define _gloffset_VertexAttribI4usvEXT 937
-#define _gloffset_VertexAttribIPointerEXT 938
-#define _gloffset_FramebufferTextureLayerEXT 939
-#define _gloffset_ColorMaskIndexedEXT 940
-#define _gloffset_DisableIndexedEXT 941
-#define _gloffset_EnableIndexedEXT 942
-#define _gloffset_GetBooleanIndexedvEXT 943
-#define _gloffset_GetIntegerIndexedvEXT 944
-#define _gloffset_IsEnabledIndexedEXT 945
-#define _gloffset_ClearColorIiEXT 946
-#define _gloffset_ClearColorIuiEXT 947
-#define _gloffset_GetTexParameterIivEXT 948
-#define _gloffset_GetTexParameterIuivEXT 949
-#define _gloffset_TexParameterIivEXT 950
-#define _gloffset_TexParameterIuivEXT 951
-#define _gloffset_BeginConditionalRenderNV 952
-#define _gloffset_EndConditionalRenderNV 953
-#define _gloffset_BeginTransformFeedbackEXT 954
-#define _gloffset_BindBufferBaseEXT 955
-#define _gloffset_BindBufferOffsetEXT 956
-#define _gloffset_BindBufferRangeEXT 957
-#define _gloffset_EndTransformFeedbackEXT 958
-#define _gloffset_GetTransformFeedbackVaryingEXT 959
-#define _gloffset_TransformFeedbackVaryingsEXT 960
-#define _gloffset_ProvokingVertexEXT 961
-#define _gloffset_GetTexParameterPointervAPPLE 962
-#define _gloffset_TextureRangeAPPLE 963
-#define _gloffset_GetObjectParameterivAPPLE 964
-#define _gloffset_ObjectPurgeableAPPLE 965
-#define _gloffset_ObjectUnpurgeableAPPLE 966
-#define _gloffset_ActiveProgramEXT 967
-#define _gloffset_CreateShaderProgramEXT 968
-#define _gloffset_UseShaderProgramEXT 969
-#define _gloffset_TextureBarrierNV 970
-#define _gloffset_StencilFuncSeparateATI 971
-#define _gloffset_ProgramEnvParameters4fvEXT 972
-#define _gloffset_ProgramLocalParameters4fvEXT 973
-#define _gloffset_GetQueryObjecti64vEXT 974
-#define _gloffset_GetQueryObjectui64vEXT 975
-#define _gloffset_EGLImageTargetRenderbufferStorageOES 976
-#define _gloffset_EGLImageTargetTexture2DOES 977
+#define _gloffset_GetProgramBinary 666
+#define _gloffset_ProgramBinary 667
+#define _gloffset_DebugMessageCallbackARB 668
+#define _gloffset_DebugMessageControlARB 669
+#define _gloffset_DebugMessageInsertARB 670
+#define _gloffset_GetDebugMessageLogARB 671
+#define _gloffset_GetGraphicsResetStatusARB 672
+#define _gloffset_GetnColorTableARB 673
+#define _gloffset_GetnCompressedTexImageARB 674
+#define _gloffset_GetnConvolutionFilterARB 675
+#define _gloffset_GetnHistogramARB 676
+#define _gloffset_GetnMapdvARB 677
+#define _gloffset_GetnMapfvARB 678
+#define _gloffset_GetnMapivARB 679
+#define _gloffset_GetnMinmaxARB 680
+#define _gloffset_GetnPixelMapfvARB 681
+#define _gloffset_GetnPixelMapuivARB 682
+#define _gloffset_GetnPixelMapusvARB 683
+#define _gloffset_GetnPolygonStippleARB 684
+#define _gloffset_GetnSeparableFilterARB 685
+#define _gloffset_GetnTexImageARB 686
+#define _gloffset_GetnUniformdvARB 687
+#define _gloffset_GetnUniformfvARB 688
+#define _gloffset_GetnUniformivARB 689
+#define _gloffset_GetnUniformuivARB 690
+#define _gloffset_ReadnPixelsARB 691
+#define _gloffset_TexStorage1D 692
+#define _gloffset_TexStorage2D 693
+#define _gloffset_TexStorage3D 694
+#define _gloffset_TextureStorage1DEXT 695
+#define _gloffset_TextureStorage2DEXT 696
+#define _gloffset_TextureStorage3DEXT 697
+#define _gloffset_PolygonOffsetEXT 698
+#define _gloffset_GetPixelTexGenParameterfvSGIS 699
+#define _gloffset_GetPixelTexGenParameterivSGIS 700
+#define _gloffset_PixelTexGenParameterfSGIS 701
+#define _gloffset_PixelTexGenParameterfvSGIS 702
+#define _gloffset_PixelTexGenParameteriSGIS 703
+#define _gloffset_PixelTexGenParameterivSGIS 704
+#define _gloffset_SampleMaskSGIS 705
+#define _gloffset_SamplePatternSGIS 706
+#define _gloffset_ColorPointerEXT 707
+#define _gloffset_EdgeFlagPointerEXT 708
+#define _gloffset_IndexPointerEXT 709
+#define _gloffset_NormalPointerEXT 710
+#define _gloffset_TexCoordPointerEXT 711
+#define _gloffset_VertexPointerEXT 712
+#define _gloffset_PointParameterfEXT 713
+#define _gloffset_PointParameterfvEXT 714
+#define _gloffset_LockArraysEXT 715
+#define _gloffset_UnlockArraysEXT 716
+#define _gloffset_SecondaryColor3bEXT 717
+#define _gloffset_SecondaryColor3bvEXT 718
+#define _gloffset_SecondaryColor3dEXT 719
+#define _gloffset_SecondaryColor3dvEXT 720
+#define _gloffset_SecondaryColor3fEXT 721
+#define _gloffset_SecondaryColor3fvEXT 722
+#define _gloffset_SecondaryColor3iEXT 723
+#define _gloffset_SecondaryColor3ivEXT 724
+#define _gloffset_SecondaryColor3sEXT 725
+#define _gloffset_SecondaryColor3svEXT 726
+#define _gloffset_SecondaryColor3ubEXT 727
+#define _gloffset_SecondaryColor3ubvEXT 728
+#define _gloffset_SecondaryColor3uiEXT 729
+#define _gloffset_SecondaryColor3uivEXT 730
+#define _gloffset_SecondaryColor3usEXT 731
+#define _gloffset_SecondaryColor3usvEXT 732
+#define _gloffset_SecondaryColorPointerEXT 733
+#define _gloffset_MultiDrawArraysEXT 734
+#define _gloffset_MultiDrawElementsEXT 735
+#define _gloffset_FogCoordPointerEXT 736
+#define _gloffset_FogCoorddEXT 737
+#define _gloffset_FogCoorddvEXT 738
+#define _gloffset_FogCoordfEXT 739
+#define _gloffset_FogCoordfvEXT 740
+#define _gloffset_PixelTexGenSGIX 741
+#define _gloffset_BlendFuncSeparateEXT 742
+#define _gloffset_FlushVertexArrayRangeNV 743
+#define _gloffset_VertexArrayRangeNV 744
+#define _gloffset_CombinerInputNV 745
+#define _gloffset_CombinerOutputNV 746
+#define _gloffset_CombinerParameterfNV 747
+#define _gloffset_CombinerParameterfvNV 748
+#define _gloffset_CombinerParameteriNV 749
+#define _gloffset_CombinerParameterivNV 750
+#define _gloffset_FinalCombinerInputNV 751
+#define _gloffset_GetCombinerInputParameterfvNV 752
+#define _gloffset_GetCombinerInputParameterivNV 753
+#define _gloffset_GetCombinerOutputParameterfvNV 754
+#define _gloffset_GetCombinerOutputParameterivNV 755
+#define _gloffset_GetFinalCombinerInputParameterfvNV 756
+#define _gloffset_GetFinalCombinerInputParameterivNV 757
+#define _gloffset_ResizeBuffersMESA 758
+#define _gloffset_WindowPos2dMESA 759
+#define _gloffset_WindowPos2dvMESA 760
+#define _gloffset_WindowPos2fMESA 761
+#define _gloffset_WindowPos2fvMESA 762
+#define _gloffset_WindowPos2iMESA 763
+#define _gloffset_WindowPos2ivMESA 764
+#define _gloffset_WindowPos2sMESA 765
+#define _gloffset_WindowPos2svMESA 766
+#define _gloffset_WindowPos3dMESA 767
+#define _gloffset_WindowPos3dvMESA 768
+#define _gloffset_WindowPos3fMESA 769
+#define _gloffset_WindowPos3fvMESA 770
+#define _gloffset_WindowPos3iMESA 771
+#define _gloffset_WindowPos3ivMESA 772
+#define _gloffset_WindowPos3sMESA 773
+#define _gloffset_WindowPos3svMESA 774
+#define _gloffset_WindowPos4dMESA 775
+#define _gloffset_WindowPos4dvMESA 776
+#define _gloffset_WindowPos4fMESA 777
+#define _gloffset_WindowPos4fvMESA 778
+#define _gloffset_WindowPos4iMESA 779
+#define _gloffset_WindowPos4ivMESA 780
+#define _gloffset_WindowPos4sMESA 781
+#define _gloffset_WindowPos4svMESA 782
+#define _gloffset_MultiModeDrawArraysIBM 783
+#define _gloffset_MultiModeDrawElementsIBM 784
+#define _gloffset_DeleteFencesNV 785
+#define _gloffset_FinishFenceNV 786
+#define _gloffset_GenFencesNV 787
+#define _gloffset_GetFenceivNV 788
+#define _gloffset_IsFenceNV 789
+#define _gloffset_SetFenceNV 790
+#define _gloffset_TestFenceNV 791
+#define _gloffset_AreProgramsResidentNV 792
+#define _gloffset_BindProgramNV 793
+#define _gloffset_DeleteProgramsNV 794
+#define _gloffset_ExecuteProgramNV 795
+#define _gloffset_GenProgramsNV 796
+#define _gloffset_GetProgramParameterdvNV 797
+#define _gloffset_GetProgramParameterfvNV 798
+#define _gloffset_GetProgramStringNV 799
+#define _gloffset_GetProgramivNV 800
+#define _gloffset_GetTrackMatrixivNV 801
+#define _gloffset_GetVertexAttribPointervNV 802
+#define _gloffset_GetVertexAttribdvNV 803
+#define _gloffset_GetVertexAttribfvNV 804
+#define _gloffset_GetVertexAttribivNV 805
+#define _gloffset_IsProgramNV 806
+#define _gloffset_LoadProgramNV 807
+#define _gloffset_ProgramParameters4dvNV 808
+#define _gloffset_ProgramParameters4fvNV 809
+#define _gloffset_RequestResidentProgramsNV 810
+#define _gloffset_TrackMatrixNV 811
+#define _gloffset_VertexAttrib1dNV 812
+#define _gloffset_VertexAttrib1dvNV 813
+#define _gloffset_VertexAttrib1fNV 814
+#define _gloffset_VertexAttrib1fvNV 815
+#define _gloffset_VertexAttrib1sNV 816
+#define _gloffset_VertexAttrib1svNV 817
+#define _gloffset_VertexAttrib2dNV 818
+#define _gloffset_VertexAttrib2dvNV 819
+#define _gloffset_VertexAttrib2fNV 820
+#define _gloffset_VertexAttrib2fvNV 821
+#define _gloffset_VertexAttrib2sNV 822
+#define _gloffset_VertexAttrib2svNV 823
+#define _gloffset_VertexAttrib3dNV 824
+#define _gloffset_VertexAttrib3dvNV 825
+#define _gloffset_VertexAttrib3fNV 826
+#define _gloffset_VertexAttrib3fvNV 827
+#define _gloffset_VertexAttrib3sNV 828
+#define _gloffset_VertexAttrib3svNV 829
+#define _gloffset_VertexAttrib4dNV 830
+#define _gloffset_VertexAttrib4dvNV 831
+#define _gloffset_VertexAttrib4fNV 832
+#define _gloffset_VertexAttrib4fvNV 833
+#define _gloffset_VertexAttrib4sNV 834
+#define _gloffset_VertexAttrib4svNV 835
+#define _gloffset_VertexAttrib4ubNV 836
+#define _gloffset_VertexAttrib4ubvNV 837
+#define _gloffset_VertexAttribPointerNV 838
+#define _gloffset_VertexAttribs1dvNV 839
+#define _gloffset_VertexAttribs1fvNV 840
+#define _gloffset_VertexAttribs1svNV 841
+#define _gloffset_VertexAttribs2dvNV 842
+#define _gloffset_VertexAttribs2fvNV 843
+#define _gloffset_VertexAttribs2svNV 844
+#define _gloffset_VertexAttribs3dvNV 845
+#define _gloffset_VertexAttribs3fvNV 846
+#define _gloffset_VertexAttribs3svNV 847
+#define _gloffset_VertexAttribs4dvNV 848
+#define _gloffset_VertexAttribs4fvNV 849
+#define _gloffset_VertexAttribs4svNV 850
+#define _gloffset_VertexAttribs4ubvNV 851
+#define _gloffset_GetTexBumpParameterfvATI 852
+#define _gloffset_GetTexBumpParameterivATI 853
+#define _gloffset_TexBumpParameterfvATI 854
+#define _gloffset_TexBumpParameterivATI 855
+#define _gloffset_AlphaFragmentOp1ATI 856
+#define _gloffset_AlphaFragmentOp2ATI 857
+#define _gloffset_AlphaFragmentOp3ATI 858
+#define _gloffset_BeginFragmentShaderATI 859
+#define _gloffset_BindFragmentShaderATI 860
+#define _gloffset_ColorFragmentOp1ATI 861
+#define _gloffset_ColorFragmentOp2ATI 862
+#define _gloffset_ColorFragmentOp3ATI 863
+#define _gloffset_DeleteFragmentShaderATI 864
+#define _gloffset_EndFragmentShaderATI 865
+#define _gloffset_GenFragmentShadersATI 866
+#define _gloffset_PassTexCoordATI 867
+#define _gloffset_SampleMapATI 868
+#define _gloffset_SetFragmentShaderConstantATI 869
+#define _gloffset_PointParameteriNV 870
+#define _gloffset_PointParameterivNV 871
+#define _gloffset_ActiveStencilFaceEXT 872
+#define _gloffset_BindVertexArrayAPPLE 873
+#define _gloffset_DeleteVertexArraysAPPLE 874
+#define _gloffset_GenVertexArraysAPPLE 875
+#define _gloffset_IsVertexArrayAPPLE 876
+#define _gloffset_GetProgramNamedParameterdvNV 877
+#define _gloffset_GetProgramNamedParameterfvNV 878
+#define _gloffset_ProgramNamedParameter4dNV 879
+#define _gloffset_ProgramNamedParameter4dvNV 880
+#define _gloffset_ProgramNamedParameter4fNV 881
+#define _gloffset_ProgramNamedParameter4fvNV 882
+#define _gloffset_PrimitiveRestartIndexNV 883
+#define _gloffset_PrimitiveRestartNV 884
+#define _gloffset_DepthBoundsEXT 885
+#define _gloffset_BlendEquationSeparateEXT 886
+#define _gloffset_BindFramebufferEXT 887
+#define _gloffset_BindRenderbufferEXT 888
+#define _gloffset_CheckFramebufferStatusEXT 889
+#define _gloffset_DeleteFramebuffersEXT 890
+#define _gloffset_DeleteRenderbuffersEXT 891
+#define _gloffset_FramebufferRenderbufferEXT 892
+#define _gloffset_FramebufferTexture1DEXT 893
+#define _gloffset_FramebufferTexture2DEXT 894
+#define _gloffset_FramebufferTexture3DEXT 895
+#define _gloffset_GenFramebuffersEXT 896
+#define _gloffset_GenRenderbuffersEXT 897
+#define _gloffset_GenerateMipmapEXT 898
+#define _gloffset_GetFramebufferAttachmentParameterivEXT 899
+#define _gloffset_GetRenderbufferParameterivEXT 900
+#define _gloffset_IsFramebufferEXT 901
+#define _gloffset_IsRenderbufferEXT 902
+#define _gloffset_RenderbufferStorageEXT 903
+#define _gloffset_BlitFramebufferEXT 904
+#define _gloffset_BufferParameteriAPPLE 905
+#define _gloffset_FlushMappedBufferRangeAPPLE 906
+#define _gloffset_BindFragDataLocationEXT 907
+#define _gloffset_GetFragDataLocationEXT 908
+#define _gloffset_GetUniformuivEXT 909
+#define _gloffset_GetVertexAttribIivEXT 910
+#define _gloffset_GetVertexAttribIuivEXT 911
+#define _gloffset_Uniform1uiEXT 912
+#define _gloffset_Uniform1uivEXT 913
+#define _gloffset_Uniform2uiEXT 914
+#define _gloffset_Uniform2uivEXT 915
+#define _gloffset_Uniform3uiEXT 916
+#define _gloffset_Uniform3uivEXT 917
+#define _gloffset_Uniform4uiEXT 918
+#define _gloffset_Uniform4uivEXT 919
+#define _gloffset_VertexAttribI1iEXT 920
+#define _gloffset_VertexAttribI1ivEXT 921
+#define _gloffset_VertexAttribI1uiEXT 922
+#define _gloffset_VertexAttribI1uivEXT 923
+#define _gloffset_VertexAttribI2iEXT 924
+#define _gloffset_VertexAttribI2ivEXT 925
+#define _gloffset_VertexAttribI2uiEXT 926
+#define _gloffset_VertexAttribI2uivEXT 927
+#define _gloffset_VertexAttribI3iEXT 928
+#define _gloffset_VertexAttribI3ivEXT 929
+#define _gloffset_VertexAttribI3uiEXT 930
+#define _gloffset_VertexAttribI3uivEXT 931
+#define _gloffset_VertexAttribI4bvEXT 932
+#define _gloffset_VertexAttribI4iEXT 933
+#define _gloffset_VertexAttribI4ivEXT 934
+#define _gloffset_VertexAttribI4svEXT 935
+#define _gloffset_VertexAttribI4ubvEXT 936
+#define _gloffset_VertexAttribI4uiEXT 937
+#define _gloffset_VertexAttribI4uivEXT 938
+#define _gloffset_VertexAttribI4usvEXT 939
+#define _gloffset_VertexAttribIPointerEXT 940
+#define _gloffset_FramebufferTextureLayerEXT 941
+#define _gloffset_ColorMaskIndexedEXT 942
+#define _gloffset_DisableIndexedEXT 943
+#define _gloffset_EnableIndexedEXT 944
+#define _gloffset_GetBooleanIndexedvEXT 945
+#define _gloffset_GetIntegerIndexedvEXT 946
+#define _gloffset_IsEnabledIndexedEXT 947
+#define _gloffset_ClearColorIiEXT 948
+#define _gloffset_ClearColorIuiEXT 949
+#define _gloffset_GetTexParameterIivEXT 950
+#define _gloffset_GetTexParameterIuivEXT 951
+#define _gloffset_TexParameterIivEXT 952
+#define _gloffset_TexParameterIuivEXT 953
+#define _gloffset_BeginConditionalRenderNV 954
+#define _gloffset_EndConditionalRenderNV 955
+#define _gloffset_BeginTransformFeedbackEXT 956
+#define _gloffset_BindBufferBaseEXT 957
+#define _gloffset_BindBufferOffsetEXT 958
+#define _gloffset_BindBufferRangeEXT 959
+#define _gloffset_EndTransformFeedbackEXT 960
+#define _gloffset_GetTransformFeedbackVaryingEXT 961
+#define _gloffset_TransformFeedbackVaryingsEXT 962
+#define _gloffset_ProvokingVertexEXT 963
+#define _gloffset_GetTexParameterPointervAPPLE 964
+#define _gloffset_TextureRangeAPPLE 965
+#define _gloffset_GetObjectParameterivAPPLE 966
+#define _gloffset_ObjectPurgeableAPPLE 967
+#define _gloffset_ObjectUnpurgeableAPPLE 968
+#define _gloffset_ActiveProgramEXT 969
+#define _gloffset_CreateShaderProgramEXT 970
+#define _gloffset_UseShaderProgramEXT 971
+#define _gloffset_TextureBarrierNV 972
+#define _gloffset_StencilFuncSeparateATI 973
+#define _gloffset_ProgramEnvParameters4fvEXT 974
+#define _gloffset_ProgramLocalParameters4fvEXT 975
+#define _gloffset_GetQueryObjecti64vEXT 976
+#define _gloffset_GetQueryObjectui64vEXT 977
+#define _gloffset_EGLImageTargetRenderbufferStorageOES 978
+#define _gloffset_EGLImageTargetTexture2DOES 979
 
 #else /* !FEATURE_remap_table */
 
-#define driDispatchRemapTable_size 570
+#define driDispatchRemapTable_size 572
 extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 
 #define AttachShader_remap_index 0
@@ -1310,318 +1312,320 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define GetShaderPrecisionFormat_remap_index 255
 #define ReleaseShaderCompiler_remap_index 256
 #define ShaderBinary_remap_index 257
-#define DebugMessageCallbackARB_remap_index 258
-#define DebugMessageControlARB_remap_index 259
-#define DebugMessageInsertARB_remap_index 260
-#define GetDebugMessageLogARB_remap_index 261
-#define GetGraphicsResetStatusARB_remap_index 262
-#define GetnColorTableARB_remap_index 263
-#define GetnCompressedTexImageARB_remap_index 264
-#define GetnConvolutionFilterARB_remap_index 265
-#define GetnHistogramARB_remap_index 266
-#define GetnMapdvARB_remap_index 267
-#define GetnMapfvARB_remap_index 268
-#define GetnMapivARB_remap_index 269
-#define GetnMinmaxARB_remap_index 270
-#define GetnPixelMapfvARB_remap_index 271
-#define GetnPixelMapuivARB_remap_index 272
-#define GetnPixelMapusvARB_remap_index 273
-#define GetnPolygonStippleARB_remap_index 274
-#define GetnSeparableFilterARB_remap_index 275
-#define GetnTexImageARB_remap_index 276
-#define GetnUniformdvARB_remap_index 277
-#define GetnUniformfvARB_remap_index 278
-#define GetnUniformivARB_remap_index 279
-#define GetnUniformuivARB_remap_index 280
-#define ReadnPixelsARB_remap_index 281
-#define TexStorage1D_remap_index 282
-#define TexStorage2D_remap_index 283
-#define TexStorage3D_remap_index 284
-#define TextureStorage1DEXT_remap_index 285
-#define TextureStorage2DEXT_remap_index 286
-#define TextureStorage3DEXT_remap_index 287
-#define PolygonOffsetEXT_remap_index 288
-#define GetPixelTexGenParameterfvSGIS_remap_index 289
-#define GetPixelTexGenParameterivSGIS_remap_index 290
-#define PixelTexGenParameterfSGIS_remap_index 291
-#define PixelTexGenParameterfvSGIS_remap_index 292
-#define PixelTexGenParameteriSGIS_remap_index 293
-#define PixelTexGenParameterivSGIS_remap_index 294
-#define SampleMaskSGIS_remap_index 295
-#define SamplePatternSGIS_remap_index 296
-#define ColorPointerEXT_remap_index 297
-#define EdgeFlagPointerEXT_remap_index 298
-#define IndexPointerEXT_remap_index 299
-#define NormalPointerEXT_remap_index 300
-#define TexCoordPointerEXT_remap_index 301
-#define VertexPointerEXT_remap_index 302
-#define PointParameterfEXT_remap_index 303
-#define PointParameterfvEXT_remap_index 304
-#define LockArraysEXT_remap_index 305
-#define UnlockArraysEXT_remap_index 306
-#define SecondaryColor3bEXT_remap_index 307
-#define SecondaryColor3bvEXT_remap_index 308
-#define SecondaryColor3dEXT_remap_index 309
-#define SecondaryColor3dvEXT_remap_index 310
-#define SecondaryColor3fEXT_remap_index 311
-#define SecondaryColor3fvEXT_remap_index 312
-#define SecondaryColor3iEXT_remap_index 313
-#define SecondaryColor3ivEXT_remap_index 314
-#define SecondaryColor3sEXT_remap_index 315
-#define SecondaryColor3svEXT_remap_index 316
-#define SecondaryColor3ubEXT_remap_index 317
-#define SecondaryColor3ubvEXT_remap_index 318
-#define SecondaryColor3uiEXT_remap_index 319
-#define SecondaryColor3uivEXT_remap_index 320
-#define SecondaryColor3usEXT_remap_index 321
-#define SecondaryColor3usvEXT_remap_index 322
-#define SecondaryColorPointerEXT_remap_index 323
-#define MultiDrawArraysEXT_remap_index 324
-#define MultiDrawElementsEXT_remap_index 325
-#define FogCoordPointerEXT_remap_index 326
-#define FogCoorddEXT_remap_index 327
-#define FogCoorddvEXT_remap_index 328
-#define FogCoordfEXT_remap_index 329
-#define FogCoordfvEXT_remap_index 330
-#define PixelTexGenSGIX_remap_index 331
-#define BlendFuncSeparateEXT_remap_index 332
-#define FlushVertexArrayRangeNV_remap_index 333
-#define VertexArrayRangeNV_remap_index 334
-#define CombinerInputNV_remap_index 335
-#define CombinerOutputNV_remap_index 336
-#define CombinerParameterfNV_remap_index 337
-#define CombinerParameterfvNV_remap_index 338
-#define CombinerParameteriNV_remap_index 339
-#define CombinerParameterivNV_remap_index 340
-#define FinalCombinerInputNV_remap_index 341
-#define GetCombinerInputParameterfvNV_remap_index 342
-#define GetCombinerInputParameterivNV_remap_index 343
-#define GetCombinerOutputParameterfvNV_remap_index 344
-#define GetCombinerOutputParameterivNV_remap_index 345
-#define GetFinalCombinerInputParameterfvNV_remap_index 346
-#define GetFinalCombinerInputParameterivNV_remap_index 347
-#define ResizeBuffersMESA_remap_index 348
-#define WindowPos2dMESA_remap_index 349
-#define WindowPos2dvMESA_remap_index 350
-#define WindowPos2fMESA_remap_index 351
-#define WindowPos2fvMESA_remap_index 352
-#define WindowPos2iMESA_remap_index 353
-#define WindowPos2ivMESA_remap_index 354
-#define WindowPos2sMESA_remap_index 355
-#define WindowPos2svMESA_remap_index 356
-#define WindowPos3dMESA_remap_index 357
-#define WindowPos3dvMESA_remap_index 358
-#define WindowPos3fMESA_remap_index 359
-#define WindowPos3fvMESA_remap_index 360
-#define WindowPos3iMESA_remap_index 361
-#define WindowPos3ivMESA_remap_index 362
-#define WindowPos3sMESA_remap_index 363
-#define WindowPos3svMESA_remap_index 364
-#define WindowPos4dMESA_remap_index 365
-#define WindowPos4dvMESA_remap_index 366
-#define WindowPos4fMESA_remap_index 367
-#define WindowPos4fvMESA_remap_index 368
-#define WindowPos4iMESA_remap_index 369
-#define WindowPos4ivMESA_remap_index 370
-#define WindowPos4sMESA_remap_index 371
-#define WindowPos4svMESA_remap_index 372
-#define MultiModeDrawArraysIBM_remap_index 373
-#define MultiModeDrawElementsIBM_remap_index 374
-#define DeleteFencesNV_remap_index 375
-#define FinishFenceNV_remap_index 376
-#define GenFencesNV_remap_index 377
-#define GetFenceivNV_remap_index 378
-#define IsFenceNV_remap_index 379
-#define SetFenceNV_remap_index 380
-#define TestFenceNV_remap_index 381
-#define AreProgramsResidentNV_remap_index 382
-#define BindProgramNV_remap_index 383
-#define DeleteProgramsNV_remap_index 384
-#define ExecuteProgramNV_remap_index 385
-#define GenProgramsNV_remap_index 386
-#define GetProgramParameterdvNV_remap_index 387
-#define GetProgramParameterfvNV_remap_index 388
-#define GetProgramStringNV_remap_index 389
-#define GetProgramivNV_remap_index 390
-#define GetTrackMatrixivNV_remap_index 391
-#define GetVertexAttribPointervNV_remap_index 392
-#define GetVertexAttribdvNV_remap_index 393
-#define GetVertexAttribfvNV_remap_index 394
-#define GetVertexAttribivNV_remap_index 395
-#define IsProgramNV_remap_index 396
-#define LoadProgramNV_remap_index 397
-#define ProgramParameters4dvNV_remap_index 398
-#define ProgramParameters4fvNV_remap_index 399
-#define RequestResidentProgramsNV_remap_index 400
-#define TrackMatrixNV_remap_index 401
-#define VertexAttrib1dNV_remap_index 402
-#define VertexAttrib1dvNV_remap_index 403
-#define VertexAttrib1fNV_remap_index 404
-#define VertexAttrib1fvNV_remap_index 405
-#define VertexAttrib1sNV_remap_index 406
-#define VertexAttrib1svNV_remap_index 407
-#define VertexAttrib2dNV_remap_index 408
-#define VertexAttrib2dvNV_remap_index 409
-#define VertexAttrib2fNV_remap_index 410
-#define VertexAttrib2fvNV_remap_index 411
-#define VertexAttrib2sNV_remap_index 412
-#define VertexAttrib2svNV_remap_index 413
-#define VertexAttrib3dNV_remap_index 414
-#define VertexAttrib3dvNV_remap_index 415
-#define VertexAttrib3fNV_remap_index 416
-#define VertexAttrib3fvNV_remap_index 417
-#define VertexAttrib3sNV_remap_index 418
-#define VertexAttrib3svNV_remap_index 419
-#define VertexAttrib4dNV_remap_index 420
-#define VertexAttrib4dvNV_remap_index 421
-#define VertexAttrib4fNV_remap_index 422
-#define VertexAttrib4fvNV_remap_index 423
-#define VertexAttrib4sNV_remap_index 424
-#define VertexAttrib4svNV_remap_index 425
-#define VertexAttrib4ubNV_remap_index 426
-#define VertexAttrib4ubvNV_remap_index 427
-#define VertexAttribPointerNV_remap_index 428
-#define VertexAttribs1dvNV_remap_index 429
-#define VertexAttribs1fvNV_remap_index 430
-#define VertexAttribs1svNV_remap_index 431
-#define VertexAttribs2dvNV_remap_index 432
-#define VertexAttribs2fvNV_remap_index 433
-#define VertexAttribs2svNV_remap_index 434
-#define VertexAttribs3dvNV_remap_index 435
-#define VertexAttribs3fvNV_remap_index 436
-#define VertexAttribs3svNV_remap_index 437
-#define VertexAttribs4dvNV_remap_index 438
-#define VertexAttribs4fvNV_remap_index 439
-#define VertexAttribs4svNV_remap_index 440
-#define VertexAttribs4ubvNV_remap_index 441
-#define GetTexBumpParameterfvATI_remap_index 442
-#define GetTexBumpParameterivATI_remap_index 443
-#define TexBumpParameterfvATI_remap_index 444
-#define TexBumpParameterivATI_remap_index 445
-#define AlphaFragmentOp1ATI_remap_index 446
-#define AlphaFragmentOp2ATI_remap_index 447
-#define AlphaFragmentOp3ATI_remap_index 448
-#define BeginFragmentShaderATI_remap_index 449
-#define BindFragmentShaderATI_remap_index 450
-#define ColorFragmentOp1ATI_remap_index 451
-#define ColorFragmentOp2ATI_remap_index 452
-#define ColorFragmentOp3ATI_remap_index 453
-#define DeleteFragmentShaderATI_remap_index 454
-#define EndFragmentShaderATI_remap_index 455
-#define GenFragmentShadersATI_remap_index 456
-#define PassTexCoordATI_remap_index 457
-#define SampleMapATI_remap_index 458
-#define SetFragmentShaderConstantATI_remap_index 459
-#define PointParameteriNV_remap_index 460
-#define PointParameterivNV_remap_index 461
-#define ActiveStencilFaceEXT_remap_index 462
-#define BindVertexArrayAPPLE_remap_index 463
-#define DeleteVertexArraysAPPLE_remap_index 464
-#define GenVertexArraysAPPLE_remap_index 465
-#define IsVertexArrayAPPLE_remap_index 466
-#define GetProgramNamedParameterdvNV_remap_index 467
-#define GetProgramNamedParameterfvNV_remap_index 468
-#define ProgramNamedParameter4dNV_remap_index 469
-#define ProgramNamedParameter4dvNV_remap_index 470
-#define ProgramNamedParameter4fNV_remap_index 471
-#define ProgramNamedParameter4fvNV_remap_index 472
-#define PrimitiveRestartIndexNV_remap_index 473
-#define PrimitiveRestartNV_remap_index 474
-#define DepthBoundsEXT_remap_index 475
-#define BlendEquationSeparateEXT_remap_index 476
-#define BindFramebufferEXT_remap_index 477
-#define BindRenderbufferEXT_remap_index 478
-#define CheckFramebufferStatusEXT_remap_index 479
-#define DeleteFramebuffersEXT_remap_index 480
-#define DeleteRenderbuffersEXT_remap_index 481
-#define FramebufferRenderbufferEXT_remap_index 482
-#define FramebufferTexture1DEXT_remap_index 483
-#define FramebufferTexture2DEXT_remap_index 484
-#define FramebufferTexture3DEXT_remap_index 485
-#define GenFramebuffersEXT_remap_index 486
-#define GenRenderbuffersEXT_remap_index 487
-#define GenerateMipmapEXT_remap_index 488
-#define GetFramebufferAttachmentParameterivEXT_remap_index 489
-#define GetRenderbufferParameterivEXT_remap_index 490
-#define IsFramebufferEXT_remap_index 491
-#define IsRenderbufferEXT_remap_index 492
-#define RenderbufferStorageEXT_remap_index 493
-#define BlitFramebufferEXT_remap_index 494
-#define BufferParameteriAPPLE_remap_index 495
-#define FlushMappedBufferRangeAPPLE_remap_index 496
-#define BindFragDataLocationEXT_remap_index 497
-#define GetFragDataLocationEXT_remap_index 498
-#define GetUniformuivEXT_remap_index 499
-#define GetVertexAttribIivEXT_remap_index 500
-#define GetVertexAttribIuivEXT_remap_index 501
-#define Uniform1uiEXT_remap_index 502
-#define Uniform1uivEXT_remap_index 503
-#define Uniform2uiEXT_remap_index 504
-#define Uniform2uivEXT_remap_index 505
-#define Uniform3uiEXT_remap_index 506
-#define Uniform3uivEXT_remap_index 507
-#define Uniform4uiEXT_remap_index 508
-#define Uniform4uivEXT_remap_index 509
-#define VertexAttribI1iEXT_remap_index 510
-#define VertexAttribI1ivEXT_remap_index 511
-#define VertexAttribI1uiEXT_remap_index 512
-#define VertexAttribI1uivEXT_remap_index 513
-#define VertexAttribI2iEXT_remap_index 514
-#define VertexAttribI2ivEXT_remap_index 515
-#define VertexAttribI2uiEXT_remap_index 516
-#define VertexAttribI2uivEXT_remap_index 517
-#define VertexAttribI3iEXT_remap_index 518
-#define VertexAttribI3ivEXT_remap_index 519
-#define VertexAttribI3uiEXT_remap_index 520
-#define VertexAttribI3uivEXT_remap_index 521
-#define VertexAttribI4bvEXT_remap_index 522
-#define VertexAttribI4iEXT_remap_index 523
-#define VertexAttribI4ivEXT_remap_index 524
-#define VertexAttribI4svEXT_remap_index 525
-#define VertexAttribI4ubvEXT_remap_index 526
-#define VertexAttribI4uiEXT_remap_index 527
-#define VertexAttribI4uivEXT_remap_index 528
-#define VertexAttribI4usvEXT_remap_index 529
-#define VertexAttribIPointerEXT_remap_index 530
-#define FramebufferTextureLayerEXT_remap_index 531
-#define ColorMaskIndexedEXT_remap_index 532
-#define DisableIndexedEXT_remap_index 533
-#define EnableIndexedEXT_remap_index 534
-#define GetBooleanIndexedvEXT_remap_index 535
-#define GetIntegerIndexedvEXT_remap_index 536
-#define IsEnabledIndexedEXT_remap_index 537
-#define ClearColorIiEXT_remap_index 538
-#define ClearColorIuiEXT_remap_index 539
-#define GetTexParameterIivEXT_remap_index 540
-#define GetTexParameterIuivEXT_remap_index 541
-#define TexParameterIivEXT_remap_index 542
-#define TexParameterIuivEXT_remap_index 543
-#define BeginConditionalRenderNV_remap_index 544
-#define EndConditionalRenderNV_remap_index 545
-#define BeginTransformFeedbackEXT_remap_index 546
-#define BindBufferBaseEXT_remap_index 547
-#define BindBufferOffsetEXT_remap_index 548
-#define BindBufferRangeEXT_remap_index 549
-#define EndTransformFeedbackEXT_remap_index 550
-#define GetTransformFeedbackVaryingEXT_remap_index 551
-#define TransformFeedbackVaryingsEXT_remap_index 552
-#define ProvokingVertexEXT_remap_index 553
-#define GetTexParameterPointervAPPLE_remap_index 554
-#define TextureRangeAPPLE_remap_index 555
-#define GetObjectParameterivAPPLE_remap_index 556
-#define ObjectPurgeableAPPLE_remap_index 557
-#define ObjectUnpurgeableAPPLE_remap_index 558
-#define ActiveProgramEXT_remap_index 559
-#define CreateShaderProgramEXT_remap_index 560
-#define UseShaderProgramEXT_remap_index 561
-#define TextureBarrierNV_remap_index 562
-#define StencilFuncSeparateATI_remap_index 563
-#define ProgramEnvParameters4fvEXT_remap_index 564
-#define ProgramLocalParameters4fvEXT_remap_index 565
-#define GetQueryObjecti64vEXT_remap_index 566
-#define GetQueryObjectui64vEXT_remap_index 567
-#define EGLImageTargetRenderbufferStorageOES_remap_index 568
-#define EGLImageTargetTexture2DOES_remap_index 569
+#define GetProgramBinary_remap_index 258
+#define ProgramBinary_remap_index 259
+#define DebugMessageCallbackARB_remap_index 260
+#define DebugMessageControlARB_remap_index 261
+#define DebugMessageInsertARB_remap_index 262
+#define GetDebugMessageLogARB_remap_index 263
+#define GetGraphicsResetStatusARB_remap_index 264
+#define GetnColorTableARB_remap_index 265
+#define GetnCompressedTexImageARB_remap_index 266
+#define GetnConvolutionFilterARB_remap_index 267
+#define GetnHistogramARB_remap_index 268
+#define GetnMapdvARB_remap_index 269
+#define GetnMapfvARB_remap_index 270
+#define GetnMapivARB_remap_index 271
+#define GetnMinmaxARB_remap_index 272
+#define GetnPixelMapfvARB_remap_index 273
+#define GetnPixelMapuivARB_remap_index 274
+#define GetnPixelMapusvARB_remap_index 275
+#define GetnPolygonStippleARB_remap_index 276
+#define GetnSeparableFilterARB_remap_index 277
+#define GetnTexImageARB_remap_index 278
+#define GetnUniformdvARB_remap_index 279
+#define GetnUniformfvARB_remap_index 280
+#define GetnUniformivARB_remap_index 281
+#define GetnUniformuivARB_remap_index 282
+#define ReadnPixelsARB_remap_index 283
+#define TexStorage1D_remap_index 284
+#define TexStorage2D_remap_index 285
+#define TexStorage3D_remap_index 286
+#define TextureStorage1DEXT_remap_index 287
+#define TextureStorage2DEXT_remap_index 288
+#define TextureStorage3DEXT_remap_index 289
+#define PolygonOffsetEXT_remap_index 290
+#define GetPixelTexGenParameterfvSGIS_remap_index 291
+#define GetPixelTexGenParameterivSGIS_remap_index 292
+#define PixelTexGenParameterfSGIS_remap_index 293
+#define PixelTexGenParameterfvSGIS_remap_index 294
+#define PixelTexGenParameteriSGIS_remap_index 295
+#define PixelTexGenParameterivSGIS_remap_index 296
+#define SampleMaskSGIS_remap_index 297
+#define SamplePatternSGIS_remap_index 298
+#define ColorPointerEXT_remap_index 299
+#define EdgeFlagPointerEXT_remap_index 300
+#define IndexPointerEXT_remap_index 301
+#define NormalPointerEXT_remap_index 302
+#define TexCoordPointerEXT_remap_index 303
+#define VertexPointerEXT_remap_index 304
+#define PointParameterfEXT_remap_index 305
+#define PointParameterfvEXT_remap_index 306
+#define LockArraysEXT_remap_index 307
+#define UnlockArraysEXT_remap_index 308
+#define SecondaryColor3bEXT_remap_index 309
+#define SecondaryColor3bvEXT_remap_index 310
+#define SecondaryColor3dEXT_remap_index 311
+#define SecondaryColor3dvEXT_remap_index 312
+#define SecondaryColor3fEXT_remap_index 313
+#define SecondaryColor3fvEXT_remap_index 314
+#define SecondaryColor3iEXT_remap_index 315
+#define SecondaryColor3ivEXT_remap_index 316
+#define SecondaryColor3sEXT_remap_index 317
+#define SecondaryColor3svEXT_remap_index 318
+#define SecondaryColor3ubEXT_remap_index 319
+#define SecondaryColor3ubvEXT_remap_index 320
+#define SecondaryColor3uiEXT_remap_index 321
+#define SecondaryColor3uivEXT_remap_index 322
+#define SecondaryColor3usEXT_remap_index 323
+#define SecondaryColor3usvEXT_remap_index 324
+#define SecondaryColorPointerEXT_remap_index 325
+#define MultiDrawArraysEXT_remap_index 326
+#define MultiDrawElementsEXT_remap_index 327
+#define FogCoordPointerEXT_remap_index 328
+#define FogCoorddEXT_remap_index 329
+#define FogCoorddvEXT_remap_index 330
+#define FogCoordfEXT_remap_index 331
+#define FogCoordfvEXT_remap_index 332
+#define PixelTexGenSGIX_remap_index 333
+#define BlendFuncSeparateEXT_remap_index 334
+#define FlushVertexArrayRangeNV_remap_index 335
+#define VertexArrayRangeNV_remap_index 336
+#define CombinerInputNV_remap_index 337
+#define CombinerOutputNV_remap_index 338
+#define CombinerParameterfNV_remap_index 339
+#define CombinerParameterfvNV_remap_index 340
+#define CombinerParameteriNV_remap_index 341
+#define CombinerParameterivNV_remap_index 342
+#define FinalCombinerInputNV_remap_index 343
+#define GetCombinerInputParameterfvNV_remap_index 344
+#define GetCombinerInputParameterivNV_remap_index 345
+#define GetCombinerOutputParameterfvNV_remap_index 346
+#define GetCombinerOutputParameterivNV_remap_index 347
+#define GetFinalCombinerInputParameterfvNV_remap_index 348
+#define GetFinalCombinerInputParameterivNV_remap_index 349
+#define ResizeBuffersMESA_remap_index 350
+#define WindowPos2dMESA_remap_index 351
+#define WindowPos2dvMESA_remap_index 352
+#define WindowPos2fMESA_remap_index 353
+#define WindowPos2fvMESA_remap_index 354
+#define WindowPos2iMESA_remap_index 355
+#define WindowPos2ivMESA_remap_index 356
+#define WindowPos2sMESA_remap_index 357
+#define WindowPos2svMESA_remap_index 358
+#define WindowPos3dMESA_remap_index 359
+#define WindowPos3dvMESA_remap_index 360
+#define WindowPos3fMESA_remap_index 361
+#define WindowPos3fvMESA_remap_index 362
+#define WindowPos3iMESA_remap_index 363
+#define WindowPos3ivMESA_remap_index 364
+#define WindowPos3sMESA_remap_index 365
+#define WindowPos3svMESA_remap_index 366
+#define WindowPos4dMESA_remap_index 367
+#define WindowPos4dvMESA_remap_index 368
+#define WindowPos4fMESA_remap_index 369
+#define WindowPos4fvMESA_remap_index 370
+#define WindowPos4iMESA_remap_index 371
+#define WindowPos4ivMESA_remap_index 372
+#define WindowPos4sMESA_remap_index 373
+#define WindowPos4svMESA_remap_index 374
+#define MultiModeDrawArraysIBM_remap_index 375
+#define MultiModeDrawElementsIBM_remap_index 376
+#define DeleteFencesNV_remap_index 377
+#define FinishFenceNV_remap_index 378
+#define GenFencesNV_remap_index 379
+#define GetFenceivNV_remap_index 380
+#define IsFenceNV_remap_index 381
+#define SetFenceNV_remap_index 382
+#define TestFenceNV_remap_index 383
+#define AreProgramsResidentNV_remap_index 384
+#define BindProgramNV_remap_index 385
+#define DeleteProgramsNV_remap_index 386
+#define ExecuteProgramNV_remap_index 387
+#define GenProgramsNV_remap_index 388
+#define GetProgramParameterdvNV_remap_index 389
+#define GetProgramParameterfvNV_remap_index 390
+#define GetProgramStringNV_remap_index 391
+#define GetProgramivNV_remap_index 392
+#define GetTrackMatrixivNV_remap_index 393
+#define GetVertexAttribPointervNV_remap_index 394
+#define GetVertexAttribdvNV_remap_index 395
+#define GetVertexAttribfvNV_remap_index 396
+#define GetVertexAttribivNV_remap_index 397
+#define IsProgramNV_remap_index 398
+#define LoadProgramNV_remap_index 399
+#define ProgramParameters4dvNV_remap_index 400
+#define ProgramParameters4fvNV_remap_index 401
+#define RequestResidentProgramsNV_remap_index 402
+#define TrackMatrixNV_remap_index 403
+#define VertexAttrib1dNV_remap_index 404
+#define VertexAttrib1dvNV_remap_index 405
+#define VertexAttrib1fNV_remap_index 406
+#define VertexAttrib1fvNV_remap_index 407
+#define VertexAttrib1sNV_remap_index 408
+#define VertexAttrib1svNV_remap_index 409
+#define VertexAttrib2dNV_remap_index 410
+#define VertexAttrib2dvNV_remap_index 411
+#define VertexAttrib2fNV_remap_index 412
+#define VertexAttrib2fvNV_remap_index 413
+#define VertexAttrib2sNV_remap_index 414
+#define VertexAttrib2svNV_remap_index 415
+#define VertexAttrib3dNV_remap_index 416
+#define VertexAttrib3dvNV_remap_index 417
+#define VertexAttrib3fNV_remap_index 418
+#define VertexAttrib3fvNV_remap_index 419
+#define VertexAttrib3sNV_remap_index 420
+#define VertexAttrib3svNV_remap_index 421
+#define VertexAttrib4dNV_remap_index 422
+#define VertexAttrib4dvNV_remap_index 423
+#define VertexAttrib4fNV_remap_index 424
+#define VertexAttrib4fvNV_remap_index 425
+#define VertexAttrib4sNV_remap_index 426
+#define VertexAttrib4svNV_remap_index 427
+#define VertexAttrib4ubNV_remap_index 428
+#define VertexAttrib4ubvNV_remap_index 429
+#define VertexAttribPointerNV_remap_index 430
+#define VertexAttribs1dvNV_remap_index 431
+#define VertexAttribs1fvNV_remap_index 432
+#define VertexAttribs1svNV_remap_index 433
+#define VertexAttribs2dvNV_remap_index 434
+#define VertexAttribs2fvNV_remap_index 435
+#define VertexAttribs2svNV_remap_index 436
+#define VertexAttribs3dvNV_remap_index 437
+#define VertexAttribs3fvNV_remap_index 438
+#define VertexAttribs3svNV_remap_index 439
+#define VertexAttribs4dvNV_remap_index 440
+#define VertexAttribs4fvNV_remap_index 441
+#define VertexAttribs4svNV_remap_index 442
+#define VertexAttribs4ubvNV_remap_index 443
+#define GetTexBumpParameterfvATI_remap_index 444
+#define GetTexBumpParameterivATI_remap_index 445
+#define TexBumpParameterfvATI_remap_index 446
+#define TexBumpParameterivATI_remap_index 447
+#define AlphaFragmentOp1ATI_remap_index 448
+#define AlphaFragmentOp2ATI_remap_index 449
+#define AlphaFragmentOp3ATI_remap_index 450
+#define BeginFragmentShaderATI_remap_index 451
+#define BindFragmentShaderATI_remap_index 452
+#define ColorFragmentOp1ATI_remap_index 453
+#define ColorFragmentOp2ATI_remap_index 454
+#define ColorFragmentOp3ATI_remap_index 455
+#define DeleteFragmentShaderATI_remap_index 456
+#define EndFragmentShaderATI_remap_index 457
+#define GenFragmentShadersATI_remap_index 458
+#define PassTexCoordATI_remap_index 459
+#define SampleMapATI_remap_index 460
+#define SetFragmentShaderConstantATI_remap_index 461
+#define PointParameteriNV_remap_index 462
+#define PointParameterivNV_remap_index 463
+#define ActiveStencilFaceEXT_remap_index 464
+#define BindVertexArrayAPPLE_remap_index 465
+#define DeleteVertexArraysAPPLE_remap_index 466
+#define GenVertexArraysAPPLE_remap_index 467
+#define IsVertexArrayAPPLE_remap_index 468
+#define GetProgramNamedParameterdvNV_remap_index 469
+#define GetProgramNamedParameterfvNV_remap_index 470
+#define ProgramNamedParameter4dNV_remap_index 471
+#define ProgramNamedParameter4dvNV_remap_index 472
+#define ProgramNamedParameter4fNV_remap_index 473
+#define ProgramNamedParameter4fvNV_remap_index 474
+#define PrimitiveRestartIndexNV_remap_index 475
+#define PrimitiveRestartNV_remap_index 476
+#define DepthBoundsEXT_remap_index 477
+#define BlendEquationSeparateEXT_remap_index 478
+#define BindFramebufferEXT_remap_index 479
+#define BindRenderbufferEXT_remap_index 480
+#define CheckFramebufferStatusEXT_remap_index 481
+#define DeleteFramebuffersEXT_remap_index 482
+#define DeleteRenderbuffersEXT_remap_index 483
+#define FramebufferRenderbufferEXT_remap_index 484
+#define FramebufferTexture1DEXT_remap_index 485
+#define FramebufferTexture2DEXT_remap_index 486
+#define FramebufferTexture3DEXT_remap_index 487
+#define GenFramebuffersEXT_remap_index 488
+#define GenRenderbuffersEXT_remap_index 489
+#define GenerateMipmapEXT_remap_index 490
+#define GetFramebufferAttachmentParameterivEXT_remap_index 491
+#define GetRenderbufferParameterivEXT_remap_index 492
+#define IsFramebufferEXT_remap_index 493
+#define IsRenderbufferEXT_remap_index 494
+#define RenderbufferStorageEXT_remap_index 495
+#define BlitFramebufferEXT_remap_index 496
+#define BufferParameteriAPPLE_remap_index 497
+#define FlushMappedBufferRangeAPPLE_remap_index 498
+#define BindFragDataLocationEXT_remap_index 499
+#define GetFragDataLocationEXT_remap_index 500
+#define GetUniformuivEXT_remap_index 501
+#define GetVertexAttribIivEXT_remap_index 502
+#define GetVertexAttribIuivEXT_remap_index 503
+#define Uniform1uiEXT_remap_index 504
+#define Uniform1uivEXT_remap_index 505
+#define Uniform2uiEXT_remap_index 506
+#define Uniform2uivEXT_remap_index 507
+#define Uniform3uiEXT_remap_index 508
+#define Uniform3uivEXT_remap_index 509
+#define Uniform4uiEXT_remap_index 510
+#define Uniform4uivEXT_remap_index 511
+#define VertexAttribI1iEXT_remap_index 512
+#define VertexAttribI1ivEXT_remap_index 513
+#define VertexAttribI1uiEXT_remap_index 514
+#define VertexAttribI1uivEXT_remap_index 515
+#define VertexAttribI2iEXT_remap_index 516
+#define VertexAttribI2ivEXT_remap_index 517
+#define VertexAttribI2uiEXT_remap_index 518
+#define VertexAttribI2uivEXT_remap_index 519
+#define VertexAttribI3iEXT_remap_index 520
+#define VertexAttribI3ivEXT_remap_index 521
+#define VertexAttribI3uiEXT_remap_index 522
+#define VertexAttribI3uivEXT_remap_index 523
+#define VertexAttribI4bvEXT_remap_index 524
+#define VertexAttribI4iEXT_remap_index 525
+#define VertexAttribI4ivEXT_remap_index 526
+#define VertexAttribI4svEXT_remap_index 527
+#define VertexAttribI4ubvEXT_remap_index 528
+#define VertexAttribI4uiEXT_remap_index 529
+#define VertexAttribI4uivEXT_remap_index 530
+#define VertexAttribI4usvEXT_remap_index 531
+#define VertexAttribIPointerEXT_remap_index 532
+#define FramebufferTextureLayerEXT_remap_index 533
+#define ColorMaskIndexedEXT_remap_index 534
+#define DisableIndexedEXT_remap_index 535
+#define EnableIndexedEXT_remap_index 536
+#define GetBooleanIndexedvEXT_remap_index 537
+#define GetIntegerIndexedvEXT_remap_index 538
+#define IsEnabledIndexedEXT_remap_index 539
+#define ClearColorIiEXT_remap_index 540
+#define ClearColorIuiEXT_remap_index 541
+#define GetTexParameterIivEXT_remap_index 542
+#define GetTexParameterIuivEXT_remap_index 543
+#define TexParameterIivEXT_remap_index 544
+#define TexParameterIuivEXT_remap_index 545
+#define BeginConditionalRenderNV_remap_index 546
+#define EndConditionalRenderNV_remap_index 547
+#define BeginTransformFeedbackEXT_remap_index 548
+#define BindBufferBaseEXT_remap_index 549
+#define BindBufferOffsetEXT_remap_index 550
+#define BindBufferRangeEXT_remap_index 551
+#define EndTransformFeedbackEXT_remap_index 552
+#define GetTransformFeedbackVaryingEXT_remap_index 553
+#define TransformFeedbackVaryingsEXT_remap_index 554
+#define ProvokingVertexEXT_remap_index 555
+#define GetTexParameterPointervAPPLE_remap_index 556
+#define TextureRangeAPPLE_remap_index 557
+#define GetObjectParameterivAPPLE_remap_index 558
+#define ObjectPurgeableAPPLE_remap_index 559
+#define ObjectUnpurgeableAPPLE_remap_index 560
+#define ActiveProgramEXT_remap_index 561
+#define CreateShaderProgramEXT_remap_index 562
+#define UseShaderProgramEXT_remap_index 563
+#define TextureBarrierNV_remap_index 564
+#define StencilFuncSeparateATI_remap_index 565
+#define ProgramEnvParameters4fvEXT_remap_index 566
+#define ProgramLocalParameters4fvEXT_remap_index 567
+#define GetQueryObjecti64vEXT_remap_index 568
+#define GetQueryObjectui64vEXT_remap_index 569
+#define EGLImageTargetRenderbufferStorageOES_remap_index 570
+#define EGLImageTargetTexture2DOES_remap_index 571
 
 #define _gloffset_AttachShader driDispatchRemapTable[AttachShader_remap_index]
 #define _gloffset_CreateProgram driDispatchRemapTable[CreateProgram_remap_index]
@@ -1881,6 +1885,8 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define _gloffset_GetShaderPrecisionFormat driDispatchRemapTable[GetShaderPrecisionFormat_remap_index]
 #define _gloffset_ReleaseShaderCompiler driDispatchRemapTable[ReleaseShaderCompiler_remap_index]
 #define _gloffset_ShaderBinary driDispatchRemapTable[ShaderBinary_remap_index]
+#define _gloffset_GetProgramBinary driDispatchRemapTable[GetProgramBinary_remap_index]
+#define _gloffset_ProgramBinary driDispatchRemapTable[ProgramBinary_remap_index]
 #define _gloffset_DebugMessageCallbackARB driDispatchRemapTable[DebugMessageCallbackARB_remap_index]
 #define _gloffset_DebugMessageControlARB driDispatchRemapTable[DebugMessageControlARB_remap_index]
 #define _gloffset_DebugMessageInsertARB driDispatchRemapTable[DebugMessageInsertARB_remap_index]
@@ -9522,6 +9528,28 @@ static inline void SET_ShaderBinary(struct _glapi_table *disp, void (GLAPIENTRYP
    SET_by_offset(disp, _gloffset_ShaderBinary, fn);
 }
 
+typedef void (GLAPIENTRYP _glptr_GetProgramBinary)(GLuint, GLsizei, GLsizei *, GLenum *, GLvoid *);
+#define CALL_GetProgramBinary(disp, parameters) \
+    (* GET_GetProgramBinary(disp)) parameters
+static inline _glptr_GetProgramBinary GET_GetProgramBinary(struct _glapi_table *disp) {
+   return (_glptr_GetProgramBinary) (GET_by_offset(disp, _gloffset_GetProgramBinary));
+}
+
+static inline void SET_GetProgramBinary(struct _glapi_table *disp, void (GLAPIENTRYP fn)(GLuint, GLsizei, GLsizei *, GLenum *, GLvoid *)) {
+   SET_by_offset(disp, _gloffset_GetProgramBinary, fn);
+}
+
+typedef void (GLAPIENTRYP _glptr_ProgramBinary)(GLuint, GLenum, const GLvoid *, GLsizei);
+#define CALL_ProgramBinary(disp, parameters) \
+    (* GET_ProgramBinary(disp)) parameters
+static inline _glptr_ProgramBinary GET_ProgramBinary(struct _glapi_table *disp) {
+   return (_glptr_ProgramBinary) (GET_by_offset(disp, _gloffset_ProgramBinary));
+}
+
+static inline void SET_ProgramBinary(struct _glapi_table *disp, void (GLAPIENTRYP fn)(GLuint, GLenum, const GLvoid *, GLsizei)) {
+   SET_by_offset(disp, _gloffset_ProgramBinary, fn);
+}
+
 typedef void (GLAPIENTRYP _glptr_DebugMessageCallbackARB)(GLDEBUGPROCARB, GLvoid *);
 #define CALL_DebugMessageCallbackARB(disp, parameters) \
     (* GET_DebugMessageCallbackARB(disp)) parameters
@@ -750,6 +750,11 @@ static const struct value_desc values[] = {
    /* GL_ARB_fragment_program/OES_standard_derivatives */
    { GL_FRAGMENT_SHADER_DERIVATIVE_HINT_ARB,
      CONTEXT_ENUM(Hint.FragmentShaderDerivative), extra_ARB_fragment_shader },
+
+   /* GL_ARB_get_program_binary / GL_OES_get_program_binary */
+   { GL_NUM_PROGRAM_BINARY_FORMATS, CONST(1), extra_ARB_shader_objects },
+   { GL_PROGRAM_BINARY_FORMATS, CONST(GL_PROGRAM_BINARY_FORMAT_MESA),
+     extra_ARB_shader_objects },
 #endif /* FEATURE_GL || FEATURE_ES2 */
 
 #if FEATURE_ES2
@@ -97,6 +97,13 @@ typedef void *GLeglImageOES;
 #define GL_PROGRAM_BINARY_LENGTH_OES 0x8741
 #endif
 
+/* Format of the program binaries returned by glGetProgramBinary.  These
+ * are only valid for the same build of Mesa that produced them.
+ */
+#ifndef GL_PROGRAM_BINARY_FORMAT_MESA
+#define GL_PROGRAM_BINARY_FORMAT_MESA 0x875F
+#endif
+
 /* GLES 2.0 tokens */
 #ifndef GL_RGB565
 #define GL_RGB565 0x8D62
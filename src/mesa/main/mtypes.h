@@ -69,6 +69,7 @@ typedef GLuint64 GLbitfield64;
  */
 /*@{*/
 struct _mesa_HashTable;
+struct disk_cache;
 struct gl_attrib_node;
 struct gl_list_extensions;
 struct gl_meta_state;
@@ -79,6 +80,7 @@ struct st_context;
 struct gl_uniform_storage;
 struct prog_instruction;
 struct gl_program_parameter_list;
+struct vbo_minmax_cache;
 /*@}*/
 
 
@@ -1517,6 +1519,13 @@ struct gl_buffer_object
    GLboolean DeletePending;   /**< true if buffer object is removed from the hash */
    GLboolean Written;   /**< Ever written to? (for debugging) */
    GLboolean Purgeable; /**< Is the buffer purgeable under memory pressure? */
+
+   /** \name Index bounds cache, see vbo_minmax_index.c */
+   /*@{*/
+   struct vbo_minmax_cache *MinMaxCache;
+   GLboolean MinMaxCacheDirty;     /**< Written since the cache was filled */
+   GLboolean MinMaxCacheDisabled;  /**< Streamed, or written by the GL */
+   /*@}*/
 };
 
 
@@ -2173,6 +2182,16 @@ struct gl_shader
    GLint RefCount;  /**< Reference count */
    GLboolean DeletePending;
    GLboolean CompileStatus;
+   /**
+    * Set when glCompileShader was satisfied by the on-disk shader cache.  The
+    * IR is then only generated if linking misses the cache as well.
+    */
+   GLboolean CompileDeferred;
+   /**
+    * Set while the shader is queued for compilation on a worker thread.  Only
+    * accessed with the lock in shaderqueue.c held.
+    */
+   GLboolean CompilePending;
    const GLchar *Source;  /**< Source code string */
    GLuint SourceChecksum;       /**< for debug/logging purposes */
    struct gl_program *Program;  /**< Post-compile assembly code */
@@ -2331,6 +2350,17 @@ struct gl_shader_program
 
    unsigned Version;       /**< GLSL version used for linking */
 
+   /**
+    * Serialized form of the linked program, for glGetProgramBinary.
+    *
+    * This is captured when linking finishes, before the driver lowers the
+    * IR.  Only kept when \c BinaryRetrievableHint was set at link time;
+    * \c NULL otherwise, or if the program could not be serialized.
+    */
+   GLubyte *Binary;
+   GLuint BinarySize;
+   GLboolean BinaryRetrievableHint; /**< GL_PROGRAM_BINARY_RETRIEVABLE_HINT */
+
    /**
     * Per-stage shaders resulting from the first stage of linking.
     *
@@ -2350,6 +2380,7 @@ struct gl_shader_program
 #define GLSL_NOP_VERT 0x20  /**< Force no-op vertex shaders */
 #define GLSL_NOP_FRAG 0x40  /**< Force no-op fragment shaders */
 #define GLSL_USE_PROG 0x80  /**< Log glUseProgram calls */
+#define GLSL_NO_CACHE 0x100 /**< Don't use the on-disk shader cache */
 
 
 /**
@@ -2378,6 +2409,9 @@ struct gl_shader_state
    struct gl_shader_program *ActiveProgram;
 
    GLbitfield Flags;                    /**< Mask of GLSL_x flags */
+
+   /** On-disk cache of compiled shaders, or \c NULL if not in use */
+   struct disk_cache *DiskCache;
 };
 
 
@@ -2840,6 +2874,13 @@ struct gl_constants
     */
    GLboolean GLSLSkipStrictMaxVaryingLimitCheck;
    GLboolean GLSLSkipStrictMaxUniformLimitCheck;
+
+   /**
+    * Whether the driver is done with the GLSL IR of a linked program once
+    * Driver.LinkShader returns.  If so, the IR is cut down to the variable
+    * declarations that the GL API still queries.
+    */
+   GLboolean CompactLinkedIR;
 };
 
 
@@ -3503,7 +3544,8 @@ enum _verbose
 /** The MESA_DEBUG_FLAGS var is a bitmask of these flags */
 enum _debug
 {
-   DEBUG_ALWAYS_FLUSH		= 0x1
+   DEBUG_ALWAYS_FLUSH		= 0x1,
+   DEBUG_MINMAX_CACHE		= 0x2
 };
 
 
@@ -632,4498 +632,4507 @@ static const char _mesa_function_pool[] =
    "iidddd\0"
    "glProgramLocalParameter4dARB\0"
    "\0"
-   /* _mesa_function_pool[4348]: CompressedTexImage3DARB (will be remapped) */
+   /* _mesa_function_pool[4348]: ProgramBinary (will be remapped) */
+   "iipi\0"
+   "glProgramBinary\0"
+   "\0"
+   /* _mesa_function_pool[4370]: CompressedTexImage3DARB (will be remapped) */
    "iiiiiiiip\0"
    "glCompressedTexImage3D\0"
    "glCompressedTexImage3DARB\0"
    "\0"
-   /* _mesa_function_pool[4408]: Color3sv (offset 18) */
+   /* _mesa_function_pool[4430]: Color3sv (offset 18) */
    "p\0"
    "glColor3sv\0"
    "\0"
-   /* _mesa_function_pool[4422]: GetConvolutionParameteriv (offset 358) */
+   /* _mesa_function_pool[4444]: GetConvolutionParameteriv (offset 358) */
    "iip\0"
    "glGetConvolutionParameteriv\0"
    "glGetConvolutionParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[4486]: DeleteSamplers (will be remapped) */
+   /* _mesa_function_pool[4508]: DeleteSamplers (will be remapped) */
    "ip\0"
    "glDeleteSamplers\0"
    "\0"
-   /* _mesa_function_pool[4507]: VertexAttrib1fARB (will be remapped) */
+   /* _mesa_function_pool[4529]: VertexAttrib1fARB (will be remapped) */
    "if\0"
    "glVertexAttrib1f\0"
    "glVertexAttrib1fARB\0"
    "\0"
-   /* _mesa_function_pool[4548]: Vertex2dv (offset 127) */
+   /* _mesa_function_pool[4570]: Vertex2dv (offset 127) */
    "p\0"
    "glVertex2dv\0"
    "\0"
-   /* _mesa_function_pool[4563]: TestFenceNV (will be remapped) */
+   /* _mesa_function_pool[4585]: TestFenceNV (will be remapped) */
    "i\0"
    "glTestFenceNV\0"
    "\0"
-   /* _mesa_function_pool[4580]: GetVertexAttribIuivEXT (will be remapped) */
+   /* _mesa_function_pool[4602]: GetVertexAttribIuivEXT (will be remapped) */
    "iip\0"
    "glGetVertexAttribIuivEXT\0"
    "glGetVertexAttribIuiv\0"
    "\0"
-   /* _mesa_function_pool[4632]: CreateShaderProgramEXT (will be remapped) */
+   /* _mesa_function_pool[4654]: CreateShaderProgramEXT (will be remapped) */
    "ip\0"
    "glCreateShaderProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[4661]: MultiTexCoord1fvARB (offset 379) */
+   /* _mesa_function_pool[4683]: MultiTexCoord1fvARB (offset 379) */
    "ip\0"
    "glMultiTexCoord1fv\0"
    "glMultiTexCoord1fvARB\0"
    "\0"
-   /* _mesa_function_pool[4706]: TexCoord3iv (offset 115) */
+   /* _mesa_function_pool[4728]: TexCoord3iv (offset 115) */
    "p\0"
    "glTexCoord3iv\0"
    "\0"
-   /* _mesa_function_pool[4723]: Uniform2uivEXT (will be remapped) */
+   /* _mesa_function_pool[4745]: Uniform2uivEXT (will be remapped) */
    "iip\0"
    "glUniform2uivEXT\0"
    "glUniform2uiv\0"
    "\0"
-   /* _mesa_function_pool[4759]: ColorFragmentOp2ATI (will be remapped) */
+   /* _mesa_function_pool[4781]: ColorFragmentOp2ATI (will be remapped) */
    "iiiiiiiiii\0"
    "glColorFragmentOp2ATI\0"
    "\0"
-   /* _mesa_function_pool[4793]: TexStorage2D (will be remapped) */
+   /* _mesa_function_pool[4815]: TexStorage2D (will be remapped) */
    "iiiii\0"
    "glTexStorage2D\0"
    "\0"
-   /* _mesa_function_pool[4815]: SecondaryColorPointerListIBM (dynamic) */
+   /* _mesa_function_pool[4837]: SecondaryColorPointerListIBM (dynamic) */
    "iiipi\0"
    "glSecondaryColorPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[4853]: GetPixelTexGenParameterivSGIS (will be remapped) */
+   /* _mesa_function_pool[4875]: GetPixelTexGenParameterivSGIS (will be remapped) */
    "ip\0"
    "glGetPixelTexGenParameterivSGIS\0"
    "\0"
-   /* _mesa_function_pool[4889]: Color3fv (offset 14) */
+   /* _mesa_function_pool[4911]: Color3fv (offset 14) */
    "p\0"
    "glColor3fv\0"
    "\0"
-   /* _mesa_function_pool[4903]: GetnPixelMapfvARB (will be remapped) */
+   /* _mesa_function_pool[4925]: GetnPixelMapfvARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapfvARB\0"
    "\0"
-   /* _mesa_function_pool[4928]: GetnMapdvARB (will be remapped) */
+   /* _mesa_function_pool[4950]: GetnMapdvARB (will be remapped) */
    "iiip\0"
    "glGetnMapdvARB\0"
    "\0"
-   /* _mesa_function_pool[4949]: TextureStorage1DEXT (will be remapped) */
+   /* _mesa_function_pool[4971]: TextureStorage1DEXT (will be remapped) */
    "iiiii\0"
    "glTextureStorage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[4978]: ReplacementCodeubSUN (dynamic) */
+   /* _mesa_function_pool[5000]: ReplacementCodeubSUN (dynamic) */
    "i\0"
    "glReplacementCodeubSUN\0"
    "\0"
-   /* _mesa_function_pool[5004]: FinishAsyncSGIX (dynamic) */
+   /* _mesa_function_pool[5026]: FinishAsyncSGIX (dynamic) */
    "p\0"
    "glFinishAsyncSGIX\0"
    "\0"
-   /* _mesa_function_pool[5025]: VertexAttribP3ui (will be remapped) */
+   /* _mesa_function_pool[5047]: VertexAttribP3ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP3ui\0"
    "\0"
-   /* _mesa_function_pool[5050]: GetDebugLogMESA (dynamic) */
+   /* _mesa_function_pool[5072]: GetDebugLogMESA (dynamic) */
    "iiiipp\0"
    "glGetDebugLogMESA\0"
    "\0"
-   /* _mesa_function_pool[5076]: FogCoorddEXT (will be remapped) */
+   /* _mesa_function_pool[5098]: FogCoorddEXT (will be remapped) */
    "d\0"
    "glFogCoordd\0"
    "glFogCoorddEXT\0"
    "\0"
-   /* _mesa_function_pool[5106]: BeginConditionalRenderNV (will be remapped) */
+   /* _mesa_function_pool[5128]: BeginConditionalRenderNV (will be remapped) */
    "ii\0"
    "glBeginConditionalRender\0"
    "glBeginConditionalRenderNV\0"
    "\0"
-   /* _mesa_function_pool[5162]: Color4ubVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[5184]: Color4ubVertex3fSUN (dynamic) */
    "iiiifff\0"
    "glColor4ubVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[5193]: FogCoordfEXT (will be remapped) */
+   /* _mesa_function_pool[5215]: FogCoordfEXT (will be remapped) */
    "f\0"
    "glFogCoordf\0"
    "glFogCoordfEXT\0"
    "\0"
-   /* _mesa_function_pool[5223]: PointSize (offset 173) */
+   /* _mesa_function_pool[5245]: PointSize (offset 173) */
    "f\0"
    "glPointSize\0"
    "\0"
-   /* _mesa_function_pool[5238]: VertexAttribI2uivEXT (will be remapped) */
+   /* _mesa_function_pool[5260]: VertexAttribI2uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI2uivEXT\0"
    "glVertexAttribI2uiv\0"
    "\0"
-   /* _mesa_function_pool[5285]: TexCoord2fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[5307]: TexCoord2fVertex3fSUN (dynamic) */
    "fffff\0"
    "glTexCoord2fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[5316]: PopName (offset 200) */
+   /* _mesa_function_pool[5338]: PopName (offset 200) */
    "\0"
    "glPopName\0"
    "\0"
-   /* _mesa_function_pool[5328]: GetSamplerParameterfv (will be remapped) */
+   /* _mesa_function_pool[5350]: GetSamplerParameterfv (will be remapped) */
    "iip\0"
    "glGetSamplerParameterfv\0"
    "\0"
-   /* _mesa_function_pool[5357]: GlobalAlphaFactoriSUN (dynamic) */
+   /* _mesa_function_pool[5379]: GlobalAlphaFactoriSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactoriSUN\0"
    "\0"
-   /* _mesa_function_pool[5384]: VertexAttrib2dNV (will be remapped) */
+   /* _mesa_function_pool[5406]: VertexAttrib2dNV (will be remapped) */
    "idd\0"
    "glVertexAttrib2dNV\0"
    "\0"
-   /* _mesa_function_pool[5408]: GetProgramInfoLog (will be remapped) */
+   /* _mesa_function_pool[5430]: GetProgramInfoLog (will be remapped) */
    "iipp\0"
    "glGetProgramInfoLog\0"
    "\0"
-   /* _mesa_function_pool[5434]: VertexP2ui (will be remapped) */
+   /* _mesa_function_pool[5456]: VertexP2ui (will be remapped) */
    "ii\0"
    "glVertexP2ui\0"
    "\0"
-   /* _mesa_function_pool[5451]: VertexAttrib4NbvARB (will be remapped) */
+   /* _mesa_function_pool[5473]: VertexAttrib4NbvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nbv\0"
    "glVertexAttrib4NbvARB\0"
    "\0"
-   /* _mesa_function_pool[5496]: GetActiveAttribARB (will be remapped) */
+   /* _mesa_function_pool[5518]: GetActiveAttribARB (will be remapped) */
    "iiipppp\0"
    "glGetActiveAttrib\0"
    "glGetActiveAttribARB\0"
    "\0"
-   /* _mesa_function_pool[5544]: Vertex4sv (offset 149) */
+   /* _mesa_function_pool[5566]: Vertex4sv (offset 149) */
    "p\0"
    "glVertex4sv\0"
    "\0"
-   /* _mesa_function_pool[5559]: VertexAttrib4ubNV (will be remapped) */
+   /* _mesa_function_pool[5581]: VertexAttrib4ubNV (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4ubNV\0"
    "\0"
-   /* _mesa_function_pool[5586]: VertexAttribI1ivEXT (will be remapped) */
+   /* _mesa_function_pool[5608]: VertexAttribI1ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI1ivEXT\0"
    "glVertexAttribI1iv\0"
    "\0"
-   /* _mesa_function_pool[5631]: ClampColor (will be remapped) */
+   /* _mesa_function_pool[5653]: ClampColor (will be remapped) */
    "ii\0"
    "glClampColor\0"
    "\0"
-   /* _mesa_function_pool[5648]: TextureRangeAPPLE (will be remapped) */
+   /* _mesa_function_pool[5670]: TextureRangeAPPLE (will be remapped) */
    "iip\0"
    "glTextureRangeAPPLE\0"
    "\0"
-   /* _mesa_function_pool[5673]: GetTexEnvfv (offset 276) */
+   /* _mesa_function_pool[5695]: GetTexEnvfv (offset 276) */
    "iip\0"
    "glGetTexEnvfv\0"
    "\0"
-   /* _mesa_function_pool[5692]: BindFragDataLocationIndexed (will be remapped) */
+   /* _mesa_function_pool[5714]: BindFragDataLocationIndexed (will be remapped) */
    "iiip\0"
    "glBindFragDataLocationIndexed\0"
    "\0"
-   /* _mesa_function_pool[5728]: BindTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[5750]: BindTransformFeedback (will be remapped) */
    "ii\0"
    "glBindTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[5756]: TextureStorage2DEXT (will be remapped) */
+   /* _mesa_function_pool[5778]: TextureStorage2DEXT (will be remapped) */
    "iiiiii\0"
    "glTextureStorage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[5786]: Indexub (offset 315) */
+   /* _mesa_function_pool[5808]: Indexub (offset 315) */
    "i\0"
    "glIndexub\0"
    "\0"
-   /* _mesa_function_pool[5799]: VertexAttrib4fNV (will be remapped) */
+   /* _mesa_function_pool[5821]: VertexAttrib4fNV (will be remapped) */
    "iffff\0"
    "glVertexAttrib4fNV\0"
    "\0"
-   /* _mesa_function_pool[5825]: GetTransformFeedbackVaryingEXT (will be remapped) */
+   /* _mesa_function_pool[5847]: GetTransformFeedbackVaryingEXT (will be remapped) */
    "iiipppp\0"
    "glGetTransformFeedbackVarying\0"
    "glGetTransformFeedbackVaryingEXT\0"
    "\0"
-   /* _mesa_function_pool[5897]: TexEnvi (offset 186) */
+   /* _mesa_function_pool[5919]: TexEnvi (offset 186) */
    "iii\0"
    "glTexEnvi\0"
    "\0"
-   /* _mesa_function_pool[5912]: GetClipPlane (offset 259) */
+   /* _mesa_function_pool[5934]: GetClipPlane (offset 259) */
    "ip\0"
    "glGetClipPlane\0"
    "\0"
-   /* _mesa_function_pool[5931]: CombinerParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[5953]: CombinerParameterfvNV (will be remapped) */
    "ip\0"
    "glCombinerParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[5959]: TexCoordP4uiv (will be remapped) */
+   /* _mesa_function_pool[5981]: TexCoordP4uiv (will be remapped) */
    "ip\0"
    "glTexCoordP4uiv\0"
    "\0"
-   /* _mesa_function_pool[5979]: VertexAttribs3dvNV (will be remapped) */
+   /* _mesa_function_pool[6001]: VertexAttribs3dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs3dvNV\0"
    "\0"
-   /* _mesa_function_pool[6005]: VertexAttribI2uiEXT (will be remapped) */
+   /* _mesa_function_pool[6027]: VertexAttribI2uiEXT (will be remapped) */
    "iii\0"
    "glVertexAttribI2uiEXT\0"
    "glVertexAttribI2ui\0"
    "\0"
-   /* _mesa_function_pool[6051]: VertexAttribs4fvNV (will be remapped) */
+   /* _mesa_function_pool[6073]: VertexAttribs4fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4fvNV\0"
    "\0"
-   /* _mesa_function_pool[6077]: VertexArrayRangeNV (will be remapped) */
+   /* _mesa_function_pool[6099]: VertexArrayRangeNV (will be remapped) */
    "ip\0"
    "glVertexArrayRangeNV\0"
    "\0"
-   /* _mesa_function_pool[6102]: FragmentLightiSGIX (dynamic) */
+   /* _mesa_function_pool[6124]: FragmentLightiSGIX (dynamic) */
    "iii\0"
    "glFragmentLightiSGIX\0"
    "\0"
-   /* _mesa_function_pool[6128]: PolygonOffsetEXT (will be remapped) */
+   /* _mesa_function_pool[6150]: PolygonOffsetEXT (will be remapped) */
    "ff\0"
    "glPolygonOffsetEXT\0"
    "\0"
-   /* _mesa_function_pool[6151]: VertexAttribI4uivEXT (will be remapped) */
+   /* _mesa_function_pool[6173]: VertexAttribI4uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4uivEXT\0"
    "glVertexAttribI4uiv\0"
    "\0"
-   /* _mesa_function_pool[6198]: PollAsyncSGIX (dynamic) */
+   /* _mesa_function_pool[6220]: PollAsyncSGIX (dynamic) */
    "p\0"
    "glPollAsyncSGIX\0"
    "\0"
-   /* _mesa_function_pool[6217]: DeleteFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[6239]: DeleteFragmentShaderATI (will be remapped) */
    "i\0"
    "glDeleteFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[6246]: Scaled (offset 301) */
+   /* _mesa_function_pool[6268]: Scaled (offset 301) */
    "ddd\0"
    "glScaled\0"
    "\0"
-   /* _mesa_function_pool[6260]: ResumeTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[6282]: ResumeTransformFeedback (will be remapped) */
    "\0"
    "glResumeTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[6288]: Scalef (offset 302) */
+   /* _mesa_function_pool[6310]: Scalef (offset 302) */
    "fff\0"
    "glScalef\0"
    "\0"
-   /* _mesa_function_pool[6302]: TexCoord2fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[6324]: TexCoord2fNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glTexCoord2fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[6340]: ProgramEnvParameters4fvEXT (will be remapped) */
+   /* _mesa_function_pool[6362]: ProgramEnvParameters4fvEXT (will be remapped) */
    "iiip\0"
    "glProgramEnvParameters4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[6375]: MultTransposeMatrixdARB (will be remapped) */
+   /* _mesa_function_pool[6397]: MultTransposeMatrixdARB (will be remapped) */
    "p\0"
    "glMultTransposeMatrixd\0"
    "glMultTransposeMatrixdARB\0"
    "\0"
-   /* _mesa_function_pool[6427]: ObjectUnpurgeableAPPLE (will be remapped) */
+   /* _mesa_function_pool[6449]: ObjectUnpurgeableAPPLE (will be remapped) */
    "iii\0"
    "glObjectUnpurgeableAPPLE\0"
    "\0"
-   /* _mesa_function_pool[6457]: AlphaFunc (offset 240) */
+   /* _mesa_function_pool[6479]: AlphaFunc (offset 240) */
    "if\0"
    "glAlphaFunc\0"
    "\0"
-   /* _mesa_function_pool[6473]: WindowPos2svMESA (will be remapped) */
+   /* _mesa_function_pool[6495]: WindowPos2svMESA (will be remapped) */
    "p\0"
    "glWindowPos2sv\0"
    "glWindowPos2svARB\0"
    "glWindowPos2svMESA\0"
    "\0"
-   /* _mesa_function_pool[6528]: EdgeFlag (offset 41) */
+   /* _mesa_function_pool[6550]: EdgeFlag (offset 41) */
    "i\0"
    "glEdgeFlag\0"
    "\0"
-   /* _mesa_function_pool[6542]: TexCoord2iv (offset 107) */
+   /* _mesa_function_pool[6564]: TexCoord2iv (offset 107) */
    "p\0"
    "glTexCoord2iv\0"
    "\0"
-   /* _mesa_function_pool[6559]: CompressedTexImage1DARB (will be remapped) */
+   /* _mesa_function_pool[6581]: CompressedTexImage1DARB (will be remapped) */
    "iiiiiip\0"
    "glCompressedTexImage1D\0"
    "glCompressedTexImage1DARB\0"
    "\0"
-   /* _mesa_function_pool[6617]: Rotated (offset 299) */
+   /* _mesa_function_pool[6639]: Rotated (offset 299) */
    "dddd\0"
    "glRotated\0"
    "\0"
-   /* _mesa_function_pool[6633]: GetTexParameterIuivEXT (will be remapped) */
+   /* _mesa_function_pool[6655]: GetTexParameterIuivEXT (will be remapped) */
    "iip\0"
    "glGetTexParameterIuivEXT\0"
    "glGetTexParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[6685]: VertexAttrib2sNV (will be remapped) */
+   /* _mesa_function_pool[6707]: VertexAttrib2sNV (will be remapped) */
    "iii\0"
    "glVertexAttrib2sNV\0"
    "\0"
-   /* _mesa_function_pool[6709]: BindBufferBaseEXT (will be remapped) */
+   /* _mesa_function_pool[6731]: BindBufferBaseEXT (will be remapped) */
    "iii\0"
    "glBindBufferBase\0"
    "glBindBufferBaseEXT\0"
    "\0"
-   /* _mesa_function_pool[6751]: ReadPixels (offset 256) */
+   /* _mesa_function_pool[6773]: ReadPixels (offset 256) */
    "iiiiiip\0"
    "glReadPixels\0"
    "\0"
-   /* _mesa_function_pool[6773]: EdgeFlagv (offset 42) */
+   /* _mesa_function_pool[6795]: EdgeFlagv (offset 42) */
    "p\0"
    "glEdgeFlagv\0"
    "\0"
-   /* _mesa_function_pool[6788]: NormalPointerListIBM (dynamic) */
+   /* _mesa_function_pool[6810]: NormalPointerListIBM (dynamic) */
    "iipi\0"
    "glNormalPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[6817]: IndexPointerEXT (will be remapped) */
+   /* _mesa_function_pool[6839]: IndexPointerEXT (will be remapped) */
    "iiip\0"
    "glIndexPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[6841]: Color4iv (offset 32) */
+   /* _mesa_function_pool[6863]: Color4iv (offset 32) */
    "p\0"
    "glColor4iv\0"
    "\0"
-   /* _mesa_function_pool[6855]: TexParameterf (offset 178) */
+   /* _mesa_function_pool[6877]: TexParameterf (offset 178) */
    "iif\0"
    "glTexParameterf\0"
    "\0"
-   /* _mesa_function_pool[6876]: TexParameteri (offset 180) */
+   /* _mesa_function_pool[6898]: TexParameteri (offset 180) */
    "iii\0"
    "glTexParameteri\0"
    "\0"
-   /* _mesa_function_pool[6897]: NormalPointerEXT (will be remapped) */
+   /* _mesa_function_pool[6919]: NormalPointerEXT (will be remapped) */
    "iiip\0"
    "glNormalPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[6922]: MultiTexCoord3dARB (offset 392) */
+   /* _mesa_function_pool[6944]: MultiTexCoord3dARB (offset 392) */
    "iddd\0"
    "glMultiTexCoord3d\0"
    "glMultiTexCoord3dARB\0"
    "\0"
-   /* _mesa_function_pool[6967]: MultiTexCoord2iARB (offset 388) */
+   /* _mesa_function_pool[6989]: MultiTexCoord2iARB (offset 388) */
    "iii\0"
    "glMultiTexCoord2i\0"
    "glMultiTexCoord2iARB\0"
    "\0"
-   /* _mesa_function_pool[7011]: DrawPixels (offset 257) */
+   /* _mesa_function_pool[7033]: DrawPixels (offset 257) */
    "iiiip\0"
    "glDrawPixels\0"
    "\0"
-   /* _mesa_function_pool[7031]: ReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[7053]: ReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (dynamic) */
    "iffffffff\0"
    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[7091]: MultiTexCoord2svARB (offset 391) */
+   /* _mesa_function_pool[7113]: MultiTexCoord2svARB (offset 391) */
    "ip\0"
    "glMultiTexCoord2sv\0"
    "glMultiTexCoord2svARB\0"
    "\0"
-   /* _mesa_function_pool[7136]: ReplacementCodeubvSUN (dynamic) */
+   /* _mesa_function_pool[7158]: ReplacementCodeubvSUN (dynamic) */
    "p\0"
    "glReplacementCodeubvSUN\0"
    "\0"
-   /* _mesa_function_pool[7163]: Uniform3iARB (will be remapped) */
+   /* _mesa_function_pool[7185]: Uniform3iARB (will be remapped) */
    "iiii\0"
    "glUniform3i\0"
    "glUniform3iARB\0"
    "\0"
-   /* _mesa_function_pool[7196]: DrawTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[7218]: DrawTransformFeedback (will be remapped) */
    "ii\0"
    "glDrawTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[7224]: DrawElementsInstancedARB (will be remapped) */
+   /* _mesa_function_pool[7246]: DrawElementsInstancedARB (will be remapped) */
    "iiipi\0"
    "glDrawElementsInstancedARB\0"
    "glDrawElementsInstancedEXT\0"
    "glDrawElementsInstanced\0"
    "\0"
-   /* _mesa_function_pool[7309]: VertexAttribI1iEXT (will be remapped) */
+   /* _mesa_function_pool[7331]: VertexAttribI1iEXT (will be remapped) */
    "ii\0"
    "glVertexAttribI1iEXT\0"
    "glVertexAttribI1i\0"
    "\0"
-   /* _mesa_function_pool[7352]: GetShaderInfoLog (will be remapped) */
+   /* _mesa_function_pool[7374]: GetShaderInfoLog (will be remapped) */
    "iipp\0"
    "glGetShaderInfoLog\0"
    "\0"
-   /* _mesa_function_pool[7377]: GetCombinerInputParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[7399]: GetCombinerInputParameterfvNV (will be remapped) */
    "iiiip\0"
    "glGetCombinerInputParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[7416]: WeightivARB (dynamic) */
+   /* _mesa_function_pool[7438]: WeightivARB (dynamic) */
    "ip\0"
    "glWeightivARB\0"
    "\0"
-   /* _mesa_function_pool[7434]: PollInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[7456]: PollInstrumentsSGIX (dynamic) */
    "p\0"
    "glPollInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[7459]: GlobalAlphaFactordSUN (dynamic) */
+   /* _mesa_function_pool[7481]: GlobalAlphaFactordSUN (dynamic) */
    "d\0"
    "glGlobalAlphaFactordSUN\0"
    "\0"
-   /* _mesa_function_pool[7486]: GetFinalCombinerInputParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[7508]: GetFinalCombinerInputParameterfvNV (will be remapped) */
    "iip\0"
    "glGetFinalCombinerInputParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[7528]: GenerateMipmapEXT (will be remapped) */
+   /* _mesa_function_pool[7550]: GenerateMipmapEXT (will be remapped) */
    "i\0"
    "glGenerateMipmap\0"
    "glGenerateMipmapEXT\0"
    "\0"
-   /* _mesa_function_pool[7568]: GenLists (offset 5) */
+   /* _mesa_function_pool[7590]: GenLists (offset 5) */
    "i\0"
    "glGenLists\0"
    "\0"
-   /* _mesa_function_pool[7582]: DepthRangef (will be remapped) */
+   /* _mesa_function_pool[7604]: DepthRangef (will be remapped) */
    "ff\0"
    "glDepthRangef\0"
    "\0"
-   /* _mesa_function_pool[7600]: GetMapAttribParameterivNV (dynamic) */
+   /* _mesa_function_pool[7622]: GetMapAttribParameterivNV (dynamic) */
    "iiip\0"
    "glGetMapAttribParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[7634]: CreateShaderObjectARB (will be remapped) */
+   /* _mesa_function_pool[7656]: CreateShaderObjectARB (will be remapped) */
    "i\0"
    "glCreateShaderObjectARB\0"
    "\0"
-   /* _mesa_function_pool[7661]: GetSharpenTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[7683]: GetSharpenTexFuncSGIS (dynamic) */
    "ip\0"
    "glGetSharpenTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[7689]: BufferDataARB (will be remapped) */
+   /* _mesa_function_pool[7711]: BufferDataARB (will be remapped) */
    "iipi\0"
    "glBufferData\0"
    "glBufferDataARB\0"
    "\0"
-   /* _mesa_function_pool[7724]: FlushVertexArrayRangeNV (will be remapped) */
+   /* _mesa_function_pool[7746]: FlushVertexArrayRangeNV (will be remapped) */
    "\0"
    "glFlushVertexArrayRangeNV\0"
    "\0"
-   /* _mesa_function_pool[7752]: MapGrid2d (offset 226) */
+   /* _mesa_function_pool[7774]: MapGrid2d (offset 226) */
    "iddidd\0"
    "glMapGrid2d\0"
    "\0"
-   /* _mesa_function_pool[7772]: MapGrid2f (offset 227) */
+   /* _mesa_function_pool[7794]: MapGrid2f (offset 227) */
    "iffiff\0"
    "glMapGrid2f\0"
    "\0"
-   /* _mesa_function_pool[7792]: SampleMapATI (will be remapped) */
+   /* _mesa_function_pool[7814]: SampleMapATI (will be remapped) */
    "iii\0"
    "glSampleMapATI\0"
    "\0"
-   /* _mesa_function_pool[7812]: VertexPointerEXT (will be remapped) */
+   /* _mesa_function_pool[7834]: VertexPointerEXT (will be remapped) */
    "iiiip\0"
    "glVertexPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[7838]: GetTexFilterFuncSGIS (dynamic) */
+   /* _mesa_function_pool[7860]: GetTexFilterFuncSGIS (dynamic) */
    "iip\0"
    "glGetTexFilterFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[7866]: Scissor (offset 176) */
+   /* _mesa_function_pool[7888]: Scissor (offset 176) */
    "iiii\0"
    "glScissor\0"
    "\0"
-   /* _mesa_function_pool[7882]: Fogf (offset 153) */
+   /* _mesa_function_pool[7904]: Fogf (offset 153) */
    "if\0"
    "glFogf\0"
    "\0"
-   /* _mesa_function_pool[7893]: ReplacementCodeuiColor4ubVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[7915]: ReplacementCodeuiColor4ubVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiColor4ubVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[7938]: TexSubImage1D (offset 332) */
+   /* _mesa_function_pool[7960]: TexSubImage1D (offset 332) */
    "iiiiiip\0"
    "glTexSubImage1D\0"
    "glTexSubImage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[7982]: VertexAttrib1sARB (will be remapped) */
+   /* _mesa_function_pool[8004]: VertexAttrib1sARB (will be remapped) */
    "ii\0"
    "glVertexAttrib1s\0"
    "glVertexAttrib1sARB\0"
    "\0"
-   /* _mesa_function_pool[8023]: FenceSync (will be remapped) */
+   /* _mesa_function_pool[8045]: FenceSync (will be remapped) */
    "ii\0"
    "glFenceSync\0"
    "\0"
-   /* _mesa_function_pool[8039]: Color4usv (offset 40) */
+   /* _mesa_function_pool[8061]: Color4usv (offset 40) */
    "p\0"
    "glColor4usv\0"
    "\0"
-   /* _mesa_function_pool[8054]: GetnUniformfvARB (will be remapped) */
+   /* _mesa_function_pool[8076]: GetnUniformfvARB (will be remapped) */
    "iiip\0"
    "glGetnUniformfvARB\0"
    "\0"
-   /* _mesa_function_pool[8079]: Fogi (offset 155) */
+   /* _mesa_function_pool[8101]: Fogi (offset 155) */
    "ii\0"
    "glFogi\0"
    "\0"
-   /* _mesa_function_pool[8090]: DepthRange (offset 288) */
+   /* _mesa_function_pool[8112]: DepthRange (offset 288) */
    "dd\0"
    "glDepthRange\0"
    "\0"
-   /* _mesa_function_pool[8107]: RasterPos3iv (offset 75) */
+   /* _mesa_function_pool[8129]: RasterPos3iv (offset 75) */
    "p\0"
    "glRasterPos3iv\0"
    "\0"
-   /* _mesa_function_pool[8125]: FinalCombinerInputNV (will be remapped) */
+   /* _mesa_function_pool[8147]: FinalCombinerInputNV (will be remapped) */
    "iiii\0"
    "glFinalCombinerInputNV\0"
    "\0"
-   /* _mesa_function_pool[8154]: TexCoord2i (offset 106) */
+   /* _mesa_function_pool[8176]: TexCoord2i (offset 106) */
    "ii\0"
    "glTexCoord2i\0"
    "\0"
-   /* _mesa_function_pool[8171]: PixelMapfv (offset 251) */
+   /* _mesa_function_pool[8193]: PixelMapfv (offset 251) */
    "iip\0"
    "glPixelMapfv\0"
    "\0"
-   /* _mesa_function_pool[8189]: Color4ui (offset 37) */
+   /* _mesa_function_pool[8211]: Color4ui (offset 37) */
    "iiii\0"
    "glColor4ui\0"
    "\0"
-   /* _mesa_function_pool[8206]: RasterPos3s (offset 76) */
+   /* _mesa_function_pool[8228]: RasterPos3s (offset 76) */
    "iii\0"
    "glRasterPos3s\0"
    "\0"
-   /* _mesa_function_pool[8225]: Color3usv (offset 24) */
+   /* _mesa_function_pool[8247]: Color3usv (offset 24) */
    "p\0"
    "glColor3usv\0"
    "\0"
-   /* _mesa_function_pool[8240]: FlushRasterSGIX (dynamic) */
+   /* _mesa_function_pool[8262]: FlushRasterSGIX (dynamic) */
    "\0"
    "glFlushRasterSGIX\0"
    "\0"
-   /* _mesa_function_pool[8260]: TexCoord2f (offset 104) */
+   /* _mesa_function_pool[8282]: TexCoord2f (offset 104) */
    "ff\0"
    "glTexCoord2f\0"
    "\0"
-   /* _mesa_function_pool[8277]: ReplacementCodeuiTexCoord2fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[8299]: ReplacementCodeuiTexCoord2fVertex3fSUN (dynamic) */
    "ifffff\0"
    "glReplacementCodeuiTexCoord2fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[8326]: TexCoord2d (offset 102) */
+   /* _mesa_function_pool[8348]: TexCoord2d (offset 102) */
    "dd\0"
    "glTexCoord2d\0"
    "\0"
-   /* _mesa_function_pool[8343]: RasterPos3d (offset 70) */
+   /* _mesa_function_pool[8365]: RasterPos3d (offset 70) */
    "ddd\0"
    "glRasterPos3d\0"
    "\0"
-   /* _mesa_function_pool[8362]: RasterPos3f (offset 72) */
+   /* _mesa_function_pool[8384]: RasterPos3f (offset 72) */
    "fff\0"
    "glRasterPos3f\0"
    "\0"
-   /* _mesa_function_pool[8381]: Uniform1fARB (will be remapped) */
+   /* _mesa_function_pool[8403]: Uniform1fARB (will be remapped) */
    "if\0"
    "glUniform1f\0"
    "glUniform1fARB\0"
    "\0"
-   /* _mesa_function_pool[8412]: AreTexturesResident (offset 322) */
+   /* _mesa_function_pool[8434]: AreTexturesResident (offset 322) */
    "ipp\0"
    "glAreTexturesResident\0"
    "glAreTexturesResidentEXT\0"
    "\0"
-   /* _mesa_function_pool[8464]: TexCoord2s (offset 108) */
+   /* _mesa_function_pool[8486]: TexCoord2s (offset 108) */
    "ii\0"
    "glTexCoord2s\0"
    "\0"
-   /* _mesa_function_pool[8481]: StencilOpSeparate (will be remapped) */
+   /* _mesa_function_pool[8503]: StencilOpSeparate (will be remapped) */
    "iiii\0"
    "glStencilOpSeparate\0"
    "glStencilOpSeparateATI\0"
    "\0"
-   /* _mesa_function_pool[8530]: ColorTableParameteriv (offset 341) */
+   /* _mesa_function_pool[8552]: ColorTableParameteriv (offset 341) */
    "iip\0"
    "glColorTableParameteriv\0"
    "glColorTableParameterivSGI\0"
    "\0"
-   /* _mesa_function_pool[8586]: VertexAttribP2ui (will be remapped) */
+   /* _mesa_function_pool[8608]: VertexAttribP2ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP2ui\0"
    "\0"
-   /* _mesa_function_pool[8611]: WindowPos3dMESA (will be remapped) */
+   /* _mesa_function_pool[8633]: WindowPos3dMESA (will be remapped) */
    "ddd\0"
    "glWindowPos3d\0"
    "glWindowPos3dARB\0"
    "glWindowPos3dMESA\0"
    "\0"
-   /* _mesa_function_pool[8665]: Color4us (offset 39) */
+   /* _mesa_function_pool[8687]: Color4us (offset 39) */
    "iiii\0"
    "glColor4us\0"
    "\0"
-   /* _mesa_function_pool[8682]: PointParameterfvEXT (will be remapped) */
+   /* _mesa_function_pool[8704]: PointParameterfvEXT (will be remapped) */
    "ip\0"
    "glPointParameterfv\0"
    "glPointParameterfvARB\0"
    "glPointParameterfvEXT\0"
    "glPointParameterfvSGIS\0"
    "\0"
-   /* _mesa_function_pool[8772]: Color3bv (offset 10) */
+   /* _mesa_function_pool[8794]: Color3bv (offset 10) */
    "p\0"
    "glColor3bv\0"
    "\0"
-   /* _mesa_function_pool[8786]: GetnCompressedTexImageARB (will be remapped) */
+   /* _mesa_function_pool[8808]: GetnCompressedTexImageARB (will be remapped) */
    "iiip\0"
    "glGetnCompressedTexImageARB\0"
    "\0"
-   /* _mesa_function_pool[8820]: WindowPos2fvMESA (will be remapped) */
+   /* _mesa_function_pool[8842]: WindowPos2fvMESA (will be remapped) */
    "p\0"
    "glWindowPos2fv\0"
    "glWindowPos2fvARB\0"
    "glWindowPos2fvMESA\0"
    "\0"
-   /* _mesa_function_pool[8875]: SecondaryColor3bvEXT (will be remapped) */
+   /* _mesa_function_pool[8897]: SecondaryColor3bvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3bv\0"
    "glSecondaryColor3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[8921]: VertexPointerListIBM (dynamic) */
+   /* _mesa_function_pool[8943]: VertexPointerListIBM (dynamic) */
    "iiipi\0"
    "glVertexPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[8951]: GetProgramLocalParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[8973]: GetProgramLocalParameterfvARB (will be remapped) */
    "iip\0"
    "glGetProgramLocalParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[8988]: FragmentMaterialfSGIX (dynamic) */
+   /* _mesa_function_pool[9010]: FragmentMaterialfSGIX (dynamic) */
    "iif\0"
    "glFragmentMaterialfSGIX\0"
    "\0"
-   /* _mesa_function_pool[9017]: BindSampler (will be remapped) */
+   /* _mesa_function_pool[9039]: BindSampler (will be remapped) */
    "ii\0"
    "glBindSampler\0"
    "\0"
-   /* _mesa_function_pool[9035]: RenderbufferStorageEXT (will be remapped) */
+   /* _mesa_function_pool[9057]: RenderbufferStorageEXT (will be remapped) */
    "iiii\0"
    "glRenderbufferStorage\0"
    "glRenderbufferStorageEXT\0"
    "\0"
-   /* _mesa_function_pool[9088]: IsFenceNV (will be remapped) */
+   /* _mesa_function_pool[9110]: IsFenceNV (will be remapped) */
    "i\0"
    "glIsFenceNV\0"
    "\0"
-   /* _mesa_function_pool[9103]: AlphaFragmentOp2ATI (will be remapped) */
+   /* _mesa_function_pool[9125]: AlphaFragmentOp2ATI (will be remapped) */
    "iiiiiiiii\0"
    "glAlphaFragmentOp2ATI\0"
    "\0"
-   /* _mesa_function_pool[9136]: AttachObjectARB (will be remapped) */
+   /* _mesa_function_pool[9158]: AttachObjectARB (will be remapped) */
    "ii\0"
    "glAttachObjectARB\0"
    "\0"
-   /* _mesa_function_pool[9158]: GetFragmentLightivSGIX (dynamic) */
+   /* _mesa_function_pool[9180]: GetFragmentLightivSGIX (dynamic) */
    "iip\0"
    "glGetFragmentLightivSGIX\0"
    "\0"
-   /* _mesa_function_pool[9188]: UniformMatrix2fvARB (will be remapped) */
+   /* _mesa_function_pool[9210]: UniformMatrix2fvARB (will be remapped) */
    "iiip\0"
    "glUniformMatrix2fv\0"
    "glUniformMatrix2fvARB\0"
    "\0"
-   /* _mesa_function_pool[9235]: MultiTexCoord2fARB (offset 386) */
+   /* _mesa_function_pool[9257]: MultiTexCoord2fARB (offset 386) */
    "iff\0"
    "glMultiTexCoord2f\0"
    "glMultiTexCoord2fARB\0"
    "\0"
-   /* _mesa_function_pool[9279]: ColorTable (offset 339) */
+   /* _mesa_function_pool[9301]: ColorTable (offset 339) */
    "iiiiip\0"
    "glColorTable\0"
    "glColorTableSGI\0"
    "glColorTableEXT\0"
    "\0"
-   /* _mesa_function_pool[9332]: IndexPointer (offset 314) */
+   /* _mesa_function_pool[9354]: IndexPointer (offset 314) */
    "iip\0"
    "glIndexPointer\0"
    "\0"
-   /* _mesa_function_pool[9352]: Accum (offset 213) */
+   /* _mesa_function_pool[9374]: Accum (offset 213) */
    "if\0"
    "glAccum\0"
    "\0"
-   /* _mesa_function_pool[9364]: GetTexImage (offset 281) */
+   /* _mesa_function_pool[9386]: GetTexImage (offset 281) */
    "iiiip\0"
    "glGetTexImage\0"
    "\0"
-   /* _mesa_function_pool[9385]: MapControlPointsNV (dynamic) */
+   /* _mesa_function_pool[9407]: MapControlPointsNV (dynamic) */
    "iiiiiiiip\0"
    "glMapControlPointsNV\0"
    "\0"
-   /* _mesa_function_pool[9417]: ConvolutionFilter2D (offset 349) */
+   /* _mesa_function_pool[9439]: ConvolutionFilter2D (offset 349) */
    "iiiiiip\0"
    "glConvolutionFilter2D\0"
    "glConvolutionFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[9473]: Finish (offset 216) */
+   /* _mesa_function_pool[9495]: Finish (offset 216) */
    "\0"
    "glFinish\0"
    "\0"
-   /* _mesa_function_pool[9484]: MapParameterfvNV (dynamic) */
+   /* _mesa_function_pool[9506]: MapParameterfvNV (dynamic) */
    "iip\0"
    "glMapParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[9508]: ClearStencil (offset 207) */
+   /* _mesa_function_pool[9530]: ClearStencil (offset 207) */
    "i\0"
    "glClearStencil\0"
    "\0"
-   /* _mesa_function_pool[9526]: VertexAttrib3dvARB (will be remapped) */
+   /* _mesa_function_pool[9548]: VertexAttrib3dvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib3dv\0"
    "glVertexAttrib3dvARB\0"
    "\0"
-   /* _mesa_function_pool[9569]: Uniform4uivEXT (will be remapped) */
+   /* _mesa_function_pool[9591]: Uniform4uivEXT (will be remapped) */
    "iip\0"
    "glUniform4uivEXT\0"
    "glUniform4uiv\0"
    "\0"
-   /* _mesa_function_pool[9605]: HintPGI (dynamic) */
+   /* _mesa_function_pool[9627]: HintPGI (dynamic) */
    "ii\0"
    "glHintPGI\0"
    "\0"
-   /* _mesa_function_pool[9619]: ConvolutionParameteriv (offset 353) */
+   /* _mesa_function_pool[9641]: ConvolutionParameteriv (offset 353) */
    "iip\0"
    "glConvolutionParameteriv\0"
    "glConvolutionParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[9677]: Color4s (offset 33) */
+   /* _mesa_function_pool[9699]: Color4s (offset 33) */
    "iiii\0"
    "glColor4s\0"
    "\0"
-   /* _mesa_function_pool[9693]: InterleavedArrays (offset 317) */
+   /* _mesa_function_pool[9715]: InterleavedArrays (offset 317) */
    "iip\0"
    "glInterleavedArrays\0"
    "\0"
-   /* _mesa_function_pool[9718]: RasterPos2fv (offset 65) */
+   /* _mesa_function_pool[9740]: RasterPos2fv (offset 65) */
    "p\0"
    "glRasterPos2fv\0"
    "\0"
-   /* _mesa_function_pool[9736]: TexCoord1fv (offset 97) */
+   /* _mesa_function_pool[9758]: TexCoord1fv (offset 97) */
    "p\0"
    "glTexCoord1fv\0"
    "\0"
-   /* _mesa_function_pool[9753]: Vertex2d (offset 126) */
+   /* _mesa_function_pool[9775]: Vertex2d (offset 126) */
    "dd\0"
    "glVertex2d\0"
    "\0"
-   /* _mesa_function_pool[9768]: CullParameterdvEXT (dynamic) */
+   /* _mesa_function_pool[9790]: CullParameterdvEXT (dynamic) */
    "ip\0"
    "glCullParameterdvEXT\0"
    "\0"
-   /* _mesa_function_pool[9793]: ProgramNamedParameter4fNV (will be remapped) */
+   /* _mesa_function_pool[9815]: ProgramNamedParameter4fNV (will be remapped) */
    "iipffff\0"
    "glProgramNamedParameter4fNV\0"
    "\0"
-   /* _mesa_function_pool[9830]: Color3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[9852]: Color3fVertex3fSUN (dynamic) */
    "ffffff\0"
    "glColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[9859]: ProgramEnvParameter4fvARB (will be remapped) */
+   /* _mesa_function_pool[9881]: ProgramEnvParameter4fvARB (will be remapped) */
    "iip\0"
    "glProgramEnvParameter4fvARB\0"
    "glProgramParameter4fvNV\0"
    "\0"
-   /* _mesa_function_pool[9916]: Color4i (offset 31) */
+   /* _mesa_function_pool[9938]: Color4i (offset 31) */
    "iiii\0"
    "glColor4i\0"
    "\0"
-   /* _mesa_function_pool[9932]: Color4f (offset 29) */
+   /* _mesa_function_pool[9954]: Color4f (offset 29) */
    "ffff\0"
    "glColor4f\0"
    "\0"
-   /* _mesa_function_pool[9948]: RasterPos4fv (offset 81) */
+   /* _mesa_function_pool[9970]: RasterPos4fv (offset 81) */
    "p\0"
    "glRasterPos4fv\0"
    "\0"
-   /* _mesa_function_pool[9966]: Color4d (offset 27) */
+   /* _mesa_function_pool[9988]: Color4d (offset 27) */
    "dddd\0"
    "glColor4d\0"
    "\0"
-   /* _mesa_function_pool[9982]: ClearIndex (offset 205) */
+   /* _mesa_function_pool[10004]: ClearIndex (offset 205) */
    "f\0"
    "glClearIndex\0"
    "\0"
-   /* _mesa_function_pool[9998]: Color4b (offset 25) */
+   /* _mesa_function_pool[10020]: Color4b (offset 25) */
    "iiii\0"
    "glColor4b\0"
    "\0"
-   /* _mesa_function_pool[10014]: LoadMatrixd (offset 292) */
+   /* _mesa_function_pool[10036]: LoadMatrixd (offset 292) */
    "p\0"
    "glLoadMatrixd\0"
    "\0"
-   /* _mesa_function_pool[10031]: FragmentLightModeliSGIX (dynamic) */
+   /* _mesa_function_pool[10053]: FragmentLightModeliSGIX (dynamic) */
    "ii\0"
    "glFragmentLightModeliSGIX\0"
    "\0"
-   /* _mesa_function_pool[10061]: RasterPos2dv (offset 63) */
+   /* _mesa_function_pool[10083]: RasterPos2dv (offset 63) */
    "p\0"
    "glRasterPos2dv\0"
    "\0"
-   /* _mesa_function_pool[10079]: ConvolutionParameterfv (offset 351) */
+   /* _mesa_function_pool[10101]: ConvolutionParameterfv (offset 351) */
    "iip\0"
    "glConvolutionParameterfv\0"
    "glConvolutionParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[10137]: TbufferMask3DFX (dynamic) */
+   /* _mesa_function_pool[10159]: TbufferMask3DFX (dynamic) */
    "i\0"
    "glTbufferMask3DFX\0"
    "\0"
-   /* _mesa_function_pool[10158]: GetTexGendv (offset 278) */
+   /* _mesa_function_pool[10180]: GetTexGendv (offset 278) */
    "iip\0"
    "glGetTexGendv\0"
    "\0"
-   /* _mesa_function_pool[10177]: ColorMaskIndexedEXT (will be remapped) */
+   /* _mesa_function_pool[10199]: ColorMaskIndexedEXT (will be remapped) */
    "iiiii\0"
    "glColorMaskIndexedEXT\0"
    "glColorMaski\0"
    "\0"
-   /* _mesa_function_pool[10219]: GetFragDataLocationEXT (will be remapped) */
+   /* _mesa_function_pool[10241]: GetFragDataLocationEXT (will be remapped) */
    "ip\0"
    "glGetFragDataLocationEXT\0"
    "glGetFragDataLocation\0"
    "\0"
-   /* _mesa_function_pool[10270]: LoadProgramNV (will be remapped) */
+   /* _mesa_function_pool[10292]: LoadProgramNV (will be remapped) */
    "iiip\0"
    "glLoadProgramNV\0"
    "\0"
-   /* _mesa_function_pool[10292]: WaitSync (will be remapped) */
+   /* _mesa_function_pool[10314]: WaitSync (will be remapped) */
    "iii\0"
    "glWaitSync\0"
    "\0"
-   /* _mesa_function_pool[10308]: EndList (offset 1) */
+   /* _mesa_function_pool[10330]: EndList (offset 1) */
    "\0"
    "glEndList\0"
    "\0"
-   /* _mesa_function_pool[10320]: VertexP4ui (will be remapped) */
+   /* _mesa_function_pool[10342]: VertexP4ui (will be remapped) */
    "ii\0"
    "glVertexP4ui\0"
    "\0"
-   /* _mesa_function_pool[10337]: MultiTexCoordP1ui (will be remapped) */
+   /* _mesa_function_pool[10359]: MultiTexCoordP1ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP1ui\0"
    "\0"
-   /* _mesa_function_pool[10362]: GetAttachedObjectsARB (will be remapped) */
+   /* _mesa_function_pool[10384]: GetAttachedObjectsARB (will be remapped) */
    "iipp\0"
    "glGetAttachedObjectsARB\0"
    "\0"
-   /* _mesa_function_pool[10392]: Uniform3fvARB (will be remapped) */
+   /* _mesa_function_pool[10414]: Uniform3fvARB (will be remapped) */
    "iip\0"
    "glUniform3fv\0"
    "glUniform3fvARB\0"
    "\0"
-   /* _mesa_function_pool[10426]: EvalCoord1fv (offset 231) */
+   /* _mesa_function_pool[10448]: EvalCoord1fv (offset 231) */
    "p\0"
    "glEvalCoord1fv\0"
    "\0"
-   /* _mesa_function_pool[10444]: DrawRangeElements (offset 338) */
+   /* _mesa_function_pool[10466]: DrawRangeElements (offset 338) */
    "iiiiip\0"
    "glDrawRangeElements\0"
    "glDrawRangeElementsEXT\0"
    "\0"
-   /* _mesa_function_pool[10495]: EvalMesh2 (offset 238) */
+   /* _mesa_function_pool[10517]: EvalMesh2 (offset 238) */
    "iiiii\0"
    "glEvalMesh2\0"
    "\0"
-   /* _mesa_function_pool[10514]: Vertex4fv (offset 145) */
+   /* _mesa_function_pool[10536]: Vertex4fv (offset 145) */
    "p\0"
    "glVertex4fv\0"
    "\0"
-   /* _mesa_function_pool[10529]: GenTransformFeedbacks (will be remapped) */
+   /* _mesa_function_pool[10551]: GenTransformFeedbacks (will be remapped) */
    "ip\0"
    "glGenTransformFeedbacks\0"
    "\0"
-   /* _mesa_function_pool[10557]: SpriteParameterfvSGIX (dynamic) */
+   /* _mesa_function_pool[10579]: SpriteParameterfvSGIX (dynamic) */
    "ip\0"
    "glSpriteParameterfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[10585]: CheckFramebufferStatusEXT (will be remapped) */
+   /* _mesa_function_pool[10607]: CheckFramebufferStatusEXT (will be remapped) */
    "i\0"
    "glCheckFramebufferStatus\0"
    "glCheckFramebufferStatusEXT\0"
    "\0"
-   /* _mesa_function_pool[10641]: GlobalAlphaFactoruiSUN (dynamic) */
+   /* _mesa_function_pool[10663]: GlobalAlphaFactoruiSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactoruiSUN\0"
    "\0"
-   /* _mesa_function_pool[10669]: GetHandleARB (will be remapped) */
+   /* _mesa_function_pool[10691]: GetHandleARB (will be remapped) */
    "i\0"
    "glGetHandleARB\0"
    "\0"
-   /* _mesa_function_pool[10687]: DebugMessageControlARB (will be remapped) */
+   /* _mesa_function_pool[10709]: DebugMessageControlARB (will be remapped) */
    "iiiipi\0"
    "glDebugMessageControlARB\0"
    "\0"
-   /* _mesa_function_pool[10720]: GetVertexAttribivARB (will be remapped) */
+   /* _mesa_function_pool[10742]: GetVertexAttribivARB (will be remapped) */
    "iip\0"
    "glGetVertexAttribiv\0"
    "glGetVertexAttribivARB\0"
    "\0"
-   /* _mesa_function_pool[10768]: BlendFunciARB (will be remapped) */
+   /* _mesa_function_pool[10790]: BlendFunciARB (will be remapped) */
    "iii\0"
    "glBlendFunciARB\0"
    "glBlendFuncIndexedAMD\0"
    "\0"
-   /* _mesa_function_pool[10811]: VertexAttribP1ui (will be remapped) */
+   /* _mesa_function_pool[10833]: VertexAttribP1ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP1ui\0"
    "\0"
-   /* _mesa_function_pool[10836]: GetnUniformivARB (will be remapped) */
+   /* _mesa_function_pool[10858]: GetnUniformivARB (will be remapped) */
    "iiip\0"
    "glGetnUniformivARB\0"
    "\0"
-   /* _mesa_function_pool[10861]: GetTexParameterIivEXT (will be remapped) */
+   /* _mesa_function_pool[10883]: GetTexParameterIivEXT (will be remapped) */
    "iip\0"
    "glGetTexParameterIivEXT\0"
    "glGetTexParameterIiv\0"
    "\0"
-   /* _mesa_function_pool[10911]: CreateProgram (will be remapped) */
+   /* _mesa_function_pool[10933]: CreateProgram (will be remapped) */
    "\0"
    "glCreateProgram\0"
    "\0"
-   /* _mesa_function_pool[10929]: LoadTransposeMatrixdARB (will be remapped) */
+   /* _mesa_function_pool[10951]: LoadTransposeMatrixdARB (will be remapped) */
    "p\0"
    "glLoadTransposeMatrixd\0"
    "glLoadTransposeMatrixdARB\0"
    "\0"
-   /* _mesa_function_pool[10981]: ReleaseShaderCompiler (will be remapped) */
+   /* _mesa_function_pool[11003]: ReleaseShaderCompiler (will be remapped) */
    "\0"
    "glReleaseShaderCompiler\0"
    "\0"
-   /* _mesa_function_pool[11007]: GetMinmax (offset 364) */
+   /* _mesa_function_pool[11029]: GetMinmax (offset 364) */
    "iiiip\0"
    "glGetMinmax\0"
    "glGetMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[11041]: StencilFuncSeparate (will be remapped) */
+   /* _mesa_function_pool[11063]: StencilFuncSeparate (will be remapped) */
    "iiii\0"
    "glStencilFuncSeparate\0"
    "\0"
-   /* _mesa_function_pool[11069]: SecondaryColor3sEXT (will be remapped) */
+   /* _mesa_function_pool[11091]: SecondaryColor3sEXT (will be remapped) */
    "iii\0"
    "glSecondaryColor3s\0"
    "glSecondaryColor3sEXT\0"
    "\0"
-   /* _mesa_function_pool[11115]: Color3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[11137]: Color3fVertex3fvSUN (dynamic) */
    "pp\0"
    "glColor3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[11141]: GetInteger64i_v (will be remapped) */
+   /* _mesa_function_pool[11163]: GetInteger64i_v (will be remapped) */
    "iip\0"
    "glGetInteger64i_v\0"
    "\0"
-   /* _mesa_function_pool[11164]: GetVertexAttribdvNV (will be remapped) */
+   /* _mesa_function_pool[11186]: GetVertexAttribdvNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribdvNV\0"
    "\0"
-   /* _mesa_function_pool[11191]: DeleteTransformFeedbacks (will be remapped) */
+   /* _mesa_function_pool[11213]: DeleteTransformFeedbacks (will be remapped) */
    "ip\0"
    "glDeleteTransformFeedbacks\0"
    "\0"
-   /* _mesa_function_pool[11222]: Normal3fv (offset 57) */
+   /* _mesa_function_pool[11244]: Normal3fv (offset 57) */
    "p\0"
    "glNormal3fv\0"
    "\0"
-   /* _mesa_function_pool[11237]: GlobalAlphaFactorbSUN (dynamic) */
+   /* _mesa_function_pool[11259]: GlobalAlphaFactorbSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorbSUN\0"
    "\0"
-   /* _mesa_function_pool[11264]: Color3us (offset 23) */
+   /* _mesa_function_pool[11286]: Color3us (offset 23) */
    "iii\0"
    "glColor3us\0"
    "\0"
-   /* _mesa_function_pool[11280]: ImageTransformParameterfvHP (dynamic) */
+   /* _mesa_function_pool[11302]: ImageTransformParameterfvHP (dynamic) */
    "iip\0"
    "glImageTransformParameterfvHP\0"
    "\0"
-   /* _mesa_function_pool[11315]: VertexAttrib4ivARB (will be remapped) */
+   /* _mesa_function_pool[11337]: VertexAttrib4ivARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4iv\0"
    "glVertexAttrib4ivARB\0"
    "\0"
-   /* _mesa_function_pool[11358]: End (offset 43) */
+   /* _mesa_function_pool[11380]: End (offset 43) */
    "\0"
    "glEnd\0"
    "\0"
-   /* _mesa_function_pool[11366]: VertexAttrib3fNV (will be remapped) */
+   /* _mesa_function_pool[11388]: VertexAttrib3fNV (will be remapped) */
    "ifff\0"
    "glVertexAttrib3fNV\0"
    "\0"
-   /* _mesa_function_pool[11391]: MultiTexCoordP3uiv (will be remapped) */
+   /* _mesa_function_pool[11413]: MultiTexCoordP3uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP3uiv\0"
    "\0"
-   /* _mesa_function_pool[11417]: VertexAttribs2dvNV (will be remapped) */
+   /* _mesa_function_pool[11439]: VertexAttribs2dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2dvNV\0"
    "\0"
-   /* _mesa_function_pool[11443]: GetQueryObjectui64vEXT (will be remapped) */
+   /* _mesa_function_pool[11465]: GetQueryObjectui64vEXT (will be remapped) */
    "iip\0"
    "glGetQueryObjectui64vEXT\0"
    "\0"
-   /* _mesa_function_pool[11473]: MultiTexCoord3fvARB (offset 395) */
+   /* _mesa_function_pool[11495]: MultiTexCoord3fvARB (offset 395) */
    "ip\0"
    "glMultiTexCoord3fv\0"
    "glMultiTexCoord3fvARB\0"
    "\0"
-   /* _mesa_function_pool[11518]: SecondaryColor3dEXT (will be remapped) */
+   /* _mesa_function_pool[11540]: SecondaryColor3dEXT (will be remapped) */
    "ddd\0"
    "glSecondaryColor3d\0"
    "glSecondaryColor3dEXT\0"
    "\0"
-   /* _mesa_function_pool[11564]: Color3ub (offset 19) */
+   /* _mesa_function_pool[11586]: Color3ub (offset 19) */
    "iii\0"
    "glColor3ub\0"
    "\0"
-   /* _mesa_function_pool[11580]: GetProgramParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[11602]: GetProgramParameterfvNV (will be remapped) */
    "iiip\0"
    "glGetProgramParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[11612]: TangentPointerEXT (dynamic) */
+   /* _mesa_function_pool[11634]: TangentPointerEXT (dynamic) */
    "iip\0"
    "glTangentPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[11637]: Color4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[11659]: Color4fNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[11672]: GetInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[11694]: GetInstrumentsSGIX (dynamic) */
    "\0"
    "glGetInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[11695]: GetUniformuivEXT (will be remapped) */
+   /* _mesa_function_pool[11717]: GetUniformuivEXT (will be remapped) */
    "iip\0"
    "glGetUniformuivEXT\0"
    "glGetUniformuiv\0"
    "\0"
-   /* _mesa_function_pool[11735]: Color3ui (offset 21) */
+   /* _mesa_function_pool[11757]: Color3ui (offset 21) */
    "iii\0"
    "glColor3ui\0"
    "\0"
-   /* _mesa_function_pool[11751]: EvalMapsNV (dynamic) */
+   /* _mesa_function_pool[11773]: EvalMapsNV (dynamic) */
    "ii\0"
    "glEvalMapsNV\0"
    "\0"
-   /* _mesa_function_pool[11768]: TexSubImage2D (offset 333) */
+   /* _mesa_function_pool[11790]: TexSubImage2D (offset 333) */
    "iiiiiiiip\0"
    "glTexSubImage2D\0"
    "glTexSubImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[11814]: FragmentLightivSGIX (dynamic) */
+   /* _mesa_function_pool[11836]: FragmentLightivSGIX (dynamic) */
    "iip\0"
    "glFragmentLightivSGIX\0"
    "\0"
-   /* _mesa_function_pool[11841]: GetTexParameterPointervAPPLE (will be remapped) */
+   /* _mesa_function_pool[11863]: GetTexParameterPointervAPPLE (will be remapped) */
    "iip\0"
    "glGetTexParameterPointervAPPLE\0"
    "\0"
-   /* _mesa_function_pool[11877]: TexGenfv (offset 191) */
+   /* _mesa_function_pool[11899]: TexGenfv (offset 191) */
    "iip\0"
    "glTexGenfv\0"
    "\0"
-   /* _mesa_function_pool[11893]: PixelTransformParameterfvEXT (dynamic) */
+   /* _mesa_function_pool[11915]: PixelTransformParameterfvEXT (dynamic) */
    "iip\0"
    "glPixelTransformParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[11929]: VertexAttrib4bvARB (will be remapped) */
+   /* _mesa_function_pool[11951]: VertexAttrib4bvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4bv\0"
    "glVertexAttrib4bvARB\0"
    "\0"
-   /* _mesa_function_pool[11972]: ShaderBinary (will be remapped) */
+   /* _mesa_function_pool[11994]: ShaderBinary (will be remapped) */
    "ipipi\0"
    "glShaderBinary\0"
    "\0"
-   /* _mesa_function_pool[11994]: TexCoordP2uiv (will be remapped) */
+   /* _mesa_function_pool[12016]: TexCoordP2uiv (will be remapped) */
    "ip\0"
    "glTexCoordP2uiv\0"
    "\0"
-   /* _mesa_function_pool[12014]: MultiTexCoord4sARB (offset 406) */
+   /* _mesa_function_pool[12036]: MultiTexCoord4sARB (offset 406) */
    "iiiii\0"
    "glMultiTexCoord4s\0"
    "glMultiTexCoord4sARB\0"
    "\0"
-   /* _mesa_function_pool[12060]: GetFragmentMaterialivSGIX (dynamic) */
+   /* _mesa_function_pool[12082]: GetFragmentMaterialivSGIX (dynamic) */
    "iip\0"
    "glGetFragmentMaterialivSGIX\0"
    "\0"
-   /* _mesa_function_pool[12093]: WindowPos4dMESA (will be remapped) */
+   /* _mesa_function_pool[12115]: WindowPos4dMESA (will be remapped) */
    "dddd\0"
    "glWindowPos4dMESA\0"
    "\0"
-   /* _mesa_function_pool[12117]: WeightPointerARB (dynamic) */
+   /* _mesa_function_pool[12139]: WeightPointerARB (dynamic) */
    "iiip\0"
    "glWeightPointerARB\0"
    "\0"
-   /* _mesa_function_pool[12142]: WindowPos2dMESA (will be remapped) */
+   /* _mesa_function_pool[12164]: WindowPos2dMESA (will be remapped) */
    "dd\0"
    "glWindowPos2d\0"
    "glWindowPos2dARB\0"
    "glWindowPos2dMESA\0"
    "\0"
-   /* _mesa_function_pool[12195]: FramebufferTexture3DEXT (will be remapped) */
+   /* _mesa_function_pool[12217]: FramebufferTexture3DEXT (will be remapped) */
    "iiiiii\0"
    "glFramebufferTexture3D\0"
    "glFramebufferTexture3DEXT\0"
    "\0"
-   /* _mesa_function_pool[12252]: BlendEquation (offset 337) */
+   /* _mesa_function_pool[12274]: BlendEquation (offset 337) */
    "i\0"
    "glBlendEquation\0"
    "glBlendEquationEXT\0"
    "\0"
-   /* _mesa_function_pool[12290]: VertexAttrib3dNV (will be remapped) */
+   /* _mesa_function_pool[12312]: VertexAttrib3dNV (will be remapped) */
    "iddd\0"
    "glVertexAttrib3dNV\0"
    "\0"
-   /* _mesa_function_pool[12315]: VertexAttrib3dARB (will be remapped) */
+   /* _mesa_function_pool[12337]: VertexAttrib3dARB (will be remapped) */
    "iddd\0"
    "glVertexAttrib3d\0"
    "glVertexAttrib3dARB\0"
    "\0"
-   /* _mesa_function_pool[12358]: VertexAttribI4usvEXT (will be remapped) */
+   /* _mesa_function_pool[12380]: VertexAttribI4usvEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4usvEXT\0"
    "glVertexAttribI4usv\0"
    "\0"
-   /* _mesa_function_pool[12405]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[12427]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
    "ppppp\0"
    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[12469]: VertexAttrib4fARB (will be remapped) */
+   /* _mesa_function_pool[12491]: VertexAttrib4fARB (will be remapped) */
    "iffff\0"
    "glVertexAttrib4f\0"
    "glVertexAttrib4fARB\0"
    "\0"
-   /* _mesa_function_pool[12513]: GetError (offset 261) */
+   /* _mesa_function_pool[12535]: GetError (offset 261) */
    "\0"
    "glGetError\0"
    "\0"
-   /* _mesa_function_pool[12526]: IndexFuncEXT (dynamic) */
+   /* _mesa_function_pool[12548]: IndexFuncEXT (dynamic) */
    "if\0"
    "glIndexFuncEXT\0"
    "\0"
-   /* _mesa_function_pool[12545]: TexCoord3dv (offset 111) */
+   /* _mesa_function_pool[12567]: TexCoord3dv (offset 111) */
    "p\0"
    "glTexCoord3dv\0"
    "\0"
-   /* _mesa_function_pool[12562]: Indexdv (offset 45) */
+   /* _mesa_function_pool[12584]: Indexdv (offset 45) */
    "p\0"
    "glIndexdv\0"
    "\0"
-   /* _mesa_function_pool[12575]: FramebufferTexture2DEXT (will be remapped) */
+   /* _mesa_function_pool[12597]: FramebufferTexture2DEXT (will be remapped) */
    "iiiii\0"
    "glFramebufferTexture2D\0"
    "glFramebufferTexture2DEXT\0"
    "\0"
-   /* _mesa_function_pool[12631]: Normal3s (offset 60) */
+   /* _mesa_function_pool[12653]: Normal3s (offset 60) */
    "iii\0"
    "glNormal3s\0"
    "\0"
-   /* _mesa_function_pool[12647]: GetObjectParameterivAPPLE (will be remapped) */
+   /* _mesa_function_pool[12669]: GetObjectParameterivAPPLE (will be remapped) */
    "iiip\0"
    "glGetObjectParameterivAPPLE\0"
    "\0"
-   /* _mesa_function_pool[12681]: PushName (offset 201) */
+   /* _mesa_function_pool[12703]: PushName (offset 201) */
    "i\0"
    "glPushName\0"
    "\0"
-   /* _mesa_function_pool[12695]: MultiTexCoord2dvARB (offset 385) */
+   /* _mesa_function_pool[12717]: MultiTexCoord2dvARB (offset 385) */
    "ip\0"
    "glMultiTexCoord2dv\0"
    "glMultiTexCoord2dvARB\0"
    "\0"
-   /* _mesa_function_pool[12740]: CullParameterfvEXT (dynamic) */
+   /* _mesa_function_pool[12762]: CullParameterfvEXT (dynamic) */
    "ip\0"
    "glCullParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[12765]: Normal3i (offset 58) */
+   /* _mesa_function_pool[12787]: Normal3i (offset 58) */
    "iii\0"
    "glNormal3i\0"
    "\0"
-   /* _mesa_function_pool[12781]: ProgramNamedParameter4fvNV (will be remapped) */
+   /* _mesa_function_pool[12803]: ProgramNamedParameter4fvNV (will be remapped) */
    "iipp\0"
    "glProgramNamedParameter4fvNV\0"
    "\0"
-   /* _mesa_function_pool[12816]: SecondaryColorPointerEXT (will be remapped) */
+   /* _mesa_function_pool[12838]: SecondaryColorPointerEXT (will be remapped) */
    "iiip\0"
    "glSecondaryColorPointer\0"
    "glSecondaryColorPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[12873]: VertexAttrib4fvARB (will be remapped) */
+   /* _mesa_function_pool[12895]: VertexAttrib4fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4fv\0"
    "glVertexAttrib4fvARB\0"
    "\0"
-   /* _mesa_function_pool[12916]: PixelTexGenSGIX (will be remapped) */
+   /* _mesa_function_pool[12938]: PixelTexGenSGIX (will be remapped) */
    "i\0"
    "glPixelTexGenSGIX\0"
    "\0"
-   /* _mesa_function_pool[12937]: GetActiveUniformARB (will be remapped) */
+   /* _mesa_function_pool[12959]: GetActiveUniformARB (will be remapped) */
    "iiipppp\0"
    "glGetActiveUniform\0"
    "glGetActiveUniformARB\0"
    "\0"
-   /* _mesa_function_pool[12987]: VertexAttribP1uiv (will be remapped) */
+   /* _mesa_function_pool[13009]: VertexAttribP1uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP1uiv\0"
    "\0"
-   /* _mesa_function_pool[13013]: Normal3b (offset 52) */
+   /* _mesa_function_pool[13035]: Normal3b (offset 52) */
    "iii\0"
    "glNormal3b\0"
    "\0"
-   /* _mesa_function_pool[13029]: Normal3d (offset 54) */
+   /* _mesa_function_pool[13051]: Normal3d (offset 54) */
    "ddd\0"
    "glNormal3d\0"
    "\0"
-   /* _mesa_function_pool[13045]: Uniform1uiEXT (will be remapped) */
+   /* _mesa_function_pool[13067]: Uniform1uiEXT (will be remapped) */
    "ii\0"
    "glUniform1uiEXT\0"
    "glUniform1ui\0"
    "\0"
-   /* _mesa_function_pool[13078]: Normal3f (offset 56) */
+   /* _mesa_function_pool[13100]: Normal3f (offset 56) */
    "fff\0"
    "glNormal3f\0"
    "\0"
-   /* _mesa_function_pool[13094]: MultiTexCoord1svARB (offset 383) */
+   /* _mesa_function_pool[13116]: MultiTexCoord1svARB (offset 383) */
    "ip\0"
    "glMultiTexCoord1sv\0"
    "glMultiTexCoord1svARB\0"
    "\0"
-   /* _mesa_function_pool[13139]: Indexi (offset 48) */
+   /* _mesa_function_pool[13161]: Indexi (offset 48) */
    "i\0"
    "glIndexi\0"
    "\0"
-   /* _mesa_function_pool[13151]: EGLImageTargetTexture2DOES (will be remapped) */
+   /* _mesa_function_pool[13173]: EGLImageTargetTexture2DOES (will be remapped) */
    "ip\0"
    "glEGLImageTargetTexture2DOES\0"
    "\0"
-   /* _mesa_function_pool[13184]: EndQueryARB (will be remapped) */
+   /* _mesa_function_pool[13206]: EndQueryARB (will be remapped) */
    "i\0"
    "glEndQuery\0"
    "glEndQueryARB\0"
    "\0"
-   /* _mesa_function_pool[13212]: DeleteFencesNV (will be remapped) */
+   /* _mesa_function_pool[13234]: DeleteFencesNV (will be remapped) */
    "ip\0"
    "glDeleteFencesNV\0"
    "\0"
-   /* _mesa_function_pool[13233]: ColorPointerListIBM (dynamic) */
+   /* _mesa_function_pool[13255]: ColorPointerListIBM (dynamic) */
    "iiipi\0"
    "glColorPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[13262]: BindBufferRangeEXT (will be remapped) */
+   /* _mesa_function_pool[13284]: BindBufferRangeEXT (will be remapped) */
    "iiiii\0"
    "glBindBufferRange\0"
    "glBindBufferRangeEXT\0"
    "\0"
-   /* _mesa_function_pool[13308]: DepthMask (offset 211) */
+   /* _mesa_function_pool[13330]: DepthMask (offset 211) */
    "i\0"
    "glDepthMask\0"
    "\0"
-   /* _mesa_function_pool[13323]: IsShader (will be remapped) */
+   /* _mesa_function_pool[13345]: IsShader (will be remapped) */
    "i\0"
    "glIsShader\0"
    "\0"
-   /* _mesa_function_pool[13337]: Indexf (offset 46) */
+   /* _mesa_function_pool[13359]: Indexf (offset 46) */
    "f\0"
    "glIndexf\0"
    "\0"
-   /* _mesa_function_pool[13349]: GetImageTransformParameterivHP (dynamic) */
+   /* _mesa_function_pool[13371]: GetImageTransformParameterivHP (dynamic) */
    "iip\0"
    "glGetImageTransformParameterivHP\0"
    "\0"
-   /* _mesa_function_pool[13387]: Indexd (offset 44) */
+   /* _mesa_function_pool[13409]: Indexd (offset 44) */
    "d\0"
    "glIndexd\0"
    "\0"
-   /* _mesa_function_pool[13399]: GetMaterialiv (offset 270) */
+   /* _mesa_function_pool[13421]: GetMaterialiv (offset 270) */
    "iip\0"
    "glGetMaterialiv\0"
    "\0"
-   /* _mesa_function_pool[13420]: StencilOp (offset 244) */
+   /* _mesa_function_pool[13442]: StencilOp (offset 244) */
    "iii\0"
    "glStencilOp\0"
    "\0"
-   /* _mesa_function_pool[13437]: WindowPos4ivMESA (will be remapped) */
+   /* _mesa_function_pool[13459]: WindowPos4ivMESA (will be remapped) */
    "p\0"
    "glWindowPos4ivMESA\0"
    "\0"
-   /* _mesa_function_pool[13459]: MultiTexCoord3svARB (offset 399) */
+   /* _mesa_function_pool[13481]: MultiTexCoord3svARB (offset 399) */
    "ip\0"
    "glMultiTexCoord3sv\0"
    "glMultiTexCoord3svARB\0"
    "\0"
-   /* _mesa_function_pool[13504]: TexEnvfv (offset 185) */
+   /* _mesa_function_pool[13526]: TexEnvfv (offset 185) */
    "iip\0"
    "glTexEnvfv\0"
    "\0"
-   /* _mesa_function_pool[13520]: MultiTexCoord4iARB (offset 404) */
+   /* _mesa_function_pool[13542]: MultiTexCoord4iARB (offset 404) */
    "iiiii\0"
    "glMultiTexCoord4i\0"
    "glMultiTexCoord4iARB\0"
    "\0"
-   /* _mesa_function_pool[13566]: Indexs (offset 50) */
+   /* _mesa_function_pool[13588]: Indexs (offset 50) */
    "i\0"
    "glIndexs\0"
    "\0"
-   /* _mesa_function_pool[13578]: TexCoordP3ui (will be remapped) */
+   /* _mesa_function_pool[13600]: TexCoordP3ui (will be remapped) */
    "ii\0"
    "glTexCoordP3ui\0"
    "\0"
-   /* _mesa_function_pool[13597]: ResizeBuffersMESA (will be remapped) */
+   /* _mesa_function_pool[13619]: ResizeBuffersMESA (will be remapped) */
    "\0"
    "glResizeBuffersMESA\0"
    "\0"
-   /* _mesa_function_pool[13619]: MultiTexCoordP1uiv (will be remapped) */
+   /* _mesa_function_pool[13641]: MultiTexCoordP1uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP1uiv\0"
    "\0"
-   /* _mesa_function_pool[13645]: BlendFuncSeparateiARB (will be remapped) */
+   /* _mesa_function_pool[13667]: BlendFuncSeparateiARB (will be remapped) */
    "iiiii\0"
    "glBlendFuncSeparateiARB\0"
    "glBlendFuncSeparateIndexedAMD\0"
    "\0"
-   /* _mesa_function_pool[13706]: GetUniformivARB (will be remapped) */
+   /* _mesa_function_pool[13728]: GetUniformivARB (will be remapped) */
    "iip\0"
    "glGetUniformiv\0"
    "glGetUniformivARB\0"
    "\0"
-   /* _mesa_function_pool[13744]: PixelTexGenParameteriSGIS (will be remapped) */
+   /* _mesa_function_pool[13766]: PixelTexGenParameteriSGIS (will be remapped) */
    "ii\0"
    "glPixelTexGenParameteriSGIS\0"
    "\0"
-   /* _mesa_function_pool[13776]: VertexPointervINTEL (dynamic) */
+   /* _mesa_function_pool[13798]: VertexPointervINTEL (dynamic) */
    "iip\0"
    "glVertexPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[13803]: Vertex2i (offset 130) */
+   /* _mesa_function_pool[13825]: Vertex2i (offset 130) */
    "ii\0"
    "glVertex2i\0"
    "\0"
-   /* _mesa_function_pool[13818]: LoadMatrixf (offset 291) */
+   /* _mesa_function_pool[13840]: LoadMatrixf (offset 291) */
    "p\0"
    "glLoadMatrixf\0"
    "\0"
-   /* _mesa_function_pool[13835]: VertexAttribI1uivEXT (will be remapped) */
+   /* _mesa_function_pool[13857]: VertexAttribI1uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI1uivEXT\0"
    "glVertexAttribI1uiv\0"
    "\0"
-   /* _mesa_function_pool[13882]: Vertex2f (offset 128) */
+   /* _mesa_function_pool[13904]: Vertex2f (offset 128) */
    "ff\0"
    "glVertex2f\0"
    "\0"
-   /* _mesa_function_pool[13897]: ReplacementCodeuiColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[13919]: ReplacementCodeuiColor4fNormal3fVertex3fvSUN (dynamic) */
    "pppp\0"
    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[13950]: Color4bv (offset 26) */
+   /* _mesa_function_pool[13972]: Color4bv (offset 26) */
    "p\0"
    "glColor4bv\0"
    "\0"
-   /* _mesa_function_pool[13964]: VertexPointer (offset 321) */
+   /* _mesa_function_pool[13986]: VertexPointer (offset 321) */
    "iiip\0"
    "glVertexPointer\0"
    "\0"
-   /* _mesa_function_pool[13986]: SecondaryColor3uiEXT (will be remapped) */
+   /* _mesa_function_pool[14008]: SecondaryColor3uiEXT (will be remapped) */
    "iii\0"
    "glSecondaryColor3ui\0"
    "glSecondaryColor3uiEXT\0"
    "\0"
-   /* _mesa_function_pool[14034]: StartInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[14056]: StartInstrumentsSGIX (dynamic) */
    "\0"
    "glStartInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[14059]: SecondaryColor3usvEXT (will be remapped) */
+   /* _mesa_function_pool[14081]: SecondaryColor3usvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3usv\0"
    "glSecondaryColor3usvEXT\0"
    "\0"
-   /* _mesa_function_pool[14107]: VertexAttrib2fvNV (will be remapped) */
+   /* _mesa_function_pool[14129]: VertexAttrib2fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2fvNV\0"
    "\0"
-   /* _mesa_function_pool[14131]: ProgramLocalParameter4dvARB (will be remapped) */
+   /* _mesa_function_pool[14153]: ProgramLocalParameter4dvARB (will be remapped) */
    "iip\0"
    "glProgramLocalParameter4dvARB\0"
    "\0"
-   /* _mesa_function_pool[14166]: DeleteLists (offset 4) */
+   /* _mesa_function_pool[14188]: DeleteLists (offset 4) */
    "ii\0"
    "glDeleteLists\0"
    "\0"
-   /* _mesa_function_pool[14184]: LogicOp (offset 242) */
+   /* _mesa_function_pool[14206]: LogicOp (offset 242) */
    "i\0"
    "glLogicOp\0"
    "\0"
-   /* _mesa_function_pool[14197]: MatrixIndexuivARB (dynamic) */
+   /* _mesa_function_pool[14219]: MatrixIndexuivARB (dynamic) */
    "ip\0"
    "glMatrixIndexuivARB\0"
    "\0"
-   /* _mesa_function_pool[14221]: Vertex2s (offset 132) */
+   /* _mesa_function_pool[14243]: Vertex2s (offset 132) */
    "ii\0"
    "glVertex2s\0"
    "\0"
-   /* _mesa_function_pool[14236]: RenderbufferStorageMultisample (will be remapped) */
+   /* _mesa_function_pool[14258]: RenderbufferStorageMultisample (will be remapped) */
    "iiiii\0"
    "glRenderbufferStorageMultisample\0"
    "glRenderbufferStorageMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[14312]: TexCoord4fv (offset 121) */
+   /* _mesa_function_pool[14334]: TexCoord4fv (offset 121) */
    "p\0"
    "glTexCoord4fv\0"
    "\0"
-   /* _mesa_function_pool[14329]: Tangent3sEXT (dynamic) */
+   /* _mesa_function_pool[14351]: Tangent3sEXT (dynamic) */
    "iii\0"
    "glTangent3sEXT\0"
    "\0"
-   /* _mesa_function_pool[14349]: GlobalAlphaFactorfSUN (dynamic) */
+   /* _mesa_function_pool[14371]: GlobalAlphaFactorfSUN (dynamic) */
    "f\0"
    "glGlobalAlphaFactorfSUN\0"
    "\0"
-   /* _mesa_function_pool[14376]: MultiTexCoord3iARB (offset 396) */
+   /* _mesa_function_pool[14398]: MultiTexCoord3iARB (offset 396) */
    "iiii\0"
    "glMultiTexCoord3i\0"
    "glMultiTexCoord3iARB\0"
    "\0"
-   /* _mesa_function_pool[14421]: IsProgram (will be remapped) */
+   /* _mesa_function_pool[14443]: IsProgram (will be remapped) */
    "i\0"
    "glIsProgram\0"
    "\0"
-   /* _mesa_function_pool[14436]: TexCoordPointerListIBM (dynamic) */
+   /* _mesa_function_pool[14458]: TexCoordPointerListIBM (dynamic) */
    "iiipi\0"
    "glTexCoordPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[14468]: VertexAttribI4svEXT (will be remapped) */
+   /* _mesa_function_pool[14490]: VertexAttribI4svEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4svEXT\0"
    "glVertexAttribI4sv\0"
    "\0"
-   /* _mesa_function_pool[14513]: GlobalAlphaFactorusSUN (dynamic) */
+   /* _mesa_function_pool[14535]: GlobalAlphaFactorusSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorusSUN\0"
    "\0"
-   /* _mesa_function_pool[14541]: ColorP4uiv (will be remapped) */
+   /* _mesa_function_pool[14563]: ColorP4uiv (will be remapped) */
    "ip\0"
    "glColorP4uiv\0"
    "\0"
-   /* _mesa_function_pool[14558]: FramebufferRenderbufferEXT (will be remapped) */
+   /* _mesa_function_pool[14580]: FramebufferRenderbufferEXT (will be remapped) */
    "iiii\0"
    "glFramebufferRenderbuffer\0"
    "glFramebufferRenderbufferEXT\0"
    "\0"
-   /* _mesa_function_pool[14619]: ClearBufferuiv (will be remapped) */
+   /* _mesa_function_pool[14641]: ClearBufferuiv (will be remapped) */
    "iip\0"
    "glClearBufferuiv\0"
    "\0"
-   /* _mesa_function_pool[14641]: VertexAttrib1dvNV (will be remapped) */
+   /* _mesa_function_pool[14663]: VertexAttrib1dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib1dvNV\0"
    "\0"
-   /* _mesa_function_pool[14665]: GenTextures (offset 328) */
+   /* _mesa_function_pool[14687]: GenTextures (offset 328) */
    "ip\0"
    "glGenTextures\0"
    "glGenTexturesEXT\0"
    "\0"
-   /* _mesa_function_pool[14700]: FramebufferTextureARB (will be remapped) */
+   /* _mesa_function_pool[14722]: FramebufferTextureARB (will be remapped) */
    "iiii\0"
    "glFramebufferTextureARB\0"
    "\0"
-   /* _mesa_function_pool[14730]: MultiTexCoordP4uiv (will be remapped) */
+   /* _mesa_function_pool[14752]: MultiTexCoordP4uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP4uiv\0"
    "\0"
-   /* _mesa_function_pool[14756]: FramebufferTexture1DEXT (will be remapped) */
+   /* _mesa_function_pool[14778]: FramebufferTexture1DEXT (will be remapped) */
    "iiiii\0"
    "glFramebufferTexture1D\0"
    "glFramebufferTexture1DEXT\0"
    "\0"
-   /* _mesa_function_pool[14812]: GetCombinerOutputParameterivNV (will be remapped) */
+   /* _mesa_function_pool[14834]: GetCombinerOutputParameterivNV (will be remapped) */
    "iiip\0"
    "glGetCombinerOutputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[14851]: MultiModeDrawArraysIBM (will be remapped) */
+   /* _mesa_function_pool[14873]: MultiModeDrawArraysIBM (will be remapped) */
    "pppii\0"
    "glMultiModeDrawArraysIBM\0"
    "\0"
-   /* _mesa_function_pool[14883]: PixelTexGenParameterivSGIS (will be remapped) */
+   /* _mesa_function_pool[14905]: PixelTexGenParameterivSGIS (will be remapped) */
    "ip\0"
    "glPixelTexGenParameterivSGIS\0"
    "\0"
-   /* _mesa_function_pool[14916]: TextureNormalEXT (dynamic) */
+   /* _mesa_function_pool[14938]: TextureNormalEXT (dynamic) */
    "i\0"
    "glTextureNormalEXT\0"
    "\0"
-   /* _mesa_function_pool[14938]: IndexPointerListIBM (dynamic) */
+   /* _mesa_function_pool[14960]: IndexPointerListIBM (dynamic) */
    "iipi\0"
    "glIndexPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[14966]: WeightfvARB (dynamic) */
+   /* _mesa_function_pool[14988]: WeightfvARB (dynamic) */
    "ip\0"
    "glWeightfvARB\0"
    "\0"
-   /* _mesa_function_pool[14984]: MultiTexCoordP3ui (will be remapped) */
+   /* _mesa_function_pool[15006]: MultiTexCoordP3ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP3ui\0"
    "\0"
-   /* _mesa_function_pool[15009]: RasterPos2sv (offset 69) */
+   /* _mesa_function_pool[15031]: RasterPos2sv (offset 69) */
    "p\0"
    "glRasterPos2sv\0"
    "\0"
-   /* _mesa_function_pool[15027]: Color4ubv (offset 36) */
+   /* _mesa_function_pool[15049]: Color4ubv (offset 36) */
    "p\0"
    "glColor4ubv\0"
    "\0"
-   /* _mesa_function_pool[15042]: DrawBuffer (offset 202) */
+   /* _mesa_function_pool[15064]: DrawBuffer (offset 202) */
    "i\0"
    "glDrawBuffer\0"
    "\0"
-   /* _mesa_function_pool[15058]: TexCoord2fv (offset 105) */
+   /* _mesa_function_pool[15080]: TexCoord2fv (offset 105) */
    "p\0"
    "glTexCoord2fv\0"
    "\0"
-   /* _mesa_function_pool[15075]: BeginFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[15097]: BeginFragmentShaderATI (will be remapped) */
    "\0"
    "glBeginFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[15102]: WindowPos4fMESA (will be remapped) */
+   /* _mesa_function_pool[15124]: WindowPos4fMESA (will be remapped) */
    "ffff\0"
    "glWindowPos4fMESA\0"
    "\0"
-   /* _mesa_function_pool[15126]: TexCoord1sv (offset 101) */
+   /* _mesa_function_pool[15148]: TexCoord1sv (offset 101) */
    "p\0"
    "glTexCoord1sv\0"
    "\0"
-   /* _mesa_function_pool[15143]: WindowPos3dvMESA (will be remapped) */
+   /* _mesa_function_pool[15165]: WindowPos3dvMESA (will be remapped) */
    "p\0"
    "glWindowPos3dv\0"
    "glWindowPos3dvARB\0"
    "glWindowPos3dvMESA\0"
    "\0"
-   /* _mesa_function_pool[15198]: VertexAttribP4ui (will be remapped) */
+   /* _mesa_function_pool[15220]: VertexAttribP4ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP4ui\0"
    "\0"
-   /* _mesa_function_pool[15223]: DepthFunc (offset 245) */
+   /* _mesa_function_pool[15245]: DepthFunc (offset 245) */
    "i\0"
    "glDepthFunc\0"
    "\0"
-   /* _mesa_function_pool[15238]: PixelMapusv (offset 253) */
+   /* _mesa_function_pool[15260]: PixelMapusv (offset 253) */
    "iip\0"
    "glPixelMapusv\0"
    "\0"
-   /* _mesa_function_pool[15257]: GetQueryObjecti64vEXT (will be remapped) */
+   /* _mesa_function_pool[15279]: GetQueryObjecti64vEXT (will be remapped) */
    "iip\0"
    "glGetQueryObjecti64vEXT\0"
    "\0"
-   /* _mesa_function_pool[15286]: MultiTexCoord1dARB (offset 376) */
+   /* _mesa_function_pool[15308]: MultiTexCoord1dARB (offset 376) */
    "id\0"
    "glMultiTexCoord1d\0"
    "glMultiTexCoord1dARB\0"
    "\0"
-   /* _mesa_function_pool[15329]: PointParameterivNV (will be remapped) */
+   /* _mesa_function_pool[15351]: PointParameterivNV (will be remapped) */
    "ip\0"
    "glPointParameteriv\0"
    "glPointParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[15373]: IsSampler (will be remapped) */
+   /* _mesa_function_pool[15395]: IsSampler (will be remapped) */
    "i\0"
    "glIsSampler\0"
    "\0"
-   /* _mesa_function_pool[15388]: BlendFunc (offset 241) */
+   /* _mesa_function_pool[15410]: BlendFunc (offset 241) */
    "ii\0"
    "glBlendFunc\0"
    "\0"
-   /* _mesa_function_pool[15404]: ColorP3ui (will be remapped) */
+   /* _mesa_function_pool[15426]: ColorP3ui (will be remapped) */
    "ii\0"
    "glColorP3ui\0"
    "\0"
-   /* _mesa_function_pool[15420]: Uniform2fvARB (will be remapped) */
+   /* _mesa_function_pool[15442]: Uniform2fvARB (will be remapped) */
    "iip\0"
    "glUniform2fv\0"
    "glUniform2fvARB\0"
    "\0"
-   /* _mesa_function_pool[15454]: BufferParameteriAPPLE (will be remapped) */
+   /* _mesa_function_pool[15476]: BufferParameteriAPPLE (will be remapped) */
    "iii\0"
    "glBufferParameteriAPPLE\0"
    "\0"
-   /* _mesa_function_pool[15483]: MultiTexCoord3dvARB (offset 393) */
+   /* _mesa_function_pool[15505]: MultiTexCoord3dvARB (offset 393) */
    "ip\0"
    "glMultiTexCoord3dv\0"
    "glMultiTexCoord3dvARB\0"
    "\0"
-   /* _mesa_function_pool[15528]: ReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[15550]: ReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (dynamic) */
    "pppp\0"
    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[15584]: DeleteObjectARB (will be remapped) */
+   /* _mesa_function_pool[15606]: DeleteObjectARB (will be remapped) */
    "i\0"
    "glDeleteObjectARB\0"
    "\0"
-   /* _mesa_function_pool[15605]: GetShaderPrecisionFormat (will be remapped) */
+   /* _mesa_function_pool[15627]: GetShaderPrecisionFormat (will be remapped) */
    "iipp\0"
    "glGetShaderPrecisionFormat\0"
    "\0"
-   /* _mesa_function_pool[15638]: MatrixIndexPointerARB (dynamic) */
+   /* _mesa_function_pool[15660]: MatrixIndexPointerARB (dynamic) */
    "iiip\0"
    "glMatrixIndexPointerARB\0"
    "\0"
-   /* _mesa_function_pool[15668]: ProgramNamedParameter4dvNV (will be remapped) */
+   /* _mesa_function_pool[15690]: ProgramNamedParameter4dvNV (will be remapped) */
    "iipp\0"
    "glProgramNamedParameter4dvNV\0"
    "\0"
-   /* _mesa_function_pool[15703]: Tangent3fvEXT (dynamic) */
+   /* _mesa_function_pool[15725]: Tangent3fvEXT (dynamic) */
    "p\0"
    "glTangent3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[15722]: Flush (offset 217) */
+   /* _mesa_function_pool[15744]: Flush (offset 217) */
    "\0"
    "glFlush\0"
    "\0"
-   /* _mesa_function_pool[15732]: Color4uiv (offset 38) */
+   /* _mesa_function_pool[15754]: Color4uiv (offset 38) */
    "p\0"
    "glColor4uiv\0"
    "\0"
-   /* _mesa_function_pool[15747]: VertexAttribI4iEXT (will be remapped) */
+   /* _mesa_function_pool[15769]: VertexAttribI4iEXT (will be remapped) */
    "iiiii\0"
    "glVertexAttribI4iEXT\0"
    "glVertexAttribI4i\0"
    "\0"
-   /* _mesa_function_pool[15793]: GenVertexArrays (will be remapped) */
+   /* _mesa_function_pool[15815]: GenVertexArrays (will be remapped) */
    "ip\0"
    "glGenVertexArrays\0"
    "\0"
-   /* _mesa_function_pool[15815]: Uniform3uivEXT (will be remapped) */
+   /* _mesa_function_pool[15837]: Uniform3uivEXT (will be remapped) */
    "iip\0"
    "glUniform3uivEXT\0"
    "glUniform3uiv\0"
    "\0"
-   /* _mesa_function_pool[15851]: RasterPos3sv (offset 77) */
+   /* _mesa_function_pool[15873]: RasterPos3sv (offset 77) */
    "p\0"
    "glRasterPos3sv\0"
    "\0"
-   /* _mesa_function_pool[15869]: TexCoordP2ui (will be remapped) */
+   /* _mesa_function_pool[15891]: TexCoordP2ui (will be remapped) */
    "ii\0"
    "glTexCoordP2ui\0"
    "\0"
-   /* _mesa_function_pool[15888]: BindFramebufferEXT (will be remapped) */
+   /* _mesa_function_pool[15910]: BindFramebufferEXT (will be remapped) */
    "ii\0"
    "glBindFramebuffer\0"
    "glBindFramebufferEXT\0"
    "\0"
-   /* _mesa_function_pool[15931]: ReferencePlaneSGIX (dynamic) */
+   /* _mesa_function_pool[15953]: ReferencePlaneSGIX (dynamic) */
    "p\0"
    "glReferencePlaneSGIX\0"
    "\0"
-   /* _mesa_function_pool[15955]: PushAttrib (offset 219) */
+   /* _mesa_function_pool[15977]: PushAttrib (offset 219) */
    "i\0"
    "glPushAttrib\0"
    "\0"
-   /* _mesa_function_pool[15971]: RasterPos2i (offset 66) */
+   /* _mesa_function_pool[15993]: RasterPos2i (offset 66) */
    "ii\0"
    "glRasterPos2i\0"
    "\0"
-   /* _mesa_function_pool[15989]: ValidateProgramARB (will be remapped) */
+   /* _mesa_function_pool[16011]: ValidateProgramARB (will be remapped) */
    "i\0"
    "glValidateProgram\0"
    "glValidateProgramARB\0"
    "\0"
-   /* _mesa_function_pool[16031]: TexParameteriv (offset 181) */
+   /* _mesa_function_pool[16053]: TexParameteriv (offset 181) */
    "iip\0"
    "glTexParameteriv\0"
    "\0"
-   /* _mesa_function_pool[16053]: UnlockArraysEXT (will be remapped) */
+   /* _mesa_function_pool[16075]: UnlockArraysEXT (will be remapped) */
    "\0"
    "glUnlockArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[16073]: TexCoord2fColor3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[16095]: TexCoord2fColor3fVertex3fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord2fColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[16114]: WindowPos3fvMESA (will be remapped) */
+   /* _mesa_function_pool[16136]: WindowPos3fvMESA (will be remapped) */
    "p\0"
    "glWindowPos3fv\0"
    "glWindowPos3fvARB\0"
    "glWindowPos3fvMESA\0"
    "\0"
-   /* _mesa_function_pool[16169]: RasterPos2f (offset 64) */
+   /* _mesa_function_pool[16191]: RasterPos2f (offset 64) */
    "ff\0"
    "glRasterPos2f\0"
    "\0"
-   /* _mesa_function_pool[16187]: VertexAttrib1svNV (will be remapped) */
+   /* _mesa_function_pool[16209]: VertexAttrib1svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib1svNV\0"
    "\0"
-   /* _mesa_function_pool[16211]: RasterPos2d (offset 62) */
+   /* _mesa_function_pool[16233]: RasterPos2d (offset 62) */
    "dd\0"
    "glRasterPos2d\0"
    "\0"
-   /* _mesa_function_pool[16229]: RasterPos3fv (offset 73) */
+   /* _mesa_function_pool[16251]: RasterPos3fv (offset 73) */
    "p\0"
    "glRasterPos3fv\0"
    "\0"
-   /* _mesa_function_pool[16247]: CopyTexSubImage3D (offset 373) */
+   /* _mesa_function_pool[16269]: CopyTexSubImage3D (offset 373) */
    "iiiiiiiii\0"
    "glCopyTexSubImage3D\0"
    "glCopyTexSubImage3DEXT\0"
    "\0"
-   /* _mesa_function_pool[16301]: VertexAttrib2dARB (will be remapped) */
+   /* _mesa_function_pool[16323]: VertexAttrib2dARB (will be remapped) */
    "idd\0"
    "glVertexAttrib2d\0"
    "glVertexAttrib2dARB\0"
    "\0"
-   /* _mesa_function_pool[16343]: Color4ub (offset 35) */
+   /* _mesa_function_pool[16365]: Color4ub (offset 35) */
    "iiii\0"
    "glColor4ub\0"
    "\0"
-   /* _mesa_function_pool[16360]: GetInteger64v (will be remapped) */
+   /* _mesa_function_pool[16382]: GetInteger64v (will be remapped) */
    "ip\0"
    "glGetInteger64v\0"
    "\0"
-   /* _mesa_function_pool[16380]: TextureColorMaskSGIS (dynamic) */
+   /* _mesa_function_pool[16402]: TextureColorMaskSGIS (dynamic) */
    "iiii\0"
    "glTextureColorMaskSGIS\0"
    "\0"
-   /* _mesa_function_pool[16409]: RasterPos2s (offset 68) */
+   /* _mesa_function_pool[16431]: RasterPos2s (offset 68) */
    "ii\0"
    "glRasterPos2s\0"
    "\0"
-   /* _mesa_function_pool[16427]: GetColorTable (offset 343) */
+   /* _mesa_function_pool[16449]: GetColorTable (offset 343) */
    "iiip\0"
    "glGetColorTable\0"
    "glGetColorTableSGI\0"
    "glGetColorTableEXT\0"
    "\0"
-   /* _mesa_function_pool[16487]: SelectBuffer (offset 195) */
+   /* _mesa_function_pool[16509]: SelectBuffer (offset 195) */
    "ip\0"
    "glSelectBuffer\0"
    "\0"
-   /* _mesa_function_pool[16506]: Indexiv (offset 49) */
+   /* _mesa_function_pool[16528]: Indexiv (offset 49) */
    "p\0"
    "glIndexiv\0"
    "\0"
-   /* _mesa_function_pool[16519]: TexCoord3i (offset 114) */
+   /* _mesa_function_pool[16541]: TexCoord3i (offset 114) */
    "iii\0"
    "glTexCoord3i\0"
    "\0"
-   /* _mesa_function_pool[16537]: CopyColorTable (offset 342) */
+   /* _mesa_function_pool[16559]: CopyColorTable (offset 342) */
    "iiiii\0"
    "glCopyColorTable\0"
    "glCopyColorTableSGI\0"
    "\0"
-   /* _mesa_function_pool[16581]: GetHistogramParameterfv (offset 362) */
+   /* _mesa_function_pool[16603]: GetHistogramParameterfv (offset 362) */
    "iip\0"
    "glGetHistogramParameterfv\0"
    "glGetHistogramParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[16641]: Frustum (offset 289) */
+   /* _mesa_function_pool[16663]: Frustum (offset 289) */
    "dddddd\0"
    "glFrustum\0"
    "\0"
-   /* _mesa_function_pool[16659]: GetString (offset 275) */
+   /* _mesa_function_pool[16681]: GetString (offset 275) */
    "i\0"
    "glGetString\0"
    "\0"
-   /* _mesa_function_pool[16674]: ColorPointervINTEL (dynamic) */
+   /* _mesa_function_pool[16696]: ColorPointervINTEL (dynamic) */
    "iip\0"
    "glColorPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[16700]: TexEnvf (offset 184) */
+   /* _mesa_function_pool[16722]: TexEnvf (offset 184) */
    "iif\0"
    "glTexEnvf\0"
    "\0"
-   /* _mesa_function_pool[16715]: VertexP2uiv (will be remapped) */
+   /* _mesa_function_pool[16737]: VertexP2uiv (will be remapped) */
    "ip\0"
    "glVertexP2uiv\0"
    "\0"
-   /* _mesa_function_pool[16733]: TexCoord3d (offset 110) */
+   /* _mesa_function_pool[16755]: TexCoord3d (offset 110) */
    "ddd\0"
    "glTexCoord3d\0"
    "\0"
-   /* _mesa_function_pool[16751]: AlphaFragmentOp1ATI (will be remapped) */
+   /* _mesa_function_pool[16773]: AlphaFragmentOp1ATI (will be remapped) */
    "iiiiii\0"
    "glAlphaFragmentOp1ATI\0"
    "\0"
-   /* _mesa_function_pool[16781]: TexCoord3f (offset 112) */
+   /* _mesa_function_pool[16803]: TexCoord3f (offset 112) */
    "fff\0"
    "glTexCoord3f\0"
    "\0"
-   /* _mesa_function_pool[16799]: MultiTexCoord3ivARB (offset 397) */
+   /* _mesa_function_pool[16821]: MultiTexCoord3ivARB (offset 397) */
    "ip\0"
    "glMultiTexCoord3iv\0"
    "glMultiTexCoord3ivARB\0"
    "\0"
-   /* _mesa_function_pool[16844]: MultiTexCoord2sARB (offset 390) */
+   /* _mesa_function_pool[16866]: MultiTexCoord2sARB (offset 390) */
    "iii\0"
    "glMultiTexCoord2s\0"
    "glMultiTexCoord2sARB\0"
    "\0"
-   /* _mesa_function_pool[16888]: VertexAttrib1dvARB (will be remapped) */
+   /* _mesa_function_pool[16910]: VertexAttrib1dvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib1dv\0"
    "glVertexAttrib1dvARB\0"
    "\0"
-   /* _mesa_function_pool[16931]: GetnHistogramARB (will be remapped) */
+   /* _mesa_function_pool[16953]: GetnHistogramARB (will be remapped) */
    "iiiiip\0"
    "glGetnHistogramARB\0"
    "\0"
-   /* _mesa_function_pool[16958]: DeleteTextures (offset 327) */
+   /* _mesa_function_pool[16980]: DeleteTextures (offset 327) */
    "ip\0"
    "glDeleteTextures\0"
    "glDeleteTexturesEXT\0"
    "\0"
-   /* _mesa_function_pool[16999]: TexCoordPointerEXT (will be remapped) */
+   /* _mesa_function_pool[17021]: TexCoordPointerEXT (will be remapped) */
    "iiiip\0"
    "glTexCoordPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[17027]: TexSubImage4DSGIS (dynamic) */
+   /* _mesa_function_pool[17049]: TexSubImage4DSGIS (dynamic) */
    "iiiiiiiiiiiip\0"
    "glTexSubImage4DSGIS\0"
    "\0"
-   /* _mesa_function_pool[17062]: TexCoord3s (offset 116) */
+   /* _mesa_function_pool[17084]: TexCoord3s (offset 116) */
    "iii\0"
    "glTexCoord3s\0"
    "\0"
-   /* _mesa_function_pool[17080]: GetTexLevelParameteriv (offset 285) */
+   /* _mesa_function_pool[17102]: GetTexLevelParameteriv (offset 285) */
    "iiip\0"
    "glGetTexLevelParameteriv\0"
    "\0"
-   /* _mesa_function_pool[17111]: CombinerStageParameterfvNV (dynamic) */
+   /* _mesa_function_pool[17133]: CombinerStageParameterfvNV (dynamic) */
    "iip\0"
    "glCombinerStageParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[17145]: VertexAttribP4uiv (will be remapped) */
+   /* _mesa_function_pool[17167]: VertexAttribP4uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP4uiv\0"
    "\0"
-   /* _mesa_function_pool[17171]: StopInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[17193]: StopInstrumentsSGIX (dynamic) */
    "i\0"
    "glStopInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[17196]: TexCoord4fColor4fNormal3fVertex4fSUN (dynamic) */
+   /* _mesa_function_pool[17218]: TexCoord4fColor4fNormal3fVertex4fSUN (dynamic) */
    "fffffffffffffff\0"
    "glTexCoord4fColor4fNormal3fVertex4fSUN\0"
    "\0"
-   /* _mesa_function_pool[17252]: ClearAccum (offset 204) */
+   /* _mesa_function_pool[17274]: ClearAccum (offset 204) */
    "ffff\0"
    "glClearAccum\0"
    "\0"
-   /* _mesa_function_pool[17271]: DeformSGIX (dynamic) */
+   /* _mesa_function_pool[17293]: DeformSGIX (dynamic) */
    "i\0"
    "glDeformSGIX\0"
    "\0"
-   /* _mesa_function_pool[17287]: GetVertexAttribfvARB (will be remapped) */
+   /* _mesa_function_pool[17309]: GetVertexAttribfvARB (will be remapped) */
    "iip\0"
    "glGetVertexAttribfv\0"
    "glGetVertexAttribfvARB\0"
    "\0"
-   /* _mesa_function_pool[17335]: SecondaryColor3ivEXT (will be remapped) */
+   /* _mesa_function_pool[17357]: SecondaryColor3ivEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3iv\0"
    "glSecondaryColor3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[17381]: TexCoord4iv (offset 123) */
+   /* _mesa_function_pool[17403]: TexCoord4iv (offset 123) */
    "p\0"
    "glTexCoord4iv\0"
    "\0"
-   /* _mesa_function_pool[17398]: TexStorage3D (will be remapped) */
+   /* _mesa_function_pool[17420]: TexStorage3D (will be remapped) */
    "iiiiii\0"
    "glTexStorage3D\0"
    "\0"
-   /* _mesa_function_pool[17421]: GetFragmentMaterialfvSGIX (dynamic) */
+   /* _mesa_function_pool[17443]: GetFragmentMaterialfvSGIX (dynamic) */
    "iip\0"
    "glGetFragmentMaterialfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[17454]: UniformMatrix4x2fv (will be remapped) */
+   /* _mesa_function_pool[17476]: UniformMatrix4x2fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4x2fv\0"
    "\0"
-   /* _mesa_function_pool[17481]: GetDetailTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[17503]: GetDetailTexFuncSGIS (dynamic) */
    "ip\0"
    "glGetDetailTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[17508]: GetCombinerStageParameterfvNV (dynamic) */
+   /* _mesa_function_pool[17530]: GetCombinerStageParameterfvNV (dynamic) */
    "iip\0"
    "glGetCombinerStageParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[17545]: SamplerParameterIiv (will be remapped) */
+   /* _mesa_function_pool[17567]: SamplerParameterIiv (will be remapped) */
    "iip\0"
    "glSamplerParameterIiv\0"
    "\0"
-   /* _mesa_function_pool[17572]: PolygonOffset (offset 319) */
+   /* _mesa_function_pool[17594]: PolygonOffset (offset 319) */
    "ff\0"
    "glPolygonOffset\0"
    "\0"
-   /* _mesa_function_pool[17592]: BindVertexArray (will be remapped) */
+   /* _mesa_function_pool[17614]: BindVertexArray (will be remapped) */
    "i\0"
    "glBindVertexArray\0"
    "\0"
-   /* _mesa_function_pool[17613]: Color4ubVertex2fvSUN (dynamic) */
+   /* _mesa_function_pool[17635]: Color4ubVertex2fvSUN (dynamic) */
    "pp\0"
    "glColor4ubVertex2fvSUN\0"
    "\0"
-   /* _mesa_function_pool[17640]: ImageTransformParameterivHP (dynamic) */
+   /* _mesa_function_pool[17662]: ImageTransformParameterivHP (dynamic) */
    "iip\0"
    "glImageTransformParameterivHP\0"
    "\0"
-   /* _mesa_function_pool[17675]: Rectd (offset 86) */
+   /* _mesa_function_pool[17697]: Rectd (offset 86) */
    "dddd\0"
    "glRectd\0"
    "\0"
-   /* _mesa_function_pool[17689]: TexFilterFuncSGIS (dynamic) */
+   /* _mesa_function_pool[17711]: TexFilterFuncSGIS (dynamic) */
    "iiip\0"
    "glTexFilterFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[17715]: SampleMaskSGIS (will be remapped) */
+   /* _mesa_function_pool[17737]: SampleMaskSGIS (will be remapped) */
    "fi\0"
    "glSampleMaskSGIS\0"
    "glSampleMaskEXT\0"
    "\0"
-   /* _mesa_function_pool[17752]: Binormal3ivEXT (dynamic) */
+   /* _mesa_function_pool[17774]: Binormal3ivEXT (dynamic) */
    "p\0"
    "glBinormal3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[17772]: SamplerParameterfv (will be remapped) */
+   /* _mesa_function_pool[17794]: SamplerParameterfv (will be remapped) */
    "iip\0"
    "glSamplerParameterfv\0"
    "\0"
-   /* _mesa_function_pool[17798]: VertexAttribI4ubvEXT (will be remapped) */
+   /* _mesa_function_pool[17820]: VertexAttribI4ubvEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4ubvEXT\0"
    "glVertexAttribI4ubv\0"
    "\0"
-   /* _mesa_function_pool[17845]: GetAttribLocationARB (will be remapped) */
+   /* _mesa_function_pool[17867]: GetAttribLocationARB (will be remapped) */
    "ip\0"
    "glGetAttribLocation\0"
    "glGetAttribLocationARB\0"
    "\0"
-   /* _mesa_function_pool[17892]: RasterPos3i (offset 74) */
+   /* _mesa_function_pool[17914]: RasterPos3i (offset 74) */
    "iii\0"
    "glRasterPos3i\0"
    "\0"
-   /* _mesa_function_pool[17911]: VertexAttrib4ubvARB (will be remapped) */
+   /* _mesa_function_pool[17933]: VertexAttrib4ubvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4ubv\0"
    "glVertexAttrib4ubvARB\0"
    "\0"
-   /* _mesa_function_pool[17956]: DetailTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[17978]: DetailTexFuncSGIS (dynamic) */
    "iip\0"
    "glDetailTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[17981]: Normal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[18003]: Normal3fVertex3fSUN (dynamic) */
    "ffffff\0"
    "glNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[18011]: CopyTexImage2D (offset 324) */
+   /* _mesa_function_pool[18033]: CopyTexImage2D (offset 324) */
    "iiiiiiii\0"
    "glCopyTexImage2D\0"
    "glCopyTexImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[18058]: GetBufferPointervARB (will be remapped) */
+   /* _mesa_function_pool[18080]: GetBufferPointervARB (will be remapped) */
    "iip\0"
    "glGetBufferPointerv\0"
    "glGetBufferPointervARB\0"
    "\0"
-   /* _mesa_function_pool[18106]: ProgramEnvParameter4fARB (will be remapped) */
+   /* _mesa_function_pool[18128]: ProgramEnvParameter4fARB (will be remapped) */
    "iiffff\0"
    "glProgramEnvParameter4fARB\0"
    "glProgramParameter4fNV\0"
    "\0"
-   /* _mesa_function_pool[18164]: Uniform3ivARB (will be remapped) */
+   /* _mesa_function_pool[18186]: Uniform3ivARB (will be remapped) */
    "iip\0"
    "glUniform3iv\0"
    "glUniform3ivARB\0"
    "\0"
-   /* _mesa_function_pool[18198]: Lightfv (offset 160) */
+   /* _mesa_function_pool[18220]: Lightfv (offset 160) */
    "iip\0"
    "glLightfv\0"
    "\0"
-   /* _mesa_function_pool[18213]: PrimitiveRestartIndexNV (will be remapped) */
+   /* _mesa_function_pool[18235]: PrimitiveRestartIndexNV (will be remapped) */
    "i\0"
    "glPrimitiveRestartIndex\0"
    "glPrimitiveRestartIndexNV\0"
    "\0"
-   /* _mesa_function_pool[18266]: ClearDepth (offset 208) */
+   /* _mesa_function_pool[18288]: ClearDepth (offset 208) */
    "d\0"
    "glClearDepth\0"
    "\0"
-   /* _mesa_function_pool[18282]: GetFenceivNV (will be remapped) */
+   /* _mesa_function_pool[18304]: GetFenceivNV (will be remapped) */
    "iip\0"
    "glGetFenceivNV\0"
    "\0"
-   /* _mesa_function_pool[18302]: WindowPos4dvMESA (will be remapped) */
+   /* _mesa_function_pool[18324]: WindowPos4dvMESA (will be remapped) */
    "p\0"
    "glWindowPos4dvMESA\0"
    "\0"
-   /* _mesa_function_pool[18324]: ColorSubTable (offset 346) */
+   /* _mesa_function_pool[18346]: ColorSubTable (offset 346) */
    "iiiiip\0"
    "glColorSubTable\0"
    "glColorSubTableEXT\0"
    "\0"
-   /* _mesa_function_pool[18367]: Color4fv (offset 30) */
+   /* _mesa_function_pool[18389]: Color4fv (offset 30) */
    "p\0"
    "glColor4fv\0"
    "\0"
-   /* _mesa_function_pool[18381]: MultiTexCoord4ivARB (offset 405) */
+   /* _mesa_function_pool[18403]: MultiTexCoord4ivARB (offset 405) */
    "ip\0"
    "glMultiTexCoord4iv\0"
    "glMultiTexCoord4ivARB\0"
    "\0"
-   /* _mesa_function_pool[18426]: GetnMinmaxARB (will be remapped) */
+   /* _mesa_function_pool[18448]: GetnMinmaxARB (will be remapped) */
    "iiiiip\0"
    "glGetnMinmaxARB\0"
    "\0"
-   /* _mesa_function_pool[18450]: ProgramLocalParameters4fvEXT (will be remapped) */
+   /* _mesa_function_pool[18472]: ProgramLocalParameters4fvEXT (will be remapped) */
    "iiip\0"
    "glProgramLocalParameters4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[18487]: ColorPointer (offset 308) */
+   /* _mesa_function_pool[18509]: ColorPointer (offset 308) */
    "iiip\0"
    "glColorPointer\0"
    "\0"
-   /* _mesa_function_pool[18508]: Rects (offset 92) */
+   /* _mesa_function_pool[18530]: Rects (offset 92) */
    "iiii\0"
    "glRects\0"
    "\0"
-   /* _mesa_function_pool[18522]: GetMapAttribParameterfvNV (dynamic) */
+   /* _mesa_function_pool[18544]: GetMapAttribParameterfvNV (dynamic) */
    "iiip\0"
    "glGetMapAttribParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[18556]: MultiTexCoordP2ui (will be remapped) */
+   /* _mesa_function_pool[18578]: MultiTexCoordP2ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP2ui\0"
    "\0"
-   /* _mesa_function_pool[18581]: ActiveProgramEXT (will be remapped) */
+   /* _mesa_function_pool[18603]: ActiveProgramEXT (will be remapped) */
    "i\0"
    "glActiveProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[18603]: Lightiv (offset 162) */
+   /* _mesa_function_pool[18625]: Lightiv (offset 162) */
    "iip\0"
    "glLightiv\0"
    "\0"
-   /* _mesa_function_pool[18618]: VertexAttrib4sARB (will be remapped) */
+   /* _mesa_function_pool[18640]: VertexAttrib4sARB (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4s\0"
    "glVertexAttrib4sARB\0"
    "\0"
-   /* _mesa_function_pool[18662]: GetQueryObjectuivARB (will be remapped) */
+   /* _mesa_function_pool[18684]: GetQueryObjectuivARB (will be remapped) */
    "iip\0"
    "glGetQueryObjectuiv\0"
    "glGetQueryObjectuivARB\0"
    "\0"
-   /* _mesa_function_pool[18710]: GetTexParameteriv (offset 283) */
+   /* _mesa_function_pool[18732]: GetTexParameteriv (offset 283) */
    "iip\0"
    "glGetTexParameteriv\0"
    "\0"
-   /* _mesa_function_pool[18735]: MapParameterivNV (dynamic) */
+   /* _mesa_function_pool[18757]: MapParameterivNV (dynamic) */
    "iip\0"
    "glMapParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[18759]: GenRenderbuffersEXT (will be remapped) */
+   /* _mesa_function_pool[18781]: GenRenderbuffersEXT (will be remapped) */
    "ip\0"
    "glGenRenderbuffers\0"
    "glGenRenderbuffersEXT\0"
    "\0"
-   /* _mesa_function_pool[18804]: ClearBufferfv (will be remapped) */
+   /* _mesa_function_pool[18826]: ClearBufferfv (will be remapped) */
    "iip\0"
    "glClearBufferfv\0"
    "\0"
-   /* _mesa_function_pool[18825]: VertexAttrib2dvARB (will be remapped) */
+   /* _mesa_function_pool[18847]: VertexAttrib2dvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib2dv\0"
    "glVertexAttrib2dvARB\0"
    "\0"
-   /* _mesa_function_pool[18868]: EdgeFlagPointerEXT (will be remapped) */
+   /* _mesa_function_pool[18890]: EdgeFlagPointerEXT (will be remapped) */
    "iip\0"
    "glEdgeFlagPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[18894]: VertexAttribs2svNV (will be remapped) */
+   /* _mesa_function_pool[18916]: VertexAttribs2svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2svNV\0"
    "\0"
-   /* _mesa_function_pool[18920]: WeightbvARB (dynamic) */
+   /* _mesa_function_pool[18942]: WeightbvARB (dynamic) */
    "ip\0"
    "glWeightbvARB\0"
    "\0"
-   /* _mesa_function_pool[18938]: VertexAttrib2fvARB (will be remapped) */
+   /* _mesa_function_pool[18960]: VertexAttrib2fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib2fv\0"
    "glVertexAttrib2fvARB\0"
    "\0"
-   /* _mesa_function_pool[18981]: GetBufferParameterivARB (will be remapped) */
+   /* _mesa_function_pool[19003]: GetBufferParameterivARB (will be remapped) */
    "iip\0"
    "glGetBufferParameteriv\0"
    "glGetBufferParameterivARB\0"
    "\0"
-   /* _mesa_function_pool[19035]: Rectdv (offset 87) */
+   /* _mesa_function_pool[19057]: Rectdv (offset 87) */
    "pp\0"
    "glRectdv\0"
    "\0"
-   /* _mesa_function_pool[19048]: ListParameteriSGIX (dynamic) */
+   /* _mesa_function_pool[19070]: ListParameteriSGIX (dynamic) */
    "iii\0"
    "glListParameteriSGIX\0"
    "\0"
-   /* _mesa_function_pool[19074]: BlendEquationiARB (will be remapped) */
+   /* _mesa_function_pool[19096]: BlendEquationiARB (will be remapped) */
    "ii\0"
    "glBlendEquationiARB\0"
    "glBlendEquationIndexedAMD\0"
    "\0"
-   /* _mesa_function_pool[19124]: ReplacementCodeuiColor4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[19146]: ReplacementCodeuiColor4fNormal3fVertex3fSUN (dynamic) */
    "iffffffffff\0"
    "glReplacementCodeuiColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[19183]: InstrumentsBufferSGIX (dynamic) */
+   /* _mesa_function_pool[19205]: InstrumentsBufferSGIX (dynamic) */
    "ip\0"
    "glInstrumentsBufferSGIX\0"
    "\0"
-   /* _mesa_function_pool[19211]: VertexAttrib4NivARB (will be remapped) */
+   /* _mesa_function_pool[19233]: VertexAttrib4NivARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4Niv\0"
    "glVertexAttrib4NivARB\0"
    "\0"
-   /* _mesa_function_pool[19256]: DrawArraysInstancedARB (will be remapped) */
+   /* _mesa_function_pool[19278]: DrawArraysInstancedARB (will be remapped) */
    "iiii\0"
    "glDrawArraysInstancedARB\0"
    "glDrawArraysInstancedEXT\0"
    "glDrawArraysInstanced\0"
    "\0"
-   /* _mesa_function_pool[19334]: GetAttachedShaders (will be remapped) */
+   /* _mesa_function_pool[19356]: GetAttachedShaders (will be remapped) */
    "iipp\0"
    "glGetAttachedShaders\0"
    "\0"
-   /* _mesa_function_pool[19361]: GenVertexArraysAPPLE (will be remapped) */
+   /* _mesa_function_pool[19383]: GenVertexArraysAPPLE (will be remapped) */
    "ip\0"
    "glGenVertexArraysAPPLE\0"
    "\0"
-   /* _mesa_function_pool[19388]: ClearBufferfi (will be remapped) */
+   /* _mesa_function_pool[19410]: ClearBufferfi (will be remapped) */
    "iifi\0"
    "glClearBufferfi\0"
    "\0"
-   /* _mesa_function_pool[19410]: Materialiv (offset 172) */
+   /* _mesa_function_pool[19432]: Materialiv (offset 172) */
    "iip\0"
    "glMaterialiv\0"
    "\0"
-   /* _mesa_function_pool[19428]: PushClientAttrib (offset 335) */
+   /* _mesa_function_pool[19450]: PushClientAttrib (offset 335) */
    "i\0"
    "glPushClientAttrib\0"
    "\0"
-   /* _mesa_function_pool[19450]: SamplerParameteriv (will be remapped) */
+   /* _mesa_function_pool[19472]: SamplerParameteriv (will be remapped) */
    "iip\0"
    "glSamplerParameteriv\0"
    "\0"
-   /* _mesa_function_pool[19476]: TexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[19498]: TexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
    "pppp\0"
    "glTexCoord2fColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[19522]: WindowPos2iMESA (will be remapped) */
+   /* _mesa_function_pool[19544]: WindowPos2iMESA (will be remapped) */
    "ii\0"
    "glWindowPos2i\0"
    "glWindowPos2iARB\0"
    "glWindowPos2iMESA\0"
    "\0"
-   /* _mesa_function_pool[19575]: SecondaryColor3fvEXT (will be remapped) */
+   /* _mesa_function_pool[19597]: SecondaryColor3fvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3fv\0"
    "glSecondaryColor3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[19621]: PolygonMode (offset 174) */
+   /* _mesa_function_pool[19643]: PolygonMode (offset 174) */
    "ii\0"
    "glPolygonMode\0"
    "\0"
-   /* _mesa_function_pool[19639]: CompressedTexSubImage1DARB (will be remapped) */
+   /* _mesa_function_pool[19661]: CompressedTexSubImage1DARB (will be remapped) */
    "iiiiiip\0"
    "glCompressedTexSubImage1D\0"
    "glCompressedTexSubImage1DARB\0"
    "\0"
-   /* _mesa_function_pool[19703]: VertexAttrib2dvNV (will be remapped) */
+   /* _mesa_function_pool[19725]: VertexAttrib2dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2dvNV\0"
    "\0"
-   /* _mesa_function_pool[19727]: TexCoord2fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[19749]: TexCoord2fNormal3fVertex3fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord2fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[19769]: GetVertexAttribivNV (will be remapped) */
+   /* _mesa_function_pool[19791]: GetVertexAttribivNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribivNV\0"
    "\0"
-   /* _mesa_function_pool[19796]: GetProgramStringARB (will be remapped) */
+   /* _mesa_function_pool[19818]: GetProgramStringARB (will be remapped) */
    "iip\0"
    "glGetProgramStringARB\0"
    "\0"
-   /* _mesa_function_pool[19823]: GetnUniformdvARB (will be remapped) */
+   /* _mesa_function_pool[19845]: GetnUniformdvARB (will be remapped) */
    "iiip\0"
    "glGetnUniformdvARB\0"
    "\0"
-   /* _mesa_function_pool[19848]: DrawElementsInstancedBaseVertex (will be remapped) */
+   /* _mesa_function_pool[19870]: DrawElementsInstancedBaseVertex (will be remapped) */
    "iiipii\0"
    "glDrawElementsInstancedBaseVertex\0"
    "\0"
-   /* _mesa_function_pool[19890]: PauseTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[19912]: PauseTransformFeedback (will be remapped) */
    "\0"
    "glPauseTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[19917]: VertexAttribIPointerEXT (will be remapped) */
+   /* _mesa_function_pool[19939]: VertexAttribIPointerEXT (will be remapped) */
    "iiiip\0"
    "glVertexAttribIPointerEXT\0"
    "glVertexAttribIPointer\0"
    "\0"
-   /* _mesa_function_pool[19973]: TexBumpParameterfvATI (will be remapped) */
+   /* _mesa_function_pool[19995]: TexBumpParameterfvATI (will be remapped) */
    "ip\0"
    "glTexBumpParameterfvATI\0"
    "\0"
-   /* _mesa_function_pool[20001]: Tangent3ivEXT (dynamic) */
+   /* _mesa_function_pool[20023]: Tangent3ivEXT (dynamic) */
    "p\0"
    "glTangent3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[20020]: CompileShaderARB (will be remapped) */
+   /* _mesa_function_pool[20042]: CompileShaderARB (will be remapped) */
    "i\0"
    "glCompileShader\0"
    "glCompileShaderARB\0"
    "\0"
-   /* _mesa_function_pool[20058]: DeleteShader (will be remapped) */
+   /* _mesa_function_pool[20080]: DeleteShader (will be remapped) */
    "i\0"
    "glDeleteShader\0"
    "\0"
-   /* _mesa_function_pool[20076]: DisableClientState (offset 309) */
+   /* _mesa_function_pool[20098]: DisableClientState (offset 309) */
    "i\0"
    "glDisableClientState\0"
    "\0"
-   /* _mesa_function_pool[20100]: TexGeni (offset 192) */
+   /* _mesa_function_pool[20122]: TexGeni (offset 192) */
    "iii\0"
    "glTexGeni\0"
    "\0"
-   /* _mesa_function_pool[20115]: TexGenf (offset 190) */
+   /* _mesa_function_pool[20137]: TexGenf (offset 190) */
    "iif\0"
    "glTexGenf\0"
    "\0"
-   /* _mesa_function_pool[20130]: Uniform3fARB (will be remapped) */
+   /* _mesa_function_pool[20152]: Uniform3fARB (will be remapped) */
    "ifff\0"
    "glUniform3f\0"
    "glUniform3fARB\0"
    "\0"
-   /* _mesa_function_pool[20163]: TexGend (offset 188) */
+   /* _mesa_function_pool[20185]: TexGend (offset 188) */
    "iid\0"
    "glTexGend\0"
    "\0"
-   /* _mesa_function_pool[20178]: ListParameterfvSGIX (dynamic) */
+   /* _mesa_function_pool[20200]: ListParameterfvSGIX (dynamic) */
    "iip\0"
    "glListParameterfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[20205]: GetPolygonStipple (offset 274) */
+   /* _mesa_function_pool[20227]: GetPolygonStipple (offset 274) */
    "p\0"
    "glGetPolygonStipple\0"
    "\0"
-   /* _mesa_function_pool[20228]: Tangent3dvEXT (dynamic) */
+   /* _mesa_function_pool[20250]: Tangent3dvEXT (dynamic) */
    "p\0"
    "glTangent3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[20247]: GetVertexAttribfvNV (will be remapped) */
+   /* _mesa_function_pool[20269]: GetVertexAttribfvNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribfvNV\0"
    "\0"
-   /* _mesa_function_pool[20274]: WindowPos3sMESA (will be remapped) */
+   /* _mesa_function_pool[20296]: WindowPos3sMESA (will be remapped) */
    "iii\0"
    "glWindowPos3s\0"
    "glWindowPos3sARB\0"
    "glWindowPos3sMESA\0"
    "\0"
-   /* _mesa_function_pool[20328]: VertexAttrib2svNV (will be remapped) */
+   /* _mesa_function_pool[20350]: VertexAttrib2svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2svNV\0"
    "\0"
-   /* _mesa_function_pool[20352]: NormalP3uiv (will be remapped) */
+   /* _mesa_function_pool[20374]: NormalP3uiv (will be remapped) */
    "ip\0"
    "glNormalP3uiv\0"
    "\0"
-   /* _mesa_function_pool[20370]: SecondaryColorP3uiv (will be remapped) */
+   /* _mesa_function_pool[20392]: SecondaryColorP3uiv (will be remapped) */
    "ip\0"
    "glSecondaryColorP3uiv\0"
    "\0"
-   /* _mesa_function_pool[20396]: VertexAttribs1fvNV (will be remapped) */
+   /* _mesa_function_pool[20418]: VertexAttribs1fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs1fvNV\0"
    "\0"
-   /* _mesa_function_pool[20422]: TexCoord2fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[20444]: TexCoord2fVertex3fvSUN (dynamic) */
    "pp\0"
    "glTexCoord2fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[20451]: WindowPos4sMESA (will be remapped) */
+   /* _mesa_function_pool[20473]: WindowPos4sMESA (will be remapped) */
    "iiii\0"
    "glWindowPos4sMESA\0"
    "\0"
-   /* _mesa_function_pool[20475]: GetnPixelMapuivARB (will be remapped) */
+   /* _mesa_function_pool[20497]: GetnPixelMapuivARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapuivARB\0"
    "\0"
-   /* _mesa_function_pool[20501]: VertexAttrib4NuivARB (will be remapped) */
+   /* _mesa_function_pool[20523]: VertexAttrib4NuivARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nuiv\0"
    "glVertexAttrib4NuivARB\0"
    "\0"
-   /* _mesa_function_pool[20548]: ClientActiveTextureARB (offset 375) */
+   /* _mesa_function_pool[20570]: ClientActiveTextureARB (offset 375) */
    "i\0"
    "glClientActiveTexture\0"
    "glClientActiveTextureARB\0"
    "\0"
-   /* _mesa_function_pool[20598]: GetSamplerParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[20620]: GetSamplerParameterIuiv (will be remapped) */
    "iip\0"
    "glGetSamplerParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[20629]: ReplacementCodeusvSUN (dynamic) */
+   /* _mesa_function_pool[20651]: ReplacementCodeusvSUN (dynamic) */
    "p\0"
    "glReplacementCodeusvSUN\0"
    "\0"
-   /* _mesa_function_pool[20656]: Uniform4fARB (will be remapped) */
+   /* _mesa_function_pool[20678]: Uniform4fARB (will be remapped) */
    "iffff\0"
    "glUniform4f\0"
    "glUniform4fARB\0"
    "\0"
-   /* _mesa_function_pool[20690]: Color4sv (offset 34) */
+   /* _mesa_function_pool[20712]: Color4sv (offset 34) */
    "p\0"
    "glColor4sv\0"
    "\0"
-   /* _mesa_function_pool[20704]: FlushMappedBufferRange (will be remapped) */
+   /* _mesa_function_pool[20726]: FlushMappedBufferRange (will be remapped) */
    "iii\0"
    "glFlushMappedBufferRange\0"
    "\0"
-   /* _mesa_function_pool[20734]: IsProgramNV (will be remapped) */
+   /* _mesa_function_pool[20756]: IsProgramNV (will be remapped) */
    "i\0"
    "glIsProgramARB\0"
    "glIsProgramNV\0"
    "\0"
-   /* _mesa_function_pool[20766]: FlushMappedBufferRangeAPPLE (will be remapped) */
+   /* _mesa_function_pool[20788]: FlushMappedBufferRangeAPPLE (will be remapped) */
    "iii\0"
    "glFlushMappedBufferRangeAPPLE\0"
    "\0"
-   /* _mesa_function_pool[20801]: PixelZoom (offset 246) */
+   /* _mesa_function_pool[20823]: PixelZoom (offset 246) */
    "ff\0"
    "glPixelZoom\0"
    "\0"
-   /* _mesa_function_pool[20817]: ReplacementCodePointerSUN (dynamic) */
+   /* _mesa_function_pool[20839]: ReplacementCodePointerSUN (dynamic) */
    "iip\0"
    "glReplacementCodePointerSUN\0"
    "\0"
-   /* _mesa_function_pool[20850]: ProgramEnvParameter4dARB (will be remapped) */
+   /* _mesa_function_pool[20872]: ProgramEnvParameter4dARB (will be remapped) */
    "iidddd\0"
    "glProgramEnvParameter4dARB\0"
    "glProgramParameter4dNV\0"
    "\0"
-   /* _mesa_function_pool[20908]: ColorTableParameterfv (offset 340) */
+   /* _mesa_function_pool[20930]: ColorTableParameterfv (offset 340) */
    "iip\0"
    "glColorTableParameterfv\0"
    "glColorTableParameterfvSGI\0"
    "\0"
-   /* _mesa_function_pool[20964]: FragmentLightModelfSGIX (dynamic) */
+   /* _mesa_function_pool[20986]: FragmentLightModelfSGIX (dynamic) */
    "if\0"
    "glFragmentLightModelfSGIX\0"
    "\0"
-   /* _mesa_function_pool[20994]: Binormal3bvEXT (dynamic) */
+   /* _mesa_function_pool[21016]: Binormal3bvEXT (dynamic) */
    "p\0"
    "glBinormal3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[21014]: PixelMapuiv (offset 252) */
+   /* _mesa_function_pool[21036]: PixelMapuiv (offset 252) */
    "iip\0"
    "glPixelMapuiv\0"
    "\0"
-   /* _mesa_function_pool[21033]: Color3dv (offset 12) */
+   /* _mesa_function_pool[21055]: Color3dv (offset 12) */
    "p\0"
    "glColor3dv\0"
    "\0"
-   /* _mesa_function_pool[21047]: IsTexture (offset 330) */
+   /* _mesa_function_pool[21069]: IsTexture (offset 330) */
    "i\0"
    "glIsTexture\0"
    "glIsTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[21077]: GenSamplers (will be remapped) */
+   /* _mesa_function_pool[21099]: GenSamplers (will be remapped) */
    "ip\0"
    "glGenSamplers\0"
    "\0"
-   /* _mesa_function_pool[21095]: ColorPointerEXT (will be remapped) */
+   /* _mesa_function_pool[21117]: ColorPointerEXT (will be remapped) */
    "iiiip\0"
    "glColorPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[21120]: VertexWeightfvEXT (dynamic) */
+   /* _mesa_function_pool[21142]: VertexWeightfvEXT (dynamic) */
    "p\0"
    "glVertexWeightfvEXT\0"
    "\0"
-   /* _mesa_function_pool[21143]: VertexAttrib1dARB (will be remapped) */
+   /* _mesa_function_pool[21165]: VertexAttrib1dARB (will be remapped) */
    "id\0"
    "glVertexAttrib1d\0"
    "glVertexAttrib1dARB\0"
    "\0"
-   /* _mesa_function_pool[21184]: VertexP3uiv (will be remapped) */
+   /* _mesa_function_pool[21206]: VertexP3uiv (will be remapped) */
    "ip\0"
    "glVertexP3uiv\0"
    "\0"
-   /* _mesa_function_pool[21202]: TexCoord4i (offset 122) */
+   /* _mesa_function_pool[21224]: TexCoord4i (offset 122) */
    "iiii\0"
    "glTexCoord4i\0"
    "\0"
-   /* _mesa_function_pool[21221]: DeleteQueriesARB (will be remapped) */
+   /* _mesa_function_pool[21243]: DeleteQueriesARB (will be remapped) */
    "ip\0"
    "glDeleteQueries\0"
    "glDeleteQueriesARB\0"
    "\0"
-   /* _mesa_function_pool[21260]: Color4ubVertex2fSUN (dynamic) */
+   /* _mesa_function_pool[21282]: Color4ubVertex2fSUN (dynamic) */
    "iiiiff\0"
    "glColor4ubVertex2fSUN\0"
    "\0"
-   /* _mesa_function_pool[21290]: FragmentColorMaterialSGIX (dynamic) */
+   /* _mesa_function_pool[21312]: FragmentColorMaterialSGIX (dynamic) */
    "ii\0"
    "glFragmentColorMaterialSGIX\0"
    "\0"
-   /* _mesa_function_pool[21322]: CurrentPaletteMatrixARB (dynamic) */
+   /* _mesa_function_pool[21344]: CurrentPaletteMatrixARB (dynamic) */
    "i\0"
    "glCurrentPaletteMatrixARB\0"
    "\0"
-   /* _mesa_function_pool[21351]: GetMapdv (offset 266) */
+   /* _mesa_function_pool[21373]: GetMapdv (offset 266) */
    "iip\0"
    "glGetMapdv\0"
    "\0"
-   /* _mesa_function_pool[21367]: ObjectPurgeableAPPLE (will be remapped) */
+   /* _mesa_function_pool[21389]: ObjectPurgeableAPPLE (will be remapped) */
    "iii\0"
    "glObjectPurgeableAPPLE\0"
    "\0"
-   /* _mesa_function_pool[21395]: GetStringi (will be remapped) */
+   /* _mesa_function_pool[21417]: GetStringi (will be remapped) */
    "ii\0"
    "glGetStringi\0"
    "\0"
-   /* _mesa_function_pool[21412]: SamplePatternSGIS (will be remapped) */
+   /* _mesa_function_pool[21434]: SamplePatternSGIS (will be remapped) */
    "i\0"
    "glSamplePatternSGIS\0"
    "glSamplePatternEXT\0"
    "\0"
-   /* _mesa_function_pool[21454]: PixelStoref (offset 249) */
+   /* _mesa_function_pool[21476]: PixelStoref (offset 249) */
    "if\0"
    "glPixelStoref\0"
    "\0"
-   /* _mesa_function_pool[21472]: IsQueryARB (will be remapped) */
+   /* _mesa_function_pool[21494]: IsQueryARB (will be remapped) */
    "i\0"
    "glIsQuery\0"
    "glIsQueryARB\0"
    "\0"
-   /* _mesa_function_pool[21498]: ReplacementCodeuiColor4ubVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[21520]: ReplacementCodeuiColor4ubVertex3fSUN (dynamic) */
    "iiiiifff\0"
    "glReplacementCodeuiColor4ubVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[21547]: PixelStorei (offset 250) */
+   /* _mesa_function_pool[21569]: PixelStorei (offset 250) */
    "ii\0"
    "glPixelStorei\0"
    "\0"
-   /* _mesa_function_pool[21565]: VertexAttrib4usvARB (will be remapped) */
+   /* _mesa_function_pool[21587]: VertexAttrib4usvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4usv\0"
    "glVertexAttrib4usvARB\0"
    "\0"
-   /* _mesa_function_pool[21610]: LinkProgramARB (will be remapped) */
+   /* _mesa_function_pool[21632]: LinkProgramARB (will be remapped) */
    "i\0"
    "glLinkProgram\0"
    "glLinkProgramARB\0"
    "\0"
-   /* _mesa_function_pool[21644]: VertexAttrib2fNV (will be remapped) */
+   /* _mesa_function_pool[21666]: VertexAttrib2fNV (will be remapped) */
    "iff\0"
    "glVertexAttrib2fNV\0"
    "\0"
-   /* _mesa_function_pool[21668]: ShaderSourceARB (will be remapped) */
+   /* _mesa_function_pool[21690]: ShaderSourceARB (will be remapped) */
    "iipp\0"
    "glShaderSource\0"
    "glShaderSourceARB\0"
    "\0"
-   /* _mesa_function_pool[21707]: FragmentMaterialiSGIX (dynamic) */
+   /* _mesa_function_pool[21729]: FragmentMaterialiSGIX (dynamic) */
    "iii\0"
    "glFragmentMaterialiSGIX\0"
    "\0"
-   /* _mesa_function_pool[21736]: EvalCoord2dv (offset 233) */
+   /* _mesa_function_pool[21758]: EvalCoord2dv (offset 233) */
    "p\0"
    "glEvalCoord2dv\0"
    "\0"
-   /* _mesa_function_pool[21754]: VertexAttrib3svARB (will be remapped) */
+   /* _mesa_function_pool[21776]: VertexAttrib3svARB (will be remapped) */
    "ip\0"
    "glVertexAttrib3sv\0"
    "glVertexAttrib3svARB\0"
    "\0"
-   /* _mesa_function_pool[21797]: ColorMaterial (offset 151) */
+   /* _mesa_function_pool[21819]: ColorMaterial (offset 151) */
    "ii\0"
    "glColorMaterial\0"
    "\0"
-   /* _mesa_function_pool[21817]: CompressedTexSubImage3DARB (will be remapped) */
+   /* _mesa_function_pool[21839]: CompressedTexSubImage3DARB (will be remapped) */
    "iiiiiiiiiip\0"
    "glCompressedTexSubImage3D\0"
    "glCompressedTexSubImage3DARB\0"
    "\0"
-   /* _mesa_function_pool[21885]: WindowPos2ivMESA (will be remapped) */
+   /* _mesa_function_pool[21907]: WindowPos2ivMESA (will be remapped) */
    "p\0"
    "glWindowPos2iv\0"
    "glWindowPos2ivARB\0"
    "glWindowPos2ivMESA\0"
    "\0"
-   /* _mesa_function_pool[21940]: IsFramebufferEXT (will be remapped) */
+   /* _mesa_function_pool[21962]: IsFramebufferEXT (will be remapped) */
    "i\0"
    "glIsFramebuffer\0"
    "glIsFramebufferEXT\0"
    "\0"
-   /* _mesa_function_pool[21978]: Uniform4ivARB (will be remapped) */
+   /* _mesa_function_pool[22000]: Uniform4ivARB (will be remapped) */
    "iip\0"
    "glUniform4iv\0"
    "glUniform4ivARB\0"
    "\0"
-   /* _mesa_function_pool[22012]: GetVertexAttribdvARB (will be remapped) */
+   /* _mesa_function_pool[22034]: GetVertexAttribdvARB (will be remapped) */
    "iip\0"
    "glGetVertexAttribdv\0"
    "glGetVertexAttribdvARB\0"
    "\0"
-   /* _mesa_function_pool[22060]: TexBumpParameterivATI (will be remapped) */
+   /* _mesa_function_pool[22082]: TexBumpParameterivATI (will be remapped) */
    "ip\0"
    "glTexBumpParameterivATI\0"
    "\0"
-   /* _mesa_function_pool[22088]: GetSeparableFilter (offset 359) */
+   /* _mesa_function_pool[22110]: GetSeparableFilter (offset 359) */
    "iiippp\0"
    "glGetSeparableFilter\0"
    "glGetSeparableFilterEXT\0"
    "\0"
-   /* _mesa_function_pool[22141]: Binormal3dEXT (dynamic) */
+   /* _mesa_function_pool[22163]: Binormal3dEXT (dynamic) */
    "ddd\0"
    "glBinormal3dEXT\0"
    "\0"
-   /* _mesa_function_pool[22162]: SpriteParameteriSGIX (dynamic) */
+   /* _mesa_function_pool[22184]: SpriteParameteriSGIX (dynamic) */
    "ii\0"
    "glSpriteParameteriSGIX\0"
    "\0"
-   /* _mesa_function_pool[22189]: RequestResidentProgramsNV (will be remapped) */
+   /* _mesa_function_pool[22211]: RequestResidentProgramsNV (will be remapped) */
    "ip\0"
    "glRequestResidentProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[22221]: TexCoordP3uiv (will be remapped) */
+   /* _mesa_function_pool[22243]: TexCoordP3uiv (will be remapped) */
    "ip\0"
    "glTexCoordP3uiv\0"
    "\0"
-   /* _mesa_function_pool[22241]: ReplacementCodeusSUN (dynamic) */
+   /* _mesa_function_pool[22263]: ReplacementCodeusSUN (dynamic) */
    "i\0"
    "glReplacementCodeusSUN\0"
    "\0"
-   /* _mesa_function_pool[22267]: FeedbackBuffer (offset 194) */
+   /* _mesa_function_pool[22289]: FeedbackBuffer (offset 194) */
    "iip\0"
    "glFeedbackBuffer\0"
    "\0"
-   /* _mesa_function_pool[22289]: RasterPos2iv (offset 67) */
+   /* _mesa_function_pool[22311]: RasterPos2iv (offset 67) */
    "p\0"
    "glRasterPos2iv\0"
    "\0"
-   /* _mesa_function_pool[22307]: TexImage1D (offset 182) */
+   /* _mesa_function_pool[22329]: TexImage1D (offset 182) */
    "iiiiiiip\0"
    "glTexImage1D\0"
    "\0"
-   /* _mesa_function_pool[22330]: ListParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[22352]: ListParameterivSGIX (dynamic) */
    "iip\0"
    "glListParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[22357]: MultiDrawElementsEXT (will be remapped) */
+   /* _mesa_function_pool[22379]: MultiDrawElementsEXT (will be remapped) */
    "ipipi\0"
    "glMultiDrawElements\0"
    "glMultiDrawElementsEXT\0"
    "\0"
-   /* _mesa_function_pool[22407]: Color3s (offset 17) */
+   /* _mesa_function_pool[22429]: Color3s (offset 17) */
    "iii\0"
    "glColor3s\0"
    "\0"
-   /* _mesa_function_pool[22422]: Uniform1ivARB (will be remapped) */
+   /* _mesa_function_pool[22444]: Uniform1ivARB (will be remapped) */
    "iip\0"
    "glUniform1iv\0"
    "glUniform1ivARB\0"
    "\0"
-   /* _mesa_function_pool[22456]: WindowPos2sMESA (will be remapped) */
+   /* _mesa_function_pool[22478]: WindowPos2sMESA (will be remapped) */
    "ii\0"
    "glWindowPos2s\0"
    "glWindowPos2sARB\0"
    "glWindowPos2sMESA\0"
    "\0"
-   /* _mesa_function_pool[22509]: WeightusvARB (dynamic) */
+   /* _mesa_function_pool[22531]: WeightusvARB (dynamic) */
    "ip\0"
    "glWeightusvARB\0"
    "\0"
-   /* _mesa_function_pool[22528]: ColorP4ui (will be remapped) */
+   /* _mesa_function_pool[22550]: ColorP4ui (will be remapped) */
    "ii\0"
    "glColorP4ui\0"
    "\0"
-   /* _mesa_function_pool[22544]: TexCoordPointer (offset 320) */
+   /* _mesa_function_pool[22566]: TexCoordPointer (offset 320) */
    "iiip\0"
    "glTexCoordPointer\0"
    "\0"
-   /* _mesa_function_pool[22568]: FogCoordPointerEXT (will be remapped) */
+   /* _mesa_function_pool[22590]: FogCoordPointerEXT (will be remapped) */
    "iip\0"
    "glFogCoordPointer\0"
    "glFogCoordPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[22612]: GetnSeparableFilterARB (will be remapped) */
+   /* _mesa_function_pool[22634]: GetnSeparableFilterARB (will be remapped) */
    "iiiipipp\0"
    "glGetnSeparableFilterARB\0"
    "\0"
-   /* _mesa_function_pool[22647]: IndexMaterialEXT (dynamic) */
+   /* _mesa_function_pool[22669]: IndexMaterialEXT (dynamic) */
    "ii\0"
    "glIndexMaterialEXT\0"
    "\0"
-   /* _mesa_function_pool[22670]: Color3i (offset 15) */
+   /* _mesa_function_pool[22692]: Color3i (offset 15) */
    "iii\0"
    "glColor3i\0"
    "\0"
-   /* _mesa_function_pool[22685]: FrontFace (offset 157) */
+   /* _mesa_function_pool[22707]: FrontFace (offset 157) */
    "i\0"
    "glFrontFace\0"
    "\0"
-   /* _mesa_function_pool[22700]: EvalCoord2d (offset 232) */
+   /* _mesa_function_pool[22722]: EvalCoord2d (offset 232) */
    "dd\0"
    "glEvalCoord2d\0"
    "\0"
-   /* _mesa_function_pool[22718]: SecondaryColor3ubvEXT (will be remapped) */
+   /* _mesa_function_pool[22740]: SecondaryColor3ubvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3ubv\0"
    "glSecondaryColor3ubvEXT\0"
    "\0"
-   /* _mesa_function_pool[22766]: EvalCoord2f (offset 234) */
+   /* _mesa_function_pool[22788]: EvalCoord2f (offset 234) */
    "ff\0"
    "glEvalCoord2f\0"
    "\0"
-   /* _mesa_function_pool[22784]: VertexAttrib4dvARB (will be remapped) */
+   /* _mesa_function_pool[22806]: VertexAttrib4dvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4dv\0"
    "glVertexAttrib4dvARB\0"
    "\0"
-   /* _mesa_function_pool[22827]: BindAttribLocationARB (will be remapped) */
+   /* _mesa_function_pool[22849]: BindAttribLocationARB (will be remapped) */
    "iip\0"
    "glBindAttribLocation\0"
    "glBindAttribLocationARB\0"
    "\0"
-   /* _mesa_function_pool[22877]: Color3b (offset 9) */
+   /* _mesa_function_pool[22899]: Color3b (offset 9) */
    "iii\0"
    "glColor3b\0"
    "\0"
-   /* _mesa_function_pool[22892]: MultiTexCoord2dARB (offset 384) */
+   /* _mesa_function_pool[22914]: MultiTexCoord2dARB (offset 384) */
    "idd\0"
    "glMultiTexCoord2d\0"
    "glMultiTexCoord2dARB\0"
    "\0"
-   /* _mesa_function_pool[22936]: ExecuteProgramNV (will be remapped) */
+   /* _mesa_function_pool[22958]: ExecuteProgramNV (will be remapped) */
    "iip\0"
    "glExecuteProgramNV\0"
    "\0"
-   /* _mesa_function_pool[22960]: Color3f (offset 13) */
+   /* _mesa_function_pool[22982]: Color3f (offset 13) */
    "fff\0"
    "glColor3f\0"
    "\0"
-   /* _mesa_function_pool[22975]: LightEnviSGIX (dynamic) */
+   /* _mesa_function_pool[22997]: LightEnviSGIX (dynamic) */
    "ii\0"
    "glLightEnviSGIX\0"
    "\0"
-   /* _mesa_function_pool[22995]: Color3d (offset 11) */
+   /* _mesa_function_pool[23017]: Color3d (offset 11) */
    "ddd\0"
    "glColor3d\0"
    "\0"
-   /* _mesa_function_pool[23010]: TextureBarrierNV (will be remapped) */
+   /* _mesa_function_pool[23032]: TextureBarrierNV (will be remapped) */
    "\0"
    "glTextureBarrierNV\0"
    "\0"
-   /* _mesa_function_pool[23031]: Normal3dv (offset 55) */
+   /* _mesa_function_pool[23053]: Normal3dv (offset 55) */
    "p\0"
    "glNormal3dv\0"
    "\0"
-   /* _mesa_function_pool[23046]: Lightf (offset 159) */
+   /* _mesa_function_pool[23068]: Lightf (offset 159) */
    "iif\0"
    "glLightf\0"
    "\0"
-   /* _mesa_function_pool[23060]: ReplacementCodeuiSUN (dynamic) */
+   /* _mesa_function_pool[23082]: ReplacementCodeuiSUN (dynamic) */
    "i\0"
    "glReplacementCodeuiSUN\0"
    "\0"
-   /* _mesa_function_pool[23086]: MatrixMode (offset 293) */
+   /* _mesa_function_pool[23108]: MatrixMode (offset 293) */
    "i\0"
    "glMatrixMode\0"
    "\0"
-   /* _mesa_function_pool[23102]: GetPixelMapusv (offset 273) */
+   /* _mesa_function_pool[23124]: GetPixelMapusv (offset 273) */
    "ip\0"
    "glGetPixelMapusv\0"
    "\0"
-   /* _mesa_function_pool[23123]: Lighti (offset 161) */
+   /* _mesa_function_pool[23145]: Lighti (offset 161) */
    "iii\0"
    "glLighti\0"
    "\0"
-   /* _mesa_function_pool[23137]: VertexAttribPointerNV (will be remapped) */
+   /* _mesa_function_pool[23159]: VertexAttribPointerNV (will be remapped) */
    "iiiip\0"
    "glVertexAttribPointerNV\0"
    "\0"
-   /* _mesa_function_pool[23168]: ClearDepthf (will be remapped) */
+   /* _mesa_function_pool[23190]: ClearDepthf (will be remapped) */
    "f\0"
    "glClearDepthf\0"
    "\0"
-   /* _mesa_function_pool[23185]: GetFragDataIndex (will be remapped) */
+   /* _mesa_function_pool[23207]: GetFragDataIndex (will be remapped) */
    "ip\0"
    "glGetFragDataIndex\0"
    "\0"
-   /* _mesa_function_pool[23208]: GetBooleanIndexedvEXT (will be remapped) */
+   /* _mesa_function_pool[23230]: GetBooleanIndexedvEXT (will be remapped) */
    "iip\0"
    "glGetBooleanIndexedvEXT\0"
    "glGetBooleani_v\0"
    "\0"
-   /* _mesa_function_pool[23253]: GetFramebufferAttachmentParameterivEXT (will be remapped) */
+   /* _mesa_function_pool[23275]: GetFramebufferAttachmentParameterivEXT (will be remapped) */
    "iiip\0"
    "glGetFramebufferAttachmentParameteriv\0"
    "glGetFramebufferAttachmentParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[23338]: PixelTransformParameterfEXT (dynamic) */
+   /* _mesa_function_pool[23360]: PixelTransformParameterfEXT (dynamic) */
    "iif\0"
    "glPixelTransformParameterfEXT\0"
    "\0"
-   /* _mesa_function_pool[23373]: MultiTexCoord4dvARB (offset 401) */
+   /* _mesa_function_pool[23395]: MultiTexCoord4dvARB (offset 401) */
    "ip\0"
    "glMultiTexCoord4dv\0"
    "glMultiTexCoord4dvARB\0"
    "\0"
-   /* _mesa_function_pool[23418]: PixelTransformParameteriEXT (dynamic) */
+   /* _mesa_function_pool[23440]: PixelTransformParameteriEXT (dynamic) */
    "iii\0"
    "glPixelTransformParameteriEXT\0"
    "\0"
-   /* _mesa_function_pool[23453]: GetDoublev (offset 260) */
+   /* _mesa_function_pool[23475]: GetDoublev (offset 260) */
    "ip\0"
    "glGetDoublev\0"
    "\0"
-   /* _mesa_function_pool[23470]: MultiTexCoordP4ui (will be remapped) */
+   /* _mesa_function_pool[23492]: MultiTexCoordP4ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP4ui\0"
    "\0"
-   /* _mesa_function_pool[23495]: MultMatrixd (offset 295) */
+   /* _mesa_function_pool[23517]: MultMatrixd (offset 295) */
    "p\0"
    "glMultMatrixd\0"
    "\0"
-   /* _mesa_function_pool[23512]: MultMatrixf (offset 294) */
+   /* _mesa_function_pool[23534]: MultMatrixf (offset 294) */
    "p\0"
    "glMultMatrixf\0"
    "\0"
-   /* _mesa_function_pool[23529]: VertexAttribI4bvEXT (will be remapped) */
+   /* _mesa_function_pool[23551]: VertexAttribI4bvEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4bvEXT\0"
    "glVertexAttribI4bv\0"
    "\0"
-   /* _mesa_function_pool[23574]: TexCoord2fColor4ubVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[23596]: TexCoord2fColor4ubVertex3fSUN (dynamic) */
    "ffiiiifff\0"
    "glTexCoord2fColor4ubVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[23617]: Uniform1iARB (will be remapped) */
+   /* _mesa_function_pool[23639]: Uniform1iARB (will be remapped) */
    "ii\0"
    "glUniform1i\0"
    "glUniform1iARB\0"
    "\0"
-   /* _mesa_function_pool[23648]: GetnMapfvARB (will be remapped) */
+   /* _mesa_function_pool[23670]: GetnMapfvARB (will be remapped) */
    "iiip\0"
    "glGetnMapfvARB\0"
    "\0"
-   /* _mesa_function_pool[23669]: VertexAttribPointerARB (will be remapped) */
+   /* _mesa_function_pool[23691]: VertexAttribPointerARB (will be remapped) */
    "iiiiip\0"
    "glVertexAttribPointer\0"
    "glVertexAttribPointerARB\0"
    "\0"
-   /* _mesa_function_pool[23724]: SharpenTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[23746]: SharpenTexFuncSGIS (dynamic) */
    "iip\0"
    "glSharpenTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[23750]: MultiTexCoord4fvARB (offset 403) */
+   /* _mesa_function_pool[23772]: MultiTexCoord4fvARB (offset 403) */
    "ip\0"
    "glMultiTexCoord4fv\0"
    "glMultiTexCoord4fvARB\0"
    "\0"
-   /* _mesa_function_pool[23795]: Uniform2uiEXT (will be remapped) */
+   /* _mesa_function_pool[23817]: Uniform2uiEXT (will be remapped) */
    "iii\0"
    "glUniform2uiEXT\0"
    "glUniform2ui\0"
    "\0"
-   /* _mesa_function_pool[23829]: TagSampleBufferSGIX (dynamic) */
+   /* _mesa_function_pool[23851]: TagSampleBufferSGIX (dynamic) */
    "\0"
    "glTagSampleBufferSGIX\0"
    "\0"
-   /* _mesa_function_pool[23853]: UniformMatrix2x3fv (will be remapped) */
+   /* _mesa_function_pool[23875]: UniformMatrix2x3fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2x3fv\0"
    "\0"
-   /* _mesa_function_pool[23880]: SamplerParameteri (will be remapped) */
+   /* _mesa_function_pool[23902]: SamplerParameteri (will be remapped) */
    "iii\0"
    "glSamplerParameteri\0"
    "\0"
-   /* _mesa_function_pool[23905]: SamplerParameterf (will be remapped) */
+   /* _mesa_function_pool[23927]: SamplerParameterf (will be remapped) */
    "iif\0"
    "glSamplerParameterf\0"
    "\0"
-   /* _mesa_function_pool[23930]: CombinerParameteriNV (will be remapped) */
+   /* _mesa_function_pool[23952]: CombinerParameteriNV (will be remapped) */
    "ii\0"
    "glCombinerParameteriNV\0"
    "\0"
-   /* _mesa_function_pool[23957]: DeleteAsyncMarkersSGIX (dynamic) */
+   /* _mesa_function_pool[23979]: DeleteAsyncMarkersSGIX (dynamic) */
    "ii\0"
    "glDeleteAsyncMarkersSGIX\0"
    "\0"
-   /* _mesa_function_pool[23986]: TransformFeedbackVaryingsEXT (will be remapped) */
+   /* _mesa_function_pool[24008]: TransformFeedbackVaryingsEXT (will be remapped) */
    "iipi\0"
    "glTransformFeedbackVaryings\0"
    "glTransformFeedbackVaryingsEXT\0"
    "\0"
-   /* _mesa_function_pool[24051]: IsAsyncMarkerSGIX (dynamic) */
+   /* _mesa_function_pool[24073]: IsAsyncMarkerSGIX (dynamic) */
    "i\0"
    "glIsAsyncMarkerSGIX\0"
    "\0"
-   /* _mesa_function_pool[24074]: FrameZoomSGIX (dynamic) */
+   /* _mesa_function_pool[24096]: FrameZoomSGIX (dynamic) */
    "i\0"
    "glFrameZoomSGIX\0"
    "\0"
-   /* _mesa_function_pool[24093]: Normal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[24115]: Normal3fVertex3fvSUN (dynamic) */
    "pp\0"
    "glNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[24120]: GetnUniformuivARB (will be remapped) */
+   /* _mesa_function_pool[24142]: GetnUniformuivARB (will be remapped) */
    "iiip\0"
    "glGetnUniformuivARB\0"
    "\0"
-   /* _mesa_function_pool[24146]: RasterPos4sv (offset 85) */
+   /* _mesa_function_pool[24168]: RasterPos4sv (offset 85) */
    "p\0"
    "glRasterPos4sv\0"
    "\0"
-   /* _mesa_function_pool[24164]: VertexAttrib4NsvARB (will be remapped) */
+   /* _mesa_function_pool[24186]: VertexAttrib4NsvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nsv\0"
    "glVertexAttrib4NsvARB\0"
    "\0"
-   /* _mesa_function_pool[24209]: VertexAttrib3fvARB (will be remapped) */
+   /* _mesa_function_pool[24231]: VertexAttrib3fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib3fv\0"
    "glVertexAttrib3fvARB\0"
    "\0"
-   /* _mesa_function_pool[24252]: ClearColor (offset 206) */
+   /* _mesa_function_pool[24274]: ClearColor (offset 206) */
    "ffff\0"
    "glClearColor\0"
    "\0"
-   /* _mesa_function_pool[24271]: GetSynciv (will be remapped) */
+   /* _mesa_function_pool[24293]: GetSynciv (will be remapped) */
    "iiipp\0"
    "glGetSynciv\0"
    "\0"
-   /* _mesa_function_pool[24290]: ClearColorIiEXT (will be remapped) */
+   /* _mesa_function_pool[24312]: ClearColorIiEXT (will be remapped) */
    "iiii\0"
    "glClearColorIiEXT\0"
    "\0"
-   /* _mesa_function_pool[24314]: DeleteFramebuffersEXT (will be remapped) */
+   /* _mesa_function_pool[24336]: DeleteFramebuffersEXT (will be remapped) */
    "ip\0"
    "glDeleteFramebuffers\0"
    "glDeleteFramebuffersEXT\0"
    "\0"
-   /* _mesa_function_pool[24363]: GlobalAlphaFactorsSUN (dynamic) */
+   /* _mesa_function_pool[24385]: GlobalAlphaFactorsSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorsSUN\0"
    "\0"
-   /* _mesa_function_pool[24390]: IsEnabledIndexedEXT (will be remapped) */
+   /* _mesa_function_pool[24412]: IsEnabledIndexedEXT (will be remapped) */
    "ii\0"
    "glIsEnabledIndexedEXT\0"
    "glIsEnabledi\0"
    "\0"
-   /* _mesa_function_pool[24429]: TexEnviv (offset 187) */
+   /* _mesa_function_pool[24451]: TexEnviv (offset 187) */
    "iip\0"
    "glTexEnviv\0"
    "\0"
-   /* _mesa_function_pool[24445]: TexSubImage3D (offset 372) */
+   /* _mesa_function_pool[24467]: TexSubImage3D (offset 372) */
    "iiiiiiiiiip\0"
    "glTexSubImage3D\0"
    "glTexSubImage3DEXT\0"
    "\0"
-   /* _mesa_function_pool[24493]: Tangent3fEXT (dynamic) */
+   /* _mesa_function_pool[24515]: Tangent3fEXT (dynamic) */
    "fff\0"
    "glTangent3fEXT\0"
    "\0"
-   /* _mesa_function_pool[24513]: SecondaryColor3uivEXT (will be remapped) */
+   /* _mesa_function_pool[24535]: SecondaryColor3uivEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3uiv\0"
    "glSecondaryColor3uivEXT\0"
    "\0"
-   /* _mesa_function_pool[24561]: MatrixIndexubvARB (dynamic) */
+   /* _mesa_function_pool[24583]: MatrixIndexubvARB (dynamic) */
    "ip\0"
    "glMatrixIndexubvARB\0"
    "\0"
-   /* _mesa_function_pool[24585]: Color4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[24607]: Color4fNormal3fVertex3fSUN (dynamic) */
    "ffffffffff\0"
    "glColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[24626]: PixelTexGenParameterfSGIS (will be remapped) */
+   /* _mesa_function_pool[24648]: PixelTexGenParameterfSGIS (will be remapped) */
    "if\0"
    "glPixelTexGenParameterfSGIS\0"
    "\0"
-   /* _mesa_function_pool[24658]: CreateShader (will be remapped) */
+   /* _mesa_function_pool[24680]: CreateShader (will be remapped) */
    "i\0"
    "glCreateShader\0"
    "\0"
-   /* _mesa_function_pool[24676]: GetColorTableParameterfv (offset 344) */
+   /* _mesa_function_pool[24698]: GetColorTableParameterfv (offset 344) */
    "iip\0"
    "glGetColorTableParameterfv\0"
    "glGetColorTableParameterfvSGI\0"
    "glGetColorTableParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[24768]: FragmentLightModelfvSGIX (dynamic) */
+   /* _mesa_function_pool[24790]: FragmentLightModelfvSGIX (dynamic) */
    "ip\0"
    "glFragmentLightModelfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[24799]: Bitmap (offset 8) */
+   /* _mesa_function_pool[24821]: Bitmap (offset 8) */
    "iiffffp\0"
    "glBitmap\0"
    "\0"
-   /* _mesa_function_pool[24817]: MultiTexCoord3fARB (offset 394) */
+   /* _mesa_function_pool[24839]: MultiTexCoord3fARB (offset 394) */
    "ifff\0"
    "glMultiTexCoord3f\0"
    "glMultiTexCoord3fARB\0"
    "\0"
-   /* _mesa_function_pool[24862]: GetTexLevelParameterfv (offset 284) */
+   /* _mesa_function_pool[24884]: GetTexLevelParameterfv (offset 284) */
    "iiip\0"
    "glGetTexLevelParameterfv\0"
    "\0"
-   /* _mesa_function_pool[24893]: GetPixelTexGenParameterfvSGIS (will be remapped) */
+   /* _mesa_function_pool[24915]: GetPixelTexGenParameterfvSGIS (will be remapped) */
    "ip\0"
    "glGetPixelTexGenParameterfvSGIS\0"
    "\0"
-   /* _mesa_function_pool[24929]: GenFramebuffersEXT (will be remapped) */
+   /* _mesa_function_pool[24951]: GenFramebuffersEXT (will be remapped) */
    "ip\0"
    "glGenFramebuffers\0"
    "glGenFramebuffersEXT\0"
    "\0"
-   /* _mesa_function_pool[24972]: BindBufferOffsetEXT (will be remapped) */
+   /* _mesa_function_pool[24994]: BindBufferOffsetEXT (will be remapped) */
    "iiii\0"
    "glBindBufferOffsetEXT\0"
    "\0"
-   /* _mesa_function_pool[25000]: VertexAttribDivisor (will be remapped) */
+   /* _mesa_function_pool[25022]: VertexAttribDivisor (will be remapped) */
    "ii\0"
    "glVertexAttribDivisor\0"
    "\0"
-   /* _mesa_function_pool[25026]: GetProgramParameterdvNV (will be remapped) */
+   /* _mesa_function_pool[25048]: GetProgramParameterdvNV (will be remapped) */
    "iiip\0"
    "glGetProgramParameterdvNV\0"
    "\0"
-   /* _mesa_function_pool[25058]: Vertex2sv (offset 133) */
+   /* _mesa_function_pool[25080]: Vertex2sv (offset 133) */
    "p\0"
    "glVertex2sv\0"
    "\0"
-   /* _mesa_function_pool[25073]: GetIntegerv (offset 263) */
+   /* _mesa_function_pool[25095]: GetIntegerv (offset 263) */
    "ip\0"
    "glGetIntegerv\0"
    "\0"
-   /* _mesa_function_pool[25091]: IsVertexArrayAPPLE (will be remapped) */
+   /* _mesa_function_pool[25113]: IsVertexArrayAPPLE (will be remapped) */
    "i\0"
    "glIsVertexArray\0"
    "glIsVertexArrayAPPLE\0"
    "\0"
-   /* _mesa_function_pool[25131]: FragmentLightfvSGIX (dynamic) */
+   /* _mesa_function_pool[25153]: FragmentLightfvSGIX (dynamic) */
    "iip\0"
    "glFragmentLightfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[25158]: VertexAttribDivisorARB (will be remapped) */
+   /* _mesa_function_pool[25180]: VertexAttribDivisorARB (will be remapped) */
    "ii\0"
    "glVertexAttribDivisorARB\0"
    "\0"
-   /* _mesa_function_pool[25187]: DetachShader (will be remapped) */
+   /* _mesa_function_pool[25209]: DetachShader (will be remapped) */
    "ii\0"
    "glDetachShader\0"
    "\0"
-   /* _mesa_function_pool[25206]: VertexAttrib4NubARB (will be remapped) */
+   /* _mesa_function_pool[25228]: VertexAttrib4NubARB (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4Nub\0"
    "glVertexAttrib4NubARB\0"
    "\0"
-   /* _mesa_function_pool[25254]: GetProgramEnvParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[25276]: GetProgramEnvParameterfvARB (will be remapped) */
    "iip\0"
    "glGetProgramEnvParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[25289]: GetTrackMatrixivNV (will be remapped) */
+   /* _mesa_function_pool[25311]: GetTrackMatrixivNV (will be remapped) */
    "iiip\0"
    "glGetTrackMatrixivNV\0"
    "\0"
-   /* _mesa_function_pool[25316]: VertexAttrib3svNV (will be remapped) */
+   /* _mesa_function_pool[25338]: VertexAttrib3svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3svNV\0"
    "\0"
-   /* _mesa_function_pool[25340]: Uniform4fvARB (will be remapped) */
+   /* _mesa_function_pool[25362]: Uniform4fvARB (will be remapped) */
    "iip\0"
    "glUniform4fv\0"
    "glUniform4fvARB\0"
    "\0"
-   /* _mesa_function_pool[25374]: MultTransposeMatrixfARB (will be remapped) */
+   /* _mesa_function_pool[25396]: MultTransposeMatrixfARB (will be remapped) */
    "p\0"
    "glMultTransposeMatrixf\0"
    "glMultTransposeMatrixfARB\0"
    "\0"
-   /* _mesa_function_pool[25426]: GetTexEnviv (offset 277) */
+   /* _mesa_function_pool[25448]: GetTexEnviv (offset 277) */
    "iip\0"
    "glGetTexEnviv\0"
    "\0"
-   /* _mesa_function_pool[25445]: ColorFragmentOp1ATI (will be remapped) */
+   /* _mesa_function_pool[25467]: ColorFragmentOp1ATI (will be remapped) */
    "iiiiiii\0"
    "glColorFragmentOp1ATI\0"
    "\0"
-   /* _mesa_function_pool[25476]: GetUniformfvARB (will be remapped) */
+   /* _mesa_function_pool[25498]: GetUniformfvARB (will be remapped) */
    "iip\0"
    "glGetUniformfv\0"
    "glGetUniformfvARB\0"
    "\0"
-   /* _mesa_function_pool[25514]: EGLImageTargetRenderbufferStorageOES (will be remapped) */
+   /* _mesa_function_pool[25536]: EGLImageTargetRenderbufferStorageOES (will be remapped) */
    "ip\0"
    "glEGLImageTargetRenderbufferStorageOES\0"
    "\0"
-   /* _mesa_function_pool[25557]: VertexAttribI2ivEXT (will be remapped) */
+   /* _mesa_function_pool[25579]: VertexAttribI2ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI2ivEXT\0"
    "glVertexAttribI2iv\0"
    "\0"
-   /* _mesa_function_pool[25602]: PopClientAttrib (offset 334) */
+   /* _mesa_function_pool[25624]: PopClientAttrib (offset 334) */
    "\0"
    "glPopClientAttrib\0"
    "\0"
-   /* _mesa_function_pool[25622]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[25644]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
    "iffffffffffff\0"
    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[25693]: DetachObjectARB (will be remapped) */
+   /* _mesa_function_pool[25715]: DetachObjectARB (will be remapped) */
    "ii\0"
    "glDetachObjectARB\0"
    "\0"
-   /* _mesa_function_pool[25715]: VertexBlendARB (dynamic) */
+   /* _mesa_function_pool[25737]: VertexBlendARB (dynamic) */
    "i\0"
    "glVertexBlendARB\0"
    "\0"
-   /* _mesa_function_pool[25735]: WindowPos3iMESA (will be remapped) */
+   /* _mesa_function_pool[25757]: WindowPos3iMESA (will be remapped) */
    "iii\0"
    "glWindowPos3i\0"
    "glWindowPos3iARB\0"
    "glWindowPos3iMESA\0"
    "\0"
-   /* _mesa_function_pool[25789]: SeparableFilter2D (offset 360) */
+   /* _mesa_function_pool[25811]: SeparableFilter2D (offset 360) */
    "iiiiiipp\0"
    "glSeparableFilter2D\0"
    "glSeparableFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[25842]: ProgramParameteriARB (will be remapped) */
+   /* _mesa_function_pool[25864]: ProgramParameteriARB (will be remapped) */
    "iii\0"
    "glProgramParameteriARB\0"
+   "glProgramParameteri\0"
    "\0"
-   /* _mesa_function_pool[25870]: Map1d (offset 220) */
+   /* _mesa_function_pool[25912]: Map1d (offset 220) */
    "iddiip\0"
    "glMap1d\0"
    "\0"
-   /* _mesa_function_pool[25886]: Map1f (offset 221) */
+   /* _mesa_function_pool[25928]: Map1f (offset 221) */
    "iffiip\0"
    "glMap1f\0"
    "\0"
-   /* _mesa_function_pool[25902]: CompressedTexImage2DARB (will be remapped) */
+   /* _mesa_function_pool[25944]: CompressedTexImage2DARB (will be remapped) */
    "iiiiiiip\0"
    "glCompressedTexImage2D\0"
    "glCompressedTexImage2DARB\0"
    "\0"
-   /* _mesa_function_pool[25961]: ArrayElement (offset 306) */
+   /* _mesa_function_pool[26003]: ArrayElement (offset 306) */
    "i\0"
    "glArrayElement\0"
    "glArrayElementEXT\0"
    "\0"
-   /* _mesa_function_pool[25997]: TexImage2D (offset 183) */
+   /* _mesa_function_pool[26039]: TexImage2D (offset 183) */
    "iiiiiiiip\0"
    "glTexImage2D\0"
    "\0"
-   /* _mesa_function_pool[26021]: DepthBoundsEXT (will be remapped) */
+   /* _mesa_function_pool[26063]: DepthBoundsEXT (will be remapped) */
    "dd\0"
    "glDepthBoundsEXT\0"
    "\0"
-   /* _mesa_function_pool[26042]: ProgramParameters4fvNV (will be remapped) */
+   /* _mesa_function_pool[26084]: ProgramParameters4fvNV (will be remapped) */
    "iiip\0"
    "glProgramParameters4fvNV\0"
    "\0"
-   /* _mesa_function_pool[26073]: DeformationMap3fSGIX (dynamic) */
+   /* _mesa_function_pool[26115]: DeformationMap3fSGIX (dynamic) */
    "iffiiffiiffiip\0"
    "glDeformationMap3fSGIX\0"
    "\0"
-   /* _mesa_function_pool[26112]: GetProgramivNV (will be remapped) */
+   /* _mesa_function_pool[26154]: GetProgramivNV (will be remapped) */
    "iip\0"
    "glGetProgramivNV\0"
    "\0"
-   /* _mesa_function_pool[26134]: GetIntegerIndexedvEXT (will be remapped) */
+   /* _mesa_function_pool[26176]: GetIntegerIndexedvEXT (will be remapped) */
    "iip\0"
    "glGetIntegerIndexedvEXT\0"
    "glGetIntegeri_v\0"
    "\0"
-   /* _mesa_function_pool[26179]: BeginTransformFeedbackEXT (will be remapped) */
+   /* _mesa_function_pool[26221]: BeginTransformFeedbackEXT (will be remapped) */
    "i\0"
    "glBeginTransformFeedback\0"
    "glBeginTransformFeedbackEXT\0"
    "\0"
-   /* _mesa_function_pool[26235]: GetMinmaxParameteriv (offset 366) */
+   /* _mesa_function_pool[26277]: GetMinmaxParameteriv (offset 366) */
    "iip\0"
    "glGetMinmaxParameteriv\0"
    "glGetMinmaxParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[26289]: PixelTransferf (offset 247) */
+   /* _mesa_function_pool[26331]: PixelTransferf (offset 247) */
    "if\0"
    "glPixelTransferf\0"
    "\0"
-   /* _mesa_function_pool[26310]: CopyTexImage1D (offset 323) */
+   /* _mesa_function_pool[26352]: CopyTexImage1D (offset 323) */
    "iiiiiii\0"
    "glCopyTexImage1D\0"
    "glCopyTexImage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[26356]: PushMatrix (offset 298) */
+   /* _mesa_function_pool[26398]: PushMatrix (offset 298) */
    "\0"
    "glPushMatrix\0"
    "\0"
-   /* _mesa_function_pool[26371]: Fogiv (offset 156) */
+   /* _mesa_function_pool[26413]: Fogiv (offset 156) */
    "ip\0"
    "glFogiv\0"
    "\0"
-   /* _mesa_function_pool[26383]: TexCoord1dv (offset 95) */
+   /* _mesa_function_pool[26425]: TexCoord1dv (offset 95) */
    "p\0"
    "glTexCoord1dv\0"
    "\0"
-   /* _mesa_function_pool[26400]: AlphaFragmentOp3ATI (will be remapped) */
+   /* _mesa_function_pool[26442]: AlphaFragmentOp3ATI (will be remapped) */
    "iiiiiiiiiiii\0"
    "glAlphaFragmentOp3ATI\0"
    "\0"
-   /* _mesa_function_pool[26436]: PixelTransferi (offset 248) */
+   /* _mesa_function_pool[26478]: PixelTransferi (offset 248) */
    "ii\0"
    "glPixelTransferi\0"
    "\0"
-   /* _mesa_function_pool[26457]: GetnColorTableARB (will be remapped) */
+   /* _mesa_function_pool[26499]: GetnColorTableARB (will be remapped) */
    "iiiip\0"
    "glGetnColorTableARB\0"
    "\0"
-   /* _mesa_function_pool[26484]: VertexAttrib3fvNV (will be remapped) */
+   /* _mesa_function_pool[26526]: VertexAttrib3fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3fvNV\0"
    "\0"
-   /* _mesa_function_pool[26508]: Rotatef (offset 300) */
+   /* _mesa_function_pool[26550]: Rotatef (offset 300) */
    "ffff\0"
    "glRotatef\0"
    "\0"
-   /* _mesa_function_pool[26524]: GetFinalCombinerInputParameterivNV (will be remapped) */
+   /* _mesa_function_pool[26566]: GetFinalCombinerInputParameterivNV (will be remapped) */
    "iip\0"
    "glGetFinalCombinerInputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[26566]: Vertex3i (offset 138) */
+   /* _mesa_function_pool[26608]: Vertex3i (offset 138) */
    "iii\0"
    "glVertex3i\0"
    "\0"
-   /* _mesa_function_pool[26582]: SecondaryColorP3ui (will be remapped) */
+   /* _mesa_function_pool[26624]: SecondaryColorP3ui (will be remapped) */
    "ii\0"
    "glSecondaryColorP3ui\0"
    "\0"
-   /* _mesa_function_pool[26607]: Vertex3f (offset 136) */
+   /* _mesa_function_pool[26649]: Vertex3f (offset 136) */
    "fff\0"
    "glVertex3f\0"
    "\0"
-   /* _mesa_function_pool[26623]: Clear (offset 203) */
+   /* _mesa_function_pool[26665]: Clear (offset 203) */
    "i\0"
    "glClear\0"
    "\0"
-   /* _mesa_function_pool[26634]: Vertex3d (offset 134) */
+   /* _mesa_function_pool[26676]: Vertex3d (offset 134) */
    "ddd\0"
    "glVertex3d\0"
    "\0"
-   /* _mesa_function_pool[26650]: GetMapParameterivNV (dynamic) */
+   /* _mesa_function_pool[26692]: GetMapParameterivNV (dynamic) */
    "iip\0"
    "glGetMapParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[26677]: Uniform4iARB (will be remapped) */
+   /* _mesa_function_pool[26719]: Uniform4iARB (will be remapped) */
    "iiiii\0"
    "glUniform4i\0"
    "glUniform4iARB\0"
    "\0"
-   /* _mesa_function_pool[26711]: ReadBuffer (offset 254) */
+   /* _mesa_function_pool[26753]: ReadBuffer (offset 254) */
    "i\0"
    "glReadBuffer\0"
    "\0"
-   /* _mesa_function_pool[26727]: ConvolutionParameteri (offset 352) */
+   /* _mesa_function_pool[26769]: ConvolutionParameteri (offset 352) */
    "iii\0"
    "glConvolutionParameteri\0"
    "glConvolutionParameteriEXT\0"
    "\0"
-   /* _mesa_function_pool[26783]: Ortho (offset 296) */
+   /* _mesa_function_pool[26825]: Ortho (offset 296) */
    "dddddd\0"
    "glOrtho\0"
    "\0"
-   /* _mesa_function_pool[26799]: Binormal3sEXT (dynamic) */
+   /* _mesa_function_pool[26841]: Binormal3sEXT (dynamic) */
    "iii\0"
    "glBinormal3sEXT\0"
    "\0"
-   /* _mesa_function_pool[26820]: ListBase (offset 6) */
+   /* _mesa_function_pool[26862]: ListBase (offset 6) */
    "i\0"
    "glListBase\0"
    "\0"
-   /* _mesa_function_pool[26834]: VertexAttribI3ivEXT (will be remapped) */
+   /* _mesa_function_pool[26876]: VertexAttribI3ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI3ivEXT\0"
    "glVertexAttribI3iv\0"
    "\0"
-   /* _mesa_function_pool[26879]: VertexAttrib4fvNV (will be remapped) */
+   /* _mesa_function_pool[26921]: VertexAttrib4fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4fvNV\0"
    "\0"
-   /* _mesa_function_pool[26903]: Vertex3s (offset 140) */
+   /* _mesa_function_pool[26945]: Vertex3s (offset 140) */
    "iii\0"
    "glVertex3s\0"
    "\0"
-   /* _mesa_function_pool[26919]: ConvolutionParameterf (offset 350) */
+   /* _mesa_function_pool[26961]: ConvolutionParameterf (offset 350) */
    "iif\0"
    "glConvolutionParameterf\0"
    "glConvolutionParameterfEXT\0"
    "\0"
-   /* _mesa_function_pool[26975]: GetColorTableParameteriv (offset 345) */
+   /* _mesa_function_pool[27017]: GetColorTableParameteriv (offset 345) */
    "iip\0"
    "glGetColorTableParameteriv\0"
    "glGetColorTableParameterivSGI\0"
    "glGetColorTableParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[27067]: ProgramEnvParameter4dvARB (will be remapped) */
+   /* _mesa_function_pool[27109]: ProgramEnvParameter4dvARB (will be remapped) */
    "iip\0"
    "glProgramEnvParameter4dvARB\0"
    "glProgramParameter4dvNV\0"
    "\0"
-   /* _mesa_function_pool[27124]: ShadeModel (offset 177) */
+   /* _mesa_function_pool[27166]: ShadeModel (offset 177) */
    "i\0"
    "glShadeModel\0"
    "\0"
-   /* _mesa_function_pool[27140]: BlendEquationSeparateiARB (will be remapped) */
+   /* _mesa_function_pool[27182]: BlendEquationSeparateiARB (will be remapped) */
    "iii\0"
    "glBlendEquationSeparateiARB\0"
    "glBlendEquationSeparateIndexedAMD\0"
    "\0"
-   /* _mesa_function_pool[27207]: Rectiv (offset 91) */
+   /* _mesa_function_pool[27249]: Rectiv (offset 91) */
    "pp\0"
    "glRectiv\0"
    "\0"
-   /* _mesa_function_pool[27220]: UseProgramObjectARB (will be remapped) */
+   /* _mesa_function_pool[27262]: UseProgramObjectARB (will be remapped) */
    "i\0"
    "glUseProgram\0"
    "glUseProgramObjectARB\0"
    "\0"
-   /* _mesa_function_pool[27258]: GetMapParameterfvNV (dynamic) */
+   /* _mesa_function_pool[27300]: GetMapParameterfvNV (dynamic) */
    "iip\0"
    "glGetMapParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[27285]: EndConditionalRenderNV (will be remapped) */
+   /* _mesa_function_pool[27327]: EndConditionalRenderNV (will be remapped) */
    "\0"
    "glEndConditionalRender\0"
    "glEndConditionalRenderNV\0"
    "\0"
-   /* _mesa_function_pool[27335]: PassTexCoordATI (will be remapped) */
+   /* _mesa_function_pool[27377]: PassTexCoordATI (will be remapped) */
    "iii\0"
    "glPassTexCoordATI\0"
    "\0"
-   /* _mesa_function_pool[27358]: DeleteProgram (will be remapped) */
+   /* _mesa_function_pool[27400]: DeleteProgram (will be remapped) */
    "i\0"
    "glDeleteProgram\0"
    "\0"
-   /* _mesa_function_pool[27377]: GetSamplerParameteriv (will be remapped) */
+   /* _mesa_function_pool[27419]: GetSamplerParameteriv (will be remapped) */
    "iip\0"
    "glGetSamplerParameteriv\0"
    "\0"
-   /* _mesa_function_pool[27406]: Tangent3dEXT (dynamic) */
+   /* _mesa_function_pool[27448]: Tangent3dEXT (dynamic) */
    "ddd\0"
    "glTangent3dEXT\0"
    "\0"
-   /* _mesa_function_pool[27426]: SecondaryColor3dvEXT (will be remapped) */
+   /* _mesa_function_pool[27468]: SecondaryColor3dvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3dv\0"
    "glSecondaryColor3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[27472]: VertexAttrib1dNV (will be remapped) */
+   /* _mesa_function_pool[27514]: VertexAttrib1dNV (will be remapped) */
    "id\0"
    "glVertexAttrib1dNV\0"
    "\0"
-   /* _mesa_function_pool[27495]: Vertex2fv (offset 129) */
+   /* _mesa_function_pool[27537]: Vertex2fv (offset 129) */
    "p\0"
    "glVertex2fv\0"
    "\0"
-   /* _mesa_function_pool[27510]: MultiDrawArraysEXT (will be remapped) */
+   /* _mesa_function_pool[27552]: MultiDrawArraysEXT (will be remapped) */
    "ippi\0"
    "glMultiDrawArrays\0"
    "glMultiDrawArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[27555]: BindRenderbufferEXT (will be remapped) */
+   /* _mesa_function_pool[27597]: BindRenderbufferEXT (will be remapped) */
    "ii\0"
    "glBindRenderbuffer\0"
    "glBindRenderbufferEXT\0"
    "\0"
-   /* _mesa_function_pool[27600]: MultiTexCoord4dARB (offset 400) */
+   /* _mesa_function_pool[27642]: MultiTexCoord4dARB (offset 400) */
    "idddd\0"
    "glMultiTexCoord4d\0"
    "glMultiTexCoord4dARB\0"
    "\0"
-   /* _mesa_function_pool[27646]: FramebufferTextureFaceARB (will be remapped) */
+   /* _mesa_function_pool[27688]: FramebufferTextureFaceARB (will be remapped) */
    "iiiii\0"
    "glFramebufferTextureFaceARB\0"
    "\0"
-   /* _mesa_function_pool[27681]: Vertex3sv (offset 141) */
+   /* _mesa_function_pool[27723]: Vertex3sv (offset 141) */
    "p\0"
    "glVertex3sv\0"
    "\0"
-   /* _mesa_function_pool[27696]: SecondaryColor3usEXT (will be remapped) */
+   /* _mesa_function_pool[27738]: SecondaryColor3usEXT (will be remapped) */
    "iii\0"
    "glSecondaryColor3us\0"
    "glSecondaryColor3usEXT\0"
    "\0"
-   /* _mesa_function_pool[27744]: ProgramLocalParameter4fvARB (will be remapped) */
+   /* _mesa_function_pool[27786]: ProgramLocalParameter4fvARB (will be remapped) */
    "iip\0"
    "glProgramLocalParameter4fvARB\0"
    "\0"
-   /* _mesa_function_pool[27779]: DeleteProgramsNV (will be remapped) */
+   /* _mesa_function_pool[27821]: DeleteProgramsNV (will be remapped) */
    "ip\0"
    "glDeleteProgramsARB\0"
    "glDeleteProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[27822]: EvalMesh1 (offset 236) */
+   /* _mesa_function_pool[27864]: EvalMesh1 (offset 236) */
    "iii\0"
    "glEvalMesh1\0"
    "\0"
-   /* _mesa_function_pool[27839]: GetCombinerOutputParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[27881]: GetCombinerOutputParameterfvNV (will be remapped) */
    "iiip\0"
    "glGetCombinerOutputParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[27878]: MultiTexCoord1sARB (offset 382) */
+   /* _mesa_function_pool[27920]: MultiTexCoord1sARB (offset 382) */
    "ii\0"
    "glMultiTexCoord1s\0"
    "glMultiTexCoord1sARB\0"
    "\0"
-   /* _mesa_function_pool[27921]: ReplacementCodeuiColor3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[27963]: ReplacementCodeuiColor3fVertex3fSUN (dynamic) */
    "iffffff\0"
    "glReplacementCodeuiColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[27968]: GetVertexAttribPointervNV (will be remapped) */
+   /* _mesa_function_pool[28010]: GetVertexAttribPointervNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribPointerv\0"
    "glGetVertexAttribPointervARB\0"
    "glGetVertexAttribPointervNV\0"
    "\0"
-   /* _mesa_function_pool[28056]: DisableIndexedEXT (will be remapped) */
+   /* _mesa_function_pool[28098]: DisableIndexedEXT (will be remapped) */
    "ii\0"
    "glDisableIndexedEXT\0"
    "glDisablei\0"
    "\0"
-   /* _mesa_function_pool[28091]: MultiTexCoord1dvARB (offset 377) */
+   /* _mesa_function_pool[28133]: MultiTexCoord1dvARB (offset 377) */
    "ip\0"
    "glMultiTexCoord1dv\0"
    "glMultiTexCoord1dvARB\0"
    "\0"
-   /* _mesa_function_pool[28136]: Uniform2iARB (will be remapped) */
+   /* _mesa_function_pool[28178]: Uniform2iARB (will be remapped) */
    "iii\0"
    "glUniform2i\0"
    "glUniform2iARB\0"
    "\0"
-   /* _mesa_function_pool[28168]: Vertex2iv (offset 131) */
+   /* _mesa_function_pool[28210]: Vertex2iv (offset 131) */
    "p\0"
    "glVertex2iv\0"
    "\0"
-   /* _mesa_function_pool[28183]: GetProgramStringNV (will be remapped) */
+   /* _mesa_function_pool[28225]: GetProgramStringNV (will be remapped) */
    "iip\0"
    "glGetProgramStringNV\0"
    "\0"
-   /* _mesa_function_pool[28209]: VertexAttribP3uiv (will be remapped) */
+   /* _mesa_function_pool[28251]: VertexAttribP3uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP3uiv\0"
    "\0"
-   /* _mesa_function_pool[28235]: LineWidth (offset 168) */
+   /* _mesa_function_pool[28277]: LineWidth (offset 168) */
    "f\0"
    "glLineWidth\0"
    "\0"
-   /* _mesa_function_pool[28250]: Tangent3svEXT (dynamic) */
+   /* _mesa_function_pool[28292]: Tangent3svEXT (dynamic) */
    "p\0"
    "glTangent3svEXT\0"
    "\0"
-   /* _mesa_function_pool[28269]: MapBufferARB (will be remapped) */
+   /* _mesa_function_pool[28311]: MapBufferARB (will be remapped) */
    "ii\0"
    "glMapBuffer\0"
    "glMapBufferARB\0"
    "\0"
-   /* _mesa_function_pool[28300]: MultiDrawElementsBaseVertex (will be remapped) */
+   /* _mesa_function_pool[28342]: MultiDrawElementsBaseVertex (will be remapped) */
    "ipipip\0"
    "glMultiDrawElementsBaseVertex\0"
    "\0"
-   /* _mesa_function_pool[28338]: TexParameterIuivEXT (will be remapped) */
+   /* _mesa_function_pool[28380]: TexParameterIuivEXT (will be remapped) */
    "iip\0"
    "glTexParameterIuivEXT\0"
    "glTexParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[28384]: Binormal3svEXT (dynamic) */
+   /* _mesa_function_pool[28426]: Binormal3svEXT (dynamic) */
    "p\0"
    "glBinormal3svEXT\0"
    "\0"
-   /* _mesa_function_pool[28404]: ApplyTextureEXT (dynamic) */
+   /* _mesa_function_pool[28446]: ApplyTextureEXT (dynamic) */
    "i\0"
    "glApplyTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[28425]: GetBufferParameteri64v (will be remapped) */
+   /* _mesa_function_pool[28467]: GetBufferParameteri64v (will be remapped) */
    "iip\0"
    "glGetBufferParameteri64v\0"
    "\0"
-   /* _mesa_function_pool[28455]: TexGendv (offset 189) */
+   /* _mesa_function_pool[28497]: TexGendv (offset 189) */
    "iip\0"
    "glTexGendv\0"
    "\0"
-   /* _mesa_function_pool[28471]: VertexAttribI3iEXT (will be remapped) */
+   /* _mesa_function_pool[28513]: VertexAttribI3iEXT (will be remapped) */
    "iiii\0"
    "glVertexAttribI3iEXT\0"
    "glVertexAttribI3i\0"
    "\0"
-   /* _mesa_function_pool[28516]: EnableIndexedEXT (will be remapped) */
+   /* _mesa_function_pool[28558]: EnableIndexedEXT (will be remapped) */
    "ii\0"
    "glEnableIndexedEXT\0"
    "glEnablei\0"
    "\0"
-   /* _mesa_function_pool[28549]: TextureMaterialEXT (dynamic) */
+   /* _mesa_function_pool[28591]: TextureMaterialEXT (dynamic) */
    "ii\0"
    "glTextureMaterialEXT\0"
    "\0"
-   /* _mesa_function_pool[28574]: TextureLightEXT (dynamic) */
+   /* _mesa_function_pool[28616]: TextureLightEXT (dynamic) */
    "i\0"
    "glTextureLightEXT\0"
    "\0"
-   /* _mesa_function_pool[28595]: ResetMinmax (offset 370) */
+   /* _mesa_function_pool[28637]: ResetMinmax (offset 370) */
    "i\0"
    "glResetMinmax\0"
    "glResetMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[28629]: SpriteParameterfSGIX (dynamic) */
+   /* _mesa_function_pool[28671]: SpriteParameterfSGIX (dynamic) */
    "if\0"
    "glSpriteParameterfSGIX\0"
    "\0"
-   /* _mesa_function_pool[28656]: EnableClientState (offset 313) */
+   /* _mesa_function_pool[28698]: EnableClientState (offset 313) */
    "i\0"
    "glEnableClientState\0"
    "\0"
-   /* _mesa_function_pool[28679]: VertexAttrib4sNV (will be remapped) */
+   /* _mesa_function_pool[28721]: VertexAttrib4sNV (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4sNV\0"
    "\0"
-   /* _mesa_function_pool[28705]: GetConvolutionParameterfv (offset 357) */
+   /* _mesa_function_pool[28747]: GetConvolutionParameterfv (offset 357) */
    "iip\0"
    "glGetConvolutionParameterfv\0"
    "glGetConvolutionParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[28769]: VertexAttribs4dvNV (will be remapped) */
+   /* _mesa_function_pool[28811]: VertexAttribs4dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4dvNV\0"
    "\0"
-   /* _mesa_function_pool[28795]: VertexAttrib4dARB (will be remapped) */
+   /* _mesa_function_pool[28837]: VertexAttrib4dARB (will be remapped) */
    "idddd\0"
    "glVertexAttrib4d\0"
    "glVertexAttrib4dARB\0"
    "\0"
-   /* _mesa_function_pool[28839]: GetTexBumpParameterfvATI (will be remapped) */
+   /* _mesa_function_pool[28881]: GetProgramBinary (will be remapped) */
+   "iippp\0"
+   "glGetProgramBinary\0"
+   "\0"
+   /* _mesa_function_pool[28907]: GetTexBumpParameterfvATI (will be remapped) */
    "ip\0"
    "glGetTexBumpParameterfvATI\0"
    "\0"
-   /* _mesa_function_pool[28870]: ProgramNamedParameter4dNV (will be remapped) */
+   /* _mesa_function_pool[28938]: ProgramNamedParameter4dNV (will be remapped) */
    "iipdddd\0"
    "glProgramNamedParameter4dNV\0"
    "\0"
-   /* _mesa_function_pool[28907]: GetMaterialfv (offset 269) */
+   /* _mesa_function_pool[28975]: GetMaterialfv (offset 269) */
    "iip\0"
    "glGetMaterialfv\0"
    "\0"
-   /* _mesa_function_pool[28928]: VertexWeightfEXT (dynamic) */
+   /* _mesa_function_pool[28996]: VertexWeightfEXT (dynamic) */
    "f\0"
    "glVertexWeightfEXT\0"
    "\0"
-   /* _mesa_function_pool[28950]: EndTransformFeedbackEXT (will be remapped) */
+   /* _mesa_function_pool[29018]: EndTransformFeedbackEXT (will be remapped) */
    "\0"
    "glEndTransformFeedback\0"
    "glEndTransformFeedbackEXT\0"
    "\0"
-   /* _mesa_function_pool[29001]: SetFragmentShaderConstantATI (will be remapped) */
+   /* _mesa_function_pool[29069]: SetFragmentShaderConstantATI (will be remapped) */
    "ip\0"
    "glSetFragmentShaderConstantATI\0"
    "\0"
-   /* _mesa_function_pool[29036]: Binormal3fEXT (dynamic) */
+   /* _mesa_function_pool[29104]: Binormal3fEXT (dynamic) */
    "fff\0"
    "glBinormal3fEXT\0"
    "\0"
-   /* _mesa_function_pool[29057]: CallList (offset 2) */
+   /* _mesa_function_pool[29125]: CallList (offset 2) */
    "i\0"
    "glCallList\0"
    "\0"
-   /* _mesa_function_pool[29071]: Materialfv (offset 170) */
+   /* _mesa_function_pool[29139]: Materialfv (offset 170) */
    "iip\0"
    "glMaterialfv\0"
    "\0"
-   /* _mesa_function_pool[29089]: TexCoord3fv (offset 113) */
+   /* _mesa_function_pool[29157]: TexCoord3fv (offset 113) */
    "p\0"
    "glTexCoord3fv\0"
    "\0"
-   /* _mesa_function_pool[29106]: FogCoordfvEXT (will be remapped) */
+   /* _mesa_function_pool[29174]: FogCoordfvEXT (will be remapped) */
    "p\0"
    "glFogCoordfv\0"
    "glFogCoordfvEXT\0"
    "\0"
-   /* _mesa_function_pool[29138]: MultiTexCoord1ivARB (offset 381) */
+   /* _mesa_function_pool[29206]: MultiTexCoord1ivARB (offset 381) */
    "ip\0"
    "glMultiTexCoord1iv\0"
    "glMultiTexCoord1ivARB\0"
    "\0"
-   /* _mesa_function_pool[29183]: SecondaryColor3ubEXT (will be remapped) */
+   /* _mesa_function_pool[29251]: SecondaryColor3ubEXT (will be remapped) */
    "iii\0"
    "glSecondaryColor3ub\0"
    "glSecondaryColor3ubEXT\0"
    "\0"
-   /* _mesa_function_pool[29231]: MultiTexCoord2ivARB (offset 389) */
+   /* _mesa_function_pool[29299]: MultiTexCoord2ivARB (offset 389) */
    "ip\0"
    "glMultiTexCoord2iv\0"
    "glMultiTexCoord2ivARB\0"
    "\0"
-   /* _mesa_function_pool[29276]: FogFuncSGIS (dynamic) */
+   /* _mesa_function_pool[29344]: FogFuncSGIS (dynamic) */
    "ip\0"
    "glFogFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[29294]: CopyTexSubImage2D (offset 326) */
+   /* _mesa_function_pool[29362]: CopyTexSubImage2D (offset 326) */
    "iiiiiiii\0"
    "glCopyTexSubImage2D\0"
    "glCopyTexSubImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[29347]: GetObjectParameterivARB (will be remapped) */
+   /* _mesa_function_pool[29415]: GetObjectParameterivARB (will be remapped) */
    "iip\0"
    "glGetObjectParameterivARB\0"
    "\0"
-   /* _mesa_function_pool[29378]: Color3iv (offset 16) */
+   /* _mesa_function_pool[29446]: Color3iv (offset 16) */
    "p\0"
    "glColor3iv\0"
    "\0"
-   /* _mesa_function_pool[29392]: TexCoord4fVertex4fSUN (dynamic) */
+   /* _mesa_function_pool[29460]: TexCoord4fVertex4fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord4fVertex4fSUN\0"
    "\0"
-   /* _mesa_function_pool[29426]: DrawElements (offset 311) */
+   /* _mesa_function_pool[29494]: DrawElements (offset 311) */
    "iiip\0"
    "glDrawElements\0"
    "\0"
-   /* _mesa_function_pool[29447]: BindVertexArrayAPPLE (will be remapped) */
+   /* _mesa_function_pool[29515]: BindVertexArrayAPPLE (will be remapped) */
    "i\0"
    "glBindVertexArrayAPPLE\0"
    "\0"
-   /* _mesa_function_pool[29473]: GetProgramLocalParameterdvARB (will be remapped) */
+   /* _mesa_function_pool[29541]: GetProgramLocalParameterdvARB (will be remapped) */
    "iip\0"
    "glGetProgramLocalParameterdvARB\0"
    "\0"
-   /* _mesa_function_pool[29510]: GetHistogramParameteriv (offset 363) */
+   /* _mesa_function_pool[29578]: GetHistogramParameteriv (offset 363) */
    "iip\0"
    "glGetHistogramParameteriv\0"
    "glGetHistogramParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[29570]: MultiTexCoord1iARB (offset 380) */
+   /* _mesa_function_pool[29638]: MultiTexCoord1iARB (offset 380) */
    "ii\0"
    "glMultiTexCoord1i\0"
    "glMultiTexCoord1iARB\0"
    "\0"
-   /* _mesa_function_pool[29613]: GetConvolutionFilter (offset 356) */
+   /* _mesa_function_pool[29681]: GetConvolutionFilter (offset 356) */
    "iiip\0"
    "glGetConvolutionFilter\0"
    "glGetConvolutionFilterEXT\0"
    "\0"
-   /* _mesa_function_pool[29668]: GetProgramivARB (will be remapped) */
+   /* _mesa_function_pool[29736]: GetProgramivARB (will be remapped) */
    "iip\0"
    "glGetProgramivARB\0"
    "\0"
-   /* _mesa_function_pool[29691]: TexBufferARB (will be remapped) */
+   /* _mesa_function_pool[29759]: TexBufferARB (will be remapped) */
    "iii\0"
    "glTexBufferARB\0"
    "glTexBuffer\0"
    "\0"
-   /* _mesa_function_pool[29723]: BlendFuncSeparateEXT (will be remapped) */
+   /* _mesa_function_pool[29791]: BlendFuncSeparateEXT (will be remapped) */
    "iiii\0"
    "glBlendFuncSeparate\0"
    "glBlendFuncSeparateEXT\0"
    "glBlendFuncSeparateINGR\0"
    "\0"
-   /* _mesa_function_pool[29796]: MapBufferRange (will be remapped) */
+   /* _mesa_function_pool[29864]: MapBufferRange (will be remapped) */
    "iiii\0"
    "glMapBufferRange\0"
    "\0"
-   /* _mesa_function_pool[29819]: ProgramParameters4dvNV (will be remapped) */
+   /* _mesa_function_pool[29887]: ProgramParameters4dvNV (will be remapped) */
    "iiip\0"
    "glProgramParameters4dvNV\0"
    "\0"
-   /* _mesa_function_pool[29850]: TexCoord2fColor3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[29918]: TexCoord2fColor3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glTexCoord2fColor3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[29887]: EvalPoint2 (offset 239) */
+   /* _mesa_function_pool[29955]: EvalPoint2 (offset 239) */
    "ii\0"
    "glEvalPoint2\0"
    "\0"
-   /* _mesa_function_pool[29904]: Uniform1uivEXT (will be remapped) */
+   /* _mesa_function_pool[29972]: Uniform1uivEXT (will be remapped) */
    "iip\0"
    "glUniform1uivEXT\0"
    "glUniform1uiv\0"
    "\0"
-   /* _mesa_function_pool[29940]: EvalPoint1 (offset 237) */
+   /* _mesa_function_pool[30008]: EvalPoint1 (offset 237) */
    "i\0"
    "glEvalPoint1\0"
    "\0"
-   /* _mesa_function_pool[29956]: Binormal3dvEXT (dynamic) */
+   /* _mesa_function_pool[30024]: Binormal3dvEXT (dynamic) */
    "p\0"
    "glBinormal3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[29976]: PopMatrix (offset 297) */
+   /* _mesa_function_pool[30044]: PopMatrix (offset 297) */
    "\0"
    "glPopMatrix\0"
    "\0"
-   /* _mesa_function_pool[29990]: FinishFenceNV (will be remapped) */
+   /* _mesa_function_pool[30058]: FinishFenceNV (will be remapped) */
    "i\0"
    "glFinishFenceNV\0"
    "\0"
-   /* _mesa_function_pool[30009]: GetFogFuncSGIS (dynamic) */
+   /* _mesa_function_pool[30077]: GetFogFuncSGIS (dynamic) */
    "p\0"
    "glGetFogFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[30029]: GetUniformLocationARB (will be remapped) */
+   /* _mesa_function_pool[30097]: GetUniformLocationARB (will be remapped) */
    "ip\0"
    "glGetUniformLocation\0"
    "glGetUniformLocationARB\0"
    "\0"
-   /* _mesa_function_pool[30078]: SecondaryColor3fEXT (will be remapped) */
+   /* _mesa_function_pool[30146]: SecondaryColor3fEXT (will be remapped) */
    "fff\0"
    "glSecondaryColor3f\0"
    "glSecondaryColor3fEXT\0"
    "\0"
-   /* _mesa_function_pool[30124]: GetTexGeniv (offset 280) */
+   /* _mesa_function_pool[30192]: GetTexGeniv (offset 280) */
    "iip\0"
    "glGetTexGeniv\0"
    "\0"
-   /* _mesa_function_pool[30143]: CombinerInputNV (will be remapped) */
+   /* _mesa_function_pool[30211]: CombinerInputNV (will be remapped) */
    "iiiiii\0"
    "glCombinerInputNV\0"
    "\0"
-   /* _mesa_function_pool[30169]: VertexAttrib3sARB (will be remapped) */
+   /* _mesa_function_pool[30237]: VertexAttrib3sARB (will be remapped) */
    "iiii\0"
    "glVertexAttrib3s\0"
    "glVertexAttrib3sARB\0"
    "\0"
-   /* _mesa_function_pool[30212]: IsTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[30280]: IsTransformFeedback (will be remapped) */
    "i\0"
    "glIsTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[30237]: ReplacementCodeuiNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[30305]: ReplacementCodeuiNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[30282]: Map2d (offset 222) */
+   /* _mesa_function_pool[30350]: Map2d (offset 222) */
    "iddiiddiip\0"
    "glMap2d\0"
    "\0"
-   /* _mesa_function_pool[30302]: Map2f (offset 223) */
+   /* _mesa_function_pool[30370]: Map2f (offset 223) */
    "iffiiffiip\0"
    "glMap2f\0"
    "\0"
-   /* _mesa_function_pool[30322]: ProgramStringARB (will be remapped) */
+   /* _mesa_function_pool[30390]: ProgramStringARB (will be remapped) */
    "iiip\0"
    "glProgramStringARB\0"
    "\0"
-   /* _mesa_function_pool[30347]: Vertex4s (offset 148) */
+   /* _mesa_function_pool[30415]: Vertex4s (offset 148) */
    "iiii\0"
    "glVertex4s\0"
    "\0"
-   /* _mesa_function_pool[30364]: TexCoord4fVertex4fvSUN (dynamic) */
+   /* _mesa_function_pool[30432]: TexCoord4fVertex4fvSUN (dynamic) */
    "pp\0"
    "glTexCoord4fVertex4fvSUN\0"
    "\0"
-   /* _mesa_function_pool[30393]: VertexAttrib3sNV (will be remapped) */
+   /* _mesa_function_pool[30461]: VertexAttrib3sNV (will be remapped) */
    "iiii\0"
    "glVertexAttrib3sNV\0"
    "\0"
-   /* _mesa_function_pool[30418]: VertexAttrib1fNV (will be remapped) */
+   /* _mesa_function_pool[30486]: VertexAttrib1fNV (will be remapped) */
    "if\0"
    "glVertexAttrib1fNV\0"
    "\0"
-   /* _mesa_function_pool[30441]: Vertex4f (offset 144) */
+   /* _mesa_function_pool[30509]: Vertex4f (offset 144) */
    "ffff\0"
    "glVertex4f\0"
    "\0"
-   /* _mesa_function_pool[30458]: EvalCoord1d (offset 228) */
+   /* _mesa_function_pool[30526]: EvalCoord1d (offset 228) */
    "d\0"
    "glEvalCoord1d\0"
    "\0"
-   /* _mesa_function_pool[30475]: Vertex4d (offset 142) */
+   /* _mesa_function_pool[30543]: Vertex4d (offset 142) */
    "dddd\0"
    "glVertex4d\0"
    "\0"
-   /* _mesa_function_pool[30492]: RasterPos4dv (offset 79) */
+   /* _mesa_function_pool[30560]: RasterPos4dv (offset 79) */
    "p\0"
    "glRasterPos4dv\0"
    "\0"
-   /* _mesa_function_pool[30510]: GetGraphicsResetStatusARB (will be remapped) */
+   /* _mesa_function_pool[30578]: GetGraphicsResetStatusARB (will be remapped) */
    "\0"
    "glGetGraphicsResetStatusARB\0"
    "\0"
-   /* _mesa_function_pool[30540]: UseShaderProgramEXT (will be remapped) */
+   /* _mesa_function_pool[30608]: UseShaderProgramEXT (will be remapped) */
    "ii\0"
    "glUseShaderProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[30566]: VertexAttribP2uiv (will be remapped) */
+   /* _mesa_function_pool[30634]: VertexAttribP2uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP2uiv\0"
    "\0"
-   /* _mesa_function_pool[30592]: PrimitiveRestartNV (will be remapped) */
+   /* _mesa_function_pool[30660]: PrimitiveRestartNV (will be remapped) */
    "\0"
    "glPrimitiveRestartNV\0"
    "\0"
-   /* _mesa_function_pool[30615]: GetCompressedTexImageARB (will be remapped) */
+   /* _mesa_function_pool[30683]: GetCompressedTexImageARB (will be remapped) */
    "iip\0"
    "glGetCompressedTexImage\0"
    "glGetCompressedTexImageARB\0"
    "\0"
-   /* _mesa_function_pool[30671]: GetTexGenfv (offset 279) */
+   /* _mesa_function_pool[30739]: GetTexGenfv (offset 279) */
    "iip\0"
    "glGetTexGenfv\0"
    "\0"
-   /* _mesa_function_pool[30690]: Vertex4i (offset 146) */
+   /* _mesa_function_pool[30758]: Vertex4i (offset 146) */
    "iiii\0"
    "glVertex4i\0"
    "\0"
-   /* _mesa_function_pool[30707]: VertexWeightPointerEXT (dynamic) */
+   /* _mesa_function_pool[30775]: VertexWeightPointerEXT (dynamic) */
    "iiip\0"
    "glVertexWeightPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[30738]: GetHistogram (offset 361) */
+   /* _mesa_function_pool[30806]: GetHistogram (offset 361) */
    "iiiip\0"
    "glGetHistogram\0"
    "glGetHistogramEXT\0"
    "\0"
-   /* _mesa_function_pool[30778]: ActiveStencilFaceEXT (will be remapped) */
+   /* _mesa_function_pool[30846]: ActiveStencilFaceEXT (will be remapped) */
    "i\0"
    "glActiveStencilFaceEXT\0"
    "\0"
-   /* _mesa_function_pool[30804]: StencilFuncSeparateATI (will be remapped) */
+   /* _mesa_function_pool[30872]: StencilFuncSeparateATI (will be remapped) */
    "iiii\0"
    "glStencilFuncSeparateATI\0"
    "\0"
-   /* _mesa_function_pool[30835]: Materialf (offset 169) */
+   /* _mesa_function_pool[30903]: Materialf (offset 169) */
    "iif\0"
    "glMaterialf\0"
    "\0"
-   /* _mesa_function_pool[30852]: GetShaderSourceARB (will be remapped) */
+   /* _mesa_function_pool[30920]: GetShaderSourceARB (will be remapped) */
    "iipp\0"
    "glGetShaderSource\0"
    "glGetShaderSourceARB\0"
    "\0"
-   /* _mesa_function_pool[30897]: IglooInterfaceSGIX (dynamic) */
+   /* _mesa_function_pool[30965]: IglooInterfaceSGIX (dynamic) */
    "ip\0"
    "glIglooInterfaceSGIX\0"
    "\0"
-   /* _mesa_function_pool[30922]: Materiali (offset 171) */
+   /* _mesa_function_pool[30990]: Materiali (offset 171) */
    "iii\0"
    "glMateriali\0"
    "\0"
-   /* _mesa_function_pool[30939]: VertexAttrib4dNV (will be remapped) */
+   /* _mesa_function_pool[31007]: VertexAttrib4dNV (will be remapped) */
    "idddd\0"
    "glVertexAttrib4dNV\0"
    "\0"
-   /* _mesa_function_pool[30965]: MultiModeDrawElementsIBM (will be remapped) */
+   /* _mesa_function_pool[31033]: MultiModeDrawElementsIBM (will be remapped) */
    "ppipii\0"
    "glMultiModeDrawElementsIBM\0"
    "\0"
-   /* _mesa_function_pool[31000]: Indexsv (offset 51) */
+   /* _mesa_function_pool[31068]: Indexsv (offset 51) */
    "p\0"
    "glIndexsv\0"
    "\0"
-   /* _mesa_function_pool[31013]: MultiTexCoord4svARB (offset 407) */
+   /* _mesa_function_pool[31081]: MultiTexCoord4svARB (offset 407) */
    "ip\0"
    "glMultiTexCoord4sv\0"
    "glMultiTexCoord4svARB\0"
    "\0"
-   /* _mesa_function_pool[31058]: LightModelfv (offset 164) */
+   /* _mesa_function_pool[31126]: LightModelfv (offset 164) */
    "ip\0"
    "glLightModelfv\0"
    "\0"
-   /* _mesa_function_pool[31077]: TexCoord2dv (offset 103) */
+   /* _mesa_function_pool[31145]: TexCoord2dv (offset 103) */
    "p\0"
    "glTexCoord2dv\0"
    "\0"
-   /* _mesa_function_pool[31094]: GenQueriesARB (will be remapped) */
+   /* _mesa_function_pool[31162]: GenQueriesARB (will be remapped) */
    "ip\0"
    "glGenQueries\0"
    "glGenQueriesARB\0"
    "\0"
-   /* _mesa_function_pool[31127]: EvalCoord1dv (offset 229) */
+   /* _mesa_function_pool[31195]: EvalCoord1dv (offset 229) */
    "p\0"
    "glEvalCoord1dv\0"
    "\0"
-   /* _mesa_function_pool[31145]: ReplacementCodeuiVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[31213]: ReplacementCodeuiVertex3fSUN (dynamic) */
    "ifff\0"
    "glReplacementCodeuiVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[31182]: Translated (offset 303) */
+   /* _mesa_function_pool[31250]: Translated (offset 303) */
    "ddd\0"
    "glTranslated\0"
    "\0"
-   /* _mesa_function_pool[31200]: Translatef (offset 304) */
+   /* _mesa_function_pool[31268]: Translatef (offset 304) */
    "fff\0"
    "glTranslatef\0"
    "\0"
-   /* _mesa_function_pool[31218]: Uniform3uiEXT (will be remapped) */
+   /* _mesa_function_pool[31286]: Uniform3uiEXT (will be remapped) */
    "iiii\0"
    "glUniform3uiEXT\0"
    "glUniform3ui\0"
    "\0"
-   /* _mesa_function_pool[31253]: StencilMask (offset 209) */
+   /* _mesa_function_pool[31321]: StencilMask (offset 209) */
    "i\0"
    "glStencilMask\0"
    "\0"
-   /* _mesa_function_pool[31270]: Tangent3iEXT (dynamic) */
+   /* _mesa_function_pool[31338]: Tangent3iEXT (dynamic) */
    "iii\0"
    "glTangent3iEXT\0"
    "\0"
-   /* _mesa_function_pool[31290]: ClampColorARB (will be remapped) */
+   /* _mesa_function_pool[31358]: ClampColorARB (will be remapped) */
    "ii\0"
    "glClampColorARB\0"
    "\0"
-   /* _mesa_function_pool[31310]: GetLightiv (offset 265) */
+   /* _mesa_function_pool[31378]: GetLightiv (offset 265) */
    "iip\0"
    "glGetLightiv\0"
    "\0"
-   /* _mesa_function_pool[31328]: GetSamplerParameterIiv (will be remapped) */
+   /* _mesa_function_pool[31396]: GetSamplerParameterIiv (will be remapped) */
    "iip\0"
    "glGetSamplerParameterIiv\0"
    "\0"
-   /* _mesa_function_pool[31358]: DrawMeshArraysSUN (dynamic) */
+   /* _mesa_function_pool[31426]: DrawMeshArraysSUN (dynamic) */
    "iiii\0"
    "glDrawMeshArraysSUN\0"
    "\0"
-   /* _mesa_function_pool[31384]: IsList (offset 287) */
+   /* _mesa_function_pool[31452]: IsList (offset 287) */
    "i\0"
    "glIsList\0"
    "\0"
-   /* _mesa_function_pool[31396]: GetnPixelMapusvARB (will be remapped) */
+   /* _mesa_function_pool[31464]: GetnPixelMapusvARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapusvARB\0"
    "\0"
-   /* _mesa_function_pool[31422]: IsSync (will be remapped) */
+   /* _mesa_function_pool[31490]: IsSync (will be remapped) */
    "i\0"
    "glIsSync\0"
    "\0"
-   /* _mesa_function_pool[31434]: RenderMode (offset 196) */
+   /* _mesa_function_pool[31502]: RenderMode (offset 196) */
    "i\0"
    "glRenderMode\0"
    "\0"
-   /* _mesa_function_pool[31450]: GetMapControlPointsNV (dynamic) */
+   /* _mesa_function_pool[31518]: GetMapControlPointsNV (dynamic) */
    "iiiiiip\0"
    "glGetMapControlPointsNV\0"
    "\0"
-   /* _mesa_function_pool[31483]: DrawBuffersARB (will be remapped) */
+   /* _mesa_function_pool[31551]: DrawBuffersARB (will be remapped) */
    "ip\0"
    "glDrawBuffers\0"
    "glDrawBuffersARB\0"
    "glDrawBuffersATI\0"
    "glDrawBuffersNV\0"
    "\0"
-   /* _mesa_function_pool[31551]: ClearBufferiv (will be remapped) */
+   /* _mesa_function_pool[31619]: ClearBufferiv (will be remapped) */
    "iip\0"
    "glClearBufferiv\0"
    "\0"
-   /* _mesa_function_pool[31572]: ProgramLocalParameter4fARB (will be remapped) */
+   /* _mesa_function_pool[31640]: ProgramLocalParameter4fARB (will be remapped) */
    "iiffff\0"
    "glProgramLocalParameter4fARB\0"
    "\0"
-   /* _mesa_function_pool[31609]: SpriteParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[31677]: SpriteParameterivSGIX (dynamic) */
    "ip\0"
    "glSpriteParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[31637]: ProvokingVertexEXT (will be remapped) */
+   /* _mesa_function_pool[31705]: ProvokingVertexEXT (will be remapped) */
    "i\0"
    "glProvokingVertexEXT\0"
    "glProvokingVertex\0"
    "\0"
-   /* _mesa_function_pool[31679]: MultiTexCoord1fARB (offset 378) */
+   /* _mesa_function_pool[31747]: MultiTexCoord1fARB (offset 378) */
    "if\0"
    "glMultiTexCoord1f\0"
    "glMultiTexCoord1fARB\0"
    "\0"
-   /* _mesa_function_pool[31722]: LoadName (offset 198) */
+   /* _mesa_function_pool[31790]: LoadName (offset 198) */
    "i\0"
    "glLoadName\0"
    "\0"
-   /* _mesa_function_pool[31736]: VertexAttribs4ubvNV (will be remapped) */
+   /* _mesa_function_pool[31804]: VertexAttribs4ubvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4ubvNV\0"
    "\0"
-   /* _mesa_function_pool[31763]: WeightsvARB (dynamic) */
+   /* _mesa_function_pool[31831]: WeightsvARB (dynamic) */
    "ip\0"
    "glWeightsvARB\0"
    "\0"
-   /* _mesa_function_pool[31781]: NormalP3ui (will be remapped) */
+   /* _mesa_function_pool[31849]: NormalP3ui (will be remapped) */
    "ii\0"
    "glNormalP3ui\0"
    "\0"
-   /* _mesa_function_pool[31798]: Uniform1fvARB (will be remapped) */
+   /* _mesa_function_pool[31866]: Uniform1fvARB (will be remapped) */
    "iip\0"
    "glUniform1fv\0"
    "glUniform1fvARB\0"
    "\0"
-   /* _mesa_function_pool[31832]: CopyTexSubImage1D (offset 325) */
+   /* _mesa_function_pool[31900]: CopyTexSubImage1D (offset 325) */
    "iiiiii\0"
    "glCopyTexSubImage1D\0"
    "glCopyTexSubImage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[31883]: CullFace (offset 152) */
+   /* _mesa_function_pool[31951]: CullFace (offset 152) */
    "i\0"
    "glCullFace\0"
    "\0"
-   /* _mesa_function_pool[31897]: BindTexture (offset 307) */
+   /* _mesa_function_pool[31965]: BindTexture (offset 307) */
    "ii\0"
    "glBindTexture\0"
    "glBindTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[31932]: VertexAttribs2fvNV (will be remapped) */
+   /* _mesa_function_pool[32000]: VertexAttribs2fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2fvNV\0"
    "\0"
-   /* _mesa_function_pool[31958]: MultiTexCoord4fARB (offset 402) */
+   /* _mesa_function_pool[32026]: MultiTexCoord4fARB (offset 402) */
    "iffff\0"
    "glMultiTexCoord4f\0"
    "glMultiTexCoord4fARB\0"
    "\0"
-   /* _mesa_function_pool[32004]: VertexAttribs3svNV (will be remapped) */
+   /* _mesa_function_pool[32072]: VertexAttribs3svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs3svNV\0"
    "\0"
-   /* _mesa_function_pool[32030]: StencilFunc (offset 243) */
+   /* _mesa_function_pool[32098]: StencilFunc (offset 243) */
    "iii\0"
    "glStencilFunc\0"
    "\0"
-   /* _mesa_function_pool[32049]: CopyPixels (offset 255) */
+   /* _mesa_function_pool[32117]: CopyPixels (offset 255) */
    "iiiii\0"
    "glCopyPixels\0"
    "\0"
-   /* _mesa_function_pool[32069]: Rectsv (offset 93) */
+   /* _mesa_function_pool[32137]: Rectsv (offset 93) */
    "pp\0"
    "glRectsv\0"
    "\0"
-   /* _mesa_function_pool[32082]: ReplacementCodeuivSUN (dynamic) */
+   /* _mesa_function_pool[32150]: ReplacementCodeuivSUN (dynamic) */
    "p\0"
    "glReplacementCodeuivSUN\0"
    "\0"
-   /* _mesa_function_pool[32109]: MultiTexCoordP2uiv (will be remapped) */
+   /* _mesa_function_pool[32177]: MultiTexCoordP2uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP2uiv\0"
    "\0"
-   /* _mesa_function_pool[32135]: EnableVertexAttribArrayARB (will be remapped) */
+   /* _mesa_function_pool[32203]: EnableVertexAttribArrayARB (will be remapped) */
    "i\0"
    "glEnableVertexAttribArray\0"
    "glEnableVertexAttribArrayARB\0"
    "\0"
-   /* _mesa_function_pool[32193]: NormalPointervINTEL (dynamic) */
+   /* _mesa_function_pool[32261]: NormalPointervINTEL (dynamic) */
    "ip\0"
    "glNormalPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[32219]: CopyConvolutionFilter2D (offset 355) */
+   /* _mesa_function_pool[32287]: CopyConvolutionFilter2D (offset 355) */
    "iiiiii\0"
    "glCopyConvolutionFilter2D\0"
    "glCopyConvolutionFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[32282]: WindowPos3ivMESA (will be remapped) */
+   /* _mesa_function_pool[32350]: WindowPos3ivMESA (will be remapped) */
    "p\0"
    "glWindowPos3iv\0"
    "glWindowPos3ivARB\0"
    "glWindowPos3ivMESA\0"
    "\0"
-   /* _mesa_function_pool[32337]: CopyBufferSubData (will be remapped) */
+   /* _mesa_function_pool[32405]: CopyBufferSubData (will be remapped) */
    "iiiii\0"
    "glCopyBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[32364]: NormalPointer (offset 318) */
+   /* _mesa_function_pool[32432]: NormalPointer (offset 318) */
    "iip\0"
    "glNormalPointer\0"
    "\0"
-   /* _mesa_function_pool[32385]: TexParameterfv (offset 179) */
+   /* _mesa_function_pool[32453]: TexParameterfv (offset 179) */
    "iip\0"
    "glTexParameterfv\0"
    "\0"
-   /* _mesa_function_pool[32407]: IsBufferARB (will be remapped) */
+   /* _mesa_function_pool[32475]: IsBufferARB (will be remapped) */
    "i\0"
    "glIsBuffer\0"
    "glIsBufferARB\0"
    "\0"
-   /* _mesa_function_pool[32435]: WindowPos4iMESA (will be remapped) */
+   /* _mesa_function_pool[32503]: WindowPos4iMESA (will be remapped) */
    "iiii\0"
    "glWindowPos4iMESA\0"
    "\0"
-   /* _mesa_function_pool[32459]: VertexAttrib4uivARB (will be remapped) */
+   /* _mesa_function_pool[32527]: VertexAttrib4uivARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4uiv\0"
    "glVertexAttrib4uivARB\0"
    "\0"
-   /* _mesa_function_pool[32504]: Tangent3bvEXT (dynamic) */
+   /* _mesa_function_pool[32572]: Tangent3bvEXT (dynamic) */
    "p\0"
    "glTangent3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[32523]: VertexAttribI3uivEXT (will be remapped) */
+   /* _mesa_function_pool[32591]: VertexAttribI3uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI3uivEXT\0"
    "glVertexAttribI3uiv\0"
    "\0"
-   /* _mesa_function_pool[32570]: UniformMatrix3x4fv (will be remapped) */
+   /* _mesa_function_pool[32638]: UniformMatrix3x4fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x4fv\0"
    "\0"
-   /* _mesa_function_pool[32597]: ClipPlane (offset 150) */
+   /* _mesa_function_pool[32665]: ClipPlane (offset 150) */
    "ip\0"
    "glClipPlane\0"
    "\0"
-   /* _mesa_function_pool[32613]: Recti (offset 90) */
+   /* _mesa_function_pool[32681]: Recti (offset 90) */
    "iiii\0"
    "glRecti\0"
    "\0"
-   /* _mesa_function_pool[32627]: TrackMatrixNV (will be remapped) */
+   /* _mesa_function_pool[32695]: TrackMatrixNV (will be remapped) */
    "iiii\0"
    "glTrackMatrixNV\0"
    "\0"
-   /* _mesa_function_pool[32649]: DrawRangeElementsBaseVertex (will be remapped) */
+   /* _mesa_function_pool[32717]: DrawRangeElementsBaseVertex (will be remapped) */
    "iiiiipi\0"
    "glDrawRangeElementsBaseVertex\0"
    "\0"
-   /* _mesa_function_pool[32688]: SamplerParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[32756]: SamplerParameterIuiv (will be remapped) */
    "iip\0"
    "glSamplerParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[32716]: TexCoordPointervINTEL (dynamic) */
+   /* _mesa_function_pool[32784]: TexCoordPointervINTEL (dynamic) */
    "iip\0"
    "glTexCoordPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[32745]: DeleteBuffersARB (will be remapped) */
+   /* _mesa_function_pool[32813]: DeleteBuffersARB (will be remapped) */
    "ip\0"
    "glDeleteBuffers\0"
    "glDeleteBuffersARB\0"
    "\0"
-   /* _mesa_function_pool[32784]: ImageTransformParameteriHP (dynamic) */
+   /* _mesa_function_pool[32852]: ImageTransformParameteriHP (dynamic) */
    "iii\0"
    "glImageTransformParameteriHP\0"
    "\0"
-   /* _mesa_function_pool[32818]: WindowPos4fvMESA (will be remapped) */
+   /* _mesa_function_pool[32886]: WindowPos4fvMESA (will be remapped) */
    "p\0"
    "glWindowPos4fvMESA\0"
    "\0"
-   /* _mesa_function_pool[32840]: GetPixelMapuiv (offset 272) */
+   /* _mesa_function_pool[32908]: GetPixelMapuiv (offset 272) */
    "ip\0"
    "glGetPixelMapuiv\0"
    "\0"
-   /* _mesa_function_pool[32861]: Rectf (offset 88) */
+   /* _mesa_function_pool[32929]: Rectf (offset 88) */
    "ffff\0"
    "glRectf\0"
    "\0"
-   /* _mesa_function_pool[32875]: VertexAttrib1sNV (will be remapped) */
+   /* _mesa_function_pool[32943]: VertexAttrib1sNV (will be remapped) */
    "ii\0"
    "glVertexAttrib1sNV\0"
    "\0"
-   /* _mesa_function_pool[32898]: Indexfv (offset 47) */
+   /* _mesa_function_pool[32966]: Indexfv (offset 47) */
    "p\0"
    "glIndexfv\0"
    "\0"
-   /* _mesa_function_pool[32911]: ColorP3uiv (will be remapped) */
+   /* _mesa_function_pool[32979]: ColorP3uiv (will be remapped) */
    "ip\0"
    "glColorP3uiv\0"
    "\0"
-   /* _mesa_function_pool[32928]: SecondaryColor3svEXT (will be remapped) */
+   /* _mesa_function_pool[32996]: SecondaryColor3svEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3sv\0"
    "glSecondaryColor3svEXT\0"
    "\0"
-   /* _mesa_function_pool[32974]: LoadTransposeMatrixfARB (will be remapped) */
+   /* _mesa_function_pool[33042]: LoadTransposeMatrixfARB (will be remapped) */
    "p\0"
    "glLoadTransposeMatrixf\0"
    "glLoadTransposeMatrixfARB\0"
    "\0"
-   /* _mesa_function_pool[33026]: GetPointerv (offset 329) */
+   /* _mesa_function_pool[33094]: GetPointerv (offset 329) */
    "ip\0"
    "glGetPointerv\0"
    "glGetPointervEXT\0"
    "\0"
-   /* _mesa_function_pool[33061]: Tangent3bEXT (dynamic) */
+   /* _mesa_function_pool[33129]: Tangent3bEXT (dynamic) */
    "iii\0"
    "glTangent3bEXT\0"
    "\0"
-   /* _mesa_function_pool[33081]: CombinerParameterfNV (will be remapped) */
+   /* _mesa_function_pool[33149]: CombinerParameterfNV (will be remapped) */
    "if\0"
    "glCombinerParameterfNV\0"
    "\0"
-   /* _mesa_function_pool[33108]: IndexMask (offset 212) */
+   /* _mesa_function_pool[33176]: IndexMask (offset 212) */
    "i\0"
    "glIndexMask\0"
    "\0"
-   /* _mesa_function_pool[33123]: BindProgramNV (will be remapped) */
+   /* _mesa_function_pool[33191]: BindProgramNV (will be remapped) */
    "ii\0"
    "glBindProgramARB\0"
    "glBindProgramNV\0"
    "\0"
-   /* _mesa_function_pool[33160]: VertexAttrib4svARB (will be remapped) */
+   /* _mesa_function_pool[33228]: VertexAttrib4svARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4sv\0"
    "glVertexAttrib4svARB\0"
    "\0"
-   /* _mesa_function_pool[33203]: GetFloatv (offset 262) */
+   /* _mesa_function_pool[33271]: GetFloatv (offset 262) */
    "ip\0"
    "glGetFloatv\0"
    "\0"
-   /* _mesa_function_pool[33219]: CreateDebugObjectMESA (dynamic) */
+   /* _mesa_function_pool[33287]: CreateDebugObjectMESA (dynamic) */
    "\0"
    "glCreateDebugObjectMESA\0"
    "\0"
-   /* _mesa_function_pool[33245]: GetShaderiv (will be remapped) */
+   /* _mesa_function_pool[33313]: GetShaderiv (will be remapped) */
    "iip\0"
    "glGetShaderiv\0"
    "\0"
-   /* _mesa_function_pool[33264]: ClientWaitSync (will be remapped) */
+   /* _mesa_function_pool[33332]: ClientWaitSync (will be remapped) */
    "iii\0"
    "glClientWaitSync\0"
    "\0"
-   /* _mesa_function_pool[33286]: TexCoord4s (offset 124) */
+   /* _mesa_function_pool[33354]: TexCoord4s (offset 124) */
    "iiii\0"
    "glTexCoord4s\0"
    "\0"
-   /* _mesa_function_pool[33305]: TexCoord3sv (offset 117) */
+   /* _mesa_function_pool[33373]: TexCoord3sv (offset 117) */
    "p\0"
    "glTexCoord3sv\0"
    "\0"
-   /* _mesa_function_pool[33322]: BindFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[33390]: BindFragmentShaderATI (will be remapped) */
    "i\0"
    "glBindFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[33349]: PopAttrib (offset 218) */
+   /* _mesa_function_pool[33417]: PopAttrib (offset 218) */
    "\0"
    "glPopAttrib\0"
    "\0"
-   /* _mesa_function_pool[33363]: Fogfv (offset 154) */
+   /* _mesa_function_pool[33431]: Fogfv (offset 154) */
    "ip\0"
    "glFogfv\0"
    "\0"
-   /* _mesa_function_pool[33375]: UnmapBufferARB (will be remapped) */
+   /* _mesa_function_pool[33443]: UnmapBufferARB (will be remapped) */
    "i\0"
    "glUnmapBuffer\0"
    "glUnmapBufferARB\0"
    "\0"
-   /* _mesa_function_pool[33409]: InitNames (offset 197) */
+   /* _mesa_function_pool[33477]: InitNames (offset 197) */
    "\0"
    "glInitNames\0"
    "\0"
-   /* _mesa_function_pool[33423]: Normal3sv (offset 61) */
+   /* _mesa_function_pool[33491]: Normal3sv (offset 61) */
    "p\0"
    "glNormal3sv\0"
    "\0"
-   /* _mesa_function_pool[33438]: Minmax (offset 368) */
+   /* _mesa_function_pool[33506]: Minmax (offset 368) */
    "iii\0"
    "glMinmax\0"
    "glMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[33464]: TexCoord4d (offset 118) */
+   /* _mesa_function_pool[33532]: TexCoord4d (offset 118) */
    "dddd\0"
    "glTexCoord4d\0"
    "\0"
-   /* _mesa_function_pool[33483]: DeformationMap3dSGIX (dynamic) */
+   /* _mesa_function_pool[33551]: DeformationMap3dSGIX (dynamic) */
    "iddiiddiiddiip\0"
    "glDeformationMap3dSGIX\0"
    "\0"
-   /* _mesa_function_pool[33522]: TexCoord4f (offset 120) */
+   /* _mesa_function_pool[33590]: TexCoord4f (offset 120) */
    "ffff\0"
    "glTexCoord4f\0"
    "\0"
-   /* _mesa_function_pool[33541]: FogCoorddvEXT (will be remapped) */
+   /* _mesa_function_pool[33609]: FogCoorddvEXT (will be remapped) */
    "p\0"
    "glFogCoorddv\0"
    "glFogCoorddvEXT\0"
    "\0"
-   /* _mesa_function_pool[33573]: FinishTextureSUNX (dynamic) */
+   /* _mesa_function_pool[33641]: FinishTextureSUNX (dynamic) */
    "\0"
    "glFinishTextureSUNX\0"
    "\0"
-   /* _mesa_function_pool[33595]: GetFragmentLightfvSGIX (dynamic) */
+   /* _mesa_function_pool[33663]: GetFragmentLightfvSGIX (dynamic) */
    "iip\0"
    "glGetFragmentLightfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[33625]: Binormal3fvEXT (dynamic) */
+   /* _mesa_function_pool[33693]: Binormal3fvEXT (dynamic) */
    "p\0"
    "glBinormal3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[33645]: GetBooleanv (offset 258) */
+   /* _mesa_function_pool[33713]: GetBooleanv (offset 258) */
    "ip\0"
    "glGetBooleanv\0"
    "\0"
-   /* _mesa_function_pool[33663]: ColorFragmentOp3ATI (will be remapped) */
+   /* _mesa_function_pool[33731]: ColorFragmentOp3ATI (will be remapped) */
    "iiiiiiiiiiiii\0"
    "glColorFragmentOp3ATI\0"
    "\0"
-   /* _mesa_function_pool[33700]: Hint (offset 158) */
+   /* _mesa_function_pool[33768]: Hint (offset 158) */
    "ii\0"
    "glHint\0"
    "\0"
-   /* _mesa_function_pool[33711]: Color4dv (offset 28) */
+   /* _mesa_function_pool[33779]: Color4dv (offset 28) */
    "p\0"
    "glColor4dv\0"
    "\0"
-   /* _mesa_function_pool[33725]: VertexAttrib2svARB (will be remapped) */
+   /* _mesa_function_pool[33793]: VertexAttrib2svARB (will be remapped) */
    "ip\0"
    "glVertexAttrib2sv\0"
    "glVertexAttrib2svARB\0"
    "\0"
-   /* _mesa_function_pool[33768]: AreProgramsResidentNV (will be remapped) */
+   /* _mesa_function_pool[33836]: AreProgramsResidentNV (will be remapped) */
    "ipp\0"
    "glAreProgramsResidentNV\0"
    "\0"
-   /* _mesa_function_pool[33797]: WindowPos3svMESA (will be remapped) */
+   /* _mesa_function_pool[33865]: WindowPos3svMESA (will be remapped) */
    "p\0"
    "glWindowPos3sv\0"
    "glWindowPos3svARB\0"
    "glWindowPos3svMESA\0"
    "\0"
-   /* _mesa_function_pool[33852]: CopyColorSubTable (offset 347) */
+   /* _mesa_function_pool[33920]: CopyColorSubTable (offset 347) */
    "iiiii\0"
    "glCopyColorSubTable\0"
    "glCopyColorSubTableEXT\0"
    "\0"
-   /* _mesa_function_pool[33902]: WeightdvARB (dynamic) */
+   /* _mesa_function_pool[33970]: WeightdvARB (dynamic) */
    "ip\0"
    "glWeightdvARB\0"
    "\0"
-   /* _mesa_function_pool[33920]: DeleteRenderbuffersEXT (will be remapped) */
+   /* _mesa_function_pool[33988]: DeleteRenderbuffersEXT (will be remapped) */
    "ip\0"
    "glDeleteRenderbuffers\0"
    "glDeleteRenderbuffersEXT\0"
    "\0"
-   /* _mesa_function_pool[33971]: VertexAttrib4NubvARB (will be remapped) */
+   /* _mesa_function_pool[34039]: VertexAttrib4NubvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nubv\0"
    "glVertexAttrib4NubvARB\0"
    "\0"
-   /* _mesa_function_pool[34018]: VertexAttrib3dvNV (will be remapped) */
+   /* _mesa_function_pool[34086]: VertexAttrib3dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3dvNV\0"
    "\0"
-   /* _mesa_function_pool[34042]: GetObjectParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[34110]: GetObjectParameterfvARB (will be remapped) */
    "iip\0"
    "glGetObjectParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[34073]: Vertex4iv (offset 147) */
+   /* _mesa_function_pool[34141]: Vertex4iv (offset 147) */
    "p\0"
    "glVertex4iv\0"
    "\0"
-   /* _mesa_function_pool[34088]: GetProgramEnvParameterdvARB (will be remapped) */
+   /* _mesa_function_pool[34156]: GetProgramEnvParameterdvARB (will be remapped) */
    "iip\0"
    "glGetProgramEnvParameterdvARB\0"
    "\0"
-   /* _mesa_function_pool[34123]: TexCoord4dv (offset 119) */
+   /* _mesa_function_pool[34191]: TexCoord4dv (offset 119) */
    "p\0"
    "glTexCoord4dv\0"
    "\0"
-   /* _mesa_function_pool[34140]: LockArraysEXT (will be remapped) */
+   /* _mesa_function_pool[34208]: LockArraysEXT (will be remapped) */
    "ii\0"
    "glLockArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[34160]: Begin (offset 7) */
+   /* _mesa_function_pool[34228]: Begin (offset 7) */
    "i\0"
    "glBegin\0"
    "\0"
-   /* _mesa_function_pool[34171]: LightModeli (offset 165) */
+   /* _mesa_function_pool[34239]: LightModeli (offset 165) */
    "ii\0"
    "glLightModeli\0"
    "\0"
-   /* _mesa_function_pool[34189]: FogCoordPointerListIBM (dynamic) */
+   /* _mesa_function_pool[34257]: FogCoordPointerListIBM (dynamic) */
    "iipi\0"
    "glFogCoordPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[34220]: Rectfv (offset 89) */
+   /* _mesa_function_pool[34288]: Rectfv (offset 89) */
    "pp\0"
    "glRectfv\0"
    "\0"
-   /* _mesa_function_pool[34233]: LightModelf (offset 163) */
+   /* _mesa_function_pool[34301]: LightModelf (offset 163) */
    "if\0"
    "glLightModelf\0"
    "\0"
-   /* _mesa_function_pool[34251]: GetTexParameterfv (offset 282) */
+   /* _mesa_function_pool[34319]: GetTexParameterfv (offset 282) */
    "iip\0"
    "glGetTexParameterfv\0"
    "\0"
-   /* _mesa_function_pool[34276]: GetLightfv (offset 264) */
+   /* _mesa_function_pool[34344]: GetLightfv (offset 264) */
    "iip\0"
    "glGetLightfv\0"
    "\0"
-   /* _mesa_function_pool[34294]: PixelTransformParameterivEXT (dynamic) */
+   /* _mesa_function_pool[34362]: PixelTransformParameterivEXT (dynamic) */
    "iip\0"
    "glPixelTransformParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[34330]: BinormalPointerEXT (dynamic) */
+   /* _mesa_function_pool[34398]: BinormalPointerEXT (dynamic) */
    "iip\0"
    "glBinormalPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[34356]: VertexP4uiv (will be remapped) */
+   /* _mesa_function_pool[34424]: VertexP4uiv (will be remapped) */
    "ip\0"
    "glVertexP4uiv\0"
    "\0"
-   /* _mesa_function_pool[34374]: GetCombinerInputParameterivNV (will be remapped) */
+   /* _mesa_function_pool[34442]: GetCombinerInputParameterivNV (will be remapped) */
    "iiiip\0"
    "glGetCombinerInputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[34413]: Disable (offset 214) */
+   /* _mesa_function_pool[34481]: Disable (offset 214) */
    "i\0"
    "glDisable\0"
    "\0"
-   /* _mesa_function_pool[34426]: MultiTexCoord2fvARB (offset 387) */
+   /* _mesa_function_pool[34494]: MultiTexCoord2fvARB (offset 387) */
    "ip\0"
    "glMultiTexCoord2fv\0"
    "glMultiTexCoord2fvARB\0"
    "\0"
-   /* _mesa_function_pool[34471]: GetRenderbufferParameterivEXT (will be remapped) */
+   /* _mesa_function_pool[34539]: GetRenderbufferParameterivEXT (will be remapped) */
    "iip\0"
    "glGetRenderbufferParameteriv\0"
    "glGetRenderbufferParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[34537]: CombinerParameterivNV (will be remapped) */
+   /* _mesa_function_pool[34605]: CombinerParameterivNV (will be remapped) */
    "ip\0"
    "glCombinerParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[34565]: GenFragmentShadersATI (will be remapped) */
+   /* _mesa_function_pool[34633]: GenFragmentShadersATI (will be remapped) */
    "i\0"
    "glGenFragmentShadersATI\0"
    "\0"
-   /* _mesa_function_pool[34592]: DrawArrays (offset 310) */
+   /* _mesa_function_pool[34660]: DrawArrays (offset 310) */
    "iii\0"
    "glDrawArrays\0"
    "glDrawArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[34626]: WeightuivARB (dynamic) */
+   /* _mesa_function_pool[34694]: WeightuivARB (dynamic) */
    "ip\0"
    "glWeightuivARB\0"
    "\0"
-   /* _mesa_function_pool[34645]: GetVertexAttribIivEXT (will be remapped) */
+   /* _mesa_function_pool[34713]: GetVertexAttribIivEXT (will be remapped) */
    "iip\0"
    "glGetVertexAttribIivEXT\0"
    "glGetVertexAttribIiv\0"
    "\0"
-   /* _mesa_function_pool[34695]: VertexAttrib2sARB (will be remapped) */
+   /* _mesa_function_pool[34763]: VertexAttrib2sARB (will be remapped) */
    "iii\0"
    "glVertexAttrib2s\0"
    "glVertexAttrib2sARB\0"
    "\0"
-   /* _mesa_function_pool[34737]: GetnTexImageARB (will be remapped) */
+   /* _mesa_function_pool[34805]: GetnTexImageARB (will be remapped) */
    "iiiiip\0"
    "glGetnTexImageARB\0"
    "\0"
-   /* _mesa_function_pool[34763]: ColorMask (offset 210) */
+   /* _mesa_function_pool[34831]: ColorMask (offset 210) */
    "iiii\0"
    "glColorMask\0"
    "\0"
-   /* _mesa_function_pool[34781]: GenAsyncMarkersSGIX (dynamic) */
+   /* _mesa_function_pool[34849]: GenAsyncMarkersSGIX (dynamic) */
    "i\0"
    "glGenAsyncMarkersSGIX\0"
    "\0"
-   /* _mesa_function_pool[34806]: DebugMessageInsertARB (will be remapped) */
+   /* _mesa_function_pool[34874]: DebugMessageInsertARB (will be remapped) */
    "iiiiip\0"
    "glDebugMessageInsertARB\0"
    "\0"
-   /* _mesa_function_pool[34838]: GetListParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[34906]: GetListParameterivSGIX (dynamic) */
    "iip\0"
    "glGetListParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[34868]: BindBufferARB (will be remapped) */
+   /* _mesa_function_pool[34936]: BindBufferARB (will be remapped) */
    "ii\0"
    "glBindBuffer\0"
    "glBindBufferARB\0"
    "\0"
-   /* _mesa_function_pool[34901]: GetInfoLogARB (will be remapped) */
+   /* _mesa_function_pool[34969]: GetInfoLogARB (will be remapped) */
    "iipp\0"
    "glGetInfoLogARB\0"
    "\0"
-   /* _mesa_function_pool[34923]: RasterPos4iv (offset 83) */
+   /* _mesa_function_pool[34991]: RasterPos4iv (offset 83) */
    "p\0"
    "glRasterPos4iv\0"
    "\0"
-   /* _mesa_function_pool[34941]: Enable (offset 215) */
+   /* _mesa_function_pool[35009]: Enable (offset 215) */
    "i\0"
    "glEnable\0"
    "\0"
-   /* _mesa_function_pool[34953]: LineStipple (offset 167) */
+   /* _mesa_function_pool[35021]: LineStipple (offset 167) */
    "ii\0"
    "glLineStipple\0"
    "\0"
-   /* _mesa_function_pool[34971]: FragmentLightfSGIX (dynamic) */
+   /* _mesa_function_pool[35039]: FragmentLightfSGIX (dynamic) */
    "iif\0"
    "glFragmentLightfSGIX\0"
    "\0"
-   /* _mesa_function_pool[34997]: SetFenceNV (will be remapped) */
+   /* _mesa_function_pool[35065]: SetFenceNV (will be remapped) */
    "ii\0"
    "glSetFenceNV\0"
    "\0"
-   /* _mesa_function_pool[35014]: VertexAttribs4svNV (will be remapped) */
+   /* _mesa_function_pool[35082]: VertexAttribs4svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4svNV\0"
    "\0"
-   /* _mesa_function_pool[35040]: EdgeFlagPointerListIBM (dynamic) */
+   /* _mesa_function_pool[35108]: EdgeFlagPointerListIBM (dynamic) */
    "ipi\0"
    "glEdgeFlagPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[35070]: UniformMatrix3x2fv (will be remapped) */
+   /* _mesa_function_pool[35138]: UniformMatrix3x2fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x2fv\0"
    "\0"
-   /* _mesa_function_pool[35097]: GetMinmaxParameterfv (offset 365) */
+   /* _mesa_function_pool[35165]: GetMinmaxParameterfv (offset 365) */
    "iip\0"
    "glGetMinmaxParameterfv\0"
    "glGetMinmaxParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[35151]: VertexAttrib1fvARB (will be remapped) */
+   /* _mesa_function_pool[35219]: VertexAttrib1fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib1fv\0"
    "glVertexAttrib1fvARB\0"
    "\0"
-   /* _mesa_function_pool[35194]: GenBuffersARB (will be remapped) */
+   /* _mesa_function_pool[35262]: GenBuffersARB (will be remapped) */
    "ip\0"
    "glGenBuffers\0"
    "glGenBuffersARB\0"
    "\0"
-   /* _mesa_function_pool[35227]: VertexAttribs1svNV (will be remapped) */
+   /* _mesa_function_pool[35295]: VertexAttribs1svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs1svNV\0"
    "\0"
-   /* _mesa_function_pool[35253]: Vertex3fv (offset 137) */
+   /* _mesa_function_pool[35321]: Vertex3fv (offset 137) */
    "p\0"
    "glVertex3fv\0"
    "\0"
-   /* _mesa_function_pool[35268]: GetTexBumpParameterivATI (will be remapped) */
+   /* _mesa_function_pool[35336]: GetTexBumpParameterivATI (will be remapped) */
    "ip\0"
    "glGetTexBumpParameterivATI\0"
    "\0"
-   /* _mesa_function_pool[35299]: Binormal3bEXT (dynamic) */
+   /* _mesa_function_pool[35367]: Binormal3bEXT (dynamic) */
    "iii\0"
    "glBinormal3bEXT\0"
    "\0"
-   /* _mesa_function_pool[35320]: FragmentMaterialivSGIX (dynamic) */
+   /* _mesa_function_pool[35388]: FragmentMaterialivSGIX (dynamic) */
    "iip\0"
    "glFragmentMaterialivSGIX\0"
    "\0"
-   /* _mesa_function_pool[35350]: IsRenderbufferEXT (will be remapped) */
+   /* _mesa_function_pool[35418]: IsRenderbufferEXT (will be remapped) */
    "i\0"
    "glIsRenderbuffer\0"
    "glIsRenderbufferEXT\0"
    "\0"
-   /* _mesa_function_pool[35390]: GenProgramsNV (will be remapped) */
+   /* _mesa_function_pool[35458]: GenProgramsNV (will be remapped) */
    "ip\0"
    "glGenProgramsARB\0"
    "glGenProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[35427]: VertexAttrib4dvNV (will be remapped) */
+   /* _mesa_function_pool[35495]: VertexAttrib4dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4dvNV\0"
    "\0"
-   /* _mesa_function_pool[35451]: EndFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[35519]: EndFragmentShaderATI (will be remapped) */
    "\0"
    "glEndFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[35476]: Binormal3iEXT (dynamic) */
+   /* _mesa_function_pool[35544]: Binormal3iEXT (dynamic) */
    "iii\0"
    "glBinormal3iEXT\0"
    "\0"
-   /* _mesa_function_pool[35497]: WindowPos2fMESA (will be remapped) */
+   /* _mesa_function_pool[35565]: WindowPos2fMESA (will be remapped) */
    "ff\0"
    "glWindowPos2f\0"
    "glWindowPos2fARB\0"
@@ -5134,575 +5143,577 @@ static const char _mesa_function_pool[] =
 /* these functions need to be remapped */
 static const struct gl_function_pool_remap MESA_remap_table_functions[] = {
    {  1731, AttachShader_remap_index },
-   { 10911, CreateProgram_remap_index },
-   { 24658, CreateShader_remap_index },
-   { 27358, DeleteProgram_remap_index },
-   { 20058, DeleteShader_remap_index },
-   { 25187, DetachShader_remap_index },
-   { 19334, GetAttachedShaders_remap_index },
-   {  5408, GetProgramInfoLog_remap_index },
+   { 10933, CreateProgram_remap_index },
+   { 24680, CreateShader_remap_index },
+   { 27400, DeleteProgram_remap_index },
+   { 20080, DeleteShader_remap_index },
+   { 25209, DetachShader_remap_index },
+   { 19356, GetAttachedShaders_remap_index },
+   {  5430, GetProgramInfoLog_remap_index },
    {   453, GetProgramiv_remap_index },
-   {  7352, GetShaderInfoLog_remap_index },
-   { 33245, GetShaderiv_remap_index },
-   { 14421, IsProgram_remap_index },
-   { 13323, IsShader_remap_index },
-   { 11041, StencilFuncSeparate_remap_index },
+   {  7374, GetShaderInfoLog_remap_index },
+   { 33313, GetShaderiv_remap_index },
+   { 14443, IsProgram_remap_index },
+   { 13345, IsShader_remap_index },
+   { 11063, StencilFuncSeparate_remap_index },
    {  4285, StencilMaskSeparate_remap_index },
-   {  8481, StencilOpSeparate_remap_index },
-   { 23853, UniformMatrix2x3fv_remap_index },
+   {  8503, StencilOpSeparate_remap_index },
+   { 23875, UniformMatrix2x3fv_remap_index },
    {  3154, UniformMatrix2x4fv_remap_index },
-   { 35070, UniformMatrix3x2fv_remap_index },
-   { 32570, UniformMatrix3x4fv_remap_index },
-   { 17454, UniformMatrix4x2fv_remap_index },
+   { 35138, UniformMatrix3x2fv_remap_index },
+   { 32638, UniformMatrix3x4fv_remap_index },
+   { 17476, UniformMatrix4x2fv_remap_index },
    {  3593, UniformMatrix4x3fv_remap_index },
-   {  5631, ClampColor_remap_index },
-   { 19388, ClearBufferfi_remap_index },
-   { 18804, ClearBufferfv_remap_index },
-   { 31551, ClearBufferiv_remap_index },
-   { 14619, ClearBufferuiv_remap_index },
-   { 21395, GetStringi_remap_index },
+   {  5653, ClampColor_remap_index },
+   { 19410, ClearBufferfi_remap_index },
+   { 18826, ClearBufferfv_remap_index },
+   { 31619, ClearBufferiv_remap_index },
+   { 14641, ClearBufferuiv_remap_index },
+   { 21417, GetStringi_remap_index },
    {   986, FramebufferTexture_remap_index },
-   { 28425, GetBufferParameteri64v_remap_index },
-   { 11141, GetInteger64i_v_remap_index },
-   { 25000, VertexAttribDivisor_remap_index },
-   { 10929, LoadTransposeMatrixdARB_remap_index },
-   { 32974, LoadTransposeMatrixfARB_remap_index },
-   {  6375, MultTransposeMatrixdARB_remap_index },
-   { 25374, MultTransposeMatrixfARB_remap_index },
+   { 28467, GetBufferParameteri64v_remap_index },
+   { 11163, GetInteger64i_v_remap_index },
+   { 25022, VertexAttribDivisor_remap_index },
+   { 10951, LoadTransposeMatrixdARB_remap_index },
+   { 33042, LoadTransposeMatrixfARB_remap_index },
+   {  6397, MultTransposeMatrixdARB_remap_index },
+   { 25396, MultTransposeMatrixfARB_remap_index },
    {   264, SampleCoverageARB_remap_index },
-   {  6559, CompressedTexImage1DARB_remap_index },
-   { 25902, CompressedTexImage2DARB_remap_index },
-   {  4348, CompressedTexImage3DARB_remap_index },
-   { 19639, CompressedTexSubImage1DARB_remap_index },
+   {  6581, CompressedTexImage1DARB_remap_index },
+   { 25944, CompressedTexImage2DARB_remap_index },
+   {  4370, CompressedTexImage3DARB_remap_index },
+   { 19661, CompressedTexSubImage1DARB_remap_index },
    {  2299, CompressedTexSubImage2DARB_remap_index },
-   { 21817, CompressedTexSubImage3DARB_remap_index },
-   { 30615, GetCompressedTexImageARB_remap_index },
+   { 21839, CompressedTexSubImage3DARB_remap_index },
+   { 30683, GetCompressedTexImageARB_remap_index },
    {  4159, DisableVertexAttribArrayARB_remap_index },
-   { 32135, EnableVertexAttribArrayARB_remap_index },
-   { 34088, GetProgramEnvParameterdvARB_remap_index },
-   { 25254, GetProgramEnvParameterfvARB_remap_index },
-   { 29473, GetProgramLocalParameterdvARB_remap_index },
-   {  8951, GetProgramLocalParameterfvARB_remap_index },
-   { 19796, GetProgramStringARB_remap_index },
-   { 29668, GetProgramivARB_remap_index },
-   { 22012, GetVertexAttribdvARB_remap_index },
-   { 17287, GetVertexAttribfvARB_remap_index },
-   { 10720, GetVertexAttribivARB_remap_index },
-   { 20850, ProgramEnvParameter4dARB_remap_index },
-   { 27067, ProgramEnvParameter4dvARB_remap_index },
-   { 18106, ProgramEnvParameter4fARB_remap_index },
-   {  9859, ProgramEnvParameter4fvARB_remap_index },
+   { 32203, EnableVertexAttribArrayARB_remap_index },
+   { 34156, GetProgramEnvParameterdvARB_remap_index },
+   { 25276, GetProgramEnvParameterfvARB_remap_index },
+   { 29541, GetProgramLocalParameterdvARB_remap_index },
+   {  8973, GetProgramLocalParameterfvARB_remap_index },
+   { 19818, GetProgramStringARB_remap_index },
+   { 29736, GetProgramivARB_remap_index },
+   { 22034, GetVertexAttribdvARB_remap_index },
+   { 17309, GetVertexAttribfvARB_remap_index },
+   { 10742, GetVertexAttribivARB_remap_index },
+   { 20872, ProgramEnvParameter4dARB_remap_index },
+   { 27109, ProgramEnvParameter4dvARB_remap_index },
+   { 18128, ProgramEnvParameter4fARB_remap_index },
+   {  9881, ProgramEnvParameter4fvARB_remap_index },
    {  4311, ProgramLocalParameter4dARB_remap_index },
-   { 14131, ProgramLocalParameter4dvARB_remap_index },
-   { 31572, ProgramLocalParameter4fARB_remap_index },
-   { 27744, ProgramLocalParameter4fvARB_remap_index },
-   { 30322, ProgramStringARB_remap_index },
-   { 21143, VertexAttrib1dARB_remap_index },
-   { 16888, VertexAttrib1dvARB_remap_index },
-   {  4507, VertexAttrib1fARB_remap_index },
-   { 35151, VertexAttrib1fvARB_remap_index },
-   {  7982, VertexAttrib1sARB_remap_index },
+   { 14153, ProgramLocalParameter4dvARB_remap_index },
+   { 31640, ProgramLocalParameter4fARB_remap_index },
+   { 27786, ProgramLocalParameter4fvARB_remap_index },
+   { 30390, ProgramStringARB_remap_index },
+   { 21165, VertexAttrib1dARB_remap_index },
+   { 16910, VertexAttrib1dvARB_remap_index },
+   {  4529, VertexAttrib1fARB_remap_index },
+   { 35219, VertexAttrib1fvARB_remap_index },
+   {  8004, VertexAttrib1sARB_remap_index },
    {  2494, VertexAttrib1svARB_remap_index },
-   { 16301, VertexAttrib2dARB_remap_index },
-   { 18825, VertexAttrib2dvARB_remap_index },
+   { 16323, VertexAttrib2dARB_remap_index },
+   { 18847, VertexAttrib2dvARB_remap_index },
    {  1781, VertexAttrib2fARB_remap_index },
-   { 18938, VertexAttrib2fvARB_remap_index },
-   { 34695, VertexAttrib2sARB_remap_index },
-   { 33725, VertexAttrib2svARB_remap_index },
-   { 12315, VertexAttrib3dARB_remap_index },
-   {  9526, VertexAttrib3dvARB_remap_index },
+   { 18960, VertexAttrib2fvARB_remap_index },
+   { 34763, VertexAttrib2sARB_remap_index },
+   { 33793, VertexAttrib2svARB_remap_index },
+   { 12337, VertexAttrib3dARB_remap_index },
+   {  9548, VertexAttrib3dvARB_remap_index },
    {  1868, VertexAttrib3fARB_remap_index },
-   { 24209, VertexAttrib3fvARB_remap_index },
-   { 30169, VertexAttrib3sARB_remap_index },
-   { 21754, VertexAttrib3svARB_remap_index },
-   {  5451, VertexAttrib4NbvARB_remap_index },
-   { 19211, VertexAttrib4NivARB_remap_index },
-   { 24164, VertexAttrib4NsvARB_remap_index },
-   { 25206, VertexAttrib4NubARB_remap_index },
-   { 33971, VertexAttrib4NubvARB_remap_index },
-   { 20501, VertexAttrib4NuivARB_remap_index },
+   { 24231, VertexAttrib3fvARB_remap_index },
+   { 30237, VertexAttrib3sARB_remap_index },
+   { 21776, VertexAttrib3svARB_remap_index },
+   {  5473, VertexAttrib4NbvARB_remap_index },
+   { 19233, VertexAttrib4NivARB_remap_index },
+   { 24186, VertexAttrib4NsvARB_remap_index },
+   { 25228, VertexAttrib4NubARB_remap_index },
+   { 34039, VertexAttrib4NubvARB_remap_index },
+   { 20523, VertexAttrib4NuivARB_remap_index },
    {  3466, VertexAttrib4NusvARB_remap_index },
-   { 11929, VertexAttrib4bvARB_remap_index },
-   { 28795, VertexAttrib4dARB_remap_index },
-   { 22784, VertexAttrib4dvARB_remap_index },
-   { 12469, VertexAttrib4fARB_remap_index },
-   { 12873, VertexAttrib4fvARB_remap_index },
-   { 11315, VertexAttrib4ivARB_remap_index },
-   { 18618, VertexAttrib4sARB_remap_index },
-   { 33160, VertexAttrib4svARB_remap_index },
-   { 17911, VertexAttrib4ubvARB_remap_index },
-   { 32459, VertexAttrib4uivARB_remap_index },
-   { 21565, VertexAttrib4usvARB_remap_index },
-   { 23669, VertexAttribPointerARB_remap_index },
-   { 34868, BindBufferARB_remap_index },
-   {  7689, BufferDataARB_remap_index },
+   { 11951, VertexAttrib4bvARB_remap_index },
+   { 28837, VertexAttrib4dARB_remap_index },
+   { 22806, VertexAttrib4dvARB_remap_index },
+   { 12491, VertexAttrib4fARB_remap_index },
+   { 12895, VertexAttrib4fvARB_remap_index },
+   { 11337, VertexAttrib4ivARB_remap_index },
+   { 18640, VertexAttrib4sARB_remap_index },
+   { 33228, VertexAttrib4svARB_remap_index },
+   { 17933, VertexAttrib4ubvARB_remap_index },
+   { 32527, VertexAttrib4uivARB_remap_index },
+   { 21587, VertexAttrib4usvARB_remap_index },
+   { 23691, VertexAttribPointerARB_remap_index },
+   { 34936, BindBufferARB_remap_index },
+   {  7711, BufferDataARB_remap_index },
    {  1599, BufferSubDataARB_remap_index },
-   { 32745, DeleteBuffersARB_remap_index },
-   { 35194, GenBuffersARB_remap_index },
-   { 18981, GetBufferParameterivARB_remap_index },
-   { 18058, GetBufferPointervARB_remap_index },
+   { 32813, DeleteBuffersARB_remap_index },
+   { 35262, GenBuffersARB_remap_index },
+   { 19003, GetBufferParameterivARB_remap_index },
+   { 18080, GetBufferPointervARB_remap_index },
    {  1552, GetBufferSubDataARB_remap_index },
-   { 32407, IsBufferARB_remap_index },
-   { 28269, MapBufferARB_remap_index },
-   { 33375, UnmapBufferARB_remap_index },
+   { 32475, IsBufferARB_remap_index },
+   { 28311, MapBufferARB_remap_index },
+   { 33443, UnmapBufferARB_remap_index },
    {   360, BeginQueryARB_remap_index },
-   { 21221, DeleteQueriesARB_remap_index },
-   { 13184, EndQueryARB_remap_index },
-   { 31094, GenQueriesARB_remap_index },
+   { 21243, DeleteQueriesARB_remap_index },
+   { 13206, EndQueryARB_remap_index },
+   { 31162, GenQueriesARB_remap_index },
    {  2191, GetQueryObjectivARB_remap_index },
-   { 18662, GetQueryObjectuivARB_remap_index },
+   { 18684, GetQueryObjectuivARB_remap_index },
    {  1970, GetQueryivARB_remap_index },
-   { 21472, IsQueryARB_remap_index },
-   {  9136, AttachObjectARB_remap_index },
-   { 20020, CompileShaderARB_remap_index },
+   { 21494, IsQueryARB_remap_index },
+   {  9158, AttachObjectARB_remap_index },
+   { 20042, CompileShaderARB_remap_index },
    {  3535, CreateProgramObjectARB_remap_index },
-   {  7634, CreateShaderObjectARB_remap_index },
-   { 15584, DeleteObjectARB_remap_index },
-   { 25693, DetachObjectARB_remap_index },
-   { 12937, GetActiveUniformARB_remap_index },
-   { 10362, GetAttachedObjectsARB_remap_index },
-   { 10669, GetHandleARB_remap_index },
-   { 34901, GetInfoLogARB_remap_index },
-   { 34042, GetObjectParameterfvARB_remap_index },
-   { 29347, GetObjectParameterivARB_remap_index },
-   { 30852, GetShaderSourceARB_remap_index },
-   { 30029, GetUniformLocationARB_remap_index },
-   { 25476, GetUniformfvARB_remap_index },
-   { 13706, GetUniformivARB_remap_index },
-   { 21610, LinkProgramARB_remap_index },
-   { 21668, ShaderSourceARB_remap_index },
-   {  8381, Uniform1fARB_remap_index },
-   { 31798, Uniform1fvARB_remap_index },
-   { 23617, Uniform1iARB_remap_index },
-   { 22422, Uniform1ivARB_remap_index },
+   {  7656, CreateShaderObjectARB_remap_index },
+   { 15606, DeleteObjectARB_remap_index },
+   { 25715, DetachObjectARB_remap_index },
+   { 12959, GetActiveUniformARB_remap_index },
+   { 10384, GetAttachedObjectsARB_remap_index },
+   { 10691, GetHandleARB_remap_index },
+   { 34969, GetInfoLogARB_remap_index },
+   { 34110, GetObjectParameterfvARB_remap_index },
+   { 29415, GetObjectParameterivARB_remap_index },
+   { 30920, GetShaderSourceARB_remap_index },
+   { 30097, GetUniformLocationARB_remap_index },
+   { 25498, GetUniformfvARB_remap_index },
+   { 13728, GetUniformivARB_remap_index },
+   { 21632, LinkProgramARB_remap_index },
+   { 21690, ShaderSourceARB_remap_index },
+   {  8403, Uniform1fARB_remap_index },
+   { 31866, Uniform1fvARB_remap_index },
+   { 23639, Uniform1iARB_remap_index },
+   { 22444, Uniform1ivARB_remap_index },
    {  2443, Uniform2fARB_remap_index },
-   { 15420, Uniform2fvARB_remap_index },
-   { 28136, Uniform2iARB_remap_index },
+   { 15442, Uniform2fvARB_remap_index },
+   { 28178, Uniform2iARB_remap_index },
    {  2563, Uniform2ivARB_remap_index },
-   { 20130, Uniform3fARB_remap_index },
-   { 10392, Uniform3fvARB_remap_index },
-   {  7163, Uniform3iARB_remap_index },
-   { 18164, Uniform3ivARB_remap_index },
-   { 20656, Uniform4fARB_remap_index },
-   { 25340, Uniform4fvARB_remap_index },
-   { 26677, Uniform4iARB_remap_index },
-   { 21978, Uniform4ivARB_remap_index },
-   {  9188, UniformMatrix2fvARB_remap_index },
+   { 20152, Uniform3fARB_remap_index },
+   { 10414, Uniform3fvARB_remap_index },
+   {  7185, Uniform3iARB_remap_index },
+   { 18186, Uniform3ivARB_remap_index },
+   { 20678, Uniform4fARB_remap_index },
+   { 25362, Uniform4fvARB_remap_index },
+   { 26719, Uniform4iARB_remap_index },
+   { 22000, Uniform4ivARB_remap_index },
+   {  9210, UniformMatrix2fvARB_remap_index },
    {    17, UniformMatrix3fvARB_remap_index },
    {  2980, UniformMatrix4fvARB_remap_index },
-   { 27220, UseProgramObjectARB_remap_index },
-   { 15989, ValidateProgramARB_remap_index },
-   { 22827, BindAttribLocationARB_remap_index },
-   {  5496, GetActiveAttribARB_remap_index },
-   { 17845, GetAttribLocationARB_remap_index },
-   { 31483, DrawBuffersARB_remap_index },
-   { 31290, ClampColorARB_remap_index },
-   { 19256, DrawArraysInstancedARB_remap_index },
-   {  7224, DrawElementsInstancedARB_remap_index },
-   { 14236, RenderbufferStorageMultisample_remap_index },
-   { 14700, FramebufferTextureARB_remap_index },
-   { 27646, FramebufferTextureFaceARB_remap_index },
-   { 25842, ProgramParameteriARB_remap_index },
-   { 25158, VertexAttribDivisorARB_remap_index },
-   { 20704, FlushMappedBufferRange_remap_index },
-   { 29796, MapBufferRange_remap_index },
-   { 29691, TexBufferARB_remap_index },
-   { 17592, BindVertexArray_remap_index },
-   { 15793, GenVertexArrays_remap_index },
-   { 32337, CopyBufferSubData_remap_index },
-   { 33264, ClientWaitSync_remap_index },
+   { 27262, UseProgramObjectARB_remap_index },
+   { 16011, ValidateProgramARB_remap_index },
+   { 22849, BindAttribLocationARB_remap_index },
+   {  5518, GetActiveAttribARB_remap_index },
+   { 17867, GetAttribLocationARB_remap_index },
+   { 31551, DrawBuffersARB_remap_index },
+   { 31358, ClampColorARB_remap_index },
+   { 19278, DrawArraysInstancedARB_remap_index },
+   {  7246, DrawElementsInstancedARB_remap_index },
+   { 14258, RenderbufferStorageMultisample_remap_index },
+   { 14722, FramebufferTextureARB_remap_index },
+   { 27688, FramebufferTextureFaceARB_remap_index },
+   { 25864, ProgramParameteriARB_remap_index },
+   { 25180, VertexAttribDivisorARB_remap_index },
+   { 20726, FlushMappedBufferRange_remap_index },
+   { 29864, MapBufferRange_remap_index },
+   { 29759, TexBufferARB_remap_index },
+   { 17614, BindVertexArray_remap_index },
+   { 15815, GenVertexArrays_remap_index },
+   { 32405, CopyBufferSubData_remap_index },
+   { 33332, ClientWaitSync_remap_index },
    {  2899, DeleteSync_remap_index },
-   {  8023, FenceSync_remap_index },
-   { 16360, GetInteger64v_remap_index },
-   { 24271, GetSynciv_remap_index },
-   { 31422, IsSync_remap_index },
-   { 10292, WaitSync_remap_index },
+   {  8045, FenceSync_remap_index },
+   { 16382, GetInteger64v_remap_index },
+   { 24293, GetSynciv_remap_index },
+   { 31490, IsSync_remap_index },
+   { 10314, WaitSync_remap_index },
    {  4127, DrawElementsBaseVertex_remap_index },
-   { 19848, DrawElementsInstancedBaseVertex_remap_index },
-   { 32649, DrawRangeElementsBaseVertex_remap_index },
-   { 28300, MultiDrawElementsBaseVertex_remap_index },
-   { 27140, BlendEquationSeparateiARB_remap_index },
-   { 19074, BlendEquationiARB_remap_index },
-   { 13645, BlendFuncSeparateiARB_remap_index },
-   { 10768, BlendFunciARB_remap_index },
-   {  5692, BindFragDataLocationIndexed_remap_index },
-   { 23185, GetFragDataIndex_remap_index },
-   {  9017, BindSampler_remap_index },
-   {  4486, DeleteSamplers_remap_index },
-   { 21077, GenSamplers_remap_index },
-   { 31328, GetSamplerParameterIiv_remap_index },
-   { 20598, GetSamplerParameterIuiv_remap_index },
-   {  5328, GetSamplerParameterfv_remap_index },
-   { 27377, GetSamplerParameteriv_remap_index },
-   { 15373, IsSampler_remap_index },
-   { 17545, SamplerParameterIiv_remap_index },
-   { 32688, SamplerParameterIuiv_remap_index },
-   { 23905, SamplerParameterf_remap_index },
-   { 17772, SamplerParameterfv_remap_index },
-   { 23880, SamplerParameteri_remap_index },
-   { 19450, SamplerParameteriv_remap_index },
-   { 15404, ColorP3ui_remap_index },
-   { 32911, ColorP3uiv_remap_index },
-   { 22528, ColorP4ui_remap_index },
-   { 14541, ColorP4uiv_remap_index },
-   { 10337, MultiTexCoordP1ui_remap_index },
-   { 13619, MultiTexCoordP1uiv_remap_index },
-   { 18556, MultiTexCoordP2ui_remap_index },
-   { 32109, MultiTexCoordP2uiv_remap_index },
-   { 14984, MultiTexCoordP3ui_remap_index },
-   { 11391, MultiTexCoordP3uiv_remap_index },
-   { 23470, MultiTexCoordP4ui_remap_index },
-   { 14730, MultiTexCoordP4uiv_remap_index },
-   { 31781, NormalP3ui_remap_index },
-   { 20352, NormalP3uiv_remap_index },
-   { 26582, SecondaryColorP3ui_remap_index },
-   { 20370, SecondaryColorP3uiv_remap_index },
+   { 19870, DrawElementsInstancedBaseVertex_remap_index },
+   { 32717, DrawRangeElementsBaseVertex_remap_index },
+   { 28342, MultiDrawElementsBaseVertex_remap_index },
+   { 27182, BlendEquationSeparateiARB_remap_index },
+   { 19096, BlendEquationiARB_remap_index },
+   { 13667, BlendFuncSeparateiARB_remap_index },
+   { 10790, BlendFunciARB_remap_index },
+   {  5714, BindFragDataLocationIndexed_remap_index },
+   { 23207, GetFragDataIndex_remap_index },
+   {  9039, BindSampler_remap_index },
+   {  4508, DeleteSamplers_remap_index },
+   { 21099, GenSamplers_remap_index },
+   { 31396, GetSamplerParameterIiv_remap_index },
+   { 20620, GetSamplerParameterIuiv_remap_index },
+   {  5350, GetSamplerParameterfv_remap_index },
+   { 27419, GetSamplerParameteriv_remap_index },
+   { 15395, IsSampler_remap_index },
+   { 17567, SamplerParameterIiv_remap_index },
+   { 32756, SamplerParameterIuiv_remap_index },
+   { 23927, SamplerParameterf_remap_index },
+   { 17794, SamplerParameterfv_remap_index },
+   { 23902, SamplerParameteri_remap_index },
+   { 19472, SamplerParameteriv_remap_index },
+   { 15426, ColorP3ui_remap_index },
+   { 32979, ColorP3uiv_remap_index },
+   { 22550, ColorP4ui_remap_index },
+   { 14563, ColorP4uiv_remap_index },
+   { 10359, MultiTexCoordP1ui_remap_index },
+   { 13641, MultiTexCoordP1uiv_remap_index },
+   { 18578, MultiTexCoordP2ui_remap_index },
+   { 32177, MultiTexCoordP2uiv_remap_index },
+   { 15006, MultiTexCoordP3ui_remap_index },
+   { 11413, MultiTexCoordP3uiv_remap_index },
+   { 23492, MultiTexCoordP4ui_remap_index },
+   { 14752, MultiTexCoordP4uiv_remap_index },
+   { 31849, NormalP3ui_remap_index },
+   { 20374, NormalP3uiv_remap_index },
+   { 26624, SecondaryColorP3ui_remap_index },
+   { 20392, SecondaryColorP3uiv_remap_index },
    {  1013, TexCoordP1ui_remap_index },
    {  2666, TexCoordP1uiv_remap_index },
-   { 15869, TexCoordP2ui_remap_index },
-   { 11994, TexCoordP2uiv_remap_index },
-   { 13578, TexCoordP3ui_remap_index },
-   { 22221, TexCoordP3uiv_remap_index },
+   { 15891, TexCoordP2ui_remap_index },
+   { 12016, TexCoordP2uiv_remap_index },
+   { 13600, TexCoordP3ui_remap_index },
+   { 22243, TexCoordP3uiv_remap_index },
    {  2099, TexCoordP4ui_remap_index },
-   {  5959, TexCoordP4uiv_remap_index },
-   { 10811, VertexAttribP1ui_remap_index },
-   { 12987, VertexAttribP1uiv_remap_index },
-   {  8586, VertexAttribP2ui_remap_index },
-   { 30566, VertexAttribP2uiv_remap_index },
-   {  5025, VertexAttribP3ui_remap_index },
-   { 28209, VertexAttribP3uiv_remap_index },
-   { 15198, VertexAttribP4ui_remap_index },
-   { 17145, VertexAttribP4uiv_remap_index },
-   {  5434, VertexP2ui_remap_index },
-   { 16715, VertexP2uiv_remap_index },
+   {  5981, TexCoordP4uiv_remap_index },
+   { 10833, VertexAttribP1ui_remap_index },
+   { 13009, VertexAttribP1uiv_remap_index },
+   {  8608, VertexAttribP2ui_remap_index },
+   { 30634, VertexAttribP2uiv_remap_index },
+   {  5047, VertexAttribP3ui_remap_index },
+   { 28251, VertexAttribP3uiv_remap_index },
+   { 15220, VertexAttribP4ui_remap_index },
+   { 17167, VertexAttribP4uiv_remap_index },
+   {  5456, VertexP2ui_remap_index },
+   { 16737, VertexP2uiv_remap_index },
    {  3267, VertexP3ui_remap_index },
-   { 21184, VertexP3uiv_remap_index },
-   { 10320, VertexP4ui_remap_index },
-   { 34356, VertexP4uiv_remap_index },
-   {  5728, BindTransformFeedback_remap_index },
-   { 11191, DeleteTransformFeedbacks_remap_index },
-   {  7196, DrawTransformFeedback_remap_index },
-   { 10529, GenTransformFeedbacks_remap_index },
-   { 30212, IsTransformFeedback_remap_index },
-   { 19890, PauseTransformFeedback_remap_index },
-   {  6260, ResumeTransformFeedback_remap_index },
-   { 23168, ClearDepthf_remap_index },
-   {  7582, DepthRangef_remap_index },
-   { 15605, GetShaderPrecisionFormat_remap_index },
-   { 10981, ReleaseShaderCompiler_remap_index },
-   { 11972, ShaderBinary_remap_index },
+   { 21206, VertexP3uiv_remap_index },
+   { 10342, VertexP4ui_remap_index },
+   { 34424, VertexP4uiv_remap_index },
+   {  5750, BindTransformFeedback_remap_index },
+   { 11213, DeleteTransformFeedbacks_remap_index },
+   {  7218, DrawTransformFeedback_remap_index },
+   { 10551, GenTransformFeedbacks_remap_index },
+   { 30280, IsTransformFeedback_remap_index },
+   { 19912, PauseTransformFeedback_remap_index },
+   {  6282, ResumeTransformFeedback_remap_index },
+   { 23190, ClearDepthf_remap_index },
+   {  7604, DepthRangef_remap_index },
+   { 15627, GetShaderPrecisionFormat_remap_index },
+   { 11003, ReleaseShaderCompiler_remap_index },
+   { 11994, ShaderBinary_remap_index },
+   { 28881, GetProgramBinary_remap_index },
+   {  4348, ProgramBinary_remap_index },
    {  1480, DebugMessageCallbackARB_remap_index },
-   { 10687, DebugMessageControlARB_remap_index },
-   { 34806, DebugMessageInsertARB_remap_index },
+   { 10709, DebugMessageControlARB_remap_index },
+   { 34874, DebugMessageInsertARB_remap_index },
    {  3078, GetDebugMessageLogARB_remap_index },
-   { 30510, GetGraphicsResetStatusARB_remap_index },
-   { 26457, GetnColorTableARB_remap_index },
-   {  8786, GetnCompressedTexImageARB_remap_index },
+   { 30578, GetGraphicsResetStatusARB_remap_index },
+   { 26499, GetnColorTableARB_remap_index },
+   {  8808, GetnCompressedTexImageARB_remap_index },
    {  4219, GetnConvolutionFilterARB_remap_index },
-   { 16931, GetnHistogramARB_remap_index },
-   {  4928, GetnMapdvARB_remap_index },
-   { 23648, GetnMapfvARB_remap_index },
+   { 16953, GetnHistogramARB_remap_index },
+   {  4950, GetnMapdvARB_remap_index },
+   { 23670, GetnMapfvARB_remap_index },
    {  2422, GetnMapivARB_remap_index },
-   { 18426, GetnMinmaxARB_remap_index },
-   {  4903, GetnPixelMapfvARB_remap_index },
-   { 20475, GetnPixelMapuivARB_remap_index },
-   { 31396, GetnPixelMapusvARB_remap_index },
+   { 18448, GetnMinmaxARB_remap_index },
+   {  4925, GetnPixelMapfvARB_remap_index },
+   { 20497, GetnPixelMapuivARB_remap_index },
+   { 31464, GetnPixelMapusvARB_remap_index },
    {  1402, GetnPolygonStippleARB_remap_index },
-   { 22612, GetnSeparableFilterARB_remap_index },
-   { 34737, GetnTexImageARB_remap_index },
-   { 19823, GetnUniformdvARB_remap_index },
-   {  8054, GetnUniformfvARB_remap_index },
-   { 10836, GetnUniformivARB_remap_index },
-   { 24120, GetnUniformuivARB_remap_index },
+   { 22634, GetnSeparableFilterARB_remap_index },
+   { 34805, GetnTexImageARB_remap_index },
+   { 19845, GetnUniformdvARB_remap_index },
+   {  8076, GetnUniformfvARB_remap_index },
+   { 10858, GetnUniformivARB_remap_index },
+   { 24142, GetnUniformuivARB_remap_index },
    {  3181, ReadnPixelsARB_remap_index },
    {  1289, TexStorage1D_remap_index },
-   {  4793, TexStorage2D_remap_index },
-   { 17398, TexStorage3D_remap_index },
-   {  4949, TextureStorage1DEXT_remap_index },
-   {  5756, TextureStorage2DEXT_remap_index },
+   {  4815, TexStorage2D_remap_index },
+   { 17420, TexStorage3D_remap_index },
+   {  4971, TextureStorage1DEXT_remap_index },
+   {  5778, TextureStorage2DEXT_remap_index },
    {  1750, TextureStorage3DEXT_remap_index },
-   {  6128, PolygonOffsetEXT_remap_index },
-   { 24893, GetPixelTexGenParameterfvSGIS_remap_index },
-   {  4853, GetPixelTexGenParameterivSGIS_remap_index },
-   { 24626, PixelTexGenParameterfSGIS_remap_index },
+   {  6150, PolygonOffsetEXT_remap_index },
+   { 24915, GetPixelTexGenParameterfvSGIS_remap_index },
+   {  4875, GetPixelTexGenParameterivSGIS_remap_index },
+   { 24648, PixelTexGenParameterfSGIS_remap_index },
    {   672, PixelTexGenParameterfvSGIS_remap_index },
-   { 13744, PixelTexGenParameteriSGIS_remap_index },
-   { 14883, PixelTexGenParameterivSGIS_remap_index },
-   { 17715, SampleMaskSGIS_remap_index },
-   { 21412, SamplePatternSGIS_remap_index },
-   { 21095, ColorPointerEXT_remap_index },
-   { 18868, EdgeFlagPointerEXT_remap_index },
-   {  6817, IndexPointerEXT_remap_index },
-   {  6897, NormalPointerEXT_remap_index },
-   { 16999, TexCoordPointerEXT_remap_index },
-   {  7812, VertexPointerEXT_remap_index },
+   { 13766, PixelTexGenParameteriSGIS_remap_index },
+   { 14905, PixelTexGenParameterivSGIS_remap_index },
+   { 17737, SampleMaskSGIS_remap_index },
+   { 21434, SamplePatternSGIS_remap_index },
+   { 21117, ColorPointerEXT_remap_index },
+   { 18890, EdgeFlagPointerEXT_remap_index },
+   {  6839, IndexPointerEXT_remap_index },
+   {  6919, NormalPointerEXT_remap_index },
+   { 17021, TexCoordPointerEXT_remap_index },
+   {  7834, VertexPointerEXT_remap_index },
    {  3929, PointParameterfEXT_remap_index },
-   {  8682, PointParameterfvEXT_remap_index },
-   { 34140, LockArraysEXT_remap_index },
-   { 16053, UnlockArraysEXT_remap_index },
+   {  8704, PointParameterfvEXT_remap_index },
+   { 34208, LockArraysEXT_remap_index },
+   { 16075, UnlockArraysEXT_remap_index },
    {  1310, SecondaryColor3bEXT_remap_index },
-   {  8875, SecondaryColor3bvEXT_remap_index },
-   { 11518, SecondaryColor3dEXT_remap_index },
-   { 27426, SecondaryColor3dvEXT_remap_index },
-   { 30078, SecondaryColor3fEXT_remap_index },
-   { 19575, SecondaryColor3fvEXT_remap_index },
+   {  8897, SecondaryColor3bvEXT_remap_index },
+   { 11540, SecondaryColor3dEXT_remap_index },
+   { 27468, SecondaryColor3dvEXT_remap_index },
+   { 30146, SecondaryColor3fEXT_remap_index },
+   { 19597, SecondaryColor3fvEXT_remap_index },
    {   518, SecondaryColor3iEXT_remap_index },
-   { 17335, SecondaryColor3ivEXT_remap_index },
-   { 11069, SecondaryColor3sEXT_remap_index },
-   { 32928, SecondaryColor3svEXT_remap_index },
-   { 29183, SecondaryColor3ubEXT_remap_index },
-   { 22718, SecondaryColor3ubvEXT_remap_index },
-   { 13986, SecondaryColor3uiEXT_remap_index },
-   { 24513, SecondaryColor3uivEXT_remap_index },
-   { 27696, SecondaryColor3usEXT_remap_index },
-   { 14059, SecondaryColor3usvEXT_remap_index },
-   { 12816, SecondaryColorPointerEXT_remap_index },
-   { 27510, MultiDrawArraysEXT_remap_index },
-   { 22357, MultiDrawElementsEXT_remap_index },
-   { 22568, FogCoordPointerEXT_remap_index },
-   {  5076, FogCoorddEXT_remap_index },
-   { 33541, FogCoorddvEXT_remap_index },
-   {  5193, FogCoordfEXT_remap_index },
-   { 29106, FogCoordfvEXT_remap_index },
-   { 12916, PixelTexGenSGIX_remap_index },
-   { 29723, BlendFuncSeparateEXT_remap_index },
-   {  7724, FlushVertexArrayRangeNV_remap_index },
-   {  6077, VertexArrayRangeNV_remap_index },
-   { 30143, CombinerInputNV_remap_index },
+   { 17357, SecondaryColor3ivEXT_remap_index },
+   { 11091, SecondaryColor3sEXT_remap_index },
+   { 32996, SecondaryColor3svEXT_remap_index },
+   { 29251, SecondaryColor3ubEXT_remap_index },
+   { 22740, SecondaryColor3ubvEXT_remap_index },
+   { 14008, SecondaryColor3uiEXT_remap_index },
+   { 24535, SecondaryColor3uivEXT_remap_index },
+   { 27738, SecondaryColor3usEXT_remap_index },
+   { 14081, SecondaryColor3usvEXT_remap_index },
+   { 12838, SecondaryColorPointerEXT_remap_index },
+   { 27552, MultiDrawArraysEXT_remap_index },
+   { 22379, MultiDrawElementsEXT_remap_index },
+   { 22590, FogCoordPointerEXT_remap_index },
+   {  5098, FogCoorddEXT_remap_index },
+   { 33609, FogCoorddvEXT_remap_index },
+   {  5215, FogCoordfEXT_remap_index },
+   { 29174, FogCoordfvEXT_remap_index },
+   { 12938, PixelTexGenSGIX_remap_index },
+   { 29791, BlendFuncSeparateEXT_remap_index },
+   {  7746, FlushVertexArrayRangeNV_remap_index },
+   {  6099, VertexArrayRangeNV_remap_index },
+   { 30211, CombinerInputNV_remap_index },
    {  2365, CombinerOutputNV_remap_index },
-   { 33081, CombinerParameterfNV_remap_index },
-   {  5931, CombinerParameterfvNV_remap_index },
-   { 23930, CombinerParameteriNV_remap_index },
-   { 34537, CombinerParameterivNV_remap_index },
-   {  8125, FinalCombinerInputNV_remap_index },
-   {  7377, GetCombinerInputParameterfvNV_remap_index },
-   { 34374, GetCombinerInputParameterivNV_remap_index },
-   { 27839, GetCombinerOutputParameterfvNV_remap_index },
-   { 14812, GetCombinerOutputParameterivNV_remap_index },
-   {  7486, GetFinalCombinerInputParameterfvNV_remap_index },
-   { 26524, GetFinalCombinerInputParameterivNV_remap_index },
-   { 13597, ResizeBuffersMESA_remap_index },
-   { 12142, WindowPos2dMESA_remap_index },
+   { 33149, CombinerParameterfNV_remap_index },
+   {  5953, CombinerParameterfvNV_remap_index },
+   { 23952, CombinerParameteriNV_remap_index },
+   { 34605, CombinerParameterivNV_remap_index },
+   {  8147, FinalCombinerInputNV_remap_index },
+   {  7399, GetCombinerInputParameterfvNV_remap_index },
+   { 34442, GetCombinerInputParameterivNV_remap_index },
+   { 27881, GetCombinerOutputParameterfvNV_remap_index },
+   { 14834, GetCombinerOutputParameterivNV_remap_index },
+   {  7508, GetFinalCombinerInputParameterfvNV_remap_index },
+   { 26566, GetFinalCombinerInputParameterivNV_remap_index },
+   { 13619, ResizeBuffersMESA_remap_index },
+   { 12164, WindowPos2dMESA_remap_index },
    {  1082, WindowPos2dvMESA_remap_index },
-   { 35497, WindowPos2fMESA_remap_index },
-   {  8820, WindowPos2fvMESA_remap_index },
-   { 19522, WindowPos2iMESA_remap_index },
-   { 21885, WindowPos2ivMESA_remap_index },
-   { 22456, WindowPos2sMESA_remap_index },
-   {  6473, WindowPos2svMESA_remap_index },
-   {  8611, WindowPos3dMESA_remap_index },
-   { 15143, WindowPos3dvMESA_remap_index },
+   { 35565, WindowPos2fMESA_remap_index },
+   {  8842, WindowPos2fvMESA_remap_index },
+   { 19544, WindowPos2iMESA_remap_index },
+   { 21907, WindowPos2ivMESA_remap_index },
+   { 22478, WindowPos2sMESA_remap_index },
+   {  6495, WindowPos2svMESA_remap_index },
+   {  8633, WindowPos3dMESA_remap_index },
+   { 15165, WindowPos3dvMESA_remap_index },
    {   564, WindowPos3fMESA_remap_index },
-   { 16114, WindowPos3fvMESA_remap_index },
-   { 25735, WindowPos3iMESA_remap_index },
-   { 32282, WindowPos3ivMESA_remap_index },
-   { 20274, WindowPos3sMESA_remap_index },
-   { 33797, WindowPos3svMESA_remap_index },
-   { 12093, WindowPos4dMESA_remap_index },
-   { 18302, WindowPos4dvMESA_remap_index },
-   { 15102, WindowPos4fMESA_remap_index },
-   { 32818, WindowPos4fvMESA_remap_index },
-   { 32435, WindowPos4iMESA_remap_index },
-   { 13437, WindowPos4ivMESA_remap_index },
-   { 20451, WindowPos4sMESA_remap_index },
+   { 16136, WindowPos3fvMESA_remap_index },
+   { 25757, WindowPos3iMESA_remap_index },
+   { 32350, WindowPos3ivMESA_remap_index },
+   { 20296, WindowPos3sMESA_remap_index },
+   { 33865, WindowPos3svMESA_remap_index },
+   { 12115, WindowPos4dMESA_remap_index },
+   { 18324, WindowPos4dvMESA_remap_index },
+   { 15124, WindowPos4fMESA_remap_index },
+   { 32886, WindowPos4fvMESA_remap_index },
+   { 32503, WindowPos4iMESA_remap_index },
+   { 13459, WindowPos4ivMESA_remap_index },
+   { 20473, WindowPos4sMESA_remap_index },
    {  3513, WindowPos4svMESA_remap_index },
-   { 14851, MultiModeDrawArraysIBM_remap_index },
-   { 30965, MultiModeDrawElementsIBM_remap_index },
-   { 13212, DeleteFencesNV_remap_index },
-   { 29990, FinishFenceNV_remap_index },
+   { 14873, MultiModeDrawArraysIBM_remap_index },
+   { 31033, MultiModeDrawElementsIBM_remap_index },
+   { 13234, DeleteFencesNV_remap_index },
+   { 30058, FinishFenceNV_remap_index },
    {  4051, GenFencesNV_remap_index },
-   { 18282, GetFenceivNV_remap_index },
-   {  9088, IsFenceNV_remap_index },
-   { 34997, SetFenceNV_remap_index },
-   {  4563, TestFenceNV_remap_index },
-   { 33768, AreProgramsResidentNV_remap_index },
-   { 33123, BindProgramNV_remap_index },
-   { 27779, DeleteProgramsNV_remap_index },
-   { 22936, ExecuteProgramNV_remap_index },
-   { 35390, GenProgramsNV_remap_index },
-   { 25026, GetProgramParameterdvNV_remap_index },
-   { 11580, GetProgramParameterfvNV_remap_index },
-   { 28183, GetProgramStringNV_remap_index },
-   { 26112, GetProgramivNV_remap_index },
-   { 25289, GetTrackMatrixivNV_remap_index },
-   { 27968, GetVertexAttribPointervNV_remap_index },
-   { 11164, GetVertexAttribdvNV_remap_index },
-   { 20247, GetVertexAttribfvNV_remap_index },
-   { 19769, GetVertexAttribivNV_remap_index },
-   { 20734, IsProgramNV_remap_index },
-   { 10270, LoadProgramNV_remap_index },
-   { 29819, ProgramParameters4dvNV_remap_index },
-   { 26042, ProgramParameters4fvNV_remap_index },
-   { 22189, RequestResidentProgramsNV_remap_index },
-   { 32627, TrackMatrixNV_remap_index },
-   { 27472, VertexAttrib1dNV_remap_index },
-   { 14641, VertexAttrib1dvNV_remap_index },
-   { 30418, VertexAttrib1fNV_remap_index },
+   { 18304, GetFenceivNV_remap_index },
+   {  9110, IsFenceNV_remap_index },
+   { 35065, SetFenceNV_remap_index },
+   {  4585, TestFenceNV_remap_index },
+   { 33836, AreProgramsResidentNV_remap_index },
+   { 33191, BindProgramNV_remap_index },
+   { 27821, DeleteProgramsNV_remap_index },
+   { 22958, ExecuteProgramNV_remap_index },
+   { 35458, GenProgramsNV_remap_index },
+   { 25048, GetProgramParameterdvNV_remap_index },
+   { 11602, GetProgramParameterfvNV_remap_index },
+   { 28225, GetProgramStringNV_remap_index },
+   { 26154, GetProgramivNV_remap_index },
+   { 25311, GetTrackMatrixivNV_remap_index },
+   { 28010, GetVertexAttribPointervNV_remap_index },
+   { 11186, GetVertexAttribdvNV_remap_index },
+   { 20269, GetVertexAttribfvNV_remap_index },
+   { 19791, GetVertexAttribivNV_remap_index },
+   { 20756, IsProgramNV_remap_index },
+   { 10292, LoadProgramNV_remap_index },
+   { 29887, ProgramParameters4dvNV_remap_index },
+   { 26084, ProgramParameters4fvNV_remap_index },
+   { 22211, RequestResidentProgramsNV_remap_index },
+   { 32695, TrackMatrixNV_remap_index },
+   { 27514, VertexAttrib1dNV_remap_index },
+   { 14663, VertexAttrib1dvNV_remap_index },
+   { 30486, VertexAttrib1fNV_remap_index },
    {  2705, VertexAttrib1fvNV_remap_index },
-   { 32875, VertexAttrib1sNV_remap_index },
-   { 16187, VertexAttrib1svNV_remap_index },
-   {  5384, VertexAttrib2dNV_remap_index },
-   { 19703, VertexAttrib2dvNV_remap_index },
-   { 21644, VertexAttrib2fNV_remap_index },
-   { 14107, VertexAttrib2fvNV_remap_index },
-   {  6685, VertexAttrib2sNV_remap_index },
-   { 20328, VertexAttrib2svNV_remap_index },
-   { 12290, VertexAttrib3dNV_remap_index },
-   { 34018, VertexAttrib3dvNV_remap_index },
-   { 11366, VertexAttrib3fNV_remap_index },
-   { 26484, VertexAttrib3fvNV_remap_index },
-   { 30393, VertexAttrib3sNV_remap_index },
-   { 25316, VertexAttrib3svNV_remap_index },
-   { 30939, VertexAttrib4dNV_remap_index },
-   { 35427, VertexAttrib4dvNV_remap_index },
-   {  5799, VertexAttrib4fNV_remap_index },
-   { 26879, VertexAttrib4fvNV_remap_index },
-   { 28679, VertexAttrib4sNV_remap_index },
+   { 32943, VertexAttrib1sNV_remap_index },
+   { 16209, VertexAttrib1svNV_remap_index },
+   {  5406, VertexAttrib2dNV_remap_index },
+   { 19725, VertexAttrib2dvNV_remap_index },
+   { 21666, VertexAttrib2fNV_remap_index },
+   { 14129, VertexAttrib2fvNV_remap_index },
+   {  6707, VertexAttrib2sNV_remap_index },
+   { 20350, VertexAttrib2svNV_remap_index },
+   { 12312, VertexAttrib3dNV_remap_index },
+   { 34086, VertexAttrib3dvNV_remap_index },
+   { 11388, VertexAttrib3fNV_remap_index },
+   { 26526, VertexAttrib3fvNV_remap_index },
+   { 30461, VertexAttrib3sNV_remap_index },
+   { 25338, VertexAttrib3svNV_remap_index },
+   { 31007, VertexAttrib4dNV_remap_index },
+   { 35495, VertexAttrib4dvNV_remap_index },
+   {  5821, VertexAttrib4fNV_remap_index },
+   { 26921, VertexAttrib4fvNV_remap_index },
+   { 28721, VertexAttrib4sNV_remap_index },
    {  1510, VertexAttrib4svNV_remap_index },
-   {  5559, VertexAttrib4ubNV_remap_index },
+   {  5581, VertexAttrib4ubNV_remap_index },
    {   826, VertexAttrib4ubvNV_remap_index },
-   { 23137, VertexAttribPointerNV_remap_index },
+   { 23159, VertexAttribPointerNV_remap_index },
    {  2537, VertexAttribs1dvNV_remap_index },
-   { 20396, VertexAttribs1fvNV_remap_index },
-   { 35227, VertexAttribs1svNV_remap_index },
-   { 11417, VertexAttribs2dvNV_remap_index },
-   { 31932, VertexAttribs2fvNV_remap_index },
-   { 18894, VertexAttribs2svNV_remap_index },
-   {  5979, VertexAttribs3dvNV_remap_index },
+   { 20418, VertexAttribs1fvNV_remap_index },
+   { 35295, VertexAttribs1svNV_remap_index },
+   { 11439, VertexAttribs2dvNV_remap_index },
+   { 32000, VertexAttribs2fvNV_remap_index },
+   { 18916, VertexAttribs2svNV_remap_index },
+   {  6001, VertexAttribs3dvNV_remap_index },
    {  2396, VertexAttribs3fvNV_remap_index },
-   { 32004, VertexAttribs3svNV_remap_index },
-   { 28769, VertexAttribs4dvNV_remap_index },
-   {  6051, VertexAttribs4fvNV_remap_index },
-   { 35014, VertexAttribs4svNV_remap_index },
-   { 31736, VertexAttribs4ubvNV_remap_index },
-   { 28839, GetTexBumpParameterfvATI_remap_index },
-   { 35268, GetTexBumpParameterivATI_remap_index },
-   { 19973, TexBumpParameterfvATI_remap_index },
-   { 22060, TexBumpParameterivATI_remap_index },
-   { 16751, AlphaFragmentOp1ATI_remap_index },
-   {  9103, AlphaFragmentOp2ATI_remap_index },
-   { 26400, AlphaFragmentOp3ATI_remap_index },
-   { 15075, BeginFragmentShaderATI_remap_index },
-   { 33322, BindFragmentShaderATI_remap_index },
-   { 25445, ColorFragmentOp1ATI_remap_index },
-   {  4759, ColorFragmentOp2ATI_remap_index },
-   { 33663, ColorFragmentOp3ATI_remap_index },
-   {  6217, DeleteFragmentShaderATI_remap_index },
-   { 35451, EndFragmentShaderATI_remap_index },
-   { 34565, GenFragmentShadersATI_remap_index },
-   { 27335, PassTexCoordATI_remap_index },
-   {  7792, SampleMapATI_remap_index },
-   { 29001, SetFragmentShaderConstantATI_remap_index },
+   { 32072, VertexAttribs3svNV_remap_index },
+   { 28811, VertexAttribs4dvNV_remap_index },
+   {  6073, VertexAttribs4fvNV_remap_index },
+   { 35082, VertexAttribs4svNV_remap_index },
+   { 31804, VertexAttribs4ubvNV_remap_index },
+   { 28907, GetTexBumpParameterfvATI_remap_index },
+   { 35336, GetTexBumpParameterivATI_remap_index },
+   { 19995, TexBumpParameterfvATI_remap_index },
+   { 22082, TexBumpParameterivATI_remap_index },
+   { 16773, AlphaFragmentOp1ATI_remap_index },
+   {  9125, AlphaFragmentOp2ATI_remap_index },
+   { 26442, AlphaFragmentOp3ATI_remap_index },
+   { 15097, BeginFragmentShaderATI_remap_index },
+   { 33390, BindFragmentShaderATI_remap_index },
+   { 25467, ColorFragmentOp1ATI_remap_index },
+   {  4781, ColorFragmentOp2ATI_remap_index },
+   { 33731, ColorFragmentOp3ATI_remap_index },
+   {  6239, DeleteFragmentShaderATI_remap_index },
+   { 35519, EndFragmentShaderATI_remap_index },
+   { 34633, GenFragmentShadersATI_remap_index },
+   { 27377, PassTexCoordATI_remap_index },
+   {  7814, SampleMapATI_remap_index },
+   { 29069, SetFragmentShaderConstantATI_remap_index },
    {   411, PointParameteriNV_remap_index },
-   { 15329, PointParameterivNV_remap_index },
-   { 30778, ActiveStencilFaceEXT_remap_index },
-   { 29447, BindVertexArrayAPPLE_remap_index },
+   { 15351, PointParameterivNV_remap_index },
+   { 30846, ActiveStencilFaceEXT_remap_index },
+   { 29515, BindVertexArrayAPPLE_remap_index },
    {  3027, DeleteVertexArraysAPPLE_remap_index },
-   { 19361, GenVertexArraysAPPLE_remap_index },
-   { 25091, IsVertexArrayAPPLE_remap_index },
+   { 19383, GenVertexArraysAPPLE_remap_index },
+   { 25113, IsVertexArrayAPPLE_remap_index },
    {   867, GetProgramNamedParameterdvNV_remap_index },
    {  3892, GetProgramNamedParameterfvNV_remap_index },
-   { 28870, ProgramNamedParameter4dNV_remap_index },
-   { 15668, ProgramNamedParameter4dvNV_remap_index },
-   {  9793, ProgramNamedParameter4fNV_remap_index },
-   { 12781, ProgramNamedParameter4fvNV_remap_index },
-   { 18213, PrimitiveRestartIndexNV_remap_index },
-   { 30592, PrimitiveRestartNV_remap_index },
-   { 26021, DepthBoundsEXT_remap_index },
+   { 28938, ProgramNamedParameter4dNV_remap_index },
+   { 15690, ProgramNamedParameter4dvNV_remap_index },
+   {  9815, ProgramNamedParameter4fNV_remap_index },
+   { 12803, ProgramNamedParameter4fvNV_remap_index },
+   { 18235, PrimitiveRestartIndexNV_remap_index },
+   { 30660, PrimitiveRestartNV_remap_index },
+   { 26063, DepthBoundsEXT_remap_index },
    {  1181, BlendEquationSeparateEXT_remap_index },
-   { 15888, BindFramebufferEXT_remap_index },
-   { 27555, BindRenderbufferEXT_remap_index },
-   { 10585, CheckFramebufferStatusEXT_remap_index },
-   { 24314, DeleteFramebuffersEXT_remap_index },
-   { 33920, DeleteRenderbuffersEXT_remap_index },
-   { 14558, FramebufferRenderbufferEXT_remap_index },
-   { 14756, FramebufferTexture1DEXT_remap_index },
-   { 12575, FramebufferTexture2DEXT_remap_index },
-   { 12195, FramebufferTexture3DEXT_remap_index },
-   { 24929, GenFramebuffersEXT_remap_index },
-   { 18759, GenRenderbuffersEXT_remap_index },
-   {  7528, GenerateMipmapEXT_remap_index },
-   { 23253, GetFramebufferAttachmentParameterivEXT_remap_index },
-   { 34471, GetRenderbufferParameterivEXT_remap_index },
-   { 21940, IsFramebufferEXT_remap_index },
-   { 35350, IsRenderbufferEXT_remap_index },
-   {  9035, RenderbufferStorageEXT_remap_index },
+   { 15910, BindFramebufferEXT_remap_index },
+   { 27597, BindRenderbufferEXT_remap_index },
+   { 10607, CheckFramebufferStatusEXT_remap_index },
+   { 24336, DeleteFramebuffersEXT_remap_index },
+   { 33988, DeleteRenderbuffersEXT_remap_index },
+   { 14580, FramebufferRenderbufferEXT_remap_index },
+   { 14778, FramebufferTexture1DEXT_remap_index },
+   { 12597, FramebufferTexture2DEXT_remap_index },
+   { 12217, FramebufferTexture3DEXT_remap_index },
+   { 24951, GenFramebuffersEXT_remap_index },
+   { 18781, GenRenderbuffersEXT_remap_index },
+   {  7550, GenerateMipmapEXT_remap_index },
+   { 23275, GetFramebufferAttachmentParameterivEXT_remap_index },
+   { 34539, GetRenderbufferParameterivEXT_remap_index },
+   { 21962, IsFramebufferEXT_remap_index },
+   { 35418, IsRenderbufferEXT_remap_index },
+   {  9057, RenderbufferStorageEXT_remap_index },
    {   743, BlitFramebufferEXT_remap_index },
-   { 15454, BufferParameteriAPPLE_remap_index },
-   { 20766, FlushMappedBufferRangeAPPLE_remap_index },
+   { 15476, BufferParameteriAPPLE_remap_index },
+   { 20788, FlushMappedBufferRangeAPPLE_remap_index },
    {  2045, BindFragDataLocationEXT_remap_index },
-   { 10219, GetFragDataLocationEXT_remap_index },
-   { 11695, GetUniformuivEXT_remap_index },
-   { 34645, GetVertexAttribIivEXT_remap_index },
-   {  4580, GetVertexAttribIuivEXT_remap_index },
-   { 13045, Uniform1uiEXT_remap_index },
-   { 29904, Uniform1uivEXT_remap_index },
-   { 23795, Uniform2uiEXT_remap_index },
-   {  4723, Uniform2uivEXT_remap_index },
-   { 31218, Uniform3uiEXT_remap_index },
-   { 15815, Uniform3uivEXT_remap_index },
+   { 10241, GetFragDataLocationEXT_remap_index },
+   { 11717, GetUniformuivEXT_remap_index },
+   { 34713, GetVertexAttribIivEXT_remap_index },
+   {  4602, GetVertexAttribIuivEXT_remap_index },
+   { 13067, Uniform1uiEXT_remap_index },
+   { 29972, Uniform1uivEXT_remap_index },
+   { 23817, Uniform2uiEXT_remap_index },
+   {  4745, Uniform2uivEXT_remap_index },
+   { 31286, Uniform3uiEXT_remap_index },
+   { 15837, Uniform3uivEXT_remap_index },
    {  3816, Uniform4uiEXT_remap_index },
-   {  9569, Uniform4uivEXT_remap_index },
-   {  7309, VertexAttribI1iEXT_remap_index },
-   {  5586, VertexAttribI1ivEXT_remap_index },
+   {  9591, Uniform4uivEXT_remap_index },
+   {  7331, VertexAttribI1iEXT_remap_index },
+   {  5608, VertexAttribI1ivEXT_remap_index },
    {  2806, VertexAttribI1uiEXT_remap_index },
-   { 13835, VertexAttribI1uivEXT_remap_index },
+   { 13857, VertexAttribI1uivEXT_remap_index },
    {    81, VertexAttribI2iEXT_remap_index },
-   { 25557, VertexAttribI2ivEXT_remap_index },
-   {  6005, VertexAttribI2uiEXT_remap_index },
-   {  5238, VertexAttribI2uivEXT_remap_index },
-   { 28471, VertexAttribI3iEXT_remap_index },
-   { 26834, VertexAttribI3ivEXT_remap_index },
+   { 25579, VertexAttribI2ivEXT_remap_index },
+   {  6027, VertexAttribI2uiEXT_remap_index },
+   {  5260, VertexAttribI2uivEXT_remap_index },
+   { 28513, VertexAttribI3iEXT_remap_index },
+   { 26876, VertexAttribI3ivEXT_remap_index },
    {  3670, VertexAttribI3uiEXT_remap_index },
-   { 32523, VertexAttribI3uivEXT_remap_index },
-   { 23529, VertexAttribI4bvEXT_remap_index },
-   { 15747, VertexAttribI4iEXT_remap_index },
+   { 32591, VertexAttribI3uivEXT_remap_index },
+   { 23551, VertexAttribI4bvEXT_remap_index },
+   { 15769, VertexAttribI4iEXT_remap_index },
    {  1911, VertexAttribI4ivEXT_remap_index },
-   { 14468, VertexAttribI4svEXT_remap_index },
-   { 17798, VertexAttribI4ubvEXT_remap_index },
+   { 14490, VertexAttribI4svEXT_remap_index },
+   { 17820, VertexAttribI4ubvEXT_remap_index },
    {   145, VertexAttribI4uiEXT_remap_index },
-   {  6151, VertexAttribI4uivEXT_remap_index },
-   { 12358, VertexAttribI4usvEXT_remap_index },
-   { 19917, VertexAttribIPointerEXT_remap_index },
+   {  6173, VertexAttribI4uivEXT_remap_index },
+   { 12380, VertexAttribI4usvEXT_remap_index },
+   { 19939, VertexAttribIPointerEXT_remap_index },
    {  3328, FramebufferTextureLayerEXT_remap_index },
-   { 10177, ColorMaskIndexedEXT_remap_index },
-   { 28056, DisableIndexedEXT_remap_index },
-   { 28516, EnableIndexedEXT_remap_index },
-   { 23208, GetBooleanIndexedvEXT_remap_index },
-   { 26134, GetIntegerIndexedvEXT_remap_index },
-   { 24390, IsEnabledIndexedEXT_remap_index },
-   { 24290, ClearColorIiEXT_remap_index },
+   { 10199, ColorMaskIndexedEXT_remap_index },
+   { 28098, DisableIndexedEXT_remap_index },
+   { 28558, EnableIndexedEXT_remap_index },
+   { 23230, GetBooleanIndexedvEXT_remap_index },
+   { 26176, GetIntegerIndexedvEXT_remap_index },
+   { 24412, IsEnabledIndexedEXT_remap_index },
+   { 24312, ClearColorIiEXT_remap_index },
    {  3766, ClearColorIuiEXT_remap_index },
-   { 10861, GetTexParameterIivEXT_remap_index },
-   {  6633, GetTexParameterIuivEXT_remap_index },
+   { 10883, GetTexParameterIivEXT_remap_index },
+   {  6655, GetTexParameterIuivEXT_remap_index },
    {  3284, TexParameterIivEXT_remap_index },
-   { 28338, TexParameterIuivEXT_remap_index },
-   {  5106, BeginConditionalRenderNV_remap_index },
-   { 27285, EndConditionalRenderNV_remap_index },
-   { 26179, BeginTransformFeedbackEXT_remap_index },
-   {  6709, BindBufferBaseEXT_remap_index },
-   { 24972, BindBufferOffsetEXT_remap_index },
-   { 13262, BindBufferRangeEXT_remap_index },
-   { 28950, EndTransformFeedbackEXT_remap_index },
-   {  5825, GetTransformFeedbackVaryingEXT_remap_index },
-   { 23986, TransformFeedbackVaryingsEXT_remap_index },
-   { 31637, ProvokingVertexEXT_remap_index },
-   { 11841, GetTexParameterPointervAPPLE_remap_index },
-   {  5648, TextureRangeAPPLE_remap_index },
-   { 12647, GetObjectParameterivAPPLE_remap_index },
-   { 21367, ObjectPurgeableAPPLE_remap_index },
-   {  6427, ObjectUnpurgeableAPPLE_remap_index },
-   { 18581, ActiveProgramEXT_remap_index },
-   {  4632, CreateShaderProgramEXT_remap_index },
-   { 30540, UseShaderProgramEXT_remap_index },
-   { 23010, TextureBarrierNV_remap_index },
-   { 30804, StencilFuncSeparateATI_remap_index },
-   {  6340, ProgramEnvParameters4fvEXT_remap_index },
-   { 18450, ProgramLocalParameters4fvEXT_remap_index },
-   { 15257, GetQueryObjecti64vEXT_remap_index },
-   { 11443, GetQueryObjectui64vEXT_remap_index },
-   { 25514, EGLImageTargetRenderbufferStorageOES_remap_index },
-   { 13151, EGLImageTargetTexture2DOES_remap_index },
+   { 28380, TexParameterIuivEXT_remap_index },
+   {  5128, BeginConditionalRenderNV_remap_index },
+   { 27327, EndConditionalRenderNV_remap_index },
+   { 26221, BeginTransformFeedbackEXT_remap_index },
+   {  6731, BindBufferBaseEXT_remap_index },
+   { 24994, BindBufferOffsetEXT_remap_index },
+   { 13284, BindBufferRangeEXT_remap_index },
+   { 29018, EndTransformFeedbackEXT_remap_index },
+   {  5847, GetTransformFeedbackVaryingEXT_remap_index },
+   { 24008, TransformFeedbackVaryingsEXT_remap_index },
+   { 31705, ProvokingVertexEXT_remap_index },
+   { 11863, GetTexParameterPointervAPPLE_remap_index },
+   {  5670, TextureRangeAPPLE_remap_index },
+   { 12669, GetObjectParameterivAPPLE_remap_index },
+   { 21389, ObjectPurgeableAPPLE_remap_index },
+   {  6449, ObjectUnpurgeableAPPLE_remap_index },
+   { 18603, ActiveProgramEXT_remap_index },
+   {  4654, CreateShaderProgramEXT_remap_index },
+   { 30608, UseShaderProgramEXT_remap_index },
+   { 23032, TextureBarrierNV_remap_index },
+   { 30872, StencilFuncSeparateATI_remap_index },
+   {  6362, ProgramEnvParameters4fvEXT_remap_index },
+   { 18472, ProgramLocalParameters4fvEXT_remap_index },
+   { 15279, GetQueryObjecti64vEXT_remap_index },
+   { 11465, GetQueryObjectui64vEXT_remap_index },
+   { 25536, EGLImageTargetRenderbufferStorageOES_remap_index },
+   { 13173, EGLImageTargetTexture2DOES_remap_index },
    {    -1, -1 }
 };
 
@@ -5711,108 +5722,108 @@ static const struct gl_function_remap MESA_alt_functions[] = {
    /* from GL_EXT_blend_color */
    {  2945, _gloffset_BlendColor },
    /* from GL_EXT_blend_minmax */
-   { 12252, _gloffset_BlendEquation },
+   { 12274, _gloffset_BlendEquation },
    /* from GL_EXT_color_subtable */
-   { 18324, _gloffset_ColorSubTable },
-   { 33852, _gloffset_CopyColorSubTable },
+   { 18346, _gloffset_ColorSubTable },
+   { 33920, _gloffset_CopyColorSubTable },
    /* from GL_EXT_convolution */
    {   305, _gloffset_ConvolutionFilter1D },
    {  2744, _gloffset_CopyConvolutionFilter1D },
-   {  4422, _gloffset_GetConvolutionParameteriv },
-   {  9417, _gloffset_ConvolutionFilter2D },
-   {  9619, _gloffset_ConvolutionParameteriv },
-   { 10079, _gloffset_ConvolutionParameterfv },
-   { 22088, _gloffset_GetSeparableFilter },
-   { 25789, _gloffset_SeparableFilter2D },
-   { 26727, _gloffset_ConvolutionParameteri },
-   { 26919, _gloffset_ConvolutionParameterf },
-   { 28705, _gloffset_GetConvolutionParameterfv },
-   { 29613, _gloffset_GetConvolutionFilter },
-   { 32219, _gloffset_CopyConvolutionFilter2D },
+   {  4444, _gloffset_GetConvolutionParameteriv },
+   {  9439, _gloffset_ConvolutionFilter2D },
+   {  9641, _gloffset_ConvolutionParameteriv },
+   { 10101, _gloffset_ConvolutionParameterfv },
+   { 22110, _gloffset_GetSeparableFilter },
+   { 25811, _gloffset_SeparableFilter2D },
+   { 26769, _gloffset_ConvolutionParameteri },
+   { 26961, _gloffset_ConvolutionParameterf },
+   { 28747, _gloffset_GetConvolutionParameterfv },
+   { 29681, _gloffset_GetConvolutionFilter },
+   { 32287, _gloffset_CopyConvolutionFilter2D },
    /* from GL_EXT_copy_texture */
-   { 16247, _gloffset_CopyTexSubImage3D },
-   { 18011, _gloffset_CopyTexImage2D },
-   { 26310, _gloffset_CopyTexImage1D },
-   { 29294, _gloffset_CopyTexSubImage2D },
-   { 31832, _gloffset_CopyTexSubImage1D },
+   { 16269, _gloffset_CopyTexSubImage3D },
+   { 18033, _gloffset_CopyTexImage2D },
+   { 26352, _gloffset_CopyTexImage1D },
+   { 29362, _gloffset_CopyTexSubImage2D },
+   { 31900, _gloffset_CopyTexSubImage1D },
    /* from GL_EXT_draw_range_elements */
-   { 10444, _gloffset_DrawRangeElements },
+   { 10466, _gloffset_DrawRangeElements },
    /* from GL_EXT_histogram */
    {   904, _gloffset_Histogram },
    {  3852, _gloffset_ResetHistogram },
-   { 11007, _gloffset_GetMinmax },
-   { 16581, _gloffset_GetHistogramParameterfv },
-   { 26235, _gloffset_GetMinmaxParameteriv },
-   { 28595, _gloffset_ResetMinmax },
-   { 29510, _gloffset_GetHistogramParameteriv },
-   { 30738, _gloffset_GetHistogram },
-   { 33438, _gloffset_Minmax },
-   { 35097, _gloffset_GetMinmaxParameterfv },
+   { 11029, _gloffset_GetMinmax },
+   { 16603, _gloffset_GetHistogramParameterfv },
+   { 26277, _gloffset_GetMinmaxParameteriv },
+   { 28637, _gloffset_ResetMinmax },
+   { 29578, _gloffset_GetHistogramParameteriv },
+   { 30806, _gloffset_GetHistogram },
+   { 33506, _gloffset_Minmax },
+   { 35165, _gloffset_GetMinmaxParameterfv },
    /* from GL_EXT_paletted_texture */
-   {  9279, _gloffset_ColorTable },
-   { 16427, _gloffset_GetColorTable },
-   { 24676, _gloffset_GetColorTableParameterfv },
-   { 26975, _gloffset_GetColorTableParameteriv },
+   {  9301, _gloffset_ColorTable },
+   { 16449, _gloffset_GetColorTable },
+   { 24698, _gloffset_GetColorTableParameterfv },
+   { 27017, _gloffset_GetColorTableParameteriv },
    /* from GL_EXT_subtexture */
-   {  7938, _gloffset_TexSubImage1D },
-   { 11768, _gloffset_TexSubImage2D },
+   {  7960, _gloffset_TexSubImage1D },
+   { 11790, _gloffset_TexSubImage2D },
    /* from GL_EXT_texture3D */
    {  2004, _gloffset_TexImage3D },
-   { 24445, _gloffset_TexSubImage3D },
+   { 24467, _gloffset_TexSubImage3D },
    /* from GL_EXT_texture_object */
    {  3620, _gloffset_PrioritizeTextures },
-   {  8412, _gloffset_AreTexturesResident },
-   { 14665, _gloffset_GenTextures },
-   { 16958, _gloffset_DeleteTextures },
-   { 21047, _gloffset_IsTexture },
-   { 31897, _gloffset_BindTexture },
+   {  8434, _gloffset_AreTexturesResident },
+   { 14687, _gloffset_GenTextures },
+   { 16980, _gloffset_DeleteTextures },
+   { 21069, _gloffset_IsTexture },
+   { 31965, _gloffset_BindTexture },
    /* from GL_EXT_vertex_array */
-   { 25961, _gloffset_ArrayElement },
-   { 33026, _gloffset_GetPointerv },
-   { 34592, _gloffset_DrawArrays },
+   { 26003, _gloffset_ArrayElement },
+   { 33094, _gloffset_GetPointerv },
+   { 34660, _gloffset_DrawArrays },
    /* from GL_SGI_color_table */
-   {  8530, _gloffset_ColorTableParameteriv },
-   {  9279, _gloffset_ColorTable },
-   { 16427, _gloffset_GetColorTable },
-   { 16537, _gloffset_CopyColorTable },
-   { 20908, _gloffset_ColorTableParameterfv },
-   { 24676, _gloffset_GetColorTableParameterfv },
-   { 26975, _gloffset_GetColorTableParameteriv },
+   {  8552, _gloffset_ColorTableParameteriv },
+   {  9301, _gloffset_ColorTable },
+   { 16449, _gloffset_GetColorTable },
+   { 16559, _gloffset_CopyColorTable },
+   { 20930, _gloffset_ColorTableParameterfv },
+   { 24698, _gloffset_GetColorTableParameterfv },
+   { 27017, _gloffset_GetColorTableParameteriv },
    /* from GL_VERSION_1_3 */
    {   473, _gloffset_MultiTexCoord3sARB },
    {   705, _gloffset_ActiveTextureARB },
-   {  4661, _gloffset_MultiTexCoord1fvARB },
-   {  6922, _gloffset_MultiTexCoord3dARB },
-   {  6967, _gloffset_MultiTexCoord2iARB },
-   {  7091, _gloffset_MultiTexCoord2svARB },
-   {  9235, _gloffset_MultiTexCoord2fARB },
-   { 11473, _gloffset_MultiTexCoord3fvARB },
-   { 12014, _gloffset_MultiTexCoord4sARB },
-   { 12695, _gloffset_MultiTexCoord2dvARB },
-   { 13094, _gloffset_MultiTexCoord1svARB },
-   { 13459, _gloffset_MultiTexCoord3svARB },
-   { 13520, _gloffset_MultiTexCoord4iARB },
-   { 14376, _gloffset_MultiTexCoord3iARB },
-   { 15286, _gloffset_MultiTexCoord1dARB },
-   { 15483, _gloffset_MultiTexCoord3dvARB },
-   { 16799, _gloffset_MultiTexCoord3ivARB },
-   { 16844, _gloffset_MultiTexCoord2sARB },
-   { 18381, _gloffset_MultiTexCoord4ivARB },
-   { 20548, _gloffset_ClientActiveTextureARB },
-   { 22892, _gloffset_MultiTexCoord2dARB },
-   { 23373, _gloffset_MultiTexCoord4dvARB },
-   { 23750, _gloffset_MultiTexCoord4fvARB },
-   { 24817, _gloffset_MultiTexCoord3fARB },
-   { 27600, _gloffset_MultiTexCoord4dARB },
-   { 27878, _gloffset_MultiTexCoord1sARB },
-   { 28091, _gloffset_MultiTexCoord1dvARB },
-   { 29138, _gloffset_MultiTexCoord1ivARB },
-   { 29231, _gloffset_MultiTexCoord2ivARB },
-   { 29570, _gloffset_MultiTexCoord1iARB },
-   { 31013, _gloffset_MultiTexCoord4svARB },
-   { 31679, _gloffset_MultiTexCoord1fARB },
-   { 31958, _gloffset_MultiTexCoord4fARB },
-   { 34426, _gloffset_MultiTexCoord2fvARB },
+   {  4683, _gloffset_MultiTexCoord1fvARB },
+   {  6944, _gloffset_MultiTexCoord3dARB },
+   {  6989, _gloffset_MultiTexCoord2iARB },
+   {  7113, _gloffset_MultiTexCoord2svARB },
+   {  9257, _gloffset_MultiTexCoord2fARB },
+   { 11495, _gloffset_MultiTexCoord3fvARB },
+   { 12036, _gloffset_MultiTexCoord4sARB },
+   { 12717, _gloffset_MultiTexCoord2dvARB },
+   { 13116, _gloffset_MultiTexCoord1svARB },
+   { 13481, _gloffset_MultiTexCoord3svARB },
+   { 13542, _gloffset_MultiTexCoord4iARB },
+   { 14398, _gloffset_MultiTexCoord3iARB },
+   { 15308, _gloffset_MultiTexCoord1dARB },
+   { 15505, _gloffset_MultiTexCoord3dvARB },
+   { 16821, _gloffset_MultiTexCoord3ivARB },
+   { 16866, _gloffset_MultiTexCoord2sARB },
+   { 18403, _gloffset_MultiTexCoord4ivARB },
+   { 20570, _gloffset_ClientActiveTextureARB },
+   { 22914, _gloffset_MultiTexCoord2dARB },
+   { 23395, _gloffset_MultiTexCoord4dvARB },
+   { 23772, _gloffset_MultiTexCoord4fvARB },
+   { 24839, _gloffset_MultiTexCoord3fARB },
+   { 27642, _gloffset_MultiTexCoord4dARB },
+   { 27920, _gloffset_MultiTexCoord1sARB },
+   { 28133, _gloffset_MultiTexCoord1dvARB },
+   { 29206, _gloffset_MultiTexCoord1ivARB },
+   { 29299, _gloffset_MultiTexCoord2ivARB },
+   { 29638, _gloffset_MultiTexCoord1iARB },
+   { 31081, _gloffset_MultiTexCoord4svARB },
+   { 31747, _gloffset_MultiTexCoord1fARB },
+   { 32026, _gloffset_MultiTexCoord4fARB },
+   { 34494, _gloffset_MultiTexCoord2fvARB },
    {    -1, -1 }
 };
 
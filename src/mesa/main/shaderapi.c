@@ -45,7 +45,9 @@
 #include "main/mtypes.h"
 #include "main/shaderapi.h"
 #include "main/shaderobj.h"
+#include "main/shaderqueue.h"
 #include "main/uniforms.h"
+#include "program/disk_cache.h"
 #include "program/program.h"
 #include "program/prog_parameter.h"
 #include "ralloc.h"
@@ -83,6 +85,8 @@ get_shader_flags(void)
          flags |= GLSL_UNIFORMS;
       if (strstr(env, "useprog"))
          flags |= GLSL_USE_PROG;
+      if (strstr(env, "nocache"))
+         flags |= GLSL_NO_CACHE;
    }
 
    return flags;
@@ -111,6 +115,13 @@ _mesa_init_shader_state(struct gl_context *ctx)
       memcpy(&ctx->ShaderCompilerOptions[sh], &options, sizeof(options));
 
    ctx->Shader.Flags = get_shader_flags();
+
+   /* Dumping and logging shaders expects every shader to really be compiled.
+    */
+   if (!(ctx->Shader.Flags & (GLSL_NO_CACHE | GLSL_DUMP | GLSL_LOG)))
+      ctx->Shader.DiskCache = _mesa_disk_cache_create();
+
+   _mesa_init_shader_queue(ctx);
 }
 
 
@@ -128,6 +139,12 @@ _mesa_free_shader_state(struct gl_context *ctx)
    _mesa_reference_shader_program(ctx, &ctx->Shader._CurrentFragmentProgram,
 				  NULL);
    _mesa_reference_shader_program(ctx, &ctx->Shader.ActiveProgram, NULL);
+
+   /* Queued compiles use the disk cache. */
+   _mesa_free_shader_queue(ctx);
+
+   _mesa_disk_cache_destroy(ctx->Shader.DiskCache);
+   ctx->Shader.DiskCache = NULL;
 }
 
 
@@ -516,7 +533,10 @@ get_programiv(struct gl_context *ctx, GLuint program, GLenum pname, GLint *param
       break;
    }
    case GL_PROGRAM_BINARY_LENGTH_OES:
-      *params = 0;
+      *params = shProg->LinkStatus ? shProg->BinarySize : 0;
+      break;
+   case GL_PROGRAM_BINARY_RETRIEVABLE_HINT:
+      *params = shProg->BinaryRetrievableHint;
       break;
 #if FEATURE_EXT_transform_feedback
    case GL_TRANSFORM_FEEDBACK_VARYINGS:
@@ -644,6 +664,7 @@ shader_source(struct gl_context *ctx, GLuint shader, const GLchar *source)
    }
    sh->Source = source;
    sh->CompileStatus = GL_FALSE;
+   sh->CompileDeferred = GL_FALSE;
 #ifdef DEBUG
    sh->SourceChecksum = _mesa_str_checksum(sh->Source);
 #endif
@@ -669,9 +690,10 @@ compile_shader(struct gl_context *ctx, GLuint shaderObj)
    sh->Pragmas = options->DefaultPragmas;
 
    /* this call will set the sh->CompileStatus field to indicate if
-    * compilation was successful.
+    * compilation was successful, possibly only once the shader is looked
+    * up again.
     */
-   _mesa_glsl_compile_shader(ctx, sh);
+   _mesa_shader_queue_compile(ctx, sh);
 }
 
 
@@ -684,6 +706,7 @@ link_program(struct gl_context *ctx, GLuint program)
    struct gl_shader_program *shProg;
    struct gl_transform_feedback_object *obj =
       ctx->TransformFeedback.CurrentObject;
+   GLuint i;
 
    shProg = _mesa_lookup_shader_program_err(ctx, program, "glLinkProgram");
    if (!shProg)
@@ -700,12 +723,14 @@ link_program(struct gl_context *ctx, GLuint program)
 
    FLUSH_VERTICES(ctx, _NEW_PROGRAM);
 
+   /* Linking happens on this thread, once all the shaders are compiled. */
+   for (i = 0; i < shProg->NumShaders; i++)
+      _mesa_shader_queue_wait(shProg->Shaders[i]);
+
    _mesa_glsl_link_shader(ctx, shProg);
 
    /* debug code */
    if (0) {
-      GLuint i;
-
       printf("Link %u shaders in program %u: %s\n",
                    shProg->NumShaders, shProg->Name,
                    shProg->LinkStatus ? "Success" : "Failed");
@@ -1456,6 +1481,95 @@ _mesa_ShaderBinary(GLint n, const GLuint* shaders, GLenum binaryformat,
    _mesa_error(ctx, GL_INVALID_OPERATION, __FUNCTION__);
 }
 
+
+void GLAPIENTRY
+_mesa_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length,
+                       GLenum *binaryFormat, GLvoid *binary)
+{
+   struct gl_shader_program *shProg;
+   GET_CURRENT_CONTEXT(ctx);
+
+   shProg = _mesa_lookup_shader_program_err(ctx, program,
+                                            "glGetProgramBinary");
+   if (!shProg)
+      return;
+
+   if (bufSize < 0) {
+      _mesa_error(ctx, GL_INVALID_VALUE, "glGetProgramBinary(bufSize)");
+      return;
+   }
+
+   if (length)
+      *length = 0;
+
+   if (!shProg->LinkStatus) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+                  "glGetProgramBinary(program not linked)");
+      return;
+   }
+
+   /* The binary is only kept if GL_PROGRAM_BINARY_RETRIEVABLE_HINT was set
+    * when the program was linked.
+    */
+   if (!shProg->Binary) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+                  "glGetProgramBinary(no binary available)");
+      return;
+   }
+
+   if ((GLuint) bufSize < shProg->BinarySize) {
+      _mesa_error(ctx, GL_INVALID_OPERATION, "glGetProgramBinary(bufSize)");
+      return;
+   }
+
+   memcpy(binary, shProg->Binary, shProg->BinarySize);
+   if (length)
+      *length = shProg->BinarySize;
+   *binaryFormat = GL_PROGRAM_BINARY_FORMAT_MESA;
+}
+
+
+void GLAPIENTRY
+_mesa_ProgramBinary(GLuint program, GLenum binaryFormat,
+                    const GLvoid *binary, GLsizei length)
+{
+   struct gl_shader_program *shProg;
+   struct gl_transform_feedback_object *obj;
+   GET_CURRENT_CONTEXT(ctx);
+
+   shProg = _mesa_lookup_shader_program_err(ctx, program, "glProgramBinary");
+   if (!shProg)
+      return;
+
+   if (binaryFormat != GL_PROGRAM_BINARY_FORMAT_MESA) {
+      _mesa_error(ctx, GL_INVALID_ENUM, "glProgramBinary(binaryFormat)");
+      return;
+   }
+
+   if (length < 0) {
+      _mesa_error(ctx, GL_INVALID_VALUE, "glProgramBinary(length)");
+      return;
+   }
+
+   obj = ctx->TransformFeedback.CurrentObject;
+   if (obj->Active
+       && (shProg == ctx->Shader.CurrentVertexProgram
+	   || shProg == ctx->Shader.CurrentGeometryProgram
+	   || shProg == ctx->Shader.CurrentFragmentProgram)) {
+      _mesa_error(ctx, GL_INVALID_OPERATION,
+                  "glProgramBinary(transform feedback active)");
+      return;
+   }
+
+   FLUSH_VERTICES(ctx, _NEW_PROGRAM);
+
+   /* A binary that cannot be loaded is not an error.  It just leaves the
+    * program unlinked, and the application is expected to fall back to
+    * compiling from source.
+    */
+   _mesa_glsl_load_program_binary(ctx, shProg, binary, length);
+}
+
 #endif /* FEATURE_ES2 */
 
 
@@ -1515,6 +1629,18 @@ _mesa_ProgramParameteriARB(GLuint program, GLenum pname, GLint value)
          return;
       }
       break;
+   case GL_PROGRAM_BINARY_RETRIEVABLE_HINT:
+      /* The binary is captured at every link regardless, so the hint only
+       * needs to be remembered for glGetProgramiv.
+       */
+      if (value != GL_TRUE && value != GL_FALSE) {
+         _mesa_error(ctx, GL_INVALID_VALUE,
+                     "glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT=%d)",
+                     value);
+         return;
+      }
+      shProg->BinaryRetrievableHint = value;
+      break;
    default:
       _mesa_error(ctx, GL_INVALID_ENUM, "glProgramParameteriARB(pname=%s)",
                   _mesa_lookup_enum_by_nr(pname));
@@ -1691,6 +1817,10 @@ _mesa_init_shader_dispatch(struct _glapi_table *exec)
    /* GL_ARB_blend_func_extended */
    SET_BindFragDataLocationIndexed(exec, _mesa_BindFragDataLocationIndexed);
    SET_GetFragDataIndex(exec, _mesa_GetFragDataIndex);
+
+   /* GL_ARB_get_program_binary */
+   SET_GetProgramBinary(exec, _mesa_GetProgramBinary);
+   SET_ProgramBinary(exec, _mesa_ProgramBinary);
 #endif /* FEATURE_GL */
 }
 
@@ -35,6 +35,7 @@
 #include "main/mfeatures.h"
 #include "main/mtypes.h"
 #include "main/shaderobj.h"
+#include "main/shaderqueue.h"
 #include "main/uniforms.h"
 #include "program/program.h"
 #include "program/prog_parameter.h"
@@ -75,6 +76,7 @@ _mesa_reference_shader(struct gl_context *ctx, struct gl_shader **ptr,
       if (deleteFlag) {
 	 if (old->Name != 0)
 	    _mesa_HashRemove(ctx->Shared->ShaderObjects, old->Name);
+         _mesa_shader_queue_wait(old);
          ctx->Driver.DeleteShader(ctx, old);
       }
 
@@ -133,6 +135,9 @@ _mesa_delete_shader(struct gl_context *ctx, struct gl_shader *sh)
 
 /**
  * Lookup a GLSL shader object.
+ *
+ * If the shader is still being compiled on a worker thread, this waits for
+ * the compile to finish, so that the caller sees its results.
  */
 struct gl_shader *
 _mesa_lookup_shader(struct gl_context *ctx, GLuint name)
@@ -147,6 +152,8 @@ _mesa_lookup_shader(struct gl_context *ctx, GLuint name)
       if (sh && sh->Type == GL_SHADER_PROGRAM_MESA) {
          return NULL;
       }
+      if (sh)
+         _mesa_shader_queue_wait(sh);
       return sh;
    }
    return NULL;
@@ -174,6 +181,7 @@ _mesa_lookup_shader_err(struct gl_context *ctx, GLuint name, const char *caller)
          _mesa_error(ctx, GL_INVALID_OPERATION, "%s", caller);
          return NULL;
       }
+      _mesa_shader_queue_wait(sh);
       return sh;
    }
 }
@@ -289,6 +297,12 @@ _mesa_clear_shader_program_data(struct gl_context *ctx,
       shProg->UniformHash = NULL;
    }
 
+   if (shProg->Binary) {
+      ralloc_free(shProg->Binary);
+      shProg->Binary = NULL;
+      shProg->BinarySize = 0;
+   }
+
    assert(shProg->InfoLog != NULL);
    ralloc_free(shProg->InfoLog);
    shProg->InfoLog = ralloc_strdup(shProg, "");
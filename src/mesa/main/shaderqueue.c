@@ -0,0 +1,396 @@
+/*
+ * Mesa 3-D graphics library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file shaderqueue.c
+ * Compilation of GLSL shaders on worker threads.
+ *
+ * glCompileShader() only queues the shader.  The GLSL front end then runs on
+ * one of a few worker threads, so that an application compiling all of its
+ * shaders up front gets them compiled in parallel.  The compile is finished,
+ * on the application's thread if no worker has picked it up yet, as soon as
+ * anything looks at the shader: _mesa_lookup_shader() waits for it, as do
+ * linking and deleting the shader.
+ *
+ * The worker threads are shared by all contexts, and started when the first
+ * shader is queued.  Their number is the number of CPUs minus one, since the
+ * application's thread takes part in the work as soon as it waits, and can
+ * be overridden with the MESA_GLSL_THREADS environment variable.  Zero
+ * compiles every shader in glCompileShader(), as before.
+ */
+
+
+#include "main/glheader.h"
+#include "main/imports.h"
+#include "main/macros.h"
+#include "main/mtypes.h"
+#include "main/shaderqueue.h"
+#include "program/ir_to_mesa.h"
+
+
+#ifdef PTHREADS
+
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+#define MAX_COMPILE_THREADS 16
+
+
+struct shader_job
+{
+   struct gl_context *ctx;
+   struct gl_shader *sh;
+   struct shader_job *next;
+};
+
+
+/**
+ * The queue state.  Everything in here, as well as gl_shader::CompilePending,
+ * is protected by \c mutex.
+ */
+static struct
+{
+   pthread_mutex_t mutex;
+   pthread_cond_t work_cond;    /**< Signaled when a job is queued */
+   pthread_cond_t done_cond;    /**< Broadcast when a job is finished */
+
+   struct shader_job *queued;   /**< Jobs not started yet, oldest first */
+   struct shader_job **tail;    /**< Where the next job is queued */
+   struct shader_job *running;  /**< Jobs being run by the workers */
+
+   GLuint num_contexts;
+   GLint max_threads;           /**< -1 until the first context is created */
+   GLuint num_threads;          /**< Number of threads running */
+   GLboolean shutdown;
+   pthread_t threads[MAX_COMPILE_THREADS];
+} queue = {
+   PTHREAD_MUTEX_INITIALIZER,
+   PTHREAD_COND_INITIALIZER,
+   PTHREAD_COND_INITIALIZER,
+   NULL, &queue.queued, NULL,
+   0, -1, 0, GL_FALSE
+};
+
+
+static GLint
+get_max_threads(void)
+{
+   const char *env = _mesa_getenv("MESA_GLSL_THREADS");
+   long n = 0;
+
+   if (env)
+      return CLAMP(atoi(env), 0, MAX_COMPILE_THREADS);
+
+#ifdef _SC_NPROCESSORS_ONLN
+   n = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+#endif
+   return CLAMP(n, 0, MAX_COMPILE_THREADS);
+}
+
+
+/**
+ * Remove the oldest queued job for \c sh, or for \c ctx if \c sh is NULL.
+ * Called with the mutex held.
+ */
+static struct shader_job *
+unqueue_job(struct gl_context *ctx, struct gl_shader *sh)
+{
+   struct shader_job **link;
+
+   for (link = &queue.queued; *link != NULL; link = &(*link)->next) {
+      struct shader_job *job = *link;
+
+      if (sh ? job->sh == sh : job->ctx == ctx) {
+         *link = job->next;
+         if (queue.tail == &job->next)
+            queue.tail = link;
+         return job;
+      }
+   }
+
+   return NULL;
+}
+
+
+/**
+ * Compile the shader of a job that isn't on any list, and free the job.
+ * Called without the mutex held.
+ */
+static void
+run_job(struct shader_job *job)
+{
+   _mesa_glsl_compile_shader(job->ctx, job->sh);
+
+   pthread_mutex_lock(&queue.mutex);
+   job->sh->CompilePending = GL_FALSE;
+   pthread_cond_broadcast(&queue.done_cond);
+   pthread_mutex_unlock(&queue.mutex);
+
+   free(job);
+}
+
+
+static void *
+compile_thread(void *data)
+{
+   (void) data;
+
+   pthread_mutex_lock(&queue.mutex);
+
+   for (;;) {
+      struct shader_job *job, **link;
+
+      while (queue.queued == NULL && !queue.shutdown)
+         pthread_cond_wait(&queue.work_cond, &queue.mutex);
+
+      if (queue.shutdown)
+         break;
+
+      job = queue.queued;
+      queue.queued = job->next;
+      if (queue.tail == &job->next)
+         queue.tail = &queue.queued;
+
+      job->next = queue.running;
+      queue.running = job;
+
+      pthread_mutex_unlock(&queue.mutex);
+      _mesa_glsl_compile_shader(job->ctx, job->sh);
+      pthread_mutex_lock(&queue.mutex);
+
+      for (link = &queue.running; *link != job; link = &(*link)->next)
+         ;
+      *link = job->next;
+
+      job->sh->CompilePending = GL_FALSE;
+      pthread_cond_broadcast(&queue.done_cond);
+      free(job);
+   }
+
+   pthread_mutex_unlock(&queue.mutex);
+   return NULL;
+}
+
+
+/**
+ * Start the worker threads.  Called with the mutex held.
+ */
+static void
+start_threads(void)
+{
+   sigset_t new_set, old_set;
+   GLint i;
+
+   /* Signals are for the application's threads to handle. */
+   sigfillset(&new_set);
+   pthread_sigmask(SIG_SETMASK, &new_set, &old_set);
+
+   for (i = 0; i < queue.max_threads; i++) {
+      if (pthread_create(&queue.threads[queue.num_threads], NULL,
+                         compile_thread, NULL) != 0)
+         break;
+      queue.num_threads++;
+   }
+
+   pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+
+   /* Don't try again on every compile if no thread could be created. */
+   if (queue.num_threads == 0)
+      queue.max_threads = 0;
+}
+
+
+void
+_mesa_init_shader_queue(struct gl_context *ctx)
+{
+   (void) ctx;
+
+   pthread_mutex_lock(&queue.mutex);
+   if (queue.max_threads < 0)
+      queue.max_threads = get_max_threads();
+   queue.num_contexts++;
+   pthread_mutex_unlock(&queue.mutex);
+}
+
+
+/**
+ * Finish the context's queued compiles, and stop the worker threads if this
+ * is the last context.
+ */
+void
+_mesa_free_shader_queue(struct gl_context *ctx)
+{
+   struct shader_job *job;
+   GLboolean busy;
+   GLuint i;
+
+   pthread_mutex_lock(&queue.mutex);
+
+   /* The shaders may be shared with other contexts, so they have to be
+    * compiled anyway.
+    */
+   while ((job = unqueue_job(ctx, NULL)) != NULL) {
+      pthread_mutex_unlock(&queue.mutex);
+      run_job(job);
+      pthread_mutex_lock(&queue.mutex);
+   }
+
+   do {
+      busy = GL_FALSE;
+      for (job = queue.running; job != NULL; job = job->next) {
+         if (job->ctx == ctx) {
+            busy = GL_TRUE;
+            pthread_cond_wait(&queue.done_cond, &queue.mutex);
+            break;
+         }
+      }
+   } while (busy);
+
+   ASSERT(queue.num_contexts > 0);
+   if (--queue.num_contexts > 0 || queue.num_threads == 0) {
+      pthread_mutex_unlock(&queue.mutex);
+      return;
+   }
+
+   /* No context is left to queue anything, so the workers are idle. */
+   queue.shutdown = GL_TRUE;
+   pthread_cond_broadcast(&queue.work_cond);
+   pthread_mutex_unlock(&queue.mutex);
+
+   for (i = 0; i < queue.num_threads; i++)
+      pthread_join(queue.threads[i], NULL);
+
+   pthread_mutex_lock(&queue.mutex);
+   queue.num_threads = 0;
+   queue.shutdown = GL_FALSE;
+   pthread_mutex_unlock(&queue.mutex);
+}
+
+
+/**
+ * Compile a shader, on a worker thread if possible.  Called via
+ * glCompileShader().
+ */
+void
+_mesa_shader_queue_compile(struct gl_context *ctx, struct gl_shader *sh)
+{
+   struct shader_job *job;
+
+   _mesa_shader_queue_wait(sh);
+
+   /* Dumps and logs are easier to read in the order shaders are compiled. */
+   if (ctx->Shader.Flags & (GLSL_DUMP | GLSL_LOG)) {
+      _mesa_glsl_compile_shader(ctx, sh);
+      return;
+   }
+
+   job = malloc(sizeof(*job));
+   if (job == NULL) {
+      _mesa_glsl_compile_shader(ctx, sh);
+      return;
+   }
+
+   job->ctx = ctx;
+   job->sh = sh;
+   job->next = NULL;
+
+   pthread_mutex_lock(&queue.mutex);
+
+   if (queue.num_threads == 0 && queue.max_threads > 0 && !queue.shutdown)
+      start_threads();
+
+   if (queue.num_threads == 0 || queue.shutdown) {
+      pthread_mutex_unlock(&queue.mutex);
+      free(job);
+      _mesa_glsl_compile_shader(ctx, sh);
+      return;
+   }
+
+   sh->CompilePending = GL_TRUE;
+   *queue.tail = job;
+   queue.tail = &job->next;
+   pthread_cond_signal(&queue.work_cond);
+
+   pthread_mutex_unlock(&queue.mutex);
+}
+
+
+/**
+ * Wait for a queued compile of the shader to finish.  If no worker thread
+ * has started it yet, it is compiled on the calling thread instead.
+ */
+void
+_mesa_shader_queue_wait(struct gl_shader *sh)
+{
+   struct shader_job *job;
+
+   pthread_mutex_lock(&queue.mutex);
+
+   if (sh->CompilePending) {
+      job = unqueue_job(NULL, sh);
+      if (job != NULL) {
+         pthread_mutex_unlock(&queue.mutex);
+         run_job(job);
+         return;
+      }
+
+      while (sh->CompilePending)
+         pthread_cond_wait(&queue.done_cond, &queue.mutex);
+   }
+
+   pthread_mutex_unlock(&queue.mutex);
+}
+
+
+#else /* PTHREADS */
+
+
+void
+_mesa_init_shader_queue(struct gl_context *ctx)
+{
+   (void) ctx;
+}
+
+
+void
+_mesa_free_shader_queue(struct gl_context *ctx)
+{
+   (void) ctx;
+}
+
+
+void
+_mesa_shader_queue_compile(struct gl_context *ctx, struct gl_shader *sh)
+{
+   _mesa_glsl_compile_shader(ctx, sh);
+}
+
+
+void
+_mesa_shader_queue_wait(struct gl_shader *sh)
+{
+   (void) sh;
+}
+
+
+#endif /* PTHREADS */
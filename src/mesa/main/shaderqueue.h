@@ -0,0 +1,56 @@
+/*
+ * Mesa 3-D graphics library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file shaderqueue.h
+ * Compilation of GLSL shaders on worker threads.
+ */
+
+#ifndef SHADERQUEUE_H
+#define SHADERQUEUE_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct gl_context;
+struct gl_shader;
+
+extern void
+_mesa_init_shader_queue(struct gl_context *ctx);
+
+extern void
+_mesa_free_shader_queue(struct gl_context *ctx);
+
+extern void
+_mesa_shader_queue_compile(struct gl_context *ctx, struct gl_shader *sh);
+
+extern void
+_mesa_shader_queue_wait(struct gl_shader *sh);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHADERQUEUE_H */
@@ -42,6 +42,7 @@
 #include "samplerobj.h"
 #endif
 #include "shaderobj.h"
+#include "shaderqueue.h"
 #include "syncobj.h"
 
 
@@ -232,6 +233,7 @@ delete_shader_cb(GLuint id, void *data, void *userData)
    struct gl_context *ctx = (struct gl_context *) userData;
    struct gl_shader *sh = (struct gl_shader *) data;
    if (sh->Type == GL_FRAGMENT_SHADER || sh->Type == GL_VERTEX_SHADER) {
+      _mesa_shader_queue_wait(sh);
       ctx->Driver.DeleteShader(ctx, sh);
    }
    else {
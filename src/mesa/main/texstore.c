@@ -75,6 +75,17 @@
 #include "../../gallium/auxiliary/util/u_format_rgb9e5.h"
 #include "../../gallium/auxiliary/util/u_format_r11g11b10f.h"
 
+/* With SIMD, swizzle_copy() is faster than the format-specific loops.
+ * Only 4-byte destination texels (the 8888 formats) have a SIMD path;
+ * other destinations keep their scalar loops.
+ */
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define SWIZZLE_SIMD 1
+#else
+#define SWIZZLE_SIMD 0
+#endif
+
 
 enum {
    ZERO = 4, 
@@ -663,6 +674,86 @@ _mesa_make_temp_ubyte_image(struct gl_context *ctx, GLuint dims,
 }
 
 
+#ifdef __SSE2__
+
+/**
+ * The part of swizzle_copy() for 4-component destination pixels which is
+ * done four pixels at a time.  The source pixels are widened to one per
+ * 32-bit lane, then each destination byte is shifted into place from its
+ * source byte, as SSE2 has no byte shuffle.
+ * \return the number of pixels copied
+ */
+static GLuint
+swizzle_copy_4_sse2(GLubyte *dst, const GLubyte *src, GLuint srcComponents,
+                    const GLubyte *map, GLuint count)
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i byte_mask = _mm_set1_epi32(0xff);
+   __m128i shift_right[4], shift_left[4], fill;
+   GLuint fill_bits = 0, num_shifts = 0, i, j;
+
+   for (j = 0; j < 4; j++) {
+      if (map[j] == ONE) {
+         fill_bits |= 0xffu << (8 * j);
+      }
+      else if (map[j] != ZERO) {
+         shift_right[num_shifts] = _mm_cvtsi32_si128(8 * map[j]);
+         shift_left[num_shifts] = _mm_cvtsi32_si128(8 * j);
+         num_shifts++;
+      }
+   }
+   fill = _mm_set1_epi32(fill_bits);
+
+   for (i = 0; i + 4 <= count; i += 4) {
+      const GLubyte *s = src + i * srcComponents;
+      __m128i pixels, result = fill;
+      GLuint k;
+
+      switch (srcComponents) {
+      case 4:
+         pixels = _mm_loadu_si128((const __m128i *) s);
+         break;
+      case 3:
+         /* A 16-byte load would read past the end of the last pixels. */
+         if (i + 6 > count)
+            return i;
+         pixels = _mm_loadu_si128((const __m128i *) s);
+         pixels = _mm_unpacklo_epi64(
+            _mm_unpacklo_epi32(pixels, _mm_srli_si128(pixels, 3)),
+            _mm_unpacklo_epi32(_mm_srli_si128(pixels, 6),
+                               _mm_srli_si128(pixels, 9)));
+         break;
+      case 2:
+         pixels = _mm_loadl_epi64((const __m128i *) s);
+         pixels = _mm_unpacklo_epi16(pixels, zero);
+         break;
+      case 1:
+         {
+            GLuint four;
+            memcpy(&four, s, 4);
+            pixels = _mm_cvtsi32_si128(four);
+            pixels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(pixels, zero), zero);
+         }
+         break;
+      default:
+         return 0;
+      }
+
+      for (k = 0; k < num_shifts; k++) {
+         __m128i byte = _mm_and_si128(_mm_srl_epi32(pixels, shift_right[k]),
+                                      byte_mask);
+         result = _mm_or_si128(result, _mm_sll_epi32(byte, shift_left[k]));
+      }
+
+      _mm_storeu_si128((__m128i *) (dst + i * 4), result);
+   }
+
+   return i;
+}
+
+#endif /* __SSE2__ */
+
+
 /**
  * Copy GLubyte pixels from <src> to <dst> with swizzling.
  * \param dst  destination pixels
@@ -707,6 +798,15 @@ swizzle_copy(GLubyte *dst, GLuint dstComponents, const GLubyte *src,
    ASSERT(srcComponents <= 4);
    ASSERT(dstComponents <= 4);
 
+#ifdef __SSE2__
+   if (dstComponents == 4) {
+      GLuint done = swizzle_copy_4_sse2(dst, src, srcComponents, map, count);
+      dst += done * 4;
+      src += done * srcComponents;
+      count -= done;
+   }
+#endif
+
    switch (dstComponents) {
    case 4:
       switch (srcComponents) {
@@ -980,6 +1080,30 @@ store_ubyte_texture(TEXSTORE_PARAMS)
    GLubyte *tempImage, *src;
    GLint img;
 
+   if (!ctx->_ImageTransferState &&
+       srcFormat == GL_RGBA &&
+       srcType == GL_UNSIGNED_BYTE &&
+       (baseInternalFormat == GL_RGBA ||
+        (baseInternalFormat == GL_RGB &&
+         _mesa_get_format_bits(dstFormat, GL_ALPHA_BITS) == 0))) {
+      /* The source pixels can be packed as they are, without a copy. */
+      const GLint userRowStride =
+         _mesa_image_row_stride(srcPacking, srcWidth, srcFormat, srcType);
+      const GLint userImageStride =
+         _mesa_image_image_stride(srcPacking, srcWidth, srcHeight,
+                                  srcFormat, srcType);
+      src = (GLubyte *) _mesa_image_address(dims, srcPacking, srcAddr,
+                                            srcWidth, srcHeight,
+                                            srcFormat, srcType, 0, 0, 0);
+      for (img = 0; img < srcDepth; img++) {
+         _mesa_pack_ubyte_rgba_rect(dstFormat, srcWidth, srcHeight,
+                                    src, userRowStride,
+                                    dstSlices[img], dstRowStride);
+         src += userImageStride;
+      }
+      return GL_TRUE;
+   }
+
    tempImage = _mesa_make_temp_ubyte_image(ctx, dims,
                                            baseInternalFormat,
                                            GL_RGBA,
@@ -1320,7 +1444,8 @@ _mesa_texstore_argb8888(TEXSTORE_PARAMS)
                      srcWidth, srcHeight, srcDepth, srcFormat, srcType,
                      srcAddr, srcPacking);
    }
-   else if (!ctx->_ImageTransferState &&
+   else if (!SWIZZLE_SIMD &&
+            !ctx->_ImageTransferState &&
             !srcPacking->SwapBytes &&
 	    (dstFormat == MESA_FORMAT_ARGB8888 ||
              dstFormat == MESA_FORMAT_XRGB8888) &&
@@ -1348,7 +1473,8 @@ _mesa_texstore_argb8888(TEXSTORE_PARAMS)
          }
       }
    }
-   else if (!ctx->_ImageTransferState &&
+   else if (!SWIZZLE_SIMD &&
+            !ctx->_ImageTransferState &&
             !srcPacking->SwapBytes &&
             dstFormat == MESA_FORMAT_ARGB8888 &&
             srcFormat == GL_LUMINANCE_ALPHA &&
@@ -1374,7 +1500,8 @@ _mesa_texstore_argb8888(TEXSTORE_PARAMS)
          }
       }
    }
-   else if (!ctx->_ImageTransferState &&
+   else if (!SWIZZLE_SIMD &&
+            !ctx->_ImageTransferState &&
             !srcPacking->SwapBytes &&
 	    dstFormat == MESA_FORMAT_ARGB8888 &&
             srcFormat == GL_RGBA &&
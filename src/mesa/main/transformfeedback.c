@@ -422,6 +422,9 @@ bind_buffer_range(struct gl_context *ctx, GLuint index,
 
    obj->BufferNames[index] = bufObj->Name;
 
+   /* Not worth tracking the writes for the index bounds cache. */
+   bufObj->MinMaxCacheDisabled = GL_TRUE;
+
    obj->Offset[index] = offset;
    obj->Size[index] = size;
 }
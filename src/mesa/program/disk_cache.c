@@ -0,0 +1,876 @@
+/*
+ * Copyright © 2012 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file disk_cache.c
+ * Persistent shader cache.
+ *
+ * An entry with key K is stored in <dir>/K[0]/K[1..19], with the key written
+ * in hex, so the 256 subdirectories each hold a slice of the cache.  The
+ * running total of the entry sizes is kept in <dir>/index, which every
+ * process maps and updates with atomic operations.  The total is only an
+ * estimate (entries replaced by another process can be counted twice), but
+ * it is good enough to keep the cache near its size limit.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main/imports.h"
+#include "main/macros.h"
+#include "main/version.h"
+#include "glapi/glthread.h"
+#include "disk_cache.h"
+
+
+/**
+ * \name SHA-1
+ *
+ * As described in FIPS 180-1.
+ */
+/*@{*/
+
+#define ROL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+static void
+sha1_transform(uint32_t state[5], const unsigned char block[64])
+{
+   uint32_t w[80];
+   uint32_t a, b, c, d, e;
+   unsigned i;
+
+   for (i = 0; i < 16; i++) {
+      w[i] = ((uint32_t) block[4 * i] << 24)
+	 | ((uint32_t) block[4 * i + 1] << 16)
+	 | ((uint32_t) block[4 * i + 2] << 8)
+	 | (uint32_t) block[4 * i + 3];
+   }
+
+   for (i = 16; i < 80; i++)
+      w[i] = ROL32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+   a = state[0];
+   b = state[1];
+   c = state[2];
+   d = state[3];
+   e = state[4];
+
+   for (i = 0; i < 80; i++) {
+      uint32_t f, k, t;
+
+      if (i < 20) {
+	 f = (b & c) | (~b & d);
+	 k = 0x5a827999;
+      } else if (i < 40) {
+	 f = b ^ c ^ d;
+	 k = 0x6ed9eba1;
+      } else if (i < 60) {
+	 f = (b & c) | (b & d) | (c & d);
+	 k = 0x8f1bbcdc;
+      } else {
+	 f = b ^ c ^ d;
+	 k = 0xca62c1d6;
+      }
+
+      t = ROL32(a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = ROL32(b, 30);
+      b = a;
+      a = t;
+   }
+
+   state[0] += a;
+   state[1] += b;
+   state[2] += c;
+   state[3] += d;
+   state[4] += e;
+}
+
+void
+_mesa_sha1_init(struct mesa_sha1 *sha1)
+{
+   sha1->state[0] = 0x67452301;
+   sha1->state[1] = 0xefcdab89;
+   sha1->state[2] = 0x98badcfe;
+   sha1->state[3] = 0x10325476;
+   sha1->state[4] = 0xc3d2e1f0;
+   sha1->count = 0;
+}
+
+void
+_mesa_sha1_update(struct mesa_sha1 *sha1, const void *data, size_t size)
+{
+   const unsigned char *p = (const unsigned char *) data;
+   unsigned used = sha1->count % 64;
+
+   sha1->count += size;
+
+   if (used) {
+      unsigned n = MIN2(64 - used, size);
+
+      memcpy(sha1->buffer + used, p, n);
+      p += n;
+      size -= n;
+
+      if (used + n < 64)
+	 return;
+
+      sha1_transform(sha1->state, sha1->buffer);
+   }
+
+   while (size >= 64) {
+      sha1_transform(sha1->state, p);
+      p += 64;
+      size -= 64;
+   }
+
+   memcpy(sha1->buffer, p, size);
+}
+
+void
+_mesa_sha1_final(struct mesa_sha1 *sha1,
+		 unsigned char result[DISK_CACHE_KEY_SIZE])
+{
+   static const unsigned char pad[64] = { 0x80 };
+   const uint64_t bits = sha1->count * 8;
+   unsigned char length[8];
+   unsigned used = sha1->count % 64;
+   unsigned i;
+
+   for (i = 0; i < 8; i++)
+      length[i] = (unsigned char) (bits >> (56 - 8 * i));
+
+   _mesa_sha1_update(sha1, pad, used < 56 ? 56 - used : 120 - used);
+   _mesa_sha1_update(sha1, length, sizeof(length));
+
+   for (i = 0; i < 5; i++) {
+      result[4 * i] = (unsigned char) (sha1->state[i] >> 24);
+      result[4 * i + 1] = (unsigned char) (sha1->state[i] >> 16);
+      result[4 * i + 2] = (unsigned char) (sha1->state[i] >> 8);
+      result[4 * i + 3] = (unsigned char) sha1->state[i];
+   }
+}
+
+/*@}*/
+
+
+#if defined(_WIN32) || !defined(__GLIBC__)
+/**
+ * Hash of the version string, the build ID where builds can't be told apart.
+ */
+static void
+version_build_id(unsigned char build_id[DISK_CACHE_KEY_SIZE])
+{
+   struct mesa_sha1 sha1;
+
+   _mesa_sha1_init(&sha1);
+   _mesa_sha1_update(&sha1, "Mesa " MESA_VERSION_STRING,
+		     sizeof("Mesa " MESA_VERSION_STRING));
+   _mesa_sha1_final(&sha1, build_id);
+}
+#endif
+
+
+#if defined(_WIN32)
+
+/* Not implemented; the shader cache is simply never available. */
+
+int
+_mesa_get_build_id(unsigned char build_id[DISK_CACHE_KEY_SIZE])
+{
+   version_build_id(build_id);
+   return 0;
+}
+
+struct disk_cache *
+_mesa_disk_cache_create(void)
+{
+   return NULL;
+}
+
+void
+_mesa_disk_cache_destroy(struct disk_cache *cache)
+{
+   (void) cache;
+}
+
+void *
+_mesa_disk_cache_get(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     size_t *size)
+{
+   (void) cache;
+   (void) key;
+   (void) size;
+   return NULL;
+}
+
+void
+_mesa_disk_cache_put(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     const void *data, size_t size)
+{
+   (void) cache;
+   (void) key;
+   (void) data;
+   (void) size;
+}
+
+void
+_mesa_disk_cache_hash_build_id(struct disk_cache *cache,
+			       struct mesa_sha1 *sha1)
+{
+   (void) cache;
+   (void) sha1;
+}
+
+#else
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <utime.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef __GLIBC__
+#include <link.h>
+#endif
+
+/** Default bound on the total size of the cache */
+#define DEFAULT_MAX_SIZE (1024ull * 1024 * 1024)
+
+/**
+ * Age in seconds after which a temporary file of _mesa_disk_cache_put() is
+ * assumed to be left over by a process which died before renaming it.
+ */
+#define STALE_TMP_FILE_AGE (10 * 60)
+
+struct disk_cache {
+   /** Cache directory, without a trailing slash */
+   char *path;
+
+   /** Approximate size of all entries, shared by all processes */
+   uint64_t *size;
+
+   uint64_t max_size;
+
+   /** Hash of the identity of the library this code was loaded from */
+   unsigned char build_id[DISK_CACHE_KEY_SIZE];
+};
+
+
+/**
+ * Create \c path and any missing parent directories.
+ */
+static int
+mkdir_with_parents(char *path)
+{
+   char *p;
+
+   for (p = path + 1; *p != '\0'; p++) {
+      if (*p != '/')
+	 continue;
+
+      *p = '\0';
+      if (mkdir(path, 0755) == -1 && errno != EEXIST) {
+	 *p = '/';
+	 return -1;
+      }
+      *p = '/';
+   }
+
+   if (mkdir(path, 0755) == -1 && errno != EEXIST)
+      return -1;
+
+   return 0;
+}
+
+static char *
+get_cache_dir(void)
+{
+   const char *dir = _mesa_getenv("MESA_GLSL_CACHE_DIR");
+   char *path;
+
+   if (dir != NULL)
+      return _mesa_strdup(dir);
+
+   dir = _mesa_getenv("XDG_CACHE_HOME");
+   if (dir != NULL) {
+      path = malloc(strlen(dir) + sizeof("/mesa"));
+      if (path != NULL)
+	 sprintf(path, "%s/mesa", dir);
+      return path;
+   }
+
+   dir = _mesa_getenv("HOME");
+   if (dir != NULL) {
+      path = malloc(strlen(dir) + sizeof("/.cache/mesa"));
+      if (path != NULL)
+	 sprintf(path, "%s/.cache/mesa", dir);
+      return path;
+   }
+
+   return NULL;
+}
+
+static uint64_t
+get_max_size(void)
+{
+   const char *str = _mesa_getenv("MESA_GLSL_CACHE_MAX_SIZE");
+   uint64_t size;
+   char *end;
+
+   if (str == NULL)
+      return DEFAULT_MAX_SIZE;
+
+   size = strtoull(str, &end, 10);
+   switch (*end) {
+   case 'G':
+   case 'g':
+      size *= 1024;
+      /* fallthrough */
+   case 'M':
+   case 'm':
+      size *= 1024;
+      /* fallthrough */
+   case 'K':
+   case 'k':
+      size *= 1024;
+      break;
+   }
+
+   return size != 0 ? size : DEFAULT_MAX_SIZE;
+}
+
+
+#ifdef __GLIBC__
+
+struct build_id_search {
+   const void *addr;
+   struct mesa_sha1 *sha1;
+   GLboolean found;
+};
+
+#define NOTE_ALIGN(x) (((x) + 3) & ~(size_t) 3)
+
+/**
+ * dl_iterate_phdr() callback which hashes the GNU build-id note of the
+ * object containing \c search->addr, or if it has none, the modification
+ * time and size of the object's file.
+ */
+static int
+hash_object_build_id(struct dl_phdr_info *info, size_t size, void *closure)
+{
+   struct build_id_search *search = (struct build_id_search *) closure;
+   const uintptr_t addr = (uintptr_t) search->addr;
+   GLboolean contains = GL_FALSE;
+   const char *path;
+   struct stat st;
+   unsigned i;
+
+   (void) size;
+
+   for (i = 0; i < info->dlpi_phnum; i++) {
+      const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+      const uintptr_t start = info->dlpi_addr + phdr->p_vaddr;
+
+      if (phdr->p_type == PT_LOAD &&
+	  addr >= start && addr < start + phdr->p_memsz)
+	 contains = GL_TRUE;
+   }
+
+   if (!contains)
+      return 0;
+
+   for (i = 0; i < info->dlpi_phnum; i++) {
+      const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+      const char *note, *end;
+
+      if (phdr->p_type != PT_NOTE)
+	 continue;
+
+      note = (const char *) (info->dlpi_addr + phdr->p_vaddr);
+      end = note + phdr->p_memsz;
+      while (note + sizeof(ElfW(Nhdr)) <= end) {
+	 const ElfW(Nhdr) *nhdr = (const ElfW(Nhdr) *) note;
+	 const char *name = note + sizeof(ElfW(Nhdr));
+	 const char *desc = name + NOTE_ALIGN(nhdr->n_namesz);
+
+	 if (nhdr->n_type == NT_GNU_BUILD_ID &&
+	     nhdr->n_namesz == sizeof("GNU") &&
+	     memcmp(name, "GNU", sizeof("GNU")) == 0 &&
+	     desc + nhdr->n_descsz <= end) {
+	    _mesa_sha1_update(search->sha1, desc, nhdr->n_descsz);
+	    search->found = GL_TRUE;
+	    return 1;
+	 }
+
+	 note = desc + NOTE_ALIGN(nhdr->n_descsz);
+      }
+   }
+
+   /* The main program has an empty name. */
+   path = info->dlpi_name[0] != '\0' ? info->dlpi_name : "/proc/self/exe";
+   if (stat(path, &st) == 0) {
+      _mesa_sha1_update(search->sha1, &st.st_mtime, sizeof(st.st_mtime));
+      _mesa_sha1_update(search->sha1, &st.st_size, sizeof(st.st_size));
+      search->found = GL_TRUE;
+   }
+
+   return 1;
+}
+
+#endif /* __GLIBC__ */
+
+/**
+ * Compute a hash which changes whenever the library containing the compiler
+ * is rebuilt, since entries made by a different build can't be trusted.
+ *
+ * \return GL_FALSE if there's no way to tell builds apart here.
+ */
+static GLboolean
+compute_build_id(unsigned char build_id[DISK_CACHE_KEY_SIZE])
+{
+#ifdef __GLIBC__
+   struct build_id_search search;
+   struct mesa_sha1 sha1;
+
+   _mesa_sha1_init(&sha1);
+   _mesa_sha1_update(&sha1, "Mesa " MESA_VERSION_STRING,
+		     sizeof("Mesa " MESA_VERSION_STRING));
+
+   search.addr = (const void *) compute_build_id;
+   search.sha1 = &sha1;
+   search.found = GL_FALSE;
+   dl_iterate_phdr(hash_object_build_id, &search);
+
+   _mesa_sha1_final(&sha1, build_id);
+   return search.found;
+#else
+   version_build_id(build_id);
+   return GL_FALSE;
+#endif
+}
+
+
+int
+_mesa_get_build_id(unsigned char build_id[DISK_CACHE_KEY_SIZE])
+{
+   _glthread_DECLARE_STATIC_MUTEX(mutex);
+   static unsigned char id[DISK_CACHE_KEY_SIZE];
+   static GLboolean found, computed;
+   GLboolean ret;
+
+   /* Searching the loaded objects is too slow to repeat at every link. */
+   _glthread_LOCK_MUTEX(mutex);
+   if (!computed) {
+      found = compute_build_id(id);
+      computed = GL_TRUE;
+   }
+   memcpy(build_id, id, sizeof(id));
+   ret = found;
+   _glthread_UNLOCK_MUTEX(mutex);
+
+   return ret;
+}
+
+
+struct disk_cache *
+_mesa_disk_cache_create(void)
+{
+   struct disk_cache *cache;
+   char *index_path;
+   struct stat st;
+   void *map;
+   int fd;
+
+   cache = calloc(1, sizeof(*cache));
+   if (cache == NULL)
+      return NULL;
+
+   if (!_mesa_get_build_id(cache->build_id))
+      goto fail;
+
+   cache->path = get_cache_dir();
+   if (cache->path == NULL || mkdir_with_parents(cache->path) == -1)
+      goto fail;
+
+   cache->max_size = get_max_size();
+
+   index_path = malloc(strlen(cache->path) + sizeof("/index"));
+   if (index_path == NULL)
+      goto fail;
+   sprintf(index_path, "%s/index", cache->path);
+
+   fd = open(index_path, O_RDWR | O_CREAT, 0644);
+   free(index_path);
+   if (fd == -1)
+      goto fail;
+
+   /* Whichever process gets here first sizes the file; the new bytes read
+    * as zero, which is the right initial total.
+    */
+   if (fstat(fd, &st) == -1
+       || (st.st_size < (off_t) sizeof(uint64_t)
+	   && ftruncate(fd, sizeof(uint64_t)) == -1)) {
+      close(fd);
+      goto fail;
+   }
+
+   map = mmap(NULL, sizeof(uint64_t), PROT_READ | PROT_WRITE, MAP_SHARED,
+	      fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+      goto fail;
+
+   cache->size = (uint64_t *) map;
+   return cache;
+
+fail:
+   free(cache->path);
+   free(cache);
+   return NULL;
+}
+
+void
+_mesa_disk_cache_destroy(struct disk_cache *cache)
+{
+   if (cache == NULL)
+      return;
+
+   munmap(cache->size, sizeof(uint64_t));
+   free(cache->path);
+   free(cache);
+}
+
+void
+_mesa_disk_cache_hash_build_id(struct disk_cache *cache,
+			       struct mesa_sha1 *sha1)
+{
+   _mesa_sha1_update(sha1, cache->build_id, sizeof(cache->build_id));
+}
+
+
+/**
+ * Add \c delta to the shared size total, clamping at zero.
+ */
+static uint64_t
+update_size(struct disk_cache *cache, int64_t delta)
+{
+   uint64_t old_size, new_size;
+
+   do {
+      old_size = *cache->size;
+      if (delta < 0 && (uint64_t) -delta > old_size)
+	 new_size = 0;
+      else
+	 new_size = old_size + delta;
+   } while (!__sync_bool_compare_and_swap(cache->size, old_size, new_size));
+
+   return new_size;
+}
+
+/**
+ * Build the path of the entry for \c key.
+ *
+ * \c path must have room for the cache path plus 44 characters.  The
+ * position of the slash after the subdirectory name is returned in
+ * \c dir_end, if non-NULL.
+ */
+static void
+get_entry_path(const struct disk_cache *cache,
+	       const unsigned char key[DISK_CACHE_KEY_SIZE],
+	       char *path, size_t *dir_end)
+{
+   static const char hex[] = "0123456789abcdef";
+   size_t len = strlen(cache->path);
+   unsigned i;
+
+   memcpy(path, cache->path, len);
+   path[len++] = '/';
+   path[len++] = hex[key[0] >> 4];
+   path[len++] = hex[key[0] & 0xf];
+
+   if (dir_end)
+      *dir_end = len;
+   path[len++] = '/';
+
+   for (i = 1; i < DISK_CACHE_KEY_SIZE; i++) {
+      path[len++] = hex[key[i] >> 4];
+      path[len++] = hex[key[i] & 0xf];
+   }
+   path[len] = '\0';
+}
+
+#define ENTRY_PATH_EXTRA (1 + 2 + 1 + 2 * (DISK_CACHE_KEY_SIZE - 1) + 1)
+
+
+void *
+_mesa_disk_cache_get(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     size_t *size)
+{
+   char *path;
+   struct stat st;
+   unsigned char *data = NULL;
+   size_t done;
+   int fd;
+
+   path = malloc(strlen(cache->path) + ENTRY_PATH_EXTRA);
+   if (path == NULL)
+      return NULL;
+   get_entry_path(cache, key, path, NULL);
+
+   fd = open(path, O_RDONLY);
+   if (fd == -1)
+      goto done;
+
+   if (fstat(fd, &st) == -1 || st.st_size == 0)
+      goto done;
+
+   data = malloc(st.st_size);
+   if (data == NULL)
+      goto done;
+
+   for (done = 0; done < (size_t) st.st_size; ) {
+      ssize_t ret = read(fd, data + done, st.st_size - done);
+      if (ret <= 0) {
+	 if (ret == -1 && errno == EINTR)
+	    continue;
+	 free(data);
+	 data = NULL;
+	 goto done;
+      }
+      done += ret;
+   }
+
+   *size = st.st_size;
+
+   /* Entries are evicted oldest modification time first, so bump it to
+    * mark the entry as recently used.
+    */
+   utime(path, NULL);
+
+done:
+   if (fd != -1)
+      close(fd);
+   free(path);
+   return data;
+}
+
+
+/**
+ * Remove the least recently used entry of the subdirectory \c dir.
+ *
+ * Temporary files are not entries, and aren't counted in the size total.
+ * Those old enough to have been left over by a process which died while
+ * storing an entry are removed along the way.
+ *
+ * \return \c GL_TRUE if an entry was removed.
+ */
+static GLboolean
+evict_lru_entry(struct disk_cache *cache, const char *dir)
+{
+   size_t dir_len = strlen(dir);
+   char *path, *lru_path = NULL;
+   time_t lru_time = 0;
+   off_t lru_size = 0;
+   struct dirent *entry;
+   time_t now = time(NULL);
+   DIR *d;
+
+   d = opendir(dir);
+   if (d == NULL)
+      return GL_FALSE;
+
+   path = malloc(dir_len + 1 + 256);
+   if (path == NULL) {
+      closedir(d);
+      return GL_FALSE;
+   }
+   memcpy(path, dir, dir_len);
+   path[dir_len] = '/';
+
+   while ((entry = readdir(d)) != NULL) {
+      struct stat st;
+
+      if (entry->d_name[0] == '.' || strlen(entry->d_name) > 255)
+	 continue;
+
+      strcpy(path + dir_len + 1, entry->d_name);
+      if (stat(path, &st) == -1 || !S_ISREG(st.st_mode))
+	 continue;
+
+      if (strchr(entry->d_name, '.') != NULL) {
+	 if (now - st.st_mtime > STALE_TMP_FILE_AGE)
+	    unlink(path);
+	 continue;
+      }
+
+      if (lru_path == NULL || st.st_mtime < lru_time) {
+	 free(lru_path);
+	 lru_path = _mesa_strdup(path);
+	 lru_time = st.st_mtime;
+	 lru_size = st.st_size;
+      }
+   }
+
+   closedir(d);
+   free(path);
+
+   if (lru_path == NULL)
+      return GL_FALSE;
+
+   if (unlink(lru_path) == 0)
+      update_size(cache, -(int64_t) lru_size);
+
+   free(lru_path);
+   return GL_TRUE;
+}
+
+/**
+ * Evict entries until the cache is below its size limit.
+ *
+ * Scanning the whole cache for the globally oldest entry would be too slow,
+ * so each step picks a random subdirectory and removes its oldest entry.
+ * With keys spread uniformly over the subdirectories this approximates LRU
+ * well.  The random numbers come from the key of the entry just stored,
+ * rather than rand(), which isn't thread-safe and belongs to the
+ * application.
+ */
+static void
+make_room(struct disk_cache *cache,
+	  const unsigned char key[DISK_CACHE_KEY_SIZE])
+{
+   size_t len = strlen(cache->path);
+   uint32_t random;
+   char *dir;
+
+   /* xorshift, seeded with key bits not used to pick the entry's own
+    * subdirectory.
+    */
+   random = key[DISK_CACHE_KEY_SIZE - 4] |
+	    key[DISK_CACHE_KEY_SIZE - 3] << 8 |
+	    key[DISK_CACHE_KEY_SIZE - 2] << 16 |
+	    (uint32_t) key[DISK_CACHE_KEY_SIZE - 1] << 24;
+   if (random == 0)
+      random = 1;
+
+   dir = malloc(len + 4);
+   if (dir == NULL)
+      return;
+   memcpy(dir, cache->path, len);
+   dir[len] = '/';
+
+   while (*cache->size > cache->max_size) {
+      unsigned start, i;
+
+      random ^= random << 13;
+      random ^= random >> 17;
+      random ^= random << 5;
+      start = random & 0xff;
+
+      for (i = 0; i < 256; i++) {
+	 sprintf(dir + len + 1, "%02x", (start + i) & 0xff);
+	 if (evict_lru_entry(cache, dir))
+	    break;
+      }
+
+      /* Nothing left to evict, so the total was off.  Start over. */
+      if (i == 256) {
+	 *cache->size = 0;
+	 break;
+      }
+   }
+
+   free(dir);
+}
+
+void
+_mesa_disk_cache_put(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     const void *data, size_t size)
+{
+   const unsigned char *p = (const unsigned char *) data;
+   char *path, *tmp_path;
+   size_t dir_end, done;
+   int fd;
+
+   path = malloc(strlen(cache->path) + ENTRY_PATH_EXTRA);
+   tmp_path = malloc(strlen(cache->path) + ENTRY_PATH_EXTRA + 32);
+   if (path == NULL || tmp_path == NULL)
+      goto done;
+   get_entry_path(cache, key, path, &dir_end);
+
+   /* Another process may have stored the same entry in the meantime. */
+   if (access(path, F_OK) == 0)
+      goto done;
+
+   path[dir_end] = '\0';
+   if (mkdir(path, 0755) == -1 && errno != EEXIST)
+      goto done;
+   path[dir_end] = '/';
+
+   /* Write to a uniquely named file and rename it into place, so that
+    * readers only ever see complete entries.  Other threads of this
+    * process may be storing the same entry at the same time.
+    */
+   sprintf(tmp_path, "%s.XXXXXX", path);
+   fd = mkstemp(tmp_path);
+   if (fd == -1)
+      goto done;
+   fchmod(fd, 0644);
+
+   for (done = 0; done < size; ) {
+      ssize_t ret = write(fd, p + done, size - done);
+      if (ret <= 0) {
+	 if (ret == -1 && errno == EINTR)
+	    continue;
+	 close(fd);
+	 unlink(tmp_path);
+	 goto done;
+      }
+      done += ret;
+   }
+
+   close(fd);
+
+   if (rename(tmp_path, path) == -1) {
+      unlink(tmp_path);
+      goto done;
+   }
+
+   if (update_size(cache, size) > cache->max_size)
+      make_room(cache, key);
+
+done:
+   free(tmp_path);
+   free(path);
+}
+
+#endif /* _WIN32 */
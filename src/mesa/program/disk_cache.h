@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2012 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file disk_cache.h
+ * \brief Persistent cache of compiled shaders, shared between processes.
+ *
+ * Entries are opaque blobs stored one per file under a cache directory and
+ * named by a SHA-1 key computed by the caller.  Files are written under a
+ * temporary name and renamed into place, so readers never see a partially
+ * written entry and any number of processes can use the same directory.
+ * The total size of the cache is bounded; when it grows past the limit the
+ * least recently used entries of a randomly chosen subdirectory are removed.
+ *
+ * The cache lives in \c $MESA_GLSL_CACHE_DIR, falling back to
+ * \c $XDG_CACHE_HOME/mesa and then \c $HOME/.cache/mesa.  Its size is
+ * bounded by \c $MESA_GLSL_CACHE_MAX_SIZE (a byte count with an optional
+ * K, M or G suffix), 1G by default.
+ */
+
+#ifndef DISK_CACHE_H
+#define DISK_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISK_CACHE_KEY_SIZE 20
+
+/**
+ * Incremental SHA-1 state, used to build cache keys.
+ */
+struct mesa_sha1 {
+   uint32_t state[5];
+   uint64_t count;
+   unsigned char buffer[64];
+};
+
+void
+_mesa_sha1_init(struct mesa_sha1 *sha1);
+
+void
+_mesa_sha1_update(struct mesa_sha1 *sha1, const void *data, size_t size);
+
+void
+_mesa_sha1_final(struct mesa_sha1 *sha1,
+		 unsigned char result[DISK_CACHE_KEY_SIZE]);
+
+
+/**
+ * Get a hash identifying this build of the library, from the version and
+ * the ELF build ID of the object containing the compiler.  Program binaries
+ * and cache entries are only valid for the build which made them.
+ *
+ * \return 0 if there is no ELF build ID, in which case the hash only tells
+ *         versions apart.
+ */
+int
+_mesa_get_build_id(unsigned char build_id[DISK_CACHE_KEY_SIZE]);
+
+
+struct disk_cache;
+
+/**
+ * Open the cache directory, creating it if needed.
+ *
+ * \return \c NULL if the cache is not available, in which case callers
+ *         simply do without it.
+ */
+struct disk_cache *
+_mesa_disk_cache_create(void);
+
+void
+_mesa_disk_cache_destroy(struct disk_cache *cache);
+
+/**
+ * Look up an entry.
+ *
+ * \return A \c malloc allocated copy of the entry, which the caller must
+ *         \c free, or \c NULL if there is no entry for \c key.
+ */
+void *
+_mesa_disk_cache_get(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     size_t *size);
+
+/**
+ * Store an entry, evicting old entries if the cache grows too large.
+ *
+ * Failures are silently ignored; the entry just won't be found later.
+ */
+void
+_mesa_disk_cache_put(struct disk_cache *cache,
+		     const unsigned char key[DISK_CACHE_KEY_SIZE],
+		     const void *data, size_t size);
+
+/**
+ * Add the identity of this build of the library to a cache key.
+ */
+void
+_mesa_disk_cache_hash_build_id(struct disk_cache *cache,
+			       struct mesa_sha1 *sha1);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISK_CACHE_H */
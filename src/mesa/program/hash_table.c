@@ -42,7 +42,8 @@ struct hash_table {
     hash_compare_func_t  compare;
 
     unsigned num_buckets;
-    struct node buckets[1];
+    unsigned num_entries;
+    struct node *buckets;
 };
 
 
@@ -50,6 +51,7 @@ struct hash_node {
     struct node link;
     const void *key;
     void *data;
+    unsigned hash_value;
 };
 
 
@@ -65,12 +67,18 @@ hash_table_ctor(unsigned num_buckets, hash_func_t hash,
         num_buckets = 16;
     }
 
-    ht = malloc(sizeof(*ht) + ((num_buckets - 1) 
-				     * sizeof(ht->buckets[0])));
+    ht = malloc(sizeof(*ht));
     if (ht != NULL) {
+        ht->buckets = malloc(num_buckets * sizeof(ht->buckets[0]));
+        if (ht->buckets == NULL) {
+            free(ht);
+            return NULL;
+        }
+
         ht->hash = hash;
         ht->compare = compare;
         ht->num_buckets = num_buckets;
+        ht->num_entries = 0;
 
         for (i = 0; i < num_buckets; i++) {
             make_empty_list(& ht->buckets[i]);
@@ -85,6 +93,7 @@ void
 hash_table_dtor(struct hash_table *ht)
 {
    hash_table_clear(ht);
+   free(ht->buckets);
    free(ht);
 }
 
@@ -105,6 +114,50 @@ hash_table_clear(struct hash_table *ht)
 
       assert(is_empty_list(& ht->buckets[i]));
    }
+
+   ht->num_entries = 0;
+}
+
+
+/**
+ * Rehash all the entries into about twice as many buckets.
+ *
+ * Called once there are on average more than two entries per bucket, so
+ * that lookups stay cheap however many entries the table ends up with.
+ * The relative order of entries with the same key is preserved, so the
+ * most recently inserted one is still found first.
+ */
+static void
+grow(struct hash_table *ht)
+{
+   const unsigned num_buckets = ht->num_buckets * 2 + 1;
+   struct node *buckets;
+   unsigned i;
+
+
+   buckets = malloc(num_buckets * sizeof(buckets[0]));
+   if (buckets == NULL) {
+      /* Keep going with longer chains. */
+      return;
+   }
+
+   for (i = 0; i < num_buckets; i++) {
+      make_empty_list(& buckets[i]);
+   }
+
+   for (i = 0; i < ht->num_buckets; i++) {
+      while (!is_empty_list(& ht->buckets[i])) {
+	 struct node *node = last_elem(& ht->buckets[i]);
+	 struct hash_node *hn = (struct hash_node *) node;
+
+	 remove_from_list(node);
+	 insert_at_head(& buckets[hn->hash_value % num_buckets], node);
+      }
+   }
+
+   free(ht->buckets);
+   ht->buckets = buckets;
+   ht->num_buckets = num_buckets;
 }
 
 
@@ -145,8 +198,12 @@ hash_table_insert(struct hash_table *ht, void *data, const void *key)
 
     node->data = data;
     node->key = key;
+    node->hash_value = hash_value;
 
     insert_at_head(& ht->buckets[bucket], & node->link);
+
+    if (++ht->num_entries > 2 * ht->num_buckets)
+       grow(ht);
 }
 
 void
@@ -170,8 +227,12 @@ hash_table_replace(struct hash_table *ht, void *data, const void *key)
 
     hn->data = data;
     hn->key = key;
+    hn->hash_value = hash_value;
 
     insert_at_head(& ht->buckets[bucket], & hn->link);
+
+    if (++ht->num_entries > 2 * ht->num_buckets)
+       grow(ht);
 }
 
 void
@@ -181,6 +242,7 @@ hash_table_remove(struct hash_table *ht, const void *key)
    if (node != NULL) {
       remove_from_list(node);
       free(node);
+      ht->num_entries--;
       return;
    }
 }
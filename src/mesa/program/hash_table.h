@@ -55,7 +55,8 @@ typedef int (*hash_compare_func_t)(const void *key1, const void *key2);
  * \c hash and \c compare routines are used when adding elements to the table
  * and when searching for elements in the table.
  *
- * \param num_buckets  Number of buckets (bins) in the hash table.
+ * \param num_buckets  Initial number of buckets (bins) in the hash table.
+ *                     The table grows as entries are added.
  * \param hash         Function used to compute hash value of input keys.
  * \param compare      Function used to compare keys.
  */
@@ -193,6 +194,11 @@ string_to_uint_map_dtor(struct string_to_uint_map *);
 #ifdef __cplusplus
 }
 
+struct string_map_iterate_wrapper_closure {
+   void (*callback)(const char *key, unsigned value, void *closure);
+   void *closure;
+};
+
 /**
  * Map from a string (name) to an unsigned integer value
  *
@@ -263,7 +269,32 @@ public:
 			 strdup(key));
    }
 
+   /**
+    * Call \c func for each mapping in the map, in no particular order
+    */
+   void iterate(void (*func)(const char *, unsigned, void *), void *closure)
+   {
+      struct string_map_iterate_wrapper_closure wrapper = {
+	 func,
+	 closure
+      };
+
+      hash_table_call_foreach(this->ht, subtract_one_wrapper, &wrapper);
+   }
+
 private:
+   static void subtract_one_wrapper(const void *key, void *data,
+				    void *closure)
+   {
+      struct string_map_iterate_wrapper_closure *wrapper =
+	 (struct string_map_iterate_wrapper_closure *) closure;
+      unsigned value = (intptr_t) data;
+
+      value -= 1;
+
+      wrapper->callback((const char *) key, value, wrapper->closure);
+   }
+
    static void delete_key(const void *key, void *data, void *closure)
    {
       (void) data;
@@ -45,6 +45,7 @@
 
 #include "main/mtypes.h"
 #include "main/shaderobj.h"
+#include "program/disk_cache.h"
 #include "program/hash_table.h"
 
 extern "C" {
@@ -3128,14 +3129,16 @@ _mesa_ir_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
 
 
 /**
- * Compile a GLSL shader.  Called via glCompileShader().
+ * Run the compiler on a shader's source.
  */
-void
-_mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader)
+static void
+compile_shader(struct gl_context *ctx, struct gl_shader *shader)
 {
    struct _mesa_glsl_parse_state *state =
       new(shader) _mesa_glsl_parse_state(ctx, shader->Type, shader);
 
+   shader->CompileDeferred = GL_FALSE;
+
    const char *source = shader->Source;
    /* Check if the user called glCompileShader without first calling
     * glShaderSource.  This should fail to compile, but not raise a GL_ERROR.
@@ -3171,8 +3174,7 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader)
       /* Do some optimization at compile time to reduce shader IR size
        * and reduce later work if the same shader is linked multiple times
        */
-      while (do_common_optimization(shader->ir, false, false, 32))
-	 ;
+      do_common_optimization_loop(shader->ir, false, false, 32);
 
       validate_ir_tree(shader->ir);
    }
@@ -3212,28 +3214,290 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader)
 
 
 /**
- * Link a GLSL shader program.  Called via glLinkProgram().
+ * \name On-disk shader cache
+ *
+ * A compile is cached as a small record of its outcome, so a cache hit skips
+ * the compiler entirely and the IR is only generated if it turns out to be
+ * needed.  A link is cached as a program binary, so a cache hit skips both
+ * the compiler and the linker.  The driver's own code generation in
+ * \c Driver.LinkShader still runs either way.
  */
-void
-_mesa_glsl_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
+/*@{*/
+
+/**
+ * Header of a cached compile, followed by the info log
+ */
+struct compile_record {
+   uint32_t version;
+   uint32_t info_log_length;
+};
+
+/**
+ * Hash everything besides the shader sources that can change the IR produced
+ * by the compiler and the linker.
+ */
+static void
+hash_compiler_state(struct gl_context *ctx, struct mesa_sha1 *sha1)
 {
-   unsigned int i;
+   const unsigned last_opcode = ir_last_opcode;
+
+   _mesa_disk_cache_hash_build_id(ctx->Shader.DiskCache, sha1);
+   _mesa_sha1_update(sha1, &last_opcode, sizeof(last_opcode));
+   _mesa_sha1_update(sha1, &ctx->API, sizeof(ctx->API));
+   _mesa_sha1_update(sha1, &ctx->Extensions,
+		     offsetof(struct gl_extensions, String));
+   _mesa_sha1_update(sha1, &ctx->Const, sizeof(ctx->Const));
+   _mesa_sha1_update(sha1, ctx->ShaderCompilerOptions,
+		     sizeof(ctx->ShaderCompilerOptions));
+   _mesa_sha1_update(sha1, &ctx->Shader.Flags, sizeof(ctx->Shader.Flags));
+}
 
-   _mesa_clear_shader_program_data(ctx, prog);
+static void
+hash_shader_source(struct mesa_sha1 *sha1, const struct gl_shader *shader)
+{
+   _mesa_sha1_update(sha1, &shader->Type, sizeof(shader->Type));
+   _mesa_sha1_update(sha1, shader->Source, strlen(shader->Source) + 1);
+}
 
-   prog->LinkStatus = GL_TRUE;
+static void
+compute_shader_key(struct gl_context *ctx, const struct gl_shader *shader,
+		   unsigned char *key)
+{
+   struct mesa_sha1 sha1;
 
-   for (i = 0; i < prog->NumShaders; i++) {
-      if (!prog->Shaders[i]->CompileStatus) {
-	 linker_error(prog, "linking with uncompiled shader");
-	 prog->LinkStatus = GL_FALSE;
-      }
+   _mesa_sha1_init(&sha1);
+   _mesa_sha1_update(&sha1, "compile", sizeof("compile"));
+   hash_compiler_state(ctx, &sha1);
+   hash_shader_source(&sha1, shader);
+   _mesa_sha1_final(&sha1, key);
+}
+
+static void
+xor_binding_hash(const char *name, unsigned value, void *closure)
+{
+   unsigned char *accum = (unsigned char *) closure;
+   unsigned char hash[DISK_CACHE_KEY_SIZE];
+   struct mesa_sha1 sha1;
+
+   _mesa_sha1_init(&sha1);
+   _mesa_sha1_update(&sha1, name, strlen(name) + 1);
+   _mesa_sha1_update(&sha1, &value, sizeof(value));
+   _mesa_sha1_final(&sha1, hash);
+
+   for (unsigned i = 0; i < DISK_CACHE_KEY_SIZE; i++)
+      accum[i] ^= hash[i];
+}
+
+/**
+ * Hash a set of name bindings independently of the order the map keeps them
+ * in.
+ */
+static void
+hash_bindings(struct mesa_sha1 *sha1, struct string_to_uint_map *map)
+{
+   unsigned char accum[DISK_CACHE_KEY_SIZE];
+
+   memset(accum, 0, sizeof(accum));
+   if (map != NULL)
+      map->iterate(xor_binding_hash, accum);
+
+   _mesa_sha1_update(sha1, accum, sizeof(accum));
+}
+
+static void
+compute_program_key(struct gl_context *ctx, struct gl_shader_program *prog,
+		    unsigned char *key)
+{
+   struct mesa_sha1 sha1;
+
+   _mesa_sha1_init(&sha1);
+   _mesa_sha1_update(&sha1, "link", sizeof("link"));
+   hash_compiler_state(ctx, &sha1);
+
+   _mesa_sha1_update(&sha1, &prog->NumShaders, sizeof(prog->NumShaders));
+   for (unsigned i = 0; i < prog->NumShaders; i++)
+      hash_shader_source(&sha1, prog->Shaders[i]);
+
+   hash_bindings(&sha1, prog->AttributeBindings);
+   hash_bindings(&sha1, prog->FragDataBindings);
+   hash_bindings(&sha1, prog->FragDataIndexBindings);
+
+   _mesa_sha1_update(&sha1, &prog->TransformFeedback.BufferMode,
+		     sizeof(prog->TransformFeedback.BufferMode));
+   _mesa_sha1_update(&sha1, &prog->TransformFeedback.NumVarying,
+		     sizeof(prog->TransformFeedback.NumVarying));
+   for (unsigned i = 0; i < prog->TransformFeedback.NumVarying; i++) {
+      const char *name = prog->TransformFeedback.VaryingNames[i];
+      _mesa_sha1_update(&sha1, name, strlen(name) + 1);
+   }
+
+   _mesa_sha1_update(&sha1, &prog->Geom, sizeof(prog->Geom));
+   _mesa_sha1_update(&sha1, &prog->InternalSeparateShader,
+		     sizeof(prog->InternalSeparateShader));
+
+   _mesa_sha1_final(&sha1, key);
+}
+
+/**
+ * Mark a shader as compiled using a cached compile record.
+ *
+ * \return \c true if the record was usable.
+ */
+static bool
+load_cached_compile(struct gl_context *ctx, struct gl_shader *shader,
+		    const unsigned char *key)
+{
+   size_t size;
+   struct compile_record *record = (struct compile_record *)
+      _mesa_disk_cache_get(ctx->Shader.DiskCache, key, &size);
+
+   if (record == NULL)
+      return false;
+
+   if (size < sizeof(*record)
+       || size - sizeof(*record) != record->info_log_length) {
+      free(record);
+      return false;
    }
 
+   ralloc_free(shader->ir);
+   shader->ir = NULL;
+   shader->num_builtins_to_link = 0;
+
+   shader->CompileStatus = GL_TRUE;
+   shader->CompileDeferred = GL_TRUE;
+   shader->Version = record->version;
+   shader->InfoLog = ralloc_strndup(shader, (const char *) (record + 1),
+				    record->info_log_length);
+
+   free(record);
+   return true;
+}
+
+static void
+store_compile_record(struct gl_context *ctx, struct gl_shader *shader,
+		     const unsigned char *key)
+{
+   const size_t log_length = shader->InfoLog ? strlen(shader->InfoLog) : 0;
+   const size_t size = sizeof(struct compile_record) + log_length;
+   struct compile_record *record = (struct compile_record *) malloc(size);
+
+   if (record == NULL)
+      return;
+
+   record->version = shader->Version;
+   record->info_log_length = log_length;
+   memcpy(record + 1, shader->InfoLog, log_length);
+
+   _mesa_disk_cache_put(ctx->Shader.DiskCache, key, record, size);
+   free(record);
+}
+
+/**
+ * Serialize a linked program, keyed with the build ID of this library.
+ */
+static void *
+serialize_linked_program(struct gl_shader_program *prog, unsigned *size)
+{
+   unsigned char build_id[DISK_CACHE_KEY_SIZE];
+
+   STATIC_ASSERT(PROGRAM_BINARY_BUILD_ID_SIZE == DISK_CACHE_KEY_SIZE);
+   _mesa_get_build_id(build_id);
+   return serialize_program(prog, prog, build_id, size);
+}
+
+/**
+ * Load a program binary made by serialize_linked_program().
+ */
+static void
+deserialize_linked_program(struct gl_context *ctx,
+			   struct gl_shader_program *prog,
+			   const void *binary, unsigned size)
+{
+   unsigned char build_id[DISK_CACHE_KEY_SIZE];
+
+   _mesa_get_build_id(build_id);
+   deserialize_program(ctx, prog, build_id, binary, size);
+}
+
+/**
+ * Keep a copy of a program binary for glGetProgramBinary.
+ */
+static void
+keep_program_binary(struct gl_shader_program *prog, const void *binary,
+		    unsigned size)
+{
+   prog->Binary = (GLubyte *) ralloc_size(prog, size);
+   memcpy(prog->Binary, binary, size);
+   prog->BinarySize = size;
+}
+
+/**
+ * Load a program from a cached program binary.
+ *
+ * \return \c true on success.  Otherwise \c prog is reset so that it can be
+ *         linked from source.
+ */
+static bool
+load_cached_program(struct gl_context *ctx, struct gl_shader_program *prog,
+		    const unsigned char *key)
+{
+   size_t size;
+   void *binary = _mesa_disk_cache_get(ctx->Shader.DiskCache, key, &size);
+
+   if (binary == NULL)
+      return false;
+
+   deserialize_linked_program(ctx, prog, binary, size);
+
    if (prog->LinkStatus) {
-      link_shaders(ctx, prog);
+      if (prog->BinaryRetrievableHint)
+	 keep_program_binary(prog, binary, size);
+   } else {
+      _mesa_clear_shader_program_data(ctx, prog);
+      prog->LinkStatus = GL_TRUE;
+   }
+
+   free(binary);
+   return prog->LinkStatus;
+}
+
+/*@}*/
+
+
+/**
+ * Compile a GLSL shader.  Called via glCompileShader().
+ */
+void
+_mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader)
+{
+   const bool use_cache =
+      ctx->Shader.DiskCache != NULL && shader->Source != NULL;
+   unsigned char key[DISK_CACHE_KEY_SIZE];
+
+   if (use_cache) {
+      compute_shader_key(ctx, shader, key);
+      if (load_cached_compile(ctx, shader, key))
+	 return;
    }
 
+   compile_shader(ctx, shader);
+
+   /* Only successful compiles are cached, since those are the only ones
+    * whose IR may never be needed.
+    */
+   if (use_cache && shader->CompileStatus)
+      store_compile_record(ctx, shader, key);
+}
+
+
+/**
+ * Hand a program that went through \c link_shaders, or was loaded from a
+ * binary, to the driver.
+ */
+static void
+link_program_in_driver(struct gl_context *ctx, struct gl_shader_program *prog)
+{
    if (prog->LinkStatus) {
       if (!ctx->Driver.LinkShader(ctx, prog)) {
 	 prog->LinkStatus = GL_FALSE;
@@ -3254,6 +3518,113 @@ _mesa_glsl_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
 	 printf("%s\n", prog->InfoLog);
       }
    }
+
+   /* The driver has generated its code, so the function bodies are dead
+    * weight from here on.
+    */
+   if (prog->LinkStatus && ctx->Const.CompactLinkedIR) {
+      for (unsigned i = 0; i < MESA_SHADER_TYPES; i++) {
+	 if (prog->_LinkedShaders[i] != NULL)
+	    compact_linked_ir(prog->_LinkedShaders[i]);
+      }
+   }
+}
+
+
+/**
+ * Link a GLSL shader program.  Called via glLinkProgram().
+ */
+void
+_mesa_glsl_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
+{
+   bool use_cache = ctx->Shader.DiskCache != NULL;
+   unsigned char key[DISK_CACHE_KEY_SIZE];
+   unsigned int i;
+
+   _mesa_clear_shader_program_data(ctx, prog);
+
+   prog->LinkStatus = GL_TRUE;
+
+   for (i = 0; i < prog->NumShaders; i++) {
+      if (!prog->Shaders[i]->CompileStatus) {
+	 linker_error(prog, "linking with uncompiled shader");
+	 prog->LinkStatus = GL_FALSE;
+      }
+
+      /* Shaders built internally, such as the fixed-function fragment
+       * shader, have no source to key the cache with.
+       */
+      if (prog->Shaders[i]->Source == NULL)
+	 use_cache = false;
+   }
+
+   if (prog->LinkStatus && use_cache) {
+      compute_program_key(ctx, prog, key);
+      if (load_cached_program(ctx, prog, key)) {
+	 link_program_in_driver(ctx, prog);
+	 return;
+      }
+   }
+
+   /* Generate the IR of any shader whose compile came from the cache. */
+   for (i = 0; prog->LinkStatus && i < prog->NumShaders; i++) {
+      struct gl_shader *sh = prog->Shaders[i];
+
+      if (sh->CompileDeferred) {
+	 compile_shader(ctx, sh);
+	 if (!sh->CompileStatus) {
+	    linker_error(prog, "linking with uncompiled shader");
+	    prog->LinkStatus = GL_FALSE;
+	 }
+      }
+   }
+
+   if (prog->LinkStatus) {
+      link_shaders(ctx, prog);
+   }
+
+   /* Serialize the linked program for the disk cache, and keep a copy for
+    * glGetProgramBinary if the application asked for one with
+    * GL_PROGRAM_BINARY_RETRIEVABLE_HINT.  This has to happen before the
+    * driver gets its hands on the IR.
+    */
+   if (prog->LinkStatus && (use_cache || prog->BinaryRetrievableHint)) {
+      unsigned size;
+      void *binary = serialize_linked_program(prog, &size);
+
+      if (binary != NULL) {
+	 if (use_cache)
+	    _mesa_disk_cache_put(ctx->Shader.DiskCache, key, binary, size);
+
+	 if (prog->BinaryRetrievableHint) {
+	    prog->Binary = (GLubyte *) binary;
+	    prog->BinarySize = size;
+	 } else {
+	    ralloc_free(binary);
+	 }
+      }
+   }
+
+   link_program_in_driver(ctx, prog);
+}
+
+
+/**
+ * Load a GLSL shader program from a binary.  Called via glProgramBinary().
+ */
+void
+_mesa_glsl_load_program_binary(struct gl_context *ctx,
+			       struct gl_shader_program *prog,
+			       const GLvoid *binary, GLsizei length)
+{
+   _mesa_clear_shader_program_data(ctx, prog);
+
+   deserialize_linked_program(ctx, prog, binary, length);
+
+   if (prog->LinkStatus && prog->BinaryRetrievableHint)
+      keep_program_binary(prog, binary, length);
+
+   link_program_in_driver(ctx, prog);
 }
 
 } /* extern "C" */
@@ -68,19 +68,29 @@
  * up front and stored in a 2-dimensional array, so that the cost of
  * coloring a node is constant with the number of registers.  We do
  * this during ra_set_finalize().
+ *
+ * It also means that the left-hand side of the test can be kept up to
+ * date incrementally: each node carries the sum of q(B,C) over the
+ * neighbors still in the graph, and pushing a node on the stack only
+ * subtracts its contribution from its neighbors.  Simplification then
+ * just works through a set of nodes known to pass the test, instead
+ * of rescanning the whole graph until nothing changes.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <ralloc.h>
 
 #include "main/imports.h"
 #include "main/macros.h"
 #include "main/mtypes.h"
+#include "main/bitset.h"
 #include "register_allocate.h"
 
 #define NO_REG ~0
 
 struct ra_reg {
-   GLboolean *conflicts;
+   BITSET_WORD *conflicts;
    unsigned int *conflict_list;
    unsigned int conflict_list_size;
    unsigned int num_conflicts;
@@ -95,7 +105,7 @@ struct ra_regs {
 };
 
 struct ra_class {
-   GLboolean *regs;
+   BITSET_WORD *regs;
 
    /**
     * p(B) in Runeson/Nyström paper.
@@ -118,8 +128,9 @@ struct ra_node {
     * List of which nodes this node interferes with.  This should be
     * symmetric with the other node.
     */
-   GLboolean *adjacency;
+   BITSET_WORD *adjacency;
    unsigned int *adjacency_list;
+   unsigned int adjacency_list_size;
    unsigned int adjacency_count;
    /** @} */
 
@@ -136,6 +147,13 @@ struct ra_node {
     */
    GLboolean in_stack;
 
+   /**
+    * Sum of q(B,C) over the neighbors that are not in the stack, where
+    * B is the class of this node and C the class of the neighbor.
+    * Only valid during ra_simplify().
+    */
+   unsigned int q_total;
+
    /* For an implementation that needs register spilling, this is the
     * approximate cost of spilling this node.
     */
@@ -171,8 +189,9 @@ ra_alloc_reg_set(void *mem_ctx, unsigned int count)
    regs->regs = rzalloc_array(regs, struct ra_reg, count);
 
    for (i = 0; i < count; i++) {
-      regs->regs[i].conflicts = rzalloc_array(regs->regs, GLboolean, count);
-      regs->regs[i].conflicts[i] = GL_TRUE;
+      regs->regs[i].conflicts = rzalloc_array(regs->regs, BITSET_WORD,
+					      BITSET_WORDS(count));
+      BITSET_SET(regs->regs[i].conflicts, i);
 
       regs->regs[i].conflict_list = ralloc_array(regs->regs, unsigned int, 4);
       regs->regs[i].conflict_list_size = 4;
@@ -194,13 +213,13 @@ ra_add_conflict_list(struct ra_regs *regs, unsigned int r1, unsigned int r2)
 				     unsigned int, reg1->conflict_list_size);
    }
    reg1->conflict_list[reg1->num_conflicts++] = r2;
-   reg1->conflicts[r2] = GL_TRUE;
+   BITSET_SET(reg1->conflicts, r2);
 }
 
 void
 ra_add_reg_conflict(struct ra_regs *regs, unsigned int r1, unsigned int r2)
 {
-   if (!regs->regs[r1].conflicts[r2]) {
+   if (!BITSET_TEST(regs->regs[r1].conflicts, r2)) {
       ra_add_conflict_list(regs, r1, r2);
       ra_add_conflict_list(regs, r2, r1);
    }
@@ -238,7 +257,7 @@ ra_alloc_reg_class(struct ra_regs *regs)
    class = rzalloc(regs, struct ra_class);
    regs->classes[regs->class_count] = class;
 
-   class->regs = rzalloc_array(class, GLboolean, regs->count);
+   class->regs = rzalloc_array(class, BITSET_WORD, BITSET_WORDS(regs->count));
 
    return regs->class_count++;
 }
@@ -248,7 +267,7 @@ ra_class_add_reg(struct ra_regs *regs, unsigned int c, unsigned int r)
 {
    struct ra_class *class = regs->classes[c];
 
-   class->regs[r] = GL_TRUE;
+   BITSET_SET(class->regs, r);
    class->p++;
 }
 
@@ -277,12 +296,12 @@ ra_set_finalize(struct ra_regs *regs)
 	    int conflicts = 0;
 	    int i;
 
-	    if (!regs->classes[c]->regs[rc])
+	    if (!BITSET_TEST(regs->classes[c]->regs, rc))
 	       continue;
 
 	    for (i = 0; i < regs->regs[rc].num_conflicts; i++) {
 	       unsigned int rb = regs->regs[rc].conflict_list[i];
-	       if (regs->classes[b]->regs[rb])
+	       if (BITSET_TEST(regs->classes[b]->regs, rb))
 		  conflicts++;
 	    }
 	    max_conflicts = MAX2(max_conflicts, conflicts);
@@ -295,9 +314,16 @@ ra_set_finalize(struct ra_regs *regs)
 static void
 ra_add_node_adjacency(struct ra_graph *g, unsigned int n1, unsigned int n2)
 {
-   g->nodes[n1].adjacency[n2] = GL_TRUE;
-   g->nodes[n1].adjacency_list[g->nodes[n1].adjacency_count] = n2;
-   g->nodes[n1].adjacency_count++;
+   struct ra_node *node = &g->nodes[n1];
+
+   if (node->adjacency_count == node->adjacency_list_size) {
+      node->adjacency_list_size *= 2;
+      node->adjacency_list = reralloc(g, node->adjacency_list,
+				      unsigned int, node->adjacency_list_size);
+   }
+
+   BITSET_SET(node->adjacency, n2);
+   node->adjacency_list[node->adjacency_count++] = n2;
 }
 
 struct ra_graph *
@@ -314,10 +340,17 @@ ra_alloc_interference_graph(struct ra_regs *regs, unsigned int count)
    g->stack = rzalloc_array(g, unsigned int, count);
 
    for (i = 0; i < count; i++) {
-      g->nodes[i].adjacency = rzalloc_array(g, GLboolean, count);
-      g->nodes[i].adjacency_list = ralloc_array(g, unsigned int, count);
+      g->nodes[i].adjacency = rzalloc_array(g, BITSET_WORD,
+					    BITSET_WORDS(count));
+      /* A node never interferes with itself.  It is marked in the bitset
+       * so that ra_add_node_interference() ignores it, but kept out of
+       * the list.
+       */
+      BITSET_SET(g->nodes[i].adjacency, i);
+
+      g->nodes[i].adjacency_list = ralloc_array(g, unsigned int, 4);
+      g->nodes[i].adjacency_list_size = 4;
       g->nodes[i].adjacency_count = 0;
-      ra_add_node_adjacency(g, i, i);
       g->nodes[i].reg = NO_REG;
    }
 
@@ -335,7 +368,7 @@ void
 ra_add_node_interference(struct ra_graph *g,
 			 unsigned int n1, unsigned int n2)
 {
-   if (!g->nodes[n1].adjacency[n2]) {
+   if (!BITSET_TEST(g->nodes[n1].adjacency, n2)) {
       ra_add_node_adjacency(g, n1, n2);
       ra_add_node_adjacency(g, n2, n1);
    }
@@ -343,20 +376,34 @@ ra_add_node_interference(struct ra_graph *g,
 
 static GLboolean pq_test(struct ra_graph *g, unsigned int n)
 {
-   unsigned int j;
-   unsigned int q = 0;
    int n_class = g->nodes[n].class;
 
-   for (j = 0; j < g->nodes[n].adjacency_count; j++) {
-      unsigned int n2 = g->nodes[n].adjacency_list[j];
-      unsigned int n2_class = g->nodes[n2].class;
+   return g->nodes[n].q_total < g->regs->classes[n_class]->p;
+}
 
-      if (n != n2 && !g->nodes[n2].in_stack) {
-	 q += g->regs->classes[n_class]->q[n2_class];
-      }
+/**
+ * Returns the highest set bit of the set below \p n, or -1 if there is
+ * none.
+ */
+static int
+ra_prev_set_bit(const BITSET_WORD *set, unsigned int n)
+{
+   int w;
+   BITSET_WORD word;
+
+   if (n == 0)
+      return -1;
+   n--;
+
+   w = BITSET_BITWORD(n);
+   word = set[w] & BITSET_MASK(n % BITSET_WORDBITS + 1);
+   while (word == 0) {
+      if (--w < 0)
+	 return -1;
+      word = set[w];
    }
 
-   return q < g->regs->classes[n_class]->p;
+   return w * BITSET_WORDBITS + _mesa_logbase2(word);
 }
 
 /**
@@ -371,31 +418,68 @@ static GLboolean pq_test(struct ra_graph *g, unsigned int n)
 GLboolean
 ra_simplify(struct ra_graph *g)
 {
+   struct ra_class **classes = g->regs->classes;
+   BITSET_WORD *colorable;
    GLboolean progress = GL_TRUE;
-   int i;
+   unsigned int i, j;
+   int n;
+
+   /* The set of nodes still in the graph that pass the pq test.  Since
+    * removing nodes only ever lowers q_total, a node stays in the set
+    * until it is pushed.
+    */
+   colorable = rzalloc_array(g, BITSET_WORD, BITSET_WORDS(g->count));
+
+   for (i = 0; i < g->count; i++) {
+      struct ra_node *node = &g->nodes[i];
+      unsigned int *q = classes[node->class]->q;
 
+      node->q_total = 0;
+      for (j = 0; j < node->adjacency_count; j++) {
+	 unsigned int n2 = node->adjacency_list[j];
+
+	 if (!g->nodes[n2].in_stack)
+	    node->q_total += q[g->nodes[n2].class];
+      }
+
+      if (!node->in_stack && node->reg == NO_REG && pq_test(g, i))
+	 BITSET_SET(colorable, i);
+   }
+
+   /* Push the nodes in the same order as repeatedly walking all of them
+    * from the last to the first would: each pass takes the colorable
+    * nodes below the current position, including the ones that became
+    * colorable during the pass, and leaves the rest for the next pass.
+    */
    while (progress) {
       progress = GL_FALSE;
 
-      for (i = g->count - 1; i >= 0; i--) {
-	 if (g->nodes[i].in_stack || g->nodes[i].reg != NO_REG)
-	    continue;
+      for (n = ra_prev_set_bit(colorable, g->count); n >= 0;
+	   n = ra_prev_set_bit(colorable, n)) {
+	 struct ra_node *node = &g->nodes[n];
+
+	 BITSET_CLEAR(colorable, n);
+	 g->stack[g->stack_count] = n;
+	 g->stack_count++;
+	 node->in_stack = GL_TRUE;
+	 progress = GL_TRUE;
+
+	 for (j = 0; j < node->adjacency_count; j++) {
+	    unsigned int n2 = node->adjacency_list[j];
+	    struct ra_node *node2 = &g->nodes[n2];
 
-	 if (pq_test(g, i)) {
-	    g->stack[g->stack_count] = i;
-	    g->stack_count++;
-	    g->nodes[i].in_stack = GL_TRUE;
-	    progress = GL_TRUE;
+	    node2->q_total -= classes[node2->class]->q[node->class];
+
+	    if (!node2->in_stack && node2->reg == NO_REG &&
+		!BITSET_TEST(colorable, n2) && pq_test(g, n2))
+	       BITSET_SET(colorable, n2);
 	 }
       }
    }
 
-   for (i = 0; i < g->count; i++) {
-      if (!g->nodes[i].in_stack)
-	 return GL_FALSE;
-   }
+   ralloc_free(colorable);
 
-   return GL_TRUE;
+   return g->stack_count == g->count;
 }
 
 /**
@@ -408,40 +492,57 @@ ra_simplify(struct ra_graph *g)
 GLboolean
 ra_select(struct ra_graph *g)
 {
+   unsigned int words = BITSET_WORDS(g->regs->count);
+   BITSET_WORD *used;
    int i;
 
+   /* Registers conflicting with the ones assigned to the current node's
+    * neighbors.
+    */
+   used = ralloc_array(g, BITSET_WORD, words);
+
    while (g->stack_count != 0) {
-      unsigned int r;
+      unsigned int r, w;
       int n = g->stack[g->stack_count - 1];
       struct ra_class *c = g->regs->classes[g->nodes[n].class];
 
+      memset(used, 0, words * sizeof(BITSET_WORD));
+
+      for (i = 0; i < g->nodes[n].adjacency_count; i++) {
+	 unsigned int n2 = g->nodes[n].adjacency_list[i];
+	 struct ra_reg *reg;
+	 unsigned int j;
+
+	 if (g->nodes[n2].in_stack || g->nodes[n2].reg == NO_REG)
+	    continue;
+
+	 reg = &g->regs->regs[g->nodes[n2].reg];
+	 for (j = 0; j < reg->num_conflicts; j++)
+	    BITSET_SET(used, reg->conflict_list[j]);
+      }
+
       /* Find the lowest-numbered reg which is not used by a member
        * of the graph adjacent to us.
        */
-      for (r = 0; r < g->regs->count; r++) {
-	 if (!c->regs[r])
-	    continue;
-
-	 /* Check if any of our neighbors conflict with this register choice. */
-	 for (i = 0; i < g->nodes[n].adjacency_count; i++) {
-	    unsigned int n2 = g->nodes[n].adjacency_list[i];
+      for (w = 0; w < words; w++) {
+	 BITSET_WORD avail = c->regs[w] & ~used[w];
 
-	    if (!g->nodes[n2].in_stack &&
-		g->regs->regs[r].conflicts[g->nodes[n2].reg]) {
-	       break;
-	    }
-	 }
-	 if (i == g->nodes[n].adjacency_count)
+	 if (avail)
 	    break;
       }
-      if (r == g->regs->count)
+      if (w == words) {
+	 ralloc_free(used);
 	 return GL_FALSE;
+      }
+      r = w * BITSET_WORDBITS + ffs(c->regs[w] & ~used[w]) - 1;
 
       g->nodes[n].reg = r;
       g->nodes[n].in_stack = GL_FALSE;
       g->stack_count--;
    }
 
+   ralloc_free(used);
+
    return GL_TRUE;
 }
 
@@ -467,9 +568,97 @@ ra_optimistic_color(struct ra_graph *g)
    }
 }
 
+/**
+ * Writes out the register set and the interference graph, so that the
+ * allocation can be replayed outside of the driver.  The format is one
+ * record per line:
+ *
+ *    ra_regs <reg count> <class count>
+ *    r <reg> <count> <conflicting regs>...
+ *    c <class> <count> <regs>...
+ *    ra_graph <node count>
+ *    n <node> <class> <reg or -1> <spill cost> <count> <adjacent nodes>...
+ *    end
+ *
+ * Conflicts and adjacency are only listed towards higher-numbered
+ * registers and nodes, as they are symmetric.
+ */
+static void
+ra_dump_graph(struct ra_graph *g, FILE *f)
+{
+   struct ra_regs *regs = g->regs;
+   unsigned int i, j, count;
+
+   fprintf(f, "ra_regs %u %u\n", regs->count, regs->class_count);
+
+   for (i = 0; i < regs->count; i++) {
+      count = 0;
+      for (j = 0; j < regs->regs[i].num_conflicts; j++) {
+	 if (regs->regs[i].conflict_list[j] > i)
+	    count++;
+      }
+
+      fprintf(f, "r %u %u", i, count);
+      for (j = 0; j < regs->regs[i].num_conflicts; j++) {
+	 if (regs->regs[i].conflict_list[j] > i)
+	    fprintf(f, " %u", regs->regs[i].conflict_list[j]);
+      }
+      fprintf(f, "\n");
+   }
+
+   for (i = 0; i < regs->class_count; i++) {
+      fprintf(f, "c %u %u", i, regs->classes[i]->p);
+      for (j = 0; j < regs->count; j++) {
+	 if (BITSET_TEST(regs->classes[i]->regs, j))
+	    fprintf(f, " %u", j);
+      }
+      fprintf(f, "\n");
+   }
+
+   fprintf(f, "ra_graph %u\n", g->count);
+
+   for (i = 0; i < g->count; i++) {
+      struct ra_node *node = &g->nodes[i];
+
+      count = 0;
+      for (j = 0; j < node->adjacency_count; j++) {
+	 if (node->adjacency_list[j] > i)
+	    count++;
+      }
+
+      fprintf(f, "n %u %u %d %.9g %u", i, node->class,
+	      node->reg == NO_REG ? -1 : (int)node->reg,
+	      node->spill_cost, count);
+      for (j = 0; j < node->adjacency_count; j++) {
+	 if (node->adjacency_list[j] > i)
+	    fprintf(f, " %u", node->adjacency_list[j]);
+      }
+      fprintf(f, "\n");
+   }
+
+   fprintf(f, "end\n");
+}
+
+/**
+ * Colors the graph, without spilling.
+ *
+ * If MESA_RA_DUMP is set, the graph is first appended to the file it
+ * names, in the format read by the r300 compiler's ra_bench.
+ */
 GLboolean
 ra_allocate_no_spills(struct ra_graph *g)
 {
+   const char *dump = getenv("MESA_RA_DUMP");
+
+   if (dump) {
+      FILE *f = fopen(dump, "a");
+
+      if (f) {
+	 ra_dump_graph(g, f);
+	 fclose(f);
+      }
+   }
+
    if (!ra_simplify(g)) {
       ra_optimistic_color(g);
    }
@@ -504,8 +693,8 @@ static float
 ra_get_spill_benefit(struct ra_graph *g, unsigned int n)
 {
    int j;
-   float benefit = 0;
-   int n_class = g->nodes[n].class;
+   unsigned int q = 0;
+   struct ra_class *n_class = g->regs->classes[g->nodes[n].class];
 
    /* Define the benefit of eliminating an interference between n, n2
     * through spilling as q(C, B) / p(C).  This is similar to the
@@ -514,14 +703,10 @@ ra_get_spill_benefit(struct ra_graph *g, unsigned int n)
     */
    for (j = 0; j < g->nodes[n].adjacency_count; j++) {
       unsigned int n2 = g->nodes[n].adjacency_list[j];
-      if (n != n2) {
-	 unsigned int n2_class = g->nodes[n2].class;
-	 benefit += ((float)g->regs->classes[n_class]->q[n2_class] /
-		     g->regs->classes[n_class]->p);
-      }
+      q += n_class->q[g->nodes[n2].class];
    }
 
-   return benefit;
+   return (float)q / n_class->p;
 }
 
 /**
@@ -532,7 +717,7 @@ int
 ra_get_best_spill_node(struct ra_graph *g)
 {
    unsigned int best_node = -1;
-   unsigned int best_benefit = 0.0;
+   float best_benefit = 0.0;
    unsigned int n;
 
    for (n = 0; n < g->count; n++) {
@@ -76,6 +76,7 @@ MAIN_SOURCES = \
 	main/scissor.c \
 	main/shaderapi.c \
 	main/shaderobj.c \
+	main/shaderqueue.c \
 	main/shared.c \
 	main/state.c \
 	main/stencil.c \
@@ -183,6 +184,7 @@ VBO_SOURCES = \
 	vbo/vbo_exec_array.c \
 	vbo/vbo_exec_draw.c \
 	vbo/vbo_exec_eval.c \
+	vbo/vbo_minmax_index.c \
 	vbo/vbo_noop.c \
 	vbo/vbo_rebase.c \
 	vbo/vbo_split.c \
@@ -244,6 +246,7 @@ STATETRACKER_SOURCES = \
 
 PROGRAM_SOURCES = \
 	program/arbprogparse.c \
+	program/disk_cache.c \
 	program/hash_table.c \
 	program/lex.yy.c \
 	program/nvfragparse.c \
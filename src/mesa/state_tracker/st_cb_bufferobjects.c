@@ -38,6 +38,7 @@
 
 #include "st_context.h"
 #include "st_cb_bufferobjects.h"
+#include "st_cb_readpixels.h"
 
 #include "pipe/p_context.h"
 #include "pipe/p_defines.h"
@@ -77,6 +78,8 @@ st_bufferobj_free(struct gl_context *ctx, struct gl_buffer_object *obj)
    assert(obj->RefCount == 0);
    assert(st_obj->transfer == NULL);
 
+   st_discard_readpixels(st_context(ctx)->pipe->screen, st_obj);
+
    if (st_obj->buffer) 
       pipe_resource_reference(&st_obj->buffer, NULL);
 
@@ -120,6 +123,8 @@ st_bufferobj_subdata(struct gl_context *ctx,
       return;
    }
 
+   st_bufferobj_finish_readpixels(st_context(ctx), st_obj);
+
    /* Now that transfers are per-context, we don't have to figure out
     * flushing here.  Usually drivers won't need to flush in this case
     * even if the buffer is currently referenced by hardware - they
@@ -156,6 +161,8 @@ st_bufferobj_get_subdata(struct gl_context *ctx,
       return;
    }
 
+   st_bufferobj_finish_readpixels(st_context(ctx), st_obj);
+
    pipe_buffer_read(st_context(ctx)->pipe, st_obj->buffer,
                     offset, size, data);
 }
@@ -219,6 +226,7 @@ st_bufferobj_data(struct gl_context *ctx,
       pipe_usage = PIPE_USAGE_DEFAULT;
    }
 
+   st_discard_readpixels(pipe->screen, st_obj);
    pipe_resource_reference( &st_obj->buffer, NULL );
 
    if (size != 0) {
@@ -248,7 +256,8 @@ st_bufferobj_map_range(struct gl_context *ctx,
                        GLintptr offset, GLsizeiptr length, GLbitfield access,
                        struct gl_buffer_object *obj)
 {
-   struct pipe_context *pipe = st_context(ctx)->pipe;
+   struct st_context *st = st_context(ctx);
+   struct pipe_context *pipe = st->pipe;
    struct st_buffer_object *st_obj = st_buffer_object(obj);
    enum pipe_transfer_usage flags = 0x0;
 
@@ -263,6 +272,7 @@ st_bufferobj_map_range(struct gl_context *ctx,
 
    if (access & GL_MAP_INVALIDATE_BUFFER_BIT) {
       flags |= PIPE_TRANSFER_DISCARD_WHOLE_RESOURCE;
+      st_discard_readpixels(pipe->screen, st_obj);
    }
    else if (access & GL_MAP_INVALIDATE_RANGE_BIT) {
       if (offset == 0 && length == obj->Size)
@@ -285,6 +295,9 @@ st_bufferobj_map_range(struct gl_context *ctx,
    assert(offset < obj->Size);
    assert(offset + length <= obj->Size);
 
+   /* This is where the application waits for glReadPixels into the buffer. */
+   st_bufferobj_finish_readpixels(st, st_obj);
+
    obj->Pointer = pipe_buffer_map_range(pipe,
                                         st_obj->buffer,
                                         offset, length,
@@ -352,7 +365,8 @@ st_copy_buffer_subdata(struct gl_context *ctx,
                        GLintptr readOffset, GLintptr writeOffset,
                        GLsizeiptr size)
 {
-   struct pipe_context *pipe = st_context(ctx)->pipe;
+   struct st_context *st = st_context(ctx);
+   struct pipe_context *pipe = st->pipe;
    struct st_buffer_object *srcObj = st_buffer_object(src);
    struct st_buffer_object *dstObj = st_buffer_object(dst);
    struct pipe_box box;
@@ -360,12 +374,17 @@ st_copy_buffer_subdata(struct gl_context *ctx,
    if(!size)
       return;
 
+   st_bufferobj_finish_readpixels(st, srcObj);
+   st_bufferobj_finish_readpixels(st, dstObj);
+
    /* buffer should not already be mapped */
    assert(!src->Pointer);
    assert(!dst->Pointer);
 
    u_box_1d(readOffset, size, &box);
 
+   dstObj->buffer->generation++;
+
    pipe->resource_copy_region(pipe, dstObj->buffer, 0, writeOffset, 0, 0,
                               srcObj->buffer, 0, &box);
 }
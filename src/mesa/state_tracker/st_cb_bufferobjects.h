@@ -34,6 +34,7 @@
 struct dd_function_table;
 struct pipe_resource;
 struct st_context;
+struct st_pending_readpixels;
 
 /**
  * State_tracker vertex/pixel buffer object, derived from Mesa's
@@ -44,6 +45,9 @@ struct st_buffer_object
    struct gl_buffer_object Base;
    struct pipe_resource *buffer;     /* GPU storage */
    struct pipe_transfer *transfer; /* In-progress map information */
+
+   /** glReadPixels not written to the buffer yet, see st_cb_readpixels.c */
+   struct st_pending_readpixels *pending_readpixels;
 };
 
 
@@ -55,6 +59,21 @@ st_buffer_object(struct gl_buffer_object *obj)
 }
 
 
+extern void
+st_resolve_readpixels(struct st_context *st, struct st_buffer_object *stobj);
+
+/**
+ * Make sure the contents of the buffer are up to date, before it's used.
+ */
+static INLINE void
+st_bufferobj_finish_readpixels(struct st_context *st,
+                               struct st_buffer_object *obj)
+{
+   if (obj->pending_readpixels)
+      st_resolve_readpixels(st, obj);
+}
+
+
 extern void
 st_bufferobj_validate_usage(struct st_context *st,
 			    struct st_buffer_object *obj,
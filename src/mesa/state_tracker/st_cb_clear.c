@@ -213,17 +213,17 @@ clear_with_quad(struct gl_context *ctx,
 	  x1, y1);
    */
 
-   cso_save_blend(st->cso_context);
-   cso_save_stencil_ref(st->cso_context);
-   cso_save_depth_stencil_alpha(st->cso_context);
-   cso_save_rasterizer(st->cso_context);
-   cso_save_viewport(st->cso_context);
-   cso_save_fragment_shader(st->cso_context);
-   cso_save_stream_outputs(st->cso_context);
-   cso_save_vertex_shader(st->cso_context);
-   cso_save_geometry_shader(st->cso_context);
-   cso_save_vertex_elements(st->cso_context);
-   cso_save_vertex_buffers(st->cso_context);
+   cso_save_state(st->cso_context, (CSO_BIT_BLEND |
+                                    CSO_BIT_STENCIL_REF |
+                                    CSO_BIT_DEPTH_STENCIL_ALPHA |
+                                    CSO_BIT_RASTERIZER |
+                                    CSO_BIT_VIEWPORT |
+                                    CSO_BIT_FRAGMENT_SHADER |
+                                    CSO_BIT_STREAM_OUTPUTS |
+                                    CSO_BIT_VERTEX_SHADER |
+                                    CSO_BIT_GEOMETRY_SHADER |
+                                    CSO_BIT_VERTEX_ELEMENTS |
+                                    CSO_BIT_VERTEX_BUFFERS));
 
    /* blend state: RGBA masking */
    {
@@ -309,17 +309,7 @@ clear_with_quad(struct gl_context *ctx,
    draw_quad(st, x0, y0, x1, y1, (GLfloat) ctx->Depth.Clear, &clearColor);
 
    /* Restore pipe state */
-   cso_restore_blend(st->cso_context);
-   cso_restore_stencil_ref(st->cso_context);
-   cso_restore_depth_stencil_alpha(st->cso_context);
-   cso_restore_rasterizer(st->cso_context);
-   cso_restore_viewport(st->cso_context);
-   cso_restore_fragment_shader(st->cso_context);
-   cso_restore_vertex_shader(st->cso_context);
-   cso_restore_geometry_shader(st->cso_context);
-   cso_restore_vertex_elements(st->cso_context);
-   cso_restore_vertex_buffers(st->cso_context);
-   cso_restore_stream_outputs(st->cso_context);
+   cso_restore_state(st->cso_context);
 }
 
 
@@ -45,6 +45,7 @@
 #include "pipe/p_screen.h"
 #include "util/u_gen_mipmap.h"
 #include "util/u_blit.h"
+#include "util/u_vbuf.h"
 
 
 /** Check if we have a front color buffer and if it's been drawn to. */
@@ -79,11 +80,23 @@ display_front_buffer(struct st_context *st)
 void st_flush( struct st_context *st,
                struct pipe_fence_handle **fence )
 {
+   struct pipe_fence_handle *vbuf_fence = NULL;
+
    FLUSH_CURRENT(st->ctx, 0);
 
    st_flush_bitmap(st);
 
+   /* u_vbuf needs the fence to reuse its upload ring without stalling. */
+   if (st->vbuf && !fence)
+      fence = &vbuf_fence;
+
    st->pipe->flush( st->pipe, fence );
+
+   if (st->vbuf && *fence)
+      u_vbuf_fence(st->vbuf, *fence);
+
+   if (vbuf_fence)
+      st->pipe->screen->fence_reference(st->pipe->screen, &vbuf_fence, NULL);
 }
 
 
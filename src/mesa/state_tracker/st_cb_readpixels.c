@@ -27,18 +27,319 @@
 
 
 #include "main/imports.h"
+#include "main/bufferobj.h"
+#include "main/image.h"
 #include "main/readpix.h"
 
+#include "pipe/p_context.h"
+#include "pipe/p_defines.h"
+#include "pipe/p_screen.h"
+#include "util/u_box.h"
+#include "util/u_format.h"
+#include "util/u_inlines.h"
+
 #include "st_atom.h"
 #include "st_context.h"
 #include "st_cb_bitmap.h"
+#include "st_cb_bufferobjects.h"
+#include "st_cb_fbo.h"
+#include "st_cb_flush.h"
 #include "st_cb_readpixels.h"
 
 
+/**
+ * A glReadPixels into a pixel pack buffer which has not been written to
+ * the buffer yet.  The pixels were copied by the GPU to a staging texture,
+ * and are packed into the buffer when it is next used, so that the read
+ * doesn't wait for rendering to finish.
+ */
+struct st_pending_readpixels
+{
+   struct st_pending_readpixels *next;
+
+   struct pipe_resource *texture;       /**< Copy of the pixels */
+   struct pipe_fence_handle *fence;     /**< Signaled when it's complete */
+   GLboolean invert;                    /**< Rows are stored top to bottom */
+
+   GLsizei width, height;
+   GLenum format, type;
+   struct gl_pixelstore_attrib packing; /**< Without the buffer object */
+   const GLvoid *pixels;                /**< Offset into the buffer */
+};
+
+
+/**
+ * Whether the pixels can be read by copying the renderbuffer region as is,
+ * which is what a staging texture of the same format provides.
+ */
+static GLboolean
+can_copy_pixels(struct gl_context *ctx, struct st_renderbuffer *strb,
+                GLenum format, GLenum type,
+                const struct gl_pixelstore_attrib *pack)
+{
+   GLbitfield transferOps = ctx->_ImageTransferState;
+
+   if (!strb || strb->software || !strb->texture || !strb->surface ||
+       strb->texture->nr_samples > 1)
+      return GL_FALSE;
+
+   if (!_mesa_format_matches_format_and_type(strb->Base.Format, format, type,
+                                             pack->SwapBytes))
+      return GL_FALSE;
+
+   /* Clamping doesn't change unsigned normalized values. */
+   if ((ctx->Color._ClampReadColor == GL_TRUE || type != GL_FLOAT) &&
+       !_mesa_is_integer_format(format) &&
+       _mesa_get_format_datatype(strb->Base.Format) != GL_UNSIGNED_NORMALIZED)
+      transferOps |= IMAGE_CLAMP_BIT;
+
+   return transferOps == 0;
+}
+
+
+/**
+ * Try to read the pixels into the pixel pack buffer without waiting for
+ * the GPU, by queuing a copy of them to a staging texture.
+ * \return GL_TRUE if done, GL_FALSE if the pixels must be read now
+ */
+static GLboolean
+queue_readpixels(struct gl_context *ctx, GLint x, GLint y,
+                 GLsizei width, GLsizei height,
+                 GLenum format, GLenum type,
+                 const struct gl_pixelstore_attrib *pack,
+                 GLvoid *dest)
+{
+   struct st_context *st = st_context(ctx);
+   struct pipe_context *pipe = st->pipe;
+   struct pipe_screen *screen = pipe->screen;
+   struct st_buffer_object *stobj = st_buffer_object(pack->BufferObj);
+   struct st_renderbuffer *strb =
+      st_renderbuffer(ctx->ReadBuffer->_ColorReadBuffer);
+   struct gl_pixelstore_attrib clippedPacking = *pack;
+   struct st_pending_readpixels *pending, **tail;
+   struct pipe_resource templ;
+   struct pipe_box box;
+   GLboolean invert;
+
+   if (format == GL_STENCIL_INDEX ||
+       format == GL_DEPTH_COMPONENT ||
+       format == GL_DEPTH_STENCIL_EXT)
+      return GL_FALSE;
+
+   if (!stobj->buffer ||
+       !can_copy_pixels(ctx, strb, format, type, pack))
+      return GL_FALSE;
+
+   if (!_mesa_clip_readpixels(ctx, &x, &y, &width, &height, &clippedPacking))
+      return GL_TRUE;
+
+   memset(&templ, 0, sizeof(templ));
+   templ.target = PIPE_TEXTURE_2D;
+   templ.format = strb->texture->format;
+   templ.width0 = width;
+   templ.height0 = height;
+   templ.depth0 = 1;
+   templ.array_size = 1;
+   templ.usage = PIPE_USAGE_STAGING;
+
+   pending = CALLOC_STRUCT(st_pending_readpixels);
+   if (!pending)
+      return GL_FALSE;
+
+   pending->texture = screen->resource_create(screen, &templ);
+   if (!pending->texture) {
+      free(pending);
+      return GL_FALSE;
+   }
+
+   /* Note: y=0=bottom of the buffer while box.y=0=top of the texture. */
+   invert = st_fb_orientation(ctx->ReadBuffer) == Y_0_TOP;
+   u_box_2d_zslice(x, invert ? strb->Base.Height - y - height : y,
+                   strb->surface->u.tex.first_layer, width, height, &box);
+
+   pipe->resource_copy_region(pipe, pending->texture, 0, 0, 0, 0,
+                              strb->texture, strb->surface->u.tex.level,
+                              &box);
+
+   /* Get the copy going, rather than leaving it behind whatever gets
+    * rendered until the next flush.
+    */
+   st_flush(st, &pending->fence);
+
+   pending->invert = invert;
+   pending->width = width;
+   pending->height = height;
+   pending->format = format;
+   pending->type = type;
+   pending->packing = clippedPacking;
+   pending->packing.BufferObj = NULL;
+   pending->pixels = dest;
+
+   /* Reads into the same buffer are packed in order. */
+   for (tail = &stobj->pending_readpixels; *tail; tail = &(*tail)->next)
+      ;
+   *tail = pending;
+
+   return GL_TRUE;
+}
+
+
+static void
+free_pending_readpixels(struct pipe_screen *screen,
+                        struct st_pending_readpixels *pending)
+{
+   if (pending->fence)
+      screen->fence_reference(screen, &pending->fence, NULL);
+   pipe_resource_reference(&pending->texture, NULL);
+   free(pending);
+}
+
+
+/**
+ * Pack the pixels of the pending glReadPixels into buffer \p stobj,
+ * waiting for their copies to complete.
+ */
+void
+st_resolve_readpixels(struct st_context *st, struct st_buffer_object *stobj)
+{
+   struct pipe_context *pipe = st->pipe;
+   struct pipe_screen *screen = pipe->screen;
+   struct st_pending_readpixels *pending = stobj->pending_readpixels;
+   struct pipe_transfer *dst_transfer;
+   GLubyte *map;
+
+   stobj->pending_readpixels = NULL;
+
+   map = pipe_buffer_map(pipe, stobj->buffer, PIPE_TRANSFER_WRITE,
+                         &dst_transfer);
+
+   while (pending) {
+      struct st_pending_readpixels *next = pending->next;
+      const GLint bytes = util_format_get_blocksize(pending->texture->format);
+      struct pipe_transfer *src_transfer;
+      const GLubyte *src;
+      GLint j;
+
+      if (pending->fence)
+         screen->fence_finish(screen, pending->fence, PIPE_TIMEOUT_INFINITE);
+
+      src_transfer = pipe_get_transfer(pipe, pending->texture, 0, 0,
+                                       PIPE_TRANSFER_READ, 0, 0,
+                                       pending->width, pending->height);
+      src = src_transfer ? pipe_transfer_map(pipe, src_transfer) : NULL;
+
+      if (map && src) {
+         for (j = 0; j < pending->height; j++) {
+            const GLint row = pending->invert ? pending->height - 1 - j : j;
+            GLubyte *dst = ADD_POINTERS(map,
+               _mesa_image_address2d(&pending->packing, pending->pixels,
+                                     pending->width, pending->height,
+                                     pending->format, pending->type, j, 0));
+
+            memcpy(dst, src + row * src_transfer->stride,
+                   pending->width * bytes);
+         }
+      }
+
+      if (src)
+         pipe_transfer_unmap(pipe, src_transfer);
+      if (src_transfer)
+         pipe->transfer_destroy(pipe, src_transfer);
+
+      free_pending_readpixels(screen, pending);
+      pending = next;
+   }
+
+   if (map)
+      pipe_buffer_unmap(pipe, dst_transfer);
+}
+
+
+/**
+ * Forget the pending glReadPixels into buffer \p stobj, whose contents are
+ * being replaced.
+ */
+void
+st_discard_readpixels(struct pipe_screen *screen,
+                      struct st_buffer_object *stobj)
+{
+   while (stobj->pending_readpixels) {
+      struct st_pending_readpixels *next = stobj->pending_readpixels->next;
+      free_pending_readpixels(screen, stobj->pending_readpixels);
+      stobj->pending_readpixels = next;
+   }
+}
+
+
+/**
+ * Store the pixels of a glTexSubImage from buffer \p stobj into texture
+ * \p dst on the GPU.  This is possible when they are exactly the pixels
+ * of the last glReadPixels into the buffer, which are still in a staging
+ * texture of the same format.
+ * \return GL_TRUE if done, GL_FALSE if the pixels must be unpacked as usual
+ */
+GLboolean
+st_copy_readpixels_to_texture(struct st_context *st,
+                              struct st_buffer_object *stobj,
+                              struct pipe_resource *dst,
+                              unsigned level, unsigned layer,
+                              GLint dstx, GLint dsty,
+                              GLsizei width, GLsizei height,
+                              GLenum format, GLenum type,
+                              const struct gl_pixelstore_attrib *unpack,
+                              const GLvoid *pixels)
+{
+   struct pipe_context *pipe = st->pipe;
+   struct st_pending_readpixels *last = stobj->pending_readpixels;
+   struct pipe_box box;
+   GLint j;
+
+   if (!last)
+      return GL_FALSE;
+   while (last->next)
+      last = last->next;
+
+   if (last->pixels != pixels ||
+       last->width != width ||
+       last->height != height ||
+       last->format != format ||
+       last->type != type ||
+       last->texture->format != dst->format)
+      return GL_FALSE;
+
+   /* Clipping the read set the row length, see _mesa_clip_readpixels(). */
+   if (last->packing.Alignment != unpack->Alignment ||
+       last->packing.RowLength !=
+       (unpack->RowLength ? unpack->RowLength : width) ||
+       last->packing.SkipPixels != unpack->SkipPixels ||
+       last->packing.SkipRows != unpack->SkipRows ||
+       last->packing.SwapBytes != unpack->SwapBytes ||
+       last->packing.Invert != unpack->Invert)
+      return GL_FALSE;
+
+   if (!last->invert) {
+      u_box_2d(0, 0, width, height, &box);
+      pipe->resource_copy_region(pipe, dst, level, dstx, dsty, layer,
+                                 last->texture, 0, &box);
+   }
+   else {
+      /* resource_copy_region() can't flip, so copy the rows one by one. */
+      for (j = 0; j < height; j++) {
+         u_box_2d(0, height - 1 - j, width, 1, &box);
+         pipe->resource_copy_region(pipe, dst, level, dstx, dsty + j, layer,
+                                    last->texture, 0, &box);
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
 /**
  * The only special thing we need to do for the state tracker's
  * glReadPixels is to validate state (to be sure we have up-to-date
  * framebuffer surfaces) and flush the bitmap cache prior to reading.
+ * Reads into a pixel pack buffer are queued on the GPU where possible.
  */
 static void
 st_readpixels(struct gl_context *ctx, GLint x, GLint y,
@@ -51,6 +352,11 @@ st_readpixels(struct gl_context *ctx, GLint x, GLint y,
 
    st_validate_state(st);
    st_flush_bitmap_cache(st);
+
+   if (_mesa_is_bufferobj(pack->BufferObj) &&
+       queue_readpixels(ctx, x, y, width, height, format, type, pack, dest))
+      return;
+
    _mesa_readpixels(ctx, x, y, width, height, format, type, pack, dest);
 }
 
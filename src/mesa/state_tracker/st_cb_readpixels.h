@@ -32,6 +32,26 @@
 #include "main/glheader.h"
 
 struct dd_function_table;
+struct gl_pixelstore_attrib;
+struct pipe_resource;
+struct pipe_screen;
+struct st_buffer_object;
+struct st_context;
+
+extern void
+st_discard_readpixels(struct pipe_screen *screen,
+                      struct st_buffer_object *stobj);
+
+extern GLboolean
+st_copy_readpixels_to_texture(struct st_context *st,
+                              struct st_buffer_object *stobj,
+                              struct pipe_resource *dst,
+                              unsigned level, unsigned layer,
+                              GLint dstx, GLint dsty,
+                              GLsizei width, GLsizei height,
+                              GLenum format, GLenum type,
+                              const struct gl_pixelstore_attrib *unpack,
+                              const GLvoid *pixels);
 
 extern void
 st_init_readpixels_functions(struct dd_function_table *functions);
@@ -34,6 +34,7 @@
 #include "main/macros.h"
 #include "pipe/p_context.h"
 #include "pipe/p_screen.h"
+#include "util/u_vbuf.h"
 #include "st_context.h"
 #include "st_cb_syncobj.h"
 
@@ -66,13 +67,17 @@ static void st_delete_sync_object(struct gl_context *ctx,
 static void st_fence_sync(struct gl_context *ctx, struct gl_sync_object *obj,
                           GLenum condition, GLbitfield flags)
 {
-   struct pipe_context *pipe = st_context(ctx)->pipe;
+   struct st_context *st = st_context(ctx);
+   struct pipe_context *pipe = st->pipe;
    struct st_sync_object *so = (struct st_sync_object*)obj;
 
    assert(condition == GL_SYNC_GPU_COMMANDS_COMPLETE && flags == 0);
    assert(so->fence == NULL);
 
    pipe->flush(pipe, &so->fence);
+
+   if (st->vbuf && so->fence)
+      u_vbuf_fence(st->vbuf, so->fence);
 }
 
 static void st_check_sync(struct gl_context *ctx, struct gl_sync_object *obj)
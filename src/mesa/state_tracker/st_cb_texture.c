@@ -27,6 +27,7 @@
 
 #include "main/mfeatures.h"
 #include "main/bufferobj.h"
+#include "main/bufferobj.h"
 #include "main/enums.h"
 #include "main/fbobject.h"
 #include "main/formats.h"
@@ -45,8 +46,10 @@
 
 #include "state_tracker/st_debug.h"
 #include "state_tracker/st_context.h"
+#include "state_tracker/st_cb_bufferobjects.h"
 #include "state_tracker/st_cb_fbo.h"
 #include "state_tracker/st_cb_flush.h"
+#include "state_tracker/st_cb_readpixels.h"
 #include "state_tracker/st_cb_texture.h"
 #include "state_tracker/st_format.h"
 #include "state_tracker/st_texture.h"
@@ -573,6 +576,79 @@ st_TexImage1D(struct gl_context * ctx,
 }
 
 
+/**
+ * Try to do a glTexSubImage2D from a pixel unpack buffer on the GPU,
+ * without mapping the buffer.
+ *
+ * Gallium has no copy from a buffer to a texture, so this only handles a
+ * buffer that was last filled by glReadPixels, with the same pixels in the
+ * same format and type, and no pixel transfer ops.  Any other PBO upload
+ * maps the buffer and goes through texstore.  See
+ * st_copy_readpixels_to_texture().
+ */
+static GLboolean
+try_pbo_upload(struct gl_context *ctx,
+               struct gl_texture_image *texImage,
+               GLint xoffset, GLint yoffset,
+               GLsizei width, GLsizei height,
+               GLenum format, GLenum type, const void *pixels,
+               const struct gl_pixelstore_attrib *unpack)
+{
+   struct st_texture_image *stImage = st_texture_image(texImage);
+   struct st_texture_object *stObj = st_texture_object(texImage->TexObject);
+   struct st_buffer_object *stobj = st_buffer_object(unpack->BufferObj);
+   GLuint level;
+
+   if (!_mesa_is_bufferobj(unpack->BufferObj) ||
+       !stobj->pending_readpixels ||
+       !stImage->pt ||
+       texImage->TexObject->Target == GL_TEXTURE_1D_ARRAY)
+      return GL_FALSE;
+
+   /* The texels must be the bytes in the buffer, as for a memcpy. */
+   if (ctx->_ImageTransferState ||
+       texImage->_BaseFormat !=
+       _mesa_get_format_base_format(texImage->TexFormat) ||
+       !_mesa_format_matches_format_and_type(texImage->TexFormat,
+                                             format, type, unpack->SwapBytes))
+      return GL_FALSE;
+
+   /* Leave any errors to be raised by the usual path. */
+   if (_mesa_bufferobj_mapped(unpack->BufferObj) ||
+       !_mesa_validate_pbo_access(2, unpack, width, height, 1,
+                                  format, type, INT_MAX, pixels))
+      return GL_FALSE;
+
+   /* An image outside the object's mipmap tree has a single level. */
+   if (stObj->pt != stImage->pt)
+      level = 0;
+   else
+      level = stImage->base.Level;
+
+   return st_copy_readpixels_to_texture(st_context(ctx), stobj, stImage->pt,
+                                        level, stImage->base.Face,
+                                        xoffset, yoffset, width, height,
+                                        format, type, unpack, pixels);
+}
+
+
+static void
+st_TexSubImage2D(struct gl_context *ctx,
+                 struct gl_texture_image *texImage,
+                 GLint xoffset, GLint yoffset,
+                 GLsizei width, GLsizei height,
+                 GLenum format, GLenum type, const void *pixels,
+                 const struct gl_pixelstore_attrib *unpack)
+{
+   if (try_pbo_upload(ctx, texImage, xoffset, yoffset, width, height,
+                      format, type, pixels, unpack))
+      return;
+
+   _mesa_store_texsubimage2d(ctx, texImage, xoffset, yoffset, width, height,
+                             format, type, pixels, unpack);
+}
+
+
 static void
 st_CompressedTexImage2D(struct gl_context *ctx,
                         struct gl_texture_image *texImage,
@@ -1429,7 +1505,7 @@ st_init_texture_functions(struct dd_function_table *functions)
    functions->TexImage2D = st_TexImage2D;
    functions->TexImage3D = st_TexImage3D;
    functions->TexSubImage1D = _mesa_store_texsubimage1d;
-   functions->TexSubImage2D = _mesa_store_texsubimage2d;
+   functions->TexSubImage2D = st_TexSubImage2D;
    functions->TexSubImage3D = _mesa_store_texsubimage3d;
    functions->CompressedTexSubImage1D = _mesa_store_compressed_texsubimage1d;
    functions->CompressedTexSubImage2D = _mesa_store_compressed_texsubimage2d;
@@ -125,6 +125,9 @@ st_begin_transform_feedback(struct gl_context *ctx, GLenum mode,
       struct st_buffer_object *bo = st_buffer_object(sobj->base.Buffers[i]);
 
       if (bo) {
+         /* Pending CPU writes must land before the GPU's. */
+         st_bufferobj_finish_readpixels(st, bo);
+
          /* Check whether we need to recreate the target. */
          if (!sobj->targets[i] ||
              sobj->targets[i] == sobj->draw_count ||
@@ -141,6 +144,9 @@ st_begin_transform_feedback(struct gl_context *ctx, GLenum mode,
             sobj->targets[i] = so_target;
          }
 
+         /* The contents are going to change. */
+         bo->buffer->generation++;
+
          sobj->num_targets = i+1;
       } else {
          pipe_so_target_reference(&sobj->targets[i], NULL);
@@ -169,6 +175,12 @@ st_resume_transform_feedback(struct gl_context *ctx,
    struct st_context *st = st_context(ctx);
    struct st_transform_feedback_object *sobj =
          st_transform_feedback_object(obj);
+   unsigned i;
+
+   for (i = 0; i < sobj->num_targets; i++) {
+      if (sobj->targets[i])
+         sobj->targets[i]->buffer->generation++;
+   }
 
    cso_set_stream_outputs(st->cso_context, sobj->num_targets, sobj->targets,
                           ~0);
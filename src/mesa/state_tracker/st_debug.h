@@ -44,6 +44,7 @@ st_print_current(void);
 #define DEBUG_FALLBACK  0x20
 #define DEBUG_QUERY     0x40
 #define DEBUG_SCREEN    0x80
+#define DEBUG_OPT       0x100
 
 #ifdef DEBUG
 extern int ST_DEBUG;
@@ -61,6 +61,7 @@
 #include "util/u_format.h"
 #include "util/u_prim.h"
 #include "util/u_draw_quad.h"
+#include "indices/u_indices.h"
 #include "draw/draw_context.h"
 #include "cso_cache/cso_context.h"
 
@@ -497,6 +498,8 @@ setup_interleaved_attribs(struct gl_context *ctx,
          return GL_FALSE;
       }
 
+      st_bufferobj_finish_readpixels(st, stobj);
+
       vbuffer->buffer = NULL;
       pipe_resource_reference(&vbuffer->buffer, stobj->buffer);
       vbuffer->buffer_offset = pointer_to_offset(low_addr);
@@ -565,6 +568,8 @@ setup_non_interleaved_attribs(struct gl_context *ctx,
             return GL_FALSE;
          }
 
+         st_bufferobj_finish_readpixels(st, stobj);
+
          vbuffer[attr].buffer = NULL;
          pipe_resource_reference(&vbuffer[attr].buffer, stobj->buffer);
          vbuffer[attr].buffer_offset = pointer_to_offset(array->Ptr);
@@ -646,6 +651,7 @@ setup_index_buffer(struct gl_context *ctx,
       if (_mesa_is_bufferobj(bufobj)) {
          /* elements/indexes are in a real VBO */
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
+         st_bufferobj_finish_readpixels(st, stobj);
          pipe_resource_reference(&ibuffer->buffer, stobj->buffer);
          ibuffer->offset = pointer_to_offset(ib->ptr);
       }
@@ -698,6 +704,9 @@ check_uniforms(struct gl_context *ctx)
  * The code below is used when the gallium driver does not support primitive
  * restart itself.  We map the index buffer, find the restart indexes, unmap
  * the index buffer then draw the sub-primitives delineated by the restarts.
+ * Points, lines, triangles and triangle strips/fans are instead translated
+ * into a single list without the restart indexes and drawn at once, see
+ * translate_primitive_restart().
  * A couple possible optimizations:
  * 1. Save the list of sub-primitive (start, count) values in a list attached
  *    to the index buffer for re-use in subsequent draws.  The list would be
@@ -789,6 +798,57 @@ find_sub_primitives(const void *elements, unsigned element_size,
 }
 
 
+/**
+ * Translate the elements of a primitive with restarts into a single list
+ * primitive without them.  Only done for the primitive types for which
+ * drawing the list gives the same result as drawing the sub-primitives:
+ * converting line strips or loops would restart the line stipple and
+ * converting quads or polygons would add edges in unfilled mode.
+ * Returns the new index array (to be freed by the caller) or NULL.
+ */
+static void *
+translate_primitive_restart(const void *elements, unsigned element_size,
+                            const struct pipe_draw_info *orig_info,
+                            boolean flatshade_first,
+                            struct pipe_draw_info *info,
+                            unsigned *index_size)
+{
+   unsigned pv = flatshade_first ? PV_FIRST : PV_LAST;
+   unsigned prim, nr;
+   u_translate_func translate;
+   void *indices;
+
+   switch (orig_info->mode) {
+   case PIPE_PRIM_POINTS:
+   case PIPE_PRIM_LINES:
+   case PIPE_PRIM_TRIANGLES:
+   case PIPE_PRIM_TRIANGLE_STRIP:
+   case PIPE_PRIM_TRIANGLE_FAN:
+      break;
+   default:
+      return NULL;
+   }
+
+   if (u_index_translator(0, orig_info->mode, element_size, orig_info->count,
+                          pv, pv, TRUE, &prim, index_size, &nr,
+                          &translate) == U_TRANSLATE_ERROR)
+      return NULL;
+
+   indices = malloc(MAX2(nr, 1) * *index_size);
+   if (!indices)
+      return NULL;
+
+   *info = *orig_info;
+   info->mode = prim;
+   info->start = 0;
+   info->count = translate(elements, orig_info->count, nr,
+                           orig_info->restart_index, indices);
+   info->primitive_restart = FALSE;
+
+   return indices;
+}
+
+
 /**
  * For gallium drivers that don't support the primitive restart
  * feature, handle it here by breaking up the indexed primitive into
@@ -799,7 +859,8 @@ handle_fallback_primitive_restart(struct cso_context *cso,
                                   struct pipe_context *pipe,
                                   const struct _mesa_index_buffer *ib,
                                   struct pipe_index_buffer *ibuffer,
-                                  struct pipe_draw_info *orig_info)
+                                  struct pipe_draw_info *orig_info,
+                                  boolean flatshade_first)
 {
    const unsigned start = orig_info->start;
    const unsigned count = orig_info->count;
@@ -809,6 +870,8 @@ handle_fallback_primitive_restart(struct cso_context *cso,
    const void *ptr = NULL;
    struct sub_primitive *sub_prims;
    unsigned num_sub_prims;
+   void *indices;
+   unsigned index_size;
 
    assert(info.indexed);
    assert(ibuffer->buffer);
@@ -836,6 +899,30 @@ handle_fallback_primitive_restart(struct cso_context *cso,
          return;
    }
 
+   indices = translate_primitive_restart(ptr, ibuffer->index_size, orig_info,
+                                         flatshade_first, &info, &index_size);
+   if (indices) {
+      struct pipe_index_buffer gen_ib;
+
+      if (transfer)
+         pipe_buffer_unmap(pipe, transfer);
+
+      memset(&gen_ib, 0, sizeof gen_ib);
+      gen_ib.index_size = index_size;
+      gen_ib.buffer = pipe_user_buffer_create(pipe->screen, indices,
+                                              info.count * index_size,
+                                              PIPE_BIND_INDEX_BUFFER);
+      if (gen_ib.buffer && info.count) {
+         cso_set_index_buffer(cso, &gen_ib);
+         cso_draw_vbo(cso, &info);
+         cso_set_index_buffer(cso, ibuffer);
+      }
+
+      pipe_resource_reference(&gen_ib.buffer, NULL);
+      free(indices);
+      return;
+   }
+
    sub_prims = find_sub_primitives(ptr, ibuffer->index_size,
                                    0, count, orig_info->restart_index,
                                    &num_sub_prims);
@@ -1117,7 +1204,9 @@ st_draw_vbo(struct gl_context *ctx,
          if (st->sw_primitive_restart) {
             /* Handle primitive restart for drivers that doesn't support it */
             handle_fallback_primitive_restart(st->cso_context, pipe, ib,
-                                              &ibuffer, &info);
+                                              &ibuffer, &info,
+                                              ctx->Light.ProvokingVertex ==
+                                              GL_FIRST_VERTEX_CONVENTION_EXT);
          }
          else {
             /* don't trim, restarts might be inside index list */
@@ -168,6 +168,8 @@ st_feedback_draw_vbo(struct gl_context *ctx,
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
          assert(stobj->buffer);
 
+         st_bufferobj_finish_readpixels(st, stobj);
+
          vbuffers[attr].buffer = NULL;
          pipe_resource_reference(&vbuffers[attr].buffer, stobj->buffer);
          vbuffers[attr].buffer_offset = pointer_to_offset(low_addr);
@@ -226,6 +228,8 @@ st_feedback_draw_vbo(struct gl_context *ctx,
       if (bufobj && bufobj->Name) {
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
 
+         st_bufferobj_finish_readpixels(st, stobj);
+
          pipe_resource_reference(&ibuffer.buffer, stobj->buffer);
          ibuffer.offset = pointer_to_offset(ib->ptr);
 
@@ -62,12 +62,14 @@ extern "C" {
 #include "pipe/p_shader_tokens.h"
 #include "pipe/p_state.h"
 #include "util/u_math.h"
+#include "os/os_time.h"
 #include "tgsi/tgsi_ureg.h"
 #include "tgsi/tgsi_info.h"
 #include "st_context.h"
 #include "st_program.h"
 #include "st_glsl_to_tgsi.h"
 #include "st_mesa_to_tgsi.h"
+#include "st_debug.h"
 }
 
 #define PROGRAM_IMMEDIATE PROGRAM_FILE_MAX
@@ -416,11 +418,9 @@ public:
 
    void simplify_cmp(void);
 
-   void rename_temp_register(int index, int new_index);
-   int get_first_temp_read(int index);
-   int get_first_temp_write(int index);
-   int get_last_temp_read(int index);
-   int get_last_temp_write(int index);
+   void rename_temp_registers(const int *renames);
+   void get_temp_live_ranges(int *first_reads, int *first_writes,
+                             int *last_reads, int *last_writes);
 
    void copy_propagate(void);
    void eliminate_dead_code(void);
@@ -3026,145 +3026,169 @@ glsl_to_tgsi_visitor::simplify_cmp(void)
    delete [] tempWrites;
 }
 
-/* Replaces all references to a temporary register index with another index. */
+/* Replaces all references to each temporary register index i with
+ * renames[i], in a single walk over the program.
+ */
 void
-glsl_to_tgsi_visitor::rename_temp_register(int index, int new_index)
+glsl_to_tgsi_visitor::rename_temp_registers(const int *renames)
 {
    foreach_iter(exec_list_iterator, iter, this->instructions) {
       glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
       unsigned j;
-      
+
       for (j=0; j < num_inst_src_regs(inst->op); j++) {
-         if (inst->src[j].file == PROGRAM_TEMPORARY && 
-             inst->src[j].index == index) {
-            inst->src[j].index = new_index;
-         }
-      }
-      
-      if (inst->dst.file == PROGRAM_TEMPORARY && inst->dst.index == index) {
-         inst->dst.index = new_index;
+         if (inst->src[j].file == PROGRAM_TEMPORARY)
+            inst->src[j].index = renames[inst->src[j].index];
       }
+
+      if (inst->dst.file == PROGRAM_TEMPORARY)
+         inst->dst.index = renames[inst->dst.index];
    }
 }
 
-int
-glsl_to_tgsi_visitor::get_first_temp_read(int index)
+/* Computes the first and last instructions reading and writing each
+ * temporary register in one walk over the program.  Accesses inside a loop
+ * count as happening at the BGNLOOP (for the first ones) or at the ENDLOOP
+ * (for the last ones) of the outermost loop, since the loop body may run
+ * again.  Registers that are never accessed get -1.  Any of the arrays may
+ * be NULL.
+ */
+void
+glsl_to_tgsi_visitor::get_temp_live_ranges(int *first_reads, int *first_writes,
+                                           int *last_reads, int *last_writes)
 {
    int depth = 0; /* loop depth */
    int loop_start = -1; /* index of the first active BGNLOOP (if any) */
-   unsigned i = 0, j;
-   
+   int *loop_reads, *loop_writes; /* temporaries accessed in that loop */
+   int num_loop_reads = 0, num_loop_writes = 0;
+   int i = 0, k;
+   unsigned j;
+
+   if (first_reads)
+      memset(first_reads, 0xff, sizeof(int) * this->next_temp);
+   if (first_writes)
+      memset(first_writes, 0xff, sizeof(int) * this->next_temp);
+   if (last_reads)
+      memset(last_reads, 0xff, sizeof(int) * this->next_temp);
+   if (last_writes)
+      memset(last_writes, 0xff, sizeof(int) * this->next_temp);
+
+   loop_reads = ralloc_array(mem_ctx, int, this->next_temp);
+   loop_writes = ralloc_array(mem_ctx, int, this->next_temp);
+
    foreach_iter(exec_list_iterator, iter, this->instructions) {
       glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
-      
+
       for (j=0; j < num_inst_src_regs(inst->op); j++) {
-         if (inst->src[j].file == PROGRAM_TEMPORARY && 
-             inst->src[j].index == index) {
-            return (depth == 0) ? i : loop_start;
+         if (inst->src[j].file == PROGRAM_TEMPORARY) {
+            int index = inst->src[j].index;
+
+            if (first_reads && first_reads[index] == -1)
+               first_reads[index] = (depth == 0) ? i : loop_start;
+
+            /* -2 marks a read that is resolved at the end of the loop. */
+            if (last_reads && depth == 0) {
+               last_reads[index] = i;
+            } else if (last_reads && last_reads[index] != -2) {
+               last_reads[index] = -2;
+               loop_reads[num_loop_reads++] = index;
+            }
          }
       }
-      
-      if (inst->op == TGSI_OPCODE_BGNLOOP) {
-         if(depth++ == 0)
-            loop_start = i;
-      } else if (inst->op == TGSI_OPCODE_ENDLOOP) {
-         if (--depth == 0)
-            loop_start = -1;
-      }
-      assert(depth >= 0);
-      
-      i++;
-   }
-   
-   return -1;
-}
 
-int
-glsl_to_tgsi_visitor::get_first_temp_write(int index)
-{
-   int depth = 0; /* loop depth */
-   int loop_start = -1; /* index of the first active BGNLOOP (if any) */
-   int i = 0;
-   
-   foreach_iter(exec_list_iterator, iter, this->instructions) {
-      glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
-      
-      if (inst->dst.file == PROGRAM_TEMPORARY && inst->dst.index == index) {
-         return (depth == 0) ? i : loop_start;
+      if (inst->dst.file == PROGRAM_TEMPORARY) {
+         int index = inst->dst.index;
+
+         if (first_writes && first_writes[index] == -1)
+            first_writes[index] = (depth == 0) ? i : loop_start;
+
+         if (last_writes && depth == 0) {
+            last_writes[index] = i;
+         } else if (last_writes && last_writes[index] != -2) {
+            last_writes[index] = -2;
+            loop_writes[num_loop_writes++] = index;
+         }
       }
-      
+
       if (inst->op == TGSI_OPCODE_BGNLOOP) {
          if(depth++ == 0)
             loop_start = i;
       } else if (inst->op == TGSI_OPCODE_ENDLOOP) {
-         if (--depth == 0)
+         if (--depth == 0) {
             loop_start = -1;
+
+            for (k = 0; k < num_loop_reads; k++)
+               last_reads[loop_reads[k]] = i;
+            for (k = 0; k < num_loop_writes; k++)
+               last_writes[loop_writes[k]] = i;
+            num_loop_reads = 0;
+            num_loop_writes = 0;
+         }
       }
       assert(depth >= 0);
-      
+
       i++;
    }
-   
-   return -1;
+
+   ralloc_free(loop_reads);
+   ralloc_free(loop_writes);
 }
 
-int
-glsl_to_tgsi_visitor::get_last_temp_read(int index)
-{
-   int depth = 0; /* loop depth */
-   int last = -1; /* index of last instruction that reads the temporary */
-   unsigned i = 0, j;
-   
-   foreach_iter(exec_list_iterator, iter, this->instructions) {
-      glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
-      
-      for (j=0; j < num_inst_src_regs(inst->op); j++) {
-         if (inst->src[j].file == PROGRAM_TEMPORARY && 
-             inst->src[j].index == index) {
-            last = (depth == 0) ? i : -2;
-         }
+/**
+ * Log of the register channels recorded by copy_propagate() and
+ * eliminate_dead_code_advanced(), in program order, with the if/else
+ * nesting level they were recorded at.  Levels never decrease along the
+ * log, so the channels recorded inside an if or else block are always at
+ * its end, and clearing the channels of a block or of the whole program
+ * does not have to look at every register.  Entries may be stale: the
+ * passes check the channel is still recorded at that level before using
+ * them.
+ */
+class channel_log {
+public:
+   channel_log(void *mem_ctx)
+   {
+      this->mem_ctx = mem_ctx;
+      this->size = 64;
+      this->count = 0;
+      this->chan = ralloc_array(mem_ctx, int, this->size);
+      this->level = ralloc_array(mem_ctx, int, this->size);
+   }
+
+   ~channel_log()
+   {
+      ralloc_free(this->chan);
+      ralloc_free(this->level);
+   }
+
+   void push(int chan, int level)
+   {
+      if (this->count == this->size) {
+         this->size *= 2;
+         this->chan = reralloc(mem_ctx, this->chan, int, this->size);
+         this->level = reralloc(mem_ctx, this->level, int, this->size);
       }
-      
-      if (inst->op == TGSI_OPCODE_BGNLOOP)
-         depth++;
-      else if (inst->op == TGSI_OPCODE_ENDLOOP)
-         if (--depth == 0 && last == -2)
-            last = i;
-      assert(depth >= 0);
-      
-      i++;
+      this->chan[this->count] = chan;
+      this->level[this->count] = level;
+      this->count++;
    }
-   
-   assert(last >= -1);
-   return last;
-}
 
-int
-glsl_to_tgsi_visitor::get_last_temp_write(int index)
-{
-   int depth = 0; /* loop depth */
-   int last = -1; /* index of last instruction that writes to the temporary */
-   int i = 0;
-   
-   foreach_iter(exec_list_iterator, iter, this->instructions) {
-      glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
-      
-      if (inst->dst.file == PROGRAM_TEMPORARY && inst->dst.index == index)
-         last = (depth == 0) ? i : -2;
-      
-      if (inst->op == TGSI_OPCODE_BGNLOOP)
-         depth++;
-      else if (inst->op == TGSI_OPCODE_ENDLOOP)
-         if (--depth == 0 && last == -2)
-            last = i;
-      assert(depth >= 0);
-      
-      i++;
+   /** Index of the first entry recorded at \p level or deeper. */
+   int block_start(int level)
+   {
+      int i = this->count;
+
+      while (i > 0 && this->level[i - 1] >= level)
+         i--;
+      return i;
    }
-   
-   assert(last >= -1);
-   return last;
-}
+
+   void *mem_ctx;
+   int *chan;
+   int *level;
+   int count;
+   int size;
+};
 
 /*
  * On a basic block basis, tracks available PROGRAM_TEMPORARY register
@@ -3186,6 +3210,32 @@ glsl_to_tgsi_visitor::get_last_temp_write(int index)
  *
  * which allows for dead code elimination on TEMP[1]'s writes.
  */
+static void
+acp_clear_copies(glsl_to_tgsi_instruction **acp, int *head,
+                 const int *copy_chan, int *copy_next,
+                 gl_register_file file, int index, int writemask)
+{
+   int *link = head;
+
+   while (*link >= 0) {
+      int chan = copy_chan[*link];
+      glsl_to_tgsi_instruction *copy = acp[chan];
+
+      if (copy && copy->src[0].file == file && copy->src[0].index == index) {
+         int src_chan = GET_SWZ(copy->src[0].swizzle, chan % 4);
+
+         if (!(writemask & (1 << src_chan))) {
+            link = &copy_next[*link];
+            continue;
+         }
+         acp[chan] = NULL;
+      }
+
+      /* The channel no longer holds a copy of this register. */
+      *link = copy_next[*link];
+   }
+}
+
 void
 glsl_to_tgsi_visitor::copy_propagate(void)
 {
@@ -3194,6 +3244,20 @@ glsl_to_tgsi_visitor::copy_propagate(void)
         					    this->next_temp * 4);
    int *acp_level = rzalloc_array(mem_ctx, int, this->next_temp * 4);
    int level = 0;
+   channel_log log(mem_ctx);
+
+   /* For each temporary and output register, the ACP channels that may hold
+    * a copy of it, linked through copy_chan and copy_next, so that a write
+    * to a register only has to look at its own copies.
+    */
+   int *temp_copies = ralloc_array(mem_ctx, int, this->next_temp);
+   int output_copies[MAX_PROGRAM_OUTPUTS];
+   int copies_size = 64, num_copies = 0;
+   int *copy_chan = ralloc_array(mem_ctx, int, copies_size);
+   int *copy_next = ralloc_array(mem_ctx, int, copies_size);
+
+   memset(temp_copies, 0xff, sizeof(int) * this->next_temp);
+   memset(output_copies, 0xff, sizeof(output_copies));
 
    foreach_iter(exec_list_iterator, iter, this->instructions) {
       glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
@@ -3259,7 +3323,9 @@ glsl_to_tgsi_visitor::copy_propagate(void)
       case TGSI_OPCODE_BGNLOOP:
       case TGSI_OPCODE_ENDLOOP:
          /* End of a basic block, clear the ACP entirely. */
-         memset(acp, 0, sizeof(*acp) * this->next_temp * 4);
+         for (int i = 0; i < log.count; i++)
+            acp[log.chan[i]] = NULL;
+         log.count = 0;
          break;
 
       case TGSI_OPCODE_IF:
@@ -3267,22 +3333,22 @@ glsl_to_tgsi_visitor::copy_propagate(void)
          break;
 
       case TGSI_OPCODE_ENDIF:
-      case TGSI_OPCODE_ELSE:
+      case TGSI_OPCODE_ELSE: {
          /* Clear all channels written inside the block from the ACP, but
           * leaving those that were not touched.
           */
-         for (int r = 0; r < this->next_temp; r++) {
-            for (int c = 0; c < 4; c++) {
-               if (!acp[4 * r + c])
-        	  continue;
+         int start = log.block_start(level);
 
-               if (acp_level[4 * r + c] >= level)
-        	  acp[4 * r + c] = NULL;
-            }
+         for (int i = start; i < log.count; i++) {
+            if (acp_level[log.chan[i]] >= level)
+               acp[log.chan[i]] = NULL;
          }
+         log.count = start;
+
          if (inst->op == TGSI_OPCODE_ENDIF)
             --level;
          break;
+      }
 
       default:
          /* Continuing the block, clear any written channels from
@@ -3292,20 +3358,17 @@ glsl_to_tgsi_visitor::copy_propagate(void)
             /* Any temporary might be written, so no copy propagation
              * across this instruction.
              */
-            memset(acp, 0, sizeof(*acp) * this->next_temp * 4);
+            for (int i = 0; i < log.count; i++)
+               acp[log.chan[i]] = NULL;
+            log.count = 0;
          } else if (inst->dst.file == PROGRAM_OUTPUT &&
         	    inst->dst.reladdr) {
             /* Any output might be written, so no copy propagation
              * from outputs across this instruction.
              */
-            for (int r = 0; r < this->next_temp; r++) {
-               for (int c = 0; c < 4; c++) {
-        	  if (!acp[4 * r + c])
-        	     continue;
-
-        	  if (acp[4 * r + c]->src[0].file == PROGRAM_OUTPUT)
-        	     acp[4 * r + c] = NULL;
-               }
+            for (int r = 0; r < MAX_PROGRAM_OUTPUTS; r++) {
+               acp_clear_copies(acp, &output_copies[r], copy_chan, copy_next,
+                                PROGRAM_OUTPUT, r, ~0);
             }
          } else if (inst->dst.file == PROGRAM_TEMPORARY ||
         	    inst->dst.file == PROGRAM_OUTPUT) {
@@ -3319,21 +3382,16 @@ glsl_to_tgsi_visitor::copy_propagate(void)
             }
 
             /* Clear where it's used as src. */
-            for (int r = 0; r < this->next_temp; r++) {
-               for (int c = 0; c < 4; c++) {
-        	  if (!acp[4 * r + c])
-        	     continue;
-
-        	  int src_chan = GET_SWZ(acp[4 * r + c]->src[0].swizzle, c);
-
-        	  if (acp[4 * r + c]->src[0].file == inst->dst.file &&
-        	      acp[4 * r + c]->src[0].index == inst->dst.index &&
-        	      inst->dst.writemask & (1 << src_chan))
-        	  {
-        	     acp[4 * r + c] = NULL;
-        	  }
-               }
+            int *copies;
+            if (inst->dst.file == PROGRAM_TEMPORARY) {
+               copies = &temp_copies[inst->dst.index];
+            } else {
+               assert(inst->dst.index < MAX_PROGRAM_OUTPUTS);
+               copies = &output_copies[inst->dst.index];
             }
+            acp_clear_copies(acp, copies, copy_chan, copy_next,
+                             inst->dst.file, inst->dst.index,
+                             inst->dst.writemask);
          }
          break;
       }
@@ -3345,15 +3403,39 @@ glsl_to_tgsi_visitor::copy_propagate(void)
           !inst->saturate &&
           !inst->src[0].reladdr &&
           !inst->src[0].negate) {
+         int *copies = NULL;
+
+         if (inst->src[0].file == PROGRAM_TEMPORARY)
+            copies = &temp_copies[inst->src[0].index];
+         else if (inst->src[0].file == PROGRAM_OUTPUT)
+            copies = &output_copies[inst->src[0].index];
+
          for (int i = 0; i < 4; i++) {
             if (inst->dst.writemask & (1 << i)) {
                acp[4 * inst->dst.index + i] = inst;
                acp_level[4 * inst->dst.index + i] = level;
+               log.push(4 * inst->dst.index + i, level);
+
+               if (copies) {
+                  if (num_copies == copies_size) {
+                     copies_size *= 2;
+                     copy_chan = reralloc(mem_ctx, copy_chan, int,
+                                          copies_size);
+                     copy_next = reralloc(mem_ctx, copy_next, int,
+                                          copies_size);
+                  }
+                  copy_chan[num_copies] = 4 * inst->dst.index + i;
+                  copy_next[num_copies] = *copies;
+                  *copies = num_copies++;
+               }
             }
          }
       }
    }
 
+   ralloc_free(copy_next);
+   ralloc_free(copy_chan);
+   ralloc_free(temp_copies);
    ralloc_free(acp_level);
    ralloc_free(acp);
 }
@@ -3379,25 +3461,34 @@ glsl_to_tgsi_visitor::copy_propagate(void)
 void
 glsl_to_tgsi_visitor::eliminate_dead_code(void)
 {
-   int i;
-   
-   for (i=0; i < this->next_temp; i++) {
-      int last_read = get_last_temp_read(i);
+   int *last_reads = rzalloc_array(mem_ctx, int, this->next_temp);
+   bool progress;
+
+   /* Removing a write may remove the last read of another register, so
+    * repeat until nothing changes.
+    */
+   do {
       int j = 0;
-      
+
+      progress = false;
+      get_temp_live_ranges(NULL, NULL, last_reads, NULL);
+
       foreach_iter(exec_list_iterator, iter, this->instructions) {
          glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
 
-         if (inst->dst.file == PROGRAM_TEMPORARY && inst->dst.index == i &&
-             j > last_read)
+         if (inst->dst.file == PROGRAM_TEMPORARY &&
+             j > last_reads[inst->dst.index])
          {
             iter.remove();
             delete inst;
+            progress = true;
          }
          
          j++;
       }
-   }
+   } while (progress);
+
+   ralloc_free(last_reads);
 }
 
 /*
@@ -3421,6 +3512,7 @@ glsl_to_tgsi_visitor::eliminate_dead_code_advanced(void)
    int *write_level = rzalloc_array(mem_ctx, int, this->next_temp * 4);
    int level = 0;
    int removed = 0;
+   channel_log log(mem_ctx);
 
    foreach_iter(exec_list_iterator, iter, this->instructions) {
       glsl_to_tgsi_instruction *inst = (glsl_to_tgsi_instruction *)iter.get();
@@ -3441,28 +3533,36 @@ glsl_to_tgsi_visitor::eliminate_dead_code_advanced(void)
           * dead code of this type, so it shouldn't make a difference as long as
           * the dead code elimination pass in the GLSL compiler does its job.
           */
-         memset(writes, 0, sizeof(*writes) * this->next_temp * 4);
+         for (int i = 0; i < log.count; i++)
+            writes[log.chan[i]] = NULL;
+         log.count = 0;
          break;
 
       case TGSI_OPCODE_ENDIF:
-      case TGSI_OPCODE_ELSE:
+      case TGSI_OPCODE_ELSE: {
          /* Promote the recorded level of all channels written inside the
           * preceding if or else block to the level above the if/else block.
           */
-         for (int r = 0; r < this->next_temp; r++) {
-            for (int c = 0; c < 4; c++) {
-               if (!writes[4 * r + c])
-        	         continue;
+         int start = log.block_start(level);
+         int kept = start;
 
-               if (write_level[4 * r + c] == level)
-        	         write_level[4 * r + c] = level-1;
+         for (int i = start; i < log.count; i++) {
+            int chan = log.chan[i];
+
+            if (writes[chan] && write_level[chan] == level) {
+               write_level[chan] = level-1;
+               log.chan[kept] = chan;
+               log.level[kept] = level-1;
+               kept++;
             }
          }
+         log.count = kept;
 
          if(inst->op == TGSI_OPCODE_ENDIF)
             --level;
          
          break;
+      }
 
       case TGSI_OPCODE_IF:
          ++level;
@@ -3477,7 +3577,9 @@ glsl_to_tgsi_visitor::eliminate_dead_code_advanced(void)
                /* Any temporary might be read, so no dead code elimination 
                 * across this instruction.
                 */
-               memset(writes, 0, sizeof(*writes) * this->next_temp * 4);
+               for (int j = 0; j < log.count; j++)
+                  writes[log.chan[j]] = NULL;
+               log.count = 0;
             } else if (inst->src[i].file == PROGRAM_TEMPORARY) {
                /* Clear where it's used as src. */
                int src_chans = 1 << GET_SWZ(inst->src[i].swizzle, 0);
@@ -3512,6 +3614,7 @@ glsl_to_tgsi_visitor::eliminate_dead_code_advanced(void)
                }
                writes[4 * inst->dst.index + c] = inst;
                write_level[4 * inst->dst.index + c] = level;
+               log.push(4 * inst->dst.index + c, level);
             }
          }
       }
@@ -3558,15 +3661,16 @@ glsl_to_tgsi_visitor::merge_registers(void)
 {
    int *last_reads = rzalloc_array(mem_ctx, int, this->next_temp);
    int *first_writes = rzalloc_array(mem_ctx, int, this->next_temp);
+   int *renames = rzalloc_array(mem_ctx, int, this->next_temp);
    int i, j;
    
    /* Read the indices of the last read and first write to each temp register
     * into an array so that we don't have to traverse the instruction list as 
     * much. */
-   for (i=0; i < this->next_temp; i++) {
-      last_reads[i] = get_last_temp_read(i);
-      first_writes[i] = get_first_temp_write(i);
-   }
+   get_temp_live_ranges(NULL, first_writes, last_reads, NULL);
+
+   for (i=0; i < this->next_temp; i++)
+      renames[i] = i;
    
    /* Start looking for registers with non-overlapping usages that can be 
     * merged together. */
@@ -3585,7 +3689,7 @@ glsl_to_tgsi_visitor::merge_registers(void)
          if (first_writes[i] <= first_writes[j] && 
              last_reads[i] <= first_writes[j])
          {
-            rename_temp_register(j, i); /* Replace all references to j with i.*/
+            renames[j] = i; /* Replace all references to j with i.*/
             
             /* Update the first_writes and last_reads arrays with the new 
              * values for the merged register index, and mark the newly unused 
@@ -3597,6 +3701,18 @@ glsl_to_tgsi_visitor::merge_registers(void)
       }
    }
    
+   /* Registers may have been merged into one that was itself merged later,
+    * so follow the renames to the end before rewriting the program.
+    */
+   for (i=0; i < this->next_temp; i++) {
+      j = renames[i];
+      while (renames[j] != j)
+         j = renames[j];
+      renames[i] = j;
+   }
+   rename_temp_registers(renames);
+
+   ralloc_free(renames);
    ralloc_free(last_reads);
    ralloc_free(first_writes);
 }
@@ -3606,17 +3722,26 @@ glsl_to_tgsi_visitor::merge_registers(void)
 void
 glsl_to_tgsi_visitor::renumber_registers(void)
 {
+   int *first_reads = rzalloc_array(mem_ctx, int, this->next_temp);
+   int *renames = rzalloc_array(mem_ctx, int, this->next_temp);
    int i = 0;
    int new_index = 0;
    
+   get_temp_live_ranges(first_reads, NULL, NULL, NULL);
+
    for (i=0; i < this->next_temp; i++) {
-      if (get_first_temp_read(i) < 0) continue;
-      if (i != new_index)
-         rename_temp_register(i, new_index);
-      new_index++;
+      if (first_reads[i] < 0) {
+         renames[i] = i;
+         continue;
+      }
+      renames[i] = new_index++;
    }
+   rename_temp_registers(renames);
    
    this->next_temp = new_index;
+
+   ralloc_free(renames);
+   ralloc_free(first_reads);
 }
 
 /**
@@ -4829,21 +4954,34 @@ get_mesa_program(struct gl_context *ctx,
 #if 0
    /* Print out some information (for debugging purposes) used by the 
     * optimization passes. */
-   for (i=0; i < v->next_temp; i++) {
-      int fr = v->get_first_temp_read(i);
-      int fw = v->get_first_temp_write(i);
-      int lr = v->get_last_temp_read(i);
-      int lw = v->get_last_temp_write(i);
-      
-      printf("Temp %d: FR=%3d FW=%3d LR=%3d LW=%3d\n", i, fr, fw, lr, lw);
-      assert(fw <= fr);
+   {
+      int *fr = rzalloc_array(v->mem_ctx, int, v->next_temp);
+      int *fw = rzalloc_array(v->mem_ctx, int, v->next_temp);
+      int *lr = rzalloc_array(v->mem_ctx, int, v->next_temp);
+      int *lw = rzalloc_array(v->mem_ctx, int, v->next_temp);
+
+      v->get_temp_live_ranges(fr, fw, lr, lw);
+      for (int i=0; i < v->next_temp; i++) {
+         printf("Temp %d: FR=%3d FW=%3d LR=%3d LW=%3d\n",
+                i, fr[i], fw[i], lr[i], lw[i]);
+         assert(fw[i] <= fr[i]);
+      }
    }
 #endif
 
-   /* Perform optimizations on the instructions in the glsl_to_tgsi_visitor. */
+   /* Perform optimizations on the instructions in the glsl_to_tgsi_visitor,
+    * timing each pass for ST_DEBUG=opt.
+    */
+   int64_t pass_time[7];
+   int num_temps = v->next_temp;
+
+   pass_time[0] = os_time_get();
    v->simplify_cmp();
+   pass_time[1] = os_time_get();
    v->copy_propagate();
+   pass_time[2] = os_time_get();
    while (v->eliminate_dead_code_advanced());
+   pass_time[3] = os_time_get();
 
    /* FIXME: These passes to optimize temporary registers don't work when there
     * is indirect addressing of the temporary register space.  We need proper 
@@ -4852,8 +4990,35 @@ get_mesa_program(struct gl_context *ctx,
     */
    if (!v->indirect_addr_temps) {
       v->eliminate_dead_code();
+      pass_time[4] = os_time_get();
       v->merge_registers();
+      pass_time[5] = os_time_get();
       v->renumber_registers();
+      pass_time[6] = os_time_get();
+   } else {
+      pass_time[4] = pass_time[5] = pass_time[6] = pass_time[3];
+   }
+
+   if (ST_DEBUG & DEBUG_OPT) {
+      unsigned num_insts = 0;
+
+      foreach_iter(exec_list_iterator, iter, v->instructions)
+         num_insts++;
+
+      debug_printf("%s program %d: %u instructions, %d -> %d temps, "
+                   "%u us: simplify_cmp %u, copy_propagate %u, "
+                   "eliminate_dead_code_advanced %u, "
+                   "eliminate_dead_code %u, merge_registers %u, "
+                   "renumber_registers %u\n",
+                   target_string, shader_program->Name, num_insts,
+                   num_temps, v->next_temp,
+                   (unsigned) (pass_time[6] - pass_time[0]),
+                   (unsigned) (pass_time[1] - pass_time[0]),
+                   (unsigned) (pass_time[2] - pass_time[1]),
+                   (unsigned) (pass_time[3] - pass_time[2]),
+                   (unsigned) (pass_time[4] - pass_time[3]),
+                   (unsigned) (pass_time[5] - pass_time[4]),
+                   (unsigned) (pass_time[6] - pass_time[5]));
    }
    
    /* Write the END instruction. */
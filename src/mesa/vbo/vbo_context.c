@@ -216,6 +216,8 @@ void _vbo_DestroyContext( struct gl_context *ctx )
    if (vbo) {
       GLuint i;
 
+      vbo_print_minmax_stats(ctx);
+
       for (i = 0; i < VBO_ATTRIB_MAX; i++) {
          _mesa_reference_buffer_object(ctx, &vbo->currval[i].BufferObj, NULL);
       }
@@ -74,9 +74,19 @@ struct vbo_context {
     * is responsible for initiating any fallback actions required:
     */
    vbo_draw_func draw_prims;
+
+   /** Index bounds cache statistics, see vbo_minmax_index.c */
+   /*@{*/
+   GLuint64 minmax_cache_hits;
+   GLuint64 minmax_cache_misses;
+   GLuint64 minmax_uncached;    /**< Scans of user or uncacheable indices */
+   /*@}*/
 };
 
 
+void vbo_print_minmax_stats(struct gl_context *ctx);
+
+
 static inline struct vbo_context *vbo_context(struct gl_context *ctx) 
 {
    return (struct vbo_context *)(ctx->swtnl_im);
@@ -0,0 +1,645 @@
+/*
+ * Mesa 3-D graphics library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file vbo_minmax_index.c
+ * Index bounds of glDrawElements() calls.
+ *
+ * Finding the smallest and largest index of a draw means mapping the index
+ * buffer, which may wait for the GPU, and reading every index.  Since most
+ * applications draw the same ranges of static index buffers every frame,
+ * the results for buffer objects are cached per buffer, keyed by the range
+ * and the primitive restart state.  The cache is dropped whenever the buffer
+ * is written through the GL API.  Buffers which the GL itself may write,
+ * i.e. pixel pack and transform feedback buffers, aren't cached at all.
+ */
+
+
+#include "main/glheader.h"
+#include "main/context.h"
+#include "main/bufferobj.h"
+#include "main/imports.h"
+#include "main/macros.h"
+#include "program/hash_table.h"
+
+#include "vbo_context.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/** The cache is cleared when it grows beyond this */
+#define MAX_MINMAX_CACHE_ENTRIES 64
+
+/** Ranges with fewer indices are scanned, which is cheaper than caching */
+#define MIN_MINMAX_CACHE_COUNT 64
+
+
+struct minmax_cache_key
+{
+   GLintptr offset;
+   GLuint count;
+   GLenum type;
+   GLuint restart_index;        /**< ~0 if primitive restart is disabled */
+   GLboolean restart;
+};
+
+
+struct minmax_cache_entry
+{
+   struct minmax_cache_key key;
+   GLuint min;
+   GLuint max;
+};
+
+
+struct vbo_minmax_cache
+{
+   struct hash_table *ht;
+   GLuint num_entries;
+
+   /** Indices read from the cache and scanned, to detect streamed buffers */
+   /*@{*/
+   GLuint64 hit_indices;
+   GLuint64 miss_indices;
+   /*@}*/
+};
+
+
+static unsigned
+minmax_cache_hash(const void *key)
+{
+   const struct minmax_cache_key *k = (const struct minmax_cache_key *) key;
+   unsigned hash;
+
+   hash = (unsigned) k->offset;
+   hash = hash * 31 + k->count;
+   hash = hash * 31 + k->type;
+   hash = hash * 31 + k->restart_index;
+   return hash;
+}
+
+
+static int
+minmax_cache_compare(const void *key1, const void *key2)
+{
+   return memcmp(key1, key2, sizeof(struct minmax_cache_key));
+}
+
+
+static void
+free_entry(const void *key, void *data, void *closure)
+{
+   (void) key;
+   (void) closure;
+   free(data);
+}
+
+
+static void
+clear_cache(struct vbo_minmax_cache *cache)
+{
+   hash_table_call_foreach(cache->ht, free_entry, NULL);
+   hash_table_clear(cache->ht);
+   cache->num_entries = 0;
+}
+
+
+/**
+ * Free the index range cache of a buffer object.  Called when the buffer
+ * object is deleted.
+ */
+void
+vbo_delete_minmax_cache(struct gl_buffer_object *bufferObj)
+{
+   struct vbo_minmax_cache *cache = bufferObj->MinMaxCache;
+
+   if (cache == NULL)
+      return;
+
+   clear_cache(cache);
+   hash_table_dtor(cache->ht);
+   free(cache);
+   bufferObj->MinMaxCache = NULL;
+}
+
+
+/**
+ * Return the cache of a buffer object, or NULL if the buffer shouldn't be
+ * cached.  Called with the buffer object's mutex held.
+ */
+static struct vbo_minmax_cache *
+get_cache(struct gl_buffer_object *bufferObj)
+{
+   struct vbo_minmax_cache *cache = bufferObj->MinMaxCache;
+
+   if (bufferObj->MinMaxCacheDisabled)
+      return NULL;
+
+   if (cache == NULL) {
+      cache = CALLOC_STRUCT(vbo_minmax_cache);
+      if (cache == NULL)
+         return NULL;
+
+      cache->ht = hash_table_ctor(MAX_MINMAX_CACHE_ENTRIES,
+                                  minmax_cache_hash, minmax_cache_compare);
+      if (cache->ht == NULL) {
+         free(cache);
+         return NULL;
+      }
+
+      bufferObj->MinMaxCache = cache;
+      bufferObj->MinMaxCacheDirty = GL_FALSE;
+   }
+
+   if (bufferObj->MinMaxCacheDirty) {
+      /* Buffers rewritten before the cache paid off are probably streamed,
+       * and will only ever miss.
+       */
+      if (cache->hit_indices < cache->miss_indices) {
+         vbo_delete_minmax_cache(bufferObj);
+         bufferObj->MinMaxCacheDisabled = GL_TRUE;
+         return NULL;
+      }
+
+      clear_cache(cache);
+      bufferObj->MinMaxCacheDirty = GL_FALSE;
+   }
+
+   return cache;
+}
+
+
+static GLboolean
+cache_lookup(struct gl_buffer_object *bufferObj,
+             const struct minmax_cache_key *key,
+             GLuint *min_index, GLuint *max_index)
+{
+   struct vbo_minmax_cache *cache;
+   struct minmax_cache_entry *entry = NULL;
+
+   _glthread_LOCK_MUTEX(bufferObj->Mutex);
+
+   cache = get_cache(bufferObj);
+   if (cache) {
+      entry = hash_table_find(cache->ht, key);
+      if (entry) {
+         *min_index = entry->min;
+         *max_index = entry->max;
+         cache->hit_indices += key->count;
+      }
+   }
+
+   _glthread_UNLOCK_MUTEX(bufferObj->Mutex);
+
+   return entry != NULL;
+}
+
+
+/**
+ * Remember the bounds of the indices described by \p key.  Returns false if
+ * the buffer object does not cache them.
+ */
+static GLboolean
+cache_store(struct gl_buffer_object *bufferObj,
+            const struct minmax_cache_key *key,
+            GLuint min_index, GLuint max_index)
+{
+   struct vbo_minmax_cache *cache;
+   struct minmax_cache_entry *entry;
+
+   _glthread_LOCK_MUTEX(bufferObj->Mutex);
+
+   cache = get_cache(bufferObj);
+   if (cache == NULL) {
+      _glthread_UNLOCK_MUTEX(bufferObj->Mutex);
+      return GL_FALSE;
+   }
+
+   cache->miss_indices += key->count;
+
+   /* Another context may have stored it meanwhile. */
+   if (hash_table_find(cache->ht, key))
+      goto out;
+
+   if (cache->num_entries == MAX_MINMAX_CACHE_ENTRIES)
+      clear_cache(cache);
+
+   entry = MALLOC_STRUCT(minmax_cache_entry);
+   if (entry == NULL)
+      goto out;
+
+   entry->key = *key;
+   entry->min = min_index;
+   entry->max = max_index;
+   hash_table_insert(cache->ht, entry, &entry->key);
+   cache->num_entries++;
+
+out:
+   _glthread_UNLOCK_MUTEX(bufferObj->Mutex);
+   return GL_TRUE;
+}
+
+
+/**
+ * Scalar scan of indices [start, end), folded into the min_ui and max_ui
+ * locals of the caller.  Restart indices are skipped when \p restart is set.
+ */
+#define SCAN_INDICES(type, indices, start, end)                          \
+do {                                                                     \
+   const type *ip = (const type *) (indices);                            \
+   GLuint j;                                                             \
+   if (restart) {                                                        \
+      for (j = (start); j < (end); j++) {                                \
+         if (ip[j] != restartIndex) {                                    \
+            if (ip[j] > max_ui) max_ui = ip[j];                          \
+            if (ip[j] < min_ui) min_ui = ip[j];                          \
+         }                                                               \
+      }                                                                  \
+   }                                                                     \
+   else {                                                                \
+      for (j = (start); j < (end); j++) {                                \
+         if (ip[j] > max_ui) max_ui = ip[j];                             \
+         if (ip[j] < min_ui) min_ui = ip[j];                             \
+      }                                                                  \
+   }                                                                     \
+} while (0)
+
+
+/**
+ * Number of leading indices to scan before the rest are 16-byte aligned.
+ * They are only if the index pointer is a multiple of the index size,
+ * which GL doesn't require of element array offsets, so the SIMD loops
+ * use unaligned loads.
+ */
+static inline GLuint
+align_head(const void *indices, GLuint index_size, GLuint count)
+{
+   GLuint head = ((16 - ((uintptr_t) indices & 15)) & 15) / index_size;
+   return MIN2(head, count);
+}
+
+
+#ifdef __SSE2__
+
+/*
+ * SSE2 has no unsigned 16 and 32-bit min/max, so these flip the sign bit and
+ * use signed comparisons.  Restart indices are replaced with values which
+ * don't change the result: all ones for the minimum, zero for the maximum.
+ */
+
+static inline __m128i
+min_epi32(__m128i a, __m128i b)
+{
+   __m128i gt = _mm_cmpgt_epi32(a, b);
+   return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+
+static inline __m128i
+max_epi32(__m128i a, __m128i b)
+{
+   __m128i gt = _mm_cmpgt_epi32(a, b);
+   return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+
+static void
+minmax_uint(const GLuint *indices, GLuint count,
+            GLboolean restart, GLuint restartIndex,
+            GLuint *min_index, GLuint *max_index)
+{
+   const __m128i bias = _mm_set1_epi32(0x80000000);
+   const __m128i restart_vec = _mm_set1_epi32(restartIndex);
+   __m128i vmin = _mm_set1_epi32(0x7fffffff);
+   __m128i vmax = bias;
+   GLuint max_ui = 0, min_ui = ~0U;
+   GLuint head = align_head(indices, sizeof(GLuint), count);
+   GLuint i, mins[4], maxs[4];
+
+   SCAN_INDICES(GLuint, indices, 0, head);
+
+   for (i = head; i + 4 <= count; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i *) (indices + i));
+      __m128i lo = v, hi = v;
+
+      if (restart) {
+         __m128i eq = _mm_cmpeq_epi32(v, restart_vec);
+         lo = _mm_or_si128(v, eq);
+         hi = _mm_andnot_si128(eq, v);
+      }
+
+      vmin = min_epi32(vmin, _mm_xor_si128(lo, bias));
+      vmax = max_epi32(vmax, _mm_xor_si128(hi, bias));
+   }
+
+   SCAN_INDICES(GLuint, indices, i, count);
+
+   _mm_storeu_si128((__m128i *) mins, _mm_xor_si128(vmin, bias));
+   _mm_storeu_si128((__m128i *) maxs, _mm_xor_si128(vmax, bias));
+   for (i = 0; i < 4; i++) {
+      min_ui = MIN2(min_ui, mins[i]);
+      max_ui = MAX2(max_ui, maxs[i]);
+   }
+
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+
+static void
+minmax_ushort(const GLushort *indices, GLuint count,
+              GLboolean restart, GLuint restartIndex,
+              GLuint *min_index, GLuint *max_index)
+{
+   const __m128i bias = _mm_set1_epi16((short) 0x8000);
+   const __m128i restart_vec = _mm_set1_epi16((short) restartIndex);
+   /* A restart index that doesn't fit never matches. */
+   const GLboolean mask = restart && restartIndex <= 0xffff;
+   __m128i vmin = _mm_set1_epi16(0x7fff);
+   __m128i vmax = bias;
+   GLuint max_ui = 0, min_ui = ~0U;
+   GLuint head = align_head(indices, sizeof(GLushort), count);
+   GLuint i;
+   GLushort mins[8], maxs[8];
+
+   SCAN_INDICES(GLushort, indices, 0, head);
+
+   for (i = head; i + 8 <= count; i += 8) {
+      __m128i v = _mm_loadu_si128((const __m128i *) (indices + i));
+      __m128i lo = v, hi = v;
+
+      if (mask) {
+         __m128i eq = _mm_cmpeq_epi16(v, restart_vec);
+         lo = _mm_or_si128(v, eq);
+         hi = _mm_andnot_si128(eq, v);
+      }
+
+      vmin = _mm_min_epi16(vmin, _mm_xor_si128(lo, bias));
+      vmax = _mm_max_epi16(vmax, _mm_xor_si128(hi, bias));
+   }
+
+   SCAN_INDICES(GLushort, indices, i, count);
+
+   _mm_storeu_si128((__m128i *) mins, _mm_xor_si128(vmin, bias));
+   _mm_storeu_si128((__m128i *) maxs, _mm_xor_si128(vmax, bias));
+   for (i = 0; i < 8; i++) {
+      min_ui = MIN2(min_ui, mins[i]);
+      max_ui = MAX2(max_ui, maxs[i]);
+   }
+
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+
+static void
+minmax_ubyte(const GLubyte *indices, GLuint count,
+             GLboolean restart, GLuint restartIndex,
+             GLuint *min_index, GLuint *max_index)
+{
+   const __m128i restart_vec = _mm_set1_epi8((char) restartIndex);
+   const GLboolean mask = restart && restartIndex <= 0xff;
+   __m128i vmin = _mm_set1_epi8((char) 0xff);
+   __m128i vmax = _mm_setzero_si128();
+   GLuint max_ui = 0, min_ui = ~0U;
+   GLuint head = align_head(indices, sizeof(GLubyte), count);
+   GLuint i;
+   GLubyte mins[16], maxs[16];
+
+   SCAN_INDICES(GLubyte, indices, 0, head);
+
+   for (i = head; i + 16 <= count; i += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i *) (indices + i));
+      __m128i lo = v, hi = v;
+
+      if (mask) {
+         __m128i eq = _mm_cmpeq_epi8(v, restart_vec);
+         lo = _mm_or_si128(v, eq);
+         hi = _mm_andnot_si128(eq, v);
+      }
+
+      vmin = _mm_min_epu8(vmin, lo);
+      vmax = _mm_max_epu8(vmax, hi);
+   }
+
+   SCAN_INDICES(GLubyte, indices, i, count);
+
+   _mm_storeu_si128((__m128i *) mins, vmin);
+   _mm_storeu_si128((__m128i *) maxs, vmax);
+   for (i = 0; i < 16; i++) {
+      min_ui = MIN2(min_ui, mins[i]);
+      max_ui = MAX2(max_ui, maxs[i]);
+   }
+
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+#else /* __SSE2__ */
+
+static void
+minmax_uint(const GLuint *indices, GLuint count,
+            GLboolean restart, GLuint restartIndex,
+            GLuint *min_index, GLuint *max_index)
+{
+   GLuint max_ui = 0, min_ui = ~0U;
+   SCAN_INDICES(GLuint, indices, 0, count);
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+
+static void
+minmax_ushort(const GLushort *indices, GLuint count,
+              GLboolean restart, GLuint restartIndex,
+              GLuint *min_index, GLuint *max_index)
+{
+   GLuint max_ui = 0, min_ui = ~0U;
+   SCAN_INDICES(GLushort, indices, 0, count);
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+
+static void
+minmax_ubyte(const GLubyte *indices, GLuint count,
+             GLboolean restart, GLuint restartIndex,
+             GLuint *min_index, GLuint *max_index)
+{
+   GLuint max_ui = 0, min_ui = ~0U;
+   SCAN_INDICES(GLubyte, indices, 0, count);
+   *min_index = min_ui;
+   *max_index = max_ui;
+}
+
+#endif /* __SSE2__ */
+
+
+/**
+ * Compute min and max elements by scanning the index buffer for
+ * glDraw[Range]Elements() calls.
+ * If primitive restart is enabled, we need to ignore restart
+ * indexes when computing min/max.
+ */
+static void
+vbo_get_minmax_index(struct gl_context *ctx,
+		     const struct _mesa_prim *prim,
+		     const struct _mesa_index_buffer *ib,
+		     GLuint *min_index, GLuint *max_index,
+		     const GLuint count)
+{
+   struct vbo_context *vbo = vbo_context(ctx);
+   const GLboolean restart = ctx->Array.PrimitiveRestart;
+   const GLuint restartIndex = ctx->Array.RestartIndex;
+   const int index_size = vbo_sizeof_ib_type(ib->type);
+   const char *indices;
+   struct minmax_cache_key key;
+   GLboolean cached = GL_FALSE;
+
+   indices = (char *) ib->ptr + prim->start * index_size;
+   if (_mesa_is_bufferobj(ib->obj)) {
+      GLsizeiptr size = MIN2(count * index_size, ib->obj->Size);
+
+      if (count >= MIN_MINMAX_CACHE_COUNT) {
+         memset(&key, 0, sizeof(key));
+         key.offset = (GLintptr) indices;
+         key.count = count;
+         key.type = ib->type;
+         key.restart = restart;
+         key.restart_index = restart ? restartIndex : ~0U;
+
+         if (cache_lookup(ib->obj, &key, min_index, max_index)) {
+            if (vbo)
+               vbo->minmax_cache_hits++;
+            return;
+         }
+         cached = GL_TRUE;
+      }
+
+      indices = ctx->Driver.MapBufferRange(ctx, (GLintptr) indices, size,
+                                           GL_MAP_READ_BIT, ib->obj);
+   }
+
+   switch (ib->type) {
+   case GL_UNSIGNED_INT:
+      minmax_uint((const GLuint *) indices, count, restart, restartIndex,
+                  min_index, max_index);
+      break;
+   case GL_UNSIGNED_SHORT:
+      minmax_ushort((const GLushort *) indices, count, restart, restartIndex,
+                    min_index, max_index);
+      break;
+   case GL_UNSIGNED_BYTE:
+      minmax_ubyte((const GLubyte *) indices, count, restart, restartIndex,
+                   min_index, max_index);
+      break;
+   default:
+      assert(0);
+      *min_index = ~0U;
+      *max_index = 0;
+      break;
+   }
+
+   /* With restart, the SIMD paths may see no index at all, and be left
+    * with the identity values of their type.  Report what the plain loops
+    * would.
+    */
+   if (*min_index > *max_index) {
+      *min_index = ~0U;
+      *max_index = 0;
+   }
+
+   if (_mesa_is_bufferobj(ib->obj)) {
+      ctx->Driver.UnmapBuffer(ctx, ib->obj);
+   }
+
+   if (cached && !cache_store(ib->obj, &key, *min_index, *max_index))
+      cached = GL_FALSE;
+
+   if (vbo) {
+      if (cached)
+         vbo->minmax_cache_misses++;
+      else
+         vbo->minmax_uncached++;
+   }
+}
+
+/**
+ * Compute min and max elements for nr_prims
+ */
+void
+vbo_get_minmax_indices(struct gl_context *ctx,
+                       const struct _mesa_prim *prims,
+                       const struct _mesa_index_buffer *ib,
+                       GLuint *min_index,
+                       GLuint *max_index,
+                       GLuint nr_prims)
+{
+   GLuint tmp_min = ~0U, tmp_max = 0;
+   GLuint i;
+   GLuint count;
+
+   *min_index = ~0;
+   *max_index = 0;
+
+   for (i = 0; i < nr_prims; i++) {
+      const struct _mesa_prim *start_prim;
+
+      start_prim = &prims[i];
+      count = start_prim->count;
+      /* Do combination if possible to reduce map/unmap count */
+      while ((i + 1 < nr_prims) &&
+             (prims[i].start + prims[i].count == prims[i+1].start)) {
+         count += prims[i+1].count;
+         i++;
+      }
+      vbo_get_minmax_index(ctx, start_prim, ib, &tmp_min, &tmp_max, count);
+      *min_index = MIN2(*min_index, tmp_min);
+      *max_index = MAX2(*max_index, tmp_max);
+   }
+}
+
+
+/**
+ * Print the index range cache statistics of a context, if MESA_DEBUG
+ * contains "minmax".
+ */
+void
+vbo_print_minmax_stats(struct gl_context *ctx)
+{
+   struct vbo_context *vbo = vbo_context(ctx);
+   GLuint64 lookups;
+
+   if (!(MESA_DEBUG_FLAGS & DEBUG_MINMAX_CACHE) || vbo == NULL)
+      return;
+
+   lookups = vbo->minmax_cache_hits + vbo->minmax_cache_misses;
+
+   _mesa_debug(ctx, "vbo: index bounds: %llu cache hits, %llu misses "
+               "(%.1f%% hits), %llu scans not cached\n",
+               (unsigned long long) vbo->minmax_cache_hits,
+               (unsigned long long) vbo->minmax_cache_misses,
+               lookups ? 100.0 * vbo->minmax_cache_hits / lookups : 0.0,
+               (unsigned long long) vbo->minmax_uncached);
+}